@@ -0,0 +1,30 @@
+# Sprite sheets and images converted at build time, see "2. Tools/assets.cmake"
+set(SPRITES "${CMAKE_CURRENT_LIST_DIR}")
+
+function(add_sprite_sheets target)
+    image2cpp_sheet(${target} girl
+        DIRS "${SPRITES}/Girl 1/Attack Right" "${SPRITES}/Girl 1/Idle" "${SPRITES}/Girl 1/Walking Right"
+        ARGS --background C40D --pivot bottom --skip-mirrored --delta "*attack*")
+
+    image2cpp_sheet(${target} zombie1
+        DIRS "${SPRITES}/Zombie 1/Attack Right" "${SPRITES}/Zombie 1/Die Right" "${SPRITES}/Zombie 1/Walk Right"
+        ARGS --compress --background C40D --pivot bottom --delta "*attack*,*die*")
+
+    image2cpp_header(${target} jungle_background
+        FILES "${SPRITES}/Backgrounds/jungle_background.png"
+        ARGS --compress)
+
+    image2cpp_header(${target} grass_tiles
+        FILES "${SPRITES}/Grass Tiles/grass_tile_left.png" "${SPRITES}/Grass Tiles/grass_tile_middle.png" "${SPRITES}/Grass Tiles/grass_tile_right.png"
+        ARGS --compress)
+
+    image2cpp_header(${target} hearts
+        FILES "${SPRITES}/Hearts/heart_empty.png" "${SPRITES}/Hearts/heart_full.png" "${SPRITES}/Hearts/heart_half.png"
+        ARGS --transparent 128 --rle)
+
+    image2cpp_header(${target} icons
+        FILES "${SPRITES}/UI/icon_frame.png" "${SPRITES}/UI/icon_school_girl.png")
+
+    image2cpp_header(${target} red_guy_menu
+        FILES "${SPRITES}/Red Guy/red_guy_menu.png")
+endfunction()
@@ -0,0 +1,86 @@
+# Sprite assets built with the firmware instead of checked-in headers.
+#
+#   image2cpp_sheet(<target> <name> DIRS <dir>... [ARGS <image2cpp.py option>...])
+#   image2cpp_header(<target> <name> FILES <png>... [ARGS <image2cpp.py option>...])
+#
+# image2cpp_sheet() packs the PNGs of DIRS into the sheet <name> with
+# image2cpp.py --sheet, image2cpp_header() converts FILES into the arrays
+# of one header with --merge (plain, --rle or --compress, as ARGS say).
+# Both pass --blob: the pixel data becomes <name>.bin, embedded into
+# <target>, and "sprites/<name>.h" only holds the tables and pointers into
+# it. Both are regenerated when a PNG or the tool changes. ESP-IDF builds
+# embed the blob with target_add_binary_data() (call after
+# idf_component_register()), host builds assemble it with .incbin under
+# the same symbol. Needs ${PYTHON} with Pillow.
+#
+# PlatformIO does not run custom commands: pio_sheets.py converts the same
+# assets before the build, as self-contained headers without a blob, and
+# sets RETRO_SHEETS_DIR to where they are. The target then only gets that
+# include directory.
+
+set(IMAGE2CPP "${CMAKE_CURRENT_LIST_DIR}/image2cpp.py")
+get_filename_component(ENGINE_SOURCE_DIR "${CMAKE_CURRENT_LIST_DIR}/../src" ABSOLUTE)
+
+# Runs image2cpp.py on inputs with --blob and embeds the result
+function(_image2cpp_blob target name comment inputs args)
+    set(out_dir "${CMAKE_CURRENT_BINARY_DIR}/assets/sprites")
+    set(header "${out_dir}/${name}.h")
+    set(blob "${out_dir}/${name}.bin")
+
+    add_custom_command(
+        OUTPUT "${header}" "${blob}"
+        COMMAND ${CMAKE_COMMAND} -E make_directory "${out_dir}"
+        COMMAND ${PYTHON} "${IMAGE2CPP}" ${inputs} ${args}
+                --image-header ST7789/image.h --blob "${blob}" -o "${header}"
+        DEPENDS ${inputs} "${IMAGE2CPP}"
+        COMMENT "${comment}"
+        VERBATIM)
+
+    # Nothing the compiler scans depends on the header before it exists,
+    # so tie it to the target explicitly
+    add_custom_target(${name}_asset DEPENDS "${header}" "${blob}")
+    add_dependencies(${target} ${name}_asset)
+    target_include_directories(${target} PRIVATE "${CMAKE_CURRENT_BINARY_DIR}/assets" "${ENGINE_SOURCE_DIR}")
+
+    if(COMMAND target_add_binary_data)
+        target_add_binary_data(${target} "${blob}" BINARY)
+    else()
+        set(asm "${out_dir}/${name}.S")
+        file(WRITE "${asm}"
+            ".section .rodata\n"
+            ".balign 4\n"
+            ".global _binary_${name}_bin_start\n"
+            "_binary_${name}_bin_start:\n"
+            ".incbin \"${blob}\"\n"
+            ".section .note.GNU-stack,\"\",@progbits\n")
+        set_source_files_properties("${asm}" PROPERTIES OBJECT_DEPENDS "${blob}")
+        target_sources(${target} PRIVATE "${asm}")
+    endif()
+endfunction()
+
+function(image2cpp_sheet target name)
+    if(DEFINED ENV{RETRO_SHEETS_DIR})
+        target_include_directories(${target} PRIVATE "$ENV{RETRO_SHEETS_DIR}" "${ENGINE_SOURCE_DIR}")
+        return()
+    endif()
+
+    cmake_parse_arguments(SHEET "" "" "DIRS;ARGS" ${ARGN})
+
+    set(inputs)
+    foreach(dir ${SHEET_DIRS})
+        file(GLOB pngs CONFIGURE_DEPENDS "${dir}/*.png")
+        list(APPEND inputs ${pngs})
+    endforeach()
+
+    _image2cpp_blob(${target} ${name} "Packing sprite sheet ${name}" "${inputs}" "--sheet;${name};${SHEET_ARGS}")
+endfunction()
+
+function(image2cpp_header target name)
+    if(DEFINED ENV{RETRO_SHEETS_DIR})
+        target_include_directories(${target} PRIVATE "$ENV{RETRO_SHEETS_DIR}" "${ENGINE_SOURCE_DIR}")
+        return()
+    endif()
+
+    cmake_parse_arguments(HEADER "" "" "FILES;ARGS" ${ARGN})
+    _image2cpp_blob(${target} ${name} "Converting sprites ${name}" "${HEADER_FILES}" "--merge;${HEADER_ARGS}")
+endfunction()
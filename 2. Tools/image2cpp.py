@@ -1,4 +1,7 @@
+import io
 import re
+import struct
+import fnmatch
 import argparse
 from pathlib import Path
 from PIL import Image
@@ -21,13 +24,356 @@ def sanitize_cpp_identifier(name):
         name = '_' + name
     return name
 
-def convert_image(path, max_w, max_h, alpha_threshold=None):
+# === Panel byte order (the ST7789 takes RGB565 big-endian) ===
+def swap_bytes(value):
+    return ((value & 0xFF) << 8) | (value >> 8)
+
+# === Run-length encoding of transparent sprites ===
+# Per row: span count, then per span: transparent pixels to skip (from the
+# end of the previous span), opaque pixel count and the opaque pixels.
+# Pixels are always stored in panel byte order, draw with drawRle().
+# `skipped` marks the pixels to leave out, by default the transparent ones.
+def encode_rle(pixels, width, height, skipped=None):
+    if skipped is None:
+        skipped = [p == 0x0001 for p in pixels]
+    data = []
+    for y in range(height):
+        row = pixels[y * width:(y + 1) * width]
+        gaps = skipped[y * width:(y + 1) * width]
+        spans = []
+        x = 0
+        while x < width:
+            start = x
+            while x < width and gaps[x]:
+                x += 1
+            skip = x - start
+            opaque = x
+            while x < width and not gaps[x]:
+                x += 1
+            if x > opaque:
+                spans.append((skip, row[opaque:x]))
+        data.append(len(spans))
+        for skip, run in spans:
+            data.append(skip)
+            data.append(len(run))
+            data.extend(swap_bytes(p) for p in run)
+    return data
+
+# === Compressed opaque images (ST7789_Image, draw with drawImage()) ===
+# Every row is encoded on its own so the driver can decode row by row
+# straight into the DMA staging buffer. The smallest lossless format wins:
+#   RGB565   raw pixels, panel byte order
+#   RLE565   uint16 tokens: bit 15 set = (n & 0x7FFF) + 1 literal pixels
+#            follow, clear = the next pixel repeats n + 1 times
+#   PAL8_RLE <= 256 colours, byte tokens: bit 7 set = (n & 0x7F) + 1 literal
+#            indices follow, clear = the next index repeats n + 1 times
+#   PAL8     <= 256 colours, one index byte per pixel
+#   PAL4     <= 16 colours, two indices per byte (high nibble first), rows
+#            padded to a whole byte
+# Palette formats are cheapest to decode and allow palette swaps at draw time.
+FORMATS = ["RGB565", "RLE565", "PAL8_RLE", "PAL8", "PAL4"]
+
+def encode_runs(row, max_len, literal_flag):
+    tokens = []
+    x = 0
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:max_len]
+            del literal[:max_len]
+            tokens.append(literal_flag | (len(chunk) - 1))
+            tokens.extend(chunk)
+
+    while x < len(row):
+        run = 1
+        while x + run < len(row) and row[x + run] == row[x] and run < max_len:
+            run += 1
+        if run >= 3:
+            flush_literal()
+            tokens.append(run - 1)
+            tokens.append(row[x])
+        else:
+            literal.extend(row[x:x + run])
+        x += run
+
+    flush_literal()
+    return tokens
+
+def encode_image(pixels, width, height, fmt=None):
+    rows = [pixels[y * width:(y + 1) * width] for y in range(height)]
+    candidates = []
+
+    raw = [swap_bytes(p) for p in pixels]
+    candidates.append(("RGB565", [], raw, len(raw) * 2))
+
+    rle = []
+    for row in rows:
+        rle.extend(encode_runs([swap_bytes(p) for p in row], 0x8000, 0x8000))
+    candidates.append(("RLE565", [], rle, len(rle) * 2))
+
+    palette = list(dict.fromkeys(pixels))
+    if len(palette) <= 256:
+        index = {c: i for i, c in enumerate(palette)}
+        data = []
+        for row in rows:
+            data.extend(encode_runs([index[p] for p in row], 0x80, 0x80))
+        candidates.append(("PAL8_RLE", [swap_bytes(c) for c in palette], data, len(data) + len(palette) * 2))
+
+        data = [index[p] for p in pixels]
+        candidates.append(("PAL8", [swap_bytes(c) for c in palette], data, len(data) + len(palette) * 2))
+
+    if len(palette) <= 16:
+        data = []
+        for row in rows:
+            indices = [index[p] for p in row] + [0]
+            data.extend((indices[x] << 4) | indices[x + 1] for x in range(0, width, 2))
+        candidates.append(("PAL4", [swap_bytes(c) for c in palette], data, len(data) + len(palette) * 2))
+
+    if fmt:
+        forced = [c for c in candidates if c[0] == fmt]
+        if not forced:
+            raise SystemExit(f"❌ {fmt} does not fit an image with {len(palette)} colours, try --colors")
+        return forced[0]
+
+    return min(candidates, key=lambda c: c[3])
+
+def write_values(f, values, digits):
+    for i, val in enumerate(values):
+        f.write(f"0x{val:0{digits}X}, ")
+        if (i + 1) % 16 == 0:
+            f.write("\n")
+
+# === Binary blobs (--blob) ===
+# The arrays go into one binary file that the build embeds (EMBED_FILES)
+# and the header keeps only the tables, pointing into it. Compiling the
+# data as hex arrays is what makes big sprite headers slow to build.
+# Arrays start 4-byte aligned and hold the same little-endian values.
+class Blob:
+    def __init__(self, path):
+        self.path = Path(path)
+        self.name = sanitize_cpp_identifier(self.path.name)
+        self.data = bytearray()
+
+    # Start symbol of the embedded file, as ESP-IDF names it
+    def declaration(self):
+        return f'extern const uint8_t {self.name}_start[] asm("_binary_{self.name}_start");\n\n'
+
+    def add(self, element, values):
+        self.data.extend(bytes(-len(self.data) % 4))
+        offset = len(self.data)
+        self.data.extend(struct.pack(f"<{len(values)}{'B' if element == 'uint8_t' else 'H'}", *values))
+        return f"({self.name}_start + {offset})"
+
+    def save(self):
+        self.path.write_bytes(self.data)
+
+def write_array(f, element, name, values, blob=None, comment=""):
+    if blob:
+        f.write(f"static const {element} *const {name} = (const {element} *){blob.add(element, values)};{comment}\n")
+        return
+    f.write(f"const {element} {name}[{len(values)}] = {{{comment}\n")
+    write_values(f, values, 2 if element == "uint8_t" else 4)
+    f.write("\n};\n")
+
+def write_image(f, file_name, stem, w, h, pixels, fmt=None, blob=None):
+    fmt, palette, data, size_bytes = encode_image(pixels, w, h, fmt)
+    f.write(f"// {file_name}\n")
+    f.write(f"// Size: {w}x{h}, {fmt} ({size_bytes} of {w * h * 2} bytes)\n")
+
+    palette_name = "nullptr"
+    if palette:
+        palette_name = f"{stem}_palette"
+        write_array(f, "uint16_t", palette_name, palette, blob)
+
+    element = "uint8_t" if fmt.startswith("PAL") else "uint16_t"
+    write_array(f, element, f"{stem}_data", data, blob)
+    f.write(f"const ST7789_Image {stem}_img = {{ {w}, {h}, ST7789_IMAGE_{fmt}, {len(palette)}, {palette_name}, {stem}_data }};\n\n")
+    return size_bytes
+
+# === Sprite sheets (ST7789_Sheet, drawn by frame index with SpriteSheet) ===
+# All inputs become frames of one sheet, in natural order (walk_2 before
+# walk_10). Frames are trimmed to the bounding box of their non-`key`
+# pixels (transparent, or the --background colour opaque art was drawn on,
+# which then never goes over the bus) and packed end to end into one
+# atlas, so every frame is still a contiguous w * h block the driver sends
+# with a single window. Inputs that share a stem up to the trailing frame
+# number form an animation range.
+def natural_key(path):
+    return [int(t) if t.isdigit() else t for t in re.split(r"(\d+)", path.stem)]
+
+def animation_name(stem):
+    return re.sub(r"_?\d+$", "", stem) or stem
+
+def trim_bounds(pixels, width, height, key):
+    if key is None:
+        return 0, 0, width, height
+    xs = [i % width for i, p in enumerate(pixels) if p != key]
+    ys = [i // width for i, p in enumerate(pixels) if p != key]
+    if not xs:
+        return 0, 0, 0, 0
+    return min(xs), min(ys), max(xs) - min(xs) + 1, max(ys) - min(ys) + 1
+
+def crop(pixels, width, x, y, w, h):
+    return [pixels[(y + row) * width + x + col] for row in range(h) for col in range(w)]
+
+def parse_pivot(pivot, w, h):
+    if pivot == "bottom":
+        return w // 2, h
+    if pivot == "center":
+        return w // 2, h // 2
+    x, y = pivot.split(",")
+    return int(x), int(y)
+
+# === Delta frames ===
+# A frame drawn where the previous frame of its range still is on screen
+# only needs the pixels that changed: drawRle() spans over the bounds of
+# the changes (untrimmed frame coordinates). The first frame of a range is
+# the delta from the last one, so loops keep going. Kept only for the
+# animations matching `patterns` and when smaller than the trimmed frame.
+def encode_delta(prev, pixels, width, height):
+    changed = [a != b for a, b in zip(prev, pixels)]
+    if not any(changed):
+        return 0, 0, 1, 1, [0]
+    x, y, w, h = trim_bounds(changed, width, height, False)
+    box = crop(pixels, width, x, y, w, h)
+    skipped = [not c for c in crop(changed, width, x, y, w, h)]
+    return x, y, w, h, encode_rle(box, w, h, skipped)
+
+def delta_table(f, name, frames, table, ranges, patterns, blob=None):
+    deltas = [(0, 0, 0, 0, 0, "nullptr")] * len(frames)
+    delta_bytes = 0
+    for anim, (first, count) in ranges.items():
+        if not any(fnmatch.fnmatch(anim, p) for p in patterns):
+            continue
+        for i in range(first, first + count):
+            prev = i - 1 if i > first else first + count - 1
+            (_, w, h, pixels), (_, pw, ph, prev_pixels) = frames[i], frames[prev]
+            if prev == i or (w, h) != (pw, ph):
+                continue
+            x, y, dw, dh, spans = encode_delta(prev_pixels, pixels, w, h)
+            tw, th = table[i][7:9]
+            if len(spans) >= tw * th:
+                continue
+            write_array(f, "uint16_t", f"{name}_delta_{i}", spans, blob, f"  // {frames[prev][0]} → {frames[i][0]}")
+            f.write("\n")
+            deltas[i] = (prev, x, y, dw, dh, f"{name}_delta_{i}")
+            delta_bytes += len(spans) * 2
+
+    f.write(f"const ST7789_SheetDelta {name}_deltas[{len(deltas)}] = {{\n")
+    for i, (prev, x, y, w, h, spans) in enumerate(deltas):
+        f.write(f"    {{ {prev}, {x}, {y}, {w}, {h}, {spans} }},  // {frames[i][0]}\n")
+    f.write("};\n")
+    return delta_bytes
+
+# frames: (file name, width, height, pixels in native byte order)
+def write_sheet(f, name, frames, kind, key, pivot, include, fmt=None, delta=None, blob=None):
+    body = io.StringIO()
+    table = []
+    atlas = []
+    total_bytes = 0
+
+    for i, (file_name, w, h, pixels) in enumerate(frames):
+        tx, ty, tw, th = trim_bounds(pixels, w, h, key)
+        trimmed = crop(pixels, w, tx, ty, tw, th)
+        px, py = parse_pivot(pivot, w, h)
+
+        if kind == "IMAGE":
+            stem = sanitize_cpp_identifier(Path(file_name).stem)
+            total_bytes += write_image(body, file_name, stem, tw, th, trimmed, fmt, blob) if tw else 0
+            data = f"&{stem}_img" if tw else "nullptr"
+        else:
+            data = f"{name}_pixels + {len(atlas)}"
+            atlas.extend(swap_bytes(p) for p in trimmed)
+            total_bytes += tw * th * 2
+
+        table.append((file_name, w, h, px, py, tx, ty, tw, th, data))
+
+    ranges = {}
+    for i, (file_name, *_rest) in enumerate(frames):
+        anim = sanitize_cpp_identifier(animation_name(Path(file_name).stem))
+        first, count = ranges.get(anim, (i, 0))
+        ranges[anim] = (first, count + 1)
+
+    if kind != "IMAGE":
+        write_array(body, "uint16_t", f"{name}_pixels", atlas, blob)
+        body.write("\n")
+
+    delta_bytes = delta_table(body, name, frames, table, ranges, delta, blob) if delta else 0
+    deltas_name = f"{name}_deltas" if delta else "nullptr"
+
+    raw_bytes = sum(w * h * 2 for _, w, h, _ in frames)
+    f.write(f"// Sheet {name}: {len(frames)} frames, {total_bytes} of {raw_bytes} bytes after trimming\n")
+    if delta:
+        f.write(f"// Deltas: {delta_bytes} bytes, draw through SpriteLayer on a framebuffer\n")
+    f.write(f"// Format: ST7789_SHEET_{kind}, draw with SpriteSheet / Animation\n\n")
+    f.write(f'#include "{include}"\n\n')
+    if blob:
+        f.write(blob.declaration())
+    f.write(body.getvalue())
+
+    f.write(f"const ST7789_SheetFrame {name}_frames[{len(table)}] = {{\n")
+    for file_name, w, h, px, py, tx, ty, tw, th, data in table:
+        f.write(f"    {{ {w}, {h}, {px}, {py}, {tx}, {ty}, {tw}, {th}, {data} }},  // {file_name}\n")
+    f.write("};\n")
+    pixels_name = "nullptr" if kind == "IMAGE" else f"{name}_pixels"
+    f.write(f"const ST7789_Sheet {name}_sheet = {{ ST7789_SHEET_{kind}, {len(table)}, {name}_frames, {pixels_name}, {deltas_name} }};\n\n")
+
+    for anim, (first, count) in ranges.items():
+        f.write(f"const ST7789_SheetRange {anim}_anim = {{ {first}, {count} }};\n")
+
+    return total_bytes, raw_bytes
+
+# === Mirrored animation sets ===
+# Left and right facing frames exported from one drawing differ only by
+# resampling noise. A frame that mirrors an earlier one (every channel within
+# `tolerance`, at most 1 in 256 pixels off, edges included) is skipped, the
+# driver draws the earlier one with ST7789_FLIP_H instead. Pixels are RGB565
+# in native byte order.
+def same_pixel(a, b, tolerance):
+    if a == b:
+        return True
+    if a == 0x0001 or b == 0x0001:
+        return False
+    return abs((a >> 11) - (b >> 11)) <= tolerance and \
+           abs(((a >> 5) & 0x3F) - ((b >> 5) & 0x3F)) <= tolerance * 2 and \
+           abs((a & 0x1F) - (b & 0x1F)) <= tolerance
+
+def mirror_of(seen, width, height, pixels, tolerance):
+    for name, w, h, other in seen:
+        if (w, h) != (width, height):
+            continue
+        budget = len(pixels) // 256
+        for i, p in enumerate(pixels):
+            if not same_pixel(p, other[i - i % w + w - 1 - i % w], tolerance):
+                budget -= 1
+                if budget < 0:
+                    break
+        else:
+            return name
+    return None
+
+def is_mirrored(seen, img, w, h, pixels, tolerance, big_endian=False):
+    if big_endian:
+        pixels = [swap_bytes(p) for p in pixels]
+    original = mirror_of(seen, w, h, pixels, tolerance)
+    if original:
+        print(f"⏭️  {img.name} mirrors {original}, draw that one with ST7789_FLIP_H")
+        return True
+    seen.append((img.name, w, h, pixels))
+    return False
+
+def convert_image(path, max_w, max_h, alpha_threshold=None, big_endian=False, colors=None):
     image = Image.open(path)
     if alpha_threshold is not None:
         image = image.convert("RGBA")
     else:
         image = image.convert("RGB")
 
+    # Lossy: reduce to a palette so PAL8 / PAL4 become possible
+    if colors:
+        image = image.quantize(colors=colors, dither=Image.Dither.NONE).convert("RGB")
+
     image = fit_image(image, max_w, max_h)
     width, height = image.size
 
@@ -46,6 +392,8 @@ def convert_image(path, max_w, max_h, alpha_threshold=None):
 
             pixels.append(rgb888_to_rgb565(r, g, b))
 
+    if big_endian:
+        pixels = [swap_bytes(p) for p in pixels]
 
     size_bytes = len(pixels) * 2  # uint16_t
     return width, height, pixels, size_bytes
@@ -58,62 +406,168 @@ def main():
     parser.add_argument("-y", "--height", type=int, default=240)
     parser.add_argument("-m", "--merge", action="store_true", help="Merge all images into one header")
     parser.add_argument("-t", "--transparent", nargs="?", const=0, type=int, default=None, metavar="ALPHA", help="Enable transparency. Pixels with alpha <= ALPHA become transparent (default: 0)")
+    parser.add_argument("-r", "--rle", action="store_true", help="Run-length encode transparent pixels (needs --transparent), draw with drawRle()")
+    parser.add_argument("-c", "--compress", action="store_true", help="Emit opaque ST7789_Image assets in the smallest lossless format, draw with drawImage()")
+    parser.add_argument("-f", "--format", choices=FORMATS, default=None, help="Force a --compress format instead of the smallest one")
+    parser.add_argument("--colors", type=int, default=None, metavar="N", help="Quantize to N colours first (16 for PAL4, 256 for PAL8)")
+    parser.add_argument("--image-header", default="../ST7789/image.h", help="Include path of image.h used by --compress output")
+    parser.add_argument("-k", "--sheet", metavar="NAME", default=None, help="Pack every input into the ST7789_Sheet NAME (trimmed with --transparent or --background, as images with --compress)")
+    parser.add_argument("--background", type=lambda v: int(v, 16), default=None, metavar="RGB565", help="Trim opaque sheet frames to what differs from this colour, e.g. C40D")
+    parser.add_argument("-d", "--delta", nargs="?", const="*", default=None, metavar="ANIMS", help="Add deltas to the opaque --sheet animations matching ANIMS (comma separated, e.g. '*attack*', default: all) so a character animating in place only sends the changed pixels")
+    parser.add_argument("-p", "--pivot", default="0,0", help="Sheet frame pivot: X,Y, 'bottom' (feet) or 'center' (default: 0,0)")
+    parser.add_argument("--blob", metavar="FILE", default=None, help="Write the --sheet or --merge arrays to the binary FILE, to be embedded with EMBED_FILES, and only tables and pointers to the header")
+    parser.add_argument("-b", "--big-endian", action="store_true", help="Store pixels in panel byte order, draw them with drawSpriteBE() / drawRgbBitmapBE()")
+    parser.add_argument("-s", "--skip-mirrored", nargs="?", const=4, type=int, default=None, metavar="TOL", help="Skip images that mirror an earlier input (channels within TOL, default: 4), draw the earlier one with ST7789_FLIP_H. List the set to keep first")
 
 
     args = parser.parse_args()
 
+    if args.rle and args.transparent is None:
+        parser.error("--rle needs --transparent")
+
+    if args.compress and (args.rle or args.transparent is not None):
+        parser.error("--compress is for opaque images")
+
+    if args.sheet and (args.rle or args.merge):
+        parser.error("--sheet already packs every input into one header")
+
+    if args.background is not None and (not args.sheet or args.transparent is not None):
+        parser.error("--background trims opaque --sheet frames")
+
+    if args.delta and (not args.sheet or args.transparent is not None):
+        parser.error("--delta is for opaque --sheet frames")
+
+    if args.blob and not (args.sheet or args.merge):
+        parser.error("--blob needs one header: --sheet or --merge")
+    blob = Blob(args.blob) if args.blob else None
+
+    suffix = "_rle" if args.rle else "_bmp"
+    byte_order = "// Byte order: big-endian, draw with drawSpriteBE() / drawRgbBitmapBE()\n" if args.big_endian else ""
+    if args.rle:
+        byte_order = "// Format: RLE spans in panel byte order, draw with drawRle()\n"
+
     # === Resolve glob patterns ===
     image_files = []
     for pattern in args.inputs:
-        image_files.extend(Path(".").glob(pattern))
+        path = Path(pattern)
+        if path.is_absolute():
+            image_files.extend(Path(path.anchor).glob(str(path.relative_to(path.anchor))))
+        else:
+            image_files.extend(Path(".").glob(pattern))
 
     image_files = [p for p in image_files if p.is_file()]
     if not image_files:
         print("❌ No matching image files found")
         return
 
+    seen = []
+    def skipped(img, w, h, pixels, big_endian=False):
+        return args.skip_mirrored is not None and is_mirrored(seen, img, w, h, pixels, args.skip_mirrored, big_endian)
+
+    # === SPRITE SHEET ===
+    if args.sheet:
+        name = sanitize_cpp_identifier(args.sheet)
+        output_path = Path(args.output or f"{name}.h")
+        kind = "IMAGE" if args.compress else "BITMAP" if args.transparent is not None else "SPRITE"
+
+        frames = []
+        for img in sorted(image_files, key=natural_key):
+            w, h, pixels, _ = convert_image(img, args.width, args.height, args.transparent, colors=args.colors)
+            if not skipped(img, w, h, pixels):
+                frames.append((img.name, w, h, pixels))
+
+        key = 0x0001 if args.transparent is not None else args.background
+        include = Path(args.image_header).with_name("sheet.h").as_posix()
+        with open(output_path, "w") as f:
+            total_bytes, raw_bytes = write_sheet(f, name, frames, kind, key, args.pivot, include, args.format, args.delta and args.delta.split(","), blob)
+
+        if blob:
+            blob.save()
+        print(f"✅ Packed {len(frames)} frames ({total_bytes} of {raw_bytes} bytes) → {output_path}")
+
+    # === COMPRESSED ===
+    elif args.compress:
+        groups = [(Path(args.output or "images.h"), image_files)] if args.merge else \
+                 [(Path(args.output) if args.output else img.with_suffix(".h"), [img]) for img in image_files]
+
+        for output_path, images in groups:
+            body = io.StringIO()
+            total_raw = total_bytes = written = 0
+            for img in images:
+                w, h, pixels, size_bytes = convert_image(img, args.width, args.height, colors=args.colors)
+                if skipped(img, w, h, pixels):
+                    continue
+                total_raw += size_bytes
+                total_bytes += write_image(body, img.name, sanitize_cpp_identifier(img.stem), w, h, pixels, args.format, blob)
+                written += 1
+
+            if not written:
+                continue
+
+            with open(output_path, "w") as f:
+                f.write(f"// Total image data size: {total_bytes} bytes ({total_raw} uncompressed)\n\n")
+                f.write(f'#include "{args.image_header}"\n\n')
+                if blob:
+                    f.write(blob.declaration())
+                f.write(body.getvalue())
+
+            if blob:
+                blob.save()
+            print(f"✅ Compressed {written} images → {output_path}")
+
     # === MERGE MODE ===
-    if args.merge:
+    elif args.merge:
         output_path = Path(args.output or "images.h")
 
         total_bytes = 0
         image_data = []
 
         for img in image_files:
-            w, h, pixels, size_bytes = convert_image(img, args.width, args.height, args.transparent)
+            w, h, pixels, size_bytes = convert_image(img, args.width, args.height, args.transparent, args.big_endian and not args.rle)
+            if skipped(img, w, h, pixels, args.big_endian and not args.rle):
+                continue
+            if args.rle:
+                pixels = encode_rle(pixels, w, h)
+                size_bytes = len(pixels) * 2
             total_bytes += size_bytes
 
-            array_name = sanitize_cpp_identifier(img.stem + "_bmp")
+            array_name = sanitize_cpp_identifier(img.stem + suffix)
             image_data.append((img.name, array_name, w, h, pixels, size_bytes))
 
         with open(output_path, "w") as f:
             f.write(f"// Total bitmap data size: {total_bytes} bytes\n\n")
+            if blob:
+                f.write("#include <stdint.h>\n\n")
+                f.write(blob.declaration())
 
             for name, arr, w, h, pixels, size_bytes in image_data:
                 f.write(f"// {name}\n")
                 f.write(f"// Size: {w}x{h} ({size_bytes} bytes)\n")
-                f.write(f"const uint16_t {arr}[{len(pixels)}] PROGMEM = {{\n")
-
-                for i, val in enumerate(pixels):
-                    f.write(f"0x{val:04X}, ")
-                    if (i + 1) % 16 == 0:
-                        f.write("\n")
-
-                f.write("\n};\n\n")
+                f.write(byte_order)
+                write_array(f, "uint16_t", arr, pixels, blob)
+                f.write("\n")
 
-        print(f"✅ Merged {len(image_files)} images → {output_path}")
+        if blob:
+            blob.save()
+        print(f"✅ Merged {len(image_data)} images → {output_path}")
 
     # === SINGLE FILE MODE ===
     else:
         for img in image_files:
             output_path = Path(args.output) if args.output else img.with_suffix(".h")
 
-            w, h, pixels, size_bytes = convert_image(img, args.width, args.height, args.transparent)
-            array_name = sanitize_cpp_identifier(img.stem + "_bmp")
+            w, h, pixels, size_bytes = convert_image(img, args.width, args.height, args.transparent, args.big_endian and not args.rle)
+            if skipped(img, w, h, pixels, args.big_endian and not args.rle):
+                continue
+            if args.rle:
+                pixels = encode_rle(pixels, w, h)
+                size_bytes = len(pixels) * 2
+            array_name = sanitize_cpp_identifier(img.stem + suffix)
 
             with open(output_path, "w") as f:
                 f.write(f"// {img.name}\n")
                 f.write(f"// Size: {w}x{h} ({size_bytes} bytes)\n")
+                f.write(byte_order)
                 f.write(f"const uint16_t {array_name}[{len(pixels)}] = {{\n")
 
                 for i, val in enumerate(pixels):
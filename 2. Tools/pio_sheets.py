@@ -0,0 +1,83 @@
+# PlatformIO pre-build step for the sprite assets (extra_scripts in
+# platformio.ini).
+#
+# PlatformIO reads ESP-IDF's CMake project but does not run its custom
+# commands, so the image2cpp_sheet() and image2cpp_header() calls of
+# "1. Assets/Sprites/sheets.cmake" never produce their headers there. This
+# script runs image2cpp.py for the same assets with the same flags before
+# the build. Without --blob, each header holds its own arrays, so nothing
+# has to be embedded. It exports RETRO_SHEETS_DIR, which makes both
+# functions (see assets.cmake) use these headers instead of adding their
+# own commands. A header is only regenerated when a PNG, sheets.cmake or
+# the tool changed. Needs Pillow in
+# PlatformIO's Python and installs it when it is missing.
+
+import os
+import re
+import glob
+import subprocess
+
+Import("env")
+
+project = env.subst("$PROJECT_DIR")
+tools = os.path.join(project, "2. Tools")
+sprites = os.path.join(project, "1. Assets", "Sprites")
+sheets_cmake = os.path.join(sprites, "sheets.cmake")
+image2cpp = os.path.join(tools, "image2cpp.py")
+out_dir = os.path.join(env.subst("$BUILD_DIR"), "assets")
+python = env.subst("$PYTHONEXE")
+
+
+# image2cpp_sheet(<target> <name> DIRS <dir>... ARGS <option>...) and
+# image2cpp_header(<target> <name> FILES <png>... ARGS <option>...) calls
+def parse_sheets(path):
+    with open(path) as f:
+        text = "\n".join(line for line in f.read().splitlines() if not line.lstrip().startswith("#"))
+
+    sheets = []
+    for kind, body in re.findall(r"image2cpp_(sheet|header)\(([^)]*)\)", text):
+        tokens = [q if q else w for q, w in re.findall(r'"([^"]*)"|(\S+)', body)]
+        tokens = [t.replace("${SPRITES}", sprites) for t in tokens]
+        name = tokens[1]
+        paths, args, into = [], [], None
+        for t in tokens[2:]:
+            if t in ("DIRS", "FILES", "ARGS"):
+                into = args if t == "ARGS" else paths
+            elif into is not None:
+                into.append(t)
+        if kind == "sheet":
+            # Same order as CMake's file(GLOB), which sorts lexicographically
+            inputs = sorted(png for d in paths for png in glob.glob(os.path.join(d, "*.png")))
+            sheets.append((name, inputs, ["--sheet", name] + args))
+        else:
+            sheets.append((name, paths, ["--merge"] + args))
+    return sheets
+
+
+def ensure_pillow():
+    if subprocess.call([python, "-c", "import PIL"], stderr=subprocess.DEVNULL) != 0:
+        print("Installing Pillow for the sprite sheets")
+        subprocess.check_call([python, "-m", "pip", "install", "pillow"])
+
+
+def pack(name, inputs, args):
+    header = os.path.join(out_dir, "sprites", name + ".h")
+
+    newest = max(os.path.getmtime(p) for p in inputs + [image2cpp, sheets_cmake])
+    if os.path.exists(header) and os.path.getmtime(header) >= newest:
+        return
+
+    print("Converting sprites %s" % name)
+    os.makedirs(os.path.dirname(header), exist_ok=True)
+    subprocess.check_call([python, image2cpp] + inputs + args +
+                          ["--image-header", "ST7789/image.h", "-o", header])
+
+
+sheets = parse_sheets(sheets_cmake)
+if sheets:
+    ensure_pillow()
+for sheet in sheets:
+    pack(*sheet)
+
+os.environ["RETRO_SHEETS_DIR"] = out_dir
+env.Append(CPPPATH=[out_dir, os.path.join(project, "src")])
@@ -0,0 +1,23 @@
+#pragma once
+#include <stdint.h>
+#include "SimPanel.h"
+
+// Host-side controls of the simulated ESP-IDF (idf.cpp), for main.cpp
+
+// The panel every SPI device on the bus talks to
+SimPanel &sim_panel();
+
+// Moves esp_timer_get_time() forward, e.g. by one game step per frame so
+// the game advances at its normal pace however fast the host renders
+void sim_advance_time(int64_t us);
+
+// Byte for the next usb_serial_jtag_read_bytes(), as the desktop
+// controller would send it (0x10 left, 0x11 right, 0x14 enter, 0x00 release)
+void sim_send_serial(uint8_t byte);
+
+// Level read by gpio_get_level() and raw value read by the ADC on `pin`
+void sim_set_level(int pin, int level);
+void sim_set_adc(int pin, int raw);
+
+// Seed of esp_random(), runs with the same seed and input are identical
+void sim_seed_random(uint32_t seed);
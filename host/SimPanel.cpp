@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include "SimPanel.h"
+#include "ST7789/commands.h"
+
+void SimPanel::write(bool dc, const uint8_t *data, size_t len)
+{
+    _stats.transactions++;
+    _stats.bytes += len;
+
+    if (!dc) {
+        for (size_t i = 0; i < len; i++)
+            command(data[i]);
+        return;
+    }
+
+    if (_cmd != ST7789_RAMWR) {
+        for (size_t i = 0; i < len; i++)
+            parameter(data[i]);
+        return;
+    }
+
+    size_t i = 0;
+    if (_pending >= 0 && len) {
+        pixel((uint16_t)((_pending << 8) | data[i++]));
+        _pending = -1;
+    }
+    for (; i + 1 < len; i += 2)
+        pixel((uint16_t)((data[i] << 8) | data[i + 1]));
+    if (i < len)
+        _pending = data[i];
+}
+
+void SimPanel::command(uint8_t cmd)
+{
+    _stats.commands++;
+    _cmd = cmd;
+    _param_count = 0;
+    _pending = -1;
+
+    switch (cmd) {
+        case ST7789_RAMWR:
+            _stats.windows++;
+            _x = _x0;
+            _y = _y0;
+            break;
+        case ST7789_INVON:
+            _inverted = true;
+            break;
+        case ST7789_INVOFF:
+            _inverted = false;
+            break;
+        case ST7789_SWRESET:
+            _madctl = 0;
+            _inverted = false;
+            break;
+    }
+}
+
+void SimPanel::parameter(uint8_t value)
+{
+    if (_param_count < sizeof(_params))
+        _params[_param_count] = value;
+    _param_count++;
+
+    switch (_cmd) {
+        case ST7789_CASET:
+            if (_param_count == 4) {
+                _x0 = (_params[0] << 8) | _params[1];
+                _x1 = (_params[2] << 8) | _params[3];
+            }
+            break;
+        case ST7789_RASET:
+            if (_param_count == 4) {
+                _y0 = (_params[0] << 8) | _params[1];
+                _y1 = (_params[2] << 8) | _params[3];
+            }
+            break;
+        case ST7789_MADCTL:
+            if (_param_count == 1)
+                _madctl = value;
+            break;
+    }
+}
+
+// Stores one pixel at the write pointer and advances it through the
+// window, wrapping like the controller does
+void SimPanel::pixel(uint16_t color)
+{
+    _stats.pixels++;
+
+    int x = _x, y = _y;
+    if (_madctl & MADCTL_MV) {
+        int t = x;
+        x = y;
+        y = t;
+    }
+    if (_madctl & MADCTL_MX) x = SIM_PANEL_WIDTH - 1 - x;
+    if (_madctl & MADCTL_MY) y = SIM_PANEL_HEIGHT - 1 - y;
+
+    if (x >= 0 && x < SIM_PANEL_WIDTH && y >= 0 && y < SIM_PANEL_HEIGHT)
+        _gram[y * SIM_PANEL_WIDTH + x] = color;
+
+    if (_x++ >= _x1) {
+        _x = _x0;
+        if (_y++ >= _y1)
+            _y = _y0;
+    }
+}
+
+uint16_t SimPanel::shown(int x, int y) const
+{
+    uint16_t c = _gram[y * SIM_PANEL_WIDTH + x];
+    if (!_inverted)
+        c = ~c;
+    if (!(_madctl & MADCTL_BGR))
+        c = (uint16_t)(((c & 0x1F) << 11) | (c & 0x07E0) | (c >> 11));
+    return c;
+}
+
+bool SimPanel::savePPM(const char *path) const
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+
+    fprintf(f, "P6\n%d %d\n255\n", SIM_PANEL_WIDTH, SIM_PANEL_HEIGHT);
+    for (int y = 0; y < SIM_PANEL_HEIGHT; y++) {
+        for (int x = 0; x < SIM_PANEL_WIDTH; x++) {
+            uint16_t c = shown(x, y);
+            uint8_t rgb[3] = {
+                (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+                (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+                (uint8_t)((c & 0x1F) * 255 / 31)
+            };
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+
+    return fclose(f) == 0;
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#define SIM_PANEL_WIDTH  240
+#define SIM_PANEL_HEIGHT 240
+
+// What went over the bus since the last clearStats()
+typedef struct {
+    uint32_t transactions;
+    uint32_t commands;
+    uint32_t windows;           // RAMWR commands
+    uint64_t bytes;             // Commands, parameters and pixels
+    uint64_t pixels;            // Pixels written through RAMWR
+} SimBusStats;
+
+// The ST7789 module as seen from the bus. Commands (DC low) and their
+// parameters / pixel data (DC high) are decoded into an in-memory GRAM:
+// CASET/RASET set the window, RAMWR streams big-endian RGB565 pixels into
+// it row by row, MADCTL swaps and mirrors the address space. Anything else
+// is counted and ignored.
+//
+// The module is an IPS panel wired BGR and inverted, which MADCTL_BGR and
+// INVON (the driver's defaults) compensate for; shown() applies the same
+// so dumps look like the real screen.
+class SimPanel {
+private:
+    uint16_t _gram[SIM_PANEL_WIDTH * SIM_PANEL_HEIGHT] = {};
+    SimBusStats _stats = {};
+
+    uint8_t _cmd = 0;
+    uint8_t _params[4] = {};
+    uint8_t _param_count = 0;
+
+    uint16_t _x0 = 0, _x1 = SIM_PANEL_WIDTH - 1;
+    uint16_t _y0 = 0, _y1 = SIM_PANEL_HEIGHT - 1;
+    uint16_t _x = 0, _y = 0;    // RAMWR write pointer
+    int16_t _pending = -1;      // High byte of a pixel split across transactions
+
+    uint8_t _madctl = 0;
+    bool _inverted = false;
+
+    void command(uint8_t cmd);
+    void parameter(uint8_t value);
+    void pixel(uint16_t color);
+
+public:
+    // One SPI transaction, `dc` is the level of the DC pin
+    void write(bool dc, const uint8_t *data, size_t len);
+
+    // RGB565 as the panel shows it at (x, y)
+    uint16_t shown(int x, int y) const;
+
+    // Binary PPM of what the panel shows
+    bool savePPM(const char *path) const;
+
+    const SimBusStats &stats() const { return _stats; }
+    void clearStats() { _stats = {}; }
+};
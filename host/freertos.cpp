@@ -0,0 +1,129 @@
+// FreeRTOS tasks, queues and critical sections on top of the C++ runtime
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Sim.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+// ===== Critical sections =====
+static std::recursive_mutex critical;
+
+void sim_enter_critical(portMUX_TYPE *)
+{
+    critical.lock();
+}
+
+void sim_exit_critical(portMUX_TYPE *)
+{
+    critical.unlock();
+}
+
+// ===== Tasks =====
+struct sim_task {
+    std::thread thread;
+};
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *, uint32_t, void *arg,
+                                   UBaseType_t, TaskHandle_t *handle, BaseType_t)
+{
+    // Tasks never return and are never deleted, the process exit ends them
+    sim_task *task = new sim_task();
+    task->thread = std::thread(fn, arg);
+    task->thread.detach();
+    if (handle) *handle = task;
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                       UBaseType_t priority, TaskHandle_t *handle)
+{
+    return xTaskCreatePinnedToCore(fn, name, stack, arg, priority, handle, 0);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    sim_advance_time((int64_t)ticks * portTICK_PERIOD_MS * 1000);
+    std::this_thread::yield();
+}
+
+TickType_t xTaskGetTickCount()
+{
+    return (TickType_t)(esp_timer_get_time() / (portTICK_PERIOD_MS * 1000));
+}
+
+// ===== Queues =====
+// Fixed-size items copied in and out of a ring, like the real thing
+struct sim_queue {
+    std::mutex lock;
+    std::condition_variable changed;
+    std::vector<uint8_t> items;
+    UBaseType_t length;
+    UBaseType_t size;
+    UBaseType_t head = 0;
+    UBaseType_t count = 0;
+};
+
+// Waits for `ready` up to `ticks`, portMAX_DELAY waits forever
+template <typename Ready>
+static bool wait(sim_queue *q, std::unique_lock<std::mutex> &lock, TickType_t ticks, Ready ready)
+{
+    if (ticks == portMAX_DELAY) {
+        q->changed.wait(lock, ready);
+        return true;
+    }
+    return q->changed.wait_for(lock, std::chrono::milliseconds((int64_t)ticks * portTICK_PERIOD_MS), ready);
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    if (!length || !item_size) return nullptr;
+
+    sim_queue *q = new sim_queue();
+    q->items.resize((size_t)length * item_size);
+    q->length = length;
+    q->size = item_size;
+    return q;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks_to_wait)
+{
+    std::unique_lock<std::mutex> lock(q->lock);
+    if (!wait(q, lock, ticks_to_wait, [q] { return q->count < q->length; }))
+        return pdFAIL;
+
+    UBaseType_t tail = (q->head + q->count) % q->length;
+    memcpy(&q->items[(size_t)tail * q->size], item, q->size);
+    q->count++;
+    q->changed.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks_to_wait)
+{
+    std::unique_lock<std::mutex> lock(q->lock);
+    if (!wait(q, lock, ticks_to_wait, [q] { return q->count > 0; }))
+        return pdFAIL;
+
+    memcpy(item, &q->items[(size_t)q->head * q->size], q->size);
+    q->head = (q->head + 1) % q->length;
+    q->count--;
+    q->changed.notify_all();
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q)
+{
+    std::lock_guard<std::mutex> lock(q->lock);
+    return q->count;
+}
+
+void vQueueDelete(QueueHandle_t q)
+{
+    delete q;
+}
@@ -0,0 +1,324 @@
+// ESP-IDF drivers of the host build: GPIO levels, ADC readings, the SPI bus
+// feeding SimPanel, the clock, the heap and the serial port
+#include <malloc.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "Sim.h"
+#include "esp_timer.h"
+#include "esp_random.h"
+#include "esp_heap_caps.h"
+#include "driver/gpio.h"
+#include "driver/adc.h"
+#include "driver/spi_master.h"
+#include "driver/usb_serial_jtag.h"
+
+// ===== Clock =====
+static const auto start_time = std::chrono::steady_clock::now();
+static std::atomic<int64_t> time_offset{0};
+
+int64_t esp_timer_get_time()
+{
+    auto elapsed = std::chrono::steady_clock::now() - start_time;
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + time_offset;
+}
+
+void sim_advance_time(int64_t us)
+{
+    time_offset += us;
+}
+
+// ===== Random =====
+static std::atomic<uint32_t> random_state{1};
+
+void sim_seed_random(uint32_t seed)
+{
+    random_state = seed ? seed : 1;
+}
+
+// xorshift32, plenty for spawn positions
+uint32_t esp_random()
+{
+    uint32_t x = random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    random_state = x;
+    return x;
+}
+
+// ===== Heap =====
+static std::atomic<size_t> heap_used{0};
+static std::atomic<size_t> heap_peak{0};
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    if (caps & MALLOC_CAP_SPIRAM) return nullptr;
+    if (heap_used + size > SIM_HEAP_SIZE) return nullptr;
+
+    void *p = malloc(size);
+    if (!p) return nullptr;
+
+    size_t used = heap_used += malloc_usable_size(p);
+    size_t peak = heap_peak;
+    while (used > peak && !heap_peak.compare_exchange_weak(peak, used)) {}
+    return p;
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    void *p = heap_caps_malloc(n * size, caps);
+    if (p) memset(p, 0, n * size);
+    return p;
+}
+
+void heap_caps_free(void *ptr)
+{
+    if (!ptr) return;
+    heap_used -= malloc_usable_size(ptr);
+    free(ptr);
+}
+
+size_t heap_caps_get_total_size(uint32_t caps)
+{
+    return caps & MALLOC_CAP_SPIRAM ? 0 : SIM_HEAP_SIZE;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    return caps & MALLOC_CAP_SPIRAM ? 0 : SIM_HEAP_SIZE - heap_used;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps)
+{
+    return caps & MALLOC_CAP_SPIRAM ? 0 : SIM_HEAP_SIZE - heap_peak;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    return heap_caps_get_free_size(caps);
+}
+
+// ===== GPIO =====
+static std::atomic<int> levels[GPIO_NUM_MAX];
+static thread_local int last_written = -1;      // Pin set by the last gpio_set_level()
+
+void sim_set_level(int pin, int level)
+{
+    if (pin >= 0 && pin < GPIO_NUM_MAX)
+        levels[pin] = level ? 1 : 0;
+}
+
+esp_err_t gpio_config(const gpio_config_t *config)
+{
+    if (!config) return ESP_ERR_INVALID_ARG;
+
+    for (int pin = 0; pin < GPIO_NUM_MAX; pin++)
+        if ((config->pin_bit_mask >> pin) & 1)
+            levels[pin] = config->pull_up_en == GPIO_PULLUP_ENABLE ? 1 : 0;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_direction(gpio_num_t pin, gpio_mode_t)
+{
+    return pin >= 0 && pin < GPIO_NUM_MAX ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level)
+{
+    if (pin < 0 || pin >= GPIO_NUM_MAX) return ESP_ERR_INVALID_ARG;
+    levels[pin] = level ? 1 : 0;
+    last_written = pin;
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t pin)
+{
+    return pin >= 0 && pin < GPIO_NUM_MAX ? levels[pin].load() : 0;
+}
+
+// ===== ADC =====
+// Channels map to GPIOs as on the ESP32-S3: ADC1 channel n is GPIO n + 1,
+// ADC2 channel n is GPIO n + 11
+static std::atomic<int> adc_raw[GPIO_NUM_MAX];
+
+void sim_set_adc(int pin, int raw)
+{
+    if (pin >= 0 && pin < GPIO_NUM_MAX)
+        adc_raw[pin] = raw;
+}
+
+esp_err_t adc1_config_width(adc_bits_width_t)
+{
+    return ESP_OK;
+}
+
+esp_err_t adc1_config_channel_atten(adc1_channel_t channel, adc_atten_t)
+{
+    return channel < ADC1_CHANNEL_MAX ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+int adc1_get_raw(adc1_channel_t channel)
+{
+    return channel < ADC1_CHANNEL_MAX ? adc_raw[channel + 1].load() : -1;
+}
+
+esp_err_t adc2_config_channel_atten(adc2_channel_t channel, adc_atten_t)
+{
+    return channel < ADC2_CHANNEL_MAX ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t adc2_get_raw(adc2_channel_t channel, adc_bits_width_t, int *raw)
+{
+    if (channel >= ADC2_CHANNEL_MAX || !raw) return ESP_ERR_INVALID_ARG;
+    *raw = adc_raw[channel + 11];
+    return ESP_OK;
+}
+
+// ===== SPI =====
+// Queued transactions go out on a thread of their own, like DMA on the
+// chip: the caller only blocks once it waits for a result, so decoding
+// them into SimPanel counts as time on the bus and not as drawing.
+struct spi_device_t {
+    transaction_cb_t pre_cb;
+    std::mutex lock;
+    std::condition_variable changed;
+    std::deque<spi_transaction_t *> queued;
+    std::deque<spi_transaction_t *> done;
+    std::thread worker;
+};
+
+static std::mutex bus;
+
+SimPanel &sim_panel()
+{
+    static SimPanel panel;
+    return panel;
+}
+
+// DC is whatever pin the pre-transfer callback drove, high without one
+static void transmit(spi_device_handle_t dev, spi_transaction_t *t)
+{
+    last_written = -1;
+    if (dev->pre_cb)
+        dev->pre_cb(t);
+    bool dc = last_written < 0 || levels[last_written];
+
+    const uint8_t *data = t->flags & SPI_TRANS_USE_TXDATA ? t->tx_data : (const uint8_t *)t->tx_buffer;
+    std::lock_guard<std::mutex> lock(bus);
+    sim_panel().write(dc, data, t->length / 8);
+}
+
+static void bus_worker(spi_device_handle_t dev)
+{
+    std::unique_lock<std::mutex> lock(dev->lock);
+    while (true) {
+        dev->changed.wait(lock, [dev] { return !dev->queued.empty(); });
+        spi_transaction_t *t = dev->queued.front();
+
+        lock.unlock();
+        transmit(dev, t);
+        lock.lock();
+
+        dev->queued.pop_front();
+        dev->done.push_back(t);
+        dev->changed.notify_all();
+    }
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t, const spi_bus_config_t *config, int)
+{
+    return config ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t, const spi_device_interface_config_t *config, spi_device_handle_t *handle)
+{
+    if (!config || !handle) return ESP_ERR_INVALID_ARG;
+
+    spi_device_handle_t dev = new spi_device_t();
+    dev->pre_cb = config->pre_cb;
+    dev->worker = std::thread(bus_worker, dev);
+    dev->worker.detach();
+    *handle = dev;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t *trans, TickType_t)
+{
+    if (!handle || !trans) return ESP_ERR_INVALID_ARG;
+
+    std::lock_guard<std::mutex> lock(handle->lock);
+    handle->queued.push_back(trans);
+    handle->changed.notify_all();
+    return ESP_OK;
+}
+
+// Blocks until the oldest queued transaction is through, fails right away
+// when nothing is queued
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t **trans, TickType_t)
+{
+    if (!handle || !trans) return ESP_ERR_INVALID_ARG;
+
+    std::unique_lock<std::mutex> lock(handle->lock);
+    handle->changed.wait(lock, [handle] { return !handle->done.empty() || handle->queued.empty(); });
+    if (handle->done.empty()) return ESP_ERR_TIMEOUT;
+
+    *trans = handle->done.front();
+    handle->done.pop_front();
+    return ESP_OK;
+}
+
+// Like on the chip, only once queued transactions are through
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans)
+{
+    if (!handle || !trans) return ESP_ERR_INVALID_ARG;
+
+    {
+        std::unique_lock<std::mutex> lock(handle->lock);
+        handle->changed.wait(lock, [handle] { return handle->queued.empty(); });
+    }
+    transmit(handle, trans);
+    return ESP_OK;
+}
+
+esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans)
+{
+    return spi_device_polling_transmit(handle, trans);
+}
+
+// ===== USB serial =====
+static std::mutex serial_lock;
+static std::deque<uint8_t> serial_rx;
+
+void sim_send_serial(uint8_t byte)
+{
+    std::lock_guard<std::mutex> lock(serial_lock);
+    serial_rx.push_back(byte);
+}
+
+esp_err_t usb_serial_jtag_driver_install(usb_serial_jtag_driver_config_t *)
+{
+    return ESP_OK;
+}
+
+// Never waits, the game loop polls once per frame anyway
+int usb_serial_jtag_read_bytes(void *buf, uint32_t length, TickType_t)
+{
+    std::lock_guard<std::mutex> lock(serial_lock);
+
+    uint32_t n = 0;
+    while (n < length && !serial_rx.empty()) {
+        ((uint8_t *)buf)[n++] = serial_rx.front();
+        serial_rx.pop_front();
+    }
+    return n;
+}
+
+int usb_serial_jtag_write_bytes(const void *src, size_t size, TickType_t)
+{
+    return (int)fwrite(src, 1, size, stdout);
+}
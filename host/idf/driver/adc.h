@@ -0,0 +1,26 @@
+#pragma once
+#include "esp_err.h"
+
+// Legacy ADC driver as IOHelper uses it. Readings come from
+// sim_set_adc(), per GPIO.
+typedef enum { ADC_UNIT_1, ADC_UNIT_2 } adc_unit_t;
+typedef enum { ADC_ATTEN_DB_0, ADC_ATTEN_DB_2_5, ADC_ATTEN_DB_6, ADC_ATTEN_DB_11 } adc_atten_t;
+typedef enum { ADC_WIDTH_BIT_12 = 3 } adc_bits_width_t;
+
+typedef enum {
+    ADC1_CHANNEL_0, ADC1_CHANNEL_1, ADC1_CHANNEL_2, ADC1_CHANNEL_3, ADC1_CHANNEL_4,
+    ADC1_CHANNEL_5, ADC1_CHANNEL_6, ADC1_CHANNEL_7, ADC1_CHANNEL_8, ADC1_CHANNEL_9,
+    ADC1_CHANNEL_MAX
+} adc1_channel_t;
+
+typedef enum {
+    ADC2_CHANNEL_0, ADC2_CHANNEL_1, ADC2_CHANNEL_2, ADC2_CHANNEL_3, ADC2_CHANNEL_4,
+    ADC2_CHANNEL_5, ADC2_CHANNEL_6, ADC2_CHANNEL_7, ADC2_CHANNEL_8, ADC2_CHANNEL_9,
+    ADC2_CHANNEL_MAX
+} adc2_channel_t;
+
+esp_err_t adc1_config_width(adc_bits_width_t width);
+esp_err_t adc1_config_channel_atten(adc1_channel_t channel, adc_atten_t atten);
+int adc1_get_raw(adc1_channel_t channel);
+esp_err_t adc2_config_channel_atten(adc2_channel_t channel, adc_atten_t atten);
+esp_err_t adc2_get_raw(adc2_channel_t channel, adc_bits_width_t width, int *raw);
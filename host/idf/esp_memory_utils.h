@@ -0,0 +1,5 @@
+#pragma once
+
+// Nothing on the host is DMA-capable, sprites always take the copying
+// path like flash-resident sprites on the device
+inline bool esp_ptr_dma_capable(const void *) { return false; }
@@ -0,0 +1,5 @@
+#pragma once
+#include <stdint.h>
+
+// Seeded generator, so runs are repeatable (sim_seed_random())
+uint32_t esp_random();
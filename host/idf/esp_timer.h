@@ -0,0 +1,6 @@
+#pragma once
+#include <stdint.h>
+
+// Host clock in microseconds: real time plus whatever sim_advance_time()
+// and vTaskDelay() added, see Sim.h
+int64_t esp_timer_get_time();
@@ -0,0 +1,34 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// FreeRTOS on top of std::thread, see freertos.cpp. Ticks match the
+// project's CONFIG_FREERTOS_HZ.
+#define configTICK_RATE_HZ 100
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE             0
+#define pdTRUE              1
+#define pdFAIL              pdFALSE
+#define pdPASS              pdTRUE
+#define portMAX_DELAY       ((TickType_t)0xFFFFFFFF)
+#define portTICK_PERIOD_MS  (1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000))
+
+// Critical sections share one recursive lock, enough for the profiler
+typedef struct {
+    int owner;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+
+void sim_enter_critical(portMUX_TYPE *mux);
+void sim_exit_critical(portMUX_TYPE *mux);
+
+#define taskENTER_CRITICAL(mux) sim_enter_critical(mux)
+#define taskEXIT_CRITICAL(mux)  sim_exit_critical(mux)
+#define portENTER_CRITICAL(mux) sim_enter_critical(mux)
+#define portEXIT_CRITICAL(mux)  sim_exit_critical(mux)
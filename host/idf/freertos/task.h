@@ -0,0 +1,16 @@
+#pragma once
+#include "FreeRTOS.h"
+
+typedef struct sim_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *arg);
+
+// Tasks are detached threads, core and priority are ignored
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                                   UBaseType_t priority, TaskHandle_t *handle, BaseType_t core);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                       UBaseType_t priority, TaskHandle_t *handle);
+
+// Advances the simulated clock instead of sleeping, so splash screens and
+// reset delays cost nothing
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
@@ -0,0 +1,190 @@
+// Headless host runner: boots the engine like app_main() does, on the
+// simulated panel, and runs a fixed number of frames as fast as the host
+// allows. Every frame advances the game clock by one update step, so a
+// run is the same sequence of game states however fast the machine is.
+//
+//   retro-sim [--scene game1|home|splash] [--frames N] [--seed N]
+//             [--press KEY@FRAME]... [--dump FILE.ppm] [--profile]
+//   retro-sim --bench [--frames N]
+//
+// --press sends a controller byte (0x10 left, 0x11 right, 0x14 enter,
+// 0x00 release) before the given frame. --dump writes the final screen.
+// --bench runs bench/Benchmark.h for N frames per scenario instead of a
+// scene; the bus costs nothing here, so it measures the CPU side only.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "Sim.h"
+#include "ST7789/ST7789.h"
+#include "engine/Globals.h"
+#include "engine/IOHelper.h"
+#include "engine/Input.h"
+#include "scenes/SplashScene.h"
+#include "scenes/HomeScene.h"
+#include "games/Game1Scene.h"
+#include "bench/Benchmark.h"
+
+// ===== Pinout, as in app_main.cpp ===== //
+#define JOYSTICK_X  5
+#define JOYSTICK_Y  4
+#define JOYSTICK_B  6
+#define TFT_DC      10
+#define TFT_RST     9
+#define TFT_SCLK    12
+#define TFT_MISO    13
+#define TFT_MOSI    11
+#define TFT_BL      21
+
+SceneManager sceneManager;
+RenderTask renderer;
+GameLoop gameLoop;
+Profiler profiler;
+IOHelper io;
+RetroDebugger debugger;
+
+ST7789 tft(TFT_DC, TFT_RST, TFT_BL, TFT_SCLK, TFT_MOSI, TFT_MISO,
+           SIM_PANEL_WIDTH, SIM_PANEL_HEIGHT, SPI2_HOST, 80, 40, 2, 16);
+
+struct Press {
+    uint32_t frame;
+    uint8_t key;
+};
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [--scene game1|home|splash] [--frames N] [--seed N] "
+                    "[--press KEY@FRAME]... [--dump FILE.ppm] [--profile]\n"
+                    "       %s --bench [--frames N]\n", name, name);
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    Scene *scene = &game1Scene;
+    uint32_t frames = 1000;
+    const char *dump = nullptr;
+    bool profile = false;
+    bool bench = false;
+    bool framesSet = false;
+    std::vector<Press> presses;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (!strcmp(arg, "--profile")) {
+            profile = true;
+            continue;
+        }
+        if (!strcmp(arg, "--bench")) {
+            bench = true;
+            continue;
+        }
+        if (!value) usage(argv[0]);
+        i++;
+
+        if (!strcmp(arg, "--scene")) {
+            if (!strcmp(value, "game1")) scene = &game1Scene;
+            else if (!strcmp(value, "home")) scene = &homeScene;
+            else if (!strcmp(value, "splash")) scene = &splashScene;
+            else usage(argv[0]);
+        }
+        else if (!strcmp(arg, "--frames")) {
+            frames = strtoul(value, nullptr, 0);
+            framesSet = true;
+        }
+        else if (!strcmp(arg, "--seed")) {
+            sim_seed_random(strtoul(value, nullptr, 0));
+        }
+        else if (!strcmp(arg, "--press")) {
+            char *at;
+            Press p;
+            p.key = (uint8_t)strtoul(value, &at, 0);
+            if (*at != '@') usage(argv[0]);
+            p.frame = strtoul(at + 1, nullptr, 0);
+            presses.push_back(p);
+        }
+        else if (!strcmp(arg, "--dump")) {
+            dump = value;
+        }
+        else {
+            usage(argv[0]);
+        }
+    }
+
+    // Joystick centred, button released
+    sim_set_adc(JOYSTICK_X, JOYCALIB_X_IDLE);
+    sim_set_adc(JOYSTICK_Y, JOYCALIB_Y_IDLE);
+
+    tft.begin();
+
+    if (bench) {
+        runBenchmarks(tft, framesSet ? frames : BENCH_FRAMES);
+        return 0;
+    }
+
+    renderer.begin(tft);
+    input.begin(JOYSTICK_X, JOYSTICK_Y, JOYSTICK_B);
+    if (profile)
+        debugger.setup();
+
+    sceneManager.set(scene);
+    gameLoop.begin(sceneManager, GAME_LOOP_UPDATE_HZ, GAME_LOOP_MAX_UPDATES);
+    int64_t step = 1000000 / GAME_LOOP_UPDATE_HZ;
+
+    renderer.sync();
+    tft.waitIdle();
+    sim_panel().clearStats();
+    tft.resetBusStats();
+    ST7789_BusStats frameBus;
+    uint64_t driverBytes = 0, driverTransactions = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t frame = 0; frame < frames; frame++) {
+        for (const Press &p : presses)
+            if (p.frame == frame)
+                sim_send_serial(p.key);
+
+        sim_advance_time(step);
+        input.update();
+        gameLoop.tick();
+        tft.takeBusStats(frameBus);
+        profiler.recordBus(frameBus);
+        driverBytes += frameBus.total.commandBytes + frameBus.total.pixelBytes;
+        driverTransactions += frameBus.total.transactions;
+    }
+
+    renderer.sync();
+    tft.waitIdle();
+    tft.takeBusStats(frameBus);
+    profiler.recordBus(frameBus);
+    driverBytes += frameBus.total.commandBytes + frameBus.total.pixelBytes;
+    driverTransactions += frameBus.total.transactions;
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const SimBusStats &bus = sim_panel().stats();
+    uint32_t n = frames ? frames : 1;
+    printf("%s: %lu frames in %.3f s, %.0f fps\n", sceneManager.active() ? sceneManager.active()->name() : "none",
+           (unsigned long)frames, seconds, frames / seconds);
+    printf("per frame: %.0f bytes, %.0f pixels, %.1f windows, %.1f transactions\n",
+           (double)bus.bytes / n, (double)bus.pixels / n, (double)bus.windows / n, (double)bus.transactions / n);
+
+    // The driver's own accounting has to agree with what reached the panel
+    if (driverBytes != bus.bytes || driverTransactions != bus.transactions)
+        fprintf(stderr, "bus stats disagree: driver %llu bytes / %llu transactions, panel %llu / %llu\n",
+                (unsigned long long)driverBytes, (unsigned long long)driverTransactions,
+                (unsigned long long)bus.bytes, (unsigned long long)bus.transactions);
+
+    if (profile) {
+        profiler.report();
+        profiler.reportBus();
+    }
+
+    if (dump && !sim_panel().savePPM(dump)) {
+        fprintf(stderr, "cannot write %s\n", dump);
+        return 1;
+    }
+    return 0;
+}
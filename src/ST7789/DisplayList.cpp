@@ -0,0 +1,413 @@
+#include <string.h>
+#include "DisplayList.h"
+#include "GlyphCache.h"
+#include "esp_heap_caps.h"
+#include "utils.h"
+
+static bool rect_empty(const ST7789_Rect &r)
+{
+    return r.x0 >= r.x1 || r.y0 >= r.y1;
+}
+
+static bool rect_overlaps(const ST7789_Rect &a, const ST7789_Rect &b)
+{
+    return a.x0 < b.x1 && b.x0 < a.x1 && a.y0 < b.y1 && b.y0 < a.y1;
+}
+
+static bool rect_contains(const ST7789_Rect &outer, const ST7789_Rect &inner)
+{
+    return outer.x0 <= inner.x0 && inner.x1 <= outer.x1 && outer.y0 <= inner.y0 && inner.y1 <= outer.y1;
+}
+
+// Fully replaces every pixel of its bounds
+static bool is_opaque(const ST7789_Command &cmd)
+{
+    return cmd.type == ST7789_CMD_FILL || cmd.type == ST7789_CMD_SPRITE || cmd.type == ST7789_CMD_SPRITE_BE
+        || cmd.type == ST7789_CMD_IMAGE || cmd.type == ST7789_CMD_TEXT_BOX
+        || (cmd.type == ST7789_CMD_CHAR && (cmd.flags & ST7789_TEXT_OPAQUE));
+}
+
+// ===== Constructor =====
+DisplayList::DisplayList(size_t arenaBytes, int maxCommands)
+: _arena_size(arenaBytes),
+  _capacity(maxCommands)
+{
+}
+
+DisplayList::~DisplayList()
+{
+    end();
+}
+
+// ===== Setup =====
+
+bool DisplayList::begin(int16_t width, int16_t height)
+{
+    if (!_arena) {
+        _arena = (uint8_t *)heap_caps_malloc(_arena_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        _order = (ST7789_Command **)heap_caps_malloc(_capacity * sizeof(ST7789_Command *), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!_arena || !_order) {
+            end();
+            return false;
+        }
+    }
+
+    _width = width;
+    _height = height;
+    clear();
+    return true;
+}
+
+void DisplayList::end()
+{
+    heap_caps_free(_arena);
+    heap_caps_free(_order);
+    _arena = nullptr;
+    _order = nullptr;
+    _count = 0;
+}
+
+// Drops every command and resets layer and clip for the next frame
+void DisplayList::clear()
+{
+    _arena_used = 0;
+    _count = 0;
+    _layer = 0;
+    _overflow = false;
+    clearClipRect();
+}
+
+void *DisplayList::arena_alloc(size_t bytes)
+{
+    bytes = (bytes + 3) & ~3; // Keep commands word aligned
+    if (!_arena || _arena_used + bytes > _arena_size) {
+        _overflow = true;
+        return nullptr;
+    }
+
+    void *p = _arena + _arena_used;
+    _arena_used += bytes;
+    return p;
+}
+
+// ===== State =====
+
+void DisplayList::setLayer(uint8_t layer)
+{
+    _layer = layer;
+}
+
+void DisplayList::setClipRect(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    _clip.x0 = CONSTRAIN(x, 0, _width);
+    _clip.y0 = CONSTRAIN(y, 0, _height);
+    _clip.x1 = CONSTRAIN(x + w, _clip.x0, _width);
+    _clip.y1 = CONSTRAIN(y + h, _clip.y0, _height);
+}
+
+void DisplayList::clearClipRect()
+{
+    _clip = { 0, 0, _width, _height };
+}
+
+const ST7789_Rect &DisplayList::clipRect()
+{
+    return _clip;
+}
+
+// ===== Commands =====
+
+// Adds a command covering (x, y, w, h) under the current clip and layer.
+// Returns nullptr when it is clipped away or the list is full.
+ST7789_Command *DisplayList::append(ST7789_CommandType type, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, const void *data, uint8_t flags)
+{
+    ST7789_Command cmd = {};
+    cmd.type = type;
+    cmd.layer = _layer;
+    cmd.flags = flags;
+    cmd.color = color;
+    cmd.x = x;
+    cmd.y = y;
+    cmd.w = w;
+    cmd.h = h;
+    cmd.data = data;
+    cmd.clip = _clip;
+    cmd.bounds = { MAX(x, _clip.x0), MAX(y, _clip.y0), MIN((int16_t)(x + w), _clip.x1), MIN((int16_t)(y + h), _clip.y1) };
+
+    if (rect_empty(cmd.bounds) || !push(cmd))
+        return nullptr;
+    return _order[_count - 1];
+}
+
+// Appends a fully formed command (bounds and clip already resolved)
+bool DisplayList::push(const ST7789_Command &cmd)
+{
+    if (_count >= _capacity) {
+        _overflow = true;
+        return false;
+    }
+
+    ST7789_Command *slot = (ST7789_Command *)arena_alloc(sizeof(ST7789_Command));
+    if (!slot) return false;
+    *slot = cmd;
+
+    if (cmd.text) {
+        size_t len = strlen(cmd.text) + 1;
+        char *text = (char *)arena_alloc(len);
+        if (!text) return false;
+        memcpy(text, cmd.text, len);
+        slot->text = text;
+    }
+
+    _order[_count++] = slot;
+    return true;
+}
+
+void DisplayList::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    if (w <= 0 || h <= 0) return;
+    append(ST7789_CMD_FILL, x, y, w, h, color);
+}
+
+void DisplayList::drawHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    fillRect(x, y, w, 1, color);
+}
+
+void DisplayList::drawVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    fillRect(x, y, 1, h, color);
+}
+
+void DisplayList::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+    if (y0 == y1) {
+        drawHLine(MIN(x0, x1), y0, ABS(x1 - x0) + 1, color);
+        return;
+    }
+    if (x0 == x1) {
+        drawVLine(x0, MIN(y0, y1), ABS(y1 - y0) + 1, color);
+        return;
+    }
+
+    ST7789_Command *cmd = append(ST7789_CMD_LINE, MIN(x0, x1), MIN(y0, y1), ABS(x1 - x0) + 1, ABS(y1 - y0) + 1, color);
+    if (!cmd) return;
+
+    // Bounds are set, keep the real end points for execution
+    cmd->x = x0;
+    cmd->y = y0;
+    cmd->w = x1;
+    cmd->h = y1;
+}
+
+void DisplayList::drawSprite(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags)
+{
+    if (!bitmap || w <= 0 || h <= 0) return;
+    append(ST7789_CMD_SPRITE, x, y, w, h, 0, bitmap, flags);
+}
+
+void DisplayList::drawRgbBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags)
+{
+    if (!bitmap || w <= 0 || h <= 0) return;
+    append(ST7789_CMD_BITMAP, x, y, w, h, 0, bitmap, flags);
+}
+
+void DisplayList::drawSpriteBE(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags)
+{
+    if (!bitmap || w <= 0 || h <= 0) return;
+    append(ST7789_CMD_SPRITE_BE, x, y, w, h, 0, bitmap, flags);
+}
+
+void DisplayList::drawRgbBitmapBE(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags)
+{
+    if (!bitmap || w <= 0 || h <= 0) return;
+    append(ST7789_CMD_BITMAP_BE, x, y, w, h, 0, bitmap, flags);
+}
+
+void DisplayList::drawRle(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *data, uint8_t flags)
+{
+    if (!data || w <= 0 || h <= 0) return;
+    append(ST7789_CMD_RLE, x, y, w, h, 0, data, flags);
+}
+
+void DisplayList::drawImage(int16_t x, int16_t y, const ST7789_Image *image, const uint16_t *palette, uint8_t flags)
+{
+    if (!image) return;
+    ST7789_Command *cmd = append(ST7789_CMD_IMAGE, x, y, image->width, image->height, 0, image, flags);
+    if (cmd) cmd->palette = palette;
+}
+
+void DisplayList::drawChar(int16_t x, int16_t y, char c, const GFXfont *font, uint16_t color)
+{
+    text_char(x, y, c, font, color, 0, 0);
+}
+
+// Opaque: the glyph's whole cell is filled with `bg`, see ST7789::setTextColor()
+void DisplayList::drawChar(int16_t x, int16_t y, char c, const GFXfont *font, uint16_t color, uint16_t bg)
+{
+    text_char(x, y, c, font, color, bg, ST7789_TEXT_OPAQUE);
+}
+
+// Text at baseline (x, y), '\n' starts a new line at x
+void DisplayList::drawText(int16_t x, int16_t y, const char *text, const GFXfont *font, uint16_t color)
+{
+    text_string(x, y, text, font, color, 0, 0);
+}
+
+// Opaque: every glyph cell is filled with `bg`, see ST7789::setTextColor()
+void DisplayList::drawText(int16_t x, int16_t y, const char *text, const GFXfont *font, uint16_t color, uint16_t bg)
+{
+    text_string(x, y, text, font, color, bg, ST7789_TEXT_OPAQUE);
+}
+
+void DisplayList::text_char(int16_t x, int16_t y, char c, const GFXfont *font, uint16_t color, uint16_t bg, uint8_t flags)
+{
+    if (!font || c < font->first || c > font->last) return;
+
+    const GFXglyph *g = &font->glyph[c - font->first];
+    ST7789_Rect box = { (int16_t)(x + g->xOffset), (int16_t)(y + g->yOffset),
+                        (int16_t)(x + g->xOffset + g->width), (int16_t)(y + g->yOffset + g->height) };
+    if (flags & ST7789_TEXT_OPAQUE) {
+        int16_t top, bottom;
+        GlyphCache::fontExtent(font, top, bottom);
+        ST7789_GlyphCell cell = GlyphCache::cell(g, top, bottom);
+        box = { (int16_t)(x + cell.x), (int16_t)(y + cell.y), (int16_t)(x + cell.x + cell.w), (int16_t)(y + cell.y + cell.h) };
+    }
+
+    ST7789_Command *cmd = append(ST7789_CMD_CHAR, box.x0, box.y0, box.x1 - box.x0, box.y1 - box.y0, color, font, flags);
+    if (!cmd) return;
+
+    cmd->x = x;
+    cmd->y = y;
+    cmd->c = c;
+    cmd->bg = bg;
+}
+
+void DisplayList::text_string(int16_t x, int16_t y, const char *text, const GFXfont *font, uint16_t color, uint16_t bg, uint8_t flags)
+{
+    if (!font || !text || !*text) return;
+
+    int16_t top = 0, bottom = 0;
+    if (flags & ST7789_TEXT_OPAQUE)
+        GlyphCache::fontExtent(font, top, bottom);
+
+    // Bounding box of every glyph (or cell) the string will draw
+    int16_t minX = INT16_MAX, minY = INT16_MAX, maxX = INT16_MIN, maxY = INT16_MIN;
+    int16_t cx = x, cy = y;
+    for (const char *p = text; *p; p++) {
+        if (*p == '\n') {
+            cx = x;
+            cy += font->yAdvance;
+            continue;
+        }
+        if (*p < font->first || *p > font->last) continue;
+
+        const GFXglyph *g = &font->glyph[*p - font->first];
+        ST7789_GlyphCell cell = { g->xOffset, g->yOffset, (int16_t)g->width, (int16_t)g->height };
+        if (flags & ST7789_TEXT_OPAQUE)
+            cell = GlyphCache::cell(g, top, bottom);
+
+        minX = MIN(minX, (int16_t)(cx + cell.x));
+        minY = MIN(minY, (int16_t)(cy + cell.y));
+        maxX = MAX(maxX, (int16_t)(cx + cell.x + cell.w));
+        maxY = MAX(maxY, (int16_t)(cy + cell.y + cell.h));
+        cx += g->xAdvance;
+    }
+    if (minX >= maxX || minY >= maxY) return;
+
+    ST7789_Command *cmd = append(ST7789_CMD_TEXT, minX, minY, maxX - minX, maxY - minY, color, font, flags);
+    if (!cmd) return;
+
+    cmd->x = x;
+    cmd->y = y;
+    cmd->bg = bg;
+    attach_text(cmd, text);
+}
+
+// Box (x, y, w, h) filled with `bg`, text at baseline (textX, textY) clipped
+// to it. Replaces whatever was in the box, see ST7789::drawTextBox().
+void DisplayList::drawTextBox(int16_t x, int16_t y, int16_t w, int16_t h, int16_t textX, int16_t textY, const char *text, const GFXfont *font, uint16_t color, uint16_t bg)
+{
+    if (!font || !text) return;
+
+    ST7789_Command *cmd = append(ST7789_CMD_TEXT_BOX, x, y, w, h, color, font);
+    if (!cmd) return;
+
+    cmd->x = textX;
+    cmd->y = textY;
+    cmd->bg = bg;
+    attach_text(cmd, text);
+}
+
+// Copies the text of the last appended command into the arena
+bool DisplayList::attach_text(ST7789_Command *cmd, const char *text)
+{
+    size_t len = strlen(text) + 1;
+    char *copy = (char *)arena_alloc(len);
+    if (!copy) {
+        _count--; // No room for the text, drop the command
+        return false;
+    }
+    memcpy(copy, text, len);
+    cmd->text = copy;
+    return true;
+}
+
+// ===== Execution =====
+
+// Orders the list by layer and drops work that cannot show up:
+// - Commands are stably sorted by layer. Inside a layer, commands that do
+//   not overlap are also ordered top-to-bottom, left-to-right, so
+//   neighbouring commands tend to share rows and the window cache hits.
+// - Commands entirely hidden by a later opaque fill or sprite are removed.
+void DisplayList::prepare()
+{
+    // Insertion sort: the list is short and mostly in order already
+    for (int i = 1; i < _count; i++) {
+        ST7789_Command *cmd = _order[i];
+        int j = i;
+        while (j > 0) {
+            const ST7789_Command *prev = _order[j - 1];
+            bool lowerLayer = cmd->layer < prev->layer;
+            bool earlierPos = cmd->layer == prev->layer
+                && (cmd->bounds.y0 < prev->bounds.y0 || (cmd->bounds.y0 == prev->bounds.y0 && cmd->bounds.x0 < prev->bounds.x0))
+                && !rect_overlaps(cmd->bounds, prev->bounds);
+            if (!lowerLayer && !earlierPos) break;
+            _order[j] = _order[j - 1];
+            j--;
+        }
+        _order[j] = cmd;
+    }
+
+    // Occlusion culling
+    int kept = 0;
+    for (int i = 0; i < _count; i++) {
+        bool hidden = false;
+        for (int j = i + 1; j < _count && !hidden; j++)
+            hidden = is_opaque(*_order[j]) && rect_contains(_order[j]->bounds, _order[i]->bounds);
+        if (!hidden)
+            _order[kept++] = _order[i];
+    }
+    _count = kept;
+}
+
+int DisplayList::count()
+{
+    return _count;
+}
+
+const ST7789_Command &DisplayList::operator[](int i)
+{
+    return *_order[i];
+}
+
+bool DisplayList::empty()
+{
+    return _count == 0;
+}
+
+// True when commands were dropped for lack of room since the last clear()
+bool DisplayList::overflowed()
+{
+    return _overflow;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "gfxfont.h"
+#include "image.h"
+#include "macros.h"
+
+// Screen-space rectangle, x1/y1 are exclusive
+struct ST7789_Rect {
+    int16_t x0, y0, x1, y1;
+};
+
+// Recorded draw call
+enum ST7789_CommandType : uint8_t {
+    ST7789_CMD_FILL,        // fillRect(x, y, w, h, color)
+    ST7789_CMD_SPRITE,      // drawSprite(x, y, w, h, data, flags)
+    ST7789_CMD_BITMAP,      // drawRgbBitmap(x, y, w, h, data, flags)
+    ST7789_CMD_CHAR,        // drawChar(x, y, c, color) with font = data
+    ST7789_CMD_TEXT,        // drawText(x, y, text) with font = data
+    ST7789_CMD_LINE,        // drawLine(x, y, w, h, color), w/h hold the end point
+    ST7789_CMD_SPRITE_BE,   // drawSpriteBE(x, y, w, h, data, flags)
+    ST7789_CMD_BITMAP_BE,   // drawRgbBitmapBE(x, y, w, h, data, flags)
+    ST7789_CMD_RLE,         // drawRle(x, y, w, h, data, flags)
+    ST7789_CMD_IMAGE,       // drawImage(x, y, image = data, palette, flags)
+    ST7789_CMD_TEXT_BOX     // drawTextBox(bounds, x, y, text) with font = data, fills bounds with bg
+};
+
+struct ST7789_Command {
+    ST7789_CommandType type;
+    uint8_t layer;          // Lower layers are drawn first
+    uint8_t flags;          // ST7789_FLIP_H of sprites and images, ST7789_TEXT_OPAQUE of text
+    char c;
+    uint16_t color;
+    int16_t x, y, w, h;
+    uint16_t bg;            // Background of ST7789_TEXT_OPAQUE text
+    ST7789_Rect bounds;     // Screen area the call can touch (clipped)
+    ST7789_Rect clip;       // Clip rect at the time of the call
+    const void *data;
+    const char *text;       // Copied into the arena
+    const uint16_t *palette;    // Palette override of an image
+};
+
+// Per-frame list of draw calls. Commands and text live in one arena that
+// is reset by clear(), so recording a frame never touches the heap.
+// ST7789::drawList() sorts, culls and executes the whole list in one pass.
+class DisplayList {
+private:
+    uint8_t *_arena = nullptr;
+    size_t _arena_size;
+    size_t _arena_used = 0;
+
+    ST7789_Command **_order = nullptr;  // Execution order, points into the arena
+    int _count = 0;
+    int _capacity;
+
+    int16_t _width = 0, _height = 0;
+    ST7789_Rect _clip = {};
+    uint8_t _layer = 0;
+    bool _overflow = false;
+
+    void *arena_alloc(size_t bytes);
+    ST7789_Command *append(ST7789_CommandType type, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, const void *data = nullptr, uint8_t flags = 0);
+    void text_char(int16_t x, int16_t y, char c, const GFXfont *font, uint16_t color, uint16_t bg, uint8_t flags);
+    void text_string(int16_t x, int16_t y, const char *text, const GFXfont *font, uint16_t color, uint16_t bg, uint8_t flags);
+    bool attach_text(ST7789_Command *cmd, const char *text);
+
+public:
+
+    DisplayList(size_t arenaBytes = ST7789_LIST_ARENA_BYTES, int maxCommands = ST7789_LIST_MAX_COMMANDS);
+    ~DisplayList();
+
+    // ---- Setup ---- //
+    bool begin(int16_t width, int16_t height);
+    void end();
+    void clear();
+
+    // ---- State for the following commands ---- //
+    void setLayer(uint8_t layer);
+    void setClipRect(int16_t x, int16_t y, int16_t w, int16_t h);
+    void clearClipRect();
+    const ST7789_Rect &clipRect();
+
+    // ---- Commands ---- //
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    void drawSprite(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags = 0);
+    void drawRgbBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags = 0);
+    void drawSpriteBE(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags = 0);
+    void drawRgbBitmapBE(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags = 0);
+    void drawRle(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *data, uint8_t flags = 0);
+    void drawImage(int16_t x, int16_t y, const ST7789_Image *image, const uint16_t *palette = nullptr, uint8_t flags = 0);
+    void drawChar(int16_t x, int16_t y, char c, const GFXfont *font, uint16_t color);
+    void drawChar(int16_t x, int16_t y, char c, const GFXfont *font, uint16_t color, uint16_t bg);
+    void drawText(int16_t x, int16_t y, const char *text, const GFXfont *font, uint16_t color);
+    void drawText(int16_t x, int16_t y, const char *text, const GFXfont *font, uint16_t color, uint16_t bg);
+    void drawTextBox(int16_t x, int16_t y, int16_t w, int16_t h, int16_t textX, int16_t textY, const char *text, const GFXfont *font, uint16_t color, uint16_t bg);
+    bool push(const ST7789_Command &cmd);
+
+    // ---- Execution ---- //
+    void prepare();
+    int count();
+    const ST7789_Command &operator[](int i);
+    bool empty();
+    bool overflowed();
+
+};
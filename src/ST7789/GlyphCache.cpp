@@ -0,0 +1,159 @@
+#include <string.h>
+#include "GlyphCache.h"
+#include "esp_heap_caps.h"
+#include "utils.h"
+
+// ===== Constructor =====
+GlyphCache::GlyphCache(size_t arenaBytes)
+: _arena_size(arenaBytes)
+{
+}
+
+GlyphCache::~GlyphCache()
+{
+    end();
+}
+
+// ===== Setup =====
+
+// Tiles are sent straight from the arena, so it has to be DMA-capable
+bool GlyphCache::begin()
+{
+    if (_arena) return true;
+
+    _arena = (uint16_t *)heap_caps_malloc(_arena_size, MALLOC_CAP_DMA);
+    if (!_arena) return false;
+
+    _pixels = (_arena_size / sizeof(uint16_t)) & ~1u;
+    _count = 0;
+    return true;
+}
+
+// Queued transfers may still read tiles, wait for the bus before calling
+void GlyphCache::end()
+{
+    heap_caps_free(_arena);
+    _arena = nullptr;
+    _pixels = 0;
+    _count = 0;
+    memset(_extents, 0, sizeof(_extents));
+}
+
+bool GlyphCache::ready()
+{
+    return _arena != nullptr;
+}
+
+// ===== Lookup =====
+
+// Tallest ascent (top, negative) and deepest descent (bottom) of any glyph
+void GlyphCache::fontExtent(const GFXfont *font, int16_t &top, int16_t &bottom)
+{
+    top = 0;
+    bottom = 0;
+    for (int i = 0; i <= font->last - font->first; i++) {
+        const GFXglyph &g = font->glyph[i];
+        if (!g.width || !g.height) continue;
+        top = MIN(top, (int16_t)g.yOffset);
+        bottom = MAX(bottom, (int16_t)(g.yOffset + g.height));
+    }
+}
+
+ST7789_GlyphCell GlyphCache::cell(const GFXglyph *glyph, int16_t top, int16_t bottom)
+{
+    int16_t x0 = MIN(0, (int16_t)glyph->xOffset);
+    int16_t x1 = MAX((int16_t)glyph->xAdvance, (int16_t)(glyph->xOffset + glyph->width));
+    return { x0, top, (int16_t)(x1 - x0), (int16_t)(bottom - top) };
+}
+
+// Same, with the font's extent remembered between calls
+ST7789_GlyphCell GlyphCache::cell(const GFXfont *font, const GFXglyph *glyph)
+{
+    for (int i = 0; i < ST7789_GLYPH_CACHE_FONTS; i++) {
+        if (_extents[i].font == font)
+            return cell(glyph, _extents[i].top, _extents[i].bottom);
+    }
+
+    Extent &e = _extents[_next_extent];
+    _next_extent = (_next_extent + 1) % ST7789_GLYPH_CACHE_FONTS;
+    e.font = font;
+    fontExtent(font, e.top, e.bottom);
+    return cell(glyph, e.top, e.bottom);
+}
+
+GlyphCache::Tile *GlyphCache::find(const GFXfont *font, char c, uint16_t fg, uint16_t bg)
+{
+    for (int i = 0; i < _count; i++) {
+        Tile &t = _tiles[i];
+        if (t.c == c && t.font == font && t.fg == fg && t.bg == bg) {
+            t.lastUse = ++_clock;
+            return &t;
+        }
+    }
+    return nullptr;
+}
+
+// Reserves a w x h tile for the key, evicting the least recently used
+// tiles until a gap is large enough. `busy` returns the last transaction
+// that may still read the evicted pixels, wait for it before rasterizing
+// into the tile. nullptr when the tile can never fit or the cache is not
+// set up.
+GlyphCache::Tile *GlyphCache::insert(const GFXfont *font, char c, uint16_t fg, uint16_t bg, int16_t w, int16_t h, uint32_t &busy)
+{
+    busy = 0;
+    if (!_arena || w <= 0 || h <= 0) return nullptr;
+
+    uint32_t size = ((uint32_t)w * h + 1) & ~1u;
+    if (size > _pixels) return nullptr;
+
+    for (;;) {
+        // First gap that fits, tiles are kept in arena order
+        uint32_t end = 0;
+        int at = -1;
+        for (int i = 0; i <= _count; i++) {
+            uint32_t next = i < _count ? _tiles[i].offset : _pixels;
+            if (next - end >= size) {
+                at = i;
+                break;
+            }
+            if (i < _count) end = _tiles[i].offset + _tiles[i].size;
+        }
+
+        if (at >= 0 && _count < ST7789_GLYPH_CACHE_TILES) {
+            memmove(&_tiles[at + 1], &_tiles[at], (_count - at) * sizeof(Tile));
+            _count++;
+
+            Tile &t = _tiles[at];
+            t.font = font;
+            t.fg = fg;
+            t.bg = bg;
+            t.c = c;
+            t.w = w;
+            t.h = h;
+            t.offset = end;
+            t.size = size;
+            t.lastUse = ++_clock;
+            t.seq = 0;
+            return &t;
+        }
+
+        // Full or fragmented: drop the least recently used tile
+        int lru = 0;
+        for (int i = 1; i < _count; i++) {
+            if (_tiles[i].lastUse < _tiles[lru].lastUse) lru = i;
+        }
+        if ((int32_t)(_tiles[lru].seq - busy) > 0) busy = _tiles[lru].seq;
+        remove(lru);
+    }
+}
+
+void GlyphCache::remove(int index)
+{
+    memmove(&_tiles[index], &_tiles[index + 1], (_count - index - 1) * sizeof(Tile));
+    _count--;
+}
+
+uint16_t *GlyphCache::pixels(const Tile *tile)
+{
+    return _arena + tile->offset;
+}
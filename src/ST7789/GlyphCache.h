@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "gfxfont.h"
+#include "macros.h"
+
+// Pixels an opaque glyph covers, relative to its pen position on the
+// baseline. Horizontally the advance plus any overhang of the glyph,
+// vertically the tallest ascent to the deepest descent of the font, so
+// neighbouring cells of a string join up without gaps.
+struct ST7789_GlyphCell {
+    int16_t x, y;
+    int16_t w, h;
+};
+
+// Opaque glyphs rasterized to RGB565 tiles in panel byte order, so a
+// cached glyph is drawn like a sprite: one window, one transfer. Tiles are
+// keyed on (font, char, fg, bg) and live in one DMA-capable arena, the
+// least recently used ones make room for new tiles when it is full.
+class GlyphCache {
+public:
+    struct Tile {
+        const GFXfont *font;
+        uint16_t fg, bg;
+        char c;
+        int16_t w, h;
+        uint32_t offset;        // In pixels from the start of the arena
+        uint32_t size;          // Pixels reserved, even for 32-bit alignment
+        uint32_t lastUse;       // LRU stamp
+        uint32_t seq;           // Last SPI transaction that may read the tile
+    };
+
+private:
+    uint16_t *_arena = nullptr;
+    size_t _arena_size;
+    uint32_t _pixels = 0;
+
+    Tile _tiles[ST7789_GLYPH_CACHE_TILES];    // Sorted by offset
+    int _count = 0;
+    uint32_t _clock = 0;
+
+    // Vertical extent of the last fonts asked for
+    struct Extent {
+        const GFXfont *font;
+        int16_t top, bottom;
+    };
+    Extent _extents[ST7789_GLYPH_CACHE_FONTS] = {};
+    int _next_extent = 0;
+
+    void remove(int index);
+
+public:
+
+    GlyphCache(size_t arenaBytes = ST7789_GLYPH_CACHE_BYTES);
+    ~GlyphCache();
+
+    // ---- Setup ---- //
+    bool begin();
+    void end();
+    bool ready();
+
+    // ---- Lookup ---- //
+    ST7789_GlyphCell cell(const GFXfont *font, const GFXglyph *glyph);
+    static ST7789_GlyphCell cell(const GFXglyph *glyph, int16_t top, int16_t bottom);
+    static void fontExtent(const GFXfont *font, int16_t &top, int16_t &bottom);
+    Tile *find(const GFXfont *font, char c, uint16_t fg, uint16_t bg);
+    Tile *insert(const GFXfont *font, char c, uint16_t fg, uint16_t bg, int16_t w, int16_t h, uint32_t &busy);
+    uint16_t *pixels(const Tile *tile);
+
+};
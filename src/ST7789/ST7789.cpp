@@ -1,10 +1,15 @@
 #include <assert.h>
+#include <string.h>
 #include "ST7789.h"
 #include "commands.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/ledc.h"
 #include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "esp_memory_utils.h"
 #include "utils.h"
 #include "../engine/IOHelper.h"
 #include "./fonts/FreeMono/FreeMono9pt7b.h"
@@ -23,7 +28,9 @@ ST7789::ST7789(
     int height,
     int spi_host,
     int spi_freq,
-    int dma_lines
+    int dma_lines,
+    int dma_buffers,
+    int queue_size
 )
 : _dc(dc), _rst(rst), _bl(bl),
   _sclk(sclk), _mosi(mosi), _miso(miso),
@@ -31,43 +38,204 @@ ST7789::ST7789(
   _spi(nullptr),
   _spi_host(spi_host),
   _spi_freq(spi_freq),
+  _queue_size(queue_size),
+  _trans(nullptr),
+  _trans_queued(0),
+  _trans_done(0),
   _dma_lines(dma_lines),
-  _dma_buf(nullptr)
+  _dma_count(dma_buffers > 1 ? dma_buffers : 1),
+  _dma_bufs(nullptr),
+  _dma_seqs(nullptr),
+  _dma_index(0),
+  _dma_buf(nullptr),
+  _dma_used(0),
+  _clip_x0(0), _clip_y0(0),
+  _clip_x1(width), _clip_y1(height)
 {
 }
 
 // ===== Low-level helpers =====
-inline void ST7789::dc_cmd()  { gpio_set_level((gpio_num_t)_dc, 0); }
-inline void ST7789::dc_data() { gpio_set_level((gpio_num_t)_dc, 1); }
 
-void ST7789::spi_write(const uint8_t *data, int len)
+// Runs right before each transaction goes out on the bus. The DC pin and
+// its level travel in t->user as (pin << 1) | level, so no instance is needed.
+void IRAM_ATTR ST7789::spi_pre_transfer_cb(spi_transaction_t *t)
 {
-    spi_transaction_t t = {};
-    t.length = len * 8;
-    t.tx_buffer = data;
-    ESP_ERROR_CHECK(spi_device_transmit(_spi, &t));
+    uint32_t user = (uint32_t)(uintptr_t)t->user;
+    gpio_set_level((gpio_num_t)(user >> 1), user & 1);
+}
+
+// Sends len bytes with DC low (command) or high (data) and returns the
+// sequence number of the transaction. In async mode the call returns as
+// soon as the transaction is queued, so anything longer than 4 bytes must
+// stay untouched until spi_wait() has seen that sequence number.
+uint32_t ST7789::spi_write(const void *data, int len, bool dc)
+{
+    spi_transaction_t local = {};
+    spi_transaction_t *t = &local;
+
+    if (_queue_size > 1) {
+        // Recycle the oldest slot once the ring is full (results come back in order)
+        if (_trans_queued - _trans_done >= (uint32_t)_queue_size)
+            spi_wait(_trans_done + 1);
+        t = &_trans[_trans_queued % _queue_size];
+        *t = {};
+    }
+
+    t->length = len * 8;
+    t->user = (void *)(uintptr_t)((_dc << 1) | (dc ? 1 : 0));
+
+    // Short writes travel inside the transaction itself
+    if (len <= 4) {
+        t->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->tx_data, data, len);
+    } else {
+        t->tx_buffer = data;
+    }
+
+    _trans_queued++;
+
+    ST7789_BusCounters &bus = _bus[_bus_primitive];
+    taskENTER_CRITICAL(&_bus_lock);
+    bus.transactions++;
+    if (dc && _bus_pixels)
+        bus.pixelBytes += len;
+    else
+        bus.commandBytes += len;
+    taskEXIT_CRITICAL(&_bus_lock);
+
+    if (_queue_size > 1) {
+        ESP_ERROR_CHECK(spi_device_queue_trans(_spi, t, portMAX_DELAY));
+    } else {
+        int64_t start = esp_timer_get_time();
+        ESP_ERROR_CHECK(spi_device_polling_transmit(_spi, t));
+        bus_waited(esp_timer_get_time() - start);
+        _trans_done = _trans_queued;
+    }
+
+    return _trans_queued;
+}
+
+// Blocks until the transaction with the given sequence number has finished
+void ST7789::spi_wait(uint32_t seq)
+{
+    if ((int32_t)(seq - _trans_done) <= 0) return;
+
+    int64_t start = esp_timer_get_time();
+    while ((int32_t)(seq - _trans_done) > 0) {
+        spi_transaction_t *done;
+        ESP_ERROR_CHECK(spi_device_get_trans_result(_spi, &done, portMAX_DELAY));
+        _trans_done++;
+    }
+    bus_waited(esp_timer_get_time() - start);
+}
+
+void ST7789::bus_waited(int64_t us)
+{
+    _bus_wait += us;
+
+    taskENTER_CRITICAL(&_bus_lock);
+    _bus[_bus_primitive].waitUs += (uint32_t)us;
+    taskEXIT_CRITICAL(&_bus_lock);
 }
 
 void ST7789::write_cmd(uint8_t cmd)
 {
-    dc_cmd();
-    spi_write(&cmd, 1);
+    _bus_pixels = cmd == ST7789_RAMWR;
+    spi_write(&cmd, 1, false);
 }
 
 void ST7789::write_data(const uint8_t *data, int len)
 {
-    dc_data();
-    spi_write(data, len);
+    spi_write(data, len, true);
+}
+
+// `pixels` is expected to come from the latest dma_alloc() (or be <= 2 pixels)
+void ST7789::write_pixels(const uint16_t *pixels, int count)
+{
+    _dma_seqs[_dma_index] = spi_write(pixels, count * 2, true);
+}
+
+void ST7789::waitIdle()
+{
+    spi_wait(_trans_queued);
+}
+
+// Time spent blocked on the bus since the last call, in microseconds
+uint32_t ST7789::takeBusWait()
+{
+    uint32_t us = (uint32_t)_bus_wait;
+    _bus_wait = 0;
+    return us;
+}
+
+// SPI traffic since the last call (or resetBusStats()), per primitive and
+// in total. Meant to be taken once per frame; it is safe to call while the
+// render task is drawing, its frame then counts for the next take.
+void ST7789::takeBusStats(ST7789_BusStats &out)
+{
+    taskENTER_CRITICAL(&_bus_lock);
+    memcpy(out.primitive, _bus, sizeof(_bus));
+    memset(_bus, 0, sizeof(_bus));
+    taskEXIT_CRITICAL(&_bus_lock);
+
+    out.total = {};
+    for (int i = 0; i < ST7789_BUS_PRIMITIVES; i++) {
+        const ST7789_BusCounters &c = out.primitive[i];
+        out.total.transactions += c.transactions;
+        out.total.commandBytes += c.commandBytes;
+        out.total.pixelBytes += c.pixelBytes;
+        out.total.windows += c.windows;
+        out.total.windowChanges += c.windowChanges;
+        out.total.waitUs += c.waitUs;
+    }
+}
+
+void ST7789::resetBusStats()
+{
+    taskENTER_CRITICAL(&_bus_lock);
+    memset(_bus, 0, sizeof(_bus));
+    taskEXIT_CRITICAL(&_bus_lock);
 }
 
 // ===== DMA =====
-void ST7789::alloc_dma_buffer()
+void ST7789::alloc_dma_buffers()
 {
-    _dma_buf = (uint16_t *)heap_caps_malloc(
-        _width * _dma_lines * sizeof(uint16_t),
-        MALLOC_CAP_DMA
-    );
-    assert(_dma_buf && "DMA buffer alloc failed");
+    _dma_bufs = (uint16_t **)heap_caps_calloc(_dma_count, sizeof(uint16_t *), MALLOC_CAP_DEFAULT);
+    _dma_seqs = (uint32_t *)heap_caps_calloc(_dma_count, sizeof(uint32_t), MALLOC_CAP_DEFAULT);
+    assert(_dma_bufs && _dma_seqs && "DMA ring alloc failed");
+
+    for (int i = 0; i < _dma_count; i++) {
+        _dma_bufs[i] = (uint16_t *)heap_caps_malloc(
+            _width * _dma_lines * sizeof(uint16_t),
+            MALLOC_CAP_DMA
+        );
+        assert(_dma_bufs[i] && "DMA buffer alloc failed");
+    }
+
+    _dma_index = 0;
+    _dma_buf = _dma_bufs[0];
+}
+
+// Hands out room for `pixels` pixels in the current DMA buffer. Consecutive
+// calls get disjoint slices, so a new slice can be filled while earlier ones
+// are still being sent. When the buffer runs out we move on to the next one
+// in the ring, which only blocks if that one is still in flight.
+uint16_t *ST7789::dma_alloc(int pixels)
+{
+    int capacity = _width * _dma_lines;
+    pixels = (pixels + 1) & ~1; // Keep every slice 32-bit aligned for DMA
+    assert(pixels <= capacity && "DMA slice larger than a buffer, draw in chunks");
+
+    if (_dma_used + pixels > capacity) {
+        _dma_index = (_dma_index + 1) % _dma_count;
+        _dma_buf = _dma_bufs[_dma_index];
+        spi_wait(_dma_seqs[_dma_index]);
+        _dma_used = 0;
+    }
+
+    uint16_t *slice = _dma_buf + _dma_used;
+    _dma_used += pixels;
+    return slice;
 }
 
 // ===== Init =====
@@ -77,7 +245,12 @@ void ST7789::begin()
     gpio_set_direction((gpio_num_t)_dc, GPIO_MODE_OUTPUT);
     gpio_set_direction((gpio_num_t)_rst, GPIO_MODE_OUTPUT);
 
-    alloc_dma_buffer();
+    alloc_dma_buffers();
+
+    if (_queue_size > 1) {
+        _trans = (spi_transaction_t *)heap_caps_calloc(_queue_size, sizeof(spi_transaction_t), MALLOC_CAP_DEFAULT);
+        assert(_trans && "SPI transaction pool alloc failed");
+    }
 
     // SPI bus
     spi_bus_config_t buscfg = {};
@@ -92,8 +265,9 @@ void ST7789::begin()
     devcfg.clock_speed_hz = _spi_freq * 1000 * 1000;
     devcfg.mode = 3;
     devcfg.spics_io_num = -1; // No CS pin on the display
-    devcfg.queue_size = 1;
+    devcfg.queue_size = _queue_size > 1 ? _queue_size : 1;
     devcfg.flags = SPI_DEVICE_HALFDUPLEX;
+    devcfg.pre_cb = spi_pre_transfer_cb; // Drives DC for queued transactions
 
     ESP_ERROR_CHECK(spi_bus_add_device((spi_host_device_t)_spi_host, &devcfg, &_spi));
 
@@ -123,6 +297,7 @@ void ST7789::st7789_init()
     _rotation = 0;
     _colorOrderBGR = true;
     _madctl = MADCTL_BGR;
+    invalidate_window();
 
     write_cmd(ST7789_SWRESET);
     vTaskDelay(pdMS_TO_TICKS(150));
@@ -168,13 +343,38 @@ void ST7789::setFont(const GFXfont *font)
     _font = font;
 }
 
+// Glyphs only touch their set pixels
 void ST7789::setTextColor(uint16_t color)
 {
     _textColor = color;
+    _textOpaque = false;
+}
+
+// Glyphs fill their whole cell with `bg`, erasing what was there. Each
+// (font, char, color, bg) is rasterized once into the glyph cache and then
+// sent like a sprite, one window per glyph instead of one per run.
+void ST7789::setTextColor(uint16_t color, uint16_t bg)
+{
+    _textColor = color;
+    _textBg = bg;
+    _textOpaque = true;
+}
+
+// Frees the tiles, e.g. when a scene with different text takes over
+void ST7789::clearGlyphCache()
+{
+    waitIdle();
+    _glyphs.end();
+    _glyphs_failed = false;
 }
 
 void ST7789::measureText(const char* text, int16_t& w, int16_t& h) {
-    if (!_font || !text) {
+    measureText(_font, text, w, h);
+}
+
+// Doesn't touch the driver, safe while another task is drawing
+void ST7789::measureText(const GFXfont *font, const char* text, int16_t& w, int16_t& h) {
+    if (!font || !text) {
         w = h = 0;
         return;
     }
@@ -185,9 +385,9 @@ void ST7789::measureText(const char* text, int16_t& w, int16_t& h) {
 
     while (*text) {
         char c = *text++;
-        if (c < _font->first || c > _font->last) continue;
+        if (c < font->first || c > font->last) continue;
 
-        const GFXglyph* g = &_font->glyph[c - _font->first];
+        const GFXglyph* g = &font->glyph[c - font->first];
 
         int16_t y1 = g->yOffset;
         int16_t y2 = g->yOffset + g->height;
@@ -203,10 +403,19 @@ void ST7789::measureText(const char* text, int16_t& w, int16_t& h) {
 }
 
 void ST7789::drawChar(int16_t x, int16_t y, char c, uint16_t color) {
+    BusScope bus(this, ST7789_BUS_TEXT);
     if (!_font) return;
     if (c < _font->first || c > _font->last) return;
+    if (record(ST7789_CMD_CHAR, x, y, 0, 0, color, _font, c, nullptr, _textOpaque ? ST7789_TEXT_OPAQUE : 0)) return;
 
-    const GFXglyph* glyph = &_font->glyph[c - _font->first];
+    if (_textOpaque)
+        opaque_char(x, y, c, color, _textBg);
+    else
+        glyph_runs(x, y, &_font->glyph[c - _font->first], color);
+}
+
+// Set pixels of a glyph as horizontal runs, the background stays
+void ST7789::glyph_runs(int16_t x, int16_t y, const GFXglyph *glyph, uint16_t color) {
     const uint8_t* bitmap = _font->bitmap + glyph->bitmapOffset;
 
     int16_t w = glyph->width;
@@ -248,23 +457,83 @@ void ST7789::drawChar(int16_t x, int16_t y, char c, uint16_t color) {
     }
 }
 
+// Cell of a glyph in one go, from the glyph cache when there is room
+void ST7789::opaque_char(int16_t x, int16_t y, char c, uint16_t color, uint16_t bg) {
+    const GFXglyph *glyph = &_font->glyph[c - _font->first];
+    ST7789_GlyphCell cell = _glyphs.cell(_font, glyph);
+    int16_t cx = x + cell.x;
+    int16_t cy = y + cell.y;
+
+    if (cx >= _clip_x1 || cy >= _clip_y1 || cx + cell.w <= _clip_x0 || cy + cell.h <= _clip_y0) return;
+
+    if (!_glyphs.ready() && !_glyphs_failed && !_glyphs.begin()) {
+        ESP_LOGW(TAG, "No DMA memory for the glyph cache, drawing text by runs");
+        _glyphs_failed = true;
+    }
+
+    GlyphCache::Tile *tile = _glyphs.find(_font, c, color, bg);
+    if (!tile) {
+        uint32_t busy;
+        tile = _glyphs.insert(_font, c, color, bg, cell.w, cell.h, busy);
+        if (tile) {
+            // Evicted tiles may still be on their way to the panel
+            spi_wait(busy);
+
+            uint16_t *dst = _glyphs.pixels(tile);
+            uint16_t fgBE = (color >> 8) | (color << 8);
+            uint16_t bgBE = (bg >> 8) | (bg << 8);
+            for (int i = 0; i < cell.w * cell.h; i++)
+                dst[i] = bgBE;
+
+            const uint8_t *bitmap = _font->bitmap + glyph->bitmapOffset;
+            uint8_t bitMask = 0;
+            uint8_t bits = 0;
+            for (int16_t yy = 0; yy < glyph->height; yy++) {
+                uint16_t *row = dst + (glyph->yOffset - cell.y + yy) * cell.w + glyph->xOffset - cell.x;
+                for (int16_t xx = 0; xx < glyph->width; xx++) {
+                    if (!(bitMask >>= 1)) {
+                        bits = *bitmap++;
+                        bitMask = 0x80;
+                    }
+                    if (bits & bitMask) row[xx] = fgBE;
+                }
+            }
+        }
+    }
+
+    if (tile) {
+        sprite(cx, cy, cell.w, cell.h, _glyphs.pixels(tile), true, false);
+        tile->seq = _trans_queued;
+        return;
+    }
+
+    // Too big for the cache (or no cache): background, then the runs
+    fillRect(cx, cy, cell.w, cell.h, bg);
+    glyph_runs(x, y, glyph, color);
+}
+
 // Add this private helper to your class
 void ST7789::drawFastRun(int16_t x, int16_t y, int16_t len, uint16_t colorLE) {
-    if (x < 0 || x >= _width || y < 0 || y >= _height) return;
-    if (x + len > _width) len = _width - x;
+    BusScope bus(this, ST7789_BUS_TEXT);
+    if (record(ST7789_CMD_FILL, x, y, len, 1, (colorLE >> 8) | (colorLE << 8))) return;
+    if (y < _clip_y0 || y >= _clip_y1) return;
+    if (x < _clip_x0) { len -= _clip_x0 - x; x = _clip_x0; }
+    if (x + len > _clip_x1) len = _clip_x1 - x;
+    if (len <= 0) return;
+
+    if (_fb) {
+        fb_fill(x, y, len, 1, colorLE);
+        return;
+    }
 
     set_window(x, y, x + len - 1, y);
 
+    uint16_t *buf = dma_alloc(len);
     for (int i = 0; i < len; i++) {
-        _dma_buf[i] = colorLE;
+        buf[i] = colorLE;
     }
 
-    spi_transaction_t t = {};
-    t.tx_buffer = _dma_buf;
-    t.length = len * 16;
-
-    dc_data();
-    ESP_ERROR_CHECK(spi_device_polling_transmit(_spi, &t));
+    write_pixels(buf, len);
 }
 
 // void ST7789::drawChar(int16_t x, int16_t y, char c, uint16_t color) {
@@ -301,6 +570,103 @@ void ST7789::drawChar(int16_t x, int16_t y, char c) {
     drawChar(x, y, c, _textColor);
 }
 
+// Draws text with its baseline at (x, y), '\n' starts a new line at x
+void ST7789::drawText(int16_t x, int16_t y, const char *text) {
+    if (!_font || !text) return;
+
+    int16_t cx = x;
+    while (*text) {
+        char c = *text++;
+
+        if (c == '\n') {
+            cx = x;
+            y += _font->yAdvance;
+            continue;
+        }
+
+        if (c < _font->first || c > _font->last) continue;
+
+        drawChar(cx, y, c, _textColor);
+        cx += _font->glyph[c - _font->first].xAdvance;
+    }
+}
+
+// Fills the box (x, y, w, h) with the background of setTextColor(color, bg)
+// and draws text with its baseline at (textX, textY) inside it, clipped to
+// the box. Drawing directly, every band of the box is composed in the DMA
+// ring and sent as one rectangle, so the old text is replaced without first
+// being erased. Into the framebuffer or a band it is a fill plus glyphs.
+void ST7789::drawTextBox(int16_t x, int16_t y, int16_t w, int16_t h, int16_t textX, int16_t textY, const char *text) {
+    BusScope bus(this, ST7789_BUS_TEXT);
+    if (!_font || !text || w <= 0 || h <= 0) return;
+
+    int16_t x0 = MAX(x, _clip_x0), y0 = MAX(y, _clip_y0);
+    int16_t x1 = MIN((int16_t)(x + w), _clip_x1), y1 = MIN((int16_t)(y + h), _clip_y1);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    if (_fb || _cmds) {
+        int16_t clip_x0 = _clip_x0, clip_y0 = _clip_y0;
+        int16_t clip_x1 = _clip_x1, clip_y1 = _clip_y1;
+        bool opaque = _textOpaque;
+
+        _clip_x0 = x0;
+        _clip_y0 = y0;
+        _clip_x1 = x1;
+        _clip_y1 = y1;
+        _textOpaque = false;
+        fillRect(x0, y0, x1 - x0, y1 - y0, _textBg);
+        drawText(textX, textY, text);
+
+        _clip_x0 = clip_x0;
+        _clip_y0 = clip_y0;
+        _clip_x1 = clip_x1;
+        _clip_y1 = clip_y1;
+        _textOpaque = opaque;
+        return;
+    }
+
+    int16_t cw = x1 - x0;
+    uint16_t fgBE = (_textColor >> 8) | (_textColor << 8);
+    uint16_t bgBE = (_textBg >> 8) | (_textBg << 8);
+    int band = (_width * _dma_lines) / cw;
+
+    for (int16_t by = y0; by < y1; by += band) {
+        int lines = MIN(band, y1 - by);
+        uint16_t *buf = dma_alloc(cw * lines);
+        for (int i = 0; i < cw * lines; i++)
+            buf[i] = bgBE;
+
+        // Set pixels of every glyph that reaches into this band
+        int16_t cx = textX, cy = textY;
+        for (const char *p = text; *p; p++) {
+            if (*p == '\n') {
+                cx = textX;
+                cy += _font->yAdvance;
+                continue;
+            }
+            if (*p < _font->first || *p > _font->last) continue;
+
+            const GFXglyph *g = &_font->glyph[*p - _font->first];
+            const uint8_t *bitmap = _font->bitmap + g->bitmapOffset;
+            int16_t gx = cx + g->xOffset, gy = cy + g->yOffset;
+            cx += g->xAdvance;
+
+            int16_t rx0 = MAX(gx, x0), rx1 = MIN((int16_t)(gx + g->width), x1);
+            int16_t ry0 = MAX(gy, by), ry1 = MIN((int16_t)(gy + g->height), (int16_t)(by + lines));
+            for (int16_t ry = ry0; ry < ry1; ry++) {
+                uint16_t *row = buf + (ry - by) * cw;
+                int bit = (ry - gy) * g->width + (rx0 - gx);
+                for (int16_t rx = rx0; rx < rx1; rx++, bit++) {
+                    if (bitmap[bit >> 3] & (0x80 >> (bit & 7))) row[rx - x0] = fgBE;
+                }
+            }
+        }
+
+        set_window(x0, by, x1 - 1, by + lines - 1);
+        write_pixels(buf, cw * lines);
+    }
+}
+
 void ST7789::print(const char* text) {
     while (*text) {
         char c = *text++;
@@ -469,87 +835,403 @@ void ST7789::setCursor(uint16_t x, uint16_t y){
 //     write_cmd(ST7789_RAMWR);
 // }
 
+// The panel keeps CASET/RASET until they are written again, so only the
+// ranges that changed since the last call are sent. RAMWR is always needed
+// to restart the write pointer at the window origin. All of it is queued,
+// the coordinates travel inside the transactions (no buffers to wait for).
 void ST7789::set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
     uint8_t data[4];
+    bool changed = x0 != _win_x0 || x1 != _win_x1 || y0 != _win_y0 || y1 != _win_y1;
+
+    taskENTER_CRITICAL(&_bus_lock);
+    _bus[_bus_primitive].windows++;
+    if (changed) _bus[_bus_primitive].windowChanges++;
+    taskEXIT_CRITICAL(&_bus_lock);
+
+    if (x0 != _win_x0 || x1 != _win_x1) {
+        write_cmd(ST7789_CASET);
+        data[0] = x0 >> 8;
+        data[1] = x0 & 0xFF;
+        data[2] = x1 >> 8;
+        data[3] = x1 & 0xFF;
+        write_data(data, 4);
+        _win_x0 = x0;
+        _win_x1 = x1;
+    }
 
-    write_cmd(ST7789_CASET);
-    data[0] = x0 >> 8;
-    data[1] = x0 & 0xFF;
-    data[2] = x1 >> 8;
-    data[3] = x1 & 0xFF;
-    write_data(data, 4);
-
-    write_cmd(ST7789_RASET);
-    data[0] = y0 >> 8;
-    data[1] = y0 & 0xFF;
-    data[2] = y1 >> 8;
-    data[3] = y1 & 0xFF;
-    write_data(data, 4);
+    if (y0 != _win_y0 || y1 != _win_y1) {
+        write_cmd(ST7789_RASET);
+        data[0] = y0 >> 8;
+        data[1] = y0 & 0xFF;
+        data[2] = y1 >> 8;
+        data[3] = y1 & 0xFF;
+        write_data(data, 4);
+        _win_y0 = y0;
+        _win_y1 = y1;
+    }
 
     write_cmd(ST7789_RAMWR);
 }
 
+// Forget the cached window, e.g. after a reset or a MADCTL change
+void ST7789::invalidate_window()
+{
+    _win_x0 = _win_y0 = 0xFFFF;
+    _win_x1 = _win_y1 = 0xFFFF;
+}
+
 void ST7789::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
-    // Clip pixels outside the screen
-    if (x < 0 || x >= _width || y < 0 || y >= _height) return;
+    BusScope bus(this, ST7789_BUS_LINE);
+    if (record(ST7789_CMD_FILL, x, y, 1, 1, color)) return;
 
-    set_window(x, y, x, y);  // set window to 1 pixel
+    // Clip pixels outside the screen (or the clip rect)
+    if (x < _clip_x0 || x >= _clip_x1 || y < _clip_y0 || y >= _clip_y1) return;
 
     uint16_t c = (color >> 8) | (color << 8); // endian swap
-    dc_data();
 
-    spi_transaction_t t = {};
-    t.tx_buffer = &c;
-    t.length    = 16;  // bits
-    ESP_ERROR_CHECK(spi_device_polling_transmit(_spi, &t));
+    if (_fb) {
+        fb_fill(x, y, 1, 1, c);
+        return;
+    }
+
+    set_window(x, y, x, y);  // set window to 1 pixel
+    write_pixels(&c, 1); // Fits in the transaction, no buffer needed
 }
 
 
 void ST7789::fillScreen(uint16_t color)
 {
-    set_window(0, 0, _width - 1, _height - 1);
-
+    BusScope bus(this, ST7789_BUS_FILL);
     uint16_t c = (color >> 8) | (color << 8);
 
-    for (int i = 0; i < _width * _dma_lines; i++) {
-        _dma_buf[i] = c;
+    if (_fb || _cmds || has_clip()) {
+        fillRect(0, 0, _width, _height, color);
+        return;
     }
 
-    spi_transaction_t t = {};
-    t.tx_buffer = _dma_buf;
+    set_window(0, 0, _width - 1, _height - 1);
 
-    dc_data();
+    uint16_t *buf = dma_alloc(_width * _dma_lines);
+    for (int i = 0; i < _width * _dma_lines; i++) {
+        buf[i] = c;
+    }
 
+    // The same buffer is queued once per band, it is only read by the DMA
     int remaining = _height;
     while (remaining > 0) {
         int lines = (remaining > _dma_lines) ? _dma_lines : remaining;
-        t.length = lines * _width * 16;
-        ESP_ERROR_CHECK(spi_device_polling_transmit(_spi, &t));
+        write_pixels(buf, lines * _width);
         remaining -= lines;
     }
 }
 
 // ===== Bitmaps =====
 
-void ST7789::drawSprite(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap)
+// Draws an opaque sprite, mirrored with ST7789_FLIP_H in `flags`. Flipping
+// costs nothing extra: rows are read backwards while they are copied into
+// the DMA buffer or framebuffer anyway.
+void ST7789::drawSprite(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags)
 {
+    BusScope bus(this, ST7789_BUS_SPRITE);
     if (!bitmap || w <= 0 || h <= 0) return;
+    if (record(ST7789_CMD_SPRITE, x, y, w, h, 0, bitmap, 0, nullptr, flags)) return;
+    sprite(x, y, w, h, bitmap, false, flags & ST7789_FLIP_H);
+}
+
+// Copies `count` pixels, last one first when `flip` is set
+static inline void copy_pixels(uint16_t *dst, const uint16_t *src, int count, bool flip)
+{
+    if (!flip) {
+        memcpy(dst, src, count * sizeof(uint16_t));
+        return;
+    }
+    for (int i = 0; i < count; i++)
+        dst[i] = src[count - 1 - i];
+}
+
+// Draws a run-length encoded transparent sprite (image2cpp.py --rle).
+// Each row holds a span count followed by (skip, count, pixels...) spans,
+// pixels in panel byte order. Into the framebuffer or a band every span is
+// one memcpy and the whole sprite is one dirty rect; drawing directly still
+// needs a window per span, since the panel cannot be read back.
+void ST7789::drawRle(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *data, uint8_t flags)
+{
+    BusScope bus(this, ST7789_BUS_RLE);
+    if (!data || w <= 0 || h <= 0) return;
+    if (record(ST7789_CMD_RLE, x, y, w, h, 0, data, 0, nullptr, flags)) return;
+    bool flip = flags & ST7789_FLIP_H;
+
+    const uint16_t *p = data;
+    for (int16_t row = 0; row < h; row++) {
+        int16_t yy = y + row;
+        if (yy >= _clip_y1) break;
+
+        bool visible = yy >= _clip_y0;
+        uint16_t spans = *p++;
+        int16_t col = 0;
+
+        for (uint16_t s = 0; s < spans; s++) {
+            col += *p++;
+            uint16_t count = *p++;
+            const uint16_t *pixels = p;
+            p += count;
+
+            // Screen position of the span, mirrored spans run from the right edge
+            int16_t xx = flip ? x + w - col - count : x + col;
+            col += count;
+
+            int16_t x0 = MAX(xx, _clip_x0);
+            int16_t x1 = MIN(xx + count, _clip_x1);
+            if (!visible || x0 >= x1) continue;
+
+            const uint16_t *src = pixels + (flip ? xx + count - x1 : x0 - xx);
+            if (_fb) {
+                copy_pixels(_fb + (yy - _fb_y0) * _fb_stride + (x0 - _fb_x0), src, x1 - x0, flip);
+            }
+            else {
+                uint16_t *buf = dma_alloc(x1 - x0);
+                copy_pixels(buf, src, x1 - x0, flip);
+                set_window(x0, yy, x1 - 1, yy);
+                write_pixels(buf, x1 - x0);
+            }
+        }
+    }
+
+    if (_fb && !_replaying) {
+        int16_t x0 = MAX(x, _clip_x0), y0 = MAX(y, _clip_y0);
+        int16_t x1 = MIN(x + w, _clip_x1), y1 = MIN(y + h, _clip_y1);
+        if (x0 < x1 && y0 < y1)
+            mark_dirty(x0, y0, x1, y1);
+    }
+}
+
+// Expands one encoded row of `image` starting at `src`, writing columns
+// [from, to) to dst[0..]. Palette formats expand through `palette`, which
+// is already in panel order. Returns where the next row starts, so rows
+// above the clip are skipped with from == to.
+static const void *decode_row(const ST7789_Image &image, const uint16_t *palette, const void *src, uint16_t *dst, int16_t from, int16_t to)
+{
+    int16_t w = image.width;
+
+    switch (image.format) {
+        case ST7789_IMAGE_RGB565: {
+            const uint16_t *p = (const uint16_t *)src;
+            if (from < to)
+                memcpy(dst, p + from, (to - from) * sizeof(uint16_t));
+            return p + w;
+        }
+
+        case ST7789_IMAGE_RLE565: {
+            const uint16_t *p = (const uint16_t *)src;
+            for (int16_t col = 0; col < w;) {
+                uint16_t token = *p++;
+                int16_t n = (token & 0x7FFF) + 1;
+                int16_t a = MAX(col, from), b = MIN(col + n, to);
+                if (token & 0x8000) {
+                    if (a < b) memcpy(dst + (a - from), p + (a - col), (b - a) * sizeof(uint16_t));
+                    p += n;
+                }
+                else {
+                    uint16_t c = *p++;
+                    for (int16_t i = a; i < b; i++) dst[i - from] = c;
+                }
+                col += n;
+            }
+            return p;
+        }
+
+        case ST7789_IMAGE_PAL8_RLE: {
+            const uint8_t *p = (const uint8_t *)src;
+            for (int16_t col = 0; col < w;) {
+                uint8_t token = *p++;
+                int16_t n = (token & 0x7F) + 1;
+                int16_t a = MAX(col, from), b = MIN(col + n, to);
+                if (token & 0x80) {
+                    for (int16_t i = a; i < b; i++) dst[i - from] = palette[p[i - col]];
+                    p += n;
+                }
+                else {
+                    uint16_t c = palette[*p++];
+                    for (int16_t i = a; i < b; i++) dst[i - from] = c;
+                }
+                col += n;
+            }
+            return p;
+        }
+
+        case ST7789_IMAGE_PAL8: {
+            const uint8_t *p = (const uint8_t *)src;
+            for (int16_t col = from; col < to; col++)
+                *dst++ = palette[p[col]];
+            return p + w;
+        }
+
+        case ST7789_IMAGE_PAL4: {
+            const uint8_t *p = (const uint8_t *)src;
+            int16_t col = from;
+            if ((col & 1) && col < to)
+                *dst++ = palette[p[col++ >> 1] & 0x0F];
+            for (; col + 1 < to; col += 2) {
+                uint8_t pair = p[col >> 1];
+                *dst++ = palette[pair >> 4];
+                *dst++ = palette[pair & 0x0F];
+            }
+            if (col < to)
+                *dst++ = palette[p[col >> 1] >> 4];
+            return p + ((w + 1) >> 1);
+        }
+    }
+
+    return src;
+}
+
+static inline void reverse_pixels(uint16_t *p, int count)
+{
+    for (int i = 0, j = count - 1; i < j; i++, j--) {
+        uint16_t c = p[i];
+        p[i] = p[j];
+        p[j] = c;
+    }
+}
+
+// Draws a compressed opaque image (image2cpp.py --compress). Rows are
+// decoded straight into the DMA staging buffer, the framebuffer or the
+// current band, so the image is never expanded anywhere else.
+// `palette` replaces the image's own palette (same size, panel order),
+// e.g. an all-white one for a hit flash. With ST7789_FLIP_H every decoded
+// row is reversed in place.
+void ST7789::drawImage(int16_t x, int16_t y, const ST7789_Image *image, const uint16_t *palette, uint8_t flags)
+{
+    BusScope bus(this, ST7789_BUS_IMAGE);
+    if (!image) return;
+    int16_t w = image->width, h = image->height;
+    if (w <= 0 || h <= 0) return;
+    if (record(ST7789_CMD_IMAGE, x, y, w, h, 0, image, 0, palette, flags)) return;
+    if (!palette) palette = image->palette;
+    bool flip = flags & ST7789_FLIP_H;
+
+    int16_t x0 = MAX(x, _clip_x0), x1 = MIN(x + w, _clip_x1);
+    int16_t y0 = MAX(y, _clip_y0), y1 = MIN(y + h, _clip_y1);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    // Columns of the image that land inside the clip
+    int16_t from = flip ? x + w - x1 : x0 - x;
+    int16_t to = flip ? x + w - x0 : x1 - x;
+    int16_t cw = x1 - x0;
+    const void *src = image->data;
+
+    for (int16_t yy = y; yy < y0; yy++)
+        src = decode_row(*image, palette, src, nullptr, 0, 0);
+
+    if (_fb) {
+        for (int16_t yy = y0; yy < y1; yy++) {
+            uint16_t *dst = _fb + (yy - _fb_y0) * _fb_stride + (x0 - _fb_x0);
+            src = decode_row(*image, palette, src, dst, from, to);
+            if (flip) reverse_pixels(dst, cw);
+        }
+        if (!_replaying)
+            mark_dirty(x0, y0, x1, y1);
+        return;
+    }
+
+    int band = (_width * _dma_lines) / cw;
+    for (int16_t yy = y0; yy < y1; yy += band) {
+        int lines = MIN(band, y1 - yy);
+        uint16_t *buf = dma_alloc(cw * lines);
+        for (int row = 0; row < lines; row++) {
+            src = decode_row(*image, palette, src, buf + row * cw, from, to);
+            if (flip) reverse_pixels(buf + row * cw, cw);
+        }
+
+        set_window(x0, yy, x1 - 1, yy + lines - 1);
+        write_pixels(buf, cw * lines);
+    }
+}
+
+// Sends whole rows straight from `src` without staging them in the DMA
+// ring. Only possible when the sprite lives in DMA-capable RAM (see
+// loadSprite()) and every chunk starts 32-bit aligned.
+bool ST7789::sprite_zero_copy(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *src)
+{
+    if (!esp_ptr_dma_capable(src) || ((uintptr_t)src & 3)) return false;
+
+    // Chunks are limited to what the bus was configured for
+    int band = (_width * _dma_lines) / w;
+    if (w & 1) band &= ~1;
+    if (band <= 0) return false;
+
+    while (h > 0) {
+        int lines = (h > band) ? band : h;
+        set_window(x, y, x + w - 1, y + lines - 1);
+        spi_write(src, w * lines * 2, true);
+        src += w * lines;
+        y += lines;
+        h -= lines;
+    }
+    return true;
+}
+
+// Copies a bitmap into DMA-capable RAM in panel byte order, so that
+// drawSpriteBE() can send it without any CPU copy. `bigEndian` tells
+// whether the source is already in panel order. Returns nullptr when
+// there is not enough DMA memory; free it with unloadSprite().
+uint16_t *ST7789::loadSprite(const uint16_t *bitmap, int16_t w, int16_t h, bool bigEndian)
+{
+    if (!bitmap || w <= 0 || h <= 0) return nullptr;
+
+    int pixels = w * h;
+    uint16_t *sprite = (uint16_t *)heap_caps_malloc(pixels * sizeof(uint16_t), MALLOC_CAP_DMA);
+    if (!sprite) {
+        ESP_LOGW(TAG, "No DMA memory for a %dx%d sprite", w, h);
+        return nullptr;
+    }
+
+    if (bigEndian) {
+        memcpy(sprite, bitmap, pixels * sizeof(uint16_t));
+    }
+    else {
+        for (int i = 0; i < pixels; i++)
+            sprite[i] = (bitmap[i] >> 8) | (bitmap[i] << 8);
+    }
+    return sprite;
+}
+
+// Waits for queued transfers that may still read the sprite, then frees it
+void ST7789::unloadSprite(uint16_t *sprite)
+{
+    if (!sprite) return;
+    waitIdle();
+    heap_caps_free(sprite);
+}
+
+// Same as drawSprite() for bitmaps already in panel byte order (see
+// image2cpp.py --big-endian). Rows are copied as they are.
+void ST7789::drawSpriteBE(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags)
+{
+    BusScope bus(this, ST7789_BUS_SPRITE);
+    if (!bitmap || w <= 0 || h <= 0) return;
+    if (record(ST7789_CMD_SPRITE_BE, x, y, w, h, 0, bitmap, 0, nullptr, flags)) return;
+    sprite(x, y, w, h, bitmap, true, flags & ST7789_FLIP_H);
+}
+
+void ST7789::sprite(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, bool swapped, bool flip)
+{
 
     int16_t original_w = w; // Store the true width of the bitmap data
     int16_t x0 = 0;
     int16_t y0 = 0;
 
     // ---- Clip X ----
-    if (x < 0) { x0 = -x; w += x; x = 0; }
-    if (x >= _width) return;
-    if (x + w > _width) w = _width - x;
+    if (x < _clip_x0) { x0 = _clip_x0 - x; w -= x0; x = _clip_x0; }
+    if (x >= _clip_x1) return;
+    if (x + w > _clip_x1) w = _clip_x1 - x;
 
     // ---- Clip Y ----
-    if (y < 0) { y0 = -y; h += y; y = 0; }
-    if (y >= _height) return;
-    if (y + h > _height) h = _height - y;
+    if (y < _clip_y0) { y0 = _clip_y0 - y; h -= y0; y = _clip_y0; }
+    if (y >= _clip_y1) return;
+    if (y + h > _clip_y1) h = _clip_y1 - y;
 
     if (w <= 0 || h <= 0) return;
 
@@ -557,28 +1239,52 @@ void ST7789::drawSprite(int16_t x, int16_t y, int16_t w, int16_t h, const uint16
     int current_y = y;
 
     // Important: The source starts at the clipped offset
-    // but moves based on the original width (stride)
-    const uint16_t *src_line = bitmap + (y0 * original_w) + x0;
+    // but moves based on the original width (stride).
+    // Mirrored, the visible columns are counted from the right edge.
+    const uint16_t *src_line = bitmap + (y0 * original_w) + (flip ? original_w - x0 - w : x0);
+
+    if (_fb) {
+        fb_blit(x, y, w, h, src_line, original_w, false, swapped, flip);
+        return;
+    }
+
+    // Whole rows of a sprite in DMA-capable RAM go out as they are
+    if (swapped && !flip && w == original_w && sprite_zero_copy(x, y, w, h, src_line))
+        return;
 
     while (remaining_h > 0) {
         int lines_to_draw = (remaining_h > _dma_lines) ? _dma_lines : remaining_h;
         
         // We fill the DMA buffer row by row to handle the stride jump
-        for (int row = 0; row < lines_to_draw; row++) {
-            for (int col = 0; col < w; col++) {
-                uint16_t c = src_line[row * original_w + col];
-                _dma_buf[row * w + col] = (c >> 8) | (c << 8);
+        uint16_t *buf = dma_alloc(w * lines_to_draw);
+        if (flip) {
+            for (int row = 0; row < lines_to_draw; row++) {
+                const uint16_t *src = src_line + row * original_w + w - 1;
+                uint16_t *dst = buf + row * w;
+                for (int col = 0; col < w; col++) {
+                    uint16_t c = src[-col];
+                    dst[col] = swapped ? c : (uint16_t)((c >> 8) | (c << 8));
+                }
+            }
+        }
+        else if (swapped && w == original_w) {
+            memcpy(buf, src_line, w * lines_to_draw * sizeof(uint16_t));
+        }
+        else if (swapped) {
+            for (int row = 0; row < lines_to_draw; row++)
+                memcpy(buf + row * w, src_line + row * original_w, w * sizeof(uint16_t));
+        }
+        else {
+            for (int row = 0; row < lines_to_draw; row++) {
+                for (int col = 0; col < w; col++) {
+                    uint16_t c = src_line[row * original_w + col];
+                    buf[row * w + col] = (c >> 8) | (c << 8);
+                }
             }
         }
 
         set_window(x, current_y, x + w - 1, current_y + lines_to_draw - 1);
-
-        spi_transaction_t t = {};
-        t.tx_buffer = _dma_buf;
-        t.length = w * lines_to_draw * 16;
-
-        dc_data();
-        ESP_ERROR_CHECK(spi_device_polling_transmit(_spi, &t));
+        write_pixels(buf, w * lines_to_draw);
 
         // Advance the source line pointer by the number of lines processed * original width
         src_line += (lines_to_draw * original_w);
@@ -650,86 +1356,119 @@ void ST7789::drawSprite(int16_t x, int16_t y, int16_t w, int16_t h, const uint16
 
 void ST7789::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
+    BusScope bus(this, ST7789_BUS_FILL);
     if (w <= 0 || h <= 0) return;
+    if (record(ST7789_CMD_FILL, x, y, w, h, color)) return;
 
     // ---- Clip X ----
-    if (x < 0) {
-        w += x;
-        x = 0;
+    if (x < _clip_x0) {
+        w -= _clip_x0 - x;
+        x = _clip_x0;
     }
-    if (x >= _width) return;
-    if (x + w > _width) {
-        w = _width - x;
+    if (x >= _clip_x1) return;
+    if (x + w > _clip_x1) {
+        w = _clip_x1 - x;
     }
 
     // ---- Clip Y ----
-    if (y < 0) {
-        h += y;
-        y = 0;
+    if (y < _clip_y0) {
+        h -= _clip_y0 - y;
+        y = _clip_y0;
     }
-    if (y >= _height) return;
-    if (y + h > _height) {
-        h = _height - y;
+    if (y >= _clip_y1) return;
+    if (y + h > _clip_y1) {
+        h = _clip_y1 - y;
     }
 
     if (w <= 0 || h <= 0) return;
 
     uint16_t c = (color >> 8) | (color << 8);
 
+    if (_fb) {
+        fb_fill(x, y, w, h, c);
+        return;
+    }
+
+    // Fill once: every band reuses the same solid-color pixels
+    int band = (h > _dma_lines) ? _dma_lines : h;
+    uint16_t *buf = dma_alloc(w * band);
+    for (int i = 0; i < w * band; i++) {
+        buf[i] = c;
+    }
+
     int remaining = h;
     int yy = y;
 
     while (remaining > 0) {
         int lines = (remaining > _dma_lines) ? _dma_lines : remaining;
 
-        // Fill FULL DMA buffer: width × lines
-        int pixels = w * lines;
-        for (int i = 0; i < pixels; i++) {
-            _dma_buf[i] = c;
-        }
-
         set_window(x, yy, x + w - 1, yy + lines - 1);
-
-        spi_transaction_t t = {};
-        t.tx_buffer = _dma_buf;
-        t.length = pixels * 16;
-
-        dc_data();
-        ESP_ERROR_CHECK(spi_device_polling_transmit(_spi, &t));
+        write_pixels(buf, w * lines);
 
         yy += lines;
         remaining -= lines;
     }
 }
 
-void ST7789::drawRgbBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap)
+void ST7789::drawRgbBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags)
 {
+    BusScope bus(this, ST7789_BUS_BITMAP);
     if (!bitmap || w <= 0 || h <= 0) return;
+    if (record(ST7789_CMD_BITMAP, x, y, w, h, 0, bitmap, 0, nullptr, flags)) return;
+    rgb_bitmap(x, y, w, h, bitmap, false, flags & ST7789_FLIP_H);
+}
+
+// drawRgbBitmap() for bitmaps in panel byte order, ST7789_TRANSPARENT_BE
+// pixels are skipped
+void ST7789::drawRgbBitmapBE(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags)
+{
+    BusScope bus(this, ST7789_BUS_BITMAP);
+    if (!bitmap || w <= 0 || h <= 0) return;
+    if (record(ST7789_CMD_BITMAP_BE, x, y, w, h, 0, bitmap, 0, nullptr, flags)) return;
+    rgb_bitmap(x, y, w, h, bitmap, true, flags & ST7789_FLIP_H);
+}
+
+void ST7789::rgb_bitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, bool swapped, bool flip)
+{
+    uint16_t key = swapped ? ST7789_TRANSPARENT_BE : ST7789_TRANSPARENT;
+
+    if (_fb) {
+        // Clip to the clip rect, transparent pixels are skipped by fb_blit()
+        int16_t x0 = x < _clip_x0 ? _clip_x0 - x : 0;
+        int16_t y0 = y < _clip_y0 ? _clip_y0 - y : 0;
+        int16_t cw = MIN(w, _clip_x1 - x) - x0;
+        int16_t ch = MIN(h, _clip_y1 - y) - y0;
+        if (cw > 0 && ch > 0)
+            fb_blit(x + x0, y + y0, cw, ch, bitmap + y0 * w + (flip ? w - x0 - cw : x0), w, true, swapped, flip);
+        return;
+    }
+
+    // Visible columns
+    int16_t col0 = MAX(0, _clip_x0 - x);
+    int16_t col1 = MIN(w, _clip_x1 - x);
+    if (col0 >= col1) return;
 
     for (int16_t row = 0; row < h; row++) {
         int16_t yy = y + row;
-        if (yy < 0 || yy >= _height) continue;
+        if (yy < _clip_y0 || yy >= _clip_y1) continue;
 
+        // Runs of this row share one slice of the DMA buffer. The visible
+        // span is enough: a run is only padded to 32 bits when a
+        // transparent pixel, which takes no room, follows it.
+        uint16_t *buf = dma_alloc(col1 - col0);
+        int used = 0;
         int count = 0;
         int start = -1;
 
-        for (int16_t col = 0; col < w; col++) {
-            int16_t xx = x + col;
-            if (xx < 0 || xx >= _width) continue;
-
-            uint16_t c = bitmap[row * w + col];
-            if (c == 0x0001) {
+        for (int16_t col = col0; col < col1; col++) {
+            uint16_t c = bitmap[row * w + (flip ? w - 1 - col : col)];
+            if (c == key) {
                 if (count > 0) {
                     // Flush previous run
                     set_window(x + start, yy, x + start + count - 1, yy);
+                    write_pixels(buf + used, count);
 
-                    spi_transaction_t t = {};
-                    t.tx_buffer = _dma_buf;
-                    t.length = count * 16;
-
-                    dc_data();
-                    ESP_ERROR_CHECK(spi_device_polling_transmit(_spi, &t));
-
+                    used += (count + 1) & ~1; // Next run starts 32-bit aligned
                     count = 0;
                 }
                 continue;
@@ -739,39 +1478,41 @@ void ST7789::drawRgbBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uin
                 start = col;
             }
 
-            _dma_buf[count++] = (c >> 8) | (c << 8);
+            buf[used + count++] = swapped ? c : (uint16_t)((c >> 8) | (c << 8));
         }
 
         // Flush tail run
         if (count > 0) {
             set_window(x + start, yy, x + start + count - 1, yy);
-
-            spi_transaction_t t = {};
-            t.tx_buffer = _dma_buf;
-            t.length = count * 16;
-
-            dc_data();
-            ESP_ERROR_CHECK(spi_device_polling_transmit(_spi, &t));
+            write_pixels(buf + used, count);
         }
     }
 }
 
 void ST7789::drawVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
 {
-    if (x < 0 || x >= _width || h <= 0) return;
+    BusScope bus(this, ST7789_BUS_LINE);
+    if (record(ST7789_CMD_FILL, x, y, 1, h, color)) return;
+
+    if (x < _clip_x0 || x >= _clip_x1 || h <= 0) return;
 
     // Clip Y
-    if (y < 0) {
-        h += y;
-        y = 0;
+    if (y < _clip_y0) {
+        h -= _clip_y0 - y;
+        y = _clip_y0;
     }
-    if (y + h > _height) {
-        h = _height - y;
+    if (y + h > _clip_y1) {
+        h = _clip_y1 - y;
     }
     if (h <= 0) return;
 
     uint16_t c = (color >> 8) | (color << 8);
 
+    if (_fb) {
+        fb_fill(x, y, 1, h, c);
+        return;
+    }
+
     int remaining = h;
     int yy = y;
 
@@ -780,16 +1521,12 @@ void ST7789::drawVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
 
         set_window(x, yy, x, yy + lines - 1);
 
+        uint16_t *buf = dma_alloc(lines);
         for (int i = 0; i < lines; i++) {
-            _dma_buf[i] = c;
+            buf[i] = c;
         }
 
-        spi_transaction_t t = {};
-        t.tx_buffer = _dma_buf;
-        t.length = lines * 16;
-
-        dc_data();
-        ESP_ERROR_CHECK(spi_device_polling_transmit(_spi, &t));
+        write_pixels(buf, lines);
 
         yy += lines;
         remaining -= lines;
@@ -798,33 +1535,568 @@ void ST7789::drawVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
 
 void ST7789::drawHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
 {
-    if (y < 0 || y >= _height || w <= 0) return;
+    BusScope bus(this, ST7789_BUS_LINE);
+    if (record(ST7789_CMD_FILL, x, y, w, 1, color)) return;
+
+    if (y < _clip_y0 || y >= _clip_y1 || w <= 0) return;
 
     // Clip X
-    if (x < 0) {
-        w += x;
-        x = 0;
+    if (x < _clip_x0) {
+        w -= _clip_x0 - x;
+        x = _clip_x0;
     }
-    if (x + w > _width) {
-        w = _width - x;
+    if (x + w > _clip_x1) {
+        w = _clip_x1 - x;
     }
     if (w <= 0) return;
 
-    set_window(x, y, x + w - 1, y);
-
     uint16_t c = (color >> 8) | (color << 8);
 
+    if (_fb) {
+        fb_fill(x, y, w, 1, c);
+        return;
+    }
+
+    set_window(x, y, x + w - 1, y);
+
     // Fill DMA buffer
+    uint16_t *buf = dma_alloc(w);
     for (int i = 0; i < w; i++) {
-        _dma_buf[i] = c;
+        buf[i] = c;
     }
 
-    spi_transaction_t t = {};
-    t.tx_buffer = _dma_buf;
-    t.length = w * 16;
+    write_pixels(buf, w);
+}
 
-    dc_data();
-    ESP_ERROR_CHECK(spi_device_polling_transmit(_spi, &t));
+// Bresenham, sent as horizontal or vertical runs so a shallow line costs
+// one window per step in y instead of one per pixel
+void ST7789::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+    BusScope bus(this, ST7789_BUS_LINE);
+    if (y0 == y1) {
+        drawHLine(MIN(x0, x1), y0, ABS(x1 - x0) + 1, color);
+        return;
+    }
+    if (x0 == x1) {
+        drawVLine(x0, MIN(y0, y1), ABS(y1 - y0) + 1, color);
+        return;
+    }
+    if (record(ST7789_CMD_LINE, x0, y0, x1, y1, color)) return;
+
+    bool steep = ABS(y1 - y0) > ABS(x1 - x0);
+    if (steep) {
+        int16_t t;
+        t = x0; x0 = y0; y0 = t;
+        t = x1; x1 = y1; y1 = t;
+    }
+    if (x0 > x1) {
+        int16_t t;
+        t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+    }
+
+    int16_t dx = x1 - x0;
+    int16_t dy = ABS(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = y0 < y1 ? 1 : -1;
+    int16_t runStart = x0;
+
+    for (int16_t x = x0; x <= x1; x++) {
+        err -= dy;
+        if (err < 0 || x == x1) {
+            // Run along the major axis ends here
+            if (steep)
+                drawVLine(y0, runStart, x - runStart + 1, color);
+            else
+                drawHLine(runStart, y0, x - runStart + 1, color);
+
+            y0 += ystep;
+            err += dx;
+            runStart = x + 1;
+        }
+    }
+}
+
+// ===== Framebuffer =====
+
+// Primitives render into RAM until flush(). The framebuffer goes to PSRAM
+// when the board has it and falls back to internal RAM otherwise.
+bool ST7789::enableFramebuffer()
+{
+    if (_fb_owned) return true;
+    disableBandRenderer();
+
+    size_t size = _width * _height * sizeof(uint16_t);
+    _fb = (uint16_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!_fb)
+        _fb = (uint16_t *)heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+
+    if (!_fb) {
+        ESP_LOGW(TAG, "No memory for a %dx%d framebuffer, drawing directly", _width, _height);
+        return false;
+    }
+
+    _fb_x0 = 0;
+    _fb_y0 = 0;
+    _fb_stride = _width;
+    _fb_owned = true;
+    _dirty_count = 0;
+    return true;
+}
+
+// Pending drawing that was not flushed is dropped
+void ST7789::disableFramebuffer()
+{
+    if (!_fb_owned) return;
+
+    heap_caps_free(_fb);
+    _fb = nullptr;
+    _fb_owned = false;
+}
+
+bool ST7789::hasFramebuffer()
+{
+    return _fb_owned;
+}
+
+// Framebuffer-style compositing without a framebuffer: draw calls are
+// recorded and flush() replays them into bands that fit the DMA buffers,
+// sending each band while the next one is rendered. Every dirty area must
+// be covered by opaque drawing (e.g. a backdrop) within the same frame,
+// pixels nobody drew come out as clearColor.
+bool ST7789::enableBandRenderer(int maxCommands, uint16_t clearColor)
+{
+    disableFramebuffer();
+    disableBandRenderer();
+
+    _cmds = (ST7789_Command *)heap_caps_malloc(maxCommands * sizeof(ST7789_Command), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!_cmds) {
+        ESP_LOGW(TAG, "No memory for %d band commands, drawing directly", maxCommands);
+        return false;
+    }
+
+    _cmd_capacity = maxCommands;
+    _cmd_count = 0;
+    _band_clear = (clearColor >> 8) | (clearColor << 8);
+    _dirty_count = 0;
+    return true;
+}
+
+// Pending drawing that was not flushed is dropped
+void ST7789::disableBandRenderer()
+{
+    if (!_cmds) return;
+
+    heap_caps_free(_cmds);
+    _cmds = nullptr;
+    _cmd_count = 0;
+    _cmd_capacity = 0;
+}
+
+// Records a draw call while the band renderer is on. Returns false when the
+// caller should draw right away (direct/framebuffer mode, or replaying).
+bool ST7789::record(ST7789_CommandType type, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, const void *data, char c, const uint16_t *palette, uint8_t flags)
+{
+    if (!_cmds || _replaying) return false;
+
+    ST7789_Rect bounds = { x, y, (int16_t)(x + w), (int16_t)(y + h) };
+    if (type == ST7789_CMD_LINE) {
+        // w/h carry the end point
+        bounds = { MIN(x, w), MIN(y, h), (int16_t)(MAX(x, w) + 1), (int16_t)(MAX(y, h) + 1) };
+    }
+    else if (type == ST7789_CMD_CHAR && (flags & ST7789_TEXT_OPAQUE)) {
+        const GFXfont *font = (const GFXfont *)data;
+        ST7789_GlyphCell cell = _glyphs.cell(font, &font->glyph[c - font->first]);
+        bounds = { (int16_t)(x + cell.x), (int16_t)(y + cell.y),
+                   (int16_t)(x + cell.x + cell.w), (int16_t)(y + cell.y + cell.h) };
+    }
+    else if (type == ST7789_CMD_CHAR) {
+        const GFXfont *font = (const GFXfont *)data;
+        const GFXglyph *g = &font->glyph[c - font->first];
+        bounds = { (int16_t)(x + g->xOffset), (int16_t)(y + g->yOffset),
+                   (int16_t)(x + g->xOffset + g->width), (int16_t)(y + g->yOffset + g->height) };
+    }
+
+    ST7789_Rect clip = { _clip_x0, _clip_y0, _clip_x1, _clip_y1 };
+    bounds = rect_intersect(bounds, clip);
+    if (bounds.x0 >= bounds.x1 || bounds.y0 >= bounds.y1) return true;
+
+    // Out of room: render what we have. Later calls that rely on these
+    // as their background will not see them, so size the list per frame.
+    if (_cmd_count == _cmd_capacity)
+        flush_bands();
+
+    // Before the command joins the list, a full dirty list may flush too
+    mark_dirty(bounds.x0, bounds.y0, bounds.x1, bounds.y1);
+
+    ST7789_Command &cmd = _cmds[_cmd_count++];
+    cmd.type = type;
+    cmd.layer = 0;
+    cmd.flags = flags;
+    cmd.text = nullptr;
+    cmd.palette = palette;
+    cmd.c = c;
+    cmd.color = color;
+    cmd.bg = _textBg;
+    cmd.x = x;
+    cmd.y = y;
+    cmd.w = w;
+    cmd.h = h;
+    cmd.bounds = bounds;
+    cmd.clip = clip;
+    cmd.data = data;
+    return true;
+}
+
+// Executes one recorded call into the current band, clipped to both
+void ST7789::replay(const ST7789_Command &cmd, const ST7789_Rect &band)
+{
+    ST7789_Rect clip = rect_intersect(cmd.clip, band);
+    _clip_x0 = clip.x0;
+    _clip_y0 = clip.y0;
+    _clip_x1 = clip.x1;
+    _clip_y1 = clip.y1;
+
+    execute(cmd);
+}
+
+// Runs a recorded call with whatever clip rect is set
+void ST7789::execute(const ST7789_Command &cmd)
+{
+    switch (cmd.type) {
+        case ST7789_CMD_FILL:
+            fillRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.color);
+            break;
+
+        case ST7789_CMD_SPRITE:
+            drawSprite(cmd.x, cmd.y, cmd.w, cmd.h, (const uint16_t *)cmd.data, cmd.flags);
+            break;
+
+        case ST7789_CMD_BITMAP:
+            drawRgbBitmap(cmd.x, cmd.y, cmd.w, cmd.h, (const uint16_t *)cmd.data, cmd.flags);
+            break;
+
+        case ST7789_CMD_SPRITE_BE:
+            drawSpriteBE(cmd.x, cmd.y, cmd.w, cmd.h, (const uint16_t *)cmd.data, cmd.flags);
+            break;
+
+        case ST7789_CMD_BITMAP_BE:
+            drawRgbBitmapBE(cmd.x, cmd.y, cmd.w, cmd.h, (const uint16_t *)cmd.data, cmd.flags);
+            break;
+
+        case ST7789_CMD_RLE:
+            drawRle(cmd.x, cmd.y, cmd.w, cmd.h, (const uint16_t *)cmd.data, cmd.flags);
+            break;
+
+        case ST7789_CMD_IMAGE:
+            drawImage(cmd.x, cmd.y, (const ST7789_Image *)cmd.data, cmd.palette, cmd.flags);
+            break;
+
+        case ST7789_CMD_CHAR: {
+            const GFXfont *font = _font;
+            uint16_t bg = _textBg;
+            bool opaque = _textOpaque;
+            _font = (const GFXfont *)cmd.data;
+            _textBg = cmd.bg;
+            _textOpaque = cmd.flags & ST7789_TEXT_OPAQUE;
+            drawChar(cmd.x, cmd.y, cmd.c, cmd.color);
+            _font = font;
+            _textBg = bg;
+            _textOpaque = opaque;
+            break;
+        }
+
+        case ST7789_CMD_TEXT: {
+            const GFXfont *font = _font;
+            uint16_t color = _textColor;
+            uint16_t bg = _textBg;
+            bool opaque = _textOpaque;
+            _font = (const GFXfont *)cmd.data;
+            _textColor = cmd.color;
+            _textBg = cmd.bg;
+            _textOpaque = cmd.flags & ST7789_TEXT_OPAQUE;
+            drawText(cmd.x, cmd.y, cmd.text);
+            _font = font;
+            _textColor = color;
+            _textBg = bg;
+            _textOpaque = opaque;
+            break;
+        }
+
+        case ST7789_CMD_TEXT_BOX: {
+            const GFXfont *font = _font;
+            uint16_t color = _textColor;
+            uint16_t bg = _textBg;
+            _font = (const GFXfont *)cmd.data;
+            _textColor = cmd.color;
+            _textBg = cmd.bg;
+            drawTextBox(cmd.bounds.x0, cmd.bounds.y0, cmd.bounds.x1 - cmd.bounds.x0, cmd.bounds.y1 - cmd.bounds.y0, cmd.x, cmd.y, cmd.text);
+            _font = font;
+            _textColor = color;
+            _textBg = bg;
+            break;
+        }
+
+        case ST7789_CMD_LINE:
+            drawLine(cmd.x, cmd.y, cmd.w, cmd.h, cmd.color);
+            break;
+    }
+}
+
+// ===== Display Lists =====
+
+// Sorts and culls the list, then runs it in one pass. Each command keeps the
+// clip it was recorded with, narrowed by the clip rect set on the driver.
+// With the framebuffer or band renderer on, flush() still has to follow.
+void ST7789::drawList(DisplayList &list)
+{
+    int16_t clip_x0 = _clip_x0, clip_y0 = _clip_y0;
+    int16_t clip_x1 = _clip_x1, clip_y1 = _clip_y1;
+    ST7789_Rect screenClip = { clip_x0, clip_y0, clip_x1, clip_y1 };
+
+    list.prepare();
+
+    for (int i = 0; i < list.count(); i++) {
+        const ST7789_Command &cmd = list[i];
+        ST7789_Rect clip = rect_intersect(cmd.clip, screenClip);
+        if (clip.x0 >= clip.x1 || clip.y0 >= clip.y1) continue;
+
+        _clip_x0 = clip.x0;
+        _clip_y0 = clip.y0;
+        _clip_x1 = clip.x1;
+        _clip_y1 = clip.y1;
+        execute(cmd);
+    }
+
+    _clip_x0 = clip_x0;
+    _clip_y0 = clip_y0;
+    _clip_x1 = clip_x1;
+    _clip_y1 = clip_y1;
+}
+
+void ST7789::flush_bands()
+{
+    int16_t clip_x0 = _clip_x0, clip_y0 = _clip_y0;
+    int16_t clip_x1 = _clip_x1, clip_y1 = _clip_y1;
+    _replaying = true;
+
+    for (int i = 0; i < _dirty_count; i++) {
+        const ST7789_Rect &r = _dirty[i];
+        int w = r.x1 - r.x0;
+        int band = (_width * _dma_lines) / w;
+
+        set_window(r.x0, r.y0, r.x1 - 1, r.y1 - 1);
+
+        for (int16_t y = r.y0; y < r.y1; y += band) {
+            int lines = MIN(band, r.y1 - y);
+            uint16_t *buf = dma_alloc(w * lines);
+
+            // Point the framebuffer paths at this band
+            _fb = buf;
+            _fb_x0 = r.x0;
+            _fb_y0 = y;
+            _fb_stride = w;
+
+            for (int p = 0; p < w * lines; p++)
+                buf[p] = _band_clear;
+
+            ST7789_Rect bandRect = { r.x0, y, r.x1, (int16_t)(y + lines) };
+            for (int c = 0; c < _cmd_count; c++) {
+                const ST7789_Rect &b = _cmds[c].bounds;
+                if (b.x0 < bandRect.x1 && bandRect.x0 < b.x1 && b.y0 < bandRect.y1 && bandRect.y0 < b.y1)
+                    replay(_cmds[c], bandRect);
+            }
+
+            write_pixels(buf, w * lines);
+        }
+    }
+
+    _fb = nullptr;
+    _replaying = false;
+    _clip_x0 = clip_x0;
+    _clip_y0 = clip_y0;
+    _clip_x1 = clip_x1;
+    _clip_y1 = clip_y1;
+    _cmd_count = 0;
+    _dirty_count = 0;
+}
+
+// Pushes only the dirty rectangles to the panel. Each one goes out in bands
+// as tall as fit in a DMA buffer; bands are copied into the DMA ring, so
+// drawing the next frame can start while the previous bands are on the bus.
+void ST7789::flush()
+{
+    BusScope bus(this, ST7789_BUS_FLUSH);
+    if (_cmds) {
+        flush_bands();
+        return;
+    }
+
+    if (!_fb_owned) return;
+
+    for (int i = 0; i < _dirty_count; i++) {
+        const ST7789_Rect &r = _dirty[i];
+        int w = r.x1 - r.x0;
+        int band = (_width * _dma_lines) / w;
+
+        set_window(r.x0, r.y0, r.x1 - 1, r.y1 - 1);
+
+        const uint16_t *src = _fb + r.y0 * _width + r.x0;
+        int remaining = r.y1 - r.y0;
+        while (remaining > 0) {
+            int lines = (remaining > band) ? band : remaining;
+            uint16_t *buf = dma_alloc(w * lines);
+            for (int row = 0; row < lines; row++) {
+                memcpy(buf + row * w, src, w * sizeof(uint16_t));
+                src += _width;
+            }
+            write_pixels(buf, w * lines);
+            remaining -= lines;
+        }
+    }
+
+    _dirty_count = 0;
+}
+
+// Adds a rectangle (exclusive x1/y1) to the dirty list. Rectangles that
+// overlap, touch, or would waste less than ST7789_DIRTY_MERGE_SLACK pixels
+// as a union are merged; when the list is full the cheapest merge wins.
+// The band renderer has no memory of pixels nobody redrew, so there only
+// unions that add no new pixels are merged, and a full list is rendered
+// with flush_bands() to make room, same as a full command list.
+void ST7789::mark_dirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    ST7789_Rect r = { x0, y0, x1, y1 };
+
+    while (true) {
+        bool merged = false;
+
+        for (int i = 0; i < _dirty_count; i++) {
+            ST7789_Rect u = rect_union(_dirty[i], r);
+            bool touching = _dirty[i].x0 <= r.x1 && r.x0 <= _dirty[i].x1
+                         && _dirty[i].y0 <= r.y1 && r.y0 <= _dirty[i].y1;
+            bool cheap = touching || rect_area(u) <= rect_area(_dirty[i]) + rect_area(r) + ST7789_DIRTY_MERGE_SLACK;
+
+            if (_cmds ? rect_union_exact(_dirty[i], r) : cheap) {
+                // The grown rectangle may now reach others, so start over
+                r = u;
+                _dirty[i] = _dirty[--_dirty_count];
+                merged = true;
+                break;
+            }
+        }
+
+        if (merged) continue;
+        if (_dirty_count < ST7789_MAX_DIRTY_RECTS) break;
+
+        if (_cmds && !_replaying) {
+            flush_bands();
+            break;
+        }
+
+        // List full: fold r into the rectangle it grows the least
+        int best = 0;
+        int32_t bestGrowth = INT32_MAX;
+        for (int i = 0; i < _dirty_count; i++) {
+            int32_t growth = rect_area(rect_union(_dirty[i], r)) - rect_area(_dirty[i]);
+            if (growth < bestGrowth) {
+                bestGrowth = growth;
+                best = i;
+            }
+        }
+        r = rect_union(_dirty[best], r);
+        _dirty[best] = _dirty[--_dirty_count];
+    }
+
+    _dirty[_dirty_count++] = r;
+}
+
+ST7789_Rect ST7789::rect_union(const ST7789_Rect &a, const ST7789_Rect &b)
+{
+    return { MIN(a.x0, b.x0), MIN(a.y0, b.y0), MAX(a.x1, b.x1), MAX(a.y1, b.y1) };
+}
+
+ST7789_Rect ST7789::rect_intersect(const ST7789_Rect &a, const ST7789_Rect &b)
+{
+    return { MAX(a.x0, b.x0), MAX(a.y0, b.y0), MIN(a.x1, b.x1), MIN(a.y1, b.y1) };
+}
+
+int32_t ST7789::rect_area(const ST7789_Rect &r)
+{
+    return (int32_t)(r.x1 - r.x0) * (r.y1 - r.y0);
+}
+
+// True when the union of a and b contains no pixel outside of a or b
+bool ST7789::rect_union_exact(const ST7789_Rect &a, const ST7789_Rect &b)
+{
+    bool aInB = b.x0 <= a.x0 && a.x1 <= b.x1 && b.y0 <= a.y0 && a.y1 <= b.y1;
+    bool bInA = a.x0 <= b.x0 && b.x1 <= a.x1 && a.y0 <= b.y0 && b.y1 <= a.y1;
+    bool stacked = a.x0 == b.x0 && a.x1 == b.x1 && a.y0 <= b.y1 && b.y0 <= a.y1;
+    bool sideBySide = a.y0 == b.y0 && a.y1 == b.y1 && a.x0 <= b.x1 && b.x0 <= a.x1;
+    return aInB || bInA || stacked || sideBySide;
+}
+
+// ===== Clipping =====
+
+// Restricts every primitive to the given rectangle (intersected with the screen)
+void ST7789::setClipRect(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    _clip_x0 = CONSTRAIN(x, 0, _width);
+    _clip_y0 = CONSTRAIN(y, 0, _height);
+    _clip_x1 = CONSTRAIN(x + w, _clip_x0, _width);
+    _clip_y1 = CONSTRAIN(y + h, _clip_y0, _height);
+}
+
+void ST7789::clearClipRect()
+{
+    _clip_x0 = 0;
+    _clip_y0 = 0;
+    _clip_x1 = _width;
+    _clip_y1 = _height;
+}
+
+bool ST7789::has_clip()
+{
+    return _clip_x0 > 0 || _clip_y0 > 0 || _clip_x1 < _width || _clip_y1 < _height;
+}
+
+// Fills an already clipped rectangle, colorBE is in panel byte order
+void ST7789::fb_fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colorBE)
+{
+    uint16_t *dst = _fb + (y - _fb_y0) * _fb_stride + (x - _fb_x0);
+    for (int16_t row = 0; row < h; row++) {
+        for (int16_t col = 0; col < w; col++)
+            dst[col] = colorBE;
+        dst += _fb_stride;
+    }
+    if (!_replaying)
+        mark_dirty(x, y, x + w, y + h);
+}
+
+// Copies an already clipped RGB565 bitmap (stride in pixels) with endian swap,
+// or row by row with memcpy when it is `swapped` (panel order) already.
+// With `transparent`, transparent pixels are skipped like drawRgbBitmap() does.
+// With `flip`, each row of w source pixels is written right to left.
+void ST7789::fb_blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *src, int16_t stride, bool transparent, bool swapped, bool flip)
+{
+    uint16_t *dst = _fb + (y - _fb_y0) * _fb_stride + (x - _fb_x0);
+    uint16_t key = swapped ? ST7789_TRANSPARENT_BE : ST7789_TRANSPARENT;
+    for (int16_t row = 0; row < h; row++) {
+        if (swapped && !transparent && !flip) {
+            memcpy(dst, src, w * sizeof(uint16_t));
+        }
+        else {
+            for (int16_t col = 0; col < w; col++) {
+                uint16_t c = src[flip ? w - 1 - col : col];
+                if (transparent && c == key) continue;
+                dst[col] = swapped ? c : (uint16_t)((c >> 8) | (c << 8));
+            }
+        }
+        src += stride;
+        dst += _fb_stride;
+    }
+    if (!_replaying)
+        mark_dirty(x, y, x + w, y + h);
 }
 
 // ===== Backlight =====
@@ -891,6 +2163,7 @@ void ST7789::setRotation(uint8_t rotation)
 
     write_cmd(ST7789_MADCTL);
     write_data(&_madctl, 1);
+    invalidate_window();
 }
 
 void ST7789::setInversion(bool enable) {
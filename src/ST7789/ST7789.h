@@ -3,10 +3,15 @@
 #include "driver/spi_master.h"
 #include "driver/gpio.h"
 #include "driver/ledc.h"
+#include "freertos/FreeRTOS.h"
 #include "gfxfont.h"
+#include "image.h"
 #include "commands.h"
 #include "macros.h"
 #include "colors.h"
+#include "DisplayList.h"
+#include "GlyphCache.h"
+#include "bus_stats.h"
 #include <stdint.h>
 
 class ST7789 {
@@ -24,29 +29,119 @@ private:
     int _spi_host;
     int _spi_freq;
 
+    // SPI queue (async mode when _queue_size > 1)
+    int _queue_size;
+    spi_transaction_t *_trans;
+    uint32_t _trans_queued;     // Transactions handed to the SPI driver
+    uint32_t _trans_done;       // Transactions whose result was collected
+    int64_t _bus_wait = 0;      // us blocked on the bus since takeBusWait()
+
+    // Bus accounting per primitive until takeBusStats(). Whichever task
+    // draws adds to it while the game loop takes it, hence the lock.
+    ST7789_BusCounters _bus[ST7789_BUS_PRIMITIVES] = {};
+    ST7789_BusPrimitive _bus_primitive = ST7789_BUS_OTHER;
+    bool _bus_pixels = false;   // Data bytes are pixels (RAMWR was the last command)
+    portMUX_TYPE _bus_lock = portMUX_INITIALIZER_UNLOCKED;
+
+    // Charges the bus traffic of a scope to `primitive` unless an
+    // enclosing scope already did
+    struct BusScope {
+        ST7789 *tft;
+        ST7789_BusPrimitive outer;
+        BusScope(ST7789 *t, ST7789_BusPrimitive primitive) : tft(t), outer(t->_bus_primitive) {
+            if (outer == ST7789_BUS_OTHER) tft->_bus_primitive = primitive;
+        }
+        ~BusScope() { tft->_bus_primitive = outer; }
+    };
+
     // DMA
     int _dma_lines;
+    int _dma_count;
 
-    // DMA buffer
-    uint16_t *_dma_buf;
+    // DMA buffers (ring of _dma_count, filled while the previous one is sent)
+    uint16_t **_dma_bufs;
+    uint32_t *_dma_seqs;        // Last transaction reading from each buffer
+    int _dma_index;             // Buffer currently handed out by dma_alloc()
+    uint16_t *_dma_buf;         // == _dma_bufs[_dma_index]
+    int _dma_used;              // Pixels handed out from the current buffer
 
     // Low-level helpers
-    inline void dc_cmd();
-    inline void dc_data();
+    static void spi_pre_transfer_cb(spi_transaction_t *t);
 
-    void spi_write(const uint8_t *data, int len);
+    uint32_t spi_write(const void *data, int len, bool dc);
+    void spi_wait(uint32_t seq);
+    void bus_waited(int64_t us);
     void write_cmd(uint8_t cmd);
     void write_data(const uint8_t *data, int len);
+    void write_pixels(const uint16_t *pixels, int count);
 
-    void alloc_dma_buffer();
+    void alloc_dma_buffers();
+    uint16_t *dma_alloc(int pixels);
     void set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+    void invalidate_window();
 
     void st7789_reset();
     void st7789_init();
 
+    // Last window sent to the panel (0xFFFF = unknown)
+    uint16_t _win_x0 = 0xFFFF, _win_y0 = 0xFFFF;
+    uint16_t _win_x1 = 0xFFFF, _win_y1 = 0xFFFF;
+
+    // Render target (panel byte order), nullptr when drawing directly.
+    // Either the framebuffer or, while the band renderer replays, a band.
+    uint16_t *_fb = nullptr;
+    int16_t _fb_x0 = 0, _fb_y0 = 0;     // Screen position of _fb[0]
+    int16_t _fb_stride = 0;             // Pixels per row of _fb
+    bool _fb_owned = false;             // _fb is the full-screen framebuffer
+
+    // Band renderer: draw calls recorded until flush(), then replayed
+    // into DMA-buffer-sized bands of every dirty rectangle
+    ST7789_Command *_cmds = nullptr;
+    int _cmd_count = 0;
+    int _cmd_capacity = 0;
+    bool _replaying = false;
+    uint16_t _band_clear = 0;           // Panel order, for uncovered pixels
+
+    bool record(ST7789_CommandType type, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, const void *data = nullptr, char c = 0, const uint16_t *palette = nullptr, uint8_t flags = 0);
+    void replay(const ST7789_Command &cmd, const ST7789_Rect &band);
+    void execute(const ST7789_Command &cmd);
+    void flush_bands();
+
+    // Regions of the framebuffer that changed since the last flush()
+    ST7789_Rect _dirty[ST7789_MAX_DIRTY_RECTS];
+    int _dirty_count = 0;
+
+    void mark_dirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+    static ST7789_Rect rect_union(const ST7789_Rect &a, const ST7789_Rect &b);
+    static ST7789_Rect rect_intersect(const ST7789_Rect &a, const ST7789_Rect &b);
+    static int32_t rect_area(const ST7789_Rect &r);
+    static bool rect_union_exact(const ST7789_Rect &a, const ST7789_Rect &b);
+
+    // Clip rect (exclusive x1/y1), the whole screen by default
+    int16_t _clip_x0, _clip_y0;
+    int16_t _clip_x1, _clip_y1;
+
+    bool has_clip();
+
+    void fb_fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colorBE);
+    void fb_blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *src, int16_t stride, bool transparent, bool swapped = false, bool flip = false);
+
+    void sprite(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, bool swapped, bool flip);
+    bool sprite_zero_copy(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *src);
+    void rgb_bitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, bool swapped, bool flip);
+
     // Font
     const GFXfont *_font = nullptr;
     uint16_t _textColor = 0xFFFF;
+    uint16_t _textBg = 0x0000;
+    bool _textOpaque = false;           // Glyphs fill their cell with _textBg
+
+    // Tiles of opaque glyphs, allocated on first use
+    GlyphCache _glyphs;
+    bool _glyphs_failed = false;
+
+    void glyph_runs(int16_t x, int16_t y, const GFXglyph *glyph, uint16_t color);
+    void opaque_char(int16_t x, int16_t y, char c, uint16_t color, uint16_t bg);
     uint16_t _cursorX = 0, _cursorY = 0;
 
     // Screen Options
@@ -70,11 +165,17 @@ public:
         int height,
         int spi_host = SPI2_HOST,
         int spi_freq = 40,
-        int dma_lines = 20
+        int dma_lines = 20,
+        int dma_buffers = 2,
+        int queue_size = 16
     );
 
     // ---- Initialization ---- //
     void begin();
+    void waitIdle();
+    uint32_t takeBusWait();
+    void takeBusStats(ST7789_BusStats &out);
+    void resetBusStats();
 
     // ---- Screen Preferences ---- //
     void setRotation(uint8_t rotation);
@@ -85,10 +186,14 @@ public:
     // ---- Font & Printing ---- //
     void setFont(const GFXfont *font);
     void setTextColor(uint16_t color);
+    void setTextColor(uint16_t color, uint16_t bg);
+    void clearGlyphCache();
     void measureText(const char* text, int16_t& w, int16_t& h);
+    static void measureText(const GFXfont *font, const char* text, int16_t& w, int16_t& h);
     void drawChar(int16_t x, int16_t y, char c, uint16_t color);
     void drawChar(int16_t x, int16_t y, char c);
     void drawText(int16_t x, int16_t y, const char *text);
+    void drawTextBox(int16_t x, int16_t y, int16_t w, int16_t h, int16_t textX, int16_t textY, const char *text);
     void drawFastRun(int16_t x, int16_t y, int16_t len, uint16_t colorLE);
     void print(const char* text);
     void print(uint32_t value);
@@ -109,13 +214,35 @@ public:
     void drawPixel(int16_t x, int16_t y, uint16_t color);
 
     // ---- Bitmaps ---- //
-    void drawSprite(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap);
-    void drawRgbBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap);
+    void drawSprite(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags = 0);
+    void drawRgbBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags = 0);
+    void drawSpriteBE(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags = 0);
+    void drawRgbBitmapBE(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap, uint8_t flags = 0);
+    void drawRle(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *data, uint8_t flags = 0);
+    void drawImage(int16_t x, int16_t y, const ST7789_Image *image, const uint16_t *palette = nullptr, uint8_t flags = 0);
+    uint16_t *loadSprite(const uint16_t *bitmap, int16_t w, int16_t h, bool bigEndian = false);
+    void unloadSprite(uint16_t *sprite);
 
     // ---- Shapes & Lines ---- //
     void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void drawVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
     void drawHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+    // ---- Display Lists ---- //
+    void drawList(DisplayList &list);
+
+    // ---- Framebuffer ---- //
+    bool enableFramebuffer();
+    void disableFramebuffer();
+    bool hasFramebuffer();
+    bool enableBandRenderer(int maxCommands = ST7789_BAND_MAX_COMMANDS, uint16_t clearColor = 0x0000);
+    void disableBandRenderer();
+    void flush();
+
+    // ---- Clipping ---- //
+    void setClipRect(int16_t x, int16_t y, int16_t w, int16_t h);
+    void clearClipRect();
 
     // ---- Backlight ---- //
     void setBrightness(uint8_t brightness);
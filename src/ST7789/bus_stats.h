@@ -0,0 +1,33 @@
+#pragma once
+#include <stdint.h>
+
+// Primitive that SPI traffic is charged to, see ST7789::takeBusStats().
+// Nested calls count for the outermost one (drawText() is TEXT even though
+// it sends runs), and with the framebuffer or band renderer everything
+// reaches the bus through FLUSH.
+enum ST7789_BusPrimitive : uint8_t {
+    ST7789_BUS_OTHER,       // Setup, rotation, colour order, waitIdle()...
+    ST7789_BUS_FILL,        // fillScreen(), fillRect()
+    ST7789_BUS_LINE,        // drawPixel(), drawHLine(), drawVLine(), drawLine()
+    ST7789_BUS_TEXT,        // drawChar(), drawText(), drawFastRun(), print()
+    ST7789_BUS_SPRITE,      // drawSprite(), drawSpriteBE()
+    ST7789_BUS_BITMAP,      // drawRgbBitmap(), drawRgbBitmapBE()
+    ST7789_BUS_RLE,         // drawRle()
+    ST7789_BUS_IMAGE,       // drawImage()
+    ST7789_BUS_FLUSH,       // flush() of the framebuffer or bands
+    ST7789_BUS_PRIMITIVES
+};
+
+typedef struct {
+    uint32_t transactions;      // Queued or polled SPI transactions
+    uint32_t commandBytes;      // Commands and their parameters (DC low + CASET/RASET data)
+    uint32_t pixelBytes;        // Data following RAMWR
+    uint32_t windows;           // set_window() calls, one RAMWR each
+    uint32_t windowChanges;     // Of those, the ones that had to send CASET and/or RASET
+    uint32_t waitUs;            // Blocked on the bus (ring full, DMA buffer in use, polling)
+} ST7789_BusCounters;
+
+typedef struct {
+    ST7789_BusCounters total;
+    ST7789_BusCounters primitive[ST7789_BUS_PRIMITIVES];
+} ST7789_BusStats;
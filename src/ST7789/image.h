@@ -0,0 +1,21 @@
+#pragma once
+#include <stdint.h>
+
+// Storage formats of ST7789_Image, see image2cpp.py --compress. Rows are
+// encoded independently and pixels / palette entries are in panel order.
+enum ST7789_ImageFormat : uint8_t {
+    ST7789_IMAGE_RGB565,    // uint16_t pixels
+    ST7789_IMAGE_RLE565,    // uint16_t tokens: 0x8000 | (n - 1) + n pixels, or (n - 1) + 1 pixel repeated
+    ST7789_IMAGE_PAL8_RLE,  // uint8_t tokens: 0x80 | (n - 1) + n indices, or (n - 1) + 1 index repeated
+    ST7789_IMAGE_PAL8,      // uint8_t index per pixel
+    ST7789_IMAGE_PAL4       // Two indices per byte, high nibble first, rows padded to a byte
+};
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    ST7789_ImageFormat format;
+    uint16_t colors;            // Palette entries, 0 without a palette
+    const uint16_t *palette;    // Can be swapped at draw time, see drawImage()
+    const void *data;
+} ST7789_Image;
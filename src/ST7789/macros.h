@@ -8,4 +8,30 @@
 #define ST7789_ALIGN_MIDDLE  32
 #define ST7789_ALIGN_BOTTOM  64
 
-#define ST7789_MIN_PADDING 5
\ No newline at end of file
+#define ST7789_MIN_PADDING 5
+
+// Transparent pixel of drawRgbBitmap(), and of drawRgbBitmapBE() in panel order
+#define ST7789_TRANSPARENT      0x0001
+#define ST7789_TRANSPARENT_BE   0x0100
+
+// Sprite / image draw flags
+#define ST7789_FLIP_H           0x01    // Mirror left to right, e.g. a walk cycle facing the other way
+
+// Text draw flags
+#define ST7789_TEXT_OPAQUE      0x02    // Glyphs fill their whole cell with the background colour
+
+// Framebuffer dirty tracking
+#define ST7789_MAX_DIRTY_RECTS      16
+#define ST7789_DIRTY_MERGE_SLACK    256 // Wasted pixels worth saving a window setup
+
+// Band renderer
+#define ST7789_BAND_MAX_COMMANDS    256
+
+// Display list
+#define ST7789_LIST_ARENA_BYTES     12288
+#define ST7789_LIST_MAX_COMMANDS    256
+
+// Glyph cache of opaque text
+#define ST7789_GLYPH_CACHE_BYTES    8192
+#define ST7789_GLYPH_CACHE_TILES    64
+#define ST7789_GLYPH_CACHE_FONTS    4
@@ -0,0 +1,49 @@
+#pragma once
+#include <stdint.h>
+#include "image.h"
+
+// How the frames of an ST7789_Sheet are stored, see image2cpp.py --sheet
+enum ST7789_SheetFormat : uint8_t {
+    ST7789_SHEET_SPRITE,    // Opaque panel order pixels, drawSpriteBE()
+    ST7789_SHEET_BITMAP,    // Panel order pixels with ST7789_TRANSPARENT_BE, drawRgbBitmapBE()
+    ST7789_SHEET_IMAGE      // One ST7789_Image per frame, drawImage()
+};
+
+// One frame of a sheet. Only the trimmed bounds (x, y, w, h) inside the
+// width x height frame are stored, the pivot is the point that lands on
+// the draw position.
+typedef struct {
+    uint16_t width, height;     // Untrimmed frame size
+    int16_t pivotX, pivotY;     // In the untrimmed frame
+    int16_t x, y;               // Trimmed bounds in the untrimmed frame
+    uint16_t w, h;
+    const void *data;           // Pixels (w * h) in the sheet's atlas, or an ST7789_Image
+} ST7789_SheetFrame;
+
+// Consecutive frames of a sheet played as one animation
+typedef struct {
+    uint16_t first;
+    uint16_t count;
+} ST7789_SheetRange;
+
+// What changes from frame `from` to this frame when both are drawn at the
+// same spot (image2cpp.py --delta): drawRle() spans covering (x, y, w, h)
+// of the untrimmed frame. Only useful where the previous frame is still on
+// screen, i.e. drawing directly or into the framebuffer.
+typedef struct {
+    uint16_t from;
+    int16_t x, y;
+    uint16_t w, h;
+    const uint16_t *spans;      // nullptr when the whole frame is cheaper
+} ST7789_SheetDelta;
+
+// Frames of a character packed into one atlas. Bitmap formats keep every
+// trimmed frame contiguous in `pixels`, so a frame is still sent with a
+// single window.
+typedef struct {
+    ST7789_SheetFormat format;
+    uint16_t count;
+    const ST7789_SheetFrame *frames;
+    const uint16_t *pixels;     // Atlas of the bitmap formats, nullptr for images
+    const ST7789_SheetDelta *deltas;    // One per frame, nullptr without --delta
+} ST7789_Sheet;
@@ -35,13 +35,24 @@
 
 // ===== Configuration ===== //
 #define SHOW_SPLASH     false
+#define RUN_BENCHMARK   false   // Driver benchmarks on boot, see bench/Benchmark.h
 
 #ifdef ATTACH_DEBUGGER
 #include "engine/RetroDebugger.h"
 #endif
 
+#if RUN_BENCHMARK
+#include "bench/Benchmark.h"
+#endif
+
 SceneManager sceneManager;
 
+RenderTask renderer;
+
+GameLoop gameLoop;
+
+Profiler profiler;
+
 IOHelper io;
 
 ST7789 tft(
@@ -55,7 +66,9 @@ ST7789 tft(
         TFT_HEIGHT, // Hard coded internally, just for rendering and calculations
         SPI2_HOST, // HSPI (default)
         80, // SPI frequency in MHz (default is 40)
-        40 // DMA lines for faster data transfer (default is 40)
+        40, // DMA lines for faster data transfer (default is 40)
+        2, // DMA buffers, one is filled while another is sent (default is 2)
+        16 // Queued SPI transactions, 1 for blocking transfers (default is 16)
     );
 
 RetroDebugger debugger;
@@ -70,6 +83,13 @@ extern "C" void app_main()
 
     tft.begin();
 
+    #if RUN_BENCHMARK
+    runBenchmarks(tft);
+    #endif
+
+    // Display lists are drawn on the second core
+    renderer.begin(tft);
+
     input.begin(JOYSTICK_X, JOYSTICK_Y, JOYSTICK_B);
 
     #ifdef ATTACH_DEBUGGER
@@ -82,10 +102,20 @@ extern "C" void app_main()
     sceneManager.set(&homeScene);
     #endif
 
+    // Scenes update at a fixed rate and render as fast as the panel allows
+    gameLoop.begin(sceneManager, GAME_LOOP_UPDATE_HZ, GAME_LOOP_MAX_UPDATES);
+
+    // SPI traffic is taken once per tick, a frame still on the render
+    // task counts for the next one
+    static ST7789_BusStats busStats;
+
     while(true){
+        int64_t inputStart = profiler.start();
         input.update();
-        sceneManager.update();
-        sceneManager.render();
+        profiler.stop(PROFILE_INPUT, inputStart);
+        gameLoop.tick();
+        tft.takeBusStats(busStats);
+        profiler.recordBus(busStats);
         #ifdef ATTACH_DEBUGGER
         debugger.debug();
         #endif
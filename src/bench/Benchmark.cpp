@@ -0,0 +1,126 @@
+#include <stdint.h>
+#include <stdio.h>
+#include "Benchmark.h"
+#include "esp_timer.h"
+#include "../engine/SpriteSheet.h"
+#include "../ST7789/colors.h"
+#include "../ST7789/fonts/FreeMono/FreeMono9pt7b.h"
+
+#include "sprites/zombie1.h"
+#include "sprites/jungle_background.h"
+#include "sprites/hearts.h"
+
+typedef void (*BenchScenario)(ST7789& tft, uint16_t frame);
+
+static void benchFill(ST7789& tft, uint16_t frame) {
+  tft.fillScreen(frame & 1 ? ST7789_COLOR_CREAM : ST7789_COLOR_PURPLE);
+}
+
+static void benchBackground(ST7789& tft, uint16_t /*frame*/) {
+  tft.drawImage(0, 56, &jungle_background_img);
+}
+
+// Two rows of five, overlapping like a crowd, each a step apart in the cycle
+static void benchSprites(ST7789& tft, uint16_t frame) {
+  Animation walk(zombie1_sheet, zombie1_walk_right_anim);
+
+  for (uint8_t i = 0; i < 10; i++) {
+    int16_t x = 27 + (i % 5) * 46;
+    int16_t y = 110 + (i / 5) * 100;
+    walk.draw(tft, frame + i, x, y, i & 1 ? ST7789_FLIP_H : 0);
+  }
+}
+
+// 10 lines of 20 characters
+static void benchTextLines(ST7789& tft) {
+  static const char* text =
+    "The quick brown fox \n"
+    "jumps over the lazy \n"
+    "dog. 0123456789 +-*/\n"
+    "THE QUICK BROWN FOX \n"
+    "JUMPS OVER THE LAZY \n"
+    "DOG! ()[]{}<>=?&%$#@\n"
+    "Sphinx of black quar\n"
+    "tz, judge my vow. ;:\n"
+    "Pack my box with fiv\n"
+    "e dozen liquor jugs.";
+
+  tft.drawText(10, 20, text);
+}
+
+static void benchText(ST7789& tft, uint16_t frame) {
+  tft.setFont(&FreeMono9pt7b);
+  tft.setTextColor(frame & 1 ? ST7789_COLOR_WHITE : ST7789_COLOR_PRIMARY);
+  benchTextLines(tft);
+}
+
+// The same lines opaque, every glyph is a tile of the glyph cache
+static void benchLabels(ST7789& tft, uint16_t frame) {
+  tft.setFont(&FreeMono9pt7b);
+  tft.setTextColor(frame & 1 ? ST7789_COLOR_WHITE : ST7789_COLOR_PRIMARY, ST7789_COLOR_BLACK);
+  benchTextLines(tft);
+}
+
+static void benchHearts(ST7789& tft, uint16_t frame) {
+  static const uint16_t* hearts[] = { heart_empty_rle, heart_half_rle, heart_full_rle };
+
+  for (uint8_t i = 0; i < 20; i++)
+    tft.drawRle(5 + (i % 10) * 23, 80 + (i / 10) * 60, 22, 21, hearts[(frame + i) % 3]);
+}
+
+static void run(ST7789& tft, const char* name, const char* mode, BenchScenario scenario, uint16_t frames) {
+  ST7789_BusStats bus;
+
+  tft.fillScreen(ST7789_COLOR_BLACK);
+  tft.flush();
+  tft.waitIdle();
+  tft.resetBusStats();
+
+  int64_t start = esp_timer_get_time();
+  for (uint16_t f = 0; f < frames; f++) {
+    scenario(tft, f);
+    tft.flush();
+  }
+  tft.waitIdle();
+  int64_t wall = esp_timer_get_time() - start;
+
+  tft.takeBusStats(bus);
+
+  float n = frames;
+  float cpu = wall - (int64_t)bus.total.waitUs;
+  float mpixels = wall > 0 ? bus.total.pixelBytes / 2.0f / wall : 0.0f;
+  printf("$bench.%s.%s=%.1f/%.1f/%.1f/%.1f/%.1f\n", name, mode,
+    wall / n, cpu / n, mpixels,
+    bus.total.transactions / n, (bus.total.commandBytes + bus.total.pixelBytes) / n);
+}
+
+static void runAll(ST7789& tft, const char* mode, uint16_t frames) {
+  run(tft, "fill", mode, benchFill, frames);
+  run(tft, "background", mode, benchBackground, frames);
+  run(tft, "sprites", mode, benchSprites, frames);
+  run(tft, "text", mode, benchText, frames);
+  run(tft, "labels", mode, benchLabels, frames);
+  run(tft, "hearts", mode, benchHearts, frames);
+}
+
+void runBenchmarks(ST7789& tft, uint16_t frames) {
+  if (!frames) return;
+  printf("$bench.frames=%u\n", frames);
+
+  runAll(tft, "direct", frames);
+
+  if (tft.enableFramebuffer()) {
+    runAll(tft, "framebuffer", frames);
+    tft.disableFramebuffer();
+  }
+
+  if (tft.enableBandRenderer()) {
+    runAll(tft, "bands", frames);
+    tft.disableBandRenderer();
+  }
+
+  tft.setTextColor(ST7789_COLOR_WHITE);
+  tft.clearGlyphCache();
+  tft.fillScreen(ST7789_COLOR_BLACK);
+  tft.waitIdle();
+}
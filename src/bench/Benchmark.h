@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+#include "../ST7789/ST7789.h"
+
+#define BENCH_FRAMES 60   // Frames per scenario and mode
+
+// Standard scenarios for comparing the driver's blitters, each run for
+// `frames` frames drawing straight to the panel, into the framebuffer (when
+// it fits) and through the band renderer:
+//
+//   fill        fillScreen(), 240x240
+//   background  jungle_background_img, 240x128 PAL8_RLE
+//   sprites     10 animated 54x75 zombie1 frames, half of them mirrored
+//   text        200 characters of FreeMono9pt7b
+//   labels      the same text opaque, drawn from the glyph cache
+//   hearts      20 transparent 22x21 RLE hearts
+//
+// Results go to stdout in the debugger's format, per frame:
+//
+//   $bench.sprites.direct=2910.4/2210.8/4.3/84.0/25462.0
+//
+// as wall us/CPU us (wall minus time blocked on the bus)/Mpixels sent per
+// second/transactions/bytes. Run it before the game loop starts: it owns the
+// panel and leaves it cleared.
+void runBenchmarks(ST7789& tft, uint16_t frames = BENCH_FRAMES);
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_timer.h"
+#include "SceneManager.h"
+#include "Profiler.h"
+
+#define GAME_LOOP_UPDATE_HZ     60  // Simulation steps per second
+#define GAME_LOOP_MAX_UPDATES   5   // Steps per frame before the loop drops time
+
+// Fixed-timestep scheduler. Every tick() runs as many Scene::update(dt)
+// steps as real time requires, then one Scene::render(alpha) where alpha
+// (0..1) is how far real time is into the next step. Gameplay speed no
+// longer depends on how long a frame takes to reach the panel.
+//
+// Scenes time their logic with now(), the simulated clock, which advances
+// by exactly one step per update. After GAME_LOOP_MAX_UPDATES steps in a
+// single tick (a slow frame, a blocking scene enter) the remaining time is
+// dropped instead of being caught up.
+class GameLoop {
+private:
+  SceneManager* scenes = nullptr;
+  int64_t step = 1000000 / GAME_LOOP_UPDATE_HZ;   // us
+  int64_t previous = 0;
+  int64_t accumulator = 0;
+  int64_t simTime = 0;                            // us
+  uint8_t maxUpdates = GAME_LOOP_MAX_UPDATES;
+
+  // Cost of the last tick, for profiling
+  int64_t updateTime = 0;
+  int64_t renderTime = 0;
+  uint8_t updateCount = 0;
+  uint32_t droppedSteps = 0;
+
+public:
+  void begin(SceneManager& manager, uint16_t hz = GAME_LOOP_UPDATE_HZ, uint8_t maxCatchUp = GAME_LOOP_MAX_UPDATES) {
+    scenes = &manager;
+    step = 1000000 / (hz ? hz : GAME_LOOP_UPDATE_HZ);
+    maxUpdates = maxCatchUp ? maxCatchUp : 1;
+    previous = esp_timer_get_time();
+    accumulator = 0;
+  }
+
+  void tick() {
+    if (!scenes) return;
+
+    int64_t start = esp_timer_get_time();
+    accumulator += start - previous;
+    previous = start;
+
+    float dt = step / 1000000.0f;
+    updateCount = 0;
+    while (accumulator >= step && updateCount < maxUpdates) {
+      // The step, including a pending scene's enter(), is charged to the
+      // scene it runs in
+      int64_t stepStart = profiler.start();
+      scenes->transition();
+      profiler.setScene(scenes->active());
+      scenes->update(dt);
+      profiler.stop(PROFILE_UPDATE, stepStart);
+      accumulator -= step;
+      simTime += step;
+      updateCount++;
+    }
+
+    // Too far behind, give up on the backlog
+    if (accumulator >= step) {
+      droppedSteps += accumulator / step;
+      accumulator %= step;
+    }
+
+    int64_t rendering = esp_timer_get_time();
+    updateTime = rendering - start;
+
+    profiler.setScene(scenes->active());
+    scenes->render((float)accumulator / step);
+    renderTime = esp_timer_get_time() - rendering;
+    profiler.record(PROFILE_RENDER, renderTime);
+  }
+
+  // Simulated time in milliseconds
+  unsigned long now() {
+    return simTime / 1000;
+  }
+
+  float stepSeconds() {
+    return step / 1000000.0f;
+  }
+
+  int64_t lastUpdateTime() { return updateTime; }
+  int64_t lastRenderTime() { return renderTime; }
+  uint8_t lastUpdateCount() { return updateCount; }
+  uint32_t dropped() { return droppedSteps; }
+};
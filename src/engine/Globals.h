@@ -3,6 +3,10 @@
 #include "SceneManager.h"
 #include "IOHelper.h"
 #include "RetroDebugger.h"
+#include "RenderTask.h"
+#include "GameLoop.h"
 
 extern ST7789 tft;
-extern SceneManager sceneManager;
\ No newline at end of file
+extern SceneManager sceneManager;
+extern RenderTask renderer;
+extern GameLoop gameLoop;
\ No newline at end of file
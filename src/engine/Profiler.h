@@ -0,0 +1,212 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "Scene.h"
+#include "../ST7789/bus_stats.h"
+
+#define PROFILER_SAMPLES    128   // Rolling window per phase
+#define PROFILER_MAX_SCENES 4     // Scenes beyond this share the last slot
+
+enum ProfilerPhase : uint8_t {
+  PROFILE_INPUT,      // input.update()
+  PROFILE_UPDATE,     // One Scene::update() step
+  PROFILE_RENDER,     // Scene::render(), recording the frame
+  PROFILE_FLUSH,      // drawList() + flush() on the render task
+  PROFILE_BUS,        // Part of FLUSH spent waiting for the SPI bus
+  PROFILE_PHASES
+};
+
+// Keeps the last PROFILER_SAMPLES durations (us) of every phase, per scene.
+// report() prints min/avg/p99 in the debugger's `$key=value` format:
+//
+//   $prof.game1.render=120/180/410
+//
+// FLUSH minus BUS is what the CPU spent converting pixels, so a slow
+// frame can be told apart from a saturated bus. Samples may come from
+// both cores. Nothing is recorded until begin().
+//
+// SPI traffic (ST7789::takeBusStats(), once per frame) is summed instead
+// and reportBus() prints the average per frame since its last call, for
+// the whole frame and every primitive that used the bus:
+//
+//   $bus.game1.total=42.0/31.5/11520.0/6.2/4.1/380.4
+//   $bus.game1.image=30.0/22.0/9600.0/4.0/3.0/300.2
+//
+// as transactions/command bytes/pixel bytes/windows/window changes/wait us.
+class Profiler {
+private:
+  struct Window {
+    uint32_t samples[PROFILER_SAMPLES];
+    uint16_t count = 0;
+    uint16_t next = 0;
+  };
+
+  struct SceneStats {
+    const Scene* scene = nullptr;
+    Window phases[PROFILE_PHASES];
+    ST7789_BusStats bus = {};
+    uint32_t busFrames = 0;
+  };
+
+  SceneStats scenes[PROFILER_MAX_SCENES];
+  uint8_t current = 0;
+  bool enabled = false;
+  portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+  static const char* phaseName(uint8_t phase) {
+    static const char* names[PROFILE_PHASES] = { "input", "update", "render", "flush", "bus" };
+    return names[phase];
+  }
+
+  static const char* primitiveName(uint8_t primitive) {
+    static const char* names[ST7789_BUS_PRIMITIVES] = { "other", "fill", "line", "text", "sprite", "bitmap", "rle", "image", "flush" };
+    return names[primitive];
+  }
+
+  static void add(ST7789_BusCounters& sum, const ST7789_BusCounters& c) {
+    sum.transactions += c.transactions;
+    sum.commandBytes += c.commandBytes;
+    sum.pixelBytes += c.pixelBytes;
+    sum.windows += c.windows;
+    sum.windowChanges += c.windowChanges;
+    sum.waitUs += c.waitUs;
+  }
+
+  // Averages keep a decimal, a sprite moving every third frame is 0.3 windows
+  static void print(const char* scene, const char* key, const ST7789_BusCounters& c, uint32_t frames) {
+    float n = frames;
+    printf("$bus.%s.%s=%.1f/%.1f/%.1f/%.1f/%.1f/%.1f\n", scene, key,
+      c.transactions / n, c.commandBytes / n, c.pixelBytes / n,
+      c.windows / n, c.windowChanges / n, c.waitUs / n);
+  }
+
+public:
+  void begin() {
+    enabled = true;
+  }
+
+  // Samples that follow belong to `scene`
+  void setScene(const Scene* scene) {
+    if (!enabled) return;
+
+    taskENTER_CRITICAL(&lock);
+    if (scenes[current].scene == scene) {
+      taskEXIT_CRITICAL(&lock);
+      return;
+    }
+
+    uint8_t slot = PROFILER_MAX_SCENES - 1;
+    for (uint8_t i = 0; i < PROFILER_MAX_SCENES; i++) {
+      if (scenes[i].scene == scene || !scenes[i].scene) {
+        slot = i;
+        break;
+      }
+    }
+
+    if (scenes[slot].scene != scene) {
+      scenes[slot].scene = scene;
+      for (uint8_t p = 0; p < PROFILE_PHASES; p++)
+        scenes[slot].phases[p].count = scenes[slot].phases[p].next = 0;
+      scenes[slot].bus = {};
+      scenes[slot].busFrames = 0;
+    }
+    current = slot;
+    taskEXIT_CRITICAL(&lock);
+  }
+
+  int64_t start() {
+    return esp_timer_get_time();
+  }
+
+  // Records the time since `since` (from start())
+  void stop(ProfilerPhase phase, int64_t since) {
+    record(phase, (uint32_t)(esp_timer_get_time() - since));
+  }
+
+  void record(ProfilerPhase phase, uint32_t us) {
+    if (!enabled) return;
+
+    taskENTER_CRITICAL(&lock);
+    Window& w = scenes[current].phases[phase];
+    w.samples[w.next] = us;
+    w.next = (w.next + 1) % PROFILER_SAMPLES;
+    if (w.count < PROFILER_SAMPLES) w.count++;
+    taskEXIT_CRITICAL(&lock);
+  }
+
+  // Adds one frame of bus traffic
+  void recordBus(const ST7789_BusStats& frame) {
+    if (!enabled) return;
+
+    taskENTER_CRITICAL(&lock);
+    SceneStats& s = scenes[current];
+    add(s.bus.total, frame.total);
+    for (uint8_t i = 0; i < ST7789_BUS_PRIMITIVES; i++)
+      add(s.bus.primitive[i], frame.primitive[i]);
+    s.busFrames++;
+    taskEXIT_CRITICAL(&lock);
+  }
+
+  // Prints the bus traffic per frame of the current scene and starts over
+  void reportBus() {
+    if (!enabled) return;
+
+    taskENTER_CRITICAL(&lock);
+    SceneStats& s = scenes[current];
+    const Scene* scene = s.scene;
+    ST7789_BusStats bus = s.bus;
+    uint32_t frames = s.busFrames;
+    s.bus = {};
+    s.busFrames = 0;
+    taskEXIT_CRITICAL(&lock);
+
+    if (!frames) return;
+
+    const char* name = scene ? scene->name() : "none";
+    print(name, "total", bus.total, frames);
+    for (uint8_t i = 0; i < ST7789_BUS_PRIMITIVES; i++) {
+      if (bus.primitive[i].transactions)
+        print(name, primitiveName(i), bus.primitive[i], frames);
+    }
+  }
+
+  // Prints every phase of the current scene that has samples. The scene
+  // and all of its windows are copied in one go, so a scene change in the
+  // middle cannot mix two scenes. Only the debugger task reports, the copy
+  // is static to keep it off that task's stack.
+  void report() {
+    if (!enabled) return;
+
+    static Window snapshot[PROFILE_PHASES];
+
+    taskENTER_CRITICAL(&lock);
+    const Scene* scene = scenes[current].scene;
+    memcpy(snapshot, scenes[current].phases, sizeof(snapshot));
+    taskEXIT_CRITICAL(&lock);
+
+    const char* name = scene ? scene->name() : "none";
+
+    for (uint8_t p = 0; p < PROFILE_PHASES; p++) {
+      uint16_t count = snapshot[p].count;
+      uint32_t* sorted = snapshot[p].samples;
+      if (!count) continue;
+
+      std::sort(sorted, sorted + count);
+      uint64_t sum = 0;
+      for (uint16_t i = 0; i < count; i++)
+        sum += sorted[i];
+
+      printf("$prof.%s.%s=%lu/%lu/%lu\n", name, phaseName(p),
+        (unsigned long)sorted[0],
+        (unsigned long)(sum / count),
+        (unsigned long)sorted[(count * 99) / 100]);
+    }
+  }
+};
+
+extern Profiler profiler;
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "../ST7789/ST7789.h"
+#include "../ST7789/DisplayList.h"
+#include "Profiler.h"
+
+#define RENDER_TASK_FRAMES   2     // Lists in flight, one recorded while one is drawn
+#define RENDER_TASK_CORE     1     // app_main runs on core 0
+#define RENDER_TASK_PRIORITY 5
+#define RENDER_TASK_STACK    4096
+
+// Draws finished display lists on the other core. The game loop records
+// frame N+1 while this task sends frame N over SPI:
+//
+//   DisplayList& frame = renderer.acquire();
+//   ... record ...
+//   renderer.submit(frame);
+//
+// While frames are queued the render task owns the driver; call sync()
+// before drawing on tft directly (e.g. in a scene's exit()).
+// Without begin(), submit() draws on the calling task.
+class RenderTask {
+private:
+  ST7789* display = nullptr;
+  DisplayList lists[RENDER_TASK_FRAMES];
+  QueueHandle_t ready = nullptr;     // Recorded, waiting to be drawn
+  QueueHandle_t idle = nullptr;      // Drawn, free to record into
+  TaskHandle_t task = nullptr;
+
+  static void run(void* arg) {
+    RenderTask* self = (RenderTask*)arg;
+    DisplayList* list;
+
+    while (true) {
+      xQueueReceive(self->ready, &list, portMAX_DELAY);
+      self->draw(*list);
+      xQueueSend(self->idle, &list, portMAX_DELAY);
+    }
+  }
+
+  void draw(DisplayList& list) {
+    int64_t start = profiler.start();
+    display->takeBusWait();
+    display->drawList(list);
+    display->flush();
+    profiler.stop(PROFILE_FLUSH, start);
+    profiler.record(PROFILE_BUS, display->takeBusWait());
+    list.clear();
+  }
+
+public:
+  // Allocates the lists and starts the task, false keeps drawing inline
+  bool begin(ST7789& tft) {
+    display = &tft;
+
+    for (uint8_t i = 0; i < RENDER_TASK_FRAMES; i++)
+      if (!lists[i].begin(tft.width(), tft.height()))
+        return false;
+
+    ready = xQueueCreate(RENDER_TASK_FRAMES, sizeof(DisplayList*));
+    idle = xQueueCreate(RENDER_TASK_FRAMES, sizeof(DisplayList*));
+    if (!ready || !idle)
+      return false;
+
+    for (uint8_t i = 0; i < RENDER_TASK_FRAMES; i++) {
+      DisplayList* list = &lists[i];
+      xQueueSend(idle, &list, 0);
+    }
+
+    return xTaskCreatePinnedToCore(run, "render", RENDER_TASK_STACK, this, RENDER_TASK_PRIORITY, &task, RENDER_TASK_CORE) == pdPASS;
+  }
+
+  // Empty list for the next frame, waits while every list is in flight
+  DisplayList& acquire() {
+    if (!task)
+      return lists[0];
+
+    DisplayList* list;
+    xQueueReceive(idle, &list, portMAX_DELAY);
+    return *list;
+  }
+
+  // Hands a recorded frame to the render task
+  void submit(DisplayList& list) {
+    if (!task) {
+      draw(list);
+      return;
+    }
+
+    DisplayList* p = &list;
+    xQueueSend(ready, &p, portMAX_DELAY);
+  }
+
+  // Waits until every submitted frame is on the panel. Must not be
+  // called while holding an acquired list.
+  void sync() {
+    if (!task) return;
+
+    DisplayList* held[RENDER_TASK_FRAMES];
+    for (uint8_t i = 0; i < RENDER_TASK_FRAMES; i++)
+      xQueueReceive(idle, &held[i], portMAX_DELAY);
+    for (uint8_t i = 0; i < RENDER_TASK_FRAMES; i++)
+      xQueueSend(idle, &held[i], 0);
+  }
+};
@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include "./Input.h"
+#include "./Profiler.h"
 #include "esp_heap_caps.h"
 
 class RetroDebugger
@@ -14,7 +15,7 @@ private:
 public:
 
   void setup(){
-    
+    profiler.begin();
   }
 
   void debug(){
@@ -35,6 +36,10 @@ public:
 
       printf("$heap=%d/%d\n", usedHeap, maxHeap);
 
+      // Frame phase timings and SPI traffic of the running scene
+      profiler.report();
+      profiler.reportBus();
+
     }
 
   }
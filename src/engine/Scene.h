@@ -3,8 +3,9 @@
 class Scene {
 public:
   virtual void enter() = 0;
-  virtual void update() = 0;
-  virtual void render() = 0;
+  virtual void update(float dt) = 0;     // Fixed step, in seconds
+  virtual void render(float alpha) = 0;  // 0..1 into the next step
   virtual void exit() = 0;
+  virtual const char* name() const { return "scene"; }  // For the profiler
   virtual ~Scene() {}
 };
\ No newline at end of file
@@ -11,18 +11,26 @@ public:
     next = s;
   }
 
-  void update() {
+  // Switches to the scene passed to set(), if any
+  void transition() {
     if (next) {
       if (current) current->exit();
       current = next;
       current->enter();
       next = nullptr;
     }
+  }
+
+  void update(float dt) {
+    transition();
+    if (current) current->update(dt);
+  }
 
-    if (current) current->update();
+  Scene* active() {
+    return current;
   }
 
-  void render() {
-    if (current) current->render();
+  void render(float alpha) {
+    if (current) current->render(alpha);
   }
 };
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <stdint.h>
+#include "Globals.h"
+#include "../utils.h"
+#include "../ST7789/DisplayList.h"
+
+#define SPRITE_LAYER_MAX 8
+#define SPRITE_LAYER_MAX_DAMAGE (SPRITE_LAYER_MAX * 2)
+
+// Retained sprites on top of a static backdrop. Moving or changing a sprite
+// repaints the area it left (backdrop + every sprite overlapping it, in id
+// order) through the clip rect, so scenes no longer erase by hand. With the
+// framebuffer enabled only those areas end up dirty and get flushed.
+//
+// Areas are only recorded as damaged while sprites are placed and get
+// repainted by commit(), once every sprite shows its final frame. Repainting
+// straight away would record the sprites placed later at their old position,
+// above the backdrop of later repaints once the list is sorted by layer.
+//
+// Repaints are recorded into a display list: the backdrop on layer 0 and
+// sprite `id` on layer id + 1, so tft.drawList() can drop backdrop work a
+// sprite covers anyway. Layers above SPRITE_LAYER_MAX are free for HUDs.
+class SpriteLayer {
+public:
+  // Repaints the backdrop, the list is already clipped to (x, y, w, h)
+  typedef void (*BackdropPainter)(DisplayList& list, int16_t x, int16_t y, int16_t w, int16_t h);
+
+  // The changed pixels between two frames drawn at the same spot
+  // (image2cpp.py --delta), used instead of a repaint where possible
+  struct Patch {
+    const void* from;           // Bitmap or image the sprite must still show...
+    int16_t fromX, fromY;       // ...at this position
+    int16_t x, y, w, h;         // Where `spans` go, drawRle() data
+    const uint16_t* spans;
+  };
+
+private:
+  struct Entry {
+    const uint16_t* bitmap = nullptr;
+    const ST7789_Image* image = nullptr;    // Drawn instead of bitmap when set
+    const uint16_t* palette = nullptr;      // Overrides image->palette
+    int16_t x = 0, y = 0, w = 0, h = 0;
+    bool transparent = false;
+    bool bigEndian = false;     // Panel byte order, see image2cpp.py --big-endian
+    uint8_t flags = 0;          // ST7789_FLIP_H
+    bool visible = false;
+  };
+
+  struct Area {
+    int16_t x, y, w, h;
+  };
+
+  Entry sprites[SPRITE_LAYER_MAX];
+  Area damage[SPRITE_LAYER_MAX_DAMAGE];
+  uint8_t damageCount = 0;
+  BackdropPainter backdrop = nullptr;
+  DisplayList* list = nullptr;
+  bool retained = false;
+
+  static bool overlaps(const Entry& s, int16_t x, int16_t y, int16_t w, int16_t h) {
+    return s.x < x + w && x < s.x + s.w && s.y < y + h && y < s.y + s.h;
+  }
+
+  static void merge(Area& a, int16_t x, int16_t y, int16_t w, int16_t h) {
+    int16_t x1 = MAX(a.x + a.w, x + w);
+    int16_t y1 = MAX(a.y + a.h, y + h);
+    a.x = MIN(a.x, x);
+    a.y = MIN(a.y, y);
+    a.w = x1 - a.x;
+    a.h = y1 - a.y;
+  }
+
+  // Queues an area for commit(), overlapping areas are repainted as one
+  void damaged(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (w <= 0 || h <= 0) return;
+
+    for (uint8_t i = 0; i < damageCount; i++) {
+      Area& a = damage[i];
+      if (a.x < x + w && x < a.x + a.w && a.y < y + h && y < a.y + a.h) {
+        merge(a, x, y, w, h);
+        return;
+      }
+    }
+    if (damageCount < SPRITE_LAYER_MAX_DAMAGE)
+      damage[damageCount++] = {x, y, w, h};
+    else
+      merge(damage[damageCount - 1], x, y, w, h);
+  }
+
+  void recompose(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (!list || w <= 0 || h <= 0) return;
+
+    list->setClipRect(x, y, w, h);
+
+    if (backdrop) {
+      list->setLayer(0);
+      backdrop(*list, x, y, w, h);
+    }
+
+    for (uint8_t i = 0; i < SPRITE_LAYER_MAX; i++) {
+      const Entry& s = sprites[i];
+      if (!s.visible || !overlaps(s, x, y, w, h))
+        continue;
+      list->setLayer(i + 1);
+      if (s.image)
+        list->drawImage(s.x, s.y, s.image, s.palette, s.flags);
+      else if (s.transparent && s.bigEndian)
+        list->drawRgbBitmapBE(s.x, s.y, s.w, s.h, s.bitmap, s.flags);
+      else if (s.transparent)
+        list->drawRgbBitmap(s.x, s.y, s.w, s.h, s.bitmap, s.flags);
+      else if (s.bigEndian)
+        list->drawSpriteBE(s.x, s.y, s.w, s.h, s.bitmap, s.flags);
+      else
+        list->drawSprite(s.x, s.y, s.w, s.h, s.bitmap, s.flags);
+    }
+
+    list->clearClipRect();
+  }
+
+  // A patch only works on top of the frame it was made from, in its own
+  // colours, and when no other sprite shares the pixels it overwrites
+  bool patchable(uint8_t id, const Entry& s, const Entry& next, const Patch& patch) const {
+    if (!retained || !list || !patch.spans || !s.visible || next.transparent || next.palette)
+      return false;
+    if ((s.image ? (const void*)s.image : s.bitmap) != patch.from || s.x != patch.fromX || s.y != patch.fromY || s.flags != next.flags)
+      return false;
+
+    int16_t x0 = MIN(s.x, next.x);
+    int16_t y0 = MIN(s.y, next.y);
+    int16_t x1 = MAX(s.x + s.w, next.x + next.w);
+    int16_t y1 = MAX(s.y + s.h, next.y + next.h);
+    for (uint8_t i = 0; i < SPRITE_LAYER_MAX; i++) {
+      if (i != id && sprites[i].visible && overlaps(sprites[i], x0, y0, x1 - x0, y1 - y0))
+        return false;
+    }
+    return true;
+  }
+
+  void place(uint8_t id, Entry next, const Patch* patch = nullptr) {
+    if (id >= SPRITE_LAYER_MAX) return;
+
+    Entry& s = sprites[id];
+    if (s.visible && s.bitmap == next.bitmap && s.image == next.image && s.palette == next.palette && s.x == next.x && s.y == next.y
+        && s.w == next.w && s.h == next.h && s.transparent == next.transparent && s.bigEndian == next.bigEndian && s.flags == next.flags)
+      return;
+
+    Entry before = s;
+    next.visible = true;
+
+    if (patch && patchable(id, before, next, *patch)) {
+      s = next;
+      list->setLayer(id + 1);
+      list->drawRle(patch->x, patch->y, patch->w, patch->h, patch->spans, next.flags);
+      return;
+    }
+
+    s = next;
+    repaint(before, s);
+  }
+
+  // Damages the old and new area of a sprite, as one region when they touch
+  void repaint(const Entry& before, const Entry& after) {
+    if (!before.visible) {
+      damaged(after.x, after.y, after.w, after.h);
+    }
+    else if (!after.visible) {
+      damaged(before.x, before.y, before.w, before.h);
+    }
+    else if (overlaps(before, after.x, after.y, after.w, after.h)) {
+      int16_t x0 = MIN(before.x, after.x);
+      int16_t y0 = MIN(before.y, after.y);
+      int16_t x1 = MAX(before.x + before.w, after.x + after.w);
+      int16_t y1 = MAX(before.y + before.h, after.y + after.h);
+      damaged(x0, y0, x1 - x0, y1 - y0);
+    }
+    else {
+      damaged(before.x, before.y, before.w, before.h);
+      damaged(after.x, after.y, after.w, after.h);
+    }
+  }
+
+public:
+  void setBackdrop(BackdropPainter painter) {
+    backdrop = painter;
+  }
+
+  // Display list that repaints are recorded into
+  void setList(DisplayList& target) {
+    list = &target;
+  }
+
+  // Set when the list's target keeps its pixels between frames (drawing
+  // directly or into the framebuffer), which lets draw() apply patches.
+  // The band renderer rebuilds every dirty band from scratch, leave it off.
+  void setRetained(bool keepsPixels) {
+    retained = keepsPixels;
+  }
+
+  // Repaints an area that something else drew over, on the next commit()
+  void invalidate(int16_t x, int16_t y, int16_t w, int16_t h) {
+    damaged(x, y, w, h);
+  }
+
+  // Records the repaint of every damaged area into the list, once the
+  // frame's sprites are placed and before the list is submitted
+  void commit() {
+    for (uint8_t i = 0; i < damageCount; i++)
+      recompose(damage[i].x, damage[i].y, damage[i].w, damage[i].h);
+    damageCount = 0;
+  }
+
+  // Places sprite `id` (higher ids are drawn on top). Nothing is redrawn
+  // when the sprite did not change since the last call. `flags` takes
+  // ST7789_FLIP_H, so one set of frames serves both facing directions.
+  // With a `patch` a frame change in place only sends the changed pixels.
+  void draw(uint8_t id, int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* bitmap, bool transparent = false, bool bigEndian = false, uint8_t flags = 0,
+            const Patch* patch = nullptr) {
+    Entry next;
+    next.bitmap = bitmap;
+    next.x = x;
+    next.y = y;
+    next.w = w;
+    next.h = h;
+    next.transparent = transparent;
+    next.bigEndian = bigEndian;
+    next.flags = flags;
+    place(id, next, patch);
+  }
+
+  // Same for a compressed opaque image (image2cpp.py --compress).
+  // `palette` replaces the image's own one for palettized formats.
+  void draw(uint8_t id, int16_t x, int16_t y, const ST7789_Image* image, const uint16_t* palette = nullptr, uint8_t flags = 0, const Patch* patch = nullptr) {
+    if (!image) return;
+
+    Entry next;
+    next.image = image;
+    next.palette = palette;
+    next.flags = flags;
+    next.x = x;
+    next.y = y;
+    next.w = image->width;
+    next.h = image->height;
+    place(id, next, patch);
+  }
+
+  // Removes sprite `id` and restores what was behind it
+  void hide(uint8_t id) {
+    if (id >= SPRITE_LAYER_MAX || !sprites[id].visible) return;
+
+    Entry before = sprites[id];
+    sprites[id].visible = false;
+
+    repaint(before, sprites[id]);
+  }
+
+  // Forgets every sprite without touching the screen (e.g. on scene enter)
+  void clear() {
+    for (uint8_t i = 0; i < SPRITE_LAYER_MAX; i++)
+      sprites[i] = Entry();
+    damageCount = 0;
+  }
+};
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <stdint.h>
+#include "SpriteLayer.h"
+#include "../ST7789/ST7789.h"
+#include "../ST7789/DisplayList.h"
+#include "../ST7789/sheet.h"
+
+// Draws frames of an ST7789_Sheet (image2cpp.py --sheet) by index. A frame
+// is placed so its pivot lands on the draw position and only its trimmed
+// bounds are sent. With ST7789_FLIP_H it is mirrored around the pivot, so
+// a character with a centred pivot turns on the spot. Sheets built with
+// image2cpp.py --delta hand SpriteLayer the changed pixels between frames.
+class SpriteSheet {
+private:
+  const ST7789_Sheet* sheet = nullptr;
+
+public:
+  SpriteSheet() {}
+  SpriteSheet(const ST7789_Sheet& source) : sheet(&source) {}
+
+  uint16_t count() const {
+    return sheet ? sheet->count : 0;
+  }
+
+  const ST7789_SheetFrame* frame(uint16_t index) const {
+    return sheet && index < sheet->count ? &sheet->frames[index] : nullptr;
+  }
+
+  // Top-left screen position of the trimmed pixels of frame `index`
+  bool origin(uint16_t index, int16_t x, int16_t y, uint8_t flags, int16_t& left, int16_t& top) const {
+    const ST7789_SheetFrame* f = frame(index);
+    if (!f || !f->w || !f->h) return false;
+
+    if (flags & ST7789_FLIP_H)
+      left = x + f->pivotX - f->x - f->w;
+    else
+      left = x - f->pivotX + f->x;
+    top = y - f->pivotY + f->y;
+    return true;
+  }
+
+  // The delta into frame `index` at the same spot, false without one
+  bool patch(uint16_t index, int16_t x, int16_t y, uint8_t flags, SpriteLayer::Patch& out) const {
+    if (!sheet || !sheet->deltas || index >= sheet->count) return false;
+
+    const ST7789_SheetDelta& d = sheet->deltas[index];
+    const ST7789_SheetFrame* f = frame(index);
+    if (!d.spans || !origin(d.from, x, y, flags, out.fromX, out.fromY)) return false;
+
+    out.from = frame(d.from)->data;
+    out.x = flags & ST7789_FLIP_H ? x + f->pivotX - d.x - d.w : x - f->pivotX + d.x;
+    out.y = y - f->pivotY + d.y;
+    out.w = d.w;
+    out.h = d.h;
+    out.spans = d.spans;
+    return true;
+  }
+
+  // Retained: places the frame as sprite `id` of `layer`
+  void draw(SpriteLayer& layer, uint8_t id, uint16_t index, int16_t x, int16_t y, uint8_t flags = 0) const {
+    int16_t left, top;
+    if (!origin(index, x, y, flags, left, top)) {
+      layer.hide(id);
+      return;
+    }
+
+    SpriteLayer::Patch delta;
+    const SpriteLayer::Patch* p = patch(index, x, y, flags, delta) ? &delta : nullptr;
+
+    const ST7789_SheetFrame* f = frame(index);
+    switch (sheet->format) {
+      case ST7789_SHEET_SPRITE:
+        layer.draw(id, left, top, f->w, f->h, (const uint16_t*)f->data, false, true, flags, p);
+        break;
+      case ST7789_SHEET_BITMAP:
+        layer.draw(id, left, top, f->w, f->h, (const uint16_t*)f->data, true, true, flags);
+        break;
+      case ST7789_SHEET_IMAGE:
+        layer.draw(id, left, top, (const ST7789_Image*)f->data, nullptr, flags, p);
+        break;
+    }
+  }
+
+  // Direct: draws the frame on `tft` right away
+  void draw(ST7789& tft, uint16_t index, int16_t x, int16_t y, uint8_t flags = 0) const {
+    int16_t left, top;
+    if (!origin(index, x, y, flags, left, top)) return;
+
+    const ST7789_SheetFrame* f = frame(index);
+    switch (sheet->format) {
+      case ST7789_SHEET_SPRITE:
+        tft.drawSpriteBE(left, top, f->w, f->h, (const uint16_t*)f->data, flags);
+        break;
+      case ST7789_SHEET_BITMAP:
+        tft.drawRgbBitmapBE(left, top, f->w, f->h, (const uint16_t*)f->data, flags);
+        break;
+      case ST7789_SHEET_IMAGE:
+        tft.drawImage(left, top, (const ST7789_Image*)f->data, nullptr, flags);
+        break;
+    }
+  }
+
+  // Immediate: records the frame into `list`
+  void draw(DisplayList& list, uint16_t index, int16_t x, int16_t y, uint8_t flags = 0) const {
+    int16_t left, top;
+    if (!origin(index, x, y, flags, left, top)) return;
+
+    const ST7789_SheetFrame* f = frame(index);
+    switch (sheet->format) {
+      case ST7789_SHEET_SPRITE:
+        list.drawSpriteBE(left, top, f->w, f->h, (const uint16_t*)f->data, flags);
+        break;
+      case ST7789_SHEET_BITMAP:
+        list.drawRgbBitmapBE(left, top, f->w, f->h, (const uint16_t*)f->data, flags);
+        break;
+      case ST7789_SHEET_IMAGE:
+        list.drawImage(left, top, (const ST7789_Image*)f->data, nullptr, flags);
+        break;
+    }
+  }
+};
+
+// A range of sheet frames such as a walk cycle, stepped by the scene
+class Animation {
+private:
+  SpriteSheet sheet;
+  uint16_t first = 0;
+  uint16_t count = 0;
+
+public:
+  Animation() {}
+  Animation(const ST7789_Sheet& source, ST7789_SheetRange range) : sheet(source), first(range.first), count(range.count) {}
+
+  uint16_t length() const {
+    return count;
+  }
+
+  // Sheet frame of step `step`, wrapping around
+  uint16_t frame(uint16_t step) const {
+    return count ? first + step % count : first;
+  }
+
+  void draw(SpriteLayer& layer, uint8_t id, uint16_t step, int16_t x, int16_t y, uint8_t flags = 0) const {
+    sheet.draw(layer, id, frame(step), x, y, flags);
+  }
+
+  void draw(DisplayList& list, uint16_t step, int16_t x, int16_t y, uint8_t flags = 0) const {
+    sheet.draw(list, frame(step), x, y, flags);
+  }
+
+  void draw(ST7789& tft, uint16_t step, int16_t x, int16_t y, uint8_t flags = 0) const {
+    sheet.draw(tft, frame(step), x, y, flags);
+  }
+};
@@ -1,119 +1,48 @@
 #include <stdint.h>
+#include <stdio.h>
 #include "Game1Scene.h"
 #include "esp_random.h"
 #include "../engine/Globals.h"
 #include "../engine/Input.h"
+#include "../engine/SpriteLayer.h"
+#include "../engine/SpriteSheet.h"
+#include "../ST7789/DisplayList.h"
+#include "../engine/RenderTask.h"
 #include "../scenes/HomeScene.h"
-#include "../sprites/girl_walk_right.h"
-#include "../sprites/girl_walk_left.h"
-#include "../sprites/girl_attack_left.h"
-#include "../sprites/girl_attack_right.h"
-#include "../sprites/girl_idle.h"
-#include "../sprites/zombie1_walk_right.h"
-#include "../sprites/zombie1_walk_left.h"
-#include "../sprites/zombie1_attack_right.h"
-#include "../sprites/zombie1_attack_left.h"
-#include "../sprites/zombie1_die_left.h"
-#include "../sprites/zombie1_die_right.h"
-#include "../sprites/grass_tiles.h"
-#include "../sprites/jungle_background.h"
-#include "../sprites/hearts.h"
-#include "../sprites/skeleton.h"
+// Packed at build time, see src/CMakeLists.txt
+#include "sprites/girl.h"
+#include "sprites/zombie1.h"
+#include "sprites/grass_tiles.h"
+#include "sprites/jungle_background.h"
+#include "sprites/hearts.h"
 #include "../ST7789/fonts/FreeMono/FreeMono9pt7b.h"
 
 #define MAX_ENEMIES 4
 #define ZOMBIES_WIDTH 54
+#define GIRL_WIDTH 34
+#define GROUND_Y 202  // Where the actors' feet (the sheet pivots) stand
 
-Game1Scene game1Scene;
-
-const uint16_t* girl_walk_right[] = {
-  girl_walk_right_1_bmp,
-  girl_walk_right_2_bmp,
-  girl_walk_right_3_bmp,
-  girl_walk_right_4_bmp,
-  girl_walk_right_5_bmp,
-  girl_walk_right_6_bmp,
-  girl_walk_right_7_bmp,
-  girl_walk_right_8_bmp,
-  girl_walk_right_9_bmp,
-  girl_walk_right_10_bmp
-};
-
-const uint16_t* girl_walk_left[] = {
-  girl_walk_left_1_bmp,
-  girl_walk_left_2_bmp,
-  girl_walk_left_3_bmp,
-  girl_walk_left_4_bmp,
-  girl_walk_left_5_bmp,
-  girl_walk_left_6_bmp,
-  girl_walk_left_7_bmp,
-  girl_walk_left_8_bmp,
-  girl_walk_left_9_bmp,
-  girl_walk_left_10_bmp
-};
-
-const uint16_t* girl_attack_right[] = {
-  girl_attack_right_1_bmp,
-  girl_attack_right_2_bmp,
-  girl_attack_right_3_bmp
-};
-
-const uint16_t* girl_attack_left[] = {
-  girl_attack_left_1_bmp,
-  girl_attack_left_2_bmp,
-  girl_attack_left_3_bmp
-};
+// Sprite layer ids, the girl is drawn on top of the zombies
+#define LAYER_ENEMY(i) (i)
+#define LAYER_GIRL MAX_ENEMIES
 
-const uint16_t* zombie1_walk_right[] = {
-  zombie1_walk_right_1_bmp,
-  zombie1_walk_right_2_bmp,
-  zombie1_walk_right_3_bmp,
-  zombie1_walk_right_4_bmp,
-  zombie1_walk_right_5_bmp,
-  zombie1_walk_right_6_bmp,
-  zombie1_walk_right_7_bmp,
-  zombie1_walk_right_8_bmp,
-  zombie1_walk_right_9_bmp,
-  zombie1_walk_right_10_bmp
-};
-
-const uint16_t* zombie1_walk_left[] = {
-  zombie1_walk_left_1_bmp,
-  zombie1_walk_left_2_bmp,
-  zombie1_walk_left_3_bmp,
-  zombie1_walk_left_4_bmp,
-  zombie1_walk_left_5_bmp,
-  zombie1_walk_left_6_bmp,
-  zombie1_walk_left_7_bmp,
-  zombie1_walk_left_8_bmp,
-  zombie1_walk_left_9_bmp,
-  zombie1_walk_left_10_bmp
-};
+// Display list layer of the score and hearts, above every sprite
+#define LAYER_HUD (SPRITE_LAYER_MAX + 1)
 
-const uint16_t* zombie1_attack_right[] = {
-  zombie1_attack_right_1_bmp,
-  zombie1_attack_right_2_bmp
-};
-
-const uint16_t* zombie1_attack_left[] = {
-  zombie1_attack_left_1_bmp,
-  zombie1_attack_left_2_bmp
-};
+Game1Scene game1Scene;
 
-const uint16_t* zombie1_die_right[] = {
-  zombie1_die_right_1_bmp,
-  zombie1_die_right_2_bmp
-};
-
-const uint16_t* zombie1_die_left[] = {
-  zombie1_die_left_1_bmp,
-  zombie1_die_left_2_bmp
-};
+// Every animation faces right, actors facing left are drawn with ST7789_FLIP_H
+const Animation girlIdle(girl_sheet, girl_idle_anim);
+const Animation girlWalk(girl_sheet, girl_walk_right_anim);
+const Animation girlAttack(girl_sheet, girl_attack_right_anim);
+const Animation zombie1Walk(zombie1_sheet, zombie1_walk_right_anim);
+const Animation zombie1Attack(zombie1_sheet, zombie1_attack_right_anim);
+const Animation zombie1Die(zombie1_sheet, zombie1_die_right_anim);
 
 const uint16_t* hearts[] = {
-  heart_empty_bmp,
-  heart_half_bmp,
-  heart_full_bmp
+  heart_empty_rle,
+  heart_half_rle,
+  heart_full_rle
 };
 
 unsigned long tickTimer, idleTimer, controllerTimer;
@@ -134,7 +63,7 @@ enum EnemyType : uint8_t {
 
 
 struct Player {
-  uint8_t x = 103, lastX = 0;
+  uint8_t x = 103;
   uint8_t positionIndex = 0;
   uint8_t direction = DIR_RIGHT;
   uint8_t steps = 2;
@@ -143,12 +72,14 @@ struct Player {
   uint8_t maxHp = 8; // Always must be an even number
   uint8_t hp = 8;
   uint8_t score = 0;
+  const Animation* animation = &girlIdle;    // Frame picked by the last update
+  uint8_t frame = 0;
   bool moving = false;
   bool attacking = false;
 };
 
 struct Enemy {
-  int16_t x = 0, lastX = 0;
+  int16_t x = 0;
   uint8_t positionIndex = 0;
   uint8_t direction = DIR_RIGHT;
   uint8_t steps = 1;
@@ -156,6 +87,8 @@ struct Enemy {
   uint8_t type = ENEMY_ZOMBIE1;
   uint8_t health = 10;
   unsigned long tick;
+  const Animation* animation = nullptr;      // Frame picked by the last update
+  uint8_t frame = 0;
   bool active = false;
   bool moving = false;
   bool attacking = false;
@@ -164,11 +97,33 @@ struct Enemy {
 Player girl;
 Enemy enemies[MAX_ENEMIES];
 
+SpriteLayer actors;
+
+// Draw calls of the frame being recorded, handed to the renderer at the
+// end of render() while the previous one may still be on its way out
+DisplayList* frame = nullptr;
+
 uint16_t nearestEnemyFromLeft = 0,
 nearestEnemyFromRight = 240;
 
 uint8_t livingEnemies = 2;
 
+// Set by update(), the score label is redrawn by the next render()
+bool scoreChanged = false;
+
+// Static scenery behind the actors, drawing is clipped by the sprite layer
+void paintBackdrop(DisplayList& list, int16_t x, int16_t y, int16_t w, int16_t h){
+  list.fillRect(x, y, w, h, bgColor);
+  if(y < 128)
+    list.drawImage(0, 0, &jungle_background_img);
+  if(y + h > 202){
+    list.drawImage(0, 202, &grass_tile_left_img);
+    list.drawImage(60, 202, &grass_tile_middle_img);
+    list.drawImage(120, 202, &grass_tile_middle_img);
+    list.drawImage(180, 202, &grass_tile_right_img);
+  }
+}
+
 void setSpeed(uint8_t speed){
   girl.speed = speed * 2;
   girl.steps = speed > 1 ? 3 : 2;
@@ -178,6 +133,8 @@ void updateHealth() {
   uint8_t heartCount = girl.maxHp >> 1;
   uint8_t hp = girl.hp;
 
+  frame->setLayer(LAYER_HUD);
+
   for(uint8_t i = 0; i < heartCount; i++) {
     uint8_t heartState = 0; // Empty
     int8_t localHp = hp - (i << 1);
@@ -187,15 +144,20 @@ void updateHealth() {
     else if(localHp == 1)
       heartState = 1; // Half
 
-    tft.drawRgbBitmap(10 + i * 24, 10, 22, 21, hearts[heartState]);
+    frame->drawRle(10 + i * 24, 10, 22, 21, hearts[heartState]);
   }
 }
 
 void updateScore(){
-  tft.setTextColor(0x0000);
-  tft.setFont(&FreeMono9pt7b);
-  tft.fillRect(173, 11, 33, 14, 0xef36);
-  tft.printWithOffsetAlignment(girl.score, ST7789_ALIGN_CENTER | ST7789_ALIGN_TOP, 72, 7);
+  char text[4];
+  int16_t textW, textH;
+  snprintf(text, sizeof(text), "%u", girl.score);
+  ST7789::measureText(&FreeMono9pt7b, text, textW, textH);
+
+  // Same spot as printWithOffsetAlignment(CENTER | TOP) with a (72, 7)
+  // offset, the box replaces the previous score in the same pass
+  frame->setLayer(LAYER_HUD);
+  frame->drawTextBox(173, 11, 33, 14, (tft.width() - textW) / 2 + 72, textH + ST7789_MIN_PADDING + 7, text, &FreeMono9pt7b, 0x0000, 0xef36);
 }
 
 uint8_t spawnEnemy(uint8_t direction, uint8_t type){
@@ -207,7 +169,6 @@ uint8_t spawnEnemy(uint8_t direction, uint8_t type){
       newEnemy.type = type;
       newEnemy.direction = direction;
       newEnemy.x = direction == DIR_RIGHT ? -30 : 230;
-      newEnemy.lastX = newEnemy.x;
       enemies[i] = newEnemy;
       return i;
     }
@@ -215,12 +176,12 @@ uint8_t spawnEnemy(uint8_t direction, uint8_t type){
   return 0;
 }
 
-void renderCharacter(){
+void updateCharacter(){
 
   // Handle controller movement
-  if(input.now() > controllerTimer){
+  if(gameLoop.now() > controllerTimer){
     // Move the character based on the speed
-    controllerTimer = input.now() + (150 / girl.speed);
+    controllerTimer = gameLoop.now() + (150 / girl.speed);
     
     #ifdef ATTACH_DEBUGGER
       // Just for debug and test
@@ -249,8 +210,6 @@ void renderCharacter(){
 
     // Go to left
     if(input.joystickReachedLeft() || input.pressedLeft()) {
-      // Last position to clear the character
-      girl.lastX = girl.x;
       // New position
       girl.x = girl.x > (nearestEnemyFromLeft + girl.steps) ? (girl.x - girl.steps) : nearestEnemyFromLeft;
       // Set direction to left
@@ -258,21 +217,20 @@ void renderCharacter(){
       // Re-draw the character
       girl.moving = true;
       // Go to idle after 100ms of stopping
-      idleTimer = input.now() + 100;
+      idleTimer = gameLoop.now() + 100;
     }
 
     // Go to right
     else if(input.joystickReachedRight() || input.pressedRight()) {
-      girl.lastX = girl.x;
       girl.x = (girl.x + 34) < (nearestEnemyFromRight - girl.steps) ? (girl.x + girl.steps) : (nearestEnemyFromRight - 34);
       girl.direction = DIR_RIGHT;
       girl.moving = true;
-      idleTimer = input.now() + 100;
+      idleTimer = gameLoop.now() + 100;
     }
 
     // Idle
     else{
-      if(input.now() > idleTimer){
+      if(gameLoop.now() > idleTimer){
         // girl.direction = girl.direction == DIR_LEFT ? DIR_IDLE2 : DIR_IDLE1;
         girl.moving = false;
       }
@@ -280,50 +238,32 @@ void renderCharacter(){
 
   }
 
-  if(input.now() > tickTimer){
-    // Re-draw the character based on its movement speed
-    tickTimer = input.now() + (150 / girl.speed);
-    
-    // Redraw character movement
+  if(gameLoop.now() > tickTimer){
+    // Advance the animation based on her movement speed
+    tickTimer = gameLoop.now() + (150 / girl.speed);
+
+    // Movement frame
     if(girl.moving){
-      // Clean the last position by filling with the background color
-      if(girl.direction == DIR_LEFT){
-        tft.fillRect(girl.x + 34, 137, 10, 65, bgColor);
-        tft.drawSprite(girl.x, 137, 34, 65, girl_walk_left[girl.positionIndex]);
-      }
-      else if(girl.direction == DIR_RIGHT){
-        tft.fillRect(girl.lastX, 137, 10, 65, bgColor);
-        tft.drawSprite(girl.x, 137, 34, 65, girl_walk_right[girl.positionIndex]);
-      }
+      girl.animation = &girlWalk;
+      girl.frame = girl.positionIndex;
     }
 
-    // Redraw character idle / attacking
+    // Idle / attacking frame
     else{
       if(girl.attacking){
         if(girl.positionIndex >= 3){
           girl.positionIndex = 0;
-          tickTimer = input.now() + (350 / girl.speed);
+          tickTimer = gameLoop.now() + (350 / girl.speed);
         }
-        tft.drawSprite(girl.x, 137, 34, 64, girl.direction == DIR_LEFT ? girl_attack_left[girl.positionIndex] : girl_attack_right[girl.positionIndex]);
+        girl.animation = &girlAttack;
+        girl.frame = girl.positionIndex;
       }
       else{
-        if(girl.direction == DIR_LEFT)
-          tft.drawSprite(girl.x, 137, 34, 65, girl_idle_2_bmp);
-        else if(girl.direction == DIR_RIGHT)
-          tft.drawSprite(girl.x, 137, 34, 65, girl_idle_1_bmp);
+        girl.animation = &girlIdle;
+        girl.frame = 0;
       }
     }
 
-    // Draw the character based on its movement direction
-    // if(girl.direction == DIR_LEFT)
-    //   tft.drawSprite(girl.x, 137, 34, 65, girl_walk_left[girl.positionIndex]);
-    // else if(girl.direction == DIR_RIGHT)
-    //   tft.drawSprite(girl.x, 137, 34, 65, girl_walk_right[girl.positionIndex]);
-    // else if(girl.direction == DIR_IDLE1)
-    //   tft.drawSprite(girl.x, 137, 34, 65, girl_idle_1_bmp);
-    // else if(girl.direction == DIR_IDLE2)
-    //   tft.drawSprite(girl.x, 137, 34, 65, girl_idle_2_bmp);
-
     girl.positionIndex++;
     
     // Only 10 different position for the character movement
@@ -333,52 +273,42 @@ void renderCharacter(){
   }
 }
 
-void renderEnemy(Enemy* e){
+void updateEnemy(Enemy* e){
 
-  if(input.now() > e->tick){
+  if(gameLoop.now() > e->tick){
   
-    e->tick = input.now() + (1750 / e->speed);
+    e->tick = gameLoop.now() + (1750 / e->speed);
 
-    // Draw enemy movement
+    // Movement frame
     if(e->moving){
-      if(e->direction == DIR_RIGHT)
-        tft.fillRect(e->lastX, 140, 10, 30, bgColor);
-      else
-        tft.fillRect(e->lastX + ZOMBIES_WIDTH, 140, 10, 30, bgColor);
-      tft.drawSprite(e->x, 127, 54, 75, e->direction == DIR_RIGHT ? zombie1_walk_right[e->positionIndex] : zombie1_walk_left[e->positionIndex]);
+      e->animation = &zombie1Walk;
+      e->frame = e->positionIndex;
     }
 
-    // Draw enemy attack
+    // Attack frame
     else if(e->attacking){
-      if(e->direction == DIR_RIGHT)
-        tft.fillRect(e->lastX, 140, 10, 30, bgColor);
-      else
-        tft.fillRect(e->lastX + ZOMBIES_WIDTH, 140, 10, 30, bgColor);
-      tft.drawSprite(e->x, 127, 54, 75, e->direction == DIR_RIGHT ? zombie1_attack_right[e->positionIndex] : zombie1_attack_left[e->positionIndex]);
+      e->animation = &zombie1Attack;
+      e->frame = e->positionIndex;
     }
 
-    // Draw enemy death
+    // Death frames, then the slot is freed
     else if(e->health == 0){
       if(e->positionIndex == 0){
-        tft.fillRect(e->lastX, 127, 54, 75, bgColor);
-        tft.drawSprite(e->x, 127, 42, 75, e->direction == DIR_RIGHT ? zombie1_die_right[0] : zombie1_die_left[0]);
+        e->animation = &zombie1Die;
+        e->frame = 0;
         e->positionIndex++;
       }
       else if(e->positionIndex == 1){
-        tft.fillRect(e->lastX, 127, 54, 75, bgColor);
-        tft.drawSprite(e->x, 127, 42, 75, e->direction == DIR_RIGHT ? zombie1_die_right[1] : zombie1_die_left[1]);
+        e->frame = 1;
         e->positionIndex++;
         e->tick += 1500;
       }
       else if(e->positionIndex == 2){
-        if(e->direction == DIR_LEFT){
-          tft.fillRect(e->x, 127, 54, 75, bgColor);
+        e->animation = nullptr;
+        if(e->direction == DIR_LEFT)
           nearestEnemyFromRight = tft.width();
-        }
-        else{
-          tft.fillRect(e->x, 127, 54, 75, bgColor);
+        else
           nearestEnemyFromLeft = 0;
-        }
         e->active = false;
       }
       return;
@@ -407,7 +337,6 @@ void renderEnemy(Enemy* e){
 
     // Didn't reach the girl
     if(shouldGo){
-      e->lastX = e->x;
       if(e->direction == DIR_RIGHT)
         e->x += e->steps;
       else
@@ -432,7 +361,7 @@ void renderEnemy(Enemy* e){
           e->attacking = false;
           e->positionIndex = 0;
           e->speed = 5;
-          updateScore();
+          scoreChanged = true;
         }
       }
       else{
@@ -466,12 +395,12 @@ void renderEnemy(Enemy* e){
 
 }
 
-void renderEnemies(){
+void updateEnemies(){
   uint8_t livingEnemiesCount = 0;
   for(int i = 0; i < MAX_ENEMIES; i++){
     if(!enemies[i].active)
       continue;
-    renderEnemy(&enemies[i]);
+    updateEnemy(&enemies[i]);
     livingEnemiesCount++;
   }
   if(livingEnemiesCount < livingEnemies){
@@ -481,26 +410,60 @@ void renderEnemies(){
 }
 
 void Game1Scene::enter() {
+  // Compose frames off-screen, or in bands when a framebuffer does not fit
+  if(!tft.enableFramebuffer())
+    tft.enableBandRenderer();
+
   // Draw the scene
-  tft.fillScreen(bgColor);
-  tft.drawSprite(0, 0, 240, 128, jungle_background_bmp);
-  tft.drawSprite(0, 202, 60, 38, grass_tile_left_bmp);
-  tft.drawSprite(60, 202, 60, 38, grass_tile_middle_bmp);
-  tft.drawSprite(120, 202, 60, 38, grass_tile_middle_bmp);
-  tft.drawSprite(180, 202, 60, 38, grass_tile_right_bmp);
+  frame = &renderer.acquire();
+  actors.clear();
+  actors.setList(*frame);
+  actors.setBackdrop(paintBackdrop);
+  actors.setRetained(tft.hasFramebuffer());   // Attack and death deltas need the previous frame
+  actors.invalidate(0, 0, tft.width(), tft.height());
   updateScore();
   updateHealth();
+  actors.commit();
+  renderer.submit(*frame);
   spawnEnemy(DIR_RIGHT, ENEMY_ZOMBIE1);
   spawnEnemy(DIR_LEFT, ENEMY_ZOMBIE1);
   spawnEnemy(DIR_LEFT, ENEMY_ZOMBIE1);
   nearestEnemyFromRight = tft.width();
 }
 
-void Game1Scene::update() {}
+// Gameplay runs on the fixed step of gameLoop, timers use gameLoop.now()
+void Game1Scene::update(float /*dt*/) {
+  updateEnemies();
+  updateCharacter();
+}
+
+// Places every actor at its current frame, unchanged sprites cost nothing
+void Game1Scene::render(float /*alpha*/) {
+  frame = &renderer.acquire();
+  actors.setList(*frame);
+
+  for(uint8_t i = 0; i < MAX_ENEMIES; i++){
+    Enemy& e = enemies[i];
+    if(e.active && e.animation)
+      e.animation->draw(actors, LAYER_ENEMY(i), e.frame, e.x + ZOMBIES_WIDTH / 2, GROUND_Y, e.direction == DIR_LEFT ? ST7789_FLIP_H : 0);
+    else
+      actors.hide(LAYER_ENEMY(i));
+  }
+
+  girl.animation->draw(actors, LAYER_GIRL, girl.frame, girl.x + GIRL_WIDTH / 2, GROUND_Y, girl.direction == DIR_LEFT ? ST7789_FLIP_H : 0);
+
+  if(scoreChanged){
+    updateScore();
+    scoreChanged = false;
+  }
 
-void Game1Scene::render() {
-  renderEnemies();
-  renderCharacter();
+  actors.commit();
+  renderer.submit(*frame);
 }
 
-void Game1Scene::exit() {}
\ No newline at end of file
+void Game1Scene::exit() {
+  // The next scene draws directly
+  renderer.sync();
+  tft.disableFramebuffer();
+  tft.disableBandRenderer();
+}
\ No newline at end of file
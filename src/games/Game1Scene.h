@@ -4,9 +4,10 @@
 class Game1Scene : public Scene {
 public:
   void enter() override;
-  void update() override;
-  void render() override;
+  void update(float dt) override;
+  void render(float alpha) override;
   void exit() override;
+  const char* name() const override { return "game1"; }
 };
 
 extern Game1Scene game1Scene;
\ No newline at end of file
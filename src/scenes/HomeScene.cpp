@@ -4,7 +4,7 @@
 #include "../engine/Globals.h"
 #include "../engine/Input.h"
 #include "../games/Game1Scene.h"
-#include "../sprites/icons.h"
+#include "sprites/icons.h"
 #include "../ST7789/fonts/f04b/f04B_30__9pt7b.h"
 #include "../ST7789/fonts/f04b/f04B_30__12pt7b.h"
 #include "../ST7789/fonts/f04b/f04B_30__18pt7b.h"
@@ -21,6 +21,18 @@ const uint16_t* icons[1] = {
   icon_school_girl_bmp
 };
 
+// DMA-capable copies of the icons while the scene is active, they are sent
+// to the panel without staging. nullptr when memory was short.
+uint16_t* loadedIcons[std::size(icons)];
+uint16_t* loadedFrame = nullptr;
+
+void drawIcon(const uint16_t* bitmap, const uint16_t* loaded) {
+  if(loaded)
+    tft.drawSpriteBE(70, 95, 100, 100, loaded);
+  else
+    tft.drawSprite(70, 95, 100, 100, bitmap);
+}
+
 void updateArrows() {
   tft.setFont(&f04B_30__18pt7b);
 
@@ -100,6 +112,10 @@ void HomeScene::enter() {
 
   tft.setBrightness(0);
   tft.fillScreen(ST7789_COLOR_CREAM);
+
+  for(size_t i = 0; i < std::size(icons); i++)
+    loadedIcons[i] = tft.loadSprite(icons[i], 100, 100);
+  loadedFrame = tft.loadSprite(icon_frame_bmp, 100, 100);
   
   tft.fillRect(0, 0, tft.width(), 50, ST7789_COLOR_PRIMARY);
   
@@ -121,7 +137,7 @@ void HomeScene::enter() {
 
 }
 
-void HomeScene::update() {
+void HomeScene::update(float /*dt*/) {
   if(input.now() > releaseDebounce){
     releaseDebounce = input.now() + 50;
     if(input.joystickReleased() && input.released())
@@ -148,15 +164,22 @@ void HomeScene::update() {
   }
 }
 
-void HomeScene::render() {
+void HomeScene::render(float /*alpha*/) {
   if(shouldUpdateSelection){
     updateArrows();
     if(selectedGame < std::size(icons))
-      tft.drawSprite(70, 95, 100, 100, icons[selectedGame]);
+      drawIcon(icons[selectedGame], loadedIcons[selectedGame]);
     else
-      tft.drawSprite(70, 95, 100, 100, icon_frame_bmp);
+      drawIcon(icon_frame_bmp, loadedFrame);
     shouldUpdateSelection = false;
   }
 }
 
-void HomeScene::exit() {}
\ No newline at end of file
+void HomeScene::exit() {
+  for(size_t i = 0; i < std::size(icons); i++){
+    tft.unloadSprite(loadedIcons[i]);
+    loadedIcons[i] = nullptr;
+  }
+  tft.unloadSprite(loadedFrame);
+  loadedFrame = nullptr;
+}
\ No newline at end of file
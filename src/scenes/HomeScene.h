@@ -4,9 +4,10 @@
 class HomeScene : public Scene {
 public:
   void enter() override;
-  void update() override;
-  void render() override;
+  void update(float dt) override;
+  void render(float alpha) override;
   void exit() override;
+  const char* name() const override { return "home"; }
 };
 
 extern HomeScene homeScene;
\ No newline at end of file
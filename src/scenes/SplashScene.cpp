@@ -8,7 +8,7 @@
 #include "../ST7789/fonts/f04b/f04B_30__9pt7b.h"
 #include "../ST7789/fonts/f04b/f04B_30__12pt7b.h"
 #include "../ST7789/fonts/f04b/f04B_30__18pt7b.h"
-#include "../sprites/red_guy_menu.h"
+#include "sprites/red_guy_menu.h"
 
 SplashScene splashScene;
 
@@ -43,14 +43,14 @@ void SplashScene::enter() {
 
 }
 
-void SplashScene::update() {
+void SplashScene::update(float /*dt*/) {
   if(!once){
     sceneManager.set(&homeScene);
     once = true;
   }
 }
 
-void SplashScene::render() {
+void SplashScene::render(float /*alpha*/) {
 }
 
 void SplashScene::exit() {}
\ No newline at end of file
@@ -4,9 +4,10 @@
 class SplashScene : public Scene {
 public:
   void enter() override;
-  void update() override;
-  void render() override;
+  void update(float dt) override;
+  void render(float alpha) override;
   void exit() override;
+  const char* name() const override { return "splash"; }
 };
 
 extern SplashScene splashScene;
\ No newline at end of file
@@ -1,434 +0,0 @@
-// Total bitmap data size: 13260 bytes
-
-// girl_attack_left_1.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_attack_left_1_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 
-0x6206, 0x49C5, 0x49C5, 0x49C5, 0x49C5, 0x41A5, 0x4184, 0x4185, 0x9B2A, 0xC40D, 0xA36B, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 
-0x6206, 0x3984, 0x838A, 0xCD6F, 0xBCEE, 0xB4CE, 0xC54F, 0xD5D0, 0xDE10, 0xC52E, 0x6287, 0x6A27, 0x41A5, 0x49C5, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6A47, 0x4A05, 0x8BCA, 0xC52F, 0xDDB0, 0xEE32, 0xDDB1, 0xD590, 0xDDB1, 0xF6B3, 0xFFD4, 0xFFF5, 0xC56E, 0x72E8, 0xBD0E, 0xC58F, 
-0x5A26, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6A27, 0x83AA, 0xF712, 0xFF33, 0xFE92, 0xBCEF, 0xB48E, 0xE5F1, 0xE631, 0xCD90, 0xBCEF, 0xD5F1, 0xFF12, 0xEE72, 0xC591, 
-0xF6B3, 0xFFF5, 0xCDCF, 0x5A26, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x6A27, 0x8349, 0xF692, 0xFF94, 0xFF13, 0xCD70, 0x938D, 0x72EA, 0xBCED, 0xFF73, 0xFF33, 0xCD70, 0xB48E, 0xCD4F, 
-0xA531, 0x9D33, 0xDE52, 0xFF33, 0xFFF5, 0x942B, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x41A5, 0xD5B0, 0xFED3, 0xEE51, 0xC52F, 0xAC2F, 0xBC91, 0x5A28, 0x6AE8, 0xF6D3, 0xFF13, 0xE611, 
-0xBCCF, 0x8C50, 0x53D0, 0x532E, 0xA42E, 0xDDB0, 0xFEF3, 0xCDAF, 0x5206, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x932A, 0x4185, 0xBCCF, 0xE612, 0xDDF0, 0x93AC, 0xA3F0, 0xFE36, 0xAC2E, 0x5A47, 0xAC8D, 
-0xF652, 0xEE31, 0xCD91, 0x6C31, 0x1A0C, 0x2108, 0x5A0A, 0x9BED, 0xD5B0, 0xFEB3, 0x8BAA, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x6A27, 0x59E6, 0x51A5, 0x6AC9, 0xC530, 0xB48E, 0x938D, 0xBC50, 0xE4F1, 0xD490, 
-0x59E7, 0x6AE8, 0xF672, 0xE5F1, 0xB4AF, 0x7C0F, 0x3A6C, 0x21AA, 0x4A2B, 0x7B0C, 0xB4AE, 0xEE52, 0x8BAA, 0x59E6, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x7248, 0x51E6, 0x5A27, 0x4985, 0x930A, 0x49C5, 0xB4AE, 0x9BEE, 0x934D, 0x8ACA, 
-0x4965, 0x71E7, 0x4944, 0x62C8, 0xEE52, 0xD590, 0x8B4C, 0x9BED, 0x9490, 0x432E, 0x322C, 0x72EC, 0xB46E, 0xE5F1, 0x8BAA, 0x59E6, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC0D, 0x6A27, 0x72A9, 0xD532, 0xC4B0, 0x59E6, 0xAB8B, 0x7AA8, 0x6AA8, 0x834C, 
-0x930C, 0x7A29, 0x30C5, 0x28E4, 0x20C3, 0x72E9, 0xD5B1, 0xBCCF, 0x832C, 0xA40D, 0xAC6D, 0x52CB, 0x3A2B, 0x7B0C, 0xB48E, 0xD5B1, 
-0x7B49, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x4164, 0xCCF1, 0xFEF9, 0xF5F5, 0x8B4C, 0x7248, 0xC40D, 
-0x6227, 0x6A68, 0xCC90, 0xC3AF, 0x81EA, 0x730D, 0x4228, 0x6AC8, 0xC530, 0x9C0D, 0x7B0B, 0xB48F, 0xA40C, 0x49C7, 0x4A0A, 0x834D, 
-0xBCAF, 0x93CB, 0x51E6, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4185, 0xB470, 0xFE36, 0xFE97, 0xD532, 
-0x4185, 0x930A, 0x6247, 0xBC6F, 0xFE15, 0xCC70, 0xA30C, 0xC4B2, 0x62CA, 0x5A87, 0xB4AF, 0x8B4C, 0x9BED, 0xC530, 0x836A, 0x4145, 
-0x4968, 0x830C, 0xC510, 0x6AE8, 0x5A06, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4985, 0xB44F, 0xFE97, 
-0xFE77, 0xA3EE, 0x6207, 0x7A88, 0x6268, 0xF615, 0xFE36, 0xDD53, 0xE553, 0xDD32, 0x7AEA, 0x6288, 0x936D, 0xA34D, 0xC4EF, 0x93EB, 
-0x3964, 0x30E5, 0x59E9, 0x8B6D, 0xD5B1, 0x8369, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49C6, 
-0xB490, 0xFE36, 0xA40E, 0x6207, 0xBBCC, 0x8AC9, 0x6268, 0xF5F5, 0xFE15, 0xEDD4, 0xF615, 0xF5F5, 0xCD12, 0x936D, 0x9AEB, 0xBBCD, 
-0x936B, 0x41C6, 0x4167, 0x4987, 0x51C7, 0x93CC, 0xDDB1, 0x9C2C, 0x51E6, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA34B, 0x3164, 0xB533, 0xAC91, 0x3124, 0xA36B, 0xC40D, 0x9B4B, 0x51E6, 0xC4D1, 0xFE15, 0xEDD4, 0xEDB4, 0xF5F5, 0xF615, 0xCC70, 
-0xC3AD, 0xB3AC, 0x4185, 0x3126, 0x72AC, 0x51C8, 0x3925, 0x832B, 0xC510, 0xD5B0, 0x6AE8, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA36B, 0x3944, 0x3185, 0x940F, 0x7B4C, 0x3103, 0xBBED, 0xC40D, 0xC40D, 0x6A47, 0x72C9, 0xFE56, 0xFE97, 0xFE56, 0xFE56, 
-0xED94, 0xC3EE, 0xCC0E, 0xB42E, 0x41A6, 0x3947, 0x72AC, 0x5A09, 0x3926, 0x5A29, 0xA44E, 0xDDD1, 0xACAD, 0x51E6, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x9B4B, 0x6A68, 0xA3CD, 0x5A48, 0x7B6C, 0xAC91, 0x41A6, 0x82A9, 0xC40D, 0xC40D, 0xAB6B, 0x51C6, 0x9BCD, 0xA40E, 
-0x9BCD, 0x9BCD, 0xB3CD, 0xBB8C, 0xDCB0, 0xCCF1, 0x49E7, 0x3947, 0x728C, 0x624B, 0x59E9, 0x4166, 0x6269, 0xAC4E, 0xC510, 0x6287, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0xAC2E, 0xED94, 0x5A68, 0x9490, 0xEED9, 0x730B, 0x3103, 0xBBCD, 0xC40D, 0xC40D, 0x9B2A, 
-0x51C6, 0x51C5, 0x6206, 0x6206, 0x5185, 0xB3AD, 0xF5B4, 0xBC4F, 0x4165, 0x3105, 0x622A, 0x6A6B, 0x6A6B, 0x4987, 0x3105, 0x834C, 
-0xAC4F, 0x49A7, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A27, 0xEDD5, 0xDD52, 0x5207, 0x9CD1, 0xFF7B, 0xACB1, 0x3965, 0x7A88, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x6A47, 0x5207, 0xCDB4, 0xEE36, 0x9B2B, 0x4903, 0x20C3, 0x49C8, 0x728C, 0x622A, 0x4987, 
-0x6229, 0x93CE, 0x72CB, 0x3104, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A28, 0xEDD4, 0xDD52, 0x5227, 0x9470, 0xFF5B, 0xE698, 0xACB1, 
-0x41A6, 0x59E6, 0x6A27, 0x6227, 0x7267, 0x7268, 0x5A27, 0x7B8C, 0xB573, 0xEF1A, 0xDE98, 0xB491, 0x7227, 0x38E3, 0x3945, 0x624B, 
-0x51C8, 0x4146, 0x7AEC, 0x72EB, 0x3924, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x92EA, 0x6248, 0xCCD1, 0xBC90, 0xACB1, 0xDE57, 
-0xEF1A, 0xDE37, 0x834C, 0x5248, 0x736C, 0x83CD, 0x7B8C, 0x736C, 0xB553, 0xF71A, 0xEEF9, 0xE6B8, 0xEEF9, 0xD637, 0x9B4C, 0x4903, 
-0x20C3, 0x5209, 0x51E8, 0x20C3, 0x2904, 0x3924, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x6248, 0xC4B1, 
-0xBCB1, 0xCDF6, 0xF73A, 0xDE78, 0xD5D5, 0xE657, 0xFF7B, 0xFF9C, 0xFF5B, 0xF73A, 0xF71A, 0xEEF9, 0xE6B8, 0xDE57, 0xE6D9, 0xDE57, 
-0x9B6C, 0x4903, 0x28C3, 0x5A09, 0x51E9, 0x28E3, 0x6A27, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x4165, 0x5248, 0xB533, 0xF71A, 0xE698, 0xD657, 0xCE36, 0xD636, 0xD657, 0xDE98, 0xEED9, 0xEEB8, 0xE698, 0xD636, 0xC594, 
-0xDE98, 0xDE37, 0x932B, 0x4903, 0x28C3, 0x5A09, 0x51E9, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x7268, 0x5A48, 0x9C0F, 0x93EE, 0x62CA, 0x5268, 0x4A07, 0x39A6, 0x62CA, 0x940F, 0x940F, 0x9C50, 
-0xAC91, 0xB513, 0xC5B5, 0xA42F, 0x7A48, 0x5144, 0x28C3, 0x5A2A, 0x5A09, 0x3944, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x3103, 0x2904, 0x3985, 0x5A28, 0x3144, 0x0000, 0x1021, 0x1882, 
-0x1882, 0x49C7, 0x7AEB, 0x6A8A, 0x6209, 0x61A6, 0x7A07, 0x59A5, 0x20C3, 0x51E9, 0x49C8, 0x51A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x7A88, 0x4185, 0x5A48, 0x49E7, 0x3924, 
-0x5125, 0x2862, 0x1822, 0x4105, 0x5187, 0x38A4, 0x2002, 0x38A4, 0x69E7, 0x5185, 0x3945, 0x49A8, 0x3945, 0x9B2A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x7A88, 
-0x3124, 0x3903, 0x61A6, 0x5946, 0x5966, 0x61A6, 0x61A6, 0x61A6, 0x4925, 0x4925, 0x5985, 0x3924, 0x51E8, 0x41A7, 0x51C6, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x7268, 0x28A3, 0x61A6, 0x7207, 0x7A27, 0x7227, 0x7227, 0x7207, 0x7207, 0x4964, 0x3104, 0x3125, 0x51A6, 
-0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x3904, 0x7207, 0x7A27, 0x7207, 0x7207, 0x7207, 0x8268, 0x7227, 0x3923, 0x6A47, 
-0x7268, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x3103, 0x7207, 0x7A27, 0x7207, 0x7207, 0x7207, 0x7207, 0x69C7, 0x4124, 
-0x51A5, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x3103, 0x7A27, 0x7A27, 0x7207, 0x7207, 0x7207, 0x61A6, 
-0x38C4, 0x1882, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x3103, 0x7207, 0x7A27, 0x7207, 0x7207, 
-0x7207, 0x5986, 0x4925, 0x30E3, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x30E3, 0x7227, 0x7A27, 
-0x7207, 0x7207, 0x7207, 0x7207, 0x7A48, 0x69E7, 0x30E3, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x20A3, 
-0x59C7, 0x7A27, 0x7227, 0x7207, 0x7207, 0x7227, 0x7A47, 0x7A27, 0x4944, 0x59E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 
-0x3944, 0x10C5, 0x2926, 0x4167, 0x59C7, 0x7207, 0x7207, 0x7207, 0x6A07, 0x51C7, 0x4167, 0x20C4, 0x51C6, 0xBBCD, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x8AE9, 0x1082, 0x20E5, 0x18E5, 0x18E6, 0x2926, 0x4166, 0x4166, 0x4166, 0x3966, 0x2106, 0x1906, 0x2127, 0x18A3, 0x59E6, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x18A3, 0x18C5, 0x18C5, 0x2106, 0x2106, 0x10C5, 0x10C5, 0x1906, 0x18E6, 0x18C5, 0x20E5, 0x2947, 
-0x2106, 0x20C3, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3124, 0x18E5, 0x18C5, 0x18C4, 0x2106, 0x2106, 0x10A4, 0x18C4, 0x2127, 0x2106, 0x18A4, 
-0x18E5, 0x2127, 0x2106, 0x18A4, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x10A3, 0x2106, 0x18A4, 0x18C5, 0x2126, 0x18E5, 0x1083, 0x18E5, 0x2127, 
-0x2106, 0x18A4, 0x18E5, 0x2126, 0x2927, 0x20E5, 0x20C3, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x7AA8, 0x2904, 0x2106, 0x18C5, 0x10A4, 0x2106, 0x2106, 0x10A4, 0x18A4, 
-0x2106, 0x2126, 0x20E5, 0x18C4, 0x20E5, 0x2106, 0x2106, 0x2126, 0x18A4, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x3103, 0x1083, 0x2106, 0x20E6, 0x18A4, 0x18C5, 0x2127, 0x18E5, 
-0x1083, 0x18E5, 0x2127, 0x2106, 0x18C5, 0x18E5, 0x2106, 0x2106, 0x2106, 0x2927, 0x20E5, 0x28E3, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x20E3, 0x20E5, 0x2127, 0x18E5, 0x1083, 0x10A4, 0x2106, 
-0x2106, 0x10A4, 0x18A4, 0x2126, 0x2127, 0x18E5, 0x10A4, 0x18E5, 0x2127, 0x2106, 0x2106, 0x2126, 0x2927, 0x18A4, 0x51A5, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4185, 0x18E5, 0x2127, 0x18A4, 0x1083, 
-0x18E5, 0x2106, 0x18C4, 0x10A4, 0x20E5, 0x2106, 0x18C5, 0x10A4, 0x10A4, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E5, 0x2106, 0x18C5, 
-0x3944, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x51C6, 0x1082, 
-0x1083, 0x18C5, 0x2927, 0x18E5, 0x1083, 0x18C5, 0x2106, 0x1084, 0x0022, 0x0883, 0x18E5, 0x2106, 0x20E6, 0x2127, 0x20E5, 0x1083, 
-0x18C4, 0x18C4, 0x3944, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB3AC, 0x6A47, 0x3124, 0x18C4, 0x2947, 0x18C5, 0x0841, 0x10A4, 0x2106, 0x4187, 0x59E7, 0x3146, 0x10C6, 0x18E6, 0x2106, 0x2106, 
-0x28E4, 0x3123, 0x1062, 0x18A3, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4985, 0x10A3, 0x28E4, 0x6A27, 0x3944, 0x4186, 0xAB6C, 0xC3CD, 0x8ACB, 0x6229, 0x7269, 
-0x726A, 0x4167, 0x3104, 0x9B2A, 0x7268, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x6A27, 0x930A, 0xC40D, 0x6A47, 0x6A27, 0xE4F1, 0xE512, 0xCC2F, 
-0xC3CD, 0xC3CD, 0x92CB, 0x4125, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x61E6, 0xE532, 
-0xF615, 0xE573, 0xDCF1, 0xCC0F, 0x69C9, 0x20A3, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0x51A5, 0xA3EE, 0xFE16, 0xF5F5, 0xFE35, 0xE553, 0x7229, 0x28C3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6A27, 0x7B0B, 0xFE36, 0xF5D5, 0xFE36, 0xD533, 0x51C7, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x8B6C, 0xFE36, 0xFE15, 0xEDB4, 0x8AEC, 0x28C3, 0xB3CC, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x8B4B, 0xFE56, 0xFE36, 0xED94, 0x82CC, 0x2062, 0x930A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x6207, 0xD4D1, 0xF5D4, 0xF5D4, 0xD4D1, 0x728A, 0x49A6, 
-0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51A5, 0x7A48, 0xED32, 0xFE77, 0xE5D5, 
-0xC554, 0x9470, 0x49E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x7268, 0xEDF5, 
-0xFF9B, 0xDEB8, 0xC5B5, 0xCE36, 0x6B4C, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 
-0x8BEE, 0xFF7B, 0xFFFE, 0xEF3B, 0xB4F2, 0xE698, 0xC616, 0x49A6, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x59C6, 0x8C2F, 0xFFFD, 0xEF5B, 0xAD33, 0xACD1, 0xFF7B, 0xCE57, 0x4185, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x8C0E, 0xFFFE, 0xDED9, 0x4207, 0x5269, 0xEEF9, 0xEEF9, 0x6B0B, 0x7AA8, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x83CD, 0xFFFE, 0xEF5B, 0x39C6, 0x3924, 0x7B4B, 0xFF9B, 0xCE16, 0x41A5, 0xBBCD, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x8C0F, 0xFFFE, 0xEF3A, 0x5A89, 0x82A9, 0x49C6, 0xCE16, 0xFFDD, 
-0x83CE, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x62A9, 0xEF1A, 0xFFFE, 0x9470, 0x6A48, 0xC40D, 0x8AC9, 
-0x6B0B, 0xF79C, 0xCE36, 0x41A5, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x4A28, 0xDED9, 0xEF3A, 0x4A27, 0xA36B, 
-0xC40D, 0xAB8C, 0x28E3, 0x5AAA, 0x5289, 0x1082, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0xBBED, 0x7A88, 0x20A2, 0x1882, 0x4A07, 0x62EA, 
-0x2924, 0x930A, 0xBBCD, 0x49A5, 0x0020, 0x0000, 0x0000, 0x0841, 0x3944, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x3103, 0x2903, 0x20A2, 0x2103, 0x2903, 
-0x18A2, 0x1040, 0x0840, 0x28E3, 0x28E3, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x4164, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2B, 0x20C2, 0x20C2, 0x20C2, 0x20E3, 
-0x2903, 0x2903, 0x2903, 0x20E3, 0x1061, 0x0020, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0841, 0x4165, 0xBBED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_attack_left_2.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_attack_left_2_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x7288, 
-0x49C5, 0x49C5, 0x49C5, 0x49C5, 0x41A5, 0x41A5, 0x4184, 0x7268, 0xC40D, 0xB3AC, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 
-0x3944, 0x6287, 0xBCEE, 0xC54F, 0xB4AE, 0xC50E, 0xD5AF, 0xDDF0, 0xD5D0, 0x7B49, 0x6A47, 0x49A5, 0x41A5, 0x82C9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x92EA, 
-0x7A88, 0x7328, 0xC52F, 0xD590, 0xE611, 0xE5F1, 0xD590, 0xD591, 0xEE52, 0xFF74, 0xFFF5, 0xEEB1, 0x8349, 0x93EB, 0xDE31, 0x7328, 
-0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 
-0x51E6, 0x5207, 0x5A47, 0xA48C, 0xFED2, 0xDDD1, 0xAC6E, 0xD570, 0xE631, 0xDDF1, 0xBD0F, 0xCD70, 0xF6D2, 0xFED2, 0xCDB1, 0xDE12, 
-0xFFD5, 0xEF12, 0x6B08, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0xA40E, 0xFEB8, 0xB44F, 0x6AC8, 0xB4CD, 0xC4F0, 0x72CB, 0x93EC, 0xF6B2, 0xFF94, 0xDE11, 0xB4AE, 0xC50F, 0xBD51, 
-0x8D12, 0xC5F2, 0xFEF2, 0xFFF5, 0xD5F0, 0x4184, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x82C9, 0x5A48, 0xDD73, 0xFF19, 0xBC90, 0x4185, 0x6AC9, 0xDD53, 0x830B, 0x4A06, 0xCD8F, 0xFF53, 0xF692, 0xCD2F, 
-0x9C6F, 0x6411, 0x432F, 0x83AD, 0xD54F, 0xF6B2, 0xEE92, 0x7308, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xA3EE, 0xFE56, 0xFE56, 0xC4D0, 0x28E4, 0x5A09, 0xFE36, 0xDD73, 0x6268, 0x838A, 0xE611, 
-0xF651, 0xE5F1, 0x8CD1, 0x32CE, 0x1929, 0x4189, 0x8B4C, 0xC50F, 0xFEB3, 0xC52E, 0x4185, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4985, 0xAC2F, 0xFE97, 0xFE77, 0xB44F, 0x4186, 0x8B2C, 0xDCF1, 0xED32, 0x82AA, 
-0x49E6, 0xCD4F, 0xF672, 0xC52F, 0x942F, 0x532E, 0x21AA, 0x3A0B, 0x6AAC, 0x9BCD, 0xE612, 0xBCEE, 0x41A5, 0xB3AC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x6B0A, 0xD5F5, 0xFE77, 0xE573, 0x6AAA, 0x6228, 0x9B4C, 0x59C6, 
-0x61C6, 0x5985, 0x49C6, 0xC52F, 0xEE52, 0x9BED, 0x8B4C, 0xA4AF, 0x5BAF, 0x324C, 0x5A8B, 0x9BCD, 0xDDB1, 0xBCEE, 0x41A5, 0xABAC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xC40D, 0x51A5, 0x8C2F, 0xD616, 0x9BEE, 0x6A88, 0x41C6, 0x82CB, 
-0x92EB, 0x4106, 0x28C5, 0x20A2, 0x49E6, 0xBCEF, 0xD590, 0x8B8C, 0x8B6C, 0xBCCE, 0x6B4B, 0x322B, 0x62AC, 0xA3ED, 0xD591, 0xAC6D, 
-0x49C5, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x4985, 0x82A9, 0x59E6, 0x7B6C, 0x9C0F, 0x3965, 0x51A5, 
-0x5A07, 0xB42E, 0xD450, 0x922B, 0x7AAD, 0x4A8A, 0x4A26, 0xAC8E, 0xB4AF, 0x7B2C, 0x9BCD, 0xBCCE, 0x6268, 0x41A8, 0x72EC, 0xAC4E, 
-0xAC8E, 0x5226, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA8, 0x72CA, 0xBC6F, 0x5A27, 0x6B0B, 0xCDD5, 0x93EE, 
-0x1882, 0x3103, 0x936C, 0xF5F4, 0xE553, 0xA2EC, 0xC451, 0x8BAD, 0x4A06, 0xA42D, 0x9BCD, 0x938C, 0xBCEF, 0xA44D, 0x49C6, 0x4127, 
-0x6A6B, 0xB48F, 0x9C2C, 0x3944, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A27, 0xEDD5, 0xFE56, 0x72CA, 0x8C0F, 
-0xFF7B, 0x9C50, 0x0820, 0x1882, 0xCD12, 0xFE97, 0xE593, 0xDD32, 0xED93, 0x9BAD, 0x5A67, 0x834C, 0x932C, 0xBC6F, 0xACAE, 0x5226, 
-0x28E4, 0x4988, 0x72CB, 0xC510, 0xB4CD, 0x4184, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72CA, 0xFE97, 0xF615, 
-0x6248, 0x736C, 0xF71A, 0x9C50, 0x0821, 0x1882, 0xCCF1, 0xFE56, 0xEDB4, 0xF615, 0xF615, 0xE593, 0xA40F, 0x8AEB, 0xB36C, 0xABCC, 
-0x5247, 0x3946, 0x4988, 0x4987, 0x7AEA, 0xCD50, 0xC52F, 0x5A26, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 
-0xFE77, 0xD512, 0x62A9, 0x9C90, 0xF71A, 0x9C2F, 0x1061, 0x3103, 0x9BCD, 0xF5F5, 0xF5D5, 0xEDB4, 0xEDB4, 0xFE36, 0xDD32, 0xBB8D, 
-0xC3EE, 0x6A47, 0x28E4, 0x624B, 0x624A, 0x3905, 0x6248, 0xB48F, 0xDDB1, 0x9C2C, 0x51A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6248, 0xD4F1, 0x7B0A, 0x734C, 0xE6D9, 0xE6B8, 0x9C2F, 0x3945, 0x51A5, 0x4185, 0xDD32, 0xFEB8, 0xFE36, 0xFE36, 0xF5D5, 
-0xD490, 0xC3AD, 0xD490, 0x6289, 0x28E5, 0x6A8B, 0x624A, 0x4146, 0x4187, 0x8B6C, 0xD591, 0xCD6F, 0x6287, 0x8AE9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x7B0B, 0x6AA9, 0x7BAD, 0xFF5B, 0xE698, 0xC554, 0x93EE, 0x41A6, 0x20C3, 0x72A9, 0x936C, 0x8B2B, 
-0x832B, 0x9B4B, 0xB34C, 0xCC0E, 0xED73, 0x72EA, 0x2905, 0x6A6B, 0x6A6B, 0x622A, 0x4187, 0x51C8, 0x93AC, 0xCD30, 0x8BAB, 0x4185, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7248, 0x6B2B, 0x6B2C, 0x7B6C, 0xF73A, 0xEED9, 0xEED9, 0xE698, 0xC574, 0x9C2F, 0x6B0B, 
-0x5269, 0x5A89, 0x5269, 0x7B4C, 0xC470, 0xED52, 0xDD12, 0x6A68, 0x28E3, 0x51E9, 0x6A6B, 0x6A8B, 0x5A09, 0x30E5, 0x6249, 0xB470, 
-0x72CA, 0x28C3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x5A48, 0x7BAD, 0x6B0B, 0x734C, 0xBD94, 0xF73A, 0xEEF9, 0xF71A, 
-0xEEF9, 0xE698, 0xD657, 0xD657, 0xD657, 0xDE78, 0xE698, 0xEE77, 0xB42F, 0x69A6, 0x28A2, 0x3146, 0x728C, 0x624A, 0x49A8, 0x49A7, 
-0x8B4C, 0x8B6D, 0x3945, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x83CE, 0xB533, 0x49E7, 0x5228, 0x6B2B, 
-0x62EA, 0x734C, 0xA491, 0xCDD5, 0xEEF9, 0xF73A, 0xEEF9, 0xE6D9, 0xE6B9, 0xE6D9, 0xAC4F, 0x69C6, 0x4924, 0x3104, 0x5A09, 0x622A, 
-0x3946, 0x624A, 0x8B4D, 0x4186, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x5227, 0xCDD5, 0xDE37, 
-0x62AA, 0x2904, 0x3965, 0x3965, 0x2904, 0x5228, 0xA470, 0xBD33, 0xACD2, 0xA491, 0xC594, 0xEEF9, 0xACB1, 0x71E6, 0x69C6, 0x28E3, 
-0x3967, 0x624A, 0x2904, 0x28E4, 0x3105, 0x7248, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 
-0x7BAD, 0xFFBC, 0xD5F6, 0x9C0F, 0xBD33, 0xBD54, 0x62AA, 0x3124, 0x20E3, 0x4186, 0x7B0B, 0xA450, 0xD637, 0xF73A, 0xAC70, 0x71E6, 
-0x69C6, 0x30E3, 0x4187, 0x624B, 0x20E3, 0x51A5, 0x930A, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8B, 0x5207, 0xACF2, 0xF71A, 0xDE57, 0xEED9, 0xEED9, 0x940F, 0x3945, 0x1001, 0x1821, 0x6A6A, 0xC595, 0xE6D9, 0xBD33, 
-0x82CA, 0x7207, 0x69C6, 0x30E3, 0x4187, 0x624B, 0x3104, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4185, 0xBD74, 0xF71A, 0xBD33, 0x836D, 0x41A6, 0x3903, 0x69C6, 0x5125, 0x4926, 0x6A8A, 
-0x72AB, 0x5167, 0x5125, 0x7207, 0x7207, 0x28C2, 0x3987, 0x6A6B, 0x2904, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x5A89, 0x940F, 0x49C6, 0x1081, 0x1061, 0x69E6, 0x8A89, 0x5986, 
-0x48E4, 0x5104, 0x40C4, 0x2823, 0x3084, 0x61A6, 0x69E6, 0x30E3, 0x41A7, 0x5A2A, 0x3924, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4985, 0x28E3, 0x82C9, 0x9B4B, 0x3944, 0x5185, 
-0x61A6, 0x5146, 0x69C7, 0x7A27, 0x7207, 0x5145, 0x40C4, 0x5165, 0x4124, 0x3966, 0x624B, 0x3145, 0x7247, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0xA36B, 0xC40D, 0xC40D, 
-0xA36B, 0x28C3, 0x4925, 0x69E7, 0x7227, 0x7207, 0x7227, 0x7207, 0x69E7, 0x69E7, 0x30E3, 0x4187, 0x624A, 0x3104, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x930A, 0x3103, 0x61C6, 0x7A28, 0x7207, 0x7207, 0x7207, 0x7227, 0x7A48, 0x61E6, 0x3924, 0x2905, 0x3945, 0x8AEA, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x3944, 0x59A6, 0x7A48, 0x7207, 0x7207, 0x7207, 0x7207, 0x7A27, 0x7A48, 0x4124, 0x59C6, 0x7A88, 
-0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB6B, 0x30E3, 0x61C6, 0x7A48, 0x7207, 0x7207, 0x7207, 0x7227, 0x69E7, 0x5185, 0x3924, 
-0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3123, 0x61C6, 0x7A28, 0x7207, 0x7207, 0x7207, 0x69E7, 0x4905, 
-0x1842, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3123, 0x61C6, 0x7A28, 0x7207, 0x7207, 0x7227, 
-0x61C6, 0x5146, 0x4104, 0x4985, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3923, 0x61C6, 0x7A28, 0x7207, 
-0x7207, 0x7207, 0x7207, 0x7A27, 0x8248, 0x3923, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x3923, 0x61C6, 
-0x8248, 0x7207, 0x7207, 0x7207, 0x7207, 0x7A27, 0x7A48, 0x4165, 0x3104, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 
-0x28E3, 0x4166, 0x7208, 0x7207, 0x7207, 0x7207, 0x59C7, 0x4167, 0x4187, 0x3147, 0x18E5, 0x3104, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBCD, 0x51C6, 0x10A4, 0x2106, 0x3967, 0x4166, 0x3966, 0x4166, 0x3126, 0x18E6, 0x18E6, 0x2127, 0x2127, 0x1083, 0x7268, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xB3AC, 
-0xBBED, 0xB3AC, 0x51C6, 0x18A4, 0x2127, 0x2126, 0x1906, 0x18C5, 0x10A5, 0x18E6, 0x2106, 0x18E5, 0x18C5, 0x2106, 0x2127, 0x18E5, 
-0x3104, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7247, 0x28E3, 0x3124, 0x3103, 0x18C4, 0x2927, 0x2927, 0x2106, 0x2106, 0x18C5, 0x18A4, 0x2106, 0x2127, 0x18C4, 0x18C4, 0x2106, 
-0x2927, 0x2127, 0x1083, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x4985, 0x1083, 0x20E5, 0x20E5, 0x2106, 0x2126, 0x2106, 0x2126, 0x20E6, 0x18C4, 0x20E5, 0x2106, 0x2106, 0x18C5, 
-0x18C5, 0x2106, 0x2106, 0x2126, 0x18E5, 0x3103, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x18C5, 0x2948, 0x2127, 0x18E5, 0x18A4, 0x20E5, 0x2927, 0x18C5, 0x18A4, 0x2106, 0x2127, 
-0x18E5, 0x18C4, 0x2106, 0x2106, 0x2106, 0x2927, 0x2127, 0x10A3, 0x7248, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x18A3, 0x2106, 0x18C5, 0x1083, 0x18A4, 0x2106, 0x18E5, 0x1083, 0x18C4, 
-0x2106, 0x2106, 0x18A4, 0x18A4, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18E5, 0x28E3, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6A27, 0x18A3, 0x18A4, 0x18A4, 0x20E6, 0x18E5, 0x1083, 
-0x18A4, 0x2106, 0x2106, 0x18C5, 0x1083, 0x18C5, 0x2106, 0x2106, 0x2126, 0x2106, 0x18E5, 0x18E5, 0x18A3, 0x930A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3924, 0x18C5, 0x2927, 0x2106, 
-0x18A4, 0x10A4, 0x2106, 0x2106, 0x18C4, 0x0863, 0x18A4, 0x2106, 0x2106, 0x2106, 0x18E5, 0x18C5, 0x18E5, 0x18E5, 0x18A3, 0x930A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x18A3, 
-0x2927, 0x2106, 0x1083, 0x10A4, 0x18E6, 0x10A5, 0x0042, 0x0842, 0x18C5, 0x2106, 0x2106, 0x18E6, 0x0884, 0x0863, 0x2106, 0x2126, 
-0x1882, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7268, 0x18A3, 0x0862, 0x1882, 0x51C7, 0x6A4A, 0x6208, 0x61E7, 0x4186, 0x18E6, 0x10C6, 0x18E6, 0x41A8, 0x6208, 0x28E4, 
-0x18C5, 0x18C5, 0x4985, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x4985, 0x28E3, 0xA34B, 0xED12, 0xD490, 0xCBED, 0xA32B, 0x7269, 0x51A8, 0x51A8, 0xA32C, 
-0xCBCD, 0x5185, 0x0021, 0x4985, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x4164, 0xCC90, 0xFE76, 0xEDB4, 0xDD12, 0xD490, 0xAB4C, 0x8A8B, 
-0xAB2C, 0xDCB0, 0xE512, 0x5A07, 0x4985, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x49A5, 0xC4F1, 0xFE56, 0xEDD4, 0xF5F5, 0xEDD4, 
-0xA36E, 0x826A, 0xCC2F, 0xFDF5, 0xF615, 0x6268, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x6A89, 0xDD73, 0xFE15, 
-0xEDD4, 0xFE36, 0xBC30, 0x8A6A, 0xCC90, 0xFE56, 0xF5F5, 0x6268, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x4165, 
-0xCCF1, 0xFE56, 0xEDD4, 0xEDD5, 0xA3AE, 0x7A4A, 0xCC90, 0xFE36, 0xEDD4, 0x5207, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA36B, 0x49A5, 0xD512, 0xFE56, 0xF615, 0xC491, 0x4146, 0x59A6, 0xDCF1, 0xFE56, 0xEDD5, 0x6AA9, 0x7268, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xA34B, 0x4185, 0xD512, 0xFE56, 0xF615, 0xC471, 0x30C4, 0x30E3, 0xBC2E, 0xF5F5, 0xFE36, 0xCCF1, 0x51E7, 0x9B2A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4985, 0x9B4B, 0xED93, 0xF5F5, 0xF5B4, 0x7ACA, 0x0000, 0x6A27, 0xE4D1, 0xFDF5, 0xF5D4, 
-0x51C6, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x4124, 0xBBCD, 0xFDF5, 0xFEF9, 0x93EE, 0x1881, 0x3903, 0xB3CD, 
-0xF615, 0xF677, 0x7B4C, 0x6A48, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3924, 0xB42F, 0xFEF9, 0xFFFD, 0x9491, 0x59E6, 
-0x59E6, 0x83AD, 0xFF5B, 0xFFDD, 0xDED9, 0x5268, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x41C6, 0xCE16, 0xFFDD, 0xFFFF, 
-0xA512, 0x6207, 0x9B2A, 0x5A89, 0xCDF6, 0xFFFE, 0xF79C, 0x5AA9, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x49E6, 0xD657, 
-0xFFFF, 0xDED9, 0x6AEA, 0x8AE9, 0xC40D, 0x6206, 0x83CE, 0xFFDE, 0xEF5B, 0x5289, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 
-0x49C6, 0xD637, 0xFFFF, 0x9CD2, 0x51C6, 0xC40D, 0xC40D, 0x59E6, 0x83AD, 0xFFDD, 0xEF3A, 0x5268, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA36B, 0x41A5, 0xCE16, 0xFFFF, 0xA4F2, 0x49A5, 0xC40D, 0xC40D, 0x930A, 0x5A48, 0xCE16, 0xEF1A, 0x5269, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x4A07, 0xD637, 0xFFFF, 0xA512, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x8C0E, 0xFFDD, 0xA512, 
-0x5A27, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6207, 0x9C91, 0xFFFE, 0xE6D9, 0x5A89, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x8C2F, 
-0xFFFF, 0xEF5B, 0x5268, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x20C2, 0x8C2F, 0xFFBD, 0xA512, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 
-0x1882, 0x8C4F, 0xFFFF, 0xF7BC, 0x5269, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xBBCD, 0xAB8C, 0x49A5, 0x1041, 0x2903, 0x62EA, 0x4A28, 0x4164, 0xB3CC, 0xC40D, 
-0x7A88, 0x1041, 0x0000, 0x39C6, 0xC616, 0xE6D9, 0x4A28, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x51A5, 0x28E3, 0x28E3, 0x18C2, 0x2903, 0x20C2, 0x1061, 0x0840, 0x1061, 
-0x3103, 0x3123, 0x1081, 0x1061, 0x0841, 0x0000, 0x2944, 0x4207, 0x20E3, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x1882, 0x20C2, 0x20C2, 0x2903, 0x2903, 0x20E3, 0x2903, 
-0x18A2, 0x0820, 0x0841, 0x0841, 0x0841, 0x1061, 0x1061, 0x0841, 0x0000, 0x0000, 0x1061, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_attack_left_3.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_attack_left_3_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x9B2B, 
-0x5A06, 0x49C5, 0x49C5, 0x49C5, 0x49C5, 0x41A5, 0x4184, 0x49A5, 0xAB6B, 0xC40D, 0xA34B, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 
-0x59E6, 0x4184, 0x8BCB, 0xCD6F, 0xB4CE, 0xBCCE, 0xCD6F, 0xD5D0, 0xDE11, 0xB50D, 0x6267, 0x6227, 0x41A5, 0x51E6, 0xB3CC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x930A, 
-0x930A, 0x6247, 0xA44C, 0xCD70, 0xDDB1, 0xEE32, 0xDDB1, 0xD590, 0xDDD1, 0xF6D3, 0xFFD5, 0xFFD5, 0xB4ED, 0x72E8, 0xC56F, 0xB54E, 
-0x5A06, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x6A47, 0x5207, 0x5207, 0x7309, 0xD5F0, 0xFEB3, 0xBCCF, 0xB4AF, 0xE611, 0xE631, 0xCD70, 0xBD0F, 0xDE31, 0xFF33, 0xE652, 0xC591, 
-0xF6F3, 0xFFF5, 0xB54E, 0x5A06, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x51E6, 0xEDB4, 0xF636, 0x7B0A, 0x8389, 0xCD70, 0x938D, 0x7AEA, 0xC52E, 0xFF94, 0xF712, 0xC52F, 0xBCAE, 0xCD4F, 
-0x9D32, 0x9D52, 0xE672, 0xFF53, 0xFFB4, 0x7B89, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBCC, 0x59E6, 0x9BAD, 0xFE77, 0xFE97, 0x72CA, 0x3985, 0xB470, 0xBC91, 0x5207, 0x7B49, 0xFF13, 0xFEF2, 0xE5F0, 
-0xB4AF, 0x8450, 0x4BB0, 0x5B2E, 0xAC6E, 0xE5F0, 0xFF13, 0xBD2E, 0x51E6, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x51C6, 0xE594, 0xFE56, 0xFE15, 0x72CA, 0x18A3, 0xB451, 0xFE77, 0x9BAD, 0x5A67, 0xBCEE, 
-0xF672, 0xEE11, 0xC591, 0x6410, 0x19EB, 0x2108, 0x622A, 0xA40D, 0xE5F1, 0xF692, 0x7329, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x5207, 0xEDD4, 0xFE97, 0xF5F5, 0x6AA9, 0x49C7, 0xC470, 0xED32, 0xC44F, 
-0x49C6, 0x7B49, 0xF692, 0xDDD0, 0xAC8F, 0x7BEF, 0x324C, 0x29AA, 0x4A4B, 0x832C, 0xC4EF, 0xEE32, 0x7328, 0x6A27, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x5A07, 0x9C90, 0xF677, 0xFE36, 0xB44F, 0x49E7, 0x82EB, 0x82C9, 
-0x4965, 0x71E7, 0x4144, 0x7329, 0xF672, 0xCD4F, 0x832C, 0xA40E, 0x8C70, 0x3AEE, 0x3A2B, 0x7B0C, 0xBCAF, 0xE5F1, 0x7B49, 0x6A27, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xC40D, 0x9B2A, 0x49E7, 0xC595, 0xC533, 0x832B, 0x5206, 0x5A28, 
-0x9B2C, 0x7208, 0x28A4, 0x28C4, 0x20E3, 0x7B4A, 0xDDD1, 0xB48E, 0x7B0C, 0xAC4E, 0xA44D, 0x4AAB, 0x3A2B, 0x832C, 0xBCCF, 0xD590, 
-0x6AE8, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x49A5, 0x6207, 0x7A88, 0x5207, 0xA430, 0x6ACA, 0x3944, 
-0x51A5, 0x82EA, 0xD490, 0xBB4E, 0x820B, 0x6B0D, 0x4227, 0x7B09, 0xC530, 0x93CD, 0x7B0C, 0xB4AF, 0x9BCB, 0x41A7, 0x522A, 0x8B8D, 
-0xBCCF, 0x836A, 0x59E6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x6207, 0xAC2E, 0x8B6C, 0x5207, 0x9C70, 0xCD94, 
-0x5228, 0x20A2, 0x51E6, 0xCCD1, 0xFE15, 0xC40F, 0xAB2D, 0xBC91, 0x5A89, 0x6AC8, 0xB48F, 0x834C, 0xA40E, 0xC510, 0x7B09, 0x3945, 
-0x51A9, 0x8B4D, 0xC50F, 0x5A67, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x9BCD, 0xFEF9, 0xBC90, 0x5A89, 
-0xCE36, 0xEEB8, 0x5228, 0x0000, 0x6A89, 0xFE56, 0xF615, 0xDD52, 0xE573, 0xD4F1, 0x6AA9, 0x62A9, 0x934D, 0xA38D, 0xC4EF, 0x838B, 
-0x3144, 0x3105, 0x5A09, 0x93CD, 0xD5B1, 0x6AE8, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0xC4B1, 0xFF39, 
-0xAC0E, 0x49E7, 0xBD94, 0xE678, 0x5A48, 0x0000, 0x6A89, 0xFE36, 0xF5F5, 0xEDD5, 0xF615, 0xF5F5, 0xCCF1, 0x934D, 0x9AEB, 0xBBCD, 
-0x834A, 0x3986, 0x4167, 0x4167, 0x5A08, 0xA40D, 0xDDB1, 0x93CA, 0x5A06, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4165, 
-0xCCF1, 0xFE77, 0x936C, 0x6B0B, 0xCE16, 0xDE57, 0x5228, 0x18A2, 0x5A07, 0xD532, 0xF5F5, 0xEDD4, 0xEDB4, 0xF5F5, 0xF5F5, 0xC42F, 
-0xC3AD, 0xA36C, 0x3945, 0x3947, 0x72AC, 0x49A8, 0x3945, 0x8B8C, 0xCD30, 0xD590, 0x6287, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6206, 0xA3CD, 0xBC4F, 0x6289, 0xA4F2, 0xF75A, 0xCDB5, 0x6289, 0x4144, 0x4985, 0x7B0A, 0xFE77, 0xFE56, 0xFE36, 0xFE36, 
-0xE553, 0xBBCD, 0xD42F, 0xABED, 0x3965, 0x4187, 0x72AC, 0x51E8, 0x3926, 0x6249, 0xAC8F, 0xDDF1, 0x9C4C, 0x59E6, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x5A27, 0x7B2B, 0x62A9, 0xB574, 0xFF9B, 0xCDD5, 0xACD2, 0x72EB, 0x20C3, 0x4185, 0x8B4B, 0x8B4B, 
-0x832B, 0x8B2B, 0xAB4C, 0xBB6C, 0xE4F1, 0xBCB0, 0x39A6, 0x4187, 0x728C, 0x624A, 0x51C8, 0x4166, 0x6A8A, 0xB48F, 0xBCEF, 0x5226, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4A07, 0x7BAD, 0x62EA, 0xB533, 0xFF7B, 0xE6B8, 0xEED9, 0xDE36, 0xB4F2, 0x83AD, 
-0x5A89, 0x5A89, 0x5269, 0x5ACA, 0xA3EE, 0xDCF1, 0xED73, 0xAC0E, 0x3944, 0x3126, 0x624A, 0x6A6B, 0x6A6B, 0x4167, 0x3925, 0x93AD, 
-0xA42F, 0x3945, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6A68, 0x62EA, 0x7BAD, 0x62EA, 0x8C2F, 0xE698, 0xF73A, 0xEEF9, 
-0xF71A, 0xEED9, 0xDE77, 0xD657, 0xD657, 0xD677, 0xDE78, 0xF6B8, 0xD594, 0x930B, 0x40E3, 0x20C3, 0x51E9, 0x728C, 0x5A09, 0x4167, 
-0x6269, 0x9BCE, 0x6A8A, 0x3924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x49E6, 0xB553, 0x83AD, 0x3985, 0x62CA, 
-0x6B2B, 0x62EA, 0x8BEE, 0xBD33, 0xDE57, 0xFF5A, 0xF71A, 0xEEF9, 0xE6B8, 0xEEFA, 0xCDF5, 0x8AEA, 0x5944, 0x3903, 0x3966, 0x624B, 
-0x51A7, 0x4166, 0x832C, 0x6AAA, 0x3944, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x7BAD, 0xEED9, 
-0xACB1, 0x3965, 0x3104, 0x3985, 0x3144, 0x3145, 0x7B4C, 0xB513, 0xB512, 0xAC91, 0xACD1, 0xDE78, 0xDE57, 0x8AEA, 0x71C6, 0x5164, 
-0x20C3, 0x5A2A, 0x51C8, 0x20C3, 0x2904, 0x3945, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 
-0x3985, 0xCE16, 0xFF7B, 0xACD1, 0xA430, 0xCDB5, 0x9C2F, 0x41A6, 0x2904, 0x28E4, 0x5A28, 0x8BAD, 0xB513, 0xEF1A, 0xDE36, 0x82CA, 
-0x71C6, 0x5164, 0x28E3, 0x5A2A, 0x49A8, 0x28E3, 0x7268, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7288, 0x6AEA, 0xDE77, 0xEED9, 0xDE57, 0xF73A, 0xCDD5, 0x6289, 0x2082, 0x1000, 0x38E4, 0x9C0F, 0xDE98, 0xDE57, 
-0xA3EE, 0x7207, 0x7A07, 0x4964, 0x28E3, 0x5A2A, 0x49A8, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x62EA, 0xEED9, 0xDE57, 0xA470, 0x62A9, 0x3103, 0x5165, 0x61A6, 0x48E5, 0x59C8, 
-0x7AEC, 0x6209, 0x4925, 0x6185, 0x8268, 0x5164, 0x20C3, 0x622A, 0x51E8, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3144, 0x8BCE, 0x730B, 0x3104, 0x0820, 0x3903, 0x8A88, 0x7A27, 
-0x5125, 0x4904, 0x5104, 0x3863, 0x2843, 0x4905, 0x7207, 0x4964, 0x3104, 0x5A2A, 0x4187, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x28E3, 0x4985, 0xA36B, 0x7247, 0x3924, 
-0x61C6, 0x5966, 0x5986, 0x7207, 0x7A47, 0x61C6, 0x40E5, 0x4905, 0x5165, 0x3104, 0x51E9, 0x5A09, 0x3924, 0xAB8B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0xB3AC, 0xC40D, 
-0xC40D, 0x6206, 0x28A3, 0x5986, 0x7207, 0x7227, 0x7207, 0x7207, 0x69E7, 0x7A07, 0x5165, 0x2904, 0x622A, 0x4187, 0x6207, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x59C6, 0x4124, 0x7207, 0x7227, 0x7207, 0x7207, 0x7207, 0x7A27, 0x7A27, 0x4964, 0x3104, 0x3125, 0x59C6, 
-0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x3903, 0x7227, 0x7A27, 0x7207, 0x7207, 0x7207, 0x7207, 0x8248, 0x69E7, 0x3924, 0x7248, 
-0x7268, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 0x3924, 0x7A28, 0x7227, 0x7207, 0x7207, 0x7207, 0x7207, 0x69C7, 0x3924, 
-0x59E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x3903, 0x7A27, 0x7207, 0x7207, 0x7207, 0x7207, 0x6186, 
-0x30A4, 0x20C3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x3903, 0x7A27, 0x7207, 0x7207, 0x7207, 
-0x7207, 0x5986, 0x4925, 0x3103, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x3903, 0x7A27, 0x7207, 
-0x7207, 0x7207, 0x7207, 0x7207, 0x8248, 0x61C6, 0x3103, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x3903, 
-0x7A27, 0x7A27, 0x7207, 0x7207, 0x7207, 0x7207, 0x7A48, 0x69E7, 0x20C3, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7A68, 0x20C3, 0x59C7, 0x7227, 0x7207, 0x7207, 0x6A07, 0x4987, 0x4166, 0x4167, 0x2926, 0x10A3, 0x6207, 0xBBED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6A47, 0x1083, 0x3147, 0x4167, 0x3966, 0x4166, 0x3966, 0x2106, 0x18E6, 0x1906, 0x2127, 0x2126, 0x10A3, 0x6A47, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x28E3, 0x20E5, 0x2106, 0x18E6, 0x10C5, 0x10C5, 0x1906, 0x2106, 0x2106, 0x2106, 0x2106, 0x2927, 
-0x18E5, 0x3103, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x18A3, 0x2927, 0x2927, 0x2106, 0x18A4, 0x18C5, 0x2127, 0x2106, 0x18C5, 0x20E5, 
-0x2106, 0x2126, 0x2106, 0x18A3, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x20E3, 0x20E5, 0x2106, 0x2106, 0x2106, 0x18C4, 0x18E5, 0x2127, 0x20E6, 
-0x18A4, 0x18E5, 0x2126, 0x2106, 0x2927, 0x20E5, 0x3104, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA8, 0x18C3, 0x2106, 0x20E6, 0x18E5, 0x2106, 0x18C5, 0x18C5, 0x2106, 
-0x2126, 0x20E6, 0x18C4, 0x18E5, 0x2126, 0x2106, 0x2106, 0x2106, 0x10A3, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x18A2, 0x2126, 0x2927, 0x18C5, 0x18C5, 0x2106, 0x18C4, 
-0x18C5, 0x2126, 0x2126, 0x2106, 0x18A4, 0x18E5, 0x2126, 0x2106, 0x18E5, 0x18E5, 0x18C5, 0x3124, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x28E3, 0x20E5, 0x18C5, 0x18C5, 0x2106, 
-0x2106, 0x18A4, 0x18C5, 0x2126, 0x2126, 0x18E5, 0x18C4, 0x20E6, 0x2106, 0x2126, 0x18E5, 0x18C4, 0x2106, 0x18A4, 0x5A06, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x3104, 0x1062, 
-0x18C5, 0x2127, 0x18C4, 0x1063, 0x18C5, 0x2127, 0x18E5, 0x10A4, 0x18E5, 0x2106, 0x2106, 0x2106, 0x18C4, 0x18C4, 0x2127, 0x18C4, 
-0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7A88, 0x0862, 0x2106, 0x2127, 0x1084, 0x0863, 0x18E5, 0x18C5, 0x1083, 0x10A4, 0x2106, 0x2126, 0x2106, 0x18E5, 0x1083, 0x18A4, 
-0x2127, 0x18C4, 0x51C5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xABAC, 0x3924, 0x18C5, 0x2106, 0x3966, 0x3946, 0x10A5, 0x0863, 0x0842, 0x18C5, 0x2106, 0x18E6, 0x18E6, 0x10A4, 
-0x0841, 0x1083, 0x2927, 0x18C4, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x3924, 0x3946, 0xABCE, 0xB450, 0x72AB, 0x6A08, 0x59E7, 0x3146, 0x10C6, 0x10A5, 
-0x3147, 0x4987, 0x3103, 0x3944, 0x18A3, 0x20C3, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x7288, 0xFDF5, 0xFE36, 0xED73, 0xE511, 0xBBEE, 0x6A09, 
-0x59E8, 0x728A, 0xB430, 0xA3CD, 0x59C6, 0xA36B, 0x7A88, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x72EA, 0xF615, 0xF5F5, 0xF5F5, 0xFE35, 
-0xD4F2, 0x8A8B, 0xA30C, 0xED32, 0xFE97, 0xBCB0, 0x4985, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x59E6, 0xA40E, 0xF615, 
-0xEDD4, 0xF615, 0xE594, 0x930D, 0xA32C, 0xEDB3, 0xFE97, 0xB46F, 0x4185, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 
-0x72C9, 0xFE15, 0xF5F5, 0xF5F5, 0xD512, 0x828B, 0x9B0C, 0xED93, 0xFE97, 0xAC2F, 0x4165, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6A27, 0x7B2B, 0xFE36, 0xFE15, 0xEDB4, 0x82EC, 0x30C4, 0x9B4B, 0xFDD4, 0xFE77, 0xBC90, 0x49A6, 0xAB8B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x830B, 0xFE36, 0xFE36, 0xEDB4, 0x7AAB, 0x1021, 0x7268, 0xED53, 0xFE16, 0xF5F5, 0x8B6C, 0x59E6, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x59C6, 0xCCB0, 0xF5D4, 0xFDF5, 0xCCB1, 0x2903, 0x1861, 0xB3AD, 0xED53, 0xFE56, 
-0xB42F, 0x4144, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51C5, 0x7227, 0xE512, 0xFEB8, 0xEE15, 0x39A5, 0x18A2, 0x7248, 
-0xD4F1, 0xFE98, 0xC553, 0x5227, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 0x6248, 0xEDD5, 0xFFBC, 0xE6FA, 0x5A68, 
-0x7247, 0x51E6, 0xCDD5, 0xFFBC, 0xFFBD, 0x9CD1, 0x51E6, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x7BAD, 0xFF7B, 0xFFFF, 
-0xF77C, 0x5AA9, 0x930A, 0x7268, 0x8C0F, 0xEF1A, 0xFFFF, 0xBDB4, 0x4185, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x83CE, 
-0xFFDD, 0xFFDD, 0xAD33, 0x5A07, 0xBBED, 0xAB8C, 0x41A6, 0xCE16, 0xFFFF, 0xAD33, 0x49A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x59E6, 0x83AD, 0xFFDE, 0xEF5B, 0x5269, 0x930A, 0xC40D, 0xAB8B, 0x3985, 0xCDF6, 0xFFFF, 0xA512, 0x49A6, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6207, 0x736C, 0xFFDE, 0xF77C, 0x5268, 0x930A, 0xC40D, 0xBBED, 0x6227, 0x7BAD, 0xFF7B, 0xAD33, 0x51A6, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x83CE, 0xFFDD, 0xEF7B, 0x5A89, 0x8AE9, 0xC40D, 0xC40D, 0xAB8C, 0x41A6, 0xD657, 0xEF5B, 
-0x6B0B, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x5A89, 0xE6D9, 0xFFFE, 0x9CB1, 0x6227, 0xBBCD, 0xC40D, 0xC40D, 0xA36B, 0x49E6, 
-0xDE77, 0xFFFF, 0xAD53, 0x49A5, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x41E7, 0xD698, 0xEF5B, 0x5268, 0x9B4B, 0xC40D, 0xC40D, 0xB3AC, 
-0x4165, 0x39A6, 0xDE98, 0xFFFF, 0xB574, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0xBBED, 0x82A9, 0x20C2, 0x1881, 0x4A07, 0x6B0B, 0x2924, 0x82A9, 0xC40D, 
-0xAB8C, 0x4164, 0x0000, 0x1061, 0x738D, 0xEF5B, 0xA4D2, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA9, 0x3123, 0x2903, 0x20C2, 0x20E3, 0x2903, 0x18A2, 0x1040, 0x0840, 
-0x20C2, 0x3924, 0x28C2, 0x0841, 0x1061, 0x0000, 0x0861, 0x41E7, 0x3165, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x28E3, 0x18C2, 0x20C2, 0x20E3, 0x2903, 0x2903, 0x2903, 
-0x20E3, 0x1061, 0x0020, 0x0841, 0x0841, 0x0861, 0x1061, 0x1061, 0x0020, 0x0000, 0x0000, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
@@ -1,434 +0,0 @@
-// Total bitmap data size: 13260 bytes
-
-// girl_attack_right_1.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_attack_right_1_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0xA36B, 0xC40D, 0x9B2A, 0x4185, 0x4185, 0x41A5, 0x49C5, 0x49C5, 0x49C5, 
-0x49C5, 0x6207, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x49C5, 0x41A5, 0x6A27, 0x6287, 0xC54E, 0xDE10, 0xD5D0, 0xCD4F, 
-0xBCCE, 0xBCEE, 0xCD6F, 0x836A, 0x3984, 0x6206, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x5A26, 0xC58F, 0xBD0E, 0x72E8, 0xC56E, 0xFFF5, 0xFFD4, 
-0xF6B3, 0xDDB1, 0xD590, 0xDDB1, 0xEE32, 0xDDB0, 0xC52F, 0x8BCA, 0x4A05, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x5A26, 0xCDCF, 0xFFF5, 0xF6B3, 0xC591, 0xEE72, 
-0xFF13, 0xD5F1, 0xBCEF, 0xCD90, 0xE631, 0xE5F1, 0xB48E, 0xBCEF, 0xFE92, 0xFF33, 0xF732, 0x83AA, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x942B, 0xFFD5, 0xFF33, 0xDE52, 
-0x9D32, 0xA531, 0xCD4F, 0xB48E, 0xCD70, 0xFF33, 0xFF73, 0xB4EE, 0x72EA, 0x938D, 0xCD70, 0xFF13, 0xFF94, 0xF692, 0x8349, 0x6A27, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x5206, 0xCDAF, 0xFEF3, 
-0xDDB0, 0xA42E, 0x532E, 0x53D0, 0x8C70, 0xBCCF, 0xE611, 0xFF13, 0xF6D3, 0x6AE8, 0x5A28, 0xBC91, 0xAC2F, 0xC52F, 0xEE51, 0xFED3, 
-0xD5B0, 0x41A5, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x8BAA, 
-0xFEB3, 0xD5B0, 0x9BED, 0x5A0A, 0x2108, 0x1A0C, 0x6C31, 0xCD91, 0xEE31, 0xF652, 0xAC8D, 0x5A47, 0xAC2F, 0xFE36, 0xA3F0, 0x93AC, 
-0xDDF0, 0xE611, 0xBCCF, 0x41A5, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x59E6, 0x8BAA, 0xEE52, 0xB4AE, 0x7AEC, 0x4A2B, 0x21AA, 0x3A6C, 0x840F, 0xB4AF, 0xE5F1, 0xF672, 0x6AC8, 0x59E7, 0xD4B0, 0xE4F1, 
-0xBC30, 0x938D, 0xB48E, 0xC530, 0x6AC9, 0x51C5, 0x59E6, 0x6A27, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x59E6, 0x8BAA, 0xE5F1, 0xB46E, 0x72EB, 0x322C, 0x432E, 0x9490, 0x9BED, 0x8B4C, 0xD590, 0xEE52, 0x62C8, 0x4944, 
-0x71E7, 0x4965, 0x8ACA, 0x934D, 0x9C0E, 0xB4AE, 0x49C5, 0x930A, 0x4985, 0x5A27, 0x51C6, 0x7247, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x7B49, 0xDDB1, 0xB48E, 0x7B0C, 0x3A2B, 0x52CB, 0xAC6D, 0xA40D, 0x830C, 0xBCCF, 0xD5B1, 
-0x72E9, 0x20C2, 0x28E4, 0x30C5, 0x7A29, 0x930C, 0x834B, 0x62A8, 0x7AA8, 0xAB8B, 0x5A06, 0xC4B0, 0xD512, 0x6AA9, 0x6A27, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x51E6, 0x93CB, 0xBCAF, 0x834D, 0x4A0A, 0x49C7, 0xA40C, 0xB48F, 0x7B0C, 
-0x9C0D, 0xC530, 0x6AC8, 0x4228, 0x72ED, 0x81EA, 0xC3AF, 0xCC90, 0x6A68, 0x6227, 0xC40D, 0x7248, 0x8B4C, 0xF5F5, 0xFEF9, 0xCCF1, 
-0x3964, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x6AE8, 0xC510, 0x830C, 0x4988, 0x4145, 0x836A, 
-0xC510, 0x9BED, 0x8B4C, 0xB4AF, 0x5A87, 0x62CA, 0xC4B2, 0xA30C, 0xCC70, 0xFE15, 0xBC6F, 0x6247, 0x930A, 0x4185, 0xD512, 0xFE97, 
-0xFE36, 0xB46F, 0x4185, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x8369, 0xD591, 0x8B6D, 0x59E9, 
-0x3105, 0x3964, 0x93EB, 0xC4EF, 0xA36D, 0x934C, 0x6288, 0x7AEA, 0xDD32, 0xE553, 0xDD53, 0xFE36, 0xF615, 0x6268, 0x7A88, 0x6207, 
-0xA3EE, 0xFE77, 0xFE97, 0xB44F, 0x4985, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x51E6, 0x9C2C, 0xDDB1, 
-0x93CC, 0x51C7, 0x4987, 0x4167, 0x41C6, 0x936B, 0xBBCD, 0x9AEB, 0x936D, 0xD512, 0xF5F5, 0xF615, 0xEDD4, 0xFE15, 0xF5F5, 0x6248, 
-0x8AC9, 0xB3CC, 0x6207, 0xA40E, 0xFE36, 0xB490, 0x51C6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x6AE8, 
-0xD5B0, 0xC510, 0x832B, 0x3925, 0x51C8, 0x728C, 0x3126, 0x4185, 0xB3AC, 0xC3AD, 0xCC70, 0xFE15, 0xF5F5, 0xEDB4, 0xEDD4, 0xFE15, 
-0xC4D1, 0x51E6, 0xA34B, 0xC40D, 0xA36B, 0x3124, 0xAC91, 0xB533, 0x3964, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x51E5, 0xACAD, 0xDDD1, 0xA42E, 0x5A29, 0x3926, 0x59E9, 0x72AC, 0x3947, 0x41A6, 0xB42E, 0xCC0E, 0xC3EE, 0xED94, 0xFE56, 0xFE56, 
-0xFE97, 0xFE56, 0x72C9, 0x6A47, 0xC40D, 0xC40D, 0xBBED, 0x3103, 0x7B4C, 0x940F, 0x3165, 0x3944, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6287, 0xC510, 0xAC4E, 0x6269, 0x4166, 0x59E9, 0x624A, 0x728C, 0x3947, 0x49E7, 0xCCF1, 0xDCB0, 0xBB8C, 0xB3CD, 
-0x9BCD, 0x9BCD, 0xA40E, 0x9BCD, 0x51C6, 0xAB6B, 0xC40D, 0xC40D, 0x82A9, 0x41A6, 0xAC91, 0x7B4C, 0x5A48, 0xA3CD, 0x6A68, 0x9B4B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A7, 0xAC4F, 0x8B4C, 0x3105, 0x4987, 0x6A8B, 0x6A6B, 0x622A, 0x3105, 0x4165, 0xBC4F, 0xF5B4, 
-0xB3AD, 0x5165, 0x6206, 0x6206, 0x51A5, 0x51C6, 0x9B4A, 0xC40D, 0xC40D, 0xBBCD, 0x3103, 0x730B, 0xEED9, 0x9490, 0x5A68, 0xED94, 
-0xAC2E, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3104, 0x72CB, 0x93CD, 0x6228, 0x4987, 0x622A, 0x728C, 0x49C8, 0x20C3, 0x4903, 
-0x9B2B, 0xEE36, 0xCDB4, 0x5207, 0x6A27, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x3965, 0xACB1, 0xFF7B, 0x9CB1, 
-0x5207, 0xDD32, 0xEDD5, 0x5A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x3925, 0x72EB, 0x7AEC, 0x4146, 0x51C8, 0x624B, 0x3945, 
-0x38E3, 0x7227, 0xB4B1, 0xDE98, 0xEF1A, 0xB574, 0x7B6C, 0x5A27, 0x7268, 0x7268, 0x6A27, 0x6A27, 0x59E6, 0x41A6, 0xACB1, 0xE6B8, 
-0xFF5B, 0x9470, 0x5227, 0xDD52, 0xEDB4, 0x5A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x3924, 0x2904, 0x20C3, 0x51E9, 
-0x51E9, 0x20C3, 0x4903, 0x9B6C, 0xD636, 0xEEF9, 0xE6B8, 0xEEF9, 0xF71A, 0xB553, 0x736C, 0x7B8D, 0x83CD, 0x736C, 0x5A48, 0x834C, 
-0xDE37, 0xEF1A, 0xDE57, 0xAC91, 0xBC90, 0xC4D1, 0x6248, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x6A27, 
-0x28E3, 0x51E9, 0x5A09, 0x20C3, 0x4903, 0x9B6C, 0xDE57, 0xE6D9, 0xDE57, 0xE6B8, 0xEEF9, 0xEF19, 0xF73A, 0xFF5B, 0xFF9C, 0xFF7B, 
-0xE657, 0xD5D5, 0xDE78, 0xF73A, 0xCDF5, 0xBCD1, 0xC4B1, 0x6248, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x4985, 0x51E9, 0x5A09, 0x28C3, 0x4903, 0x932B, 0xDE37, 0xDE98, 0xC5B4, 0xD636, 0xE698, 0xEEB9, 0xEED9, 0xDE98, 
-0xD657, 0xD636, 0xCE36, 0xD657, 0xE698, 0xF73A, 0xB533, 0x5248, 0x4165, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x5A09, 0x5A2A, 0x28C3, 0x5144, 0x7A48, 0xA42F, 0xC5B5, 0xB512, 0xA491, 0x9C50, 0x940F, 
-0x940F, 0x62CA, 0x39A6, 0x4A07, 0x5248, 0x62AA, 0x93EE, 0x9C2F, 0x5A48, 0x7268, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49A5, 0x49C8, 0x51E9, 0x20C3, 0x59A5, 0x7A07, 0x61A6, 0x6209, 0x6A8A, 0x7AEB, 
-0x49C7, 0x1882, 0x1882, 0x1021, 0x0000, 0x3144, 0x5A28, 0x3985, 0x2903, 0x3103, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x3945, 0x49A8, 0x3945, 0x5185, 0x69E7, 0x38A4, 0x2002, 
-0x38A4, 0x5187, 0x4105, 0x1822, 0x2862, 0x5125, 0x3924, 0x49E7, 0x5A28, 0x4185, 0x7A88, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A6, 0x4187, 0x51E8, 0x3944, 0x5985, 
-0x4925, 0x4925, 0x61A6, 0x61A6, 0x61A6, 0x5966, 0x5946, 0x61A6, 0x3103, 0x3124, 0x7A88, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x51A6, 0x3145, 
-0x3104, 0x4964, 0x71E7, 0x7207, 0x7227, 0x7227, 0x7A27, 0x7207, 0x6186, 0x28A3, 0x7268, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA36B, 0x7268, 0x6A47, 0x3923, 0x7227, 0x8268, 0x7207, 0x7207, 0x7207, 0x7A27, 0x7207, 0x3904, 0x6207, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x51A5, 0x4144, 0x69C7, 0x7207, 0x7207, 0x7207, 0x7207, 0x7A27, 0x7207, 0x3103, 0x82A9, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x1882, 0x38C4, 0x61A6, 0x7207, 0x7207, 0x7207, 0x7A27, 0x7A27, 
-0x30E3, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x30E3, 0x4925, 0x5986, 0x7207, 0x7207, 0x7207, 
-0x7227, 0x7207, 0x3103, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x30E3, 0x6A07, 0x7A48, 0x7207, 0x7207, 
-0x7207, 0x7207, 0x7A27, 0x7207, 0x30E3, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x59E6, 0x4144, 0x7A27, 0x7A47, 
-0x7A27, 0x7207, 0x7207, 0x7207, 0x7A27, 0x59C7, 0x20C3, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x51C6, 0x20C4, 0x4167, 
-0x51C7, 0x6A07, 0x7207, 0x7207, 0x7207, 0x59C7, 0x4167, 0x2926, 0x10C4, 0x3944, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x18A4, 
-0x2127, 0x1906, 0x2106, 0x3966, 0x4166, 0x3966, 0x4166, 0x2926, 0x18E6, 0x18E5, 0x20E5, 0x1082, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 
-0x20C3, 0x20E6, 0x2947, 0x20E5, 0x18C5, 0x18E6, 0x1906, 0x10C5, 0x10C5, 0x2106, 0x2106, 0x18C5, 0x18E5, 0x18A3, 0x7A88, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x59E6, 0x18A4, 0x2106, 0x2127, 0x18E5, 0x18A4, 0x20E6, 0x2127, 0x18C4, 0x10A4, 0x2106, 0x2106, 0x18C4, 0x18C5, 0x18E5, 
-0x3124, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xA34B, 0x20E3, 0x20E5, 0x2927, 0x2126, 0x18E5, 0x18A4, 0x2106, 0x2127, 0x18E5, 0x1083, 0x18E5, 0x2126, 0x18C5, 
-0x18A4, 0x2106, 0x10A3, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x18A4, 0x2126, 0x2106, 0x2126, 0x20E5, 0x18C4, 0x20E5, 0x2126, 0x2106, 0x18A4, 0x18A4, 
-0x2106, 0x2106, 0x10A4, 0x18C5, 0x20E6, 0x2904, 0x7A88, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x20E3, 0x20E5, 0x2927, 0x2106, 0x2106, 0x2106, 0x18C5, 0x18C5, 0x2106, 0x2127, 
-0x18E5, 0x1083, 0x18E5, 0x2127, 0x18C5, 0x18A4, 0x20E6, 0x2106, 0x1083, 0x3103, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51A5, 0x18A4, 0x2127, 0x2126, 0x2106, 0x2106, 0x2127, 0x18E5, 0x10A4, 
-0x20E5, 0x2927, 0x2106, 0x18A4, 0x18A4, 0x2106, 0x2106, 0x10A4, 0x1083, 0x18E5, 0x2127, 0x20E5, 0x28E3, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3944, 0x18C5, 0x2106, 0x20E5, 0x2106, 0x2106, 0x2106, 
-0x20E6, 0x10A4, 0x10A4, 0x18C5, 0x2106, 0x18E5, 0x10A4, 0x18C4, 0x2106, 0x18E5, 0x1063, 0x18A4, 0x2127, 0x18E5, 0x4165, 0xBBCC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3944, 0x18C5, 0x18C4, 0x1083, 0x20E5, 
-0x2127, 0x20E6, 0x2106, 0x18E5, 0x0883, 0x0022, 0x1084, 0x2106, 0x18C5, 0x1083, 0x18E5, 0x2927, 0x18C5, 0x1083, 0x1082, 0x51C6, 
-0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x18A3, 0x1062, 
-0x3124, 0x28E4, 0x2106, 0x2106, 0x18E6, 0x10C6, 0x3146, 0x59E7, 0x4187, 0x2106, 0x10A4, 0x0841, 0x18C5, 0x2947, 0x18C4, 0x3124, 
-0x6A47, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7A88, 0x7268, 0x9B2A, 0x3104, 0x4167, 0x726A, 0x7269, 0x6209, 0x8ACA, 0xCBED, 0xAB4C, 0x4186, 0x3944, 0x6A27, 0x28E4, 0x10A3, 
-0x4985, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x4125, 0x92CB, 0xC3CD, 0xC3CD, 0xCC2F, 0xE512, 0xE4F1, 0x6A27, 0x6A47, 0xC40D, 
-0x930A, 0x6227, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x20A3, 0x69E9, 0xCC0F, 0xE4F1, 0xE573, 0xF616, 0xE532, 0x61E6, 
-0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x28C3, 0x7229, 0xE553, 0xFE35, 0xF5F5, 0xFE16, 
-0xA3EE, 0x51A5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x51C7, 0xD533, 0xFE36, 
-0xF5D5, 0xFE36, 0x7B0B, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x28C3, 
-0x8AEC, 0xEDB5, 0xF615, 0xFE36, 0x8B4C, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x2062, 0x8ACC, 0xED94, 0xFE36, 0xFE56, 0x8B4B, 0x51C5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x932A, 0x49A6, 0x728A, 0xD4D1, 0xF5D4, 0xF5D4, 0xD4D1, 0x61E7, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x49C6, 0x9470, 0xCD33, 0xE5D5, 0xFE77, 0xE512, 0x7A48, 0x51A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x6B4C, 0xCE37, 0xC594, 0xDEB8, 0xFF7B, 0xEDF5, 0x7268, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x49C6, 0xC616, 0xE698, 0xB4F2, 0xEF3B, 0xFFFE, 0xFF7B, 0x8BEE, 0x59C6, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4185, 0xCE57, 0xFF7B, 0xACD1, 0xAD33, 0xEF5B, 0xFFFD, 0x8C2F, 
-0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x6B2B, 0xEEF9, 0xEEF9, 0x5269, 0x4207, 0xDED9, 
-0xFFFE, 0x8C0E, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x4185, 0xCE16, 0xFF9B, 0x7B4B, 0x3924, 
-0x39C6, 0xEF5B, 0xFFFE, 0x83CD, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x83CE, 0xFFDD, 0xCE16, 
-0x49C6, 0x82A9, 0x5A89, 0xEF3A, 0xFFFE, 0x8C0F, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4185, 0xCE16, 
-0xF79C, 0x6B0B, 0x82C9, 0xC40D, 0x6A48, 0x9470, 0xFFFE, 0xE71A, 0x62AA, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 
-0x1082, 0x5289, 0x5AAA, 0x28E3, 0xAB8C, 0xC40D, 0xA36B, 0x4A27, 0xEF3A, 0xDEB9, 0x4A28, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBED, 0x3944, 0x0841, 0x0000, 0x0000, 0x0020, 0x49A5, 0xB3CC, 0x930A, 0x2924, 0x62EA, 0x4A07, 0x1881, 0x20A2, 0x7A88, 0xBBCD, 
-0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x4164, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x28E3, 0x28C2, 0x0840, 0x1040, 0x18A2, 0x2903, 0x2903, 
-0x20A2, 0x2903, 0x3123, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4165, 0x0841, 0x0861, 0x0861, 0x1061, 0x0861, 0x0841, 0x0020, 0x1061, 0x20E3, 0x2903, 
-0x2903, 0x2903, 0x20E3, 0x20C2, 0x18C2, 0x20C2, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_attack_right_2.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_attack_right_2_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0xB3AC, 0xC40D, 0x7268, 0x4184, 0x4185, 0x41A5, 0x49C5, 0x49C5, 
-0x49C5, 0x49C5, 0x7A88, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x41A5, 0x49A5, 0x6A47, 0x7B49, 0xD5D0, 0xDE10, 0xD5AF, 
-0xC50E, 0xB4CE, 0xC52F, 0xBCEE, 0x62A7, 0x3944, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x7328, 0xDE31, 0x93EB, 0x8349, 0xEE91, 0xFFF5, 
-0xFF74, 0xEE52, 0xD591, 0xD591, 0xE5F1, 0xE611, 0xD590, 0xC52F, 0x7328, 0x7A88, 0x92EA, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA8, 0x6B08, 0xEF12, 0xFFD5, 0xDE12, 0xCDB1, 
-0xFED2, 0xF6F2, 0xC570, 0xBD0F, 0xDDF1, 0xE631, 0xD570, 0xAC6E, 0xDDD1, 0xFED2, 0xA46C, 0x5A27, 0x5A07, 0x51E6, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4184, 0xD5F0, 0xFFF5, 0xFED2, 
-0xC5F2, 0x8D12, 0xBD51, 0xC50F, 0xB4AE, 0xDE11, 0xFF94, 0xF6B2, 0x93EC, 0x72CB, 0xC4F0, 0xB4AD, 0x6AC8, 0xB44F, 0xFEB8, 0xA40E, 
-0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x7308, 0xEE92, 
-0xF692, 0xD52F, 0x83AD, 0x432F, 0x6411, 0x9C6F, 0xCD2F, 0xF692, 0xFF53, 0xCD8F, 0x4A06, 0x830C, 0xDD53, 0x6AC9, 0x4185, 0xBC90, 
-0xFF19, 0xDD53, 0x5A48, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x4185, 
-0xC52E, 0xFEB3, 0xC50F, 0x8B4C, 0x4169, 0x1129, 0x32CE, 0x8CD1, 0xDDF1, 0xF651, 0xE611, 0x838A, 0x6268, 0xDD73, 0xFE36, 0x5A09, 
-0x2904, 0xC4D0, 0xFE56, 0xFE56, 0xA3EE, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB3AC, 0x41A5, 0xBCEE, 0xE612, 0x9BED, 0x6AAC, 0x3A0B, 0x21AA, 0x532E, 0x944F, 0xC52F, 0xF672, 0xCD4F, 0x49E6, 0x82CA, 0xED32, 
-0xDCF1, 0x8B2C, 0x4186, 0xB44F, 0xFE77, 0xFE97, 0xAC2F, 0x4985, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xABAC, 0x41A5, 0xBCEE, 0xDDB1, 0x9BCD, 0x5A8B, 0x326C, 0x5BAF, 0xA4AF, 0x8B6C, 0x9BED, 0xEE72, 0xC52F, 0x49C6, 
-0x5985, 0x69C6, 0x59C6, 0x9B4C, 0x6228, 0x6AAA, 0xE573, 0xFE77, 0xD5F5, 0x6AEA, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x49C5, 0xAC8D, 0xD590, 0xA3ED, 0x62AC, 0x322B, 0x6B4B, 0xBCCE, 0x8B6C, 0x8B8C, 0xD590, 
-0xBCEF, 0x49E6, 0x20A2, 0x30C5, 0x4106, 0x9AEB, 0x82CB, 0x41C6, 0x6A88, 0x9BEE, 0xD616, 0x8C2F, 0x51A5, 0xC40D, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x5A26, 0xAC8E, 0xAC4E, 0x72EC, 0x41A8, 0x6268, 0xBCCE, 0x9BCD, 
-0x7B2C, 0xB4AF, 0xB48E, 0x4A26, 0x4A8A, 0x7AAD, 0x922B, 0xD450, 0xB42E, 0x5A06, 0x51A5, 0x3965, 0x9C0F, 0x7B6C, 0x59E6, 0x7AA8, 
-0x4985, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x3944, 0x9C2C, 0xB48F, 0x6A6B, 0x4127, 0x49C6, 
-0xA44D, 0xBCEF, 0x8B8D, 0x9BCD, 0xA42D, 0x4A06, 0x8BAD, 0xC451, 0xA2EC, 0xE553, 0xF5D4, 0x936C, 0x2903, 0x1882, 0x93EE, 0xCDD5, 
-0x6B0B, 0x5A27, 0xBC6F, 0x72CA, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4184, 0xB4CD, 0xC510, 0x72CB, 
-0x4987, 0x28E4, 0x5226, 0xACAE, 0xBC6F, 0x932C, 0x834B, 0x5A67, 0x9BAD, 0xED94, 0xDD32, 0xE593, 0xFE97, 0xCD12, 0x1882, 0x0821, 
-0xA450, 0xFF7B, 0x8C2F, 0x72CA, 0xFE56, 0xEDD5, 0x5A07, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5A26, 0xC52F, 
-0xCD50, 0x7AEA, 0x4987, 0x4988, 0x3946, 0x5247, 0xABCC, 0xB36C, 0x8AEB, 0xA40F, 0xE593, 0xF615, 0xF615, 0xEDB4, 0xFE56, 0xCCF1, 
-0x1882, 0x0821, 0x9C50, 0xF71A, 0x736C, 0x6248, 0xF615, 0xFE97, 0x72CA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49A5, 
-0x9C2C, 0xDDB1, 0xB48F, 0x6249, 0x3905, 0x624A, 0x622B, 0x28E4, 0x6A47, 0xC3EE, 0xBBAD, 0xDD32, 0xFE36, 0xEDB4, 0xEDB4, 0xF5D5, 
-0xF5F5, 0x9BCD, 0x3103, 0x1061, 0x9C2F, 0xF71A, 0x9C90, 0x62A9, 0xD512, 0xFE76, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8AE9, 0x6287, 0xCD6F, 0xD591, 0x8B6C, 0x4987, 0x4146, 0x624A, 0x6A8C, 0x28E5, 0x6289, 0xD490, 0xC3AD, 0xD490, 0xF5F5, 0xFE36, 
-0xFE36, 0xFEB8, 0xD532, 0x4185, 0x51A5, 0x3945, 0x9C2F, 0xE6B8, 0xE6D9, 0x734C, 0x830A, 0xCCF1, 0x6248, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x4185, 0x8BAB, 0xCD30, 0x93AC, 0x51C8, 0x4187, 0x622A, 0x6A6B, 0x6A6B, 0x2905, 0x72EA, 0xED73, 0xCBEE, 0xB34C, 
-0x9B4B, 0x832B, 0x832B, 0x936C, 0x72A9, 0x20C3, 0x41A6, 0x93EE, 0xC554, 0xE698, 0xFF5B, 0x7BAD, 0x6AA9, 0x7B0B, 0x6A47, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28C3, 0x72CA, 0xB470, 0x6249, 0x30E5, 0x5A09, 0x6A8B, 0x6A6B, 0x51E9, 0x28E3, 0x6A68, 0xDD32, 
-0xED52, 0xC470, 0x7B4C, 0x5269, 0x5A89, 0x5269, 0x6B0B, 0x9C2F, 0xC574, 0xE698, 0xEED9, 0xEED9, 0xF73A, 0x736C, 0x6B2B, 0x6B2B, 
-0x7267, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x3945, 0x8B6D, 0x8B4C, 0x49C7, 0x49A8, 0x624A, 0x6A8C, 0x3146, 0x28A2, 
-0x69A6, 0xB42F, 0xEE77, 0xE698, 0xDE98, 0xD657, 0xD657, 0xD657, 0xE698, 0xF6FA, 0xF71A, 0xEEF9, 0xF73A, 0xBD94, 0x734C, 0x6B0B, 
-0x7B8D, 0x5A48, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x4186, 0x8B4D, 0x624A, 0x3946, 0x622A, 0x5209, 
-0x3104, 0x4924, 0x69C6, 0xAC4F, 0xE6D9, 0xE6B9, 0xE6D9, 0xEEF9, 0xF75A, 0xEEF9, 0xCDD5, 0xA491, 0x734C, 0x62EA, 0x6B2B, 0x5228, 
-0x49E7, 0xB533, 0x83CE, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7248, 0x3125, 0x28E4, 0x2904, 
-0x624A, 0x3967, 0x30E3, 0x69C6, 0x71E6, 0xB491, 0xEEF9, 0xC594, 0xA491, 0xACD2, 0xBD33, 0xA470, 0x5228, 0x2904, 0x3965, 0x3965, 
-0x2904, 0x62AA, 0xDE37, 0xCDD5, 0x5207, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x930A, 
-0x51A5, 0x20E3, 0x624B, 0x4187, 0x30E3, 0x69C6, 0x71E6, 0xAC70, 0xF73A, 0xD636, 0xA450, 0x7B0B, 0x4186, 0x20E3, 0x3124, 0x62AA, 
-0xBD54, 0xBD33, 0x9C0F, 0xD616, 0xFFBC, 0x7BAD, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xA36B, 0x3104, 0x624B, 0x4187, 0x30E3, 0x69C6, 0x71E7, 0x82CA, 0xBD33, 0xE6D9, 0xC595, 0x6A6A, 0x1821, 0x1001, 
-0x3945, 0x940F, 0xEED9, 0xEED9, 0xDE77, 0xF71A, 0xAD12, 0x5207, 0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x28E4, 0x6A6B, 0x3967, 0x28C2, 0x7207, 0x7207, 0x5125, 0x5167, 0x72AB, 0x6A8A, 0x4926, 
-0x5125, 0x69C6, 0x3903, 0x41A6, 0x836D, 0xBD33, 0xF71A, 0xBD74, 0x4185, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x3124, 0x622A, 0x41A7, 0x3103, 0x69E6, 0x61A6, 0x3084, 0x2843, 0x40C3, 
-0x5124, 0x48E5, 0x6186, 0x8A89, 0x69E6, 0x1041, 0x1081, 0x49C6, 0x940F, 0x5A89, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x3145, 0x624B, 0x3966, 0x4124, 0x5165, 0x38C4, 
-0x5145, 0x7207, 0x7A47, 0x69C6, 0x5146, 0x61A6, 0x5185, 0x3944, 0x9B4B, 0x82C9, 0x28E3, 0x4985, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3104, 0x624A, 0x41A7, 0x30E3, 
-0x71E7, 0x69E7, 0x7207, 0x7227, 0x7207, 0x7227, 0x69E7, 0x4925, 0x28C3, 0xA36B, 0xC40D, 0xC40D, 0xA36B, 0xB3CC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x3945, 
-0x2905, 0x3924, 0x61E6, 0x7A48, 0x7227, 0x7207, 0x7207, 0x7207, 0x7A28, 0x61A6, 0x3103, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x82C9, 0x7A88, 0x59C6, 0x4124, 0x7A48, 0x7A27, 0x7207, 0x7207, 0x7207, 0x7207, 0x7A48, 0x59A6, 0x3944, 0xABAC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x3924, 0x5985, 0x71E7, 0x7227, 0x7207, 0x7207, 0x7207, 0x7A48, 0x61E6, 0x30E3, 
-0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x1842, 0x4905, 0x69E7, 0x7207, 0x7207, 0x7207, 0x7A28, 
-0x61C6, 0x3123, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x4985, 0x4104, 0x5146, 0x61C6, 0x7207, 0x7207, 
-0x7207, 0x7A28, 0x61C6, 0x3123, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x3903, 0x8248, 0x7A27, 0x7207, 
-0x7207, 0x7207, 0x7207, 0x7A28, 0x61C6, 0x3923, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x3104, 0x4165, 0x7A48, 
-0x7A27, 0x7227, 0x7207, 0x7207, 0x7207, 0x8248, 0x61C6, 0x3923, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3104, 0x18E5, 
-0x3147, 0x4187, 0x4167, 0x59C7, 0x7207, 0x7207, 0x7207, 0x7208, 0x4166, 0x28E3, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 
-0x1083, 0x2927, 0x2107, 0x18E6, 0x18E6, 0x3146, 0x4166, 0x3966, 0x4166, 0x3967, 0x2106, 0x10A4, 0x51C6, 0xBBCD, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x3104, 0x18E5, 0x2127, 0x2106, 0x18C5, 0x18E5, 0x2106, 0x18E6, 0x10A5, 0x18E5, 0x1906, 0x2126, 0x2127, 0x18A4, 0x51C6, 
-0xB3AC, 0xBBED, 0xB3AC, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7268, 0x1083, 0x2126, 0x2927, 0x2106, 0x18A4, 0x18C4, 0x2127, 0x2106, 0x18C4, 0x18C5, 0x2106, 0x2106, 0x2927, 
-0x2127, 0x18C4, 0x3103, 0x3124, 0x28E3, 0x7248, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x2903, 0x18E5, 0x2126, 0x2106, 0x2106, 0x18C5, 0x18C5, 0x2106, 0x2106, 0x18E5, 0x18C4, 0x20E6, 
-0x2126, 0x2106, 0x2126, 0x2106, 0x20E5, 0x20E5, 0x1083, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x10A3, 0x2127, 0x2927, 0x2106, 0x2106, 0x2106, 0x18C4, 0x18E5, 0x2127, 0x2106, 
-0x18A4, 0x18C5, 0x2927, 0x20E5, 0x18A4, 0x18E5, 0x2127, 0x2948, 0x18C5, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x28E3, 0x18E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18A4, 0x18A4, 
-0x2126, 0x2106, 0x18A4, 0x1083, 0x20E5, 0x2106, 0x18A4, 0x1083, 0x18C5, 0x2106, 0x18A3, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x18A3, 0x18C5, 0x18E5, 0x2106, 0x2126, 0x2106, 0x2106, 
-0x18C5, 0x1083, 0x18C5, 0x2126, 0x2106, 0x18A4, 0x1083, 0x18E5, 0x20E6, 0x18A4, 0x18C4, 0x18C3, 0x6A27, 0xBBED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x932A, 0x18A3, 0x18E5, 0x18E5, 0x18C5, 0x18E5, 
-0x2106, 0x2106, 0x2106, 0x10A4, 0x1063, 0x18C4, 0x2106, 0x20E6, 0x10A4, 0x18A4, 0x2106, 0x2927, 0x18C5, 0x3924, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x1082, 0x2126, 0x2106, 
-0x0863, 0x0884, 0x18E6, 0x2106, 0x2106, 0x18C5, 0x0842, 0x0042, 0x10A5, 0x18E6, 0x10A4, 0x1083, 0x2106, 0x2927, 0x18A3, 0x7A88, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4985, 
-0x18C5, 0x18C4, 0x2904, 0x6208, 0x41A8, 0x18E6, 0x10C6, 0x18E6, 0x4186, 0x61E7, 0x6208, 0x6A4A, 0x51C7, 0x1082, 0x0862, 0x18A3, 
-0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xB3CC, 0x4985, 0x0001, 0x5185, 0xCBED, 0xA32C, 0x51A8, 0x51A8, 0x726A, 0xA32B, 0xCBED, 0xD490, 0xED12, 0xA34B, 0x28E3, 
-0x4985, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x4985, 0x5A07, 0xE512, 0xDCB0, 0xAB2C, 0x928B, 0xAB4C, 0xD490, 0xE512, 0xEDB4, 0xFE76, 
-0xCC90, 0x4164, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x6268, 0xF615, 0xFDF5, 0xCC2F, 0x826A, 0xA36E, 0xEDD4, 0xF5F5, 
-0xEDD4, 0xFE56, 0xC4F1, 0x49A5, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x6268, 0xEDF5, 0xFE56, 0xCC90, 0x8A6B, 0xBC50, 
-0xFE36, 0xEDB4, 0xF615, 0xDD73, 0x6A89, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x5207, 0xEDD4, 0xFE56, 0xCC70, 
-0x7A4A, 0xA3AE, 0xEDF5, 0xEDB4, 0xFE56, 0xCCF1, 0x4165, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x72A9, 0xEDD5, 
-0xFE56, 0xDCF1, 0x59A6, 0x4146, 0xC491, 0xF615, 0xFE56, 0xD512, 0x49A5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x51E6, 
-0xCCF1, 0xFE36, 0xF5F5, 0xBC2E, 0x30E3, 0x30C4, 0xC471, 0xF615, 0xFE56, 0xD512, 0x4185, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8AE9, 0x51E6, 0xF5D4, 0xFDF5, 0xE4D1, 0x6A07, 0x0000, 0x7ACA, 0xF5B4, 0xF5F5, 0xED93, 0x9B4B, 0x4985, 0xABAC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6A47, 0x7B6C, 0xF677, 0xF616, 0xB3AD, 0x3903, 0x1881, 0x93EE, 0xFEF9, 0xFDF5, 0xBBCD, 0x4124, 0x8AEA, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5268, 0xDED9, 0xFFDD, 0xFF5B, 0x83AD, 0x59E6, 0x59E6, 0x9491, 0xFFFD, 0xFEF9, 0xB42F, 0x3924, 
-0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x5AA9, 0xF79C, 0xFFFE, 0xCDF6, 0x5A89, 0x9B2A, 0x6207, 0xA512, 0xFFFF, 0xFFFD, 
-0xCE16, 0x41C6, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x5289, 0xEF5B, 0xFFDE, 0x83CE, 0x6206, 0xC40D, 0x8AE9, 0x6B0A, 
-0xDED9, 0xFFFF, 0xD657, 0x49E6, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5268, 0xEF3A, 0xFFDD, 0x83AD, 0x59E6, 0xC40D, 
-0xC40D, 0x51C6, 0x9CD2, 0xFFFF, 0xD637, 0x41C6, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5269, 0xEF1A, 0xCE16, 0x5A48, 
-0x930A, 0xC40D, 0xC40D, 0x51A5, 0xA4F2, 0xFFFF, 0xCE16, 0x41A5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x5A27, 0xA512, 0xFFDD, 
-0x8BEE, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 0xA512, 0xFFFF, 0xD637, 0x49E7, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5268, 
-0xEF7B, 0xFFFF, 0x8C2F, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5A89, 0xE6F9, 0xFFFE, 0x9C91, 0x6227, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x5269, 0xF79D, 0xFFFF, 0x8C4F, 0x1882, 0x7AA8, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0xA512, 0xFFDD, 0x8C2F, 0x20C2, 0x9B4B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x932A, 0x4A28, 0xE6F9, 0xC616, 0x39A6, 0x0000, 0x1041, 0x7A88, 0xC40D, 0xB3CC, 0x4164, 0x4A28, 0x62EA, 0x2903, 
-0x1061, 0x49A5, 0xAB8C, 0xBBED, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x932A, 0x20E3, 0x4207, 0x2944, 0x0000, 0x0841, 0x0861, 0x1061, 0x3123, 0x3103, 0x1061, 0x0840, 
-0x1061, 0x20E3, 0x2903, 0x18C2, 0x28E3, 0x28E3, 0x51A5, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x1061, 0x0000, 0x0000, 0x0841, 0x1061, 0x1061, 0x0841, 0x0841, 0x0841, 
-0x0840, 0x18A2, 0x2903, 0x20E3, 0x2903, 0x2903, 0x20C2, 0x20C2, 0x1082, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_attack_right_3.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_attack_right_3_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x9B4B, 0xC40D, 0xA36B, 0x49A5, 0x4184, 0x41A5, 0x49C5, 0x49C5, 0x49E5, 
-0x41C5, 0x5A06, 0x9B4B, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x51C5, 0x41A5, 0x6A27, 0x6267, 0xB4ED, 0xDE11, 0xD5D0, 0xCD4F, 
-0xBCCE, 0xB4CE, 0xCD6F, 0x8BCB, 0x3985, 0x59E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x5A06, 0xBD4E, 0xC56F, 0x72E8, 0xB4ED, 0xFFD5, 0xFFD5, 
-0xF6D3, 0xDDD1, 0xD590, 0xDDB1, 0xEE32, 0xDDB0, 0xCD70, 0xA44C, 0x6247, 0x930A, 0x930A, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x5A06, 0xB54E, 0xFFF5, 0xF6F3, 0xC591, 0xE652, 
-0xFF13, 0xDE31, 0xBD0F, 0xCD70, 0xE631, 0xE611, 0xB4AF, 0xBCCF, 0xFEB3, 0xD5D0, 0x7309, 0x51E7, 0x5207, 0x6A27, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x7B89, 0xFFB4, 0xFF53, 0xE672, 
-0x9D53, 0x9D32, 0xCD4F, 0xBCAE, 0xC52F, 0xF712, 0xFF94, 0xC52E, 0x7AEA, 0x938D, 0xCD70, 0x8369, 0x7B0A, 0xF636, 0xE5B4, 0x51E6, 
-0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x51E6, 0xBD4E, 0xFF13, 
-0xE5D0, 0xAC6E, 0x5B2E, 0x4BB0, 0x8450, 0xB4AE, 0xE5F0, 0xFEF2, 0xFF13, 0x7B49, 0x5207, 0xBC91, 0xB470, 0x3985, 0x72CA, 0xFE97, 
-0xFE77, 0x9BAD, 0x59E6, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x7308, 
-0xF692, 0xE5F1, 0xA40E, 0x622A, 0x2108, 0x19EC, 0x6410, 0xC591, 0xEE11, 0xF672, 0xBCEE, 0x5A67, 0x9BAD, 0xFE77, 0xBC51, 0x18A3, 
-0x72CA, 0xFE15, 0xFE56, 0xE594, 0x51C6, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6A27, 0x7329, 0xEE32, 0xC4EF, 0x832C, 0x524B, 0x21AA, 0x324C, 0x7BEF, 0xAC8F, 0xDDD0, 0xF692, 0x7B49, 0x49C6, 0xC44F, 0xED32, 
-0xC470, 0x49C7, 0x6AA9, 0xF5F5, 0xFE97, 0xEDD4, 0x5207, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6A27, 0x7B29, 0xE5F1, 0xBCAF, 0x7B0C, 0x3A2B, 0x3AEE, 0x8C70, 0xA40E, 0x8B2C, 0xCD50, 0xF672, 0x7329, 0x4144, 
-0x71E7, 0x4965, 0x82C9, 0x82EB, 0x49E7, 0xB44F, 0xFE36, 0xF677, 0x9C90, 0x5A07, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x6AE8, 0xD590, 0xBCCF, 0x832C, 0x3A2B, 0x4AAB, 0xA44D, 0xAC4E, 0x7B0C, 0xB48E, 0xDDD1, 
-0x7B4A, 0x20E3, 0x28C4, 0x30A4, 0x7209, 0x9B2C, 0x5A08, 0x5206, 0x832B, 0xC533, 0xC594, 0x4A07, 0x9B2A, 0xC40D, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x59E6, 0x836A, 0xBCCF, 0x8B6D, 0x522A, 0x41A7, 0x9BCB, 0xB4AF, 0x7B0C, 
-0x93CD, 0xC530, 0x7B09, 0x4227, 0x6B0D, 0x81EB, 0xBB4E, 0xD491, 0x7AEA, 0x51A5, 0x3944, 0x6ACB, 0x9C30, 0x5207, 0x7A88, 0x6207, 
-0x49A5, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x5A67, 0xC510, 0x8B4D, 0x51A9, 0x3925, 0x7B09, 
-0xC510, 0xA40E, 0x834C, 0xB48F, 0x6AC8, 0x5A89, 0xBC91, 0xAB2D, 0xC40F, 0xFE15, 0xCCD1, 0x51E6, 0x18A2, 0x5228, 0xCD94, 0x9C70, 
-0x5207, 0x8B6C, 0xAC2E, 0x6207, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x6AE8, 0xD5B1, 0x93AD, 0x5A09, 
-0x3105, 0x3144, 0x83AB, 0xC4EF, 0xA38D, 0x934D, 0x62A9, 0x6AA9, 0xD4F1, 0xE573, 0xDD53, 0xF615, 0xFE56, 0x6A89, 0x0000, 0x5228, 
-0xEEB8, 0xCE36, 0x5A89, 0xC490, 0xFEF9, 0x9BCD, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x59E6, 0x93CB, 0xDDB1, 
-0xA40D, 0x5A08, 0x4167, 0x4167, 0x3986, 0x834A, 0xBBCD, 0x9AEB, 0x934D, 0xCCF1, 0xF5F5, 0xF615, 0xEDD4, 0xF5F5, 0xFE36, 0x6A89, 
-0x0000, 0x5248, 0xE678, 0xB594, 0x4A07, 0xAC0E, 0xFF39, 0xC4B1, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x6287, 
-0xD590, 0xCD30, 0x8B8C, 0x3945, 0x49A8, 0x72AC, 0x3947, 0x3945, 0xA36C, 0xC3AD, 0xC42F, 0xF5F5, 0xF615, 0xEDB4, 0xEDD4, 0xF5F5, 
-0xD532, 0x5A07, 0x20A2, 0x5208, 0xDE57, 0xCE16, 0x6AEB, 0x936C, 0xFE77, 0xCCF1, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x5A06, 0xA44C, 0xE5F1, 0xAC6F, 0x6249, 0x3926, 0x51E8, 0x72AC, 0x4188, 0x3965, 0xABED, 0xD44F, 0xBBCD, 0xE553, 0xFE36, 0xFE36, 
-0xFE57, 0xFE77, 0x7B0A, 0x4985, 0x4144, 0x6289, 0xCDB5, 0xF75A, 0xA4F2, 0x6289, 0xBC6F, 0xA3ED, 0x6207, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x5226, 0xBCEF, 0xB48F, 0x6A8A, 0x4166, 0x51E8, 0x624A, 0x728C, 0x4187, 0x39A6, 0xBCB0, 0xE4F1, 0xBB6C, 0xA34C, 
-0x8B2B, 0x832B, 0x8B4B, 0x8B4B, 0x4185, 0x20C3, 0x72EA, 0xACD2, 0xCDF5, 0xFF9B, 0xB574, 0x62A9, 0x7B2B, 0x5A27, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3945, 0xA42F, 0x93AD, 0x3925, 0x4167, 0x6A6B, 0x6A6B, 0x624A, 0x3125, 0x3944, 0xAC0E, 0xED73, 
-0xDCF1, 0xA3EE, 0x5AAA, 0x5269, 0x5A89, 0x5A89, 0x83AD, 0xB4F2, 0xDE36, 0xEED9, 0xE6B8, 0xFF7B, 0xB533, 0x62EA, 0x7BAD, 0x4A07, 
-0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3924, 0x6A8A, 0x9BCE, 0x6269, 0x4987, 0x5A09, 0x728C, 0x51E9, 0x20C3, 0x40E3, 
-0x930A, 0xDD94, 0xF6B8, 0xDE78, 0xD677, 0xD657, 0xD657, 0xDE77, 0xEED9, 0xF71A, 0xEEF9, 0xF73A, 0xDE98, 0x8C2F, 0x62CA, 0x7BAD, 
-0x62EA, 0x6A68, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x3944, 0x6AAA, 0x832C, 0x4166, 0x51A8, 0x624B, 0x3966, 
-0x3904, 0x5964, 0x8AEA, 0xCDF5, 0xEEF9, 0xE6B8, 0xEEF9, 0xF71A, 0xFF3A, 0xDE57, 0xBD33, 0x8BEE, 0x62EA, 0x6B2B, 0x62CA, 0x3985, 
-0x83AD, 0xB553, 0x49E7, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB6B, 0x3945, 0x2905, 0x20C3, 0x49C8, 
-0x5A0A, 0x20C3, 0x5164, 0x71C6, 0x8AEA, 0xDE57, 0xDE78, 0xACB1, 0xAC91, 0xB4F2, 0xB513, 0x7B2C, 0x3144, 0x3145, 0x3965, 0x3124, 
-0x3985, 0xACB1, 0xEED9, 0x7BAD, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x7268, 
-0x28E3, 0x49A8, 0x5A2A, 0x28E3, 0x5164, 0x71C6, 0x82EA, 0xDE36, 0xEF1A, 0xB513, 0x8B8D, 0x5A28, 0x2904, 0x2904, 0x41C6, 0x9C2F, 
-0xCDB5, 0xA430, 0xB4D1, 0xFF9B, 0xCE16, 0x3985, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x51C6, 0x49A8, 0x5A2A, 0x28E3, 0x4964, 0x7A07, 0x7227, 0xA3EE, 0xDE57, 0xDE98, 0x9C0F, 0x38E4, 0x1000, 0x2082, 
-0x6289, 0xCDD5, 0xF73A, 0xDE57, 0xEED9, 0xDE77, 0x6AEA, 0x7A68, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x4985, 0x51E8, 0x622A, 0x20C3, 0x5164, 0x8268, 0x6185, 0x4925, 0x6209, 0x7AEC, 0x59C8, 0x48E5, 
-0x61A6, 0x5165, 0x3103, 0x62A9, 0xA470, 0xDE57, 0xEED9, 0x62EA, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x4187, 0x5A2A, 0x2904, 0x4964, 0x7207, 0x4905, 0x2843, 0x3863, 0x5104, 
-0x4904, 0x5125, 0x7A27, 0x8A88, 0x3903, 0x0820, 0x3104, 0x730B, 0x8BCE, 0x3144, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x3924, 0x5A09, 0x51E9, 0x3104, 0x5165, 0x4905, 0x40E5, 
-0x61C6, 0x7A47, 0x7207, 0x5986, 0x5966, 0x61C6, 0x3924, 0x7248, 0xAB6B, 0x4985, 0x28E3, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x4187, 0x5A2A, 0x2904, 0x5164, 
-0x7A27, 0x69E7, 0x7207, 0x7207, 0x7227, 0x7207, 0x5986, 0x28A3, 0x6206, 0xC40D, 0xC40D, 0xB3AC, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x59C6, 0x3125, 
-0x3104, 0x4964, 0x7A48, 0x7A27, 0x7207, 0x7207, 0x7207, 0x7227, 0x7207, 0x4104, 0x59E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xABAC, 0x7268, 0x7248, 0x3924, 0x69E7, 0x8248, 0x7207, 0x7207, 0x7207, 0x7207, 0x7A27, 0x7207, 0x3903, 0x7268, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x59E6, 0x4124, 0x69C7, 0x7207, 0x7207, 0x7207, 0x7207, 0x7227, 0x7A28, 0x3924, 0x6227, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x28C3, 0x30A4, 0x6186, 0x7207, 0x7207, 0x7207, 0x7227, 0x7227, 
-0x3903, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x30E3, 0x4925, 0x5986, 0x69E7, 0x7207, 0x7207, 
-0x7227, 0x7227, 0x3903, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x3103, 0x69C6, 0x8248, 0x7207, 0x7207, 
-0x7207, 0x7207, 0x7227, 0x7A27, 0x3903, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x20C3, 0x69E7, 0x8248, 
-0x7207, 0x7207, 0x7207, 0x7207, 0x7A27, 0x7A27, 0x3903, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6207, 0x10A3, 0x2926, 
-0x4167, 0x4166, 0x4987, 0x6A07, 0x7207, 0x7207, 0x7227, 0x59C7, 0x20A3, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x10A3, 
-0x2127, 0x2127, 0x1906, 0x18E6, 0x2106, 0x3966, 0x4166, 0x3966, 0x4167, 0x3147, 0x1083, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 
-0x3103, 0x18E5, 0x2927, 0x2106, 0x2106, 0x2106, 0x2106, 0x1906, 0x10C5, 0x10C5, 0x18E6, 0x2106, 0x20E5, 0x28E3, 0x9B4B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6A27, 0x10A3, 0x2106, 0x2106, 0x2106, 0x20E5, 0x18C5, 0x2106, 0x2126, 0x18C5, 0x18A4, 0x2106, 0x2927, 0x2927, 0x10A3, 
-0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xABAC, 0x3104, 0x20E5, 0x2927, 0x2106, 0x2126, 0x18E5, 0x18A4, 0x20E5, 0x2127, 0x18E5, 0x18C4, 0x2106, 0x2106, 
-0x2106, 0x20E5, 0x20E4, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x10A3, 0x2106, 0x2106, 0x2106, 0x2126, 0x18E5, 0x18A4, 0x20E6, 0x2126, 0x2106, 0x18C5, 
-0x18C5, 0x2106, 0x18E5, 0x20E6, 0x2106, 0x18C3, 0x7AA8, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3124, 0x18E5, 0x18E5, 0x18E5, 0x2106, 0x2126, 0x18E5, 0x18A4, 0x2106, 0x2126, 
-0x2126, 0x18C5, 0x18C4, 0x2106, 0x18C5, 0x18C5, 0x2927, 0x2126, 0x1882, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x18A4, 0x2106, 0x18C4, 0x18E5, 0x2126, 0x2106, 0x20E6, 0x18C4, 
-0x18E5, 0x2126, 0x2126, 0x18C5, 0x18A4, 0x2106, 0x2106, 0x18C5, 0x18C5, 0x20E5, 0x20E3, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x18C4, 0x2127, 0x18C4, 0x18C4, 0x2106, 0x2106, 
-0x2106, 0x18E5, 0x10A4, 0x18E5, 0x2927, 0x18E5, 0x1063, 0x18C5, 0x2127, 0x18C5, 0x0862, 0x3124, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 0x18C4, 0x2127, 0x18A4, 0x1083, 
-0x18E5, 0x2106, 0x2126, 0x2106, 0x10A4, 0x1083, 0x18C5, 0x18C5, 0x0863, 0x1084, 0x2127, 0x2106, 0x0862, 0x7A88, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x18C4, 0x2927, 
-0x1083, 0x0841, 0x10C4, 0x18E6, 0x18E6, 0x2106, 0x18C5, 0x0842, 0x0863, 0x10A5, 0x3946, 0x3966, 0x2106, 0x18C5, 0x3924, 0xABAC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 
-0x20C3, 0x10A3, 0x3944, 0x3103, 0x4987, 0x3147, 0x10A5, 0x10E6, 0x3146, 0x59E7, 0x6A08, 0x72AB, 0xB450, 0xABCE, 0x3946, 0x3924, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8AE9, 0x7A88, 0xA36B, 0x59C6, 0xA3CD, 0xB430, 0x72AA, 0x59E8, 0x6A09, 0xBBEE, 0xE511, 0xED73, 0xFE36, 0xFDF5, 
-0x7289, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49A5, 0xBCB0, 0xFE97, 0xED32, 0xA30C, 0x8A8B, 0xD4F2, 0xFE35, 0xF5F5, 
-0xF5F5, 0xF615, 0x72EA, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4185, 0xB470, 0xFE97, 0xEDB3, 0xA32C, 0x930D, 0xE594, 
-0xF615, 0xEDD4, 0xF615, 0xA40E, 0x59E6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4185, 0xAC4F, 0xFE97, 0xED93, 0x9B0C, 
-0x828B, 0xD512, 0xF5F5, 0xF5F5, 0xFE15, 0x72C9, 0x7248, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x49C6, 0xBC90, 0xFE77, 
-0xFDD4, 0x9B4B, 0x30C4, 0x82EC, 0xEDB4, 0xFE15, 0xFE36, 0x7B0B, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x59E6, 0x8B6C, 
-0xF5F5, 0xFE16, 0xED53, 0x7268, 0x1021, 0x7AAB, 0xEDB4, 0xFE36, 0xFE36, 0x830B, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x4144, 0xB42F, 0xFE56, 0xED53, 0xB3AD, 0x1861, 0x2903, 0xCCB1, 0xFE15, 0xF5D4, 0xCCB0, 0x59C6, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA34B, 0x5227, 0xC553, 0xFE98, 0xD4F1, 0x7248, 0x18A2, 0x39A5, 0xE615, 0xFEB8, 0xE512, 0x7227, 0x51C6, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x51E6, 0x9CD1, 0xFFDD, 0xFFBC, 0xCDD5, 0x51E6, 0x6A47, 0x5A68, 0xE71A, 0xFFBC, 0xEDD5, 0x6228, 0x6A27, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4185, 0xBDB4, 0xFFFF, 0xEF1A, 0x8C0F, 0x7268, 0x930A, 0x5AA9, 0xEF7C, 0xFFFE, 0xFF5B, 
-0x7BAD, 0x5A06, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49A5, 0xAD33, 0xFFFF, 0xCE16, 0x41A6, 0xABAC, 0xBBED, 0x5A07, 0xAD33, 
-0xFFDD, 0xFFDD, 0x83CE, 0x5A06, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0xA512, 0xFFFF, 0xCDF6, 0x3985, 0xAB8C, 0xC40D, 
-0x930A, 0x5269, 0xEF5B, 0xFFDE, 0x7BAD, 0x5A06, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x51C6, 0xAD53, 0xFF7B, 0x7B8D, 0x6227, 
-0xBBED, 0xC40D, 0x930A, 0x5268, 0xF77C, 0xFFDE, 0x736C, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x6B0B, 0xEF5B, 0xD657, 
-0x41A5, 0xABAC, 0xC40D, 0xC40D, 0x8AEA, 0x5A89, 0xEF7B, 0xFFDE, 0x83CE, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49A5, 0xAD33, 
-0xFFFF, 0xDE77, 0x49E6, 0xA36B, 0xC40D, 0xC40D, 0xBBCD, 0x6227, 0x9CB1, 0xFFFE, 0xE6D9, 0x5A89, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x51C6, 0xB574, 0xFFFF, 0xDE98, 0x39A6, 0x4165, 0xB3CC, 0xC40D, 0xC40D, 0x9B4B, 0x5268, 0xF77B, 0xD678, 0x41E7, 0x59C6, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x51C6, 0xA4D2, 0xEF5B, 0x738D, 0x1061, 0x0000, 0x4165, 0xAB8C, 0xC40D, 0x7AA8, 0x2924, 0x630B, 0x4A07, 0x1881, 
-0x20C2, 0x82A9, 0xBBED, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x3185, 0x41E7, 0x0861, 0x0000, 0x1061, 0x0841, 0x28C2, 0x3924, 0x20A2, 0x0840, 0x1040, 
-0x18A2, 0x2903, 0x20E3, 0x20C2, 0x2903, 0x3123, 0x7AA8, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x0000, 0x0000, 0x0020, 0x1061, 0x1061, 0x0861, 0x0841, 0x0841, 0x0020, 
-0x1061, 0x20E3, 0x2903, 0x2903, 0x2903, 0x20E3, 0x20C2, 0x18C2, 0x28E3, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
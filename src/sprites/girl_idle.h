@@ -1,289 +0,0 @@
-// Total bitmap data size: 8840 bytes
-
-// girl_idle_1.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_idle_1_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x9B4B, 0xBBCD, 0xBBED, 0x6207, 0x4184, 0x41A5, 0x41A5, 0x49C5, 0x49C5, 0x49C5, 
-0x51C5, 0x82A9, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x41A5, 0x51C6, 0x6227, 0x8BEA, 0xDDF0, 0xDDF0, 0xD58F, 0xBD0E, 
-0xB4AE, 0xCD6F, 0xAC8D, 0x5226, 0x4185, 0x82A9, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7248, 0x83CA, 0xDE11, 0x836A, 0x8BCA, 0xF733, 0xFFF5, 0xFF53, 
-0xE612, 0xD591, 0xD591, 0xE612, 0xE5F1, 0xD590, 0xAC8D, 0x62E7, 0x49C5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x83AA, 0xFF73, 0xFFB4, 0xD5D1, 0xD5D1, 0xFF12, 
-0xEEB2, 0xC54F, 0xC52F, 0xDE11, 0xE631, 0xC530, 0xAC6E, 0xDDD1, 0xFEF3, 0xFF73, 0xC5AF, 0x5206, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x49E5, 0xEEB2, 0xFFD5, 0xFED2, 0xB5B2, 
-0x9512, 0xC570, 0xC4EE, 0xBCCF, 0xE671, 0xFFB4, 0xE651, 0x8B8B, 0x7AEC, 0xB48F, 0xEE71, 0xFF74, 0xFF54, 0xBD0E, 0x5A06, 0x9B2A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6206, 0x8BCA, 0xFED2, 0xF672, 
-0xC50F, 0x736D, 0x434F, 0x7430, 0xA46F, 0xD56F, 0xF6B2, 0xFF54, 0xB4CD, 0x49C6, 0x938D, 0xBC91, 0xAC6E, 0xDDF0, 0xF672, 0xFEB3, 
-0x838A, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x49C5, 0xDDB0, 
-0xF692, 0xBCAF, 0x7AEB, 0x3948, 0x114A, 0x3B4F, 0xA511, 0xE5F0, 0xF672, 0xD5B0, 0x7309, 0x6AA9, 0xEDD4, 0xDD34, 0x832C, 0xBCEE, 
-0xE631, 0xDDD1, 0x7B2A, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 
-0x49E5, 0xCD8F, 0xDDD1, 0x938C, 0x628C, 0x31EB, 0x21CB, 0x636E, 0x9C6F, 0xD54F, 0xFEB2, 0xACAD, 0x41A5, 0x9B4C, 0xED52, 0xCC90, 
-0xA3AE, 0x9BED, 0xC530, 0xA42D, 0x49C5, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x9B2A, 0x4A05, 0xCD4F, 0xD570, 0x938C, 0x4A4B, 0x328D, 0x6BEF, 0xAC8F, 0x8B2C, 0xAC4E, 0xFE92, 0xA46D, 0x4185, 0x61A6, 
-0x59A6, 0x6207, 0x9B4C, 0x8B6D, 0xBCCF, 0x7329, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x49E5, 0xBCEE, 0xCD70, 0x93AD, 0x528C, 0x3A4B, 0x838C, 0xBCAE, 0x832C, 0x9BCD, 0xDDD1, 0xA46D, 
-0x3984, 0x20C3, 0x28C5, 0x5166, 0x92CB, 0x8B4C, 0x7B2A, 0x5A06, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x6287, 0xB4CE, 0xA40E, 0x6AAC, 0x3987, 0x72C9, 0xBCEF, 0x8B8D, 0x834C, 
-0xBD10, 0x9C0C, 0x4206, 0x5ACB, 0x7A6C, 0x9A6B, 0xD491, 0x9BAD, 0x4185, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x3964, 0xB48E, 0xA42E, 0x622A, 0x3926, 0x5A27, 0xB4AE, 
-0xB4AF, 0x8B4C, 0xA42E, 0x8BCB, 0x4A26, 0x9C0F, 0xBBEF, 0xAB2C, 0xED94, 0xEDB4, 0x7ACA, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x41C5, 0xC52F, 0xB4AF, 0x6A8B, 0x4167, 
-0x28E4, 0x62A8, 0xBCCF, 0xB40E, 0x932C, 0x7B2B, 0x5A68, 0xB42E, 0xED94, 0xD532, 0xE5B4, 0xFE97, 0xB46F, 0x4165, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA8, 0x62A7, 0xCD70, 0xC4F0, 
-0x6A89, 0x4167, 0x4988, 0x3145, 0x62A8, 0xB3ED, 0xAB2C, 0x8B0C, 0xB450, 0xEDB4, 0xF615, 0xF5F5, 0xEDB4, 0xFE77, 0xB44F, 0x4165, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x930A, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x49C5, 0xB4AD, 
-0xD5B1, 0xAC4E, 0x51E7, 0x3926, 0x6A6B, 0x51E9, 0x28E4, 0x7AA9, 0xCBEE, 0xBBAD, 0xE573, 0xFE36, 0xEDB4, 0xEDB4, 0xF5F5, 0xEDD4, 
-0x832B, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x3124, 0x49C6, 0x7AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7288, 
-0x7308, 0xD5B0, 0xCD30, 0x7B0B, 0x4146, 0x4987, 0x6A6B, 0x622A, 0x28E4, 0x7B0A, 0xDC90, 0xBB8C, 0xDCF1, 0xFE16, 0xFE56, 0xFE36, 
-0xFED8, 0xC4D1, 0x4185, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x938C, 0xEDB4, 0x72A9, 0x7A88, 0xC40D, 0xC40D, 
-0xC40D, 0x4184, 0xA42D, 0xC510, 0x834C, 0x49A7, 0x4987, 0x624A, 0x6A6B, 0x5A0A, 0x2905, 0x8B8C, 0xED73, 0xC3AD, 0xBBAD, 0xA3CD, 
-0x9BCD, 0x9BCD, 0xAC2F, 0x6AA9, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x59E6, 0xCCF1, 0xFF19, 0xDD52, 0x41A5, 
-0xA34B, 0xC40D, 0xC40D, 0x20A3, 0x834C, 0xAC4F, 0x51E7, 0x3105, 0x622A, 0x6A8B, 0x6A6B, 0x49A8, 0x28E3, 0x82EA, 0xF5B4, 0xE4F2, 
-0x7227, 0x5185, 0x6206, 0x51C6, 0x4985, 0x7247, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x8B6C, 0xFE15, 0xFE77, 
-0xEDD4, 0x49C6, 0x930A, 0xC40D, 0xC40D, 0x51C6, 0x41A7, 0x93AD, 0x7B0B, 0x4987, 0x51C8, 0x6A6B, 0x6A6B, 0x2905, 0x30C2, 0x71E7, 
-0xAB8D, 0xDDB4, 0x83AD, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x93AD, 
-0xFE97, 0xF615, 0x9BAD, 0x6207, 0xBBCD, 0xC40D, 0xC40D, 0xBBED, 0x59E6, 0x49C7, 0x8B6D, 0x5A08, 0x4166, 0x624A, 0x49C8, 0x30E4, 
-0x5165, 0x71E6, 0x936C, 0xDE57, 0xEEF9, 0x83CD, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x59E6, 0x938C, 0xFE97, 0x938C, 0x5A06, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x59E6, 0x3125, 0x20C3, 0x3925, 0x624B, 
-0x3125, 0x3903, 0x71C6, 0x7227, 0xB4F2, 0xEEF9, 0xF71A, 0xEED9, 0x83AD, 0x6207, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x4165, 0xCD12, 0xEDD5, 0x3985, 0x3944, 0x7A88, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x8AC9, 0x4164, 
-0x2904, 0x6A6B, 0x3125, 0x3903, 0x69C6, 0x7227, 0xBD33, 0xE6D9, 0xBD74, 0xDE57, 0xF71A, 0x83CE, 0x6207, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8AEA, 0x3965, 0xA470, 0xDE16, 0x93CD, 0x72A9, 0x9BCD, 0x7B0B, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x8AE9, 0x3125, 0x6A6B, 0x3146, 0x3903, 0x69C6, 0x7227, 0xC574, 0xDE78, 0xA450, 0xC594, 0xFF5B, 0xEED9, 0x83CE, 0x5A07, 
-0xBBED, 0xC40D, 0xC40D, 0x8AE9, 0x3104, 0xA491, 0xF71A, 0x840F, 0x6268, 0xDD53, 0xFF19, 0xEDD4, 0x41A5, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x3125, 0x6A8B, 0x3946, 0x3103, 0x69C6, 0x7A48, 0xB4B1, 0xB513, 0x9C0F, 0xCDD5, 0xEEF9, 0xEEF9, 
-0xEED9, 0x8C0E, 0x6247, 0xBBED, 0x930A, 0x3965, 0x834C, 0xCDD5, 0xCE16, 0x5A89, 0x936C, 0xFE77, 0xFE97, 0xCCF1, 0x4185, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x3125, 0x624A, 0x3125, 0x3903, 0x7A27, 0x69E7, 0x6208, 0x6A6A, 0x72CB, 0x93EF, 
-0xD616, 0xEED9, 0xEEF9, 0xEEB9, 0x7B8D, 0x3924, 0x3124, 0xA470, 0xE677, 0xC594, 0x62CA, 0x6AA9, 0xE593, 0xFE97, 0xD532, 0x6248, 
-0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x59E6, 0x4187, 0x4187, 0x3924, 0x69E7, 0x5145, 0x2843, 0x40E5, 
-0x4946, 0x4105, 0x836D, 0xD636, 0xEEF9, 0xD616, 0x93CE, 0x6269, 0x9C2F, 0xE6B8, 0xFFBC, 0xC5B5, 0x3185, 0x6A89, 0xF5F6, 0xD532, 
-0x5A27, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x932A, 0x3104, 0x5A09, 0x3966, 0x4964, 0x5966, 
-0x40C4, 0x5965, 0x6186, 0x38A3, 0x38A4, 0x8BAE, 0xEEF9, 0xD616, 0x93CE, 0xB4D2, 0xE698, 0xFF5A, 0xD636, 0x7B6C, 0x6289, 0x7B0B, 
-0x72EB, 0x51E6, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x3946, 0x2904, 
-0x3923, 0x61C6, 0x71E7, 0x7227, 0x7A48, 0x69C6, 0x3863, 0x4126, 0xB513, 0xEF19, 0xDE57, 0xDE57, 0xEEF9, 0xD616, 0x736C, 0x41A6, 
-0x5A49, 0x49C6, 0x3944, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7A88, 0x7A88, 0x4985, 0x5185, 0x8A88, 0x7227, 0x7207, 0x7A27, 0x69C6, 0x38A3, 0x5187, 0xB533, 0xF75A, 0xF75A, 0xFF9B, 0x944F, 
-0x20E3, 0x3124, 0x4985, 0x82C9, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x3903, 0x59A6, 0x7207, 0x7207, 0x7207, 0x7A47, 0x61A6, 0x3863, 0x4967, 0xBD54, 0xDE77, 
-0xA4F2, 0x5228, 0x4144, 0x82C9, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x2062, 0x5146, 0x69E7, 0x7207, 0x7207, 0x7A27, 0x61A6, 0x40C4, 
-0x6A49, 0x6ACA, 0x51C6, 0x82C9, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x4144, 0x4104, 0x5146, 0x69C7, 0x7227, 0x7207, 0x7207, 
-0x7227, 0x7A27, 0x4924, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x4964, 0x8248, 0x7207, 0x7207, 0x7207, 
-0x7207, 0x7207, 0x7227, 0x8248, 0x5186, 0x20C3, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x20C3, 0x51A6, 0x8248, 0x7A27, 
-0x7207, 0x7207, 0x7207, 0x7207, 0x7A27, 0x69E7, 0x4187, 0x18C4, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x20C3, 0x18E5, 0x3967, 
-0x61E7, 0x7207, 0x7207, 0x7207, 0x7207, 0x69E7, 0x4987, 0x3146, 0x2127, 0x1906, 0x20C3, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x20C3, 0x2106, 
-0x2127, 0x2106, 0x3126, 0x4166, 0x3966, 0x3966, 0x4166, 0x3946, 0x2106, 0x18E6, 0x2106, 0x2927, 0x18A4, 0x51C6, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 
-0x18A3, 0x2927, 0x2926, 0x2106, 0x18C5, 0x18C5, 0x1906, 0x18E6, 0x10C5, 0x18E6, 0x2106, 0x2106, 0x20E5, 0x20E5, 0x18A4, 0x49A5, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8AE9, 0x20C3, 0x20E5, 0x2126, 0x2126, 0x2106, 0x18A4, 0x18C5, 0x2127, 0x18E5, 0x18A4, 0x18E5, 0x2126, 0x2126, 0x18C5, 0x18C4, 
-0x2106, 0x18C3, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7A88, 0x1083, 0x2127, 0x2126, 0x2106, 0x2106, 0x18C4, 0x18E5, 0x2127, 0x20E5, 0x18C4, 0x20E5, 0x2126, 0x2126, 
-0x18E5, 0x18C4, 0x2126, 0x18A4, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x6206, 0x10A3, 0x2126, 0x2106, 0x2106, 0x2106, 0x18C4, 0x18E5, 0x2127, 0x20E6, 0x18A4, 0x18E5, 
-0x2106, 0x2126, 0x18E5, 0x1083, 0x18C5, 0x18C4, 0x49A5, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x18A3, 0x2106, 0x2126, 0x2106, 0x2106, 0x2106, 0x18C4, 0x18E5, 0x2927, 0x2106, 
-0x1083, 0x10A4, 0x2106, 0x2127, 0x20E5, 0x1083, 0x18C4, 0x2106, 0x18A3, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A68, 0x1083, 0x2126, 0x2127, 0x2106, 0x2106, 0x2106, 0x18C4, 0x18C4, 
-0x2106, 0x2106, 0x18A4, 0x10A4, 0x2106, 0x2127, 0x2106, 0x18C5, 0x18C4, 0x2106, 0x18C4, 0x4165, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x1083, 0x2106, 0x2126, 0x2106, 0x2106, 0x2106, 
-0x10A4, 0x1063, 0x18E5, 0x2927, 0x18E5, 0x10A4, 0x18C5, 0x2106, 0x2127, 0x18E5, 0x1083, 0x18C5, 0x2106, 0x18A3, 0x7268, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x1083, 0x2127, 0x2927, 0x2106, 
-0x2106, 0x18E6, 0x0863, 0x0042, 0x18C5, 0x2127, 0x18E6, 0x0843, 0x0863, 0x18E6, 0x2927, 0x20E5, 0x1083, 0x18C5, 0x2927, 0x10A3, 
-0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x3924, 0x18E5, 
-0x2927, 0x2106, 0x10C5, 0x18E6, 0x4987, 0x59E7, 0x2926, 0x10C5, 0x2106, 0x59C7, 0x51A7, 0x2106, 0x2107, 0x18E5, 0x0841, 0x18A4, 
-0x2927, 0x10A3, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x3124, 0x1083, 0x49A7, 0x728A, 0x7249, 0xAB4C, 0xC3CD, 0x7A8A, 0x4167, 0x7249, 0xC3CD, 0xBBAD, 0x59E8, 0x10A3, 0x20E3, 
-0x6A27, 0x4165, 0x10A3, 0x0862, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3103, 0x6A07, 0xCBEE, 0xC3CD, 0xD490, 0xE512, 0xBBAE, 0x824A, 0xA30B, 0xCC2E, 0xF573, 0xABEE, 
-0x20A2, 0x8AE9, 0xC40D, 0xAB8C, 0x6207, 0x6207, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x51A5, 0x92CA, 0xDCB1, 0xEDD4, 0xFE35, 0xCCB1, 0x8AAB, 0x9ACB, 0xCC4F, 
-0xFE36, 0xB490, 0x51A5, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x830A, 0xFE36, 0xF5F5, 0xF615, 0xDD33, 0x8ACC, 
-0x9AEB, 0xED73, 0xD532, 0x6248, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x7B2B, 0xF615, 0xF5D4, 0xF615, 
-0xDD53, 0x8AAB, 0xA32C, 0xFE56, 0xB470, 0x4185, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x51C6, 0xA3EE, 
-0xFE36, 0xF615, 0xD4F2, 0x828B, 0xA32C, 0xFE56, 0xCCF1, 0x4165, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x59C6, 0x938C, 0xFE77, 0xFE35, 0xCC50, 0x7A09, 0xAB8D, 0xFE56, 0xAC2F, 0x51A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6A47, 0x730A, 0xEDD4, 0xF5B4, 0xDD32, 0x9B2C, 0x8229, 0xC40F, 0xAC0E, 0x5A27, 0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x9CB1, 0xFF5A, 0xDCD1, 0x9ACA, 0x59C6, 0x92CA, 0x9B2B, 0x51A5, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x8C90, 0xFFFD, 0xE5D5, 0xA36C, 0x4165, 0x4965, 0x59E6, 0xB3AC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 0x8C2F, 0xFFFE, 0xFF5B, 0xCDD5, 0x41C6, 0x4144, 0xB3AC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x49C6, 0x9CB1, 0xEF3A, 0xFFFD, 0xD677, 0x4A07, 0x9B2A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x5227, 0xAD33, 0xBD33, 0xCDD5, 0xFFFE, 0xDE77, 
-0x4A07, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x5A48, 0xCE36, 0xFF9C, 0xBD13, 0xCDD5, 
-0xFFFF, 0xD657, 0x41C6, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x3103, 0x736C, 0xFF9C, 0xEED9, 
-0x83AD, 0xA4D2, 0xFFFE, 0xDE78, 0x5227, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0000, 0x3185, 
-0x6B0B, 0x62CA, 0x51C6, 0x5A48, 0xDE98, 0xFFFE, 0xA4F2, 0x5A07, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2B, 0x28E3, 
-0x0861, 0x0020, 0x0000, 0x0820, 0x82C9, 0x6A47, 0x9CB1, 0xFFDD, 0x9490, 0x20C3, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8AC9, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x6A47, 0x59C6, 0x4207, 0x62EA, 0x2924, 0x1061, 0x4985, 0xAB8B, 0xBBED, 0xBBED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x7268, 0x28E3, 0x1081, 0x0861, 0x0861, 0x20A2, 0x1881, 0x0820, 0x1061, 0x20C2, 0x2903, 0x20C2, 0x28E3, 
-0x28E3, 0x49A5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x51A5, 0x0841, 0x1061, 0x0841, 0x0820, 0x18A2, 0x2903, 0x20E3, 0x2903, 
-0x2903, 0x20C2, 0x20C2, 0x1882, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_idle_2.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_idle_2_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 
-0x82A9, 0x51C5, 0x49C5, 0x49C5, 0x49C5, 0x41A5, 0x41A5, 0x4184, 0x6206, 0xC3ED, 0xBBED, 0x9B4B, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 
-0x82A9, 0x4985, 0x5226, 0xACAD, 0xCD4F, 0xB4AE, 0xBD0E, 0xCD8F, 0xDDF0, 0xDE10, 0x8BEA, 0x6227, 0x51C6, 0x41A5, 0x7268, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA36B, 0x49C5, 0x62C7, 0xAC8D, 0xD590, 0xE5F1, 0xE611, 0xD591, 0xD591, 0xE612, 0xFF53, 0xFFF5, 0xF733, 0x8BCA, 0x836A, 0xDE11, 
-0x83CA, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA36B, 0x5206, 0xCDAF, 0xFF73, 0xFEF3, 0xDDD1, 0xAC6E, 0xC530, 0xEE31, 0xDE11, 0xBD2F, 0xC54F, 0xEEB2, 0xFF13, 0xD5D1, 
-0xD5D1, 0xFFB4, 0xFF73, 0x83A9, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x9B2A, 0x5A06, 0xBD0E, 0xFF54, 0xFF74, 0xEE51, 0xB48F, 0x7AEC, 0x8B8B, 0xE631, 0xFFB4, 0xE671, 0xBCCE, 0xC4EE, 
-0xC570, 0x9512, 0xB5B2, 0xFED2, 0xFFD5, 0xEEB2, 0x49E5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x8B8A, 0xFEB3, 0xF672, 0xDDF0, 0xAC6E, 0xBC91, 0x938D, 0x49E6, 0xB4CD, 0xFF54, 0xF6B2, 
-0xD56F, 0xA46F, 0x7431, 0x434F, 0x736D, 0xC50F, 0xF672, 0xFED2, 0x8BCA, 0x6206, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x7B2A, 0xDDD1, 0xE631, 0xBCEE, 0x832C, 0xDD34, 0xEDD4, 0x6AA9, 0x7309, 
-0xD5B0, 0xF652, 0xE5F0, 0xA511, 0x3B2F, 0x114A, 0x3948, 0x7AEB, 0xB4AF, 0xF692, 0xD5B0, 0x49C5, 0x9B2B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x49A5, 0xA44D, 0xC530, 0x9BCD, 0xA3CE, 0xCC90, 0xED52, 
-0x9B4C, 0x41A5, 0xACAD, 0xFE92, 0xCD4F, 0x9C4F, 0x636E, 0x21CB, 0x31EB, 0x628B, 0x938C, 0xDDD1, 0xD58F, 0x49E5, 0x9B2A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x7B29, 0xB4CF, 0x8B6D, 0x9B4C, 
-0x6206, 0x59A6, 0x61A6, 0x4185, 0xA46D, 0xF692, 0xAC4E, 0x8B2C, 0xACAF, 0x6BEF, 0x328D, 0x4A4B, 0x938C, 0xD570, 0xCD4F, 0x4A05, 
-0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x5A06, 0x7B2A, 
-0x8B4C, 0x92CB, 0x5166, 0x28C5, 0x20A3, 0x3984, 0xA46D, 0xDDB1, 0x9BCD, 0x832C, 0xBCAE, 0x838C, 0x3A4B, 0x528C, 0x93AD, 0xCD70, 
-0xBCEE, 0x49E5, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x9B2A, 0x4185, 0xA3AD, 0xD491, 0x9A6B, 0x7A6C, 0x5ACB, 0x4206, 0x9C0C, 0xBD0F, 0x834C, 0x8B8D, 0xBCEF, 0x72C9, 0x3987, 0x6AAC, 
-0xA40E, 0xB4AE, 0x6287, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7268, 0x7ACA, 0xEDB4, 0xED94, 0xAB2C, 0xBC0F, 0x9C0F, 0x4A26, 0x8BCB, 0xA42E, 0x8B4C, 0xB4AF, 0xB4AE, 0x5A27, 
-0x3926, 0x622A, 0xA42E, 0xAC8E, 0x3964, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4185, 0xB46F, 0xFEB7, 0xE5B4, 0xD532, 0xED94, 0xB42E, 0x5A68, 0x7B2B, 0x932C, 0xB42E, 0xBCCF, 
-0x62A8, 0x28E3, 0x4167, 0x6A8B, 0xB4AF, 0xC52F, 0x41A5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x932A, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4165, 0xB44F, 0xFE77, 0xEDB4, 0xF5F5, 0xF615, 0xEDB4, 0xB44F, 0x8B0C, 0xAB2C, 
-0xB3ED, 0x62A8, 0x3145, 0x4988, 0x4167, 0x6A89, 0xC510, 0xCD70, 0x62A7, 0x7AA8, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 
-0x49C6, 0x3144, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x832B, 0xEDD4, 0xF5F5, 0xEDB4, 0xEDB4, 0xFE36, 0xE573, 
-0xBBAD, 0xCBEE, 0x7AA9, 0x28E4, 0x51E9, 0x6A8B, 0x3926, 0x51C7, 0xAC4E, 0xD5B1, 0xB4AD, 0x49A5, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 
-0x7A88, 0x72C9, 0xEDB4, 0x938C, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x4185, 0xC4D1, 0xFED8, 0xFE36, 0xFE56, 
-0xFE16, 0xDCF1, 0xBB8C, 0xD490, 0x7B0A, 0x28E4, 0x622A, 0x6A6B, 0x4987, 0x4146, 0x7B0B, 0xCD30, 0xD5B0, 0x7308, 0x7288, 0xC40D, 
-0xC40D, 0xA34B, 0x41A5, 0xDD53, 0xFF19, 0xCCF1, 0x51E6, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x6AA9, 0xAC2F, 
-0x9BCD, 0x9BCD, 0xABED, 0xBBAD, 0xC3CD, 0xED73, 0x8B8C, 0x2905, 0x5A2A, 0x6A6B, 0x622A, 0x4987, 0x49A7, 0x834C, 0xC510, 0xA42D, 
-0x4185, 0xC40D, 0xC40D, 0x930A, 0x49C6, 0xEDD4, 0xFE97, 0xFE15, 0x8B6C, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x7247, 0x4985, 0x51C5, 0x6206, 0x51A5, 0x7227, 0xE512, 0xF5B4, 0x82EA, 0x28E3, 0x49A8, 0x6A6B, 0x6A8B, 0x622A, 0x3105, 0x51E8, 
-0xAC4F, 0x834C, 0x20C3, 0xC40D, 0xC40D, 0xBBCD, 0x6207, 0x9BAD, 0xF615, 0xFE97, 0x93AD, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 0x83AD, 0xDDB4, 0xAB8C, 0x71E7, 0x30C2, 0x2905, 0x6A6B, 0x6A6B, 0x51C8, 
-0x4987, 0x7B0B, 0x93AD, 0x41A7, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x938C, 0xFE77, 0x938C, 0x59E6, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x83AD, 0xEEF9, 0xDE57, 0x936C, 0x71E6, 0x5164, 0x3104, 0x49C8, 
-0x624A, 0x4146, 0x5A08, 0x8B4D, 0x49C7, 0x59E6, 0xBBED, 0xC40D, 0xC40D, 0xB3AC, 0x7A88, 0x3944, 0x4185, 0xEDD5, 0xCD12, 0x4165, 
-0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x6207, 0x83AD, 0xEED9, 0xF71A, 0xEEF9, 0xB4F2, 0x7227, 0x71C6, 
-0x38E3, 0x3125, 0x624B, 0x3925, 0x20C3, 0x3105, 0x59E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x830B, 0x9BCD, 0x72A9, 0x93CD, 
-0xDE16, 0xA470, 0x3965, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6207, 0x83CE, 0xF719, 0xDE57, 0xBD74, 0xE6D9, 0xBD33, 
-0x7227, 0x69C6, 0x3903, 0x3145, 0x6A6B, 0x2904, 0x4164, 0x8AC9, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4185, 0xEDD4, 0xFF19, 
-0xDD53, 0x6268, 0x840E, 0xF71A, 0xA470, 0x3104, 0x8AE9, 0xC40D, 0xC40D, 0xBBED, 0x5A06, 0x83EE, 0xEED9, 0xFF5A, 0xC594, 0xA450, 
-0xDE78, 0xC574, 0x7227, 0x69C6, 0x3903, 0x3146, 0x6A6B, 0x3125, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4185, 
-0xCCF1, 0xFE97, 0xFE77, 0x936C, 0x5A89, 0xCE16, 0xCDB5, 0x834C, 0x3965, 0x930A, 0xBBED, 0x6247, 0x8C0E, 0xEED9, 0xEEF9, 0xEEF9, 
-0xCDD5, 0x9C0F, 0xB513, 0xB4B1, 0x7A48, 0x69C6, 0x38E3, 0x3946, 0x6A8B, 0x3125, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x8AC9, 0x6248, 0xD532, 0xFEB7, 0xE593, 0x6AA9, 0x62CA, 0xC594, 0xE677, 0x9C70, 0x3124, 0x3124, 0x7B8D, 0xEED9, 0xEEF9, 
-0xEED9, 0xD616, 0x93EF, 0x72CB, 0x6A8A, 0x6208, 0x69E7, 0x7A27, 0x3903, 0x3125, 0x624A, 0x3125, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x5A27, 0xD532, 0xF5F5, 0x6A89, 0x3185, 0xC5B5, 0xFFBC, 0xE6B8, 0x9C2F, 0x6269, 0x93CE, 
-0xD616, 0xEEF9, 0xD636, 0x836D, 0x4105, 0x4946, 0x40E5, 0x2843, 0x5145, 0x69E7, 0x3924, 0x4187, 0x4167, 0x59E6, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x92EA, 0x51E6, 0x72EB, 0x7B0B, 0x628A, 0x7B8C, 0xD636, 0xFF5B, 0xE698, 
-0xB4D1, 0x93CE, 0xD616, 0xEEF9, 0x8BAE, 0x38A4, 0x38A3, 0x6186, 0x5965, 0x40E4, 0x5966, 0x4944, 0x3966, 0x5A09, 0x2904, 0x932A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x3944, 0x49C6, 0x5A48, 0x41A6, 0x7B6C, 
-0xD616, 0xEEF9, 0xDE57, 0xDE57, 0xEF19, 0xB513, 0x4126, 0x3863, 0x69C6, 0x7A47, 0x7207, 0x71E7, 0x61C6, 0x3923, 0x2904, 0x3946, 
-0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x82C9, 0x4985, 
-0x3124, 0x28E3, 0x944F, 0xFF9B, 0xF75A, 0xF75A, 0xB533, 0x5187, 0x38A3, 0x69C6, 0x7A27, 0x7207, 0x7227, 0x8A68, 0x5185, 0x4985, 
-0x7288, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x82C9, 0x4144, 0x5228, 0xA4F2, 0xDE77, 0xBD34, 0x4967, 0x3883, 0x69C6, 0x7A27, 0x7207, 0x7207, 0x71E7, 0x59A6, 
-0x3903, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x82C9, 0x51C6, 0x6ACA, 0x6A49, 0x48C4, 0x61A6, 0x7A27, 0x7207, 0x7207, 0x69E7, 
-0x5146, 0x2062, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x4924, 0x7A27, 0x7227, 0x7207, 0x7207, 
-0x7227, 0x69E7, 0x5146, 0x4104, 0x4144, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x20C3, 0x5186, 0x8248, 0x7207, 
-0x7207, 0x7207, 0x7207, 0x7207, 0x7207, 0x8248, 0x4944, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x4985, 0x18C4, 0x4187, 
-0x69E7, 0x7A27, 0x7207, 0x7207, 0x7207, 0x7207, 0x7A27, 0x8248, 0x5186, 0x20E3, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x20C3, 
-0x1906, 0x2127, 0x3146, 0x4987, 0x69E7, 0x7207, 0x7207, 0x7207, 0x7207, 0x61E7, 0x3967, 0x18E6, 0x20C3, 0x8AEA, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x51C6, 0x18A4, 0x2927, 0x2106, 0x18E6, 0x2106, 0x3946, 0x4166, 0x3966, 0x3966, 0x4166, 0x3126, 0x2106, 0x2127, 0x2106, 0x20C3, 
-0x9B2B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x49A5, 0x18A4, 0x20E5, 0x20E5, 0x2106, 0x2106, 0x18E5, 0x10C5, 0x18E6, 0x1906, 0x10C5, 0x18C5, 0x2106, 0x2927, 
-0x2927, 0x10A3, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x18C3, 0x2106, 0x18C4, 0x18C5, 0x2126, 0x2126, 0x18E5, 0x10A4, 0x20E5, 0x2127, 0x18C5, 0x18A4, 
-0x2106, 0x2126, 0x2126, 0x2105, 0x20E3, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x18A4, 0x2126, 0x18C4, 0x18E5, 0x2106, 0x2126, 0x20E6, 0x18C4, 0x20E5, 0x2127, 
-0x18C5, 0x18C4, 0x2106, 0x2106, 0x2126, 0x2127, 0x1083, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x49A5, 0x18C4, 0x18C5, 0x1083, 0x18E5, 0x2126, 0x2106, 0x18C5, 0x18A4, 
-0x20E5, 0x2127, 0x18C5, 0x18C4, 0x2106, 0x2106, 0x2106, 0x2106, 0x18A3, 0x6207, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x18A3, 0x2106, 0x18C4, 0x1083, 0x20E5, 0x2127, 0x2106, 
-0x10A4, 0x1083, 0x20E6, 0x2927, 0x18E5, 0x18C4, 0x2106, 0x2106, 0x2106, 0x2126, 0x2106, 0x18C3, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4165, 0x18C5, 0x2106, 0x18A4, 0x18C5, 0x2106, 
-0x2126, 0x2106, 0x10A4, 0x18A4, 0x2106, 0x2106, 0x18C4, 0x18C4, 0x2106, 0x2106, 0x2106, 0x2126, 0x2127, 0x1083, 0x7A88, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x18A3, 0x2106, 0x18C5, 0x1083, 
-0x18E5, 0x2127, 0x2106, 0x18C5, 0x10A4, 0x18E5, 0x2927, 0x18E5, 0x1063, 0x10A4, 0x2106, 0x2106, 0x2106, 0x2126, 0x2106, 0x1083, 
-0x7AA8, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x10A3, 0x2927, 
-0x18C5, 0x1083, 0x20E5, 0x2927, 0x18E6, 0x0863, 0x0863, 0x18E5, 0x2127, 0x18C5, 0x0042, 0x0883, 0x18E6, 0x2106, 0x2106, 0x2927, 
-0x2127, 0x1083, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 
-0x10A3, 0x2927, 0x18A4, 0x0841, 0x18E5, 0x2107, 0x2106, 0x51A7, 0x59C7, 0x2106, 0x10C5, 0x2926, 0x59E7, 0x4987, 0x18E6, 0x10C5, 
-0x2106, 0x2927, 0x18E5, 0x3924, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6A27, 0x0862, 0x10A3, 0x4165, 0x6A27, 0x20E3, 0x10A3, 0x59E8, 0xBBAD, 0xC3CD, 0x6A49, 0x4167, 0x7A6A, 0xC3CD, 0xAB4C, 
-0x7269, 0x726A, 0x49A7, 0x1083, 0x3124, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x6207, 0x6207, 0xAB8C, 0xC40D, 0x8AE9, 0x20C2, 0xB3EE, 0xF553, 0xCC2E, 0xA30C, 0x824A, 0xBBAD, 
-0xE532, 0xD490, 0xCBCD, 0xD3EE, 0x6A07, 0x3103, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0xB490, 0xFE36, 0xCC4F, 0x9ACB, 
-0x8A8B, 0xCCB1, 0xFE35, 0xEDD4, 0xDCB1, 0x92CA, 0x51A5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x6248, 0xD512, 
-0xED73, 0x9B0B, 0x8ACC, 0xD553, 0xF615, 0xF5F5, 0xFE16, 0x82EA, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x4185, 0xB470, 0xFE56, 0xA32C, 0x8AAB, 0xDD53, 0xF615, 0xF5D4, 0xF615, 0x7B0B, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xB3CC, 0x4164, 0xCCF1, 0xFE56, 0xA32C, 0x828B, 0xD4F2, 0xF615, 0xFE36, 0xA3ED, 0x51C6, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51A5, 0xAC2F, 0xFE56, 0xAB8D, 0x7A09, 0xC450, 0xFE35, 0xFE77, 0x938C, 0x51C6, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x5A27, 0xAC0E, 0xC40F, 0x8229, 0x9B2C, 0xDD32, 0xF5B4, 0xEDD4, 0x730A, 
-0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x49A5, 0x9B2B, 0x92CA, 0x59C6, 0x9AEA, 0xDCD1, 
-0xFF5A, 0x9CB1, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x59E6, 0x4965, 0x4165, 
-0xA36C, 0xE5D5, 0xFFFD, 0x8C90, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 
-0x4144, 0x41C6, 0xCDD5, 0xFF7B, 0xFFFE, 0x8C2F, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x9B2A, 0x4A07, 0xD677, 0xFFDD, 0xEF3A, 0x9CB1, 0x49C6, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x4A07, 0xDE77, 0xFFFE, 0xC5D5, 0xBD33, 0xAD33, 0x5A27, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x41C6, 0xD657, 0xFFFE, 0xCDD5, 0xBD13, 0xFF9C, 0xCE16, 0x5A48, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x5227, 0xDE78, 0xFFFE, 0xA4D2, 0x83AD, 0xEED9, 0xFF9C, 
-0x736C, 0x3103, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x5A07, 0xA4F2, 0xFFFE, 0xDE98, 0x5A48, 0x51E6, 
-0x62CA, 0x6B0B, 0x3185, 0x0000, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x932A, 0x20E3, 0x9490, 0xFFDD, 0x9CB1, 
-0x6A47, 0x82C9, 0x0820, 0x0000, 0x0020, 0x0861, 0x28E3, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xBBCD, 0xAB6B, 0x4185, 0x1061, 0x2924, 
-0x62EA, 0x4207, 0x59E6, 0x6A27, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x4985, 0x28E3, 0x28E3, 0x20C2, 
-0x2903, 0x20C2, 0x1061, 0x0840, 0x1881, 0x18A2, 0x0861, 0x0861, 0x1081, 0x28E3, 0x7268, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x59C6, 0x18A2, 0x20C2, 
-0x20C2, 0x2903, 0x2903, 0x20E3, 0x2903, 0x18A2, 0x0820, 0x0841, 0x1061, 0x0841, 0x51A5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
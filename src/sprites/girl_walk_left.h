@@ -1,1441 +0,0 @@
-// Total bitmap data size: 44200 bytes
-
-// girl_walk_left_10.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_left_10_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 
-0x49A5, 0x4185, 0x49A5, 0x4985, 0x4985, 0x3964, 0x59E6, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 
-0x4985, 0x5226, 0xA44C, 0xB4AD, 0xB4AD, 0xBCEE, 0xBD0E, 0xC54F, 0x9C2B, 0x5A26, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 
-0x51C5, 0x5A87, 0x9C2C, 0xBD0F, 0xDDD1, 0xDDD1, 0xDDB1, 0xEE52, 0xFF33, 0xFFF5, 0xFFD5, 0xACAC, 0x51C6, 0xBBED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB3CC, 0x51E6, 0xBD6E, 0xFF53, 0xF692, 0xCD50, 0xBCCF, 0xE611, 0xD5D0, 0xB4AE, 0xCD70, 0xFF12, 0xFF33, 0xDE32, 0x8BAB, 0x59E6, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xABAC, 0x5A06, 0xB4CD, 0xFF54, 0xFF94, 0xE611, 0xAC2E, 0x7AEB, 0xB50E, 0xFFB4, 0xD611, 0xBCAE, 0xCD4F, 0x9D31, 0x9512, 
-0xEE32, 0xA44C, 0x59E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x7309, 0xFE93, 0xF692, 0xDDD0, 0xA42E, 0xC4B2, 0x72CA, 0x5AA7, 0xF6D2, 0xFEF2, 0xCD90, 0x8C90, 
-0x4B90, 0x5B4E, 0xC52F, 0xF672, 0xA44C, 0x5A06, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x6288, 0xD591, 0xE631, 0xB4AE, 0x8B4D, 0xF5B5, 0xDD53, 0x6248, 0x93EB, 0xFE72, 
-0xDE11, 0x7471, 0x098B, 0x41E9, 0xB48E, 0xD570, 0xEE52, 0x9C2C, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x49A5, 0x93EC, 0xC530, 0x93AD, 0xABEF, 0xC46F, 0xD490, 0x59E7, 
-0x5A47, 0xF652, 0xE611, 0x7BAE, 0x21EB, 0x3189, 0x8B6C, 0xB48E, 0xD591, 0xDDD0, 0x49E5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x62A8, 0xB4CF, 0x936D, 0x92EB, 0x5185, 
-0x2882, 0x0821, 0x5A67, 0xE612, 0xD570, 0x8B6C, 0x83EE, 0x4B0E, 0x420B, 0x93AD, 0xC530, 0xC52F, 0x49E5, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x6A47, 0x6288, 0x932C, 
-0x9AEC, 0x5106, 0x3968, 0x2187, 0x6287, 0xCD70, 0xB48E, 0x830B, 0xB46E, 0x94B0, 0x424B, 0x830C, 0xCD50, 0xC54F, 0x49E5, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 
-0x49A5, 0xBC4F, 0xD491, 0x9AAD, 0xB494, 0x6B2C, 0x5A67, 0xC50F, 0x93CD, 0x834C, 0xAC4E, 0x834A, 0x49A8, 0x832C, 0xCD50, 0xD590, 
-0x4A05, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6227, 0x936C, 0xFE56, 0xDD12, 0xB431, 0xDD74, 0x6248, 0x5226, 0xAC4E, 0x8B2C, 0xB48F, 0x9C0C, 0x4145, 0x59E9, 0x9BED, 
-0xCD70, 0xA44C, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4985, 0xB46F, 0xFE97, 0xE5B4, 0xDD73, 0xE553, 0xA3CD, 0x6ACA, 0x8B0C, 0xAB8D, 0xBCAE, 0x72E9, 0x3926, 
-0x7B0C, 0xC530, 0xDDD1, 0x5A66, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0xAC2F, 0xFE56, 0xEDB4, 0xEDB4, 0xEDB4, 0xF615, 0xBC30, 0xA30B, 0xC3EE, 0x82EA, 
-0x3966, 0x49A9, 0x8B4D, 0xD591, 0xA44C, 0x51C6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x5A48, 0xE593, 0xFE77, 0xFE15, 0xFE36, 0xFE36, 0xD490, 0xC3AD, 
-0xBC0E, 0x5A08, 0x3926, 0x72AB, 0xBCCF, 0x9C2B, 0x5A06, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0xAC2E, 0xF636, 0xE593, 0xE594, 0xE532, 
-0xC3CD, 0xCBEE, 0xC490, 0x5A28, 0x4168, 0x8B6D, 0xE5F1, 0x7328, 0x7AA8, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x51E6, 0x51E6, 0x49C6, 
-0x49C6, 0x7248, 0xB38D, 0xF5B4, 0xDD93, 0x51E7, 0x4147, 0x832D, 0xC50F, 0xBD0E, 0x6267, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0x9B2A, 0x9B4B, 0xB3AC, 0x6206, 0x8BAD, 0xFF1A, 0xBD32, 0x28E3, 0x1021, 0x622A, 0x8B6D, 0xCD50, 0xCD4F, 0x5A67, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 0x8C2F, 0xA40F, 0x7228, 0x6A89, 0x2924, 0x2083, 0x51E9, 0x8B6D, 0xD571, 0xBD0E, 
-0x41A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A48, 0x83CE, 0x938C, 0x5924, 0x8AEB, 0xEE98, 0xBD94, 0x3985, 0x30E5, 0x622A, 
-0x93AD, 0xB4AE, 0x41A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x4985, 0x6289, 0xA3CE, 0x71E7, 0x8B0B, 0xB512, 0xCDF6, 0xFF5B, 0x8C2F, 
-0x1862, 0x4967, 0x72AC, 0x93CD, 0x41A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x51A5, 0x30E3, 0x5165, 0x7A48, 0x7207, 0x71E7, 0x9C0F, 0x940F, 0x8BAE, 
-0xEEF9, 0x9C90, 0x1062, 0x51C8, 0x8B6D, 0x6AC9, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x30E3, 0x5165, 0x7227, 0x7207, 0x5125, 0x5965, 0x7A89, 0x832C, 
-0x836D, 0xB4F2, 0xEED9, 0xCDF5, 0x5A89, 0x4987, 0x5A28, 0x6226, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4185, 0x5985, 0x8A68, 0x8268, 0x61C6, 0x3084, 0x3084, 
-0x61E7, 0x832C, 0x8B8D, 0xB4F2, 0xE698, 0xFF9B, 0x83CD, 0x0820, 0x59E6, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0x59A5, 0x8268, 0x7207, 0x5986, 
-0x30A4, 0x3064, 0x5145, 0x7A48, 0x7AEB, 0x9BEF, 0xD5F6, 0xF75A, 0x942F, 0x4164, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x4944, 0x69E7, 
-0x4905, 0x38A4, 0x30A4, 0x5145, 0x69E7, 0x71E6, 0x7228, 0x72CA, 0xA4B1, 0xEED9, 0xE698, 0x62CA, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 
-0x4144, 0x30A3, 0x3884, 0x38C4, 0x5166, 0x7207, 0x7A27, 0x7A28, 0x5144, 0x28C2, 0x836D, 0xDE57, 0xFFDC, 0x736C, 0x7A88, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x4164, 0x30A3, 0x5966, 0x69E7, 0x7227, 0x7227, 0x7227, 0x69C7, 0x38C4, 0x20A3, 0x5228, 0xA470, 0xD5F6, 0x8BEE, 
-0x5A07, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4164, 0x5985, 0x7A48, 0x7227, 0x7227, 0x7207, 0x61C6, 0x38C4, 0x30C4, 0x3125, 0x3145, 0x7B0B, 
-0x938D, 0xBD13, 0x5AA9, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4164, 0x59A6, 0x7A48, 0x7207, 0x7207, 0x7227, 0x5146, 0x2022, 0x1882, 0x49A7, 
-0x4187, 0x49E7, 0x93CE, 0xDE57, 0xA4F2, 0x5A06, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4164, 0x59A5, 0x7A48, 0x7207, 0x7207, 0x7207, 0x5146, 0x2843, 
-0x2083, 0x49C8, 0x20A3, 0x3165, 0xCDD5, 0xFF5A, 0xE6B9, 0x5248, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4164, 0x59A5, 0x7A48, 0x7207, 0x7207, 0x7207, 
-0x69C7, 0x61A6, 0x5165, 0x4165, 0x59C6, 0x5A89, 0xF71A, 0xFF3A, 0xDE77, 0x49E7, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4164, 0x59A5, 0x7A48, 0x7207, 
-0x7207, 0x7207, 0x7207, 0x8248, 0x7207, 0x4984, 0x82C9, 0x5A68, 0xD616, 0xF73A, 0xDE98, 0x5A89, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0x5165, 
-0x7A48, 0x7207, 0x7207, 0x7207, 0x7207, 0x7A27, 0x6A07, 0x4145, 0x59C6, 0x7288, 0x83AD, 0xEF1A, 0xF719, 0xBD53, 0x51E6, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 
-0x49E6, 0x7268, 0x7207, 0x7207, 0x7207, 0x7A27, 0x69E7, 0x59A7, 0x3967, 0x2926, 0x3944, 0x6207, 0x5228, 0xDE57, 0xFF5A, 0xDE78, 
-0x49E7, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x5A48, 0x83EE, 0x82CA, 0x71E6, 0x7A27, 0x6A07, 0x59C7, 0x3966, 0x2106, 0x1906, 0x2107, 0x18C4, 0x0020, 0x3144, 0xC554, 
-0xFF9B, 0xD637, 0x49E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6A47, 0x8BCE, 0x8BAF, 0x3926, 0x51A6, 0x51A7, 0x4166, 0x2106, 0x1906, 0x18E6, 0x2106, 0x2126, 0x18C5, 0x0000, 
-0x3144, 0xA430, 0xCDB5, 0xC5B5, 0x4A07, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x5A07, 0x93AE, 0x41C8, 0x0864, 0x1906, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2126, 0x18E5, 
-0x18C5, 0x0842, 0x3985, 0xA450, 0xC595, 0xC5B4, 0x4A07, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x5208, 0x4A09, 0x1084, 0x18A4, 0x18C5, 0x1906, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x18C5, 0x10A4, 0x1062, 0x83EE, 0xFF7B, 0xDDF5, 0x49C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x6227, 0x5A4A, 0x0884, 0x1083, 0x18C5, 0x18C4, 0x20E5, 0x2126, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x2126, 0x18E5, 0x18A4, 0x0022, 0x730B, 0xFED8, 0xE573, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x3145, 0x4A09, 0x10A4, 0x18A4, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2126, 0x18E5, 0x0001, 0x5227, 0xE573, 0xFE36, 0xDD53, 0x49C6, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x0863, 0x18C5, 0x18C4, 0x18E5, 0x2127, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2126, 0x20E6, 0x0001, 0x5A27, 0xEDB4, 0xFE56, 0xDD53, 0x49C6, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x18A3, 0x2927, 0x18E5, 0x10A4, 
-0x20E5, 0x2126, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x10A4, 0x0021, 0x832B, 0xFEF8, 0xF615, 
-0x49A6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x2904, 0x18C4, 
-0x18A4, 0x18E5, 0x2126, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2126, 0x2106, 0x0000, 0x7B0A, 
-0xE593, 0x8B6C, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA34B, 0x59E6, 0x20C3, 0x18C5, 0x2106, 0x18E6, 0x18E6, 0x18E6, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2927, 
-0x10A3, 0x49C6, 0x5A07, 0x6227, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x28E3, 0x10A5, 0x10C5, 0x3167, 0x59E8, 0x3147, 0x2106, 0x2106, 0x18E6, 0x18E6, 0x2106, 
-0x2127, 0x2106, 0x2904, 0x6A27, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x932A, 0x6A68, 0x932C, 0x726A, 0x92EB, 0xB38D, 0x59E7, 0x10A4, 0x2106, 0x18E6, 
-0x3967, 0x5A08, 0x28E4, 0x20C3, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x9BCD, 0xFE56, 0xE532, 0xDC6F, 0xA32B, 0x59E6, 0x4985, 
-0x51C7, 0x930B, 0xA34C, 0x9AEA, 0x30E3, 0x9B2B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x9BCD, 0xFEB8, 0xF5F5, 0xF573, 0x7A68, 
-0x6A47, 0x82C9, 0x7247, 0xDC4F, 0xDC4F, 0xA34B, 0x4985, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x7AEA, 0xFE36, 0xFE56, 
-0xF5D4, 0x9B0B, 0x5185, 0x59E6, 0x6A27, 0xCBEE, 0xDC70, 0xB3EE, 0x4165, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6A47, 
-0x8B6C, 0xFE36, 0xDCD1, 0xC3CD, 0x832B, 0x18E3, 0x6A07, 0xCBAD, 0xCC0E, 0xCD32, 0x62A9, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6A27, 0x834B, 0xD532, 0xE5B5, 0xF6F9, 0x62EA, 0x28A2, 0xB3CD, 0xD512, 0xF6F9, 0xB594, 0x51C6, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x3985, 0xDEB8, 0xFFFE, 0xF77B, 0xA4D1, 0x18E3, 0x83EE, 0xEF1A, 0xFF9C, 0xC5D5, 0x49A5, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x840F, 0xFFDD, 0xFF9C, 0xE698, 0x5AA9, 0x7BAD, 0xFF5B, 0xFF7B, 
-0xB594, 0x49C6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x41A6, 0xDEB8, 0xFFFE, 0xEEF9, 0x62CA, 0x7B8D, 
-0xEEF9, 0xFF7B, 0xB594, 0x49C6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x7BCE, 0xFFFE, 0xFF9C, 
-0xAD12, 0x62CA, 0xACF2, 0xFFDD, 0xB594, 0x49C6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x49E6, 
-0xDE98, 0xFFFE, 0xE6B8, 0x4207, 0x83EE, 0xFFFF, 0xB574, 0x49C6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7248, 0x7BEE, 0xFFFF, 0xEF3A, 0x7B8D, 0x83CE, 0xFF7B, 0xBDB5, 0x49C6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x5207, 0xE6F9, 0xFFFF, 0xAD12, 0x41C6, 0xD657, 0xCE57, 0x49A6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x5AA9, 0xBD94, 0x5A89, 0x0800, 0x9470, 0xBDB5, 0x51E6, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49A5, 0x1061, 0x20C2, 0x20C2, 0x0800, 0x4A48, 0x9CF2, 0x5A27, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x1882, 0x20C2, 0x20A2, 0x2903, 0x0820, 0x4207, 
-0x9CD1, 0x5A27, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4164, 0x20C2, 0x2903, 0x2903, 0x20E3, 
-0x0841, 0x2103, 0x41E7, 0x49A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x51C6, 0x20C2, 0x20C2, 0x2903, 0x20E3, 
-0x1882, 0x0841, 0x0841, 0x0820, 0x0000, 0x4144, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x18A2, 0x20E3, 0x2903, 
-0x20C2, 0x0841, 0x0820, 0x0020, 0x0841, 0x0861, 0x0841, 0x4164, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_left_1.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_left_1_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x82C9, 
-0x49C5, 0x41A5, 0x49A5, 0x41A5, 0x4185, 0x4164, 0x4164, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x82C9, 
-0x4985, 0x5226, 0xA46D, 0xBCEE, 0xBCEE, 0xC52E, 0xC54E, 0xCDAF, 0xC52E, 0x62A7, 0x8AE9, 0xA36B, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 
-0x49C5, 0x62C7, 0xA44C, 0xC50F, 0xDDD1, 0xE5F1, 0xDDB1, 0xE611, 0xFEF3, 0xFFD5, 0xFFF5, 0xDDF0, 0x5226, 0x3964, 0x49C5, 0xA36B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8B, 0x5206, 0xC5AF, 0xFF53, 0xF692, 0xCD50, 0xBCCF, 0xDDF1, 0xDDF1, 0xBCCF, 0xC50F, 0xF6B2, 0xFF33, 0xDE32, 0xC530, 0xDDD0, 
-0xBCEE, 0x51E6, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA34B, 0x5A06, 0xBD0E, 0xFF74, 0xFF74, 0xE631, 0xAC4E, 0x7AEB, 0xACAD, 0xFF73, 0xE672, 0xB4CE, 0xCD0F, 0xB571, 0x84D2, 
-0xBD71, 0xF652, 0xFEB3, 0xBCEE, 0x51E6, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x838A, 0xFEB3, 0xF672, 0xDDD0, 0xAC4E, 0xC4B2, 0x7AEB, 0x5266, 0xE671, 0xFF53, 0xDDD0, 0xA4B0, 
-0x5BF0, 0x4B4F, 0x9C2E, 0xC4EF, 0xDDB0, 0xFEF3, 0x8BAA, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x7B09, 0xDDD1, 0xE631, 0xB4AE, 0x8B4D, 0xED95, 0xE573, 0x6268, 0x8BAA, 0xEE51, 
-0xEE52, 0x94F1, 0x226D, 0x1929, 0x7AEB, 0xB48E, 0xC52F, 0xF672, 0xCD6F, 0x5206, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x49A5, 0xA44D, 0xC530, 0x93CD, 0xA3CF, 0xCCB0, 0xE511, 0x7268, 
-0x49E6, 0xDDB0, 0xF672, 0x946F, 0x322C, 0x196A, 0x4A6B, 0x8BAD, 0xB48E, 0xD5B0, 0xFED3, 0x93CA, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x7B29, 0xB4CF, 0x934D, 0x9B2C, 0x59E6, 
-0x3903, 0x1841, 0x41C6, 0xD590, 0xEE11, 0x9BCD, 0x7B6D, 0x5BAF, 0x324C, 0x6AAB, 0xAC2D, 0xCD50, 0xF672, 0x8369, 0x6227, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x5A06, 0x730A, 0x932C, 
-0x92CB, 0x4905, 0x28E6, 0x1906, 0x4A27, 0xC50F, 0xCD30, 0x8B4C, 0x9BCD, 0xA4F0, 0x52ED, 0x62AB, 0xAC2D, 0xDDD1, 0xB4CD, 0x51E5, 
-0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 
-0x4185, 0xABEE, 0xD450, 0x926C, 0xA3F2, 0x6B6E, 0x5227, 0xB4AE, 0xAC6E, 0x7B0C, 0xA42E, 0xB4CE, 0x5A49, 0x624A, 0xB48F, 0xD5B0, 
-0x7308, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6A27, 0x832B, 0xF5F5, 0xDD12, 0xABD0, 0xD555, 0x72EA, 0x41E5, 0xA46E, 0x938D, 0x93AD, 0xBD0F, 0x93CC, 0x4145, 0x6229, 
-0xCD51, 0xAC8D, 0x51E6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x4165, 0xBCB0, 0xFE97, 0xE594, 0xD533, 0xE553, 0x9B6C, 0x5A68, 0x834C, 0x9B2C, 0xC48F, 0xA46D, 0x5207, 
-0x4167, 0x72AB, 0xD591, 0x940B, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4185, 0xBC90, 0xFE76, 0xEDD4, 0xEDB4, 0xED93, 0xEDB4, 0xAC2F, 0x92EB, 0xBB6C, 0xB40E, 
-0x6AAA, 0x30E5, 0x49A8, 0x7AEC, 0xD570, 0x940B, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x7B0B, 0xEDD4, 0xF5F5, 0xEDD5, 0xF5F5, 0xFE36, 0xDD12, 0xBB8C, 
-0xC40E, 0x934D, 0x51E9, 0x4167, 0x4167, 0x72CB, 0xCD50, 0xB4CE, 0x5A06, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4165, 0xCCF1, 0xFEB8, 0xFE36, 0xFE36, 0xF5D5, 
-0xCC4F, 0xBB8C, 0xD4B0, 0x9BAF, 0x5A2A, 0x51E8, 0x3925, 0x5A29, 0xA40E, 0xD5B1, 0x7B49, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x6268, 0x8B8C, 0x832B, 
-0x7B0B, 0x9B6C, 0xBB8C, 0xD44F, 0xE573, 0x7B2C, 0x49A8, 0x6A4B, 0x4987, 0x4167, 0x6A6A, 0xAC4F, 0xAC8D, 0x5A26, 0x9B4B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7AA8, 
-0x59E6, 0x6227, 0x7268, 0x51A5, 0x8B0B, 0xF697, 0xE656, 0x4A07, 0x28E5, 0x728C, 0x622A, 0x4187, 0x4167, 0x6A6B, 0xBCCF, 0x7B49, 
-0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x632B, 0xCDB4, 0xA3EE, 0x59E6, 0x2082, 0x51E9, 0x728C, 0x622A, 0x4987, 0x4167, 
-0x7AEC, 0x5208, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x6289, 0x8BCD, 0x7A89, 0x9B8D, 0xB4D1, 0x41E6, 0x3126, 0x6A6B, 0x6A6B, 
-0x51E8, 0x49A7, 0x624B, 0x3126, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x5207, 0x9C2F, 0x8B0B, 0x938C, 0xE6B8, 0xFF7B, 0xA4F2, 0x39A6, 
-0x51A8, 0x622A, 0x3925, 0x4167, 0x4167, 0x59E6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x4985, 0x28C2, 0x7268, 0x8AA9, 0x938C, 0xD636, 0xDE78, 0xEEF9, 
-0xD657, 0x4207, 0x4146, 0x59E9, 0x20A3, 0x3124, 0x4165, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x4985, 0x30E3, 0x5185, 0x69E7, 0x61A6, 0x6165, 0xA42F, 0xBD53, 
-0x93CE, 0xCDD5, 0xCE36, 0x41E7, 0x3926, 0x622B, 0x6A89, 0x9C2C, 0x62A8, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x51A5, 0x4944, 0x7207, 0x7A48, 0x71E7, 0x40C4, 0x40E4, 
-0x7AAA, 0x8B8D, 0x8BAE, 0xDE37, 0xCDF5, 0x3986, 0x3906, 0x8B6D, 0xC4F0, 0xD591, 0x6288, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3944, 0x59A6, 0x8A68, 0x7A48, 0x61C6, 
-0x38A4, 0x2843, 0x5166, 0x832C, 0xACB1, 0xE698, 0xD657, 0x5AAA, 0x49A7, 0xBCAF, 0xCD50, 0x6288, 0x6A47, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3944, 0x59A6, 0x8248, 
-0x61C6, 0x5145, 0x38A4, 0x3084, 0x5965, 0x7268, 0x8B8D, 0xCDD5, 0xFF5B, 0xB553, 0x39C6, 0x6267, 0x6AA8, 0x6A47, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 
-0x4144, 0x5166, 0x40C4, 0x3064, 0x38C4, 0x5986, 0x71E7, 0x69E6, 0x7AAA, 0xACB1, 0xEEF9, 0xCE16, 0x3144, 0x4164, 0x7A88, 0xBBED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x3924, 0x2863, 0x38C5, 0x4925, 0x61A6, 0x7207, 0x7227, 0x7207, 0x61C7, 0x7B0C, 0xD616, 0xEEF9, 0x734C, 0x7268, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3944, 0x4104, 0x61A6, 0x7207, 0x7227, 0x7207, 0x7227, 0x6186, 0x3884, 0x6249, 0xCDD5, 0xFF9C, 
-0xC5B4, 0x41A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x4144, 0x59C6, 0x8248, 0x7207, 0x7207, 0x7227, 0x61A6, 0x3884, 0x1801, 0x5A28, 
-0xA450, 0xC574, 0xB533, 0x49E6, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x59A6, 0x7A48, 0x7207, 0x7207, 0x7227, 0x5966, 0x3083, 
-0x1842, 0x5228, 0x8B4D, 0x93CE, 0xD5F6, 0x8C0F, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x59A5, 0x7A48, 0x7207, 0x7207, 0x7207, 
-0x69E7, 0x6186, 0x5985, 0x6A69, 0x8BAE, 0xBD53, 0xFF7B, 0xC594, 0x4185, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x59A5, 0x7A48, 0x7207, 
-0x7207, 0x7207, 0x7207, 0x7227, 0x7A27, 0x7207, 0x834C, 0xCDB5, 0xFF7B, 0xB533, 0x41A5, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x59A5, 
-0x7A48, 0x7207, 0x7207, 0x7207, 0x7207, 0x7207, 0x7A07, 0x7207, 0x7ACA, 0x9C30, 0xEEB9, 0xB533, 0x4185, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 
-0x4144, 0x61A6, 0x7A48, 0x7207, 0x7207, 0x7A27, 0x7A27, 0x69E7, 0x59A6, 0x59E7, 0x7ACA, 0x93EE, 0xE678, 0xD657, 0x5A48, 0x9B4B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x4164, 0x4965, 0x7A48, 0x7A27, 0x6A07, 0x59C7, 0x59C7, 0x4166, 0x20E6, 0x2106, 0x5209, 0x93AE, 0xBD33, 0xD5D5, 
-0x838D, 0x51A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x20C3, 0x2926, 0x49A7, 0x59C7, 0x4166, 0x2106, 0x2106, 0x2106, 0x1906, 0x10C6, 0x2947, 0x72EB, 
-0x9BEE, 0xBD13, 0x8BEE, 0x4165, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4165, 0x18C4, 0x2106, 0x2106, 0x2106, 0x2106, 0x1906, 0x1906, 0x2106, 0x20E5, 0x18E5, 
-0x2106, 0x41A8, 0x8B8D, 0xE698, 0xAD12, 0x49A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x20C3, 0x20E5, 0x18C5, 0x18E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x18C4, 0x18A4, 0x1084, 0x18C4, 0x9BEE, 0xFF19, 0xB4D1, 0x49A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x51C6, 0x51C5, 0x51C6, 0x20E4, 0x2106, 0x2106, 0x10A4, 0x18C4, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x20E5, 0x0863, 0x0862, 0x7B0B, 0xEDB4, 0xFE77, 0xAC2E, 0x51A6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0862, 0x18C4, 0x18C4, 0x20E5, 0x2927, 0x2126, 0x18C5, 0x10A4, 0x20E5, 
-0x2126, 0x2106, 0x2106, 0x2106, 0x2126, 0x0043, 0x1082, 0xB46F, 0xFE77, 0xFE36, 0xAC2F, 0x4985, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x10A3, 0x2927, 0x20E6, 0x20E6, 0x2106, 0x2126, 0x2106, 
-0x10A4, 0x18C4, 0x2106, 0x2106, 0x2106, 0x2106, 0x2126, 0x18C5, 0x0842, 0x49C6, 0xD532, 0xFF19, 0xBC90, 0x1882, 0x6A27, 0xBBED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x18C3, 0x18E5, 0x18C5, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x18C5, 0x10A4, 0x2106, 0x2126, 0x2106, 0x2106, 0x2106, 0x2927, 0x0022, 0x18A2, 0xBCB0, 0xFE56, 0x938C, 0x18C4, 
-0x0042, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x51C6, 0x10A3, 0x2127, 
-0x2126, 0x2106, 0x2106, 0x2126, 0x20E6, 0x18C4, 0x20E5, 0x2127, 0x2106, 0x2106, 0x2106, 0x2127, 0x0884, 0x2924, 0x834B, 0x6269, 
-0x20E4, 0x20E5, 0x10A3, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 
-0x20C3, 0x18E5, 0x18E6, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E6, 0x18C5, 0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x18C5, 0x0862, 
-0x1082, 0x0842, 0x0022, 0x20C3, 0x6207, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6206, 0x28E4, 0x2927, 0x10C5, 0x10C5, 0x18E6, 0x2927, 0x2927, 0x1083, 0x1083, 0x1906, 0x10C6, 0x10A5, 0x18E6, 
-0x3967, 0x18A2, 0x28E3, 0x3103, 0x59E6, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x6207, 0x8B0C, 0x49A8, 0x5A09, 0x5A08, 0x2905, 0x1083, 0x4164, 0x3103, 0x3146, 0x5A09, 
-0x51E8, 0x6249, 0x8ACA, 0x4164, 0x9B2A, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x5A06, 0xBC70, 0xED53, 0xC40E, 0xBBAD, 0x7248, 0x3944, 0x7268, 0xC40D, 0x7AA8, 
-0x59C6, 0xCBEE, 0xBBCD, 0xCBEE, 0xB36C, 0x3923, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7248, 0x72CA, 0xFE56, 0xF615, 0xE4D1, 0xB36C, 0x4144, 0xA36B, 0xC40D, 
-0xC40D, 0xAB8C, 0x5185, 0xA32B, 0xD40E, 0xCBEE, 0xD470, 0x7AEA, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x7289, 0xFE56, 0xFE36, 0xD4B0, 0x69E7, 0x6206, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x59C6, 0xCC0E, 0xD490, 0xF5F5, 0xF5F5, 0x830B, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x72CA, 0xFE15, 0xFDF5, 0xBC0E, 
-0x3903, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4985, 0x92EA, 0xED73, 0xF5F5, 0xFE36, 0xF6F9, 0x83CE, 0x6A47, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x5A68, 0xCE16, 0xF616, 
-0xCC6F, 0x6A48, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x4985, 0x9B6C, 0xF5D4, 0xEE97, 0xFFFE, 0xD698, 
-0x41A6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A68, 0x738D, 
-0xFFFE, 0xF71A, 0xCD33, 0x41C6, 0x9B4A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x4985, 0xAC70, 0xFF5B, 
-0xFFBC, 0xFFBC, 0x83EE, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x82A9, 0x6B2B, 0xFFBC, 0xFFDC, 0xEF1A, 0x5A89, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 
-0x51E7, 0xAD12, 0xFF5B, 0xFFFE, 0xCE57, 0x49C6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x82A9, 0x6B2B, 0xFFBC, 0xFF9C, 0xC5B4, 0x5227, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xB3AC, 0x51C6, 0xACF2, 0xFF9B, 0xFFDD, 0x83EE, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x6B2B, 0xFFDD, 0xF77B, 0x6B0B, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x49E6, 0xACF2, 0xFFFE, 0xD657, 0x41A6, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x6B2B, 0xFFBD, 0xF77C, 0x5A89, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x49C6, 0xAD12, 0xFFBC, 0xB553, 0x5207, 0xBBCC, 0xC40D, 
-0xC40D, 0xC40D, 0x92EA, 0x7A88, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x6B4C, 0xFF9C, 0xC594, 0x5207, 0xA34B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x51E6, 0xB533, 0xFFDD, 0xB574, 
-0x5A47, 0xBBCC, 0xC40D, 0xC40D, 0x3944, 0x0861, 0x51A5, 0x8AEA, 0xC40D, 0xC40D, 0x8AC9, 0x734C, 0xFF7B, 0x734C, 0x7A88, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x5248, 
-0xF73A, 0xFFFF, 0x83EE, 0x4164, 0xB3CC, 0xC40D, 0x3944, 0x18C2, 0x20C2, 0x18A2, 0x59E6, 0x7A88, 0x4164, 0x734C, 0xFF5B, 0x734C, 
-0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBED, 0x6227, 0x736C, 0x9450, 0x4A48, 0x0020, 0x82A9, 0xC40D, 0x8AC9, 0x20C2, 0x2903, 0x2903, 0x18A2, 0x1061, 0x1061, 0x4A07, 
-0xBD53, 0x736C, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x0820, 0x0000, 0x0821, 0x0861, 0x3123, 0xAB8C, 0xC40D, 0x8AEA, 0x20C2, 0x20E3, 0x2923, 0x2903, 
-0x2903, 0x18A2, 0x3985, 0x5A27, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x3944, 0x0020, 0x0020, 0x0841, 0x1061, 0x0841, 0x8AC9, 0xC40D, 0xC40D, 0x8AE9, 0x20C2, 
-0x1082, 0x20E3, 0x2924, 0x2903, 0x0840, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0841, 0x0861, 0x1061, 0x0841, 0x1061, 0x59E6, 0xBBED, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x7A88, 0x3103, 0x20E3, 0x20E3, 0x18A2, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x4164, 0x18A2, 0x0861, 0x0861, 0x1061, 0x5A06, 0xA34B, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x0861, 0x0861, 0x4985, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x4164, 0x0841, 0x0861, 0x0861, 0x0841, 0x4164, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_left_2.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_left_2_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x930A, 0x49A5, 0x5206, 
-0x9C2C, 0xB4AD, 0xACAD, 0xBCED, 0xBCED, 0xC54E, 0xB4CD, 0x6267, 0x932A, 0xB3AC, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x49C5, 0x5A66, 
-0x9C0B, 0xBCEF, 0xDDD1, 0xE5F1, 0xDDB1, 0xEE32, 0xFF13, 0xFFD5, 0xFFF5, 0xD5CF, 0x51E5, 0x3144, 0x51C5, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x51E6, 
-0xBD4E, 0xF712, 0xF692, 0xCD70, 0xBCEF, 0xDDD1, 0xDDD0, 0xBCCF, 0xC52F, 0xF6D2, 0xFF53, 0xDE52, 0xBD0F, 0xD590, 0xACAD, 0x51E6, 
-0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 
-0x5A06, 0xB4AD, 0xFF74, 0xFFB4, 0xE631, 0xAC4E, 0x830B, 0xB4EE, 0xFF73, 0xE651, 0xB4AE, 0xCD2F, 0xBD91, 0x8CF2, 0xC591, 0xFE72, 
-0xFED3, 0xB4AD, 0x51E6, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x59E6, 0x836A, 0xFEB3, 0xF692, 0xDDF0, 0xAC8E, 0xC491, 0x72CB, 0x5A87, 0xE691, 0xFF53, 0xD5B0, 0xA4AF, 0x6411, 0x538F, 
-0x9C4E, 0xC50F, 0xDDD1, 0xFEF3, 0x8369, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x7B4A, 0xE5F2, 0xEE31, 0xBCCE, 0x8B4D, 0xE574, 0xDD52, 0x6268, 0x93EB, 0xF651, 0xEE51, 0x94F1, 
-0x228E, 0x2149, 0x7B0B, 0xBCAE, 0xBCEF, 0xE611, 0xC52E, 0x5206, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x49C6, 0xAC6D, 0xCD50, 0x93CD, 0xA3CF, 0xD4D1, 0xED52, 0x7289, 0x4A06, 0xDDB0, 
-0xF672, 0x946F, 0x2A2C, 0x1949, 0x4A6B, 0x93CD, 0xAC4E, 0xC52F, 0xFEB3, 0x8BCA, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x7B4A, 0xB4CF, 0x8B4D, 0x9B4C, 0x6207, 0x4144, 0x2061, 
-0x41C5, 0xD590, 0xEE31, 0x9BCD, 0x734D, 0x538F, 0x322C, 0x6AAB, 0xA42D, 0xD570, 0xFED3, 0x8BAA, 0x6206, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x5A06, 0x7B4B, 0x934C, 0x8AAB, 0x4905, 
-0x20A5, 0x10E5, 0x4A26, 0xC52F, 0xCD50, 0x8B4C, 0x9BCD, 0x9CD0, 0x4ACD, 0x62AB, 0xAC4E, 0xD5B1, 0xACAD, 0x5A06, 0xAB8B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x4185, 0xABCD, 
-0xCC50, 0x924B, 0x9BB1, 0x6B4E, 0x5247, 0xB4AE, 0xAC8E, 0x7B0C, 0xA40D, 0xB4AE, 0x5249, 0x626A, 0xD550, 0xAC8D, 0x49A5, 0xB3CC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 
-0x7AEA, 0xF5D4, 0xDCF2, 0xA3B0, 0xD555, 0x72EB, 0x49E5, 0xAC6E, 0x93AD, 0x938D, 0xBCEF, 0xA40C, 0x4986, 0x59E8, 0xCD51, 0x9C2B, 
-0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBED, 0x4165, 0xBC90, 0xFEB7, 0xE573, 0xD512, 0xE553, 0x934B, 0x5A47, 0x8B4C, 0x9B2C, 0xBC6E, 0xAC6E, 0x8B8D, 0x72EA, 0x4986, 
-0x7B0B, 0xD5B1, 0x7308, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x4165, 0xBC90, 0xFE77, 0xEDD4, 0xEDB4, 0xED93, 0xE593, 0xA40F, 0x8AEB, 0xB36C, 0xAC0D, 0x72EB, 0x728B, 
-0x8B6C, 0x51E7, 0x51C8, 0xCD30, 0xB4AD, 0x49A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x834B, 0xF5D5, 0xF5F5, 0xEDD4, 0xEDD5, 0xFE56, 0xDD12, 0xBB8C, 0xC3EE, 0x8B2C, 
-0x5A0A, 0x5A0A, 0x832C, 0x832A, 0x4166, 0x7B0B, 0xD590, 0x93EB, 0x5A06, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x4185, 0xCD12, 0xFED8, 0xFE36, 0xFE56, 0xF5F5, 0xCC6F, 0xBB8C, 
-0xD490, 0x9BAF, 0x5A0A, 0x5A0A, 0x72AB, 0x8B8C, 0x5A07, 0x51C8, 0xAC8F, 0xDDF1, 0x93CB, 0x6227, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x6AA9, 0xA3EE, 0x938C, 0x8B6C, 0xA3AD, 
-0xBB8D, 0xCC2F, 0xE553, 0x832C, 0x49A8, 0x6A4B, 0x622A, 0x72AB, 0x834B, 0x5A27, 0x5A29, 0xB4AF, 0xDDD1, 0x5A46, 0x8AE9, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7268, 0x51A5, 0x59E6, 
-0x6227, 0x4985, 0x8B2B, 0xF656, 0xEE36, 0x5248, 0x3105, 0x728C, 0x622A, 0x5A0A, 0x7ACC, 0x834B, 0x51E7, 0x6269, 0xB4AF, 0x72EA, 
-0x4985, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x630B, 0xD5D5, 0xAC2F, 0x51C6, 0x28C3, 0x5A09, 0x624B, 0x622A, 0x5A0A, 0x7ACC, 0x834B, 0x5A27, 
-0x6A6A, 0x7AEC, 0x2904, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x5A48, 0x8BAD, 0xAC70, 0xB490, 0x7AA9, 0x2061, 0x49C7, 0x938D, 0x72AB, 0x5A0A, 0x5A0A, 
-0x938D, 0x7AE9, 0x4987, 0x6A4B, 0x2904, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x5207, 0x9C2F, 0xBCD1, 0xD5F5, 0xF75A, 0xBD73, 0x3145, 0x4186, 0xB48F, 0x93CD, 
-0x622A, 0x622A, 0x5A29, 0x49A6, 0x51C9, 0x4187, 0x61E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x51C6, 0x28C2, 0x6A27, 0xAC2F, 0xCDB4, 0xE6B8, 0xF71A, 0xDE77, 0x4A48, 0x30E5, 
-0x93AD, 0xAC4E, 0x7ACB, 0x622A, 0x49A7, 0x3945, 0x3125, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x51C6, 0x30E3, 0x4965, 0x69E6, 0x6185, 0x7AAA, 0x9C0F, 0xBD53, 0xF71A, 0xD636, 
-0x4A28, 0x28C5, 0x72AC, 0xA42E, 0x9BCD, 0x622A, 0x72CB, 0xA42D, 0x49E5, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x4144, 0x69E7, 0x7A48, 0x71E7, 0x40C4, 0x51A7, 0x836D, 0xBD33, 
-0xF71A, 0xD636, 0x4A48, 0x3926, 0x6A6B, 0x8B4C, 0x9C0D, 0x622A, 0x832C, 0xBCEF, 0x5A47, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3924, 0x59A6, 0x8A68, 0x7A48, 0x61C6, 0x3063, 0x38E5, 
-0x9C30, 0xDE98, 0xF71A, 0xD636, 0x4A07, 0x28C4, 0x622B, 0x7B0C, 0x8B8C, 0x6A8B, 0x9BEE, 0x7B4A, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3944, 0x59A6, 0x8248, 0x69C6, 0x5145, 
-0x3084, 0x3043, 0x93AE, 0xEEF9, 0xF71A, 0xDE57, 0x4A07, 0x20A2, 0x4167, 0x832C, 0xA40E, 0xAC6F, 0xAC6E, 0x49E5, 0x92EA, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x4144, 0x5986, 
-0x40C5, 0x3084, 0x38A4, 0x48E4, 0x9BEE, 0xE6B8, 0xF71A, 0xDE57, 0x5248, 0x8AC9, 0x6207, 0x6269, 0xAC4E, 0x93CB, 0x5206, 0x82A9, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 
-0x3924, 0x2863, 0x38A4, 0x4905, 0x5966, 0x69A6, 0xAC2F, 0xEED9, 0xF71A, 0xDE57, 0x5248, 0xB3AC, 0xB3CC, 0x2903, 0x49E6, 0x51C5, 
-0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x3944, 0x38E4, 0x6186, 0x7207, 0x7207, 0x69C6, 0x8B2B, 0xCDD5, 0xF71A, 0xDE77, 0x5228, 0xA34B, 0xC40D, 0x6207, 
-0x7248, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x59A6, 0x7A48, 0x7207, 0x7207, 0x5986, 0x61E8, 0x93EF, 0xDE57, 0xDE98, 0x5248, 0x930A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x59A6, 0x7A48, 0x7207, 0x7207, 0x5125, 0x6A8A, 0xBD33, 0xDE77, 0xDE77, 
-0x5248, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x59A5, 0x7A48, 0x7207, 0x71E7, 0x5965, 0x9BCE, 0xEEF9, 
-0xF73A, 0xDE57, 0x5248, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x59A5, 0x7A48, 0x7207, 0x69E7, 0x69A6, 
-0xA40E, 0xE6B8, 0xF71A, 0xDE98, 0x5248, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x59A5, 0x7A48, 0x7207, 
-0x69E7, 0x69A6, 0xA3EE, 0xE6B8, 0xF71A, 0xD616, 0x4A07, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x4144, 0x61A6, 
-0x7A48, 0x7207, 0x69E7, 0x69A6, 0xA40E, 0xE6D9, 0xF73A, 0xB4F2, 0x3144, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 
-0x3944, 0x4985, 0x7A48, 0x7A27, 0x7A07, 0x6185, 0x9BEF, 0xEF3A, 0xE698, 0x93EE, 0x3103, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBCD, 0x3924, 0x2905, 0x51C7, 0x59C7, 0x59A6, 0x3925, 0x6B0C, 0xC594, 0xAC91, 0x832C, 0x3165, 0x6A47, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3944, 0x18C5, 0x2127, 0x2106, 0x2106, 0x18C5, 0x49E8, 0x9C2F, 0xB4D2, 0x93EF, 0x39A7, 0x18A2, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x20C3, 0x18E5, 0x2106, 0x1906, 0x18E6, 0x10A5, 0x526A, 0xCDD5, 0xEEF9, 0xACD2, 
-0x41A8, 0x0862, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0x18C4, 0x18E5, 0x20E5, 0x2106, 0x2106, 0x0843, 0x6AEB, 0xF6B8, 
-0xF697, 0x836C, 0x20E5, 0x18E5, 0x20C3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x18C3, 0x20E5, 0x18C4, 0x18E5, 0x2127, 0x0884, 0x3965, 
-0xBC90, 0xFE56, 0xEDB4, 0x5207, 0x0022, 0x2127, 0x18A4, 0x5A06, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x4985, 0x4164, 0x20C3, 0x2126, 0x2106, 0x10A4, 0x18C4, 0x2127, 
-0x0022, 0x5A48, 0xF5D4, 0xFE56, 0xEDB4, 0x5A27, 0x0022, 0x2927, 0x2126, 0x18A4, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x1062, 0x10A3, 0x18E5, 0x2927, 0x2126, 0x18C5, 
-0x10A4, 0x20E5, 0x18C5, 0x20E4, 0x938C, 0xFE77, 0xFE76, 0x6248, 0x0022, 0x2127, 0x2927, 0x2127, 0x18A4, 0x6206, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x1082, 0x18E5, 0x2106, 0x2106, 
-0x2126, 0x2106, 0x10A4, 0x18A4, 0x2107, 0x0002, 0x6289, 0xF615, 0xD532, 0x49C6, 0x0001, 0x20E6, 0x2106, 0x2927, 0x2927, 0x18A4, 
-0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4985, 0x18C4, 
-0x2927, 0x2106, 0x2106, 0x2126, 0x10C4, 0x0883, 0x18E6, 0x0863, 0x5A47, 0x832B, 0x3145, 0x18C3, 0x1063, 0x18A4, 0x2926, 0x2127, 
-0x2106, 0x18A4, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8AC9, 0x18A3, 0x2106, 0x2127, 0x2106, 0x18E6, 0x2106, 0x2905, 0x2106, 0x10A4, 0x18A3, 0x18A3, 0x0023, 0x0884, 0x1083, 0x1062, 
-0x18C5, 0x18C4, 0x20C3, 0x59E6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC3ED, 0x7A88, 0x18A3, 0x10A5, 0x10C5, 0x10C5, 0x5A09, 0x9B2C, 0x5209, 0x10C5, 0x0043, 0x0064, 0x3988, 0x51E8, 
-0x20C3, 0x28C2, 0x3103, 0x51C5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB6B, 0x4164, 0x51A7, 0x49C8, 0x6209, 0xB3AD, 0xC3ED, 0x7A89, 0x5A09, 0x51E9, 0x51E8, 
-0x930B, 0xB38C, 0x4164, 0x8AE9, 0xC40D, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x7ACA, 0xDCD1, 0xBBCD, 0xC3CD, 0xC3CD, 0x6A07, 0x4985, 0x82A9, 
-0xC3EE, 0xBBAD, 0xCBEE, 0xBBAC, 0x4164, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x9BCD, 0xFE77, 0xE511, 0xDC4F, 0x9B0B, 0x49A5, 
-0x7A88, 0x59C6, 0xCC0E, 0xCBEE, 0xDC90, 0xCC90, 0x4165, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x938C, 0xFE97, 0xF5F5, 0xC40E, 
-0x59A5, 0x82A9, 0xBBCD, 0x51C5, 0x8AA9, 0xD490, 0xEDB4, 0xF615, 0x93AC, 0x5A06, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x936C, 0xFE36, 
-0xFDD4, 0xA36C, 0x3903, 0xB3CC, 0xC40D, 0x82C9, 0x4965, 0xE512, 0xFE36, 0xF5D4, 0xFE56, 0x9C4F, 0x5A06, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 
-0x9C0E, 0xFE97, 0xE512, 0xA34B, 0x3944, 0xB3AC, 0xC40D, 0xBBCD, 0x59C6, 0x82CA, 0xED94, 0xF615, 0xFF5A, 0xEF1A, 0x4A27, 0xA34B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6227, 0x8C0E, 0xFF3A, 0xF698, 0xB4B1, 0x41A5, 0xAB8C, 0xC40D, 0xC40D, 0xBBED, 0x51A5, 0x8BAD, 0xF6D9, 0xFFBC, 0xFFFD, 
-0x9CD1, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x5227, 0xBDD5, 0xFFFE, 0xC5D5, 0x41C6, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x5206, 0x9470, 
-0xF73A, 0xFFFE, 0xE71A, 0x4A07, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x9CB1, 0xFFFE, 0xC594, 0x41A6, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBED, 0x51E6, 0x944F, 0xF75B, 0xFFDD, 0xB594, 0x5A07, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0xA512, 0xFFFF, 0xC5D5, 0x41A5, 0xABAC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51E6, 0x942F, 0xFF7B, 0xFFFE, 0xBDD5, 0x5207, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0xA512, 0xFFFF, 0xD657, 0x3985, 0xAB8B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51E6, 0x942F, 0xFF7B, 0xFFFF, 0xD657, 0x6289, 0xB3AC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0xAD33, 0xFFFD, 0x944F, 
-0x5A06, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51E6, 0x9C70, 0xEED9, 0xC5F6, 0x5ACA, 0x3944, 
-0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0xB574, 
-0xE6D9, 0x41C6, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x6248, 0x5289, 0x2103, 
-0x0861, 0x0841, 0x3924, 0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x59E6, 0xB594, 0xE6D9, 0x41A5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 
-0x1061, 0x0000, 0x0820, 0x1061, 0x0841, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x62EA, 0xF79C, 0xE6D9, 0x49E6, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8B, 0x1881, 0x0841, 0x1061, 0x0841, 0x3103, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x5289, 0xEF1A, 0xDE77, 0x41C6, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x1881, 0x0861, 0x0841, 0x3923, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0xBBED, 0x82A9, 0x18A2, 0x18A2, 0x5268, 0x62CA, 0x3123, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4185, 0x0841, 0x0841, 0x3124, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x3924, 0x3103, 0x20C2, 0x2903, 0x2903, 0x1881, 0x1041, 0x20A2, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x4164, 0x0841, 0x0841, 0x4185, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x2903, 0x18C2, 0x20C2, 0x20E3, 0x2903, 0x2903, 0x2903, 0x20C2, 0x20C2, 0xA36B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x1881, 0x0840, 0x28E2, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_left_3.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_left_3_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x3123, 0x3124, 0xAC8C, 0xAC8C, 0xAC8C, 0xAC8C, 0xAC8C, 0xAC8C, 0xAC8C, 0x51C5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x3103, 0x18A2, 0xBD0E, 0x9C0D, 0xBCCF, 0xBCCF, 0xC52F, 0xE5F1, 0xEE92, 0xF6F2, 0xF6F2, 0xDE30, 0x3964, 0x18A2, 0x18A2, 0x4985, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBCC, 0x51C5, 0xDE30, 0xFF13, 0xDDD0, 0xBCEF, 0xD5B0, 0xE5F1, 0xD5B0, 0xB4CF, 0xCD70, 0xEE92, 0xF6F2, 0xD5F1, 0xBCEF, 0xE5F1, 
-0xE5F1, 0xBCEE, 0x49A5, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x51C5, 0xBCEE, 0xF6D2, 0xF6D2, 0xE5F1, 0xB48E, 0x832C, 0xACAD, 0xFF13, 0xDE31, 0xBCEF, 0xCD50, 0xC591, 0x6C51, 
-0xCD90, 0xD5B0, 0xE5F1, 0xE5F1, 0x8BCA, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6207, 0x836A, 0xDDF1, 0xE5F1, 0xE5F1, 0xB48E, 0x9BCE, 0xB44F, 0x5266, 0xE651, 0xEEB2, 0xD5B0, 0xA4AF, 
-0x7451, 0x4B4E, 0xA46E, 0xB4AE, 0xD590, 0xE5F1, 0xAC8C, 0x6A67, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x72E9, 0xC52F, 0xDDF1, 0xCD70, 0x72AC, 0xEDB4, 0xCCF1, 0x6AA9, 0x8BAB, 0xE5F1, 
-0xE5F1, 0x94F1, 0x4B0E, 0x1949, 0x7B2C, 0xB4AE, 0xB4AE, 0xCD70, 0xE5F1, 0x7308, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x5A47, 0x9C0C, 0xC50F, 0x8B6C, 0xBC70, 0xCC6F, 0xCC6F, 0x82CA, 
-0x4A06, 0xD590, 0xE5F1, 0x942E, 0x532E, 0x1949, 0x5B2E, 0x834C, 0xB4AE, 0xBCEF, 0xE5F1, 0x7308, 0x6207, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x838B, 0xB4AE, 0x6A8B, 0xB3CD, 0x3103, 
-0x3103, 0x1882, 0x41C5, 0xCD50, 0xE5F1, 0x93AD, 0x93EE, 0x5B6E, 0x324C, 0x6A8B, 0xB4AE, 0xBCEF, 0xAC8D, 0x6A47, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x3123, 0x9C0D, 0x6A8B, 
-0xAB6C, 0x5968, 0x59CA, 0x39C9, 0x41C5, 0xB4AE, 0xBCCF, 0x834C, 0x9C0D, 0xAC8F, 0x63F0, 0x6A8B, 0xBCCF, 0xA44C, 0x49A5, 0xBBCC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A2, 0xA32B, 0xE553, 0xAA6C, 0x830E, 0x94B2, 0x41C5, 0xB4AE, 0xB4AE, 0x832C, 0x9C0D, 0xB4AE, 0x3945, 0x6A8B, 0xBCCF, 0xAC8D, 
-0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x3103, 0xCCF1, 0xEDB4, 0xDD33, 0x82ED, 0xDE58, 0x7A68, 0x41C5, 0xAC8E, 0x830C, 0x9BCD, 0xB4AE, 0xAC4E, 0x49C6, 0x5A29, 
-0x6A8B, 0xBCEF, 0x8BCA, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x3103, 0xCCF1, 0xEDB4, 0xEDB4, 0xE573, 0xCC90, 0xA3EE, 0x6AA9, 0x8B4C, 0xA34C, 0xB44E, 0xA42E, 0x7ACB, 
-0xAC8E, 0x3104, 0x6A8B, 0xBCEF, 0x93EB, 0x6A47, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xCCF1, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xC491, 0xA32C, 0xBBAD, 0xA3AD, 
-0x72AB, 0x938D, 0x93CD, 0x5A27, 0x5A08, 0x9C0D, 0xBCEF, 0x93EB, 0x6A67, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x72CA, 0xDD53, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xD4F1, 0xBBAD, 
-0xCC4F, 0x8B2D, 0x624A, 0x624A, 0x624A, 0x834C, 0x6A89, 0x5A08, 0x9BED, 0xBCEF, 0x9C2C, 0x6A67, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xCCF1, 0xEDB4, 0xEDB4, 0xEDB4, 0xDD32, 
-0xC42F, 0xBBAD, 0xD4F1, 0x938E, 0x624A, 0x624A, 0x624A, 0x6A6B, 0x7B0B, 0x6A89, 0x5A08, 0x9BED, 0xBCEF, 0x9C2C, 0x51C5, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5207, 0x3985, 0x3985, 
-0x3985, 0x6227, 0xBBAD, 0xCC6F, 0xE593, 0x6A89, 0x51E8, 0x624A, 0x624A, 0x624A, 0x6A6B, 0x7B0B, 0x72EA, 0x5A08, 0x93CD, 0xBCEF, 
-0x3144, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0xAB8C, 0xAB8C, 0xAB8C, 0x7A88, 0x5A89, 0xDE37, 0xDE57, 0x5268, 0x49A8, 0x624A, 0x624A, 0x624A, 0x624A, 0x624A, 0x7B0B, 0x6A89, 
-0x51C7, 0x9BED, 0x72AB, 0x20C3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x7268, 0x3924, 0x7A89, 0x7A89, 0x7A48, 0x2082, 0x5A09, 0x6A8B, 0x6A8B, 0x624A, 0x624A, 
-0x7B0C, 0xAC8E, 0x6AA9, 0x51C8, 0x624A, 0x18A3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x4965, 0xAC90, 0xDE77, 0xDE77, 0xA42F, 0x20E3, 0x5A09, 0xAC4E, 0xAC4E, 
-0x7ACB, 0x624A, 0x624A, 0x8B6C, 0x6AA9, 0x51C8, 0x51E8, 0x3944, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x7A88, 0x30E3, 0x9BAD, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 0x39A6, 0x5A09, 
-0x9BED, 0xB4AE, 0xAC4E, 0x624A, 0x624A, 0x8B6C, 0x6AA9, 0x4186, 0x3944, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x7A88, 0x28C3, 0x30E3, 0x7207, 0x9BAD, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 
-0x39A6, 0x5A09, 0x624A, 0x9BED, 0xAC6E, 0x7ACB, 0x624A, 0x7B0C, 0x7B0A, 0x51E6, 0x6227, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x4124, 0x3903, 0x7207, 0x69E7, 0x5166, 0x8B4C, 0xDE77, 0xDE77, 
-0xDE77, 0xDE77, 0x39A6, 0x5A09, 0x624A, 0x6A6B, 0x938D, 0x9C0D, 0x624A, 0x624A, 0x8B6C, 0xB4AE, 0x3143, 0x930A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x61C6, 0x7207, 0x7207, 0x69E7, 0x38A4, 0x7AEB, 
-0xDE77, 0xDE77, 0xDE77, 0xBD53, 0x3145, 0x20C3, 0x5A2A, 0x624A, 0x6A8B, 0xAC6E, 0x832C, 0x624A, 0x8B6C, 0xB4AE, 0x3143, 0x930A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x61C6, 0x7207, 0x7207, 0x69E7, 
-0x38A4, 0x7AEB, 0xDE77, 0xDE77, 0xDE77, 0xA491, 0x20E3, 0x7A88, 0x3124, 0x624A, 0x6A8B, 0xB4AE, 0x93CD, 0x832C, 0xAC4E, 0x62A8, 
-0x7A88, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x61C6, 0x7207, 
-0x40E5, 0x40E5, 0x38A4, 0x7AEB, 0xDE77, 0xDE77, 0xDE77, 0xA491, 0x20E3, 0xAB8C, 0xAB8C, 0x18A3, 0x5A09, 0x41C5, 0x93CD, 0x8B6C, 
-0xB4AE, 0x41C5, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A2, 0x30A4, 0x38A4, 0x40E4, 0x6229, 0xDE77, 0xDE77, 0xDE77, 0xA491, 0x3165, 0x628A, 0x1082, 0xAB8C, 0xAB8C, 0x3123, 0x930A, 
-0x41C5, 0xAC4D, 0x5A47, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x18A2, 0x38E4, 0x4925, 0x7207, 0x8B2B, 0xDE77, 0xDE77, 0xDE77, 0xA491, 0x3165, 0x628A, 0x1082, 0xAB8C, 0xC40D, 
-0xC40D, 0x930A, 0x3984, 0x5A47, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x61C6, 0x7207, 0x7207, 0x8B2B, 0xDE77, 0xDE77, 0xDE77, 0xA491, 0x5228, 0x6ACA, 0x1082, 
-0xAB8C, 0xC40D, 0xC40D, 0xAB8C, 0x4985, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x61C6, 0x7207, 0x7207, 0x8B2B, 0xDE77, 0xDE77, 0xCDB5, 0x6AEB, 0x6ACA, 
-0x8B6D, 0x734C, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x61C6, 0x7207, 0x7A48, 0xB4D1, 0xDE77, 0xDE77, 0xB4F2, 
-0x3165, 0x5228, 0x8B6D, 0xACD1, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x61C6, 0x7207, 0x7A89, 0xDE77, 0xDE77, 
-0xDE77, 0xB4F2, 0x5A07, 0x4165, 0x7B0B, 0x8B6D, 0x1082, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x61C6, 0x7207, 0x7A89, 
-0xDE77, 0xDE77, 0xDE77, 0xB4F2, 0x7A89, 0x28C3, 0x9450, 0xC5B5, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x61C6, 
-0x7207, 0x7A89, 0xDE77, 0xDE77, 0xC594, 0x8BAD, 0x7A89, 0x69E6, 0x20E3, 0xC5B5, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A2, 0x20E5, 0x6A08, 0x93CE, 0xDE57, 0xDE57, 0xBD33, 0x7AAA, 0x3966, 0x2106, 0x0841, 0xA4F2, 0x3165, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x18A2, 0x18C5, 0x3167, 0x8B6D, 0x9C0F, 0xACD1, 0x834C, 0x49E9, 0x2106, 0x2106, 0x1083, 0x0020, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x1083, 0x524A, 0xAC91, 0x9C2F, 0x8B6D, 0x628A, 0x20E5, 0x2106, 0x2106, 0x2106, 0x0841, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x1083, 0x93CE, 0xDE77, 0xCDB5, 0x72EC, 0x41C8, 0x18C5, 0x18E5, 0x2106, 
-0x2106, 0x0841, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x20E4, 0x0841, 0xCD12, 0xE615, 0xAD12, 0x3145, 0x2106, 0x18C5, 
-0x18E5, 0x2106, 0x2106, 0x0841, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x20E5, 0x0841, 0xEDB4, 0xDD53, 0x3185, 0x20E5, 
-0x2106, 0x18C5, 0x18E5, 0x2106, 0x2106, 0x18C4, 0x3924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x20E4, 0x1062, 0x938C, 0xEDB4, 0xCCF1, 
-0x0861, 0x2106, 0x2106, 0x18C5, 0x18E5, 0x2106, 0x2106, 0x2106, 0x0841, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x18C4, 0x0841, 0xCCF1, 
-0xEDB4, 0xCCF1, 0x0861, 0x2106, 0x2106, 0x18C5, 0x1083, 0x18E5, 0x2106, 0x2106, 0x20E5, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x18A4, 0x2106, 
-0x0841, 0xB44F, 0xEDB4, 0xEDB4, 0xA3EE, 0x1062, 0x2106, 0x18C5, 0x1083, 0x18E5, 0x2106, 0x2106, 0x2106, 0x20E5, 0x18A2, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 
-0x18A4, 0x2106, 0x2106, 0x0841, 0xB44F, 0x938C, 0x0841, 0x10A3, 0x2106, 0x18E5, 0x1083, 0x18C5, 0x2106, 0x2106, 0x2106, 0x20E5, 
-0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6207, 0x18A4, 0x2106, 0x2106, 0x1063, 0x1062, 0x1083, 0x2106, 0x2106, 0x2106, 0x2106, 0x1062, 0x1062, 0x2106, 0x2106, 
-0x2106, 0x20E4, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x930A, 0x3124, 0x20E5, 0x2106, 0x0841, 0x6229, 0x2106, 0x2106, 0x2106, 0x18E5, 0x4166, 0x28E3, 0x4144, 
-0x28E4, 0x1083, 0x1083, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x20C3, 0x1062, 0x0020, 0xB38C, 0x82AA, 0x82AA, 0x82AA, 0x51A6, 0x20C2, 
-0x6206, 0xAB8C, 0x930A, 0x7A88, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x930A, 0x18A2, 0xDD32, 0xDD12, 0xBBAD, 0xBBAD, 
-0x7248, 0x0020, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xB44F, 0xEDB4, 0xEDB4, 
-0xD4F1, 0x8289, 0x4965, 0x51A5, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xCCF1, 
-0xEDB4, 0xEDB4, 0xDD32, 0x7248, 0x4965, 0x6A07, 0x7A88, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A2, 0xCCF1, 0xEDB4, 0xEDB4, 0xCCD1, 0x7248, 0x51A6, 0xBBEE, 0x49A6, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x18A2, 0xCCF1, 0xEDB4, 0xD4F1, 0x8ACA, 0x49A6, 0xC490, 0xDDF6, 0x7BAD, 0x830A, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x936C, 0xEE16, 0xC4B1, 0x936C, 0x5AAA, 0xEF3A, 0xF75B, 0xF75B, 0x5ACA, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xF75B, 0xE6D9, 0xA4F2, 0x5289, 0xE6B8, 0xEF3A, 0xF75B, 0xA512, 
-0x6A88, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xF75B, 0xEF3A, 0xA4F2, 0x20E3, 0x8C0F, 0xE6B8, 
-0xEF3A, 0xF75B, 0x41E7, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xF75B, 0xEF3A, 0xA4F2, 0x3103, 
-0x82EA, 0x8C0F, 0xE6B8, 0xEF1A, 0xC616, 0x5207, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xF75B, 0xEF3A, 
-0xA4F2, 0x4985, 0xBBCC, 0x6247, 0x9C70, 0xDE98, 0xEF3A, 0x2103, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 
-0xF75B, 0xEF1A, 0xA4B1, 0x59C6, 0xC40D, 0xC40D, 0x4985, 0x8C0F, 0xD657, 0xD678, 0x2103, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x18A2, 0xEF3A, 0xC5B4, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x8BCD, 0x3185, 0x0861, 0x0861, 0x18A2, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xEF3A, 0xC5B4, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x0841, 0x0861, 0x0861, 0x0841, 
-0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x5AA9, 0xEF3A, 0xC5B4, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x0841, 0x0861, 
-0x0861, 0x1081, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x7BAD, 0xEF3A, 0xC5B4, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 
-0x0841, 0x0861, 0x0841, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x20C2, 0x20E3, 0x734C, 0x5A89, 0x3123, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0x0841, 0x0861, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x3123, 0x3123, 0x20C2, 0x20E3, 0x20E3, 0x20E3, 0x20C3, 0x3123, 0xC40D, 
-0xC40D, 0xC40D, 0x7247, 0x1061, 0x0841, 0x0820, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x20C2, 0x20C3, 0x20C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20C3, 
-0x3123, 0xC40D, 0xC40D, 0x7247, 0x1081, 0x0841, 0x0820, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_left_4.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_left_4_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 
-0x3123, 0x5206, 0xAC8C, 0xAC8C, 0xAC8C, 0xAC8C, 0xAC8C, 0xAC8C, 0x8B8A, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A2, 0x5206, 0xBCEE, 0xAC6E, 0xBCCF, 0xBCCF, 0xDDB0, 0xE5F1, 0xF6F2, 0xF6F2, 0xE691, 0x7B69, 0x18A2, 0x18A2, 0x18A2, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x3944, 0xFF13, 0xF6D2, 0xDDB0, 0xBCEF, 0xD5B0, 0xE5F1, 0xC54F, 0xB4AE, 0xDDF1, 0xF6F2, 0xE692, 0xC550, 0xD590, 0xE5F1, 
-0xE5F1, 0x3944, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x51E6, 0xD590, 0xF6D2, 0xEE92, 0xDDD0, 0xA40E, 0x834C, 0xCD8F, 0xFF13, 0xCD70, 0xBCCF, 0xD5B0, 0x9CF1, 0x9CF1, 
-0xD5B0, 0xDDF1, 0xE5F1, 0xC52F, 0x51E6, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4985, 0x9C0C, 0xDDF1, 0xE5F1, 0xD590, 0xB48F, 0xBC70, 0x72EA, 0x8BEB, 0xEE92, 0xEEB2, 0xBD0F, 0x8C70, 
-0x5BD0, 0x7BCE, 0xB4AE, 0xC52F, 0xDDF1, 0xE5F1, 0xAC8D, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x838B, 0xC52F, 0xDDF1, 0xB48E, 0x832D, 0xEDB4, 0xB44F, 0x6288, 0xBD0E, 0xE5F1, 
-0xD5D1, 0x5BD0, 0x320B, 0x524A, 0x8B6C, 0xAC4E, 0xC52F, 0xE5F1, 0xAC8D, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x49C5, 0xAC4D, 0xBCEF, 0x93AD, 0xB430, 0xCC6F, 0xCC6F, 0x49A6, 
-0x93CB, 0xDDF1, 0xD5B0, 0x5B2E, 0x324C, 0x424B, 0x62CC, 0x9C0D, 0xB4AE, 0xC52F, 0xAC8D, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x9C0D, 0xAC4E, 0x7ACB, 0xA36C, 0x3103, 
-0x3103, 0x1041, 0x838B, 0xDDD0, 0xD590, 0x72CB, 0x840F, 0x3AAD, 0x3167, 0x6A6A, 0xAC4E, 0xAC6E, 0x51E6, 0xA34B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x3123, 0xAC4E, 0x7AAB, 
-0xA32C, 0x5968, 0x5A2B, 0x2105, 0x838B, 0xBCCF, 0xAC8E, 0x7ACB, 0xAC8E, 0x842F, 0x39E8, 0x51E9, 0xAC4E, 0xBD0E, 0x3123, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0x3944, 0xCC4F, 0xD4D2, 0x9A8C, 0xACB3, 0x5A8A, 0x838B, 0xB4AE, 0x9C0D, 0x7B0C, 0xB4AE, 0x6AA9, 0x51C8, 0x9C0D, 0xB4AE, 0xC52F, 
-0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x18A2, 0xEDB4, 0xEDB4, 0xD4F2, 0xAC51, 0xD554, 0x49A6, 0x838B, 0xA42E, 0x82EB, 0xB4AE, 0xAC8E, 0x72EA, 0x5A08, 0x8B8C, 
-0xAC8E, 0xBCEE, 0x51E6, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xEDB4, 0xEDB4, 0xEDB4, 0xDD32, 0xDD12, 0x938C, 0x7B2B, 0x82CB, 0xBBCD, 0xAC4E, 0x8B6C, 0x9BED, 
-0x5A47, 0x4166, 0xA44D, 0xBCCF, 0xAC8D, 0x1882, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xA3AE, 0xB38D, 0xB3AD, 0x832C, 
-0x72CB, 0x8B6C, 0x7B0A, 0x3945, 0x7B2B, 0xB4AE, 0xB4AE, 0x7308, 0x6AA8, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x6A89, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xC42F, 0xBBAD, 
-0xCCB0, 0x624A, 0x624A, 0x624A, 0x7AEB, 0x836B, 0x4186, 0x834C, 0xB4AE, 0xC52F, 0xB4AE, 0x6AA8, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20C2, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xD4D1, 
-0xBBCD, 0xBBAD, 0xDD33, 0x624A, 0x624A, 0x624A, 0x624A, 0x72CB, 0x836B, 0x4166, 0x7AEB, 0x834C, 0xBCCF, 0xB4AE, 0x6AA8, 0xA34B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x20C2, 0x20C2, 0x20C2, 
-0x20C2, 0x82A9, 0xBBAD, 0xDD32, 0xCCF1, 0x28E4, 0x624A, 0x624A, 0x624A, 0x624A, 0x6A8B, 0x93AC, 0x3104, 0x4166, 0x834C, 0xB4AE, 
-0x49E5, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4985, 0x9C4F, 0xD5F5, 0xB512, 0x18A2, 0x5A2A, 0x624A, 0x624A, 0x624A, 0x624A, 0x6A8B, 0xAC8E, 0x9BEC, 
-0x4186, 0x832C, 0x7B0C, 0x18A3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4144, 0x7269, 0x8B2B, 0x7207, 0x5185, 0x28E4, 0x624A, 0x624A, 0x624A, 0x624A, 0x624A, 
-0x7ACB, 0xB4AE, 0x7B2A, 0x4987, 0x5A09, 0x3944, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x51A5, 0x72A9, 0xCD94, 0xDE77, 0x936C, 0x5185, 0x28E4, 0x624A, 0x7ACB, 0x6A6B, 
-0x624A, 0x624A, 0x6A8B, 0x9C0D, 0x7B2A, 0x3125, 0x49A6, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x6207, 0x51A5, 0x72A9, 0xCDB4, 0xDE77, 0xDE77, 0xD5F6, 0x5A07, 0x28E4, 0x624A, 
-0x93CD, 0x93CD, 0x6A6B, 0x624A, 0x624A, 0x7ACB, 0x9BEC, 0x6288, 0x6227, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x51A5, 0x4944, 0x5185, 0xA42F, 0xDE77, 0xDE77, 0xDE77, 0xD616, 0x62AA, 
-0x28E4, 0x624A, 0x7AEB, 0xAC4E, 0x9BED, 0x624A, 0x624A, 0x6A6B, 0x832C, 0x9BED, 0x838B, 0x72E9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x61C6, 0x61C6, 0x7207, 0x6186, 0x93AE, 0xDE77, 0xDE77, 0xDE77, 
-0xD616, 0x62AA, 0x28E4, 0x624A, 0x624A, 0x6A6B, 0xAC4E, 0xAC4E, 0x93CD, 0x624A, 0x624A, 0x8B6C, 0xB4AE, 0x3984, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x7207, 0x7207, 0x7207, 0x5986, 0x8B8E, 0xDE77, 
-0xDE77, 0xDE77, 0x834C, 0x5185, 0x1041, 0x3945, 0x5A2A, 0x624A, 0x624A, 0xB4AE, 0xAC4D, 0x9C0D, 0x9C0D, 0x5A47, 0x18A2, 0x930A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x7207, 0x69E7, 0x61A6, 0x5145, 
-0x8B8E, 0xDE77, 0xDE77, 0xDE77, 0x834C, 0x5185, 0x4985, 0x7A88, 0x49A7, 0x5A2A, 0x624A, 0xB4AE, 0x72E9, 0x3103, 0x3103, 0x7A88, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x4945, 0x5146, 
-0x38A4, 0x4967, 0xACB1, 0xDE77, 0xDE77, 0xC594, 0x72AA, 0x3903, 0x4985, 0xC40D, 0x7A88, 0x3945, 0x4166, 0x8B8C, 0x49A5, 0x930A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x0820, 0x38A4, 0x40E4, 0x8B4C, 0xDE77, 0xDE77, 0xDE77, 0x93CE, 0x4925, 0x20E3, 0x6ACA, 0x930A, 0xC40D, 0x7A88, 0x6207, 0x3945, 
-0x41C5, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x0841, 0x5986, 0x61A6, 0x9BAD, 0xDE77, 0xDE77, 0xDE77, 0x93CE, 0x30A4, 0x39A6, 0x8C0F, 0x6207, 0xC40D, 0xC40D, 
-0xC40D, 0x7A88, 0x7A88, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x7207, 0x82CA, 0xCDF5, 0xDE77, 0xDE77, 0xDE77, 0x93CE, 0x1062, 0x838D, 0x8C0F, 0x6207, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x7207, 0x8B2B, 0xDE77, 0xDE77, 0xDE77, 0xA470, 0x4966, 0x1082, 0x8B6D, 
-0x5A69, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x7A48, 0x936C, 0xDE77, 0xDE77, 0xDE77, 0x9C2F, 0x4926, 
-0x20C2, 0x832C, 0xAC91, 0x734C, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x8B2B, 0xDE77, 0xDE77, 0xDE77, 0xD616, 
-0x93CE, 0x7227, 0x61C6, 0x20E3, 0xAC91, 0x734C, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x938D, 0xDE77, 0xDE77, 
-0xDE77, 0xA491, 0x7268, 0x7207, 0x69E6, 0x3103, 0x83CE, 0x734C, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1082, 0x9C2F, 
-0xDE77, 0xDE77, 0xCDB5, 0x938D, 0x7228, 0x7207, 0x69E7, 0x3925, 0x5289, 0x734C, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x1082, 0x8BAD, 0xBD33, 0xCDB5, 0x9C0F, 0x7A89, 0x7207, 0x4186, 0x3946, 0x2106, 0x2945, 0x2944, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0x3166, 0xB533, 0x8BAD, 0x93CE, 0x628A, 0x3967, 0x3146, 0x18C4, 0x2106, 0x2106, 0x18A4, 0x0020, 0x7A88, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xC5D5, 0xDE77, 0xBD53, 0x6AAB, 0x2927, 0x2106, 0x2106, 0x10A4, 0x2106, 0x2106, 0x2106, 0x1083, 
-0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x18C5, 0xDE57, 0xDE77, 0xBD74, 0x5A49, 0x2106, 0x2106, 0x18A4, 0x10A3, 0x2106, 0x2106, 
-0x2106, 0x10A3, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x2904, 0x0020, 0xEDB4, 0xDD73, 0x83AE, 0x10A3, 0x2106, 0x2106, 0x10A4, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x1062, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x1083, 0x49E7, 0xEDB4, 0xB44F, 0x0861, 0x2106, 0x2106, 0x18C4, 
-0x1083, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x1062, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x0020, 0xCCF1, 0xEDB4, 0xB44F, 0x0861, 0x2106, 
-0x2106, 0x18C4, 0x18C4, 0x2106, 0x2106, 0x2106, 0x2106, 0x18C5, 0x0841, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x28E4, 0x0841, 0xCCF1, 0xEDB4, 0xDD53, 
-0x6A89, 0x18A4, 0x18E5, 0x10A4, 0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x1083, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x18A4, 0x18E5, 0x41A6, 
-0xEDB4, 0xBCB0, 0x3124, 0x1062, 0x18C5, 0x1083, 0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x1083, 0x59C6, 0xBBCC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x18A4, 
-0x2106, 0x1083, 0x20C2, 0x2904, 0x20E5, 0x2106, 0x6229, 0xA34C, 0x3987, 0x2106, 0x2106, 0x2106, 0x18C4, 0x59E6, 0xBBCC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7247, 0x18A2, 0x18A2, 0x0020, 0xA34C, 0x3167, 0x3167, 0x2926, 0x6A49, 0xBBAD, 0xBBAD, 0x49A8, 0x2106, 0x2106, 0x20E4, 0x7247, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xBBAD, 0xBBAD, 0xBBAD, 0x7248, 0x59E6, 0xC3EE, 0xC42F, 0xBBCD, 0x49A8, 0x3946, 
-0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x5A07, 0xCC4F, 0xBBAD, 0xBBAD, 0x8ACA, 0x59E6, 0xC470, 0xEDB4, 0xCC90, 
-0xCC6F, 0x9B4B, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xCCF1, 0xE573, 0xBBAD, 0xBBAD, 0xBBAD, 0x59E6, 0x82EA, 
-0xE573, 0xEDB4, 0xEDB4, 0xB44F, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xCCF1, 0xE593, 0xCC90, 0xBBAD, 0xBBAD, 
-0x59E6, 0x7248, 0xDD32, 0xEDB4, 0xEDB4, 0xB44F, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xCCF1, 0xEDB4, 0xDD32, 
-0xBBAD, 0x8ACA, 0x6206, 0x6206, 0xA36C, 0xE573, 0xEDB4, 0xB44F, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x3944, 
-0xEDB4, 0xEDB4, 0xD4F1, 0xAB6C, 0x61E6, 0x1061, 0x8ACA, 0xE573, 0xEDB4, 0xB44F, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3944, 0xDD73, 0xEDD5, 0xE615, 0xDE77, 0x62EA, 0x7248, 0xDD32, 0xEDB4, 0xEDD4, 0x93AD, 0x6207, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x41E7, 0xEF3A, 0xE698, 0xDE77, 0xDE77, 0x39A6, 0xABAD, 0xE5D5, 0xEE77, 0xA512, 0x6A88, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x5207, 0xB594, 0xEF1A, 0xDE77, 0xDE77, 0x39A6, 0xC5B5, 0xE698, 0xF75B, 
-0xF75B, 0x7BAD, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x41E7, 0xEF3A, 0xE6B8, 0xDE77, 0x8C0F, 0x734C, 
-0xE698, 0xF75B, 0xF75B, 0x7BAD, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x6247, 0x9CB1, 0xE6F9, 0xDE77, 
-0xDE77, 0x20E3, 0xE698, 0xF75B, 0xF75B, 0x7BAD, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5ACA, 
-0xEF3A, 0xE6B8, 0xDE77, 0x20E3, 0xE698, 0xF75B, 0xF75B, 0x7BAD, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7AC9, 0x8C2F, 0xE6D9, 0xDE77, 0x20E3, 0xE698, 0xF75B, 0xA512, 0x6247, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x7B8D, 0xE6F9, 0xE6B8, 0x20E3, 0xE698, 0xF75B, 0x9CB1, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x9CB1, 0xE6B8, 0x20E3, 0xE698, 0xF75B, 0x9CB1, 0x6207, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4164, 0x62EA, 0xD637, 0x20E3, 0xE698, 0xF75B, 0x9CB1, 0x6207, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4164, 0x0841, 0x0861, 0x5A89, 0x20E3, 0x942F, 0xF75B, 
-0x9CB1, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x4164, 0x0841, 0x0861, 0x0841, 0x1082, 0x20E3, 
-0x3164, 0x736C, 0x4A48, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3123, 0x28E3, 0x0841, 0x0020, 0x0020, 0x1081, 
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18A2, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x0841, 0x0841, 0x0841, 0x20C3, 
-0x20C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18A2, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_left_5.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_left_5_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 
-0x3123, 0x3123, 0x3123, 0x3123, 0x3123, 0x3123, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0x18A2, 0x5226, 0xC54F, 0xC54F, 0xC54F, 0xC54F, 0xC54F, 0xC54F, 0x8BAA, 0x7247, 0x59C6, 0x18A2, 0x18A2, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0x3964, 0x39A4, 0xD5B0, 0xB4AE, 0xB4CF, 0xB4CF, 0xCD70, 0xDDD0, 0xF6F2, 0xFF13, 0xF712, 0x8BCA, 0x9C0B, 0xE5F1, 0xE5F1, 0x3984, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA34B, 0x51E6, 0xEE91, 0xF6F2, 0xDDB0, 0xC52F, 0xCD50, 0xDDF1, 0xCD90, 0xB4CF, 0xDDD0, 0xF6D2, 0xE671, 0xC550, 0xD5B0, 0xE5F1, 
-0xE5F1, 0xE5F1, 0x5206, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x6AA8, 0xBCEE, 0xEE92, 0xEE92, 0xD590, 0xA40E, 0x832B, 0xCD8F, 0xFF13, 0xD5B0, 0xB4AE, 0xC570, 0x94F1, 0x9CD0, 
-0xCD70, 0xCD70, 0xCD70, 0xDDF1, 0xC52F, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4985, 0x9C0C, 0xDDD0, 0xE5F1, 0xDDB0, 0xA40E, 0xC491, 0x72EA, 0x83AA, 0xE651, 0xEE92, 0xC530, 0x8450, 
-0x53AF, 0x630D, 0x8B6C, 0xA42E, 0xB4AE, 0xDDD0, 0xC52F, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x838B, 0xBCEF, 0xDDF1, 0xB4CF, 0x832D, 0xEDB4, 0xBCB0, 0x6AA8, 0xBD0E, 0xE5F1, 
-0xD5D1, 0x53AF, 0x29EB, 0x526B, 0x7AEB, 0x7AEB, 0xAC4E, 0xC50F, 0xC52F, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x49C5, 0x9C0C, 0xC50F, 0x832C, 0xB430, 0xCC6F, 0xCC6F, 0x49A6, 
-0x93CB, 0xDDF1, 0xD5B0, 0x5B2E, 0x324C, 0x4ACC, 0x5A8A, 0x51E9, 0x9C0D, 0xB4AE, 0xC52F, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x838B, 0xB4AE, 0x728B, 0xA36C, 0x3103, 
-0x3103, 0x1041, 0x838B, 0xDDD0, 0xD590, 0x72CB, 0x840F, 0x3AAD, 0x2926, 0x51C8, 0x9C0D, 0xB4AE, 0xC52F, 0x3123, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x3123, 0x9C0D, 0x726B, 
-0xA32C, 0x5968, 0x5A2B, 0x2105, 0x838B, 0xBCCF, 0xAC8E, 0x7ACB, 0xAC8E, 0x842F, 0x39E8, 0x51C8, 0x9C0D, 0xD5B0, 0x3944, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0x3944, 0xC42F, 0xD4D2, 0x9A8C, 0xACB3, 0x5A8A, 0x838B, 0xB4AE, 0x9C0D, 0x7B0C, 0xB4AE, 0x6AA9, 0x51C8, 0x93CD, 0xB4AE, 0xDDD0, 
-0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x3103, 0xCCF1, 0xEDB4, 0xD4F2, 0xAC51, 0xD554, 0x49A6, 0x838B, 0xA42E, 0x82EB, 0xB4AE, 0xAC8E, 0x6268, 0x51C8, 0x8B6C, 
-0xAC8E, 0xDDD0, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x3103, 0xCCF1, 0xEDB4, 0xEDB4, 0xDD32, 0xDD12, 0x938C, 0x7B2B, 0x82CB, 0xBBCD, 0xAC4E, 0x8B6C, 0x72AA, 
-0x51C7, 0x5A09, 0x9C0D, 0xCD70, 0x5226, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xCCF1, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xA3AE, 0xB38D, 0xB3AD, 0x832C, 
-0x832C, 0xB4AE, 0x5A47, 0x51C8, 0x832C, 0xAC8E, 0xC52F, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5A07, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xC42F, 0xBBAD, 
-0xCCB0, 0x624A, 0x6A8B, 0x9BED, 0x93AC, 0x5A28, 0x5A09, 0xAC4E, 0xBCCE, 0x72E8, 0x4985, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xD4D1, 
-0xBBCD, 0xBBAD, 0xDD33, 0x624A, 0x624A, 0x6A8B, 0x9BED, 0x9BEC, 0x51C7, 0x72AA, 0xB4AE, 0xBCCE, 0xAC8C, 0x6AC8, 0x3123, 0xA34B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x3985, 0x3985, 0x3985, 
-0x3985, 0x82A9, 0xBBAD, 0xD4F1, 0xD512, 0x2904, 0x624A, 0x624A, 0x72CB, 0x9BED, 0x9BEC, 0x49A6, 0x7AEB, 0x8B6C, 0xBCEF, 0xA42D, 
-0x6269, 0x3944, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0xAB8C, 0xAB8C, 0xAB8C, 0x4985, 0xB4F2, 0xDE57, 0xC594, 0x18A2, 0x624A, 0x624A, 0x624A, 0x6A6B, 0xA42E, 0xA42D, 0x1061, 0x1061, 
-0x18A2, 0x41A6, 0x6A6B, 0x18A3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x49C6, 0x6207, 0x7A89, 0x7207, 0x5185, 0x28E4, 0x624A, 0x624A, 0x624A, 0x624A, 0xAC4E, 
-0x3123, 0xBBCC, 0xC40D, 0x7247, 0x18A2, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x6268, 0xA4D2, 0xDE77, 0xDE77, 0x8B2B, 0x5185, 0x28E4, 0x624A, 0x624A, 0x624A, 
-0x624A, 0x9BED, 0x9C0C, 0x49A5, 0xA34B, 0xC40D, 0xC40D, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x7A88, 0x59C6, 0x83AD, 0xDE77, 0xDE77, 0xDE77, 0xCDF5, 0x5185, 0x28E4, 0x624A, 
-0x7ACB, 0x832C, 0x6A6B, 0x624A, 0x9BED, 0x9C0D, 0x6227, 0x7A88, 0x7A88, 0x5A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x59E6, 0x3903, 0x6248, 0xC553, 0xDE77, 0xDE77, 0xDE77, 0xCDF5, 0x5185, 
-0x28E4, 0x624A, 0x7B0C, 0xA42E, 0x93CD, 0x6A6B, 0x6A6B, 0x93AD, 0x93CC, 0x5A67, 0x5A67, 0x9C0C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x4965, 0x4965, 0x7207, 0x9BAD, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 
-0x9C2F, 0x5185, 0x28E4, 0x624A, 0x624A, 0x7AEB, 0xAC4E, 0x9BED, 0x624A, 0x6A6B, 0x93CD, 0xB4AE, 0xB4AE, 0x5A67, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x61C6, 0x7207, 0x7207, 0x9BAD, 0xDE77, 0xDE77, 
-0xDE77, 0xAC91, 0x7248, 0x5185, 0x28E4, 0x624A, 0x624A, 0x624A, 0x72CB, 0xAC4E, 0x9C0D, 0x9C0D, 0xAC4E, 0x72E9, 0x3144, 0x7A88, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x61C6, 0x7207, 0x7207, 0x9BAD, 
-0xDE77, 0xDE77, 0xDE77, 0x93CE, 0x7207, 0x5185, 0x0841, 0x3946, 0x624A, 0x624A, 0x624A, 0x6A8B, 0x9C0C, 0x18A2, 0x18A2, 0x6227, 
-0xAB8C, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x61C6, 0x69E7, 
-0x6A49, 0xD636, 0xDE77, 0xDE77, 0xA470, 0x7268, 0x7207, 0x5185, 0x4A07, 0x6B0B, 0x1061, 0x4187, 0x624A, 0x624A, 0x3123, 0xAB8C, 
-0xAB8C, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A2, 0x38A4, 0x6229, 0xDE77, 0xDE77, 0xDE77, 0x9C2F, 0x7228, 0x59A6, 0x20E3, 0xAC91, 0x734C, 0x7A88, 0x59C6, 0x18A2, 0x18A2, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x18A2, 0x4905, 0x832D, 0xDE77, 0xDE77, 0xD616, 0x93CE, 0x69E7, 0x30A4, 0x20E3, 0xAC91, 0x8C0F, 0x7AEA, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x7A89, 0xDE77, 0xDE77, 0xDE77, 0xA491, 0x61E8, 0x38C4, 0x28A3, 0x41C6, 0x9C2F, 0xCDF5, 
-0x5289, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xAC90, 0xDE77, 0xDE77, 0xDE77, 0xA491, 0x4966, 0x38A4, 0x1082, 0x8B6D, 
-0x8B6D, 0xB4F2, 0x5289, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xDE77, 0xDE77, 0xDE77, 0xC594, 0x72CB, 0x4105, 0x38A4, 
-0x4965, 0x4A07, 0x8B6D, 0xB4F2, 0xA4D1, 0x6AA9, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x8C0F, 0xDE77, 0xDE77, 0xDE77, 0xB4F2, 0x6A49, 
-0x61A6, 0x61A6, 0x61C6, 0x20E3, 0x8B6D, 0x93CE, 0xC594, 0x5289, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x836D, 0xDE77, 0xDE77, 0xC594, 
-0x830B, 0x7227, 0x7207, 0x7207, 0x7207, 0x4944, 0x3986, 0x8B6D, 0xBD53, 0x5289, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x7B0B, 0x93CE, 
-0xCDB5, 0x8B6D, 0x7AAA, 0x7207, 0x7207, 0x7207, 0x7207, 0x59C7, 0x18A4, 0x41C6, 0xBD53, 0x5289, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xA4D2, 
-0xDE77, 0x93CE, 0x834C, 0x72AA, 0x69E7, 0x7207, 0x7207, 0x61E7, 0x59C7, 0x2106, 0x18C4, 0x41A6, 0x832C, 0xBD53, 0x39A6, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x3103, 0xA4D2, 0xDE77, 0xD616, 0x6ACB, 0x2106, 0x4166, 0x59C7, 0x59C7, 0x2106, 0x2106, 0x2106, 0x2106, 0x1083, 0x5228, 0xB4F2, 
-0x3185, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x7289, 0xBCF2, 0xDE77, 0xB4F2, 0x5249, 0x2106, 0x2106, 0x2106, 0x18E5, 0x1083, 0x2106, 0x2106, 0x2106, 0x18C4, 
-0x3986, 0x8BCE, 0x2924, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4985, 0xB44F, 0xEDB4, 0x838D, 0x49E8, 0x2106, 0x2106, 0x2106, 0x2106, 0x18A4, 0x18C4, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x1062, 0x8C0F, 0x39A6, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x72A9, 0xCCF1, 0xEDB4, 0x20C2, 0x18E5, 0x2106, 0x2106, 0x2106, 0x18E5, 0x10A4, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x18C5, 0x9C0F, 0x39A5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x18A2, 0x938C, 0xEDB4, 0xEDB4, 0x20C2, 0x2106, 0x2106, 0x2106, 0x2106, 0x18C4, 
-0x1083, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x9BEF, 0x3985, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A3, 0x1083, 0x938C, 0xEDB4, 0xEDB4, 0x20C2, 0x2106, 0x2106, 0x2106, 
-0x18C5, 0x1083, 0x18E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x9BEF, 0x3985, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A3, 0x1083, 0x832B, 0xEDB4, 0xEDB4, 0xCCF1, 0x0841, 
-0x2106, 0x18E5, 0x1083, 0x1083, 0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x1062, 0x938C, 0x3985, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x18A2, 0x1041, 0x938C, 0xCCF1, 
-0x20E3, 0x0861, 0x2106, 0x2906, 0x18A4, 0x18C5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x1062, 0x832B, 0x5207, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 
-0x1041, 0x0841, 0x2106, 0x2106, 0x49A8, 0x7A8A, 0x59E6, 0x2905, 0x49A8, 0x2926, 0x2106, 0x2106, 0x2106, 0x20E5, 0x20C3, 0x3103, 
-0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x61E6, 0x51C7, 0x5A09, 0x6229, 0xBBAD, 0xBBAD, 0x59E6, 0x7248, 0xBBAD, 0x6229, 0x5A09, 0x5A09, 0x4187, 0x3124, 
-0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4985, 0x8ACA, 0xBBAD, 0xBBAD, 0xBBAD, 0xBBAD, 0x9B0A, 0x6206, 0x61E6, 0xA32B, 0xBBAD, 0xBBCD, 0xD4B0, 
-0x82EA, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xA3CD, 0xC3EE, 0xBBAD, 0xBBAD, 0x9B0A, 0x61E6, 0xA34B, 0x4985, 0x8ACA, 0xD4D1, 
-0xDD12, 0xEDB4, 0x938C, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x72C9, 0xDD53, 0xE553, 0xC3EE, 0xBBAD, 0x8ACA, 0x4985, 0xC40D, 0xA34B, 
-0x4985, 0xCCF1, 0xEDB4, 0xEDB4, 0x938C, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x938C, 0xEDB4, 0xEDB4, 0xC3EE, 0xA32B, 0x4985, 0xBBCC, 
-0xC40D, 0xC40D, 0x3103, 0xCCF1, 0xEDB4, 0xEDB4, 0xDD53, 0x72C9, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x938C, 0xEDB4, 0xEDB4, 0xE573, 0xA32B, 
-0x3123, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xB44F, 0xEDB4, 0xEDB4, 0xEDB4, 0x834C, 0x7AC9, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x8B6C, 0xDD53, 0xEDB4, 
-0xC3EE, 0xABEE, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4144, 0xB44F, 0xE553, 0xEDD4, 0xEEB8, 0x5ACA, 0x7A88, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 
-0x936C, 0xDDB4, 0xC490, 0xC5B4, 0x5207, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1882, 0xC44F, 0xEE98, 0xF75B, 0x7BAD, 0x830A, 
-0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3103, 0xB594, 0xDE98, 0xDE77, 0xA4F2, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x9B8D, 0xEF3A, 0xF75B, 
-0xF75B, 0x5ACA, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xB594, 0xEEF9, 0xDE77, 0xA4F2, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x39A6, 
-0xE6D9, 0xF75B, 0xF75B, 0x5ACA, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5A68, 0xE6F9, 0xDE77, 0xA4F2, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x39A6, 0xE6D9, 0xF75B, 0xF75B, 0x5ACA, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xD678, 0xEF1A, 0xA4F2, 0x4985, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBCC, 0x7AA9, 0x736C, 0xEF1A, 0xF75B, 0x5ACA, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xD678, 0xEF3A, 0xA4F2, 0x4985, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5289, 0xE6F9, 0xF75B, 0x5ACA, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xEF3A, 
-0xDE78, 0x8C0F, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x734C, 0xEF1A, 0x5ACA, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A2, 0xBD94, 0xEF1A, 0x8C0F, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x734C, 0xEF1A, 0x7BAD, 0x7AC9, 0xBBCC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x18A2, 0x18C3, 0x9C91, 0x5A89, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x734C, 0xEF1A, 0xF75B, 
-0x41E7, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x1061, 0x0861, 0x0861, 0x0841, 0x4164, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x734C, 
-0xEF1A, 0xF75B, 0x41E7, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x20A2, 0x0841, 0x0861, 0x0861, 0x0861, 0x0840, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0x4185, 0x4A27, 0xC616, 0xF75B, 0x41E7, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x4985, 0x20C2, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x7A88, 0xC40D, 0xC40D, 
-0xBBCC, 0x4185, 0x18C2, 0x20E3, 0x5A89, 0x736C, 0x2124, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x20A2, 0x0841, 0x0841, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x49A5, 0xBBCC, 
-0x59C6, 0x3123, 0x28E3, 0x20C2, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x0841, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0xAB8C, 0xAB8C, 0xAB8C, 
-0xBBCC, 0x59C6, 0x28E3, 0x20C3, 0x20C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x0841, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_left_6.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_left_6_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A2, 0x0020, 0xE5F1, 0xE5F1, 0xE5F1, 0xE5F1, 0xE5F1, 0xE5F1, 0xE5F1, 0x3984, 0x930A, 0x18A2, 0x0020, 0x18A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 
-0x49C5, 0x2102, 0xC54F, 0xBCCF, 0xB4CF, 0xB4CF, 0xBCEF, 0xDDD0, 0xEE71, 0xF712, 0xFF13, 0xF6F2, 0x5266, 0xC54F, 0xE5F1, 0xC52F, 
-0x3123, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x51C5, 0xBD2E, 0xFF13, 0xE611, 0xC50F, 0xC50F, 0xD5B0, 0xDDF1, 0xBD0F, 0xC52F, 0xE631, 0xF6D2, 0xCDD1, 0xBD0F, 0xDDF1, 
-0xE5F1, 0xE5F1, 0xAC8D, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x6A67, 0xAC8C, 0xEE71, 0xEEB2, 0xE611, 0xBCCF, 0x8B4D, 0x838A, 0xFF13, 0xE671, 0xBD0F, 0xC50F, 0xBD70, 0x7C91, 
-0xB510, 0xCD70, 0xCD70, 0xE5F1, 0xC54F, 0x5206, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x62A8, 0xDDB0, 0xE5F1, 0xE5F1, 0xAC4E, 0xA40F, 0xCCF1, 0x18C2, 0xDE11, 0xEE92, 0xDDF1, 0xACD0, 
-0x7451, 0x4B0E, 0x7B4C, 0xAC8E, 0xB4AE, 0xCD70, 0xE5F1, 0xAC8D, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x5A67, 0xC50F, 0xDDB0, 0xCD70, 0x72AB, 0xDD53, 0xDD53, 0x72CA, 0x7B4A, 0xE5F1, 
-0xE5F1, 0xA511, 0x4B4E, 0x218A, 0x51EA, 0x834C, 0xB4AE, 0xB4AE, 0xCD70, 0xAC8D, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x6227, 0x838B, 0xBCEF, 0x93AD, 0xB450, 0xC44F, 0xCC6F, 0xB3CD, 
-0x3144, 0xCD70, 0xE5F1, 0xA46F, 0x52ED, 0x218A, 0x52ED, 0x626B, 0x832C, 0xB4AE, 0xBCEF, 0xAC8D, 0x4985, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x72E9, 0xB4AE, 0x7AEB, 0xBBEE, 0x4965, 
-0x3103, 0x20C2, 0x3144, 0xC52F, 0xE5F1, 0xA42D, 0x83AD, 0x63AF, 0x324C, 0x3946, 0x624A, 0xB4AE, 0xBCEF, 0xAC8D, 0x4985, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x49A5, 0x7B2A, 0x7AEB, 
-0xB38D, 0x61A8, 0x59A9, 0x526C, 0x3144, 0xB4AE, 0xBCCF, 0x8B8C, 0x93CD, 0xAC8E, 0x6C10, 0x3145, 0x624A, 0xBCCF, 0xA44C, 0x51C5, 
-0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x4985, 0x8ACA, 0xE573, 0xBAED, 0x726B, 0xCE79, 0x3144, 0xB4AE, 0xB4AE, 0x8B6C, 0x93CD, 0xB4AE, 0x49C6, 0x5A09, 0xB4AE, 0xBCCF, 
-0xAC8D, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0x938C, 0xEDB4, 0xEDB4, 0x82AC, 0xE678, 0xAB6C, 0x3144, 0xAC8E, 0x8B6C, 0x938C, 0xB4AE, 0xAC4E, 0x49C6, 0x5A09, 
-0xB4AE, 0xC52F, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4985, 0x938C, 0xEDB4, 0xEDB4, 0xEDB4, 0xCC6F, 0xCCF1, 0x5227, 0x8B6C, 0x9B2C, 0xB42E, 0xAC4E, 0x72AB, 
-0x3925, 0x5A09, 0x9C0D, 0xBCEE, 0x51E6, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x938C, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xD512, 0x9B2C, 0xBBAD, 0xABAD, 
-0x7AEB, 0x624A, 0x6269, 0x51E8, 0x624A, 0xB4AE, 0xBCEE, 0x5206, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x72A9, 0xDD53, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xDD32, 0xBBAD, 
-0xC40E, 0x9B4D, 0x624A, 0x624A, 0x9C0D, 0x3945, 0x624A, 0x9BED, 0xBCCF, 0xBCEE, 0x6A87, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xB44F, 0xEDB4, 0xEDB4, 0xEDB4, 0xE593, 
-0xCC6F, 0xBBAD, 0xD4B0, 0xA3EF, 0x624A, 0x624A, 0x9C0D, 0x72E9, 0x3125, 0x6A6B, 0x93AD, 0xBCCF, 0x93CC, 0x49A6, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5207, 0x5A27, 0x5A27, 
-0x5A27, 0x6248, 0xBBAD, 0xC42F, 0xE553, 0x8B4C, 0x49C8, 0x624A, 0x7AEB, 0xAC8E, 0x72E9, 0x28E4, 0x4166, 0x832C, 0x8B6C, 0x6A8A, 
-0x4186, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 
-0x930A, 0x930A, 0x930A, 0x930A, 0x5A28, 0xDDF6, 0xE637, 0x732B, 0x4166, 0x624A, 0x624A, 0xAC4E, 0xB4AE, 0x1061, 0x7268, 0x18A3, 
-0x3986, 0x6A8B, 0x3125, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x2082, 0x7A89, 0x7A89, 0x7228, 0x28C3, 0x51E8, 0x624A, 0x6A8B, 0xB4AE, 0x838B, 
-0x4985, 0xAB8C, 0x7268, 0x3946, 0x3125, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3965, 0xC5B5, 0xAC90, 0x7207, 0x7207, 0x28C3, 0x49A8, 0x624A, 0x624A, 
-0x6A8B, 0xB4AE, 0x72E9, 0x4985, 0xBBCC, 0x59E6, 0x0841, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0xAB8C, 0x2924, 0xDE77, 0xDE77, 0xDE77, 0xAC90, 0x7A48, 0x28C3, 0x49A8, 
-0x624A, 0x624A, 0x624A, 0x6A8B, 0xAC8E, 0x93CC, 0x49A5, 0xAB8C, 0xAB8C, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x930A, 0x20A2, 0x2082, 0x7A89, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 0xA42F, 
-0x28C3, 0x49A8, 0x624A, 0x624A, 0x7ACB, 0x624A, 0x72AB, 0xA42E, 0x7B2A, 0x3143, 0x3143, 0x838B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5185, 0x28C3, 0x69E6, 0x7207, 0xA3EE, 0xDE77, 0xDE77, 0xDE77, 
-0xDE77, 0xA42F, 0x28C3, 0x49A8, 0x624A, 0x624A, 0xB4AE, 0x7B0C, 0x624A, 0x6A8B, 0x93CD, 0xA42E, 0xB4AE, 0x838B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x4944, 0x7207, 0x7207, 0x7207, 0xDE77, 0xDE77, 
-0xDE77, 0xDE77, 0xCDF5, 0x93AD, 0x28C3, 0x49A8, 0x624A, 0x624A, 0x93CD, 0xAC6E, 0x7ACB, 0x624A, 0x6A8B, 0x9BED, 0x93CC, 0x6227, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x4944, 0x7207, 0x7207, 0x7207, 
-0xDE77, 0xDE77, 0xDE77, 0xDE77, 0xB4F2, 0x7AAA, 0x28C3, 0x28E4, 0x5A09, 0x624A, 0x624A, 0x938D, 0xAC4E, 0x8B6C, 0x7B0A, 0x5A67, 
-0x6227, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x4944, 0x7207, 
-0x5145, 0x4925, 0xDE77, 0xDE77, 0xDE77, 0xCDB5, 0x938D, 0x7248, 0x28C3, 0x734C, 0x3965, 0x5A2A, 0x624A, 0x6A6B, 0x6ACA, 0x41C5, 
-0x6227, 0x7A88, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 
-0x51A5, 0x38E4, 0x38A4, 0x38A4, 0xDE77, 0xDE77, 0xDE77, 0xBD53, 0x7AAA, 0x4944, 0x41A6, 0xBD74, 0xB553, 0x3965, 0x18A3, 0x18A3, 
-0x3944, 0x930A, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x4985, 0x2883, 0x38A4, 0x61A6, 0xDE77, 0xDE77, 0xDE77, 0xBD53, 0x6229, 0x2082, 0x5228, 0x8BAD, 0xCDF5, 0x20E3, 
-0xAB8C, 0xAB8C, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x5165, 0x69E7, 0xC553, 0xDE77, 0xDE77, 0xDE77, 0xBD53, 0x49C7, 0x41A6, 0x832C, 0x8B6D, 
-0xC5B5, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x5185, 0x7207, 0xD5F5, 0xDE77, 0xDE77, 0xCDB5, 0x6A6A, 0x2083, 0x41A6, 
-0x832C, 0x8B6D, 0xBD53, 0xDE77, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x5185, 0x82CA, 0xD636, 0xDE77, 0xDE77, 0xCDB5, 0x6A6A, 
-0x5986, 0x4944, 0x5207, 0x832C, 0x8B6D, 0xD616, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x5185, 0xD5F5, 0xDE77, 0xDE77, 0xDE57, 
-0xACD1, 0x7A89, 0x7207, 0x7207, 0x28C3, 0x628A, 0x8B6D, 0xD616, 0x5289, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x7AEA, 0xD636, 0xDE77, 
-0xDE77, 0xD616, 0x830B, 0x7207, 0x7207, 0x7207, 0x4944, 0x41A6, 0x832C, 0xBD33, 0xDE77, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x83AE, 
-0xDE57, 0xDE77, 0xDE57, 0xACB1, 0x7A89, 0x7207, 0x7207, 0x7207, 0x7207, 0x28E4, 0x3965, 0x832C, 0xDE77, 0x18A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x4985, 0x628A, 0xA470, 0xDE57, 0xA470, 0x834C, 0x7207, 0x7207, 0x7207, 0x7207, 0x51A7, 0x2926, 0x18C5, 0x3124, 0xDE77, 0x8BEE, 
-0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7247, 0x732B, 0xBD74, 0x93CE, 0x9C2F, 0x834C, 0x7248, 0x7207, 0x7207, 0x51A7, 0x3146, 0x2926, 0x2106, 0x2106, 0x0841, 
-0x9C2F, 0x838D, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4985, 0x8C0F, 0xDE77, 0xD616, 0x93CE, 0x3167, 0x2926, 0x2926, 0x2926, 0x20E5, 0x18C5, 0x2106, 0x2106, 
-0x2106, 0x20E5, 0x1082, 0xB553, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x8C0F, 0xDE77, 0x9C2F, 0x39A8, 0x2106, 0x2106, 0x2106, 0x18E5, 0x18C5, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x0020, 0xDE77, 0x8C0F, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0xAB8C, 0xAB8C, 0x59C6, 0x938C, 0xEDB4, 0xC574, 0x39C8, 0x2106, 0x2106, 0x2106, 0x18E5, 0x1083, 
-0x18C5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20C2, 0xB44F, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0x0841, 0x20C2, 0xB44F, 0xEDB4, 0x3985, 0x20E5, 0x2106, 0x20E5, 0x18E5, 
-0x1083, 0x18C5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20C2, 0xB44F, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x1062, 0x18A4, 0x72EA, 0xEDB4, 0xEDB4, 0x3985, 0x20E5, 0x2106, 
-0x1083, 0x1083, 0x18C5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20C2, 0xB44F, 0x3123, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3945, 0x1062, 0x72EA, 0xEDB4, 0xEDB4, 0x832B, 
-0x2105, 0x2106, 0x51A7, 0x4987, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18A4, 0x6A89, 0xB44F, 0x3123, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x4144, 0x3985, 0xBCB0, 
-0xEDB4, 0x938C, 0x1061, 0x6208, 0xAB6C, 0x51A6, 0x2905, 0x51E8, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x0020, 0x72EA, 
-0x72A9, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 
-0x3924, 0x6A68, 0x5A27, 0x7A89, 0x7248, 0xAB6C, 0x4965, 0x7A88, 0x6207, 0x6207, 0x82AA, 0x51E8, 0x2106, 0x2106, 0x2106, 0x1083, 
-0x0020, 0x7A88, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x5207, 0xB3EE, 0x9B0A, 0x8ACA, 0xAB6C, 0xBBAD, 0x4965, 0xA34B, 0xC40D, 0x930A, 0x4965, 0xBBAD, 0xA34C, 0x930B, 0x930B, 
-0x930B, 0x1882, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7A88, 0x5A27, 0xE593, 0xCC4F, 0xBBAD, 0xBBAD, 0x3103, 0x930A, 0xC40D, 0xC40D, 0x930A, 0x4965, 0xBBAD, 0xCC90, 
-0xE573, 0xE573, 0xE573, 0x20C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5A07, 0xDD53, 0xEDB4, 0xE593, 0xCC4F, 0xBBAD, 0x1882, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 
-0x7B0A, 0xE593, 0xEDB4, 0xEDB4, 0xEDB4, 0x20C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5A27, 0xEDB4, 0xEDB4, 0xEDB4, 0xCC6F, 0x3103, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7A88, 0x72EA, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0x20C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x7289, 0xBCB0, 0xEDB4, 0xE573, 0xC42F, 0x3103, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x72A9, 0xCCF1, 0xEDB4, 0xEDB4, 0xEDB4, 0x49C6, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x5A27, 0xE573, 0xC42F, 0xBC0E, 0x5A48, 
-0x934B, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x72EA, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDF5, 0x0020, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x6A88, 0xB44F, 0xCD12, 
-0xD5D5, 0xDE77, 0x20E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x7289, 0xC470, 0xE593, 0xEE36, 0xF73A, 0x5ACA, 0x8AC9, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 
-0x7BAD, 0xF75B, 0xE6D9, 0xDE77, 0x20E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x7248, 0xDD73, 0xEF1A, 0xF75B, 
-0xF75B, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7A88, 0x7BAD, 0xF75B, 0xE6D9, 0xDE77, 0x20E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x6206, 0xBD53, 
-0xEF3A, 0xF75B, 0xF75B, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x6A88, 0xAD13, 0xEF3A, 0xE698, 0x20E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x4985, 0xA4D2, 0xE6B8, 0xEF3A, 0xF75B, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x9CB1, 0xF75B, 0xE6B8, 0x20E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xA34B, 0x5207, 0xB553, 0xEF3A, 0xF75B, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x9CB1, 0xF75B, 0xE6B8, 0x20E3, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xA4D2, 0xEF3A, 0xF75B, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x9CB1, 0xE6B8, 0x20E3, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x8C0F, 0xEF3A, 0xF75B, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x7BCE, 0xD637, 
-0x20E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xC5B5, 0xF75B, 0x5A68, 0xA34B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 
-0x0841, 0x83CE, 0x39A6, 0x934B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xC5B5, 0xF75B, 0xD678, 
-0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0x7A88, 0x3124, 0x0841, 0x0861, 0x83CE, 0x1081, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xC5B5, 
-0xF75B, 0xD678, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x6207, 
-0x6207, 0x4164, 0x0840, 0x0841, 0x0861, 0x0861, 0x0861, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x3103, 0xC5B5, 0xF75B, 0xD678, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6207, 0x2903, 0x5AA9, 0xF75B, 0xD678, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8AC9, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7247, 0x20C2, 0x20E3, 0x20E3, 0x5A89, 0x4A07, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x930A, 0x930A, 0x930A, 0x930A, 0x4164, 0x0020, 0x0020, 0x0020, 0x7A88, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x3123, 0x3123, 0x20C2, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20C3, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0xAB8C, 0xAB8C, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0x930A, 0x18A2, 0x20C3, 0x20C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20C3, 0x3123, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_left_7.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_left_7_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 
-0xAB8C, 0x7AA8, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x930A, 0xC40D, 0xAB8C, 0xAB8C, 0xBBCC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x7AA9, 0x3964, 0x7309, 0xD5B0, 0xD5B0, 0xDDD0, 0xE5F1, 0xE631, 0xE651, 0xE651, 0x4A26, 0x930A, 0x3984, 0x3984, 0x51E6, 
-0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7AC9, 0x5AA7, 0x7B49, 0xD5B0, 0xBCCF, 0xC52F, 0xC52F, 0xCD50, 0xCD70, 0xEE71, 0xF712, 0xFF13, 0xF6D2, 0x41C5, 0xE5F1, 
-0xE5F1, 0xC54F, 0x5206, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7A88, 0x6AC7, 0xFF13, 0xF6D2, 0xDDD0, 0xC50F, 0xBCEF, 0xDDF1, 0xDDF1, 0xBCEF, 0xC52F, 0xEE71, 0xEEB2, 0xBD91, 
-0xC52F, 0xE5F1, 0xE5F1, 0xE5F1, 0xAC8D, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7247, 0x7308, 0xE611, 0xEE92, 0xEE71, 0xD590, 0xA40E, 0x8B6C, 0xACAD, 0xFF13, 0xE651, 0xBCEF, 0xC52F, 
-0xA531, 0x6C51, 0xCD50, 0xCD50, 0xCD70, 0xE5F1, 0xAC8D, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xC52F, 0xE5F1, 0xE5F1, 0xCD4F, 0xA40E, 0xCCD1, 0x938C, 0x6AC8, 0xDE11, 0xEE71, 
-0xDDD0, 0x9490, 0x6C51, 0x3A6C, 0x832C, 0xB4AE, 0xB4AE, 0xCD70, 0xD590, 0x6AC8, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xB4AE, 0xC50F, 0xDDF1, 0xA44E, 0x832D, 0xEDB4, 0xCCF1, 0x72C9, 
-0x9C0B, 0xE5F1, 0xE5F1, 0x84B1, 0x324C, 0x1928, 0x624A, 0x7B0C, 0xB4AE, 0xBCEF, 0xE5F1, 0x8BCA, 0x4985, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x18A2, 0xB4AE, 0xAC8E, 0x936D, 0xCCB1, 0xC3EE, 
-0xC3EE, 0x6207, 0x7309, 0xD590, 0xE5F1, 0x834C, 0x5B8F, 0x2189, 0x63F0, 0x624A, 0x7AEB, 0xB4AE, 0xC52F, 0x8BCA, 0x4985, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0xB4AE, 0xAC4E, 0x7AAB, 
-0x930A, 0x1882, 0x1882, 0x1041, 0x72E9, 0xCD70, 0xE5F1, 0x832C, 0x9C4E, 0x63F0, 0x2189, 0x3925, 0x6A8B, 0xB4AE, 0xBCEF, 0x8BCA, 
-0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3123, 
-0x93CC, 0x82CB, 0xAB4C, 0x69A9, 0x6A8C, 0x39E9, 0x72E9, 0xB4AE, 0xB4AE, 0x7AEB, 0xAC4E, 0xB4AE, 0x6C51, 0x3104, 0x6A8B, 0xB4AE, 
-0xB4AE, 0x8BAA, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7A88, 0x51E6, 0xCC90, 0xD4D2, 0x8A6C, 0xACB3, 0x734C, 0x72E9, 0xB4AE, 0xA42E, 0x832C, 0xAC8E, 0xB4AE, 0x93AC, 0x4166, 
-0x6A8B, 0xBCEF, 0xAC8D, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x20C2, 0xEDB4, 0xEDB4, 0xD4F2, 0xAC51, 0xD574, 0x6227, 0x72E9, 0xAC4E, 0x82EC, 0xA42D, 0xB4AE, 0xA42E, 
-0x28C3, 0x624A, 0x832C, 0xC52F, 0xAC8D, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20C2, 0xEDB4, 0xEDB4, 0xEDB4, 0xDD32, 0xD4F1, 0xA3EE, 0x7B0A, 0x8B2C, 0xAB6C, 0xB46E, 
-0x9BED, 0x6A6B, 0x28C3, 0x6A8B, 0xBCCF, 0xC54F, 0x8B8A, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20C2, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xB3EF, 0xAB6C, 
-0xBBAD, 0x938C, 0x6A6B, 0x624A, 0x6AA9, 0x51E8, 0xB4AE, 0xB4AE, 0x72C8, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA9, 0x6A89, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 
-0xCC6F, 0xBBAD, 0xD4B0, 0x82EC, 0x624A, 0x624A, 0xB4AE, 0x3924, 0x834C, 0xB4AE, 0xBD0F, 0x6AC8, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x20C2, 0xEDB4, 0xEDB4, 0xEDB4, 
-0xEDB4, 0xD4F1, 0xBBCD, 0xBBAD, 0xDD32, 0x832D, 0x624A, 0x624A, 0xB4AE, 0x8B8B, 0x4166, 0x834C, 0xB4AE, 0x8BAC, 0x49A7, 0x7A88, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x932A, 0x3985, 
-0x3985, 0x3985, 0x3985, 0x7A89, 0xBBAD, 0xCC90, 0xE593, 0x51E7, 0x5A09, 0x624A, 0x7AEB, 0xAC6E, 0x8B8B, 0x49A7, 0x834C, 0xAC4E, 
-0x7B2B, 0x4165, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 0x6206, 0x942F, 0xDE37, 0xDE57, 0x39A6, 0x5A09, 0x624A, 0x624A, 0xB4AE, 0xB4AE, 0x7B2A, 
-0x4166, 0x6A8B, 0x6A6B, 0x3125, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x59E6, 0x51A6, 0x7A89, 0x7207, 0x7207, 0x1041, 0x5A09, 0x624A, 0x6A8B, 
-0xB4AE, 0x838B, 0x1041, 0x18A2, 0x2904, 0x2904, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x59E6, 0x51C6, 0xC553, 0xDE77, 0xA3EE, 0x7A48, 0x1041, 0x5A09, 
-0x624A, 0x6A8B, 0x9C0D, 0x93CC, 0x49A5, 0xA34B, 0x8AC9, 0x3103, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x930A, 0x59E6, 0x4124, 0xA42F, 0xDE77, 0xDE77, 0xDE77, 0xA3EE, 
-0x18A2, 0x5A09, 0x624A, 0x624A, 0x6A8B, 0xA42E, 0x93CC, 0x6227, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x7A88, 0x7247, 0x28C3, 0x4944, 0x7207, 0xA42F, 0xDE77, 0xDE77, 
-0xDE77, 0xDE77, 0x20E3, 0x5A09, 0x624A, 0x624A, 0x624A, 0x6A8B, 0x9C0D, 0x838B, 0x6227, 0x7A88, 0x7A88, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x3903, 0x4944, 0x7207, 0x61C6, 0x7269, 0xC553, 
-0xDE77, 0xDE77, 0xDE77, 0xDE77, 0x20E3, 0x5A09, 0x624A, 0x8B6C, 0x834C, 0x624A, 0x6A8B, 0x9BED, 0x93CC, 0x5A67, 0x3144, 0x7A88, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x7207, 0x7207, 0x7207, 0x5986, 
-0x7AEB, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 0xB4F2, 0x18A2, 0x5A09, 0x624A, 0x834C, 0xAC6E, 0x834C, 0x624A, 0x832C, 0xB4AE, 0x7B2A, 
-0x6227, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x7207, 0x7207, 
-0x7207, 0x5986, 0x7AEB, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 0x9C2F, 0x1082, 0x5A09, 0x624A, 0x6A6B, 0x834C, 0xAC6E, 0x93CD, 0x9C0D, 
-0x838B, 0x6227, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 
-0x7207, 0x61C6, 0x4905, 0x40E5, 0x7AEB, 0xDE77, 0xDE77, 0xDE77, 0xACD1, 0x82CA, 0x1041, 0x18A3, 0x624A, 0x624A, 0x6A6B, 0x834C, 
-0x93CC, 0x3144, 0x49A5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x1861, 0x40E5, 0x38A4, 0x38A4, 0x7AEB, 0xDE77, 0xDE77, 0xDE77, 0x9C2F, 0x2904, 0x628A, 0xBD53, 0x1061, 0x1061, 
-0x1061, 0x1061, 0x49A5, 0xAB8C, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0820, 0x40E4, 0x4925, 0x7A48, 0xA3EE, 0xDE77, 0xDE77, 0xDE57, 0x8BCE, 0x3165, 0x7B0B, 0xD616, 
-0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x1061, 0x7207, 0x7207, 0x9BAD, 0xDE77, 0xDE77, 0xDE77, 0xA491, 0x20E3, 0x628A, 
-0x8B6D, 0xD616, 0x20E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x1061, 0x7207, 0x7207, 0x9BAD, 0xDE77, 0xDE77, 0xDE77, 0xA491, 
-0x3944, 0x5208, 0x832C, 0xC594, 0xDE77, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x1061, 0x7207, 0x7207, 0x9BAD, 0xDE77, 0xDE77, 
-0xDE77, 0xA491, 0x7268, 0x4124, 0x5208, 0x832C, 0xDE77, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x1061, 0x7207, 0x7207, 0x9BAD, 
-0xDE77, 0xDE77, 0xDE77, 0xA491, 0x7268, 0x7207, 0x4124, 0xA470, 0xDE77, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x1061, 0x7207, 
-0x7207, 0x9BAD, 0xDE77, 0xDE77, 0xBD53, 0x8B4C, 0x7228, 0x7207, 0x7207, 0x5248, 0xDE77, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0x1061, 0x7207, 0x7248, 0xA42F, 0xDE77, 0xDE77, 0xA491, 0x7A89, 0x7207, 0x7207, 0x7207, 0x20E4, 0x5289, 0x8BEE, 0x59C6, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x0841, 0x4166, 0x7268, 0x93CE, 0xB4F2, 0xDE77, 0xA491, 0x7A89, 0x7207, 0x7207, 0x4166, 0x2106, 0x18C4, 0x2944, 
-0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0841, 0x2106, 0x5A8A, 0xD616, 0xBD53, 0x93CE, 0x8BAD, 0x7A89, 0x3966, 0x2926, 0x2106, 0x2106, 
-0x2106, 0x18C4, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0841, 0x2106, 0x3146, 0x9C2F, 0xDE77, 0xDE77, 0xB4F2, 0x49E9, 0x2106, 0x18A4, 0x20E5, 
-0x2106, 0x2106, 0x2106, 0x20E5, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0841, 0x20E5, 0x2905, 0x93EE, 0xDE57, 0xD616, 0x9C70, 0x41C8, 0x18C4, 
-0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E5, 0x20C2, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x930A, 0x930A, 0x0862, 0x10A4, 0x18C5, 0x3985, 0xEDB4, 0x938C, 0x1083, 
-0x2106, 0x18A4, 0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E5, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x0862, 0x1062, 0x18C5, 0x1083, 0x3145, 0x72EA, 0xEDB4, 
-0x938C, 0x1082, 0x18A4, 0x18A4, 0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E5, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x20E5, 0x18C5, 0x1083, 0x18A4, 0x3985, 
-0xEDB4, 0xEDB4, 0x938C, 0x0842, 0x1083, 0x18E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E5, 0x3123, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x18A4, 0x1083, 0x18C5, 
-0x20E5, 0x3985, 0xEDB4, 0xEDB4, 0xBCB0, 0x41A6, 0x10A3, 0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E5, 0x3123, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x1082, 
-0x18E5, 0x2106, 0x2106, 0x20E4, 0x832B, 0xEDB4, 0xB44F, 0x3966, 0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x20E5, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x18A2, 0x930B, 0x930B, 0x930B, 0x92EB, 0x7A68, 0x3985, 0x20C2, 0x4985, 0x51C8, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x1082, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3103, 0x8ACA, 0xBBAD, 0xBBAD, 0xBBAD, 0xBBAD, 0xBBAD, 0x6A07, 0x0020, 0x59E6, 0xB38C, 0xA34C, 0x4187, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x20C2, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xCCF1, 0xEDB4, 0xBBAD, 0xBBAD, 0xBBAD, 0x8ACA, 0x4985, 0x7A88, 0x59E6, 0xBBAD, 0xBBAD, 
-0xBBAD, 0xBBAD, 0xBBAD, 0x1882, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3944, 0xCCF1, 0xEDB4, 0xE573, 0xBBAD, 0x8ACA, 0x4144, 0xC40D, 0xC40D, 0x6207, 
-0x938C, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0x20C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xCCF1, 0xEDB4, 0xEDB4, 0xE573, 0xA32B, 0x3123, 0xC40D, 0xC40D, 
-0xC40D, 0x6207, 0x938C, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0x20C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xCCF1, 0xEDB4, 0xEDB4, 0xCC90, 0x7248, 0x6207, 
-0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x72A9, 0xCCF1, 0xEDB4, 0xEDB4, 0xEDB4, 0x6A89, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xCD94, 0xEDD4, 0xD4F1, 0xA32B, 
-0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x938C, 0xEDB4, 0xEDB4, 0xEDB4, 0xEE36, 0x5ACA, 0x8AC9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xD678, 0xE636, 
-0xCD12, 0xA32B, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x7289, 0xCCF1, 0xEDB4, 0xEDB4, 0xF73A, 0xF75B, 0x18A2, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x942F, 
-0xE6F9, 0xDE98, 0xDE77, 0x4965, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5207, 0xB3EE, 0xEE77, 0xF73A, 
-0xF75B, 0x9470, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x3103, 0xB594, 0xF75B, 0xDE98, 0xDE77, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x4985, 
-0xC5F5, 0xEF3A, 0xF75B, 0xD678, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3103, 0xB594, 0xF75B, 0xDE98, 0xDE77, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBCC, 0x3965, 0xC5D5, 0xF75B, 0xF75B, 0xB594, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xB594, 0xF75B, 0xDE98, 0x20E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3965, 0xDE98, 0xF75B, 0xD678, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xB594, 0xEF3A, 0xDE98, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xC5D5, 0xEF3A, 0xC616, 0x3144, 0xBBCC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x930A, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xB594, 0xDE98, 0xB553, 0x3103, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49E6, 0xACF2, 0xEF3A, 0xC616, 0x6AA9, 
-0xA34B, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x3124, 0x7A88, 0xA34B, 0xC40D, 0xC40D, 0x3103, 0xB553, 0xDE78, 0x20E3, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x49C6, 0xACF2, 
-0xD657, 0x6B2B, 0x3944, 0xA34B, 0xC40D, 0xC40D, 0x0820, 0x0841, 0x0820, 0x4164, 0x7A88, 0x7A88, 0x28E3, 0xACF2, 0xDE77, 0x20E3, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x2103, 0x83AD, 0x20E3, 0x18A2, 0x6207, 0xC40D, 0xC40D, 0x4164, 0x0841, 0x0861, 0x0841, 0x0840, 0x0840, 0x0841, 0x5AA9, 
-0xD616, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x0841, 0x20E3, 0x20E3, 0x20C2, 0x3944, 0x930A, 0xC40D, 0xAB8C, 0x49A5, 0x0841, 0x0861, 0x0861, 0x0861, 
-0x0861, 0x0861, 0x4A27, 0x7AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x4164, 0x18A2, 0x20E3, 0x20E3, 0x20E3, 0x1081, 0x6207, 0xC40D, 0xC40D, 0xAB8C, 0x49A5, 0x0020, 
-0x0841, 0x0861, 0x0861, 0x0861, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0820, 0x20E3, 0x20E3, 0x18C2, 0x0841, 0x51A5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x930A, 0x4164, 0x0841, 0x0861, 0x0861, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3123, 0x28E3, 0x20C2, 0x20E3, 0x20C2, 0x3924, 0x930A, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x4164, 0x0020, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x20C3, 0x20C3, 0x20E3, 0x18C2, 0x3924, 0xBBCC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_left_8.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_left_8_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x7AA8, 
-0x49C5, 0x49A5, 0x49A5, 0x4185, 0x4184, 0x3964, 0x51C6, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x82A9, 
-0x4184, 0x5A67, 0xB4AD, 0xB4CE, 0xBCEE, 0xC54E, 0xC54E, 0xD5B0, 0xA46C, 0x5A26, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 
-0x49C5, 0x6AE8, 0xAC6D, 0xC52F, 0xDDF1, 0xDDD1, 0xDDB1, 0xEE32, 0xFF33, 0xFFF5, 0xFFD4, 0xA48C, 0x51C6, 0x9B4B, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x5206, 0xCDEF, 0xFF73, 0xF692, 0xC50F, 0xBCCF, 0xE611, 0xD5D0, 0xB4AE, 0xCD70, 0xFF12, 0xF713, 0xD5F2, 0x8BAB, 0x4A05, 
-0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA36B, 0x5A06, 0xC50E, 0xFF74, 0xFF74, 0xDDF0, 0xA40E, 0x7ACB, 0xBD4E, 0xFFB4, 0xD5F0, 0xBCAE, 0xCD4F, 0x9D11, 0x94F2, 
-0xDDD1, 0xE611, 0x8BAA, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x834A, 0xFEB3, 0xF672, 0xD5B0, 0xA42E, 0xC4D2, 0x6AAA, 0x62C7, 0xF713, 0xFED2, 0xCD70, 0x8C70, 
-0x4370, 0x636E, 0xBCCF, 0xDDD1, 0xEE52, 0x838A, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x6AC9, 0xDDB1, 0xE611, 0xAC6E, 0x8B4E, 0xF5F5, 0xD512, 0x5A48, 0x9C2C, 0xFE92, 
-0xD611, 0x6C31, 0x118B, 0x3989, 0x9C0D, 0xBCCF, 0xDDD1, 0xD5B0, 0x41A5, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x41A5, 0xA42D, 0xC510, 0x93AD, 0xABEF, 0xCC6F, 0xD48F, 0x51C6, 
-0x6287, 0xF692, 0xDDD1, 0x738E, 0x21CB, 0x21CB, 0x62ED, 0x9BED, 0xBCEF, 0xDDD1, 0x8BCA, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x72E9, 0xB4AF, 0x934D, 0x92EB, 0x4965, 
-0x28A2, 0x1021, 0x62A8, 0xEE52, 0xCD4F, 0x8B4C, 0x7BEF, 0x4B4E, 0x2968, 0x59E8, 0xA40D, 0xE5F1, 0xC54F, 0x4184, 0xB3CC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x6227, 0x6AC9, 0x934C, 
-0x92CB, 0x48E5, 0x3148, 0x2166, 0x6AA8, 0xD590, 0xAC6E, 0x830B, 0xAC6E, 0xB4F0, 0x5207, 0x3905, 0x93AD, 0xD591, 0xB4CE, 0x49A5, 
-0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 
-0x49A5, 0xBC4F, 0xD450, 0x928D, 0xAC74, 0x630C, 0x6287, 0xC510, 0x93CD, 0x832C, 0xB48E, 0xC50F, 0x6A88, 0x4147, 0x8B8D, 0xD5B1, 
-0xC50E, 0x41A4, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6207, 0x938C, 0xFE56, 0xD4F2, 0xB431, 0xD554, 0x5A27, 0x5A67, 0xAC6F, 0x8B2C, 0xAC4E, 0xC510, 0x7AEA, 0x4146, 0x6A6A, 
-0xA42E, 0xD590, 0x93EB, 0x59E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x4165, 0xC4B0, 0xFE97, 0xE594, 0xDD53, 0xE552, 0x936C, 0x6AA9, 0x8B2C, 0xAB8C, 0xC4CF, 0x8BAC, 0x4146, 
-0x4147, 0x8B6D, 0xCD50, 0xCD70, 0x49E5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4185, 0xBC90, 0xFE56, 0xEDD4, 0xEDB4, 0xEDB4, 0xEDD4, 0xABEF, 0xA2EB, 0xBBCD, 0x9B8D, 
-0x49A8, 0x3105, 0x72AB, 0xAC6E, 0xD590, 0x8BAA, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x72A9, 0xEDB4, 0xFE36, 0xF5F5, 0xFE15, 0xFE16, 0xD470, 0xC3AD, 
-0xBC0F, 0x7ACC, 0x3946, 0x3105, 0x8B6C, 0xD571, 0xCD6F, 0x49C5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4165, 0xC4B1, 0xFE77, 0xF5D5, 0xF5F5, 0xE553, 
-0xC3CD, 0xC3ED, 0xCCD1, 0x7AED, 0x6249, 0x5A28, 0x5A28, 0xAC4E, 0xD590, 0x838A, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x5207, 0x6288, 0x5A48, 
-0x5A28, 0x8ACA, 0xBBAD, 0xED73, 0xCD32, 0x49C7, 0x72CB, 0xAC8E, 0x5A28, 0x51C8, 0xAC4E, 0xDDD1, 0x8BAA, 0x6A47, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 
-0x82A9, 0x8AC9, 0x9B2A, 0x51A5, 0x9BEE, 0xFEF9, 0xAC90, 0x2924, 0x4987, 0xA40E, 0xAC6D, 0x5A07, 0x51E8, 0xAC6F, 0xE5F1, 0x7B49, 
-0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x83EE, 0xBD12, 0x8B2B, 0x4124, 0x28A4, 0x5A2A, 0xA40E, 0xA42D, 0x5207, 0x6269, 
-0xAC6F, 0x7B0B, 0x3944, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7288, 0x732B, 0xAC70, 0xBD12, 0xCD73, 0x6A68, 0x20A2, 0x51C9, 0x624B, 0xA42E, 
-0xA42C, 0x49A6, 0x622A, 0x51E9, 0x3924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x6A27, 0x6269, 0xA42F, 0xAC50, 0xDE77, 0xFF9C, 0x9CB0, 0x2904, 0x51A8, 
-0x6A6B, 0xA42E, 0xBD0F, 0x49E6, 0x4167, 0x49A7, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x6A27, 0x3103, 0x4124, 0x8268, 0x8AEB, 0x8B8D, 0xC5B5, 0xFF7B, 0xAD32, 
-0x3145, 0x4988, 0x938D, 0xBCEF, 0x8B8B, 0x4185, 0x28E4, 0x59C6, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x3103, 0x3924, 0x69E7, 0x7207, 0x5945, 0x6A49, 0xA450, 0xCDF6, 
-0xFF5B, 0xA4F1, 0x3125, 0x4988, 0x9BEE, 0xC50F, 0x49C5, 0x82A9, 0x930A, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x4164, 0x5185, 0x8248, 0x8248, 0x61A6, 0x3063, 0x4126, 
-0xB4F2, 0xEEF9, 0xF73A, 0xA4F1, 0x3125, 0x4988, 0x830C, 0xB48E, 0x7309, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3944, 0x59A6, 0x8268, 0x7A27, 0x59A6, 
-0x3043, 0x2843, 0x9C30, 0xF71A, 0xF71A, 0xA4F1, 0x3145, 0x51A8, 0x620A, 0x7ACB, 0xB48F, 0x7B29, 0x6227, 0xBBCD, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x4985, 0x59A5, 0x7207, 
-0x5146, 0x40E5, 0x3063, 0x40E4, 0xAC91, 0xEEF9, 0xF73A, 0x9CB1, 0x20C4, 0x6A6A, 0x830C, 0x5A0A, 0xAC4F, 0xD591, 0x6AE9, 0x6206, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x932A, 
-0x3924, 0x40E4, 0x3884, 0x3084, 0x40E4, 0x69C6, 0xBCD1, 0xE6F9, 0xF71A, 0xAD12, 0x2925, 0x7AEA, 0xC510, 0xAC4E, 0xB48E, 0xAC6D, 
-0x5A47, 0x7AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3924, 0x2883, 0x4925, 0x61A6, 0x69C6, 0x71E7, 0xB4D1, 0xEEF9, 0xE6B8, 0xE698, 0x736D, 0x49E6, 0xA44D, 0xAC8E, 
-0x6287, 0x3944, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x5165, 0x7207, 0x7227, 0x71E6, 0x69E6, 0xBD12, 0xEF3A, 0xDE77, 0xFF5B, 0xA4D2, 0x18A2, 
-0x3123, 0x4185, 0x7268, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x61C6, 0x8248, 0x7207, 0x69E7, 0x69C6, 0x9BCE, 0xD657, 0xE6B8, 0xF73A, 
-0xA4B1, 0x4185, 0xAB8C, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x59A6, 0x7A28, 0x7207, 0x7207, 0x69C6, 0x61C7, 0xB4F2, 
-0xEEF9, 0xF73A, 0x9CB1, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x59A6, 0x7A28, 0x7207, 0x7207, 0x69C6, 
-0x69C6, 0xB4F2, 0xEEF9, 0xF73A, 0x9CB1, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x59A6, 0x7A28, 0x7207, 
-0x7207, 0x69C6, 0x7227, 0xBD33, 0xEEF9, 0xF73A, 0x9CB1, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3944, 0x59A6, 
-0x7A28, 0x7207, 0x7207, 0x69C6, 0x7207, 0xBD13, 0xEEF9, 0xF73A, 0xA4B1, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 
-0x3944, 0x61C6, 0x8248, 0x7207, 0x7207, 0x69C6, 0x7227, 0xC553, 0xEF3A, 0xFF5B, 0x9CB1, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBCD, 0x3944, 0x59A6, 0x7A28, 0x7207, 0x7A27, 0x71E6, 0x7207, 0xB4F2, 0xE6B8, 0xD616, 0x838E, 0x18C3, 0x7A88, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x3944, 0x2905, 0x4987, 0x61E7, 0x6A07, 0x61C6, 0x4987, 0x732D, 0xB4D2, 0xAC90, 0x6AAB, 0x2106, 
-0x1082, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x28E3, 0x0884, 0x2106, 0x3146, 0x3146, 0x2906, 0x18C5, 0x6ACB, 0xCDB4, 0xCDD5, 
-0x7B2C, 0x2106, 0x1084, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x18A4, 0x18C4, 0x18E5, 0x1906, 0x1906, 0x10A5, 0x0022, 0x93AC, 
-0xFF5A, 0xDE16, 0x628A, 0x18C5, 0x20E6, 0x18A3, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0x10A4, 0x18E5, 0x20E5, 0x2126, 0x2127, 0x0863, 
-0x2904, 0xC4B0, 0xFEF8, 0xC4D1, 0x2104, 0x1084, 0x2927, 0x18C4, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB6B, 0x7A88, 0x3104, 0x1083, 0x10A4, 0x2106, 0x2106, 
-0x10A4, 0x3965, 0xB46F, 0xFE36, 0xEDB4, 0x830A, 0x1083, 0x18C5, 0x2927, 0x2106, 0x18A3, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 0x0862, 0x18E5, 0x18C4, 0x18C4, 
-0x2106, 0x2106, 0x0022, 0x832A, 0xFE77, 0xFE77, 0xCCF1, 0x2904, 0x0864, 0x2127, 0x2126, 0x2127, 0x18A4, 0x59C6, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x18C4, 0x18E5, 
-0x10A4, 0x20E5, 0x2126, 0x2106, 0x1084, 0x41A6, 0xD512, 0xFEF8, 0xCCF1, 0x20E3, 0x0864, 0x2127, 0x2106, 0x2927, 0x2126, 0x18A2, 
-0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 
-0x18A4, 0x18C4, 0x0863, 0x10C5, 0x18E6, 0x1906, 0x18E6, 0x0001, 0x832B, 0xEDF5, 0x6AA9, 0x10A3, 0x18E6, 0x2106, 0x2126, 0x2927, 
-0x2106, 0x18A3, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x3965, 0x59C7, 0x49A7, 0x2106, 0x2926, 0x2926, 0x2106, 0x1083, 0x3924, 0x51E6, 0x18C4, 0x10A5, 0x2927, 0x2927, 
-0x2126, 0x18A4, 0x18A2, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x7A47, 0xB3AD, 0x92EB, 0x9B2C, 0x59C7, 0x4166, 0x930B, 0x82A9, 0x8288, 0x7A8A, 0x3967, 
-0x18C5, 0x2106, 0x18C4, 0x59E6, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51C6, 0x930A, 0xD42E, 0xCBED, 0xE46F, 0x7A68, 0x59C6, 0xED11, 0xFDF5, 0xF594, 
-0xE4D1, 0x82CA, 0x1882, 0x1082, 0x59E6, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x7B0A, 0xEDB4, 0xD470, 0xBBAD, 0xBBAD, 0x59E6, 0x4964, 0xC46F, 
-0xFE56, 0xEDF5, 0xFE15, 0xBC6F, 0x4164, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x938C, 0xFEB8, 0xE573, 0xD46F, 0x9AEA, 0x49A5, 
-0x6227, 0x832B, 0xFE36, 0xEDD4, 0xFE77, 0xB490, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x834B, 0xFE77, 0xF5D5, 0xC40E, 
-0x59C6, 0x8AC9, 0x7A88, 0x832B, 0xFE77, 0xEDD4, 0xFE15, 0xD532, 0x51E6, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x8B6C, 0xFE56, 
-0xED32, 0x9B0A, 0x4144, 0xC3ED, 0xAB6B, 0x5A07, 0xDD52, 0xFE56, 0xEDB4, 0xFE36, 0xD5D5, 0x5A68, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 
-0x938C, 0xFE15, 0xDCB1, 0x9BAD, 0x41A5, 0xBBED, 0xC40D, 0x9B2A, 0x5A07, 0xDD53, 0xFE15, 0xF636, 0xFFFF, 0x9CF2, 0x59E6, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA36B, 0x5A07, 0xC533, 0xFED9, 0xB533, 0x49C6, 0xBBCC, 0xC40D, 0xC40D, 0x9B2A, 0x51E6, 0xCC90, 0xF6B8, 0xFFFD, 0xDEF9, 
-0x5248, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x94D1, 0xFFFE, 0xBD74, 0x41A5, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0x932A, 0x49A6, 0xCDF5, 
-0xFFDC, 0xFFFE, 0x9490, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x9CD1, 0xFFFE, 0xBD53, 0x41A5, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x5A68, 0xD636, 0xFFFD, 0xE6FA, 0x62EA, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0xA4D2, 0xFFFD, 0xBD53, 0x41A5, 0xBBCC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5A68, 0xDE98, 0xFFFF, 0xEF3B, 0x732B, 0x8AC9, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x9CD1, 0xFFFE, 0xC5B5, 0x4185, 0xB3CC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x5A89, 0xE6D9, 0xFFFF, 0xCE57, 0x2944, 0x30E3, 0x9B4B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0xA512, 0xFFBC, 0x942F, 
-0x5A06, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x62CA, 0xC5D5, 0x7B8C, 0x20E3, 0x18A2, 0x3103, 
-0x9B2B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0xAD53, 
-0xE6D9, 0x49C6, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x2903, 0x18A2, 0x20E3, 
-0x3124, 0x20C2, 0x3944, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6207, 0xB553, 0xE6B9, 0x4185, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 
-0x1081, 0x2924, 0x2903, 0x18A2, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA34B, 0x62A9, 0xEF5B, 0xE6D9, 0x49C6, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6206, 0x18A2, 0x2903, 0x18A2, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x4A48, 0xE71A, 0xDE78, 0x41A6, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x20C2, 0x2903, 0x20C2, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0xC3ED, 0x930A, 0x20A2, 0x0020, 0x41E7, 0x5A89, 0x3124, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x28E3, 0x20E3, 0x18A2, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x4164, 0x3103, 0x18A2, 0x0861, 0x0841, 0x0000, 0x0000, 0x20C2, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x18A2, 0x20E3, 0x28E3, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4185, 0x0841, 0x0841, 0x0841, 0x1061, 0x0861, 0x0841, 0x0841, 0x20C2, 0xABAC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x0841, 0x1061, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_left_9.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_left_9_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x8AE9, 
-0x49A5, 0x4985, 0x49A5, 0x4985, 0x4985, 0x3964, 0x59E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x930A, 
-0x4985, 0x5226, 0xA46D, 0xACAD, 0xB4AD, 0xBCEE, 0xBD0E, 0xC54F, 0x940B, 0x6226, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 
-0x49C5, 0x62A7, 0x9C2C, 0xC50F, 0xE5F1, 0xDDD1, 0xDDB1, 0xEE52, 0xFF33, 0xFFF5, 0xFFD4, 0xA46C, 0x59C6, 0xA36B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB3AC, 0x51E6, 0xC58E, 0xFF53, 0xF692, 0xCD30, 0xBCCF, 0xE611, 0xD5B0, 0xB4AE, 0xCD90, 0xFF12, 0xFF33, 0xDE12, 0x8B8A, 0x49E5, 
-0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x5A06, 0xBCCD, 0xFF74, 0xFF74, 0xE611, 0xA42E, 0x7AEB, 0xBD2E, 0xFFB4, 0xD5F1, 0xB4AE, 0xCD4F, 0x9D31, 0x9512, 
-0xDDB1, 0xE611, 0x8BAA, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6207, 0x7B29, 0xFEB3, 0xF672, 0xDDD0, 0xA42E, 0xC4B2, 0x72AA, 0x62C7, 0xF6F3, 0xFEF2, 0xCD70, 0x8C70, 
-0x4370, 0x636E, 0xBCCF, 0xDDD1, 0xEE52, 0x8BAA, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x62A8, 0xD5B1, 0xE631, 0xAC8E, 0x8B4D, 0xF5D5, 0xDD52, 0x5A48, 0x9C0C, 0xFE92, 
-0xDE11, 0x6C51, 0x118B, 0x3169, 0x9BCD, 0xB4AF, 0xEE32, 0xE611, 0x41A5, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x41A5, 0x9C0C, 0xC510, 0x93AD, 0xABEF, 0xC46F, 0xD48F, 0x59C6, 
-0x5A67, 0xF672, 0xDDF1, 0x7BAE, 0x21EB, 0x21CB, 0x62CC, 0x9BED, 0xD590, 0xCD6F, 0x49C5, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x6AC8, 0xB4AF, 0x934D, 0x92EB, 0x4965, 
-0x2882, 0x0821, 0x6288, 0xEE32, 0xD54F, 0x8B4C, 0x7BCE, 0x4B6F, 0x3A2C, 0x8B4C, 0xCD50, 0xC52F, 0x49E5, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x6247, 0x6288, 0x934C, 
-0x9AEB, 0x5106, 0x3968, 0x2187, 0x62A8, 0xD570, 0xAC8E, 0x830B, 0xAC6E, 0x8C4F, 0x4A4B, 0x8B4C, 0xCD50, 0xC52F, 0x49E5, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 
-0x49A5, 0xBC4F, 0xD471, 0x92AD, 0xB494, 0x6B0C, 0x5A67, 0xC50F, 0x93CD, 0x832C, 0xBCCF, 0x93CB, 0x49A8, 0x834C, 0xCD50, 0xC52F, 
-0x49E5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6206, 0x938C, 0xFE56, 0xDD12, 0xB431, 0xD574, 0x6227, 0x5246, 0xAC4E, 0x8B2C, 0xAC4E, 0xC530, 0x6A88, 0x30E5, 0x834C, 
-0xDDB1, 0xD5B0, 0x49C5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4185, 0xBC90, 0xFE97, 0xE5B4, 0xDD53, 0xE552, 0xA3CD, 0x6ACA, 0x8B0C, 0xAB8C, 0xC4CF, 0x8B8C, 0x4146, 
-0x4147, 0x938D, 0xE611, 0xA44C, 0x59E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xB44F, 0xFE56, 0xEDB4, 0xEDB4, 0xEDB4, 0xF5F5, 0xB42F, 0xA30B, 0xC3CD, 0x8B2B, 
-0x4187, 0x4147, 0x6A8B, 0xB48F, 0xD5B0, 0x5226, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x6248, 0xE594, 0xFE76, 0xFE15, 0xFE36, 0xFE16, 0xD470, 0xC3AC, 
-0xCC50, 0x624A, 0x28C4, 0x6AAA, 0xB48F, 0xD590, 0x838A, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xAC4F, 0xF616, 0xE593, 0xE594, 0xE532, 
-0xC3CD, 0xC3ED, 0xD512, 0x6A8A, 0x28C4, 0x7AEB, 0xC530, 0xDDD1, 0x5A46, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x932A, 0x51C6, 0x51E6, 0x49C6, 
-0x49C6, 0x7248, 0xBBAD, 0xF5B4, 0xD573, 0x49E7, 0x28E5, 0x51C8, 0x93AD, 0xCD50, 0xB4AD, 0x5A26, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0x9B2A, 0xA34B, 0xB3AC, 0x59E6, 0x8BEE, 0xFF1A, 0xAC70, 0x3104, 0x30E4, 0x3946, 0x5A09, 0x93AD, 0xD591, 0xBCEE, 0x5A06, 0xA34B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A27, 0x8C0F, 0xA3EE, 0x932B, 0x6248, 0x20A3, 0x4987, 0x4147, 0x51E9, 0x93AD, 0xD5B1, 
-0xB4AD, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6248, 0x83CE, 0x8B2B, 0x82AA, 0xDE16, 0xC5D5, 0x5248, 0x4167, 0x5A08, 0x49A7, 
-0x59E9, 0xC510, 0xDDD0, 0x41A4, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x4985, 0x6A89, 0xA3AD, 0x932B, 0xACB1, 0xCDD5, 0xF73A, 0x9CB0, 0x28E4, 
-0x832B, 0x72A9, 0x4167, 0x93AE, 0x834A, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x49A5, 0x30E3, 0x5185, 0x7A27, 0x7A07, 0x9BCE, 0x9C0F, 0x8B6D, 0xEEB8, 
-0xA4D1, 0x3965, 0x7AEA, 0x6248, 0x622A, 0x622A, 0x20C3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x30E3, 0x5185, 0x7227, 0x7207, 0x4925, 0x5965, 0x7ACA, 0x8B8D, 
-0xACD2, 0xF71A, 0x9470, 0x5247, 0x6267, 0x4987, 0x6A6B, 0x3946, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0x59A6, 0x8A68, 0x8268, 0x61A6, 0x3084, 0x3884, 
-0x6228, 0x93EE, 0xD636, 0xF73A, 0xCE16, 0x736C, 0x5A67, 0x5207, 0x20C3, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4144, 0x59A6, 0x8268, 0x7207, 0x5986, 
-0x3084, 0x3063, 0x5966, 0x8B4C, 0xC5B5, 0xE6B8, 0xFF5B, 0x8C0F, 0x5A47, 0x5246, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x61E6, 0x4965, 0x69C7, 
-0x4905, 0x30A4, 0x38A4, 0x5145, 0x69C6, 0x7207, 0x9C2F, 0xDE98, 0xFF7B, 0x7B8D, 0x5226, 0x5A67, 0x7AA9, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 
-0x3924, 0x3083, 0x3884, 0x38C4, 0x5166, 0x7207, 0x7207, 0x69C6, 0x72AA, 0xBD74, 0xFF7B, 0xACF2, 0x62A8, 0x49C5, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x4144, 0x30C4, 0x5966, 0x69E7, 0x7227, 0x7227, 0x7227, 0x5986, 0x4926, 0x8B6D, 0xC594, 0xDE57, 0x7B8D, 0x6227, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4144, 0x59A6, 0x7A48, 0x7227, 0x7227, 0x7207, 0x61C6, 0x38A4, 0x28A3, 0x72AA, 0x834C, 0xBD33, 
-0x7BAD, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4144, 0x59A6, 0x7A48, 0x7207, 0x7207, 0x7227, 0x5146, 0x1822, 0x1882, 0x6AAA, 
-0x9BEE, 0xD5D5, 0x7BAD, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4144, 0x59A6, 0x7A28, 0x7207, 0x7207, 0x7207, 0x5146, 0x2843, 
-0x1041, 0x628A, 0xCDB5, 0xF71A, 0xC5B4, 0x5227, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4144, 0x59A6, 0x7A28, 0x7207, 0x7207, 0x7207, 
-0x69C6, 0x61A6, 0x30A2, 0x49E7, 0xD637, 0xF73A, 0xF73A, 0x736C, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4144, 0x59A6, 0x7A28, 0x7207, 
-0x7207, 0x7207, 0x7207, 0x8268, 0x5944, 0x4185, 0xBD74, 0xF73A, 0xEEF9, 0x6B2B, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4144, 0x59A6, 
-0x7A28, 0x7207, 0x7207, 0x7207, 0x7207, 0x7207, 0x69C6, 0x6A07, 0xA470, 0xE6B9, 0xF71A, 0x6B0B, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x4144, 0x59A6, 0x7A28, 0x7207, 0x7207, 0x7207, 0x7207, 0x7A07, 0x7207, 0x61E7, 0x93EF, 0xE698, 0xFF7B, 0x736C, 0x7268, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x4144, 0x5985, 0x8248, 0x7207, 0x7207, 0x7A07, 0x7A27, 0x61E7, 0x4166, 0x3946, 0x940F, 0xF71A, 0xD636, 0x5A48, 
-0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x930A, 0x51E7, 0x6228, 0x71E7, 0x7A27, 0x7A27, 0x61E7, 0x49A7, 0x3126, 0x10A5, 0x2947, 0x8BAE, 0xCD94, 
-0x6AEA, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x9BEE, 0x6AAB, 0x28E5, 0x51A7, 0x4987, 0x3146, 0x1906, 0x18E6, 0x0863, 0x2926, 
-0x8BAE, 0xC574, 0x62AA, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x59E6, 0x9BCD, 0x5A49, 0x0064, 0x1906, 0x1906, 0x1906, 0x2106, 0x2106, 
-0x0863, 0x1883, 0x940F, 0xFF5B, 0x83EE, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x72C9, 0x7B0C, 0x20E5, 0x18C5, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x0863, 0x3145, 0xC4D1, 0xFED8, 0x836C, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0xAC2F, 0x72EC, 0x0002, 0x2106, 0x2126, 
-0x2106, 0x2106, 0x2106, 0x1084, 0x20E4, 0xAC4E, 0xFE36, 0xFE36, 0x832B, 0x1081, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x7B0B, 0x628B, 0x0863, 
-0x20E5, 0x2126, 0x2106, 0x2106, 0x2127, 0x0884, 0x20E4, 0xB46F, 0xFE36, 0xFE36, 0x832B, 0x0000, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x2105, 
-0x2926, 0x10A4, 0x20E5, 0x2126, 0x2106, 0x2106, 0x2106, 0x2106, 0x0863, 0x4186, 0xE573, 0xFF39, 0x938C, 0x0021, 0x18A3, 0xA34B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x51A5, 0x1084, 0x10A4, 0x0863, 0x18E5, 0x2126, 0x2106, 0x2106, 0x2106, 0x2927, 0x0043, 0x3145, 0xC4D0, 0xC4B0, 0x5207, 0x10A4, 
-0x10A4, 0x59E6, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8AC9, 0x18A3, 0x18A3, 0x4166, 0x3147, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x2127, 0x10A4, 0x3124, 0x5207, 0x18A3, 
-0x1084, 0x2947, 0x2126, 0x1082, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x3103, 0x82AA, 0x49C9, 0x08A5, 0x18C5, 0x18C5, 0x18E5, 0x2106, 0x2126, 0x18A4, 
-0x0021, 0x0842, 0x2106, 0x2947, 0x18C4, 0x4985, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x7248, 0x51A7, 0x6A49, 0x8ACB, 0x82CB, 0x7AAA, 0x28E4, 
-0x1062, 0x10A3, 0x3104, 0x49A5, 0x18A3, 0x1083, 0x51C6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51A5, 0x6A07, 0x59A5, 0xB3AD, 0xF593, 0xF5B4, 
-0xED53, 0x5A06, 0x59E6, 0x8AC9, 0xA36B, 0xBBCC, 0x82C9, 0x82A9, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4985, 0x9B0A, 0x7A48, 0x6A89, 
-0xE5B4, 0xFE56, 0xFE56, 0xBC90, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4164, 0xAB4C, 
-0x8289, 0x49E6, 0xE5B4, 0xF615, 0xFE15, 0xF5F5, 0x6289, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x4185, 0xABAD, 0xA34B, 0x49A5, 0xB470, 0xFE36, 0xE532, 0xFE56, 0xC5D5, 0x49C6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x41A5, 0xC490, 0xDC4F, 0x82A9, 0x6ACA, 0xC512, 0xE5D5, 0xF6F9, 0xF7BC, 0x6B2B, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x7B0B, 0xDD53, 0xEE36, 0x734C, 0x3165, 0xBD94, 0xFFBC, 0xFFFE, 0xCE16, 0x49A6, 0xBBCD, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x41C6, 0xCE77, 0xFFFE, 0x83CE, 0x3923, 0x5227, 0xD657, 0xFFFF, 0xCE36, 
-0x4185, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x49C6, 0xD657, 0xFFDD, 0x8BEE, 0x7268, 0x6A27, 0x8C2F, 
-0xFFFF, 0xCE37, 0x49C6, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x49E6, 0xD657, 0xFFDD, 0x83EE, 0x6A47, 
-0xB3AC, 0x5207, 0xDE98, 0xFFFE, 0x7BCE, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x49E6, 0xCE37, 0xFFFD, 
-0x944F, 0x6206, 0xC40D, 0x59E6, 0x8C0E, 0xFFFF, 0xE71A, 0x5227, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x49E6, 
-0xD677, 0xF75B, 0x732B, 0x7A68, 0xC40D, 0xAB6B, 0x4A07, 0xD657, 0xEF1A, 0x6B4C, 0x51C6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB3CC, 0x49C6, 0xE6D9, 0xBD74, 0x51C6, 0xBBED, 0xC40D, 0xC40D, 0x6227, 0x6B0B, 0x5AA9, 0x3985, 0x18A2, 0x51C5, 0xBBCD, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x49C6, 0xE6D9, 0xAD12, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x28E3, 0x1061, 0x20C2, 0x2923, 0x1882, 
-0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x83CE, 0xFFDE, 0xAD12, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x28C2, 0x20C2, 0x2924, 
-0x20E3, 0x28E3, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3123, 0x83EE, 0xFFDD, 0xAD12, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x28E3, 
-0x20E3, 0x20E3, 0x28E3, 0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xC3ED, 0x7268, 0x0020, 0x1082, 0x5ACA, 0x4A28, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 
-0x6207, 0x18A2, 0x2923, 0x18A2, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA9, 0x3123, 0x3103, 0x1061, 0x1061, 0x0841, 0x0000, 0x0000, 0x51A5, 0xC40D, 
-0xC40D, 0xA36B, 0x20C2, 0x20E3, 0x20C3, 0x4165, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x20A2, 0x0841, 0x0841, 0x0861, 0x1061, 0x0861, 0x0861, 0x0841, 
-0x51A5, 0xC40D, 0xC40D, 0x59E6, 0x18A2, 0x20E3, 0x28E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
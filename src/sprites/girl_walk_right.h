@@ -1,1441 +0,0 @@
-// Total bitmap data size: 44200 bytes
-
-// girl_walk_right_10.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_right_10_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x59C6, 0x3964, 0x4985, 0x4985, 0x49A5, 
-0x41A5, 0x49A5, 0x8AEA, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x5A26, 0x9C2B, 0xC56F, 0xBD0E, 
-0xBCEE, 0xB4AD, 0xB4AD, 0xA44C, 0x5226, 0x49A5, 0x930A, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51C6, 0xACAC, 0xFFD5, 
-0xFFF5, 0xFF33, 0xEE32, 0xDDB1, 0xDDD1, 0xDDD1, 0xBCEF, 0x9C2C, 0x5A87, 0x49C5, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x59E6, 0x8BAB, 
-0xDE32, 0xFF33, 0xFF12, 0xCD70, 0xB4AE, 0xD5D0, 0xE5F1, 0xBCCF, 0xCD50, 0xF692, 0xFF53, 0xBD6E, 0x51E6, 0xB3CC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x59E6, 
-0xA44C, 0xEE32, 0x94F2, 0x9D31, 0xCD4F, 0xB4AE, 0xD611, 0xFFB4, 0xB50E, 0x7AEB, 0xAC2E, 0xE611, 0xFF94, 0xFF54, 0xB4AD, 0x5A06, 
-0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x59E6, 0xA44C, 0xF672, 0xC52F, 0x5B4E, 0x4B90, 0x8C90, 0xCD90, 0xFEF2, 0xF6D2, 0x5AA7, 0x72CA, 0xC4B2, 0xA42E, 0xDDD0, 0xF672, 
-0xFE93, 0x7309, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x59E6, 0x9C2C, 0xF652, 0xD570, 0xB48E, 0x41E9, 0x098B, 0x7471, 0xDE31, 0xFE72, 0x93EB, 0x6248, 0xDD53, 0xEDB5, 0x8B4D, 
-0xB4AE, 0xE631, 0xD591, 0x6288, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x49E5, 0xDDD0, 0xD590, 0xB48E, 0x8B6C, 0x3189, 0x21EB, 0x7BAE, 0xE611, 0xF652, 0x5A47, 0x59E7, 0xD490, 
-0xC46F, 0xABEF, 0x93AD, 0xC530, 0x93EC, 0x49A5, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49E5, 0xC52F, 0xC530, 0x93AD, 0x420B, 0x4B0E, 0x83EE, 0x8B6C, 0xD570, 0xE611, 0x5A67, 
-0x0821, 0x28A2, 0x5185, 0x92EB, 0x934D, 0xB4CF, 0x62A8, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49E5, 0xC54F, 0xCD50, 0x830C, 0x424B, 0x94B0, 0xB46E, 0x830B, 0xB48E, 
-0xCD70, 0x6287, 0x2187, 0x3968, 0x5106, 0x9B0C, 0x932C, 0x6288, 0x6A47, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4A05, 0xD590, 0xCD50, 0x832C, 0x49A8, 0x834A, 0xAC4E, 
-0x834C, 0x93CD, 0xC50F, 0x5A67, 0x6B2D, 0xB494, 0x9AAD, 0xDC91, 0xBC4F, 0x49A5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51E6, 0xA44C, 0xCD70, 0x9BEE, 0x59E9, 
-0x4145, 0x9C0C, 0xB4AF, 0x8B2C, 0xAC4E, 0x5226, 0x6248, 0xDD74, 0xB431, 0xDD12, 0xFE56, 0x936C, 0x6207, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5A66, 0xDDD1, 
-0xC510, 0x7B0C, 0x3926, 0x72E9, 0xBCAE, 0xAB8D, 0x8B0C, 0x6ACA, 0xA3CD, 0xE553, 0xDD53, 0xE5B4, 0xFE97, 0xB46F, 0x4985, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x51E6, 0xA44C, 0xD591, 0x8B6D, 0x49A9, 0x3966, 0x82EA, 0xC3EE, 0xA30B, 0xBC30, 0xF615, 0xEDB4, 0xEDD4, 0xEDD4, 0xFE56, 0xAC2F, 
-0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBCD, 0x5A06, 0x9C2B, 0xBCCF, 0x72AB, 0x3926, 0x5A08, 0xBC0E, 0xC3AD, 0xD490, 0xFE36, 0xFE36, 0xFE15, 0xFE76, 
-0xE593, 0x5A27, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA8, 0x7328, 0xE5F1, 0x8B6D, 0x4168, 0x6228, 0xC490, 0xCBEE, 0xC3CD, 0xE532, 0xE594, 
-0xE593, 0xF636, 0xAC2E, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x6267, 0xC50E, 0xC50F, 0x832D, 0x4147, 0x51E7, 0xDD93, 0xEDB4, 0xB38D, 
-0x7248, 0x49C6, 0x49E6, 0x49E6, 0x51C6, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5A67, 0xCD4F, 0xCD50, 0x8B6D, 0x622A, 0x1021, 0x28E3, 0xBD32, 
-0xFF1A, 0x8BAD, 0x6206, 0xB3AC, 0x9B4B, 0x9B2A, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41A5, 0xC50E, 0xD571, 0x8B6D, 0x59E9, 0x2083, 0x2944, 
-0x6A89, 0x7228, 0xA40F, 0x8C2F, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41A5, 0xB4AE, 0x93AD, 0x622A, 0x30E5, 
-0x3985, 0xBD94, 0xEE98, 0x8B0A, 0x5944, 0x9B8C, 0x83CE, 0x6A48, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41A5, 0x9BCD, 0x72AC, 
-0x4968, 0x1862, 0x8C2F, 0xFF5B, 0xCDF6, 0xB512, 0x8B0B, 0x71E7, 0xA3CE, 0x6289, 0x51A5, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 
-0x6AC9, 0x8B6D, 0x51A8, 0x1062, 0x9C90, 0xEEF9, 0x8BAE, 0x940F, 0x9C0F, 0x71E7, 0x7207, 0x7A28, 0x5165, 0x3103, 0x51A5, 0x930A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x6206, 0x5A48, 0x4987, 0x5A89, 0xCDF5, 0xEED9, 0xB4F2, 0x8B6D, 0x832C, 0x7A89, 0x5965, 0x5125, 0x7207, 0x7207, 
-0x5165, 0x3103, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x59E6, 0x0841, 0x83CD, 0xFF9B, 0xE698, 0xB4F2, 0x8B8D, 0x832B, 0x61E7, 0x3084, 0x3084, 
-0x61C6, 0x8268, 0x8268, 0x5985, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4164, 0x942F, 0xFF5A, 0xD5F6, 0x9BEF, 0x7AEB, 0x7A48, 0x5145, 
-0x3064, 0x30A4, 0x5986, 0x7207, 0x8268, 0x59A5, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x62CA, 0xE698, 0xEED9, 0xA4B1, 0x72CA, 0x7227, 
-0x71E6, 0x69E7, 0x5145, 0x3084, 0x30A4, 0x4905, 0x69E7, 0x4944, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x736C, 0xFFDC, 0xDE57, 0x836D, 
-0x28C2, 0x5144, 0x7A28, 0x7227, 0x7207, 0x5145, 0x38C4, 0x3884, 0x3083, 0x4144, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x5A07, 0x8BEE, 0xD5F6, 
-0xA470, 0x5228, 0x20A3, 0x38C4, 0x69C7, 0x7227, 0x7227, 0x7207, 0x69E7, 0x5966, 0x30A3, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5AA9, 
-0xBD13, 0x938D, 0x7B0B, 0x3145, 0x3125, 0x30C4, 0x38C4, 0x61C6, 0x7207, 0x7227, 0x7227, 0x7A48, 0x5985, 0x4164, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 
-0x59E6, 0xA4F2, 0xDE57, 0x93CE, 0x49E7, 0x4187, 0x41A7, 0x1882, 0x2022, 0x5146, 0x7227, 0x7207, 0x7207, 0x8248, 0x59A6, 0x4164, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x5268, 0xEED9, 0xFF5A, 0xC5B5, 0x3165, 0x20A3, 0x49C8, 0x1882, 0x2843, 0x5146, 0x7207, 0x7207, 0x7207, 0x7A28, 
-0x5985, 0x4164, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x49E7, 0xDE77, 0xFF3A, 0xF71A, 0x5A89, 0x59C6, 0x4145, 0x5165, 0x6186, 0x69C6, 0x7207, 0x7207, 
-0x7207, 0x7A28, 0x5985, 0x4164, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x5AA9, 0xDE98, 0xF73A, 0xD616, 0x5A68, 0x82C9, 0x4984, 0x7207, 0x8268, 0x7207, 
-0x7207, 0x7207, 0x7207, 0x7A28, 0x5985, 0x4164, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51E6, 0xBD73, 0xF71A, 0xEF19, 0x7BAD, 0x7A88, 0x59C6, 0x4145, 0x7207, 
-0x7A27, 0x7227, 0x7207, 0x7207, 0x7207, 0x7A48, 0x5165, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49E7, 0xDE98, 0xFF5A, 0xDE57, 0x5228, 0x6207, 0x3945, 
-0x2926, 0x4167, 0x59A7, 0x6A07, 0x7A27, 0x7207, 0x7207, 0x7207, 0x7268, 0x49E6, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49E6, 0xD636, 0xFF9B, 0xC554, 0x3144, 
-0x0020, 0x18C4, 0x2107, 0x1906, 0x2106, 0x3966, 0x59C7, 0x6A07, 0x7A27, 0x71E6, 0x8AEA, 0x83CE, 0x5A48, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4A07, 0xC5B5, 0xCDB5, 
-0xA430, 0x3144, 0x0000, 0x18C5, 0x2126, 0x2106, 0x18E6, 0x1906, 0x2106, 0x4166, 0x51A7, 0x51A6, 0x3926, 0x8BAF, 0x8BCE, 0x6A47, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4A07, 
-0xC5B5, 0xC595, 0xA450, 0x3965, 0x0842, 0x18C5, 0x18E5, 0x2126, 0x2106, 0x2106, 0x1906, 0x2106, 0x2106, 0x1906, 0x0884, 0x41C8, 
-0x93AE, 0x5A07, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x49C6, 0xDDF5, 0xFF7B, 0x83EE, 0x1062, 0x1084, 0x18C5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18E6, 0x18C5, 
-0x10A4, 0x0884, 0x49E9, 0x5208, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x49A5, 0xE573, 0xFED8, 0x730B, 0x0022, 0x18A4, 0x18E5, 0x2126, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x20E6, 0x18C4, 0x18C5, 0x1084, 0x0884, 0x5A4A, 0x6227, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49C6, 0xDD53, 0xFE36, 0xE573, 0x5227, 0x0001, 0x18E5, 0x2126, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18C4, 0x10A4, 0x4A09, 0x3145, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49C6, 0xDD53, 0xFE56, 0xEDB4, 0x5A27, 0x0001, 0x20E6, 0x2126, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2127, 0x18E5, 0x18A4, 0x18C5, 0x0863, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A6, 0xF615, 0xFEF8, 0x832B, 0x0021, 0x10A4, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2126, 0x20E5, 0x10A4, 0x18E5, 0x2127, 0x18A3, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x8B6C, 0xE593, 0x7B0A, 0x0000, 
-0x20E6, 0x2126, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2126, 0x18E5, 0x18A4, 0x18C4, 0x2904, 
-0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x6207, 0x5A07, 
-0x49C6, 0x10A3, 0x2127, 0x2126, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18E6, 0x18E6, 0x18E6, 0x2106, 0x18C4, 0x20C3, 
-0x59E6, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8B, 0x6227, 0x2904, 0x2106, 0x2127, 0x2106, 0x18E6, 0x18E6, 0x2106, 0x2106, 0x3147, 0x59E9, 0x3167, 0x10C5, 0x10A5, 
-0x28E3, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x20C3, 0x28E4, 0x5A08, 0x3967, 0x18E6, 0x2106, 0x10A4, 0x59E7, 0xB3AD, 0x92EB, 
-0x726A, 0x934C, 0x6268, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2B, 0x3103, 0x9AEA, 0xA34C, 0x930B, 0x51C7, 0x4985, 0x59E6, 
-0xA32B, 0xDC6F, 0xE532, 0xFE56, 0x9BCD, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x4985, 0xA34C, 0xDC4F, 0xDC4F, 0x7247, 
-0x82C9, 0x6A47, 0x7A68, 0xF573, 0xF615, 0xFEB8, 0x9BCD, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4164, 0xB3EE, 0xDC70, 
-0xCBEE, 0x6A27, 0x59E6, 0x5185, 0x9B0B, 0xF5D5, 0xFE56, 0xFE36, 0x72EA, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x62A9, 
-0xCD32, 0xCC0E, 0xCBAD, 0x6A07, 0x18E3, 0x832B, 0xBBCD, 0xE4D1, 0xFE36, 0x8B6C, 0x6A47, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0x51C6, 0xB594, 0xF6F9, 0xD512, 0xB3CD, 0x28A2, 0x62EB, 0xF6F9, 0xE5B5, 0xD532, 0x834B, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x49A5, 0xC5D5, 0xFF9C, 0xEF19, 0x83EE, 0x20E3, 0xA4D1, 0xFF7B, 0xFFFE, 0xDEB8, 0x3985, 0xB3CC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49C6, 0xB594, 0xFF7B, 0xF75B, 0x7BAD, 0x5AA9, 0xE698, 0xFF9C, 0xFFDD, 0x840F, 0x7268, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49C6, 0xB594, 0xFF7B, 0xEEF9, 0x7B8D, 0x62CA, 0xEEF9, 0xFFFE, 0xDEB8, 0x41A6, 
-0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49C6, 0xB594, 0xFFDD, 0xACF2, 0x62CA, 0xAD12, 0xFF9C, 0xFFFE, 
-0x7BCE, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49C6, 0xB574, 0xFFFE, 0x83EE, 0x4207, 0xE6B8, 
-0xFFFE, 0xDE98, 0x49E6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49C6, 0xBDB5, 0xFF7B, 0x83CE, 
-0x7B8D, 0xEF3A, 0xFFFF, 0x7BCE, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49C6, 0xD657, 
-0xD657, 0x41C6, 0xAD12, 0xFFFF, 0xE6F9, 0x4A07, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x51E6, 0xBDB5, 0x9470, 0x0820, 0x5A89, 0xBD94, 0x5AA9, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x5A27, 0xA4F2, 0x4A48, 0x0800, 0x20C2, 0x20C2, 0x1061, 0x51A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x5A27, 0x9CD1, 0x4207, 0x0820, 0x2903, 0x18A2, 0x20E3, 0x1081, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49A5, 0x4207, 0x2103, 0x0840, 0x20E3, 0x2903, 0x2903, 0x20C2, 0x4164, 0xABAC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4144, 0x0000, 0x0820, 0x0841, 0x0841, 0x1882, 0x20E3, 0x2903, 
-0x20C2, 0x20C2, 0x51C6, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4164, 0x0841, 0x0861, 0x0841, 0x0020, 0x0820, 
-0x0841, 0x20C2, 0x2903, 0x20E3, 0x1882, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_right_1.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_right_1_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x4164, 0x3964, 0x4185, 0x41A5, 0x49A5, 
-0x41A5, 0x49C5, 0x82C9, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0xA36B, 0x8AE9, 0x62A7, 0xC52E, 0xD5AF, 0xC54E, 
-0xC52E, 0xBCEE, 0xBCEE, 0xA46D, 0x5226, 0x4985, 0x82C9, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x49C5, 0x3964, 0x5226, 0xDE10, 0xFFF5, 
-0xFFD4, 0xFEF3, 0xE611, 0xDDB1, 0xE5F1, 0xDDD1, 0xC50F, 0xA44C, 0x62C7, 0x49C5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x51E6, 0xBCEE, 0xDDF0, 0xC530, 
-0xDE32, 0xFF33, 0xF6B2, 0xC50F, 0xBCEF, 0xDE11, 0xDDF1, 0xBCCF, 0xCD50, 0xF692, 0xFF53, 0xC5AF, 0x5206, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x5206, 0xBCEE, 0xFEB3, 
-0xF652, 0xBD71, 0x84D2, 0xB571, 0xCD0F, 0xBCCE, 0xE692, 0xFF73, 0xACAD, 0x7AEB, 0xAC4E, 0xE631, 0xFF94, 0xFF74, 0xBD0E, 0x5A06, 
-0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x8BAA, 
-0xFEF3, 0xDDB0, 0xC4EF, 0x9C2E, 0x4B4F, 0x5BF0, 0xA4B0, 0xDDD0, 0xFF33, 0xE671, 0x5266, 0x7AEB, 0xC4B2, 0xAC4E, 0xDDD0, 0xF672, 
-0xFEB3, 0x838A, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 
-0x5206, 0xCD4F, 0xF672, 0xC50F, 0xB48E, 0x7AEB, 0x1929, 0x226D, 0x94F1, 0xEE52, 0xEE51, 0x8BAA, 0x6268, 0xE573, 0xED95, 0x8B4D, 
-0xB4AE, 0xE631, 0xDDD1, 0x730A, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x59C6, 0x8BCB, 0xFED3, 0xD590, 0xB48E, 0x8BAD, 0x4A6B, 0x196A, 0x322C, 0x946F, 0xF672, 0xDDB0, 0x49E6, 0x7268, 0xE511, 
-0xCCB0, 0xA3CF, 0x93CD, 0xC530, 0xA44D, 0x41A5, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6227, 0x8369, 0xF672, 0xCD50, 0xA42D, 0x6AAB, 0x324C, 0x5BAF, 0x7B6D, 0x9BCD, 0xEE11, 0xD590, 0x41C6, 
-0x1841, 0x3903, 0x59E6, 0x9B2C, 0x8B4D, 0xB4CF, 0x7B29, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x51E5, 0xB4CE, 0xDDD1, 0xAC2D, 0x62AB, 0x52ED, 0xA4D0, 0x9BCD, 0x8B4C, 0xC550, 
-0xC50F, 0x4A27, 0x1926, 0x28E6, 0x4905, 0x92CB, 0x934C, 0x730A, 0x5A06, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x7308, 0xDDB1, 0xB48E, 0x626A, 0x5249, 0xB4CE, 0xA42E, 
-0x7B0C, 0xAC6E, 0xB4AE, 0x5227, 0x6B6E, 0xA3F2, 0x926C, 0xD470, 0xABEE, 0x4185, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x51E6, 0xAC8D, 0xCD50, 0x6229, 0x4145, 
-0x93CC, 0xBD0F, 0x93AD, 0x938D, 0xA46E, 0x49C5, 0x72EA, 0xD555, 0xABD0, 0xDD12, 0xF5F5, 0x832B, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x940B, 0xD591, 
-0x72AB, 0x4167, 0x5A07, 0xA46D, 0xC48F, 0x9B2C, 0x834C, 0x5A68, 0x9B6C, 0xE553, 0xD533, 0xE594, 0xFEB7, 0xBCB0, 0x4165, 0xBBED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 
-0x9C0B, 0xD570, 0x7AEC, 0x4988, 0x3105, 0x6AAA, 0xB40E, 0xBB6C, 0x92EB, 0xAC2F, 0xEDB4, 0xED93, 0xEDB4, 0xEDD4, 0xFE76, 0xBC90, 
-0x4165, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA36B, 0x5206, 0xB4CD, 0xCD30, 0x72CB, 0x4167, 0x4167, 0x51E9, 0x934D, 0xC40E, 0xBB8C, 0xDD12, 0xFE36, 0xF5F5, 0xEDD4, 0xF5F5, 
-0xEDD4, 0x7B0B, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6206, 0x7B49, 0xD5B1, 0xA40E, 0x5A29, 0x3925, 0x51E9, 0x5A2A, 0x9BAF, 0xD4B0, 0xBB8C, 0xCC4F, 0xF5D5, 0xFE56, 
-0xFE36, 0xFEB8, 0xCCD1, 0x4165, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x5A26, 0xAC8D, 0xAC4F, 0x6A6A, 0x4167, 0x4987, 0x6A4B, 0x49A8, 0x7B2C, 0xE573, 0xD44F, 0xBB8D, 
-0x9B6C, 0x7B0B, 0x832B, 0x938C, 0x6268, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x7B49, 0xBCCF, 0x6A6B, 0x4167, 0x4987, 0x622A, 0x728C, 0x28E4, 0x4A07, 0xE656, 
-0xF677, 0x8B0B, 0x51A5, 0x7268, 0x6227, 0x59E6, 0x7AA8, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x5207, 0x7AEC, 0x4167, 0x4187, 0x624A, 0x728C, 0x51E9, 0x2082, 
-0x59E7, 0xA3EE, 0xCDB4, 0x632B, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x3126, 0x624B, 0x4987, 0x51E8, 0x6A6B, 0x6A6B, 
-0x3126, 0x41E7, 0xB4D1, 0x9B8D, 0x8289, 0x8BCE, 0x6289, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x59E6, 0x4167, 0x4167, 0x3925, 
-0x622A, 0x49A8, 0x39A6, 0xA4F2, 0xFF7B, 0xE6B8, 0x938C, 0x930B, 0x9C2F, 0x5207, 0x9B2A, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4165, 
-0x2924, 0x20A3, 0x59E9, 0x4146, 0x4207, 0xD656, 0xEEF9, 0xDE78, 0xD636, 0x936C, 0x8AA9, 0x7268, 0x28C2, 0x4985, 0x930A, 0xBBED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6A47, 0x62A8, 0x9C0C, 0x6A89, 0x622B, 0x3926, 0x41E7, 0xCE36, 0xCDD5, 0x93CE, 0xBD53, 0xA42F, 0x6165, 0x61A6, 0x69E7, 0x5165, 
-0x30E3, 0x49A5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6A27, 0x6288, 0xD591, 0xC4F0, 0x8B6D, 0x3906, 0x3186, 0xCDF5, 0xDE37, 0x8BAE, 0x8B8D, 0x7AAA, 0x40E4, 0x40C4, 
-0x71E7, 0x7A48, 0x7207, 0x4944, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6A47, 0x6288, 0xCD50, 0xBCAF, 0x49A7, 0x5ACA, 0xDE57, 0xE698, 0xACB1, 0x832C, 0x5166, 
-0x2843, 0x38A4, 0x61C6, 0x7A48, 0x8A68, 0x59A6, 0x3924, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x6AA8, 0x5A67, 0x39C6, 0xB553, 0xFF7B, 0xCDD5, 0x8B8D, 
-0x7268, 0x5965, 0x3084, 0x38A4, 0x5145, 0x61C6, 0x8248, 0x59A6, 0x3944, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7A88, 0x4164, 0x3144, 0xCE16, 0xEEF9, 
-0xACB1, 0x7ACA, 0x69E6, 0x7207, 0x5986, 0x38A4, 0x3064, 0x38C5, 0x5166, 0x4124, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x736C, 
-0xEEF9, 0xD616, 0x7AEC, 0x61E7, 0x7207, 0x7227, 0x7207, 0x61A6, 0x4925, 0x38C5, 0x2863, 0x3924, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x41A5, 0xC5B4, 0xFF9C, 0xCDD5, 0x6249, 0x3884, 0x6186, 0x7227, 0x7207, 0x7227, 0x7207, 0x61A7, 0x4104, 0x3944, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xB3AC, 0x49E6, 0xB533, 0xC574, 0xA450, 0x5A28, 0x1821, 0x38A4, 0x61A6, 0x7227, 0x7207, 0x7207, 0x8248, 0x59A6, 0x3944, 
-0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x6227, 0x8C0F, 0xD5F6, 0x93CE, 0x834D, 0x5248, 0x1841, 0x3083, 0x5966, 0x7227, 0x7207, 0x7207, 0x7A48, 
-0x59A6, 0x3944, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4185, 0xC594, 0xFF7B, 0xBD53, 0x8BAE, 0x6A69, 0x5985, 0x6186, 0x69E7, 0x7207, 0x7207, 
-0x7207, 0x7A28, 0x59A5, 0x3944, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x41A5, 0xB533, 0xFF7B, 0xC5B5, 0x834C, 0x7207, 0x7A27, 0x7227, 0x7207, 
-0x7207, 0x7207, 0x7207, 0x7A28, 0x59A5, 0x3944, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4185, 0xB533, 0xEEB9, 0x9C30, 0x7ACA, 0x7207, 0x7A07, 
-0x7207, 0x7207, 0x7207, 0x7207, 0x7207, 0x7A28, 0x59A5, 0x3944, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2B, 0x5A48, 0xD657, 0xE678, 0x93EE, 0x72CA, 
-0x59C7, 0x59A6, 0x69E7, 0x7A27, 0x7A27, 0x7207, 0x7207, 0x7A48, 0x59A6, 0x4144, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51A5, 0x838D, 0xD5D6, 0xBD33, 
-0x8BAE, 0x5209, 0x2106, 0x20E6, 0x4166, 0x59C7, 0x59C7, 0x6A07, 0x7A27, 0x7A48, 0x4965, 0x4144, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4165, 0x8BEE, 
-0xBD13, 0x9BEE, 0x72EB, 0x2947, 0x10C6, 0x18E6, 0x2106, 0x2106, 0x2106, 0x4186, 0x59C7, 0x49A7, 0x2906, 0x20C3, 0x92EA, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x49A5, 0xACF2, 0xE6B8, 0x8B8D, 0x41A8, 0x2106, 0x18E5, 0x20E5, 0x2106, 0x1906, 0x1906, 0x2106, 0x2106, 0x2106, 0x2106, 0x18C4, 
-0x4165, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x49A5, 0xACB1, 0xFF19, 0x9BEE, 0x18C4, 0x1084, 0x18A4, 0x18A4, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18E5, 
-0x18C5, 0x20E5, 0x20C3, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A6, 0xAC2E, 0xFE77, 0xEDB4, 0x7B0B, 0x1062, 0x0863, 0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x18C4, 0x10A4, 0x2106, 0x2106, 0x20E4, 0x51C6, 0x51C5, 0x51C6, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4985, 0xAC2F, 0xFE36, 0xFE77, 0xB46F, 0x1082, 0x0043, 0x2126, 0x2106, 0x2106, 
-0x2106, 0x2126, 0x20E5, 0x10A4, 0x18C5, 0x2126, 0x2927, 0x20E5, 0x18C4, 0x18C4, 0x0862, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6A27, 0x1882, 0xBC90, 0xFF19, 0xD532, 0x49C6, 0x0842, 0x18C5, 0x2126, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x18A4, 0x10A4, 0x2106, 0x2126, 0x2106, 0x20E6, 0x2106, 0x2927, 0x10A3, 0x7A68, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x0042, 0x18C4, 0x938C, 0xFE56, 0xBCB0, 0x18A2, 0x0022, 
-0x2927, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x10A4, 0x18C5, 0x2106, 0x2106, 0x2106, 0x20E6, 0x18C5, 0x18E5, 0x18A3, 0x8AE9, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x10A3, 0x20E5, 0x20E4, 0x6269, 0x832B, 
-0x2924, 0x0884, 0x2127, 0x2106, 0x2106, 0x2106, 0x2127, 0x20E5, 0x18C4, 0x2106, 0x2126, 0x2106, 0x2106, 0x2126, 0x2106, 0x10A3, 
-0x51C6, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x6207, 0x20C3, 0x0022, 
-0x0842, 0x1881, 0x0862, 0x18C5, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E5, 0x18C5, 0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 0x18E6, 
-0x18E5, 0x20C3, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8B, 0x59E6, 0x3104, 0x28E3, 0x18A2, 0x3967, 0x18E6, 0x10A5, 0x10E6, 0x18E6, 0x1083, 0x1083, 0x2927, 0x2927, 0x18E6, 0x10C5, 
-0x10C5, 0x2927, 0x28E4, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xC40D, 0x9B2A, 0x4164, 0x8ACA, 0x6249, 0x51C8, 0x5A09, 0x3146, 0x3103, 0x4164, 0x1083, 0x2905, 
-0x59E9, 0x5A09, 0x49A8, 0x8B0C, 0x6207, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x3924, 0xB36C, 0xCBEE, 0xBBCD, 0xCBEE, 0x59C6, 0x7A88, 0xC40D, 
-0x7268, 0x3944, 0x7248, 0xBBAD, 0xC40E, 0xED53, 0xBC6F, 0x5A06, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x7AEA, 0xD470, 0xCBEE, 0xD40E, 0xA32B, 0x51A5, 
-0xAB8C, 0xC40D, 0xC40D, 0xA36B, 0x4164, 0xB36C, 0xE4D1, 0xF615, 0xFE56, 0x72CA, 0x7248, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x830B, 0xF5F5, 0xF5D5, 0xD490, 0xCC0E, 
-0x59C6, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x69E7, 0xD490, 0xFE36, 0xFE56, 0x6AA9, 0x7268, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x83EE, 0xFEF9, 0xFE36, 0xF5F5, 
-0xED73, 0x92CA, 0x4985, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x3924, 0xBC0E, 0xFDF5, 0xF615, 0x72CA, 0x7268, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x41A6, 0xD698, 0xFFFE, 
-0xEE97, 0xF5D4, 0x9B4C, 0x4985, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x6A48, 0xD470, 0xF616, 0xCE16, 
-0x5A68, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x83EE, 
-0xFFBC, 0xFFBC, 0xFF5A, 0xA470, 0x4985, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2B, 0x41C6, 0xCD33, 
-0xF71A, 0xFFFE, 0x738D, 0x7A68, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 
-0x49C6, 0xCE57, 0xFFFE, 0xFF5B, 0xAD12, 0x51E7, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 
-0x5A89, 0xEF19, 0xFFDC, 0xFFBC, 0x6B2B, 0x82A8, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6A27, 0x83EE, 0xFFDD, 0xFF9B, 0xACF2, 0x49C6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x9B2B, 0x5227, 0xC5B4, 0xFF9C, 0xFFBC, 0x6B2B, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xB3CC, 0x41A6, 0xD657, 0xFFFE, 0xACF2, 0x49C6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x6B0B, 0xF77B, 0xFFDD, 0x6B2B, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x5207, 0xB553, 0xFFBC, 0xAD12, 0x49C6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x5A89, 0xF77C, 0xFFBD, 0x6B2B, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x5A27, 0xB574, 0xFFDD, 0xB533, 0x51E6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x5207, 0xC5B4, 0xFF9C, 0x6B4C, 0x82A9, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x7AA8, 0x930A, 0xC40D, 0xB3CC, 0x4164, 0x83EE, 0xFFFF, 0xF73A, 0x5248, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x734C, 0xFF7B, 0x734C, 0x8AC9, 
-0xC40D, 0xC3ED, 0x8AEA, 0x51A5, 0x1061, 0x3924, 0xC40D, 0x82A9, 0x0020, 0x4A68, 0x9450, 0x736C, 0x6227, 0xBBED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x734C, 0xFF5B, 
-0x734C, 0x4164, 0x7A88, 0x59E6, 0x18A2, 0x20C2, 0x18C2, 0x3944, 0xAB8B, 0x3123, 0x0861, 0x0820, 0x0000, 0x0820, 0x8AEA, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 
-0x736C, 0xBD53, 0x4A07, 0x1061, 0x1061, 0x18A2, 0x2903, 0x2903, 0x20C2, 0x8AC9, 0x8AC9, 0x0841, 0x1061, 0x0841, 0x0020, 0x0020, 
-0x3944, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xB3AC, 0x5A27, 0x3985, 0x20C2, 0x2903, 0x2903, 0x2903, 0x20E3, 0x20C2, 0x8AEA, 0xC40D, 0xBBED, 0x59E6, 0x1061, 0x0841, 
-0x0861, 0x0861, 0x0841, 0x7AA8, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x0840, 0x2903, 0x2924, 0x20E3, 0x1082, 0x20C2, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0xA34B, 0x59E6, 0x1061, 0x0861, 0x0861, 0x18A2, 0x4164, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x18A2, 0x20E3, 0x20C3, 0x3103, 0x7A88, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4164, 0x0841, 0x0861, 0x0861, 0x0841, 0x4164, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4985, 0x0861, 0x1061, 0x7268, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_right_2.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_right_2_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0xB3AC, 0x930A, 0x6267, 0xB4CD, 0xC54E, 0xBCED, 0xBCED, 0xAC8D, 
-0xB4AD, 0x9C2C, 0x5206, 0x49A5, 0x930A, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x51C5, 0x3144, 0x51E5, 0xD5CF, 0xFFF5, 0xFFD5, 0xFEF3, 
-0xEE32, 0xDDB1, 0xE5F1, 0xDDD1, 0xBCCF, 0x940B, 0x5A66, 0x49C5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x51E6, 0xACAD, 0xD590, 0xBD0F, 0xDE52, 0xFF53, 
-0xF6D2, 0xC52F, 0xBCCF, 0xDDD0, 0xDDD1, 0xBCEF, 0xCD70, 0xF692, 0xF712, 0xBD4E, 0x51E6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x51E6, 0xB4AD, 0xFED3, 0xFE72, 0xC591, 
-0x8CF2, 0xBD91, 0xCD2F, 0xB4AE, 0xE651, 0xFF73, 0xB4EE, 0x830B, 0xAC4E, 0xE651, 0xFFB4, 0xFF74, 0xB4AD, 0x5A06, 0xAB8B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x8369, 0xFEF3, 0xDDD1, 
-0xC50F, 0x9C4E, 0x538F, 0x6410, 0xA4AF, 0xD5D0, 0xFF53, 0xEE91, 0x5A87, 0x72CB, 0xBC91, 0xB48E, 0xDDF0, 0xF692, 0xFEB3, 0x836A, 
-0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x5206, 0xC52E, 
-0xE611, 0xBCEF, 0xB4AE, 0x7B0B, 0x2149, 0x228E, 0x94F1, 0xEE51, 0xF651, 0x93EB, 0x6268, 0xDD52, 0xE575, 0x8B2D, 0xBCCE, 0xEE31, 
-0xE5F2, 0x7B4A, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 
-0x8BAA, 0xFEB3, 0xC52F, 0xAC4E, 0x93CD, 0x526B, 0x1949, 0x2A2C, 0x946F, 0xF672, 0xDDD0, 0x4A06, 0x7289, 0xED52, 0xD4D1, 0xA3CF, 
-0x93CD, 0xCD50, 0xAC6D, 0x49C5, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6206, 0x8BAA, 0xFED3, 0xCD70, 0xA42D, 0x6AAB, 0x322C, 0x538F, 0x734D, 0x9BCD, 0xEE31, 0xD590, 0x41C6, 0x2061, 0x4144, 
-0x6207, 0x9B4C, 0x8B4D, 0xB4CF, 0x7B4A, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x5A06, 0xACAD, 0xD5B0, 0xAC4E, 0x628B, 0x4ACD, 0x9CD0, 0x9BCD, 0x8B4C, 0xCD50, 0xC50F, 0x4A26, 
-0x10E5, 0x20A5, 0x48E5, 0x92AA, 0x934C, 0x7B4B, 0x5A26, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x49A5, 0xACAD, 0xCD50, 0x626A, 0x5249, 0xB4AE, 0xA40E, 0x7B0C, 0xAC8E, 
-0xB4AE, 0x5247, 0x6B4E, 0x9BB1, 0x924B, 0xCC50, 0xABCD, 0x4185, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x51C6, 0x9C2C, 0xCD51, 0x59E8, 0x4986, 0xA40C, 0xBCEF, 
-0x938D, 0x93AD, 0xAC6E, 0x49E5, 0x72EB, 0xD555, 0xA3B0, 0xDCF2, 0xF5D4, 0x7AEA, 0x7248, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x7308, 0xD5B1, 0x7B0B, 0x4986, 0x72EA, 
-0x8B8D, 0xAC8E, 0xBC6E, 0x9B2C, 0x8B4C, 0x5A47, 0x934B, 0xE573, 0xD512, 0xE573, 0xFEB7, 0xBC90, 0x4165, 0xBBED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x49A5, 0xB4AD, 0xCD30, 0x51C8, 
-0x51E7, 0x8B8C, 0x728B, 0x72EB, 0xAC0D, 0xB36C, 0x8AEB, 0xAC0F, 0xE593, 0xED73, 0xEDB4, 0xEDD4, 0xFE76, 0xBC90, 0x4165, 0xBBED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x5A06, 0x93EB, 0xD590, 
-0x7B0B, 0x4166, 0x832A, 0x832C, 0x59EA, 0x5A0A, 0x8B2C, 0xC3EE, 0xBB8C, 0xDD12, 0xFE36, 0xEDD5, 0xEDD4, 0xF5F5, 0xF5D5, 0x832B, 
-0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6226, 0x93CB, 
-0xDDF1, 0xB48F, 0x51C8, 0x5A07, 0x8B8C, 0x72AB, 0x5A0A, 0x5A0A, 0x9BAF, 0xD490, 0xBB8C, 0xCC6F, 0xF5F5, 0xFE56, 0xFE36, 0xFED8, 
-0xCD11, 0x4185, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 
-0x5A66, 0xDDD1, 0xB4AF, 0x5A29, 0x5A27, 0x834B, 0x72AB, 0x622A, 0x6A4B, 0x49A8, 0x832C, 0xE553, 0xCC2E, 0xBBAD, 0xA3AD, 0x8B6C, 
-0x8B8C, 0xA3EE, 0x6AA9, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB3CC, 0x4985, 0x72EA, 0xB4AF, 0x6249, 0x51E7, 0x834B, 0x7ACC, 0x5A0A, 0x622A, 0x6A8B, 0x3105, 0x5248, 0xEE56, 0xF636, 0x8B2B, 
-0x5185, 0x6227, 0x59E6, 0x51A5, 0x7268, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x82A9, 0x2904, 0x7AEC, 0x6A6A, 0x5A27, 0x834B, 0x7ACC, 0x5A0A, 0x622A, 0x6A4B, 0x5A09, 0x28C3, 0x51C6, 0xAC2F, 
-0xD5D5, 0x630B, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x2904, 0x6A4B, 0x4987, 0x72E9, 0x8B8D, 0x5A0A, 0x5A0A, 0x72AB, 0x8B8D, 0x49C7, 0x2061, 
-0x7AC9, 0xB490, 0xAC70, 0x8BAD, 0x5A48, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x5A06, 0x4187, 0x51C8, 0x49A7, 0x5A29, 0x622A, 0x622A, 0x93CD, 0xB48F, 
-0x4186, 0x3145, 0xC573, 0xF73A, 0xD5F5, 0xBCD1, 0x9C2F, 0x5207, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x59C6, 0x3125, 0x3945, 0x49A7, 0x622B, 0x7AEB, 
-0xAC4E, 0x93AD, 0x30E5, 0x5248, 0xDE77, 0xF71A, 0xE6B8, 0xCDB4, 0xAC2F, 0x6A27, 0x28C2, 0x51C6, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x4A06, 0xA42D, 0x72CB, 
-0x622A, 0x9BCD, 0xA42E, 0x72AC, 0x28C5, 0x4A48, 0xD637, 0xF71A, 0xBD53, 0x9C0F, 0x7AAA, 0x6985, 0x69E6, 0x4944, 0x30E3, 0x51C6, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x5A47, 
-0xBD0F, 0x832C, 0x624A, 0x9C0D, 0x8B4C, 0x6A6B, 0x3926, 0x4A28, 0xD636, 0xF71A, 0xBD33, 0x836C, 0x51A7, 0x40C4, 0x71E7, 0x7A48, 
-0x69E7, 0x4124, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x51C6, 0x7B4A, 0x9BEE, 0x6A8B, 0x8B8C, 0x7B0C, 0x622B, 0x28C4, 0x4A27, 0xD636, 0xF71A, 0xDE98, 0x9C30, 0x38E5, 0x3063, 
-0x61C6, 0x7A48, 0x8A68, 0x59A6, 0x3924, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x49C5, 0xAC6E, 0xAC6F, 0xA40E, 0x832C, 0x4167, 0x20A2, 0x4A07, 0xDE57, 0xF71A, 0xEEF9, 0x93AE, 
-0x3043, 0x3084, 0x5146, 0x69C7, 0x8268, 0x59A6, 0x3944, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x5206, 0x93CB, 0xA44E, 0x5A48, 0x6227, 0x8AC9, 0x5248, 0xDE57, 0xF71A, 
-0xE6B8, 0x9BEE, 0x48E4, 0x38A4, 0x3084, 0x40E5, 0x5986, 0x4144, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x51C5, 0x49E6, 0x2903, 0xB3CC, 0xABAC, 0x5248, 
-0xDE57, 0xF71A, 0xE6D9, 0xAC2F, 0x69A6, 0x5966, 0x4905, 0x38A4, 0x2863, 0x3924, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7247, 0x6207, 0xC40D, 
-0xA34B, 0x5228, 0xDE57, 0xF71A, 0xCDD5, 0x8B2B, 0x69C6, 0x7227, 0x7207, 0x6186, 0x38E4, 0x3944, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x930A, 0x5248, 0xDE98, 0xDE57, 0x93EE, 0x59E8, 0x6186, 0x7227, 0x7227, 0x8248, 0x59A6, 0x3944, 0xBBCC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5248, 0xDE77, 0xDE77, 0xBD33, 0x6A8A, 0x5125, 0x7207, 0x7207, 0x7A48, 0x59A6, 0x3944, 
-0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5228, 0xDE57, 0xF73A, 0xEEF9, 0x9BCE, 0x5965, 0x71E7, 0x7207, 0x7A28, 
-0x59A6, 0x3944, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5248, 0xDE78, 0xF71A, 0xE6B8, 0xA40E, 0x69A6, 0x69E7, 
-0x7207, 0x7A28, 0x59A6, 0x3944, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x4A07, 0xD616, 0xEF1A, 0xE6B8, 0xA3EE, 
-0x69A6, 0x69E7, 0x7207, 0x7A28, 0x59A6, 0x3944, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x3144, 0xB4F2, 0xF71A, 
-0xE6D9, 0xA40E, 0x69A6, 0x69E7, 0x7207, 0x7A48, 0x59A6, 0x4144, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x3103, 
-0x93EE, 0xE698, 0xEF3A, 0x9C0F, 0x6185, 0x7A07, 0x7A27, 0x7A48, 0x4985, 0x3944, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6A47, 0x3965, 0x832C, 0xAC91, 0xC594, 0x6B0C, 0x3925, 0x59A7, 0x59C7, 0x51C7, 0x2905, 0x3924, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8B, 0x18A2, 0x41A7, 0x93EF, 0xB4D2, 0x9C2F, 0x49E8, 0x18C5, 0x2106, 0x2106, 0x2927, 0x18C5, 0x3944, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6227, 0x0862, 0x41A8, 0xACD2, 0xEEF9, 0xCDD5, 0x526A, 0x10A5, 0x18E6, 0x1906, 0x1906, 0x18C5, 0x20C3, 
-0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x20C3, 0x18E5, 0x20E5, 0x836C, 0xF697, 0xF6B8, 0x6AEB, 0x0843, 0x2106, 0x2126, 0x20E5, 
-0x18C5, 0x18C4, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x18A4, 0x2127, 0x0022, 0x5207, 0xEDB4, 0xFE56, 0xBC90, 0x3965, 0x1084, 
-0x2127, 0x20E5, 0x18C4, 0x20E5, 0x18C3, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x18A4, 0x2127, 0x2927, 0x0022, 0x5A27, 0xEDB4, 0xFE56, 0xF5D4, 
-0x5A48, 0x0022, 0x2127, 0x18C4, 0x18A4, 0x2126, 0x2106, 0x20C3, 0x4164, 0x4985, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6206, 0x18A4, 0x2127, 0x2927, 0x2127, 0x0022, 0x6268, 0xFE76, 
-0xFE77, 0x936C, 0x20C4, 0x18C5, 0x20E6, 0x10A4, 0x18C5, 0x2126, 0x2927, 0x18E5, 0x10A4, 0x0862, 0x6206, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x18A4, 0x2927, 0x2927, 0x2106, 0x20E6, 0x0001, 
-0x49E6, 0xD532, 0xF615, 0x6A89, 0x0002, 0x2107, 0x18A4, 0x18A4, 0x2106, 0x2126, 0x2106, 0x2106, 0x18E5, 0x1082, 0x7A88, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x18A4, 0x2106, 0x2127, 0x2126, 
-0x18A4, 0x1063, 0x18C3, 0x3145, 0x832B, 0x5A47, 0x0863, 0x18E6, 0x0863, 0x10C4, 0x2126, 0x2106, 0x2106, 0x2927, 0x18C4, 0x4985, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x59E6, 0x20C3, 
-0x18C4, 0x18C5, 0x1062, 0x1083, 0x0884, 0x0023, 0x18A3, 0x18A2, 0x10A4, 0x2106, 0x2905, 0x20E6, 0x1906, 0x2106, 0x2127, 0x2106, 
-0x18A3, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA36B, 0x51A6, 0x3103, 0x28C2, 0x20C3, 0x51E8, 0x3988, 0x0064, 0x0043, 0x10C5, 0x5A09, 0x9B2C, 0x5A09, 0x10C5, 0x10C5, 
-0x10A5, 0x18A3, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xC40D, 0x8AE9, 0x4164, 0xB38C, 0x930B, 0x51E8, 0x51E9, 0x5A09, 0x7A89, 0xCBED, 0xB3AD, 
-0x6209, 0x49C8, 0x51A7, 0x4164, 0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x4164, 0xBBAC, 0xCBEE, 0xBBAD, 0xC3EE, 0x82A9, 0x4985, 
-0x6A07, 0xC3CD, 0xC3AD, 0xBBCD, 0xDCD1, 0x7AC9, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x4185, 0xCC90, 0xD490, 0xCBEE, 0xCC0E, 
-0x59C6, 0x7A88, 0x4985, 0x9B0B, 0xDC4F, 0xE511, 0xFE77, 0x9BCD, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x5A06, 0x93AD, 0xF615, 0xEDB4, 
-0xD490, 0x8A89, 0x51C6, 0xBBCD, 0x82A9, 0x59A6, 0xC40E, 0xF5F5, 0xFE97, 0x938C, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A06, 0x9C4F, 0xFE56, 
-0xF5D4, 0xFE36, 0xE512, 0x4965, 0x82C9, 0xC40D, 0xB3CC, 0x3903, 0xA36C, 0xFDD4, 0xFE36, 0x936C, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x4A28, 
-0xEF1A, 0xFF5A, 0xF615, 0xED94, 0x82CA, 0x59C6, 0xBBCD, 0xC40D, 0xB3AC, 0x3944, 0xA34B, 0xE512, 0xFE97, 0x9C0E, 0x51C6, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x59E6, 0x9CD1, 0xFFFD, 0xFFBC, 0xF6F9, 0x8BAD, 0x51C5, 0xBBED, 0xC40D, 0xC40D, 0xABAC, 0x41A5, 0xB4B1, 0xF698, 0xFF3A, 0x8BEE, 
-0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA36B, 0x4A07, 0xE71A, 0xFFFE, 0xF73A, 0x9470, 0x5A06, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x41C6, 0xC5B5, 0xFFFE, 
-0xBDD5, 0x5227, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xB3AC, 0x5207, 0xB594, 0xFFDD, 0xF75B, 0x944F, 0x51E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x41A6, 
-0xC594, 0xFFFE, 0x9CB1, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x5207, 0xBDD5, 0xFFFE, 0xFF7B, 0x942F, 0x51E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x41A5, 0xC5D5, 0xFFFF, 0xA512, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x6289, 0xD677, 0xFFFF, 0xF77B, 0x942F, 0x51E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x3985, 0xD657, 0xFFFF, 0xA512, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x3924, 0x5ACA, 0xC5F6, 0xEED9, 0x9C70, 0x51E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x5A06, 0x944F, 0xFFFD, 0xAD33, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x3124, 0x0841, 0x0861, 0x2104, 0x5269, 0x6A48, 0xBBCD, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x49C6, 0xE6D9, 0xB574, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x0841, 0x1061, 0x0820, 0x0000, 0x1061, 0xA34B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x41A5, 0xE6D9, 0xB594, 0x59E6, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x3103, 0x0841, 0x1061, 0x0841, 0x1081, 
-0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x49E6, 0xEEF9, 0xF77C, 0x62EA, 
-0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x3123, 0x0861, 
-0x0861, 0x1881, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x41C6, 0xDE77, 
-0xEF1A, 0x5A89, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB3AC, 0x3124, 0x0841, 0x0841, 0x4185, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 
-0x3124, 0x62CA, 0x5268, 0x18A2, 0x18A2, 0x82A9, 0xBBED, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x4185, 0x0841, 0x0841, 0x4144, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA36B, 0x20A2, 0x1041, 0x1881, 0x2903, 0x2903, 0x20C2, 0x3103, 0x3924, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x28C2, 0x0840, 0x1881, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x20C2, 0x20E3, 0x2903, 0x2903, 0x2903, 0x20E3, 0x20C2, 0x18C2, 0x2903, 0xAB8B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_right_3.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_right_3_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x3124, 0xAC8C, 0xAC8C, 0xAC8C, 
-0xAC8C, 0xAC8C, 0xAC8C, 0xAC8C, 0x51C5, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4144, 0x18A2, 0x18A2, 0x3984, 0xDE30, 0xF6F2, 
-0xF6F2, 0xEE92, 0xE5F1, 0xC52F, 0xBCCF, 0xBCCF, 0x9C0D, 0xBD0E, 0x18A2, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x49A5, 0xAC8C, 0xE5F1, 0xE5F1, 0xBCEF, 
-0xD5F1, 0xF6F2, 0xEE92, 0xCD70, 0xB4CF, 0xD5B0, 0xE5F1, 0xD590, 0xBCEF, 0xDDD0, 0xFF13, 0xDE30, 0x3123, 0xBBCC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x8BCA, 0xE5F1, 0xE5F1, 
-0xDDB0, 0xC570, 0x7471, 0xC591, 0xC52F, 0xB4CF, 0xDE31, 0xFF13, 0xB4EE, 0x832C, 0xC50F, 0xDDD0, 0xF6D2, 0xEEB2, 0xBCEE, 0x6A67, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x6A67, 0xAC8C, 
-0xE5F1, 0xD590, 0xB4AE, 0xA46E, 0x4B4E, 0x6C51, 0xA4AF, 0xD5D0, 0xEEB2, 0xE651, 0x5266, 0xB44F, 0x9BCF, 0xB48E, 0xE5F1, 0xE5F1, 
-0xDDD0, 0x836A, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 
-0x7308, 0xE5F1, 0xCD70, 0xB4AE, 0xB4AE, 0x7B2C, 0x2149, 0x4B0E, 0x94F1, 0xE5F1, 0xE5F1, 0x8BAB, 0x6AA9, 0xCCF1, 0xEDB4, 0x72AC, 
-0xCD70, 0xDDF1, 0xC52F, 0x72E9, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6207, 0x7308, 0xE5F1, 0xBCEF, 0xB4AE, 0x834C, 0x5B2E, 0x2149, 0x4AED, 0x942E, 0xE5F1, 0xD590, 0x4A06, 0x82CA, 0xCC6F, 
-0xCC6F, 0xBC70, 0x8B6C, 0xC50F, 0x93CC, 0x6227, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x6A47, 0x9C2B, 0xBCEF, 0xB4AE, 0x6A8B, 0x29EB, 0x5BAF, 0x93EE, 0x93AD, 0xE5F1, 0xCD50, 0x41C5, 
-0x20C2, 0x3103, 0x3103, 0xABAD, 0x6A8B, 0xB4AE, 0x838B, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x49A5, 0xB4CD, 0xBCCF, 0x6A8B, 0x63F0, 0xAC8F, 0x9C0D, 0x834C, 0xBCCF, 
-0xB4AE, 0x41C5, 0x39C9, 0x59C9, 0x5968, 0xB36C, 0x6A8B, 0x9C0C, 0x49A5, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xAC8C, 0xBCCF, 0x6A8B, 0x3945, 0xB4AE, 0x9C0D, 
-0x832C, 0xB4AE, 0xB4AE, 0x41C5, 0x94B2, 0x830E, 0xAA6C, 0xE553, 0xA32B, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x8BCA, 0xBCEF, 0x6A8B, 0x5A29, 0x49C6, 
-0xAC4E, 0xB4AE, 0x9BCD, 0x832C, 0xAC8E, 0x41C5, 0x7A68, 0xDDF7, 0x82ED, 0xDD33, 0xEDB4, 0xCCF1, 0x3123, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x6A47, 0xA44C, 0xBCEF, 0x6A8B, 
-0x3104, 0xAC4E, 0x832C, 0xA42E, 0xB44E, 0x9B2C, 0x8B4C, 0x5A27, 0xB44F, 0xCC90, 0xE593, 0xEDB4, 0xEDB4, 0xCCF1, 0x3123, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x6A67, 0x93EB, 0xBCEF, 
-0x9BED, 0x59E8, 0x5A27, 0x93CD, 0x938D, 0x6A8B, 0xA3AD, 0xBBAD, 0xA32C, 0xC491, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xCCF1, 
-0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x6A67, 0x9C2C, 
-0xBCEF, 0x9BED, 0x5A08, 0x6A89, 0x834C, 0x624A, 0x624A, 0x624A, 0x8B2D, 0xCC4F, 0xBBAD, 0xD4F1, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 
-0xDD53, 0x72CA, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x6A67, 
-0x9C2C, 0xBCEF, 0x9BED, 0x5A08, 0x72EA, 0x7B0B, 0x6A6B, 0x624A, 0x624A, 0x624A, 0x938E, 0xD4F1, 0xBBAD, 0xC42F, 0xDD32, 0xEDB4, 
-0xEDB4, 0xEDB4, 0xCCF1, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x3144, 0xBCCF, 0x93CD, 0x5A08, 0x6A89, 0x7B0B, 0x624A, 0x624A, 0x624A, 0x624A, 0x51E8, 0x6269, 0xE573, 0xCC6F, 0xBBAD, 
-0x7268, 0x3985, 0x3985, 0x3985, 0x3965, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3124, 0x6A8A, 0x9BED, 0x51C7, 0x6A89, 0x7B0B, 0x6A6B, 0x624A, 0x624A, 0x624A, 0x624A, 0x49C8, 0x5269, 0xDE57, 
-0xDE37, 0x5A89, 0x7A88, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x624A, 0x51C8, 0x6AA9, 0xAC8E, 0x7B0C, 0x624A, 0x624A, 0x6A8B, 0x6A8B, 0x5A09, 0x2082, 
-0x7A48, 0x7A89, 0x7A89, 0x3924, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3944, 0x51E8, 0x51C8, 0x6AA9, 0x8B6C, 0x624A, 0x624A, 0x72AB, 0xAC8E, 0xAC4E, 
-0x5A09, 0x20E3, 0xAC90, 0xDE77, 0xDE77, 0xA42F, 0x49A5, 0x7268, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x3944, 0x3946, 0x6AA9, 0x8B6C, 0x624A, 0x624A, 0xAC4E, 
-0xB4AE, 0x93CD, 0x5A09, 0x39A6, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 0x9BAD, 0x30E3, 0x8AEA, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x7AA8, 0x49E6, 0x7B0A, 0x7B0C, 0x624A, 
-0x7B0C, 0xAC8E, 0x9BED, 0x624A, 0x5A09, 0x39A6, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 0x9BAD, 0x7207, 0x30E3, 0x28C3, 0x7A88, 0x8AC9, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x3144, 0xB4AE, 0x8B6C, 
-0x624A, 0x624A, 0x9C0D, 0x938D, 0x6A6B, 0x624A, 0x5A09, 0x39A6, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 0x8B4C, 0x5166, 0x69E7, 0x7207, 
-0x3903, 0x4124, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x3144, 
-0xB4AE, 0x8B6C, 0x624A, 0x832C, 0xAC4E, 0x6A8B, 0x624A, 0x5A2A, 0x20C3, 0x2924, 0xBD53, 0xDE77, 0xDE77, 0xDE77, 0x7ACB, 0x38A4, 
-0x69E7, 0x7207, 0x7207, 0x61C6, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBCC, 0x7AA8, 0x5A67, 0xAC4E, 0x832C, 0x93CD, 0xB4AE, 0x6A8B, 0x624A, 0x20C3, 0x8AC9, 0x20E3, 0xAC91, 0xDE77, 0xDE77, 0xDE77, 
-0x7ACB, 0x38A4, 0x69E7, 0x7207, 0x7207, 0x61C6, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x930A, 0x41C5, 0xB4AE, 0x8B6C, 0x93CD, 0x3984, 0x5A09, 0x18A3, 0xAB8C, 0xAB8C, 0x20E3, 0xAC91, 0xDE77, 
-0xDE77, 0xDE77, 0x7ACB, 0x38A4, 0x40E5, 0x40E5, 0x7207, 0x61C6, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x5A47, 0xAC4D, 0x41C5, 0x930A, 0x3103, 0xAB8C, 0xAB8C, 0x1082, 0x62AA, 
-0x3165, 0xAC91, 0xDE77, 0xDE77, 0xDE77, 0x6A49, 0x40E4, 0x38A4, 0x30A4, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x5A47, 0x3143, 0x930A, 0xC40D, 0xC40D, 0xAB8C, 
-0x1082, 0x62AA, 0x3165, 0xAC91, 0xDE77, 0xDE77, 0xDE77, 0x8B2B, 0x7207, 0x4925, 0x40E4, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x4985, 0xA34B, 0xC40D, 
-0xC40D, 0xAB8C, 0x1082, 0x730B, 0x5228, 0xAC91, 0xDE77, 0xDE77, 0xDE77, 0x8B2B, 0x7207, 0x7207, 0x61C6, 0x18A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6247, 0x734C, 0x8B6D, 0x6ACA, 0x6AEB, 0xCDB5, 0xDE77, 0xDE77, 0x8B2B, 0x7207, 0x7207, 0x61C6, 0x18A2, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xACD1, 0x8B6D, 0x5228, 0x3165, 0xB4F2, 0xDE77, 0xDE77, 0xB4D1, 0x7A48, 0x7207, 
-0x61C6, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1082, 0x8B6D, 0x6ACA, 0x4165, 0x5A07, 0xB4F2, 0xDE77, 0xDE77, 0xDE77, 
-0x7A89, 0x7207, 0x61C6, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xC5B5, 0x9450, 0x28C3, 0x7A89, 0xB4F2, 0xDE77, 
-0xDE77, 0xDE77, 0x7A89, 0x7207, 0x61C6, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20E3, 0xC5B4, 0x3965, 0x69E6, 0x7A89, 
-0x8BAD, 0xC594, 0xDE77, 0xDE77, 0x7A89, 0x7207, 0x61C6, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3164, 0xA4F2, 0x0861, 
-0x2106, 0x3966, 0x7AAA, 0xBD33, 0xDE57, 0xD616, 0x93CE, 0x6A07, 0x20E5, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0x0020, 0x1083, 0x2106, 0x2106, 0x49E9, 0x7B2C, 0xB4F2, 0x9C0F, 0x8B6D, 0x3167, 0x18C5, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x0841, 0x2106, 0x2106, 0x2106, 0x20E5, 0x628A, 0x8B6D, 0xA470, 0xAC91, 0x524A, 0x1083, 0x18A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0841, 0x2106, 0x2106, 0x18E5, 0x18C5, 0x41C8, 0x730C, 0xC5B5, 0xDE77, 0x93CE, 0x1083, 0x18A2, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0841, 0x2106, 0x2106, 0x18E5, 0x18C5, 0x2106, 0x3145, 0xBD53, 0xE616, 0xCD12, 
-0x0841, 0x20E4, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28E3, 0x18E5, 0x2106, 0x2106, 0x18E5, 0x18C5, 0x2106, 0x18E5, 0x3166, 
-0xCCF1, 0xEDB4, 0x0841, 0x20E5, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0841, 0x2106, 0x2106, 0x2106, 0x18E5, 0x18C5, 0x2106, 
-0x2106, 0x0841, 0xCCF1, 0xEDB4, 0xA3EE, 0x0861, 0x20E4, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x20E5, 0x2106, 0x2106, 0x18E5, 0x1083, 
-0x18C5, 0x2106, 0x2106, 0x0841, 0xCCF1, 0xEDB4, 0xCCF1, 0x0841, 0x18C5, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x20E5, 0x2106, 0x2106, 0x2106, 
-0x18E5, 0x1083, 0x18C5, 0x2106, 0x1062, 0x938C, 0xEDB4, 0xEDB4, 0xB44F, 0x0861, 0x2106, 0x18A4, 0x6207, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x20E5, 0x2106, 
-0x2106, 0x2106, 0x18C5, 0x1083, 0x18E5, 0x2106, 0x1083, 0x0841, 0xA40E, 0xB44F, 0x0841, 0x2106, 0x2106, 0x18A4, 0x6207, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 
-0x20E4, 0x2106, 0x2106, 0x20E5, 0x1062, 0x1062, 0x2106, 0x2106, 0x2106, 0x2106, 0x1083, 0x1062, 0x1083, 0x2106, 0x2106, 0x18A4, 
-0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7247, 0x1083, 0x1083, 0x28E4, 0x4144, 0x28E3, 0x4166, 0x18E5, 0x2106, 0x2106, 0x2106, 0x6229, 0x0841, 0x2106, 
-0x20E5, 0x3124, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x7A88, 0x8AC9, 0xAB8C, 0x6206, 0x20C2, 0x51A6, 0x82AA, 0x82AA, 0x82AA, 0xB38C, 
-0x0020, 0x1062, 0x3124, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0020, 0x7248, 0xBBAD, 0xBBAD, 
-0xD4F1, 0xDD32, 0x1061, 0x930A, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x51A5, 0x4965, 
-0x8289, 0xDD12, 0xEDB4, 0xEDB4, 0xB44F, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x7A88, 
-0x6A07, 0x4965, 0x7248, 0xDD32, 0xEDB4, 0xEDB4, 0xCCF1, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7A88, 0x49A6, 0xBBEE, 0x51A6, 0x7248, 0xD4F1, 0xEDB4, 0xEDB4, 0xCCF1, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBCC, 0x6247, 0x8C2F, 0xDDF6, 0xC490, 0x49E6, 0x8ACA, 0xDD12, 0xE593, 0xCCF1, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5ACA, 0xF75B, 0xF75B, 0xEF3A, 0x5AAA, 0x93AD, 0xC4B1, 0xEE16, 0x936C, 0x59C6, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x6A88, 0xA513, 0xF75B, 0xEF3A, 0xE698, 0x5289, 0xA4D2, 0xE6D9, 0xF75B, 0x18A2, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x41E7, 0xF75B, 0xEF3A, 0xE6B8, 0x8C0F, 0x20E3, 0xA4D2, 0xEF3A, 0xF75B, 
-0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x3944, 0xC5F6, 0xEF3A, 0xE698, 0x8C0F, 0x6247, 0x4144, 0xA4D2, 
-0xEF3A, 0xF75B, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x2103, 0xEF1A, 0xDE98, 0x9C70, 0x6247, 0xBBCC, 
-0x4985, 0xA4D2, 0xEF3A, 0xF75B, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x2103, 0xD678, 0xDEB8, 0x8C0F, 0x4985, 
-0xC40D, 0xC40D, 0x59C6, 0x8C0F, 0xEF3A, 0xF75B, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x1061, 0x0861, 0x0861, 0x3185, 
-0x732B, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xC5B5, 0xEF3A, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x0841, 0x0861, 
-0x0861, 0x0841, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xC5B5, 0xEF3A, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 
-0x1081, 0x0861, 0x0861, 0x0841, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xC5B5, 0xEF3A, 0x5A89, 0x8AC9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7247, 0x0841, 0x0861, 0x0841, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xC5B5, 0xEF3A, 0x7BAD, 0x18A2, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x0861, 0x0841, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x5A89, 0x734C, 
-0x20E3, 0x20C2, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x0820, 0x0841, 0x20C2, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0x3103, 
-0x20C3, 0x20E3, 0x20E3, 0x20E3, 0x20C2, 0x3123, 0x3123, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0820, 0x0841, 0x1081, 0x7247, 0xC40D, 
-0xC40D, 0x3103, 0x20C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20C3, 0x20C3, 0x20C2, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_right_4.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_right_4_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x72E8, 0xAC8C, 0xAC8C, 
-0xAC8C, 0xAC8C, 0xAC8C, 0xAC8C, 0x6AA8, 0x3123, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x18A2, 0x18A2, 0x7B69, 0xE691, 
-0xF6F2, 0xF6F2, 0xE5F1, 0xD5B0, 0xBCCF, 0xBCCF, 0xAC6E, 0xBD0E, 0x3964, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3944, 0xE5F1, 0xE5F1, 0xD590, 
-0xC550, 0xE692, 0xF6F2, 0xDDF1, 0xB4AE, 0xC52F, 0xE5F1, 0xD5B0, 0xBCEF, 0xD5B0, 0xF6D2, 0xFF13, 0x3944, 0xBBCC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x51E6, 0xD590, 0xE5F1, 
-0xDDF1, 0xD5B0, 0x9CF1, 0xA511, 0xD590, 0xB4AE, 0xCD90, 0xFF13, 0xD5F0, 0x834C, 0xB48F, 0xDDD0, 0xEE92, 0xF6D2, 0xC52F, 0x51E6, 
-0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xAC8C, 
-0xE5F1, 0xDDF1, 0xCD4F, 0xB4AE, 0x7BCE, 0x5BD0, 0x8470, 0xBD0F, 0xEEB2, 0xEE92, 0x8BEB, 0x72EA, 0xB470, 0xA40E, 0xDDD0, 0xE5F1, 
-0xDDF1, 0x9C2C, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x3103, 0xAC8C, 0xE5F1, 0xC52F, 0xAC4E, 0x8B6C, 0x524A, 0x320B, 0x5BD0, 0xD5D1, 0xE5F1, 0xC50E, 0x6288, 0xB44F, 0xEDB4, 0x832D, 
-0xB48E, 0xDDF1, 0xC52F, 0x838B, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3103, 0xAC8C, 0xC52F, 0xB4AE, 0x9C0D, 0x62CC, 0x424B, 0x324C, 0x5AED, 0xD5B0, 0xDDF1, 0x93EB, 0x49A6, 0xCC6F, 
-0xCC6F, 0xC491, 0x8B4C, 0xBCEF, 0xA44D, 0x5A47, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x51E6, 0x9C0D, 0xAC6E, 0x6A6A, 0x3187, 0x3AAD, 0x842F, 0x72CC, 0xD590, 0xDDD0, 0x838B, 
-0x1882, 0x3103, 0x3103, 0xA36C, 0x7ACB, 0xAC4E, 0x9C0C, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xBD0E, 0xAC4E, 0x51E9, 0x39E8, 0x842F, 0xAC8E, 0x7AEB, 0xAC8E, 
-0xBCCF, 0x838B, 0x2105, 0x5A2B, 0x5968, 0x9B0B, 0x7AAB, 0xAC4E, 0x3123, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xC54F, 0xB4AE, 0x9C0D, 0x51C8, 0x6AA9, 0xB4AE, 
-0x832C, 0x9C0D, 0xB4AE, 0x838B, 0x5A8A, 0xACB3, 0x9A8C, 0xDCF2, 0xCC6F, 0x3944, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x51E6, 0xCD4F, 0xB4AE, 0x8B8C, 0x49A7, 
-0x72EA, 0xAC4E, 0xB4AE, 0x7ACB, 0x9C0D, 0x838B, 0x4985, 0xD554, 0xA3D0, 0xD4F2, 0xEDB4, 0xEDB4, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x28E2, 0xAC8C, 0xBCCF, 0xA44D, 
-0x4987, 0x5A47, 0x9BED, 0x8B6C, 0xAC8E, 0xBBCD, 0x82EB, 0x938C, 0x938C, 0xDD12, 0xDD32, 0xEDB4, 0xEDB4, 0xEDB4, 0x18A2, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x6AA8, 0x7308, 0xB4AE, 
-0xB4AE, 0x7B2B, 0x3945, 0x7B0A, 0x8B6C, 0x72AB, 0x832C, 0xB3AD, 0xB38D, 0xA3AE, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 
-0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x6AA8, 0xB4AE, 
-0xC52F, 0xBCCF, 0x834C, 0x4186, 0x7AEA, 0x7AEB, 0x624A, 0x624A, 0x624A, 0xCCB0, 0xBBAD, 0xC42F, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 
-0xEDB4, 0x6A89, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x5206, 
-0xB4AE, 0xB4AE, 0x834C, 0x7AEB, 0x4166, 0x93CC, 0x72CB, 0x624A, 0x624A, 0x624A, 0x624A, 0xDD53, 0xBBAD, 0xBBCD, 0xD4B0, 0xEDB4, 
-0xEDB4, 0xEDB4, 0xEDB4, 0x20C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x49E5, 0xB4AE, 0x834C, 0x4166, 0x3104, 0x93AC, 0x6A8B, 0x624A, 0x624A, 0x624A, 0x624A, 0x20C3, 0xCCF1, 0xDD32, 0xBBAD, 
-0x82A9, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x18A2, 0x7B0C, 0x832C, 0x4186, 0x93AC, 0xAC4E, 0x6A8B, 0x624A, 0x624A, 0x624A, 0x624A, 0x5A2A, 0x28E3, 0xB512, 
-0xD5F5, 0xA491, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3944, 0x51E8, 0x4987, 0x832A, 0xB4AE, 0x7AEB, 0x624A, 0x624A, 0x624A, 0x624A, 0x624A, 0x28E4, 
-0x5185, 0x7207, 0x8B2B, 0x7289, 0x51A5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x49A6, 0x3125, 0x832A, 0x9BED, 0x72AB, 0x624A, 0x624A, 0x6A8B, 0x7ACB, 
-0x624A, 0x28E4, 0x5185, 0x936C, 0xDE77, 0xCDF5, 0x72A9, 0x51A5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x6227, 0x6288, 0x9BEC, 0x7AEB, 0x624A, 0x624A, 0x6A6B, 
-0x93AD, 0x93CD, 0x624A, 0x28E4, 0x5A07, 0xD5F6, 0xDE77, 0xDE77, 0xCDB4, 0x72A9, 0x51A5, 0x6207, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72E9, 0x838B, 0x9BED, 0x832C, 0x6A8B, 0x624A, 
-0x624A, 0x9BED, 0xA42E, 0x7AEB, 0x624A, 0x28E4, 0x628A, 0xD616, 0xDE77, 0xDE77, 0xDE77, 0xA42F, 0x5185, 0x4944, 0x4164, 0x4985, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41C5, 0xB4AE, 0x8B6C, 0x624A, 
-0x624A, 0x9BED, 0xAC4E, 0xAC4E, 0x6A8B, 0x624A, 0x624A, 0x28E4, 0x628A, 0xD616, 0xDE77, 0xDE77, 0xDE77, 0x93AE, 0x61A6, 0x7207, 
-0x69E6, 0x61C6, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x18A2, 
-0x5A47, 0x9C0D, 0x9C0D, 0xB4AE, 0xB4AE, 0x624A, 0x624A, 0x5A2A, 0x3945, 0x1041, 0x5185, 0x834C, 0xDE77, 0xDE77, 0xDE77, 0x8B8E, 
-0x5986, 0x7207, 0x7207, 0x7207, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7A88, 0x3103, 0x3103, 0x72E9, 0xAC4D, 0x624A, 0x5A2A, 0x3945, 0x7A88, 0x4985, 0x5185, 0x834C, 0xDE77, 0xDE77, 
-0xDE77, 0x8B8E, 0x5166, 0x61A6, 0x69E7, 0x7207, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x5A47, 0x8B8C, 0x4166, 0x49A7, 0x7A88, 0xC40D, 0x4985, 0x30E3, 0x72AA, 
-0xC594, 0xDE77, 0xDE77, 0xACB1, 0x4967, 0x38A4, 0x5145, 0x4945, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x41C5, 0x3945, 0x6207, 0x7A88, 0xC40D, 0x930A, 0x6ACA, 
-0x20E3, 0x4925, 0x93CE, 0xDE77, 0xDE77, 0xDE77, 0x8B4C, 0x40E5, 0x38A4, 0x0820, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x7A88, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 
-0x6207, 0x8C0F, 0x39A6, 0x30A4, 0x93CE, 0xDE77, 0xDE77, 0xDE77, 0x9BAD, 0x61A6, 0x5986, 0x0841, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6207, 0x8C0F, 0x838D, 0x20A3, 0x93CE, 0xDE77, 0xDE77, 0xDE77, 0xCD94, 0x82CA, 0x7207, 0x1041, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x5A69, 0x8BAD, 0x1082, 0x4966, 0xAC91, 0xDE77, 0xDE77, 0xDE77, 0x8B2B, 0x7207, 0x1041, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x734C, 0xA491, 0x7B0B, 0x20C2, 0x4926, 0x9C2F, 0xDE77, 0xDE77, 0xDE77, 0x9BAD, 
-0x7207, 0x1041, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x734C, 0xA491, 0x20E3, 0x61C6, 0x7228, 0x93AE, 0xCDF5, 0xDE77, 
-0xDE77, 0xDE77, 0x8B2B, 0x1041, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x734C, 0x83AE, 0x3945, 0x69E6, 0x7207, 0x7268, 
-0xAC91, 0xDE77, 0xDE77, 0xDE77, 0x938D, 0x1061, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x734C, 0x5289, 0x3925, 0x69E7, 
-0x7207, 0x7228, 0x938D, 0xCDB5, 0xDE77, 0xDE77, 0x9C2F, 0x1082, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x2944, 0x2945, 
-0x20E5, 0x3966, 0x4166, 0x7207, 0x7A89, 0x9C0F, 0xCDB5, 0xB4F2, 0x93CE, 0x1082, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 
-0x0020, 0x18A4, 0x2106, 0x2106, 0x18C4, 0x3146, 0x3987, 0x628A, 0x9C0F, 0x8BAD, 0xB533, 0x3167, 0x4144, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7A88, 0x1083, 0x2106, 0x2106, 0x2106, 0x10A4, 0x2106, 0x2106, 0x2927, 0x6AAB, 0xC594, 0xDE57, 0xC5D5, 0x18A2, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x930A, 0x0020, 0x10A3, 0x2106, 0x2106, 0x2106, 0x10A3, 0x18A4, 0x2106, 0x2106, 0x5A49, 0xC5B5, 0xDE57, 0xDE57, 
-0x18C5, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x1062, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x10A4, 0x20E6, 0x2106, 0x1083, 0x83CE, 
-0xDD73, 0xEDB4, 0x0020, 0x2904, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x1062, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x1083, 0x18C4, 0x2106, 
-0x2106, 0x0841, 0xB44F, 0xEDB4, 0x49E7, 0x1083, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0841, 0x18C5, 0x2106, 0x2106, 0x2106, 0x2106, 0x18C4, 
-0x18C4, 0x2106, 0x2106, 0x0841, 0xB44F, 0xEDB4, 0xCCF1, 0x0020, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0x1083, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x20E5, 0x10A4, 0x18E5, 0x18A4, 0x7B0B, 0xCCF1, 0xEDB4, 0xCCF1, 0x0841, 0x28E4, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x6207, 0x1083, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x20E5, 0x1083, 0x18C5, 0x1062, 0x3124, 0xBCB0, 0xEDB4, 0x3124, 0x18E5, 0x18A4, 0x6207, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 
-0x59E6, 0x18C4, 0x2106, 0x2106, 0x2106, 0x49A8, 0xA34C, 0x6229, 0x2106, 0x20E5, 0x18A2, 0x20C2, 0x1083, 0x2106, 0x18A4, 0x6207, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7247, 0x20E4, 0x2106, 0x2106, 0x49A8, 0xBBAD, 0xBBAD, 0x6A49, 0x2926, 0x3167, 0x3167, 0xA34C, 0x0020, 0x18A2, 
-0x18A2, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x3946, 0x49A8, 0xBBAD, 0xC42F, 0xC40E, 0x59E6, 0x7248, 0xBBAD, 0xBBAD, 0xBBAD, 
-0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x9B6C, 0xCC6F, 0xCC90, 0xEDB4, 0xC470, 0x59E6, 0x8ACA, 0xBBAD, 
-0xBBAD, 0xCC4F, 0x5A07, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xB44F, 0xEDB4, 0xEDB4, 0xE573, 0x82EA, 0x59E6, 
-0xBBAD, 0xBBAD, 0xBBAD, 0xE573, 0xCCF1, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xB44F, 0xEDB4, 0xEDB4, 0xDD32, 
-0x7248, 0x59E6, 0xBBAD, 0xBBAD, 0xD4B0, 0xE593, 0xCCF1, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xB44F, 0xEDB4, 
-0xE593, 0xA36C, 0x4985, 0x6206, 0x8289, 0xBBAD, 0xDD32, 0xEDB4, 0xCCF1, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 
-0xB44F, 0xEDB4, 0xE573, 0x8ACA, 0x1061, 0x61E6, 0xAB6C, 0xDD12, 0xE593, 0xEDB4, 0x3944, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6207, 0x93AD, 0xEDB4, 0xEDB4, 0xDD32, 0x8AEA, 0x62EA, 0xDE77, 0xE5F5, 0xEDF5, 0xCCF1, 0x3944, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBCC, 0x6A88, 0xB594, 0xEE77, 0xEDF5, 0xABEE, 0x39A6, 0xDE77, 0xDE77, 0xDE98, 0xEF3A, 0x41E7, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x7BAD, 0xF75B, 0xF75B, 0xDE98, 0xC5B4, 0x39A6, 0xDE77, 0xDE77, 0xEF1A, 0xA512, 0x6AA9, 0xBBCC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x7BAD, 0xF75B, 0xF75B, 0xDE98, 0x734C, 0x8C0F, 0xDE77, 0xE6B8, 0xEF3A, 0x41E7, 
-0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x7BAD, 0xF75B, 0xF75B, 0xDE98, 0x20E3, 0xDE77, 0xDE77, 0xE6F9, 
-0x9CB1, 0x82EA, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x7BAD, 0xF75B, 0xF75B, 0xDE98, 0x20E3, 0xDE77, 
-0xE6B8, 0xEF3A, 0x5ACA, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x6247, 0xAD13, 0xF75B, 0xDE98, 
-0x20E3, 0xDE77, 0xE6D9, 0x8C2F, 0x7AC9, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x9CB1, 
-0xF75B, 0xDE98, 0x20E3, 0xE6B8, 0xE6F9, 0x7B8D, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6207, 0x9CB1, 0xF75B, 0xDE98, 0x20E3, 0xE6B8, 0x9CB1, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6207, 0x9CB1, 0xF75B, 0xDE98, 0x20E3, 0xC5D5, 0x62EA, 0x4164, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x9CB1, 0xF75B, 0x8C2F, 0x20E3, 0x5A89, 0x0861, 0x0841, 0x4164, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x4A48, 0x736C, 0x3164, 0x20E3, 0x1081, 0x0841, 0x0861, 0x0841, 0x3123, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x18A2, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x1082, 0x0020, 
-0x0020, 0x0841, 0x28E3, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x18A2, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 
-0x20E3, 0x20C3, 0x20C3, 0x0841, 0x0841, 0x0841, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_right_5.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_right_5_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x3123, 0x3123, 0x3123, 0x3123, 
-0x3123, 0x3123, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x18A2, 0x18A2, 0x59E6, 0x7247, 0x8BAA, 0xC54F, 0xC54F, 
-0xC54F, 0xC54F, 0xC54F, 0xC54F, 0x5226, 0x18A2, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3984, 0xE5F1, 0xE5F1, 0x9C0B, 0x8BCA, 0xF712, 
-0xFF13, 0xF6F2, 0xDDD0, 0xD5B0, 0xB4CF, 0xB4CF, 0xB4AE, 0xD5B0, 0x39A4, 0x3984, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x3964, 0xE5F1, 0xE5F1, 0xE5F1, 0xD590, 
-0xC550, 0xDE52, 0xF6D2, 0xDDD0, 0xB4AE, 0xCD90, 0xE611, 0xCD50, 0xBCCF, 0xDDB0, 0xF6F2, 0xDE30, 0x51E6, 0xA34B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xC54F, 0xDDF1, 0xCD70, 
-0xCD70, 0xCD70, 0x9CD0, 0x94F1, 0xCD70, 0xB4AE, 0xD5B0, 0xFF13, 0xCD8F, 0x832B, 0xA40E, 0xDDD0, 0xEE92, 0xEE92, 0xC54F, 0x5206, 
-0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xC54F, 
-0xDDD0, 0xB4AE, 0xA42E, 0x8B6C, 0x630D, 0x53AF, 0x8470, 0xC530, 0xEE92, 0xE671, 0x83AA, 0x72EA, 0xC491, 0xA40E, 0xDDD0, 0xE5F1, 
-0xDDD0, 0x9C0C, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x3103, 0xC54F, 0xC50F, 0xA42E, 0x7AEB, 0x7AEB, 0x526B, 0x29EB, 0x5BD0, 0xD5D1, 0xE5F1, 0xB4CD, 0x6AA8, 0xBCB0, 0xEDB4, 0x832D, 
-0xB4CF, 0xDDF1, 0xC50F, 0x838B, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3103, 0xC54F, 0xB4AE, 0x9C0D, 0x51E9, 0x5A8A, 0x4ACC, 0x324C, 0x5AED, 0xD5B0, 0xDDF1, 0x93EB, 0x49A6, 0xCC6F, 
-0xCC6F, 0xC491, 0x832C, 0xC50F, 0x93CC, 0x5A47, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xC54F, 0xB4AE, 0x9C0D, 0x51C8, 0x2946, 0x3AAD, 0x842F, 0x72CC, 0xD590, 0xDDD0, 0x838B, 
-0x1882, 0x3103, 0x3103, 0xA36C, 0x6A6B, 0xB4AE, 0x838B, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x3944, 0xD5B0, 0x9C0D, 0x51C8, 0x39E8, 0x842F, 0xAC8E, 0x7AEB, 0xAC8E, 
-0xBCCF, 0x838B, 0x2105, 0x5A2B, 0x5968, 0x9B0B, 0x6A6B, 0x9C0C, 0x49A5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xDDD0, 0xB4AE, 0x93CD, 0x51C8, 0x6AA9, 0xB4AE, 
-0x832C, 0x9C0D, 0xB4AE, 0x838B, 0x5A8A, 0xACB3, 0x9A8C, 0xDCF2, 0xC42F, 0x3944, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xDDD0, 0xAC8E, 0x834C, 0x51C8, 
-0x6268, 0xAC4E, 0xB4AE, 0x7ACB, 0x9C0D, 0x838B, 0x4985, 0xD554, 0xA3D0, 0xD4F2, 0xEDB4, 0xCCF1, 0x3123, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x5226, 0xCD70, 0x9C0D, 
-0x5A09, 0x51C7, 0x72AA, 0x8B6C, 0xAC8E, 0xBBCD, 0x82EB, 0x938C, 0x938C, 0xDD12, 0xDD32, 0xEDB4, 0xEDB4, 0xCCF1, 0x3123, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xC54F, 
-0xAC6E, 0x832C, 0x51C8, 0x5A47, 0xB4AE, 0x832C, 0x832C, 0xB3AD, 0xB38D, 0xA3AE, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xCCF1, 
-0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x4985, 
-0x8B8A, 0xBCCE, 0xAC4E, 0x5A09, 0x5A28, 0x93AC, 0x9BED, 0x6A8B, 0x624A, 0xCCB0, 0xBBAD, 0xC42F, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 
-0xEDB4, 0x5A07, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x3123, 
-0x6AC8, 0xAC8C, 0xBCCE, 0xB4AE, 0x72AB, 0x51C7, 0xA42D, 0x9C0D, 0x6A8B, 0x624A, 0x624A, 0xDD53, 0xBBAD, 0xBBCD, 0xD4B0, 0xEDB4, 
-0xEDB4, 0xEDB4, 0xEDB4, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x3944, 0x6249, 0xA42D, 0xBCEF, 0x8B6C, 0x7AEB, 0x4165, 0x9BEC, 0x9C0D, 0x6A8B, 0x624A, 0x624A, 0x2904, 0xCCF1, 0xDD12, 0xBBAD, 
-0x930A, 0x3985, 0x3985, 0x3985, 0x3985, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x18A2, 0x6A6B, 0x41A6, 0x18A2, 0x1082, 0x1061, 0xA42D, 0x9C0D, 0x6A6B, 0x624A, 0x624A, 0x624A, 0x18A3, 0xC594, 
-0xDE57, 0xA490, 0x4985, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x18A2, 0x7247, 0xC40D, 0xAB8C, 0x3123, 0xAC4E, 0x624A, 0x624A, 0x624A, 0x624A, 0x28E4, 
-0x5185, 0x7207, 0x7A89, 0x6A28, 0x49C6, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0xC40D, 0xC40D, 0xAB8C, 0x49A5, 0xAC4D, 0x93CD, 0x624A, 0x624A, 0x624A, 
-0x624A, 0x28E4, 0x5185, 0x82CA, 0xDE77, 0xDE77, 0x9C70, 0x6268, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x7A88, 0x7A88, 0x5A47, 0x93CC, 0x9BED, 0x624A, 0x6A8B, 
-0x832C, 0x7ACB, 0x624A, 0x28E4, 0x5185, 0xD5F5, 0xDE77, 0xDE77, 0xDE77, 0x83AD, 0x59C6, 0x7A88, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9C0D, 0x5A67, 0x5A67, 0x93CC, 0x93CD, 0x6A6B, 
-0x6A6B, 0x93AD, 0xA42E, 0x7B0C, 0x624A, 0x28E4, 0x5185, 0xD5F5, 0xDE77, 0xDE77, 0xDE77, 0xC553, 0x6248, 0x3903, 0x59E6, 0x7247, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x62A8, 0xB4AE, 0xB4AE, 0x93CD, 
-0x6A8B, 0x624A, 0x9BED, 0xA42E, 0x7AEB, 0x624A, 0x624A, 0x28E4, 0x5185, 0x9C2F, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 0x9BAD, 0x7207, 
-0x4965, 0x4965, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA8, 0x3144, 
-0x72E9, 0xA42E, 0x9C0D, 0x9C0D, 0xAC6E, 0x72CB, 0x624A, 0x624A, 0x624A, 0x28E4, 0x5185, 0x7268, 0xA470, 0xDE77, 0xDE77, 0xDE77, 
-0x9BAD, 0x7207, 0x7207, 0x61C6, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x6227, 0x18A2, 0x18A2, 0x9C0D, 0x6A8B, 0x624A, 0x624A, 0x624A, 0x3946, 0x0841, 0x5185, 0x7207, 0x93CE, 0xDE77, 
-0xDE77, 0xDE77, 0x9BAD, 0x7207, 0x7207, 0x61C6, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0xAB8C, 0xAB8C, 0x3123, 0x624A, 0x624A, 0x4187, 0x1061, 0x6B0B, 0x4A07, 0x5185, 0x7207, 
-0x7268, 0xAC91, 0xDE77, 0xDE77, 0xD636, 0x61E8, 0x69E7, 0x61C6, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x18A2, 0x59C6, 0x7A88, 0x734C, 0xA491, 
-0x20E3, 0x59A6, 0x7228, 0x9C2F, 0xDE77, 0xDE77, 0xDE77, 0x6229, 0x38A4, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x6227, 
-0x8C0F, 0xA491, 0x20E3, 0x30A4, 0x61E7, 0x93AE, 0xCDF5, 0xDE77, 0xDE77, 0x832D, 0x4946, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7A88, 0x5289, 0xCDF5, 0x9C2F, 0x4A07, 0x28A3, 0x38C4, 0x6A08, 0xAC91, 0xDE77, 0xDE77, 0xDE77, 0x7A89, 0x18A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7A88, 0x5289, 0xB4F2, 0x8B6D, 0x8B6D, 0x1082, 0x38A4, 0x4966, 0xAC91, 0xDE77, 0xDE77, 0xDE77, 0xAC90, 0x18A2, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x6AA9, 0xA4D2, 0xB4F2, 0x8B6D, 0x41C6, 0x4965, 0x38A4, 0x40E5, 0x72CB, 0xC594, 0xDE77, 0xDE77, 
-0xDE77, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5289, 0xCDB5, 0x93CE, 0x8B6D, 0x20E3, 0x61C6, 0x61A6, 0x61A6, 0x7269, 0xB4F2, 
-0xDE77, 0xDE77, 0xDE77, 0xA4B1, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5289, 0xBD53, 0x8B6D, 0x3986, 0x59A6, 0x7207, 0x7207, 0x7207, 
-0x7227, 0x830B, 0xC594, 0xDE77, 0xDE77, 0x836C, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5289, 0xBD53, 0x41C6, 0x18A4, 0x59C7, 0x7207, 
-0x7207, 0x7207, 0x7207, 0x7AAA, 0x8B6D, 0xC5B5, 0x93CE, 0x730B, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x39A6, 0xBD53, 0x832C, 0x41A6, 0x18C4, 
-0x2106, 0x59C7, 0x61E7, 0x7207, 0x7207, 0x69E7, 0x72AA, 0x8B6D, 0x93CE, 0xDE77, 0xA4F2, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3185, 0xACD1, 0x5228, 
-0x1083, 0x2106, 0x2106, 0x2106, 0x2905, 0x59C7, 0x59C7, 0x4166, 0x2106, 0x6ACB, 0xD616, 0xDE77, 0xA4F2, 0x3123, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3144, 
-0x8BCE, 0x3986, 0x18C4, 0x2106, 0x2106, 0x2106, 0x1083, 0x20E5, 0x2106, 0x2106, 0x2106, 0x5229, 0xB4F2, 0xDE77, 0xC553, 0x5207, 
-0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x39A6, 0x8C0F, 0x1062, 0x2106, 0x2106, 0x2106, 0x2106, 0x18C4, 0x18A4, 0x2106, 0x2106, 0x2106, 0x2106, 0x49E8, 0x838D, 
-0xEDB4, 0xB44F, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x3985, 0x9C0F, 0x18C5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x1083, 0x18E5, 0x2106, 0x2106, 0x2106, 
-0x18E5, 0x20C2, 0xEDB4, 0xDD53, 0x72A9, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3985, 0x9BEF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x1083, 0x18C4, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x20C2, 0xEDB4, 0xEDB4, 0x938C, 0x18A2, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3985, 0x9BEF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18E5, 
-0x1083, 0x18C5, 0x2106, 0x2106, 0x2106, 0x20C2, 0xEDB4, 0xEDB4, 0x938C, 0x1083, 0x18A3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3985, 0x938C, 0x1062, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x20E5, 0x1083, 0x1083, 0x18E5, 0x2106, 0x0841, 0xCCF1, 0xEDB4, 0xDD53, 0x832B, 0x1083, 0x18A3, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3965, 0x832B, 0x1062, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x18C5, 0x18A4, 0x2906, 0x2106, 0x0841, 0x20E3, 0xCCF1, 0xA3EE, 0x1041, 0x18A2, 0x8AC9, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x3103, 0x3124, 
-0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x49A8, 0x3125, 0x59E6, 0x6A49, 0x49A8, 0x2926, 0x20E5, 0x0841, 0x1041, 0x7247, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x3124, 0x4187, 0x5A09, 0x5A09, 0x6229, 0xBBAD, 0x7248, 0x59E6, 0xBBAD, 0xBBAD, 0x6229, 0x5A09, 0x59E8, 0x4985, 
-0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x82EA, 0xD4B0, 0xBBCD, 0xBBAD, 0xA32B, 0x61E6, 0x6206, 0x9B0A, 0xBBAD, 0xBBAD, 0xBBAD, 
-0xBBAD, 0x8ACA, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x938C, 0xEDB4, 0xDD12, 0xD4D1, 0x8ACA, 0x4985, 0xA34B, 0x6206, 0xA32B, 
-0xBBAD, 0xBBAD, 0xC40E, 0xA3AD, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x938C, 0xEDB4, 0xEDB4, 0xDD32, 0x4985, 0xAB8C, 0xC40D, 
-0x4985, 0x8ACA, 0xBBAD, 0xBBCD, 0xE553, 0xDD53, 0x8B6C, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x72C9, 0xDD53, 0xEDB4, 0xEDB4, 0xCCF1, 0x3123, 
-0xC40D, 0xC40D, 0xBBCC, 0x3103, 0xA32B, 0xC3EE, 0xEDB4, 0xEDB4, 0x938C, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x7AC9, 0x834C, 0xEDB4, 0xEDB4, 0xEDB4, 
-0xB44F, 0x4144, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xA32B, 0xE573, 0xEDB4, 0xEDB4, 0x938C, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x5ACA, 0xEEB8, 0xEDD5, 
-0xE553, 0xBC90, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xABAD, 0xC3EE, 0xEDB4, 0xDD53, 0x72CA, 0x7A88, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x6247, 0x8C2F, 
-0xF75B, 0xEE77, 0xC44F, 0x1882, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x5207, 0xD616, 0xCC90, 0xDDB4, 0x936C, 0x7247, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 
-0x5ACA, 0xF75B, 0xF75B, 0xEF3A, 0x8B6C, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xA4D2, 0xDE77, 0xE698, 0xB594, 0x3123, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x5ACA, 0xF75B, 0xF75B, 0xE6D9, 0x39A6, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xA4D2, 0xDE77, 0xEEF9, 
-0xB594, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5ACA, 0xF75B, 0xF75B, 0xE6D9, 0x39A6, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xA4D2, 
-0xDE77, 0xE6F9, 0x732B, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5ACA, 0xF75B, 0xEF1A, 0x83AD, 0x7AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x4985, 0xA4D2, 0xEF1A, 0xD678, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5ACA, 0xF75B, 0xE6F9, 0x5289, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x4985, 0xA4D2, 0xEF3A, 0xD678, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5ACA, 0xEF1A, 0x734C, 0x7A88, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6207, 0x8C0F, 0xDE98, 0xEF3A, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AC9, 0x8C2F, 0xEF1A, 0x734C, 0x7A88, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x8C0F, 0xEF3A, 0xC616, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x41E7, 0xF75B, 0xEF1A, 
-0x734C, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x5A89, 0x9C91, 0x18C3, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x41E7, 
-0xF75B, 0xEF1A, 0x734C, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4164, 0x0841, 0x0861, 0x0861, 0x1061, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x41E7, 0xF75B, 0xC5F6, 0x4A27, 0x4185, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0840, 0x0861, 0x0861, 0x0861, 0x0841, 
-0x20A2, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x18A2, 0x736C, 0x5A89, 0x20E3, 0x18C2, 0x3924, 0xBBCC, 0xC40D, 0xC40D, 0x7A88, 0x0840, 0x0861, 0x0861, 
-0x0861, 0x0861, 0x0841, 0x1061, 0x4985, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0841, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20C2, 0x3924, 0x3123, 0x59C6, 0xAB8C, 0x49A5, 
-0x0020, 0x0020, 0x0020, 0x0861, 0x0861, 0x0841, 0x0841, 0x20A2, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0841, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20C3, 0x20C3, 0x18A2, 
-0x59E6, 0xBBCC, 0xAB8C, 0xAB8C, 0xAB8C, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_right_6.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_right_6_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 
-0x18A2, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x0020, 0x18A2, 0x930A, 0x3984, 0xE5F1, 0xE5F1, 0xE5F1, 
-0xE5F1, 0xE5F1, 0xE5F1, 0xE5F1, 0x0020, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x51C5, 0xC54F, 0xE5F1, 0xC52F, 0x4A05, 0xF712, 0xFF13, 
-0xF712, 0xEE71, 0xDDD0, 0xC52F, 0xB4CF, 0xB4CF, 0xBCCF, 0xC52F, 0x2102, 0x49C5, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xAC8C, 0xE5F1, 0xE5F1, 0xDDD0, 0xBD0F, 
-0xCDD1, 0xF6D2, 0xE631, 0xC52F, 0xBCEF, 0xDE11, 0xDDD0, 0xC52F, 0xC52F, 0xE631, 0xFF13, 0xACCD, 0x6A67, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x6AA8, 0xBCEE, 0xE5F1, 0xCD70, 
-0xCD70, 0xB530, 0x7471, 0xBD70, 0xC50F, 0xBD0F, 0xE671, 0xFF13, 0x838A, 0x8B4D, 0xBCCF, 0xE611, 0xEEB2, 0xEE71, 0xAC8C, 0x6A67, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xAC8C, 0xE5F1, 
-0xCD70, 0xB4AE, 0xAC6E, 0x7B4C, 0x4B0E, 0x7450, 0xACD0, 0xDDF1, 0xEE92, 0xDE11, 0x18C2, 0xCCF1, 0xA40F, 0xAC4E, 0xE5F1, 0xE5F1, 
-0xDDB0, 0x62A8, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 
-0xAC8C, 0xCD70, 0xB4AE, 0xB4AE, 0x834C, 0x520A, 0x2189, 0x4B4E, 0xA511, 0xE5F1, 0xE5F1, 0x7B49, 0x72CA, 0xDD53, 0xDD33, 0x72AB, 
-0xCD70, 0xDDB0, 0xC50F, 0x5A67, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0xAC8C, 0xBCEF, 0xB4AE, 0x832C, 0x626B, 0x52CD, 0x29AA, 0x52ED, 0xA46F, 0xE5F1, 0xCD70, 0x3164, 0xB3CD, 0xCC6F, 
-0xC44F, 0xB450, 0x93AD, 0xBCEF, 0x838B, 0x6227, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4985, 0xAC8C, 0xBCEF, 0xB4AE, 0x624A, 0x3946, 0x324C, 0x63AF, 0x8BAD, 0xA42D, 0xE5F1, 0xC52F, 0x3143, 
-0x3103, 0x3103, 0x4164, 0xBBEE, 0x7ACB, 0xB4AE, 0x72E9, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x3123, 0xB4CD, 0xBCCF, 0x624A, 0x3145, 0x6BEF, 0xAC8F, 0x93CD, 0x8B8C, 0xBCCF, 
-0xB4AE, 0x3143, 0x526C, 0x59A9, 0x61A8, 0xAB6C, 0x7ACB, 0x7B2A, 0x49A5, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xAC8C, 0xBCCF, 0xB4AE, 0x5A09, 0x49C6, 0xB4AE, 0x93CD, 
-0x8B6C, 0xB4AE, 0xB4AE, 0x3143, 0xCE79, 0x726B, 0xBAED, 0xE573, 0x8ACA, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xC54F, 0xB4AE, 0x5A09, 0x49A6, 
-0xAC8E, 0xB4AE, 0x938C, 0x8B6C, 0xAC8E, 0x3143, 0xAB6C, 0xE679, 0x82AC, 0xEDB4, 0xEDB4, 0x938C, 0x4985, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x51E6, 0xCD4F, 0x9C0D, 
-0x5A09, 0x3925, 0x72AB, 0xA42E, 0xB42E, 0x9B2C, 0x93AD, 0x5227, 0xDD53, 0xCC4F, 0xEDB4, 0xEDB4, 0xEDB4, 0x938C, 0x4985, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x6AA8, 0xAC6D, 
-0xB4AE, 0x624A, 0x51E8, 0x5A28, 0x624A, 0x7AEB, 0xABAD, 0xBBAD, 0x9B2C, 0xCCF2, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0x938C, 
-0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x6A87, 
-0xAC6D, 0xBCEF, 0x9BED, 0x624A, 0x3945, 0x9C0D, 0x624A, 0x624A, 0x9B4D, 0xC40E, 0xBBAD, 0xDD32, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 
-0xCCF1, 0x72A9, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 
-0x49A6, 0x93CC, 0xBCCF, 0x93CD, 0x6A6B, 0x3125, 0x7AEA, 0x9C0D, 0x624A, 0x624A, 0xA3EF, 0xD4B0, 0xBBAD, 0xCC6F, 0xE593, 0xEDB4, 
-0xEDB4, 0xEDB4, 0xB44F, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x4186, 0x6A8A, 0x8B6C, 0x832C, 0x3986, 0x28E4, 0x72E9, 0xAC6E, 0x7B0C, 0x624A, 0x49C8, 0x8B4C, 0xE553, 0xC42F, 0xBBAD, 
-0x6248, 0x5A27, 0x5A27, 0x5A27, 0x7289, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7A88, 0x3125, 0x6A8B, 0x4166, 0x18A3, 0x7268, 0x18A2, 0xB4AE, 0xAC4E, 0x624A, 0x624A, 0x4166, 0x732B, 0xE637, 
-0xD5D5, 0x5A28, 0x7A88, 0x930A, 0x930A, 0x930A, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x3125, 0x3946, 0x7268, 0xAB8C, 0x3103, 0x838B, 0xB4AE, 0x6A8B, 0x624A, 0x49C8, 0x28C3, 
-0x7228, 0x7A89, 0x7A89, 0x20E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0841, 0x59E6, 0xBBCC, 0x4144, 0x8B6B, 0xB4AE, 0x6A8B, 0x624A, 0x624A, 
-0x49C8, 0x28C3, 0x7207, 0x7207, 0xAC90, 0xCDD5, 0x3965, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0xAB8C, 0xAB8C, 0x49A5, 0x838B, 0xAC4E, 0x6A8B, 0x624A, 
-0x624A, 0x624A, 0x49C8, 0x28C3, 0x7A48, 0xAC90, 0xDE77, 0xDE77, 0xDE77, 0x2924, 0xAB8C, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2A, 0x3143, 0x3143, 0x838B, 0xA42E, 0x72AB, 
-0x624A, 0x7ACB, 0x624A, 0x624A, 0x49C8, 0x28C3, 0xA42F, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 0x7A89, 0x2082, 0x3903, 0x930A, 0xA34B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x838B, 0xB4AE, 0xA42E, 0x93CD, 
-0x72AB, 0x624A, 0x7B0C, 0xB4AE, 0x624A, 0x624A, 0x49C8, 0x28C3, 0xA42F, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 0xA3EE, 0x7207, 0x69E6, 
-0x28C3, 0x5185, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A47, 0x93CC, 
-0x9BED, 0x6A8B, 0x624A, 0x7B0C, 0xAC8E, 0x93CD, 0x624A, 0x624A, 0x49C8, 0x28C3, 0x93AD, 0xCDF5, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 
-0x7207, 0x7207, 0x7207, 0x4944, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA34B, 0x6227, 0x5A67, 0x7B0A, 0x8B6C, 0xAC4E, 0x938D, 0x624A, 0x624A, 0x5A09, 0x28E4, 0x28C3, 0x7AAA, 0xB4F2, 0xDE77, 0xDE77, 
-0xDE77, 0xDE77, 0x7207, 0x7207, 0x7207, 0x4944, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x7A88, 0x5A47, 0x41C5, 0x72EA, 0x6A6B, 0x624A, 0x5A2A, 0x49E8, 0x62EA, 0x28C3, 0x7248, 0x938D, 
-0xCDB5, 0xDE77, 0xDE77, 0xDE77, 0x4925, 0x5145, 0x7207, 0x4944, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x930A, 0x3944, 0x18A3, 0x18A3, 0x20E3, 0xB553, 0xC574, 0x5207, 
-0x4944, 0x7AAA, 0xBD53, 0xDE77, 0xDE77, 0xDE77, 0x38A4, 0x38C4, 0x38E4, 0x4164, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0xAB8C, 0xAB8C, 0x20E3, 0xCDB5, 
-0x93CE, 0x5228, 0x2082, 0x6229, 0xBD53, 0xDE77, 0xDE77, 0xDE77, 0x61A6, 0x38A4, 0x2883, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x20E3, 0xCDB5, 0x8B6D, 0x832C, 0x41A6, 0x49C7, 0xBD53, 0xDE77, 0xDE77, 0xDE77, 0xC553, 0x69E7, 0x4965, 0x4985, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x0020, 0xDE77, 0xC594, 0x8B6D, 0x832C, 0x41A6, 0x2083, 0x6A6A, 0xC5B5, 0xDE77, 0xDE77, 0xCDF5, 0x7207, 0x5185, 0x4985, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x0020, 0xD616, 0x8B6D, 0x832C, 0x41A6, 0x4944, 0x5986, 0x728A, 0xC5B5, 0xDE77, 0xDE77, 0xCDF5, 0x8B2B, 
-0x5185, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x5289, 0xD616, 0x8B6D, 0x62AA, 0x28C3, 0x7207, 0x7207, 0x7A89, 0xACB1, 0xDE57, 0xDE77, 
-0xDE77, 0xCDF5, 0x5185, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xDE77, 0xBD33, 0x730B, 0x5207, 0x4944, 0x7207, 0x7207, 0x7207, 0x830B, 
-0xD616, 0xDE77, 0xDE77, 0xD636, 0x72A9, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xDE77, 0x832C, 0x3986, 0x28E4, 0x7207, 0x7207, 0x7207, 
-0x7207, 0x7A89, 0xACB1, 0xDE57, 0xDE77, 0xDE57, 0x83CE, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x8BEE, 0xDE77, 0x3124, 0x18C4, 0x2926, 0x51A7, 
-0x7207, 0x7207, 0x7207, 0x7207, 0x834C, 0xA470, 0xDE57, 0xA470, 0x62AA, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x8BCE, 0x9C2F, 0x0841, 0x2106, 
-0x2106, 0x2926, 0x3146, 0x51A7, 0x7207, 0x7207, 0x7268, 0x834C, 0x9C0F, 0x8BAD, 0xBD74, 0x8BCD, 0x6207, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xB553, 0x1082, 
-0x20E5, 0x2106, 0x2106, 0x2106, 0x18C5, 0x20E5, 0x2926, 0x2926, 0x2926, 0x3167, 0x93CE, 0xD616, 0xDE77, 0x8C0F, 0x4985, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4144, 0xA4B1, 
-0xDE77, 0x0020, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18C5, 0x18E5, 0x2106, 0x2106, 0x2106, 0x39A8, 0x9C2F, 0xDE77, 0x8C0F, 
-0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x3103, 0xB44F, 0x20C2, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18C5, 0x1083, 0x18E5, 0x2106, 0x2106, 0x2106, 0x39C8, 
-0xD5D5, 0xEDB4, 0x938C, 0x59C6, 0xAB8C, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3103, 0xB44F, 0x20C2, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18C5, 0x1083, 0x18E5, 0x20E5, 
-0x2106, 0x20E5, 0x3985, 0xEDB4, 0xA3EE, 0x20C2, 0x0821, 0x0821, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xB44F, 0x20C2, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18C5, 
-0x1083, 0x1083, 0x2106, 0x20E5, 0x3985, 0xEDB4, 0xEDB4, 0x72EA, 0x18A4, 0x1062, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xB44F, 0x6A89, 0x18A4, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x4987, 0x51A7, 0x2106, 0x2105, 0x72EA, 0xEDB4, 0xEDB4, 0x72EA, 0x1062, 0x3945, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x72A9, 0x72EA, 0x0020, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x51E8, 0x2905, 0x51A6, 0xAB6C, 0x6208, 0x1061, 0x938C, 0xEDB4, 0xBCB0, 0x3985, 0x4144, 0xA34B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x7A88, 0x0020, 0x1083, 0x2106, 
-0x2106, 0x2106, 0x51E8, 0x82AA, 0x6207, 0x7A88, 0x7A88, 0x4965, 0xAB6C, 0x7248, 0x6207, 0x5A27, 0x6A68, 0x3924, 0x7A88, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 
-0x1061, 0x930B, 0x930B, 0x930B, 0xA34C, 0xBBAD, 0x4965, 0x930A, 0xC40D, 0x930A, 0x3944, 0xBBAD, 0xAB6C, 0x8ACA, 0xA32B, 0xB3EE, 
-0x7289, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x20C2, 0xE573, 0xE573, 0xE573, 0xCC90, 0xBBAD, 0x4965, 0x930A, 0xC40D, 0xC40D, 0x930A, 0x3103, 0xBBAD, 0xBBAD, 
-0xCC4F, 0xE593, 0x5A27, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20C2, 0xEDB4, 0xEDB4, 0xEDB4, 0xE593, 0x7B0A, 0x7A88, 0xBBCC, 0xC40D, 0xC40D, 0xAB8C, 0x1882, 
-0xBBAD, 0xCC4F, 0xE593, 0xEDB4, 0xDD53, 0x5A07, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20C2, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0x72EA, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x3103, 0xCC6F, 0xEDB4, 0xEDB4, 0xEDB4, 0x5A27, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x5A27, 0xEDB4, 0xEDB4, 0xEDB4, 0xCCF1, 0x72A9, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3103, 0xCC4F, 0xE553, 0xEDB4, 0xCCF1, 0x5207, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0xEE16, 0xEDB4, 0xEDB4, 0xEDB4, 0x72EA, 0x6207, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x5A48, 0xC42F, 0xCC4F, 0xE573, 0x5A27, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x5ACA, 0xF73A, 0xEE16, 0xE573, 0xC470, 
-0x7289, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x20E3, 0xDE77, 0xD5D5, 0xCD12, 0xB44F, 0x6A88, 0x930A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xF75B, 0xF75B, 0xEF1A, 
-0xDD73, 0x7248, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x20E3, 0xDE77, 0xE6D9, 0xF75B, 0x7BAD, 0x7A88, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xF75B, 
-0xF75B, 0xEF1A, 0xB512, 0x61E6, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x20E3, 0xDE77, 0xE6D9, 0xF75B, 0x7BAD, 
-0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A2, 0xF75B, 0xF75B, 0xE6B8, 0xA4F2, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x20E3, 0xE6B8, 0xEF3A, 
-0xB594, 0x6A88, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x18A2, 0xF75B, 0xEF3A, 0xB553, 0x5207, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x20E3, 
-0xE6B8, 0xF75B, 0x9CB1, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xF75B, 0xEF3A, 0xA4F2, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x20E3, 0xE6B8, 0xF75B, 0x9CB1, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xF75B, 0xEF1A, 0xA4B1, 0x4144, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x20E3, 0xE6B8, 0x9CB1, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x39A6, 0xF75B, 0xC5B4, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x20E3, 0xD657, 0x6B4C, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xD678, 0xF75B, 0xC5B4, 0x3123, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x5289, 0x83CE, 0x0841, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xD678, 0xF75B, 0xC5B4, 0x3123, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1081, 0x83CE, 0x0861, 0x0841, 0x3124, 0x7A88, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xD678, 0xF75B, 
-0xC5B4, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 
-0x4164, 0x6207, 0x6207, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 
-0xD678, 0xF75B, 0x5AA9, 0x20A2, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x0861, 0x0861, 0x0861, 
-0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x3103, 0x5269, 0x5A89, 0x20E3, 0x20E3, 0x20C2, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x0861, 
-0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x3103, 0x20C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2903, 0x3123, 0x3123, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 
-0x8AC9, 0x0020, 0x0020, 0x0020, 0x3123, 0x930A, 0x930A, 0x930A, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x20C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20C3, 0x20C3, 0x18A2, 0xA34B, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0xAB8C, 0xAB8C, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_right_7.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_right_7_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0xAB8C, 0xAB8C, 0xC40D, 0x930A, 0x20C2, 0x20C2, 0x20C2, 
-0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x7AA8, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x51E6, 0x3984, 0x3984, 0x930A, 0x5A87, 0xE651, 
-0xE651, 0xE631, 0xE5F1, 0xDDF1, 0xD5B0, 0xD5B0, 0x62A8, 0x3964, 0x7AA8, 0x930A, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x6AA8, 0xBCEE, 0xE5F1, 0xE5F1, 0x41C5, 
-0xF6D2, 0xFF13, 0xF6F2, 0xE651, 0xCD70, 0xCD50, 0xC52F, 0xC52F, 0xBCCF, 0xD5B0, 0x8BCA, 0x5AA7, 0x7AC9, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xAC8C, 0xE5F1, 0xE5F1, 
-0xE5F1, 0xC52F, 0xBD91, 0xEEB2, 0xE651, 0xCD4F, 0xBCEF, 0xDDF1, 0xDDF1, 0xBCEF, 0xC50F, 0xDDB0, 0xF6D2, 0xFF13, 0x6AC7, 0x7A88, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xAC8C, 
-0xE5F1, 0xCD70, 0xCD50, 0xCD50, 0x6C51, 0xA531, 0xC52F, 0xBCEF, 0xE651, 0xFF13, 0xACAD, 0x8B6C, 0xA40E, 0xD590, 0xEE71, 0xEE92, 
-0xE611, 0x7308, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 
-0x6AC8, 0xC52F, 0xCD4F, 0xB4AE, 0xB4AE, 0x832C, 0x3A6C, 0x6C51, 0x9CB0, 0xD590, 0xEE71, 0xDE11, 0x6AC8, 0x938C, 0xCCD1, 0x93AD, 
-0xD590, 0xE5F1, 0xE5F1, 0xC52F, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0x8BCA, 0xE5F1, 0xBCEF, 0xB4AE, 0x832C, 0x624A, 0x2149, 0x320B, 0x84B1, 0xE5F1, 0xE5F1, 0xA44C, 0x72C9, 0xDD53, 
-0xEDB4, 0x832D, 0xA44E, 0xDDD0, 0xC52F, 0xB4AE, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4985, 0x8BCA, 0xC50F, 0xB4AE, 0x7AEB, 0x624A, 0x63F0, 0x218A, 0x5B8F, 0x836D, 0xE5F1, 0xD590, 0x7309, 
-0x6207, 0xC3EE, 0xC3EE, 0xDD12, 0x830C, 0xAC8E, 0xB4AE, 0x18A2, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x8BCA, 0xBCEF, 0xB4AE, 0x6A8B, 0x3925, 0x2189, 0x63F0, 0x9C4E, 0x832C, 0xE5F1, 
-0xCD70, 0x72E9, 0x1041, 0x1882, 0x1882, 0x9B2B, 0x7ACB, 0xAC4E, 0xB4AE, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x8BAA, 0xC52F, 0xB4AE, 0x6A8B, 0x3104, 0x6C51, 0xB4AE, 0xAC4E, 
-0x7ACB, 0xB4AE, 0xB4AE, 0x72E9, 0x39E9, 0x6A8C, 0x69A9, 0xAB6D, 0x82CB, 0x93CC, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xAC8C, 0xBCEF, 0x6A8B, 0x3945, 0x93AC, 
-0xB4AE, 0xAC4E, 0x832C, 0xA42E, 0xB4AE, 0x72E9, 0x734C, 0xA411, 0x9ACD, 0xD4D2, 0xCC90, 0x49A6, 0x932A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0xAC8C, 0xC52F, 0x830C, 
-0x6A6B, 0x28C3, 0x9C0D, 0xB4AE, 0xA42E, 0x82EB, 0xA42E, 0x72E9, 0x6227, 0xDDD6, 0xA3D0, 0xD4F2, 0xEDB4, 0xEDB4, 0x20C2, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x72E8, 
-0xD590, 0xBCCF, 0x6A8B, 0x28C3, 0x6A6B, 0x9BED, 0xB46E, 0xAB8D, 0x8B2C, 0x7B0A, 0xA3EE, 0xD4F1, 0xDD32, 0xEDB4, 0xEDB4, 0xEDB4, 
-0x20C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8AC9, 0x6AC8, 0xB4AE, 0xB4AE, 0x51E8, 0x6AA9, 0x624A, 0x6A6B, 0x938C, 0xBBAD, 0xAB6C, 0xB40F, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 
-0xEDB4, 0xEDB4, 0x20C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7A88, 0x6AC8, 0xAC8D, 0xBCCF, 0x834C, 0x3924, 0xB4AE, 0x624A, 0x624A, 0x830C, 0xCC90, 0xBBAD, 0xCC6F, 0xEDB4, 0xEDB4, 
-0xEDB4, 0xEDB4, 0xEDB4, 0x6A89, 0x7AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7A88, 0x3945, 0x9BCD, 0xB4AE, 0x834C, 0x4166, 0x7B2A, 0xB4AE, 0x624A, 0x624A, 0x832D, 0xDD32, 0xBBAD, 0xC3EE, 
-0xD4F1, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0x20C2, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x4165, 0x832B, 0xAC6E, 0x834C, 0x49A7, 0x7B2A, 0xB4AE, 0x7AEB, 0x624A, 0x5A2A, 0x51E7, 0xE593, 
-0xD4B0, 0xBBAD, 0x7A89, 0x3985, 0x3985, 0x3985, 0x3985, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x3125, 0x6A6B, 0x6A8B, 0x4166, 0x8B8B, 0xB4AE, 0xB4AE, 0x624A, 0x624A, 0x5A09, 
-0x39A6, 0xDE57, 0xDE37, 0x942F, 0x6206, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x2904, 0x2904, 0x18A2, 0x0020, 0x838B, 0xB4AE, 0x6A8B, 0x624A, 
-0x5A09, 0x1061, 0x7207, 0x7A48, 0x7A89, 0x51A6, 0x59E6, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x3103, 0x930A, 0xAB8C, 0x49A5, 0x93CC, 0xA42E, 
-0x6A6B, 0x624A, 0x5A09, 0x1061, 0x7A48, 0xA3EE, 0xDE77, 0xBD12, 0x51C6, 0x7248, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x49A5, 0x93CC, 
-0xA42E, 0x6A6B, 0x624A, 0x624A, 0x5A09, 0x1061, 0xA3EE, 0xDE77, 0xDE77, 0xDE77, 0xA42F, 0x3903, 0x7248, 0x930A, 0xBBCC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x7A88, 0x7A88, 0x5A47, 
-0x838B, 0x9BED, 0x72AB, 0x624A, 0x624A, 0x624A, 0x5A09, 0x20E3, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 0xA42F, 0x7207, 0x4944, 0x28C3, 
-0x59E6, 0x7A88, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x3144, 
-0x5A67, 0x93CC, 0x9BED, 0x6A8B, 0x624A, 0x834C, 0x8B6C, 0x624A, 0x5A09, 0x20E3, 0xDE77, 0xDE77, 0xDE77, 0xDE77, 0xC553, 0x7269, 
-0x61C6, 0x7207, 0x4944, 0x3903, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x6227, 0x7B2A, 0xB4AE, 0x832C, 0x624A, 0x8B6C, 0xAC8E, 0x834C, 0x624A, 0x5A09, 0x18A2, 0xBD33, 0xDE77, 0xDE77, 0xDE77, 
-0xDE77, 0x7ACB, 0x5986, 0x7207, 0x7207, 0x7207, 0x1041, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x6227, 0x838B, 0x9C0D, 0x93CD, 0xAC4E, 0x834C, 0x6A6B, 0x624A, 0x5A09, 0x1082, 0x9C2F, 0xDE77, 
-0xDE77, 0xDE77, 0xDE77, 0x7ACB, 0x5986, 0x7207, 0x7207, 0x7207, 0x1041, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x6227, 0x3144, 0x93CC, 0x834C, 0x624A, 0x624A, 0x624A, 0x1082, 0x1061, 
-0x82CA, 0xACD1, 0xDE77, 0xDE77, 0xDE77, 0x7ACB, 0x40E5, 0x4905, 0x61C6, 0x7207, 0x1041, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0xAB8C, 0x3123, 0x1082, 0x1061, 0x1061, 0x1061, 
-0xB553, 0x628A, 0x3124, 0x9C2F, 0xDE77, 0xDE77, 0xDE77, 0x7ACB, 0x38A4, 0x38A4, 0x38C4, 0x1861, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x0020, 0xD616, 0x730B, 0x20E3, 0x93CE, 0xDE57, 0xDE77, 0xDE77, 0xA3EE, 0x7A48, 0x4925, 0x40E4, 0x0820, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x20E3, 0xD616, 0x8B6D, 0x62AA, 0x20E3, 0xAC91, 0xDE77, 0xDE77, 0xDE77, 0x9BAD, 0x7207, 0x7207, 0x1041, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xDE77, 0xBD53, 0x8B6D, 0x5208, 0x3944, 0xAC91, 0xDE77, 0xDE77, 0xDE77, 0x9BAD, 0x7207, 
-0x7207, 0x1041, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xDE77, 0x832C, 0x5228, 0x3903, 0x7268, 0xAC91, 0xDE77, 0xDE77, 0xDE77, 
-0x9BAD, 0x7207, 0x7207, 0x1041, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xDE77, 0xA470, 0x4124, 0x7207, 0x7268, 0xAC91, 0xDE77, 
-0xDE77, 0xDE77, 0x9BAD, 0x7207, 0x7207, 0x1041, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xDE77, 0x5248, 0x7207, 0x7207, 0x7227, 
-0x8B4C, 0xBD53, 0xDE77, 0xDE77, 0x9BAD, 0x7207, 0x7207, 0x1041, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x8BEE, 0x5289, 0x20E4, 0x7207, 
-0x7207, 0x7207, 0x7A89, 0xAC91, 0xDE77, 0xDE77, 0xA42F, 0x7228, 0x7207, 0x1041, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x39A6, 0x18C4, 
-0x2926, 0x3966, 0x7207, 0x7207, 0x7A89, 0xAC91, 0xDE77, 0xB533, 0x8BAD, 0x7268, 0x4186, 0x0841, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 
-0x18C4, 0x2106, 0x2106, 0x2106, 0x2926, 0x4166, 0x7A89, 0x8BAD, 0x93CE, 0xBD53, 0xD616, 0x524A, 0x2926, 0x0841, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x18A2, 0x20E5, 0x2106, 0x2106, 0x2106, 0x20E5, 0x18A4, 0x2106, 0x49E9, 0xB4F2, 0xDE77, 0xDE77, 0x9C2F, 0x3146, 0x2106, 
-0x0841, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x20A2, 0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E5, 0x18C4, 0x41C8, 0x9C70, 0xD616, 0xDE57, 0x8BCE, 
-0x3146, 0x20E5, 0x0841, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E5, 0x18A4, 0x20E6, 0x1083, 0x938C, 
-0xEDB4, 0x3985, 0x18C4, 0x10A4, 0x0841, 0x930A, 0x930A, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18A4, 0x18A4, 
-0x1082, 0x938C, 0xEDB4, 0x832B, 0x20E4, 0x1083, 0x18C5, 0x1062, 0x0862, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x18E5, 0x1083, 0x0842, 0x938C, 0xEDB4, 0xEDB4, 0x3985, 0x18A4, 0x1083, 0x18C5, 0x20E5, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x20E5, 0x10A3, 0x41A6, 0xBCB0, 0xEDB4, 0xEDB4, 0x3985, 0x20E5, 0x18C5, 0x1083, 0x18A4, 0x18A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x20E5, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E5, 0x3966, 0xB44F, 0xEDB4, 0x72EA, 0x3145, 0x2106, 0x2106, 0x18E5, 0x1082, 0x8AC9, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x20C3, 
-0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x49A8, 0x4985, 0x3124, 0x3985, 0x7A68, 0x92EB, 0x930B, 0x930B, 0x930B, 
-0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x20A2, 0x2106, 0x2106, 0x2106, 0x2106, 0x49A8, 0xA34C, 0xB38C, 0x59E6, 0x0020, 0x6A27, 0xAB6C, 0xBBAD, 0xBBAD, 
-0xBBAD, 0xBBAD, 0x8ACA, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x1882, 0xBBAD, 0xBBAD, 0xBBAD, 0xBBAD, 0xBBAD, 0x59E6, 0x7A88, 0x4985, 0x8ACA, 
-0xBBAD, 0xBBAD, 0xBBAD, 0xEDB4, 0xCCF1, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20C2, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0x938C, 0x6207, 0xC40D, 
-0xC40D, 0x4985, 0x7248, 0xBBAD, 0xE573, 0xEDB4, 0xCCF1, 0x3944, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20C2, 0xEDB4, 0xEDB4, 0xEDB4, 0xEDB4, 0x938C, 
-0x6207, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xA32B, 0xE573, 0xEDB4, 0xEDB4, 0xCCF1, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x6A89, 0xEDB4, 0xEDB4, 0xEDB4, 
-0xCCF1, 0x72A9, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x7268, 0xCC90, 0xEDB4, 0xEDB4, 0xCCF1, 0x3123, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x5ACA, 0xEE36, 0xEDB4, 
-0xEDB4, 0xEDB4, 0x938C, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xA32B, 0xD4F1, 0xEDD4, 0xCD94, 0x3123, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xF75B, 
-0xF73A, 0xEDB4, 0xEDB4, 0xCCF1, 0x7289, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0xA32B, 0xCD12, 0xE636, 0xD678, 
-0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 
-0x9470, 0xF75B, 0xF73A, 0xEE77, 0xABCD, 0x7289, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x4965, 0xDE77, 
-0xE698, 0xE6F9, 0x7B8D, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x18A2, 0xD678, 0xF75B, 0xF75B, 0xD616, 0x4985, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A2, 0xDE77, 0xE698, 0xF75B, 0xB594, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x4144, 0xB594, 0xF75B, 0xF75B, 0xC5D5, 0x3965, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x18A2, 0xDE77, 0xE698, 0xF75B, 0xB594, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xD678, 0xF75B, 0xDE98, 0x3965, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x20E3, 0xE698, 0xF75B, 0xB594, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x5207, 0xB594, 0xEF3A, 0xC5D5, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0xE698, 0xEF3A, 0xB594, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x5207, 0xC616, 0xEF3A, 0xB553, 0x3144, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0xA4F2, 0xE698, 0xB594, 0x3123, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x930A, 0xC40D, 0xC40D, 0xA34B, 0x3944, 0x6B2B, 0xDEB8, 0x9CB1, 0x49C6, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20E3, 0xDE98, 0xB553, 0x3123, 
-0xC40D, 0xC40D, 0xA34B, 0x7A88, 0x3124, 0x0020, 0xC40D, 0xC40D, 0x6207, 0x18A2, 0x20E3, 0x736C, 0x3165, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20E3, 0xDE77, 
-0xACF2, 0x18A2, 0x7A88, 0x7A88, 0x4164, 0x0820, 0x0841, 0x0820, 0xC40D, 0x930A, 0x3944, 0x20C2, 0x20E3, 0x20E3, 0x0841, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x20E3, 0xD616, 0x5AA9, 0x0841, 0x0840, 0x0840, 0x0841, 0x0861, 0x0841, 0x4164, 0xC40D, 0x6207, 0x1081, 0x20E3, 0x20E3, 0x20E3, 
-0x18C2, 0x4164, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7AA9, 0x4A27, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x49A5, 0xAB8C, 0xC40D, 0xAB8C, 0x51A5, 0x0841, 
-0x18A2, 0x20E3, 0x20E3, 0x0820, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x49A5, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x930A, 0x4185, 0x20C2, 0x20E3, 0x18C2, 0x3924, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x0861, 0x0861, 0x0841, 0x3123, 0x930A, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x28E3, 0x20C2, 0x20E3, 0x20C3, 0x20C3, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0x0020, 0x4164, 0xBBCC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_right_8.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_right_8_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x51C6, 0x3964, 0x4185, 0x4185, 0x49A5, 
-0x41A5, 0x49A5, 0x7AA8, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x5A26, 0xA44C, 0xD5B0, 0xC54E, 
-0xC54E, 0xBCEE, 0xB4CE, 0xB4AD, 0x5A67, 0x4185, 0x82A9, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x51C6, 0xA48C, 0xFFD5, 
-0xFFF5, 0xFF33, 0xEE32, 0xDDB1, 0xDDD1, 0xDDF1, 0xC50F, 0xAC6D, 0x6AE8, 0x49C5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 0x49E5, 0x8BAB, 
-0xD5F2, 0xF713, 0xFF12, 0xCD70, 0xB4AE, 0xD5D0, 0xE611, 0xBCCF, 0xC52F, 0xF692, 0xFF73, 0xCDEF, 0x5206, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x8BAA, 
-0xEE11, 0xDDD1, 0x94F2, 0x9511, 0xCD4F, 0xBCAE, 0xD5F1, 0xFFB4, 0xBD4E, 0x7ACB, 0xA40E, 0xDDF0, 0xFF74, 0xFF54, 0xBD0E, 0x5A06, 
-0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 
-0x838A, 0xEE52, 0xDDD1, 0xBCCE, 0x636E, 0x4370, 0x8C70, 0xCD70, 0xFED2, 0xF713, 0x62C7, 0x6AAA, 0xC4D2, 0xA42E, 0xD5B0, 0xF672, 
-0xFEB3, 0x834A, 0x5A06, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB3AC, 0x41A4, 0xD5B0, 0xDDD1, 0xBCCF, 0x9C0D, 0x3989, 0x118B, 0x6C31, 0xD611, 0xFE92, 0x9C2C, 0x5A48, 0xD512, 0xF5F5, 0x8B6D, 
-0xAC8E, 0xE611, 0xD5B1, 0x6AC9, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6227, 0x8BCA, 0xDDD1, 0xBCEF, 0x9BED, 0x62EC, 0x21AB, 0x21CB, 0x738E, 0xDDD1, 0xF692, 0x6287, 0x51C6, 0xD48F, 
-0xCC6F, 0xABEF, 0x93AD, 0xC50F, 0x9C2D, 0x41A5, 0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4184, 0xC54F, 0xDDF1, 0xA40D, 0x59E8, 0x2968, 0x4B4E, 0x7BEF, 0x8B6C, 0xCD4F, 0xEE52, 0x62A8, 
-0x1021, 0x28A2, 0x4965, 0x930B, 0x934D, 0xB4AF, 0x72E9, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x49A5, 0xB4CD, 0xD591, 0x93AD, 0x3905, 0x5207, 0xB4F0, 0xAC6E, 0x830B, 0xAC8E, 
-0xD590, 0x6AA8, 0x2166, 0x3148, 0x48E5, 0x92CB, 0x934C, 0x6AC9, 0x6227, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x41A5, 0xC52F, 0xD5B1, 0x8B8D, 0x4147, 0x6A88, 0xC50F, 0xB48E, 
-0x832C, 0x93CD, 0xC530, 0x6287, 0x630C, 0xAC74, 0x928D, 0xD450, 0xBC4F, 0x49A5, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x5A06, 0x93EB, 0xD570, 0xA42E, 0x6A6A, 0x4146, 
-0x7B0A, 0xC510, 0xAC4E, 0x8B2C, 0xAC6E, 0x5A67, 0x5A27, 0xD554, 0xB411, 0xD4F2, 0xFE36, 0x938C, 0x6207, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x49E5, 0xCD70, 0xCD50, 
-0x8B6D, 0x4147, 0x4146, 0x8BAC, 0xC4CF, 0xAB8C, 0x8B2C, 0x62A9, 0x936C, 0xE532, 0xDD53, 0xE594, 0xFE97, 0xC4B0, 0x4165, 0xBBED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 
-0x8BAA, 0xD590, 0xAC6E, 0x6AAB, 0x3105, 0x49A8, 0x9B8D, 0xBBCD, 0xA2EB, 0xABEF, 0xEDD5, 0xEDB4, 0xEDB4, 0xEDD4, 0xFE56, 0xBC90, 
-0x4985, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x49C5, 0xCD6F, 0xD571, 0x8B6C, 0x30E5, 0x3946, 0x7ACD, 0xBC0F, 0xC3AC, 0xD470, 0xFE36, 0xF615, 0xF5F5, 0xFE36, 
-0xEDD4, 0x72A9, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x838A, 0xD590, 0xAC4E, 0x5A28, 0x5A28, 0x6249, 0x7AED, 0xCCD1, 0xC3ED, 0xC3CD, 0xE553, 0xF5F5, 
-0xF5D5, 0xFE77, 0xC4B0, 0x4165, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6A47, 0x8BAA, 0xDDD1, 0xAC4E, 0x51C8, 0x5A48, 0xAC8E, 0x72AB, 0x49A7, 0xCD32, 0xED73, 0xBBAD, 
-0x82CA, 0x5A28, 0x5A48, 0x6269, 0x5207, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x7B49, 0xE5F1, 0xAC6F, 0x51C8, 0x5A07, 0xAC6D, 0xA40E, 0x4987, 0x2924, 0xACB0, 
-0xFED9, 0x9C0E, 0x51A5, 0x9B2A, 0x8AC9, 0x82A8, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3944, 0x7B0B, 0xB46F, 0x6249, 0x51E7, 0xA42D, 0xA40E, 0x5A2A, 0x28A4, 
-0x4124, 0x8B2B, 0xBD12, 0x83EE, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3924, 0x51E9, 0x622A, 0x49A6, 0xA42C, 0xA42E, 0x624B, 
-0x51C9, 0x20A2, 0x6A68, 0xCD73, 0xBD12, 0xAC70, 0x732B, 0x7288, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x49A7, 0x4167, 0x49E6, 0xBCEF, 
-0xA42E, 0x6A6B, 0x51A8, 0x2904, 0xA4B0, 0xFF9C, 0xDE77, 0xAC50, 0xA42F, 0x6268, 0x6A27, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x51C6, 0x28E4, 
-0x4185, 0x8B8A, 0xBCEF, 0x938D, 0x4988, 0x3145, 0xAD32, 0xFF7B, 0xC5B5, 0x8B8D, 0x8AEB, 0x7A68, 0x4124, 0x3103, 0x6A27, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xABAC, 0x92EA, 0x82A9, 0x49C5, 0xC50F, 0x9BEE, 0x4988, 0x2925, 0xA4F1, 0xFF5B, 0xCDF6, 0xA450, 0x6A69, 0x5945, 0x7207, 0x69E6, 
-0x3924, 0x3103, 0x92EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 0x72E9, 0xAC8E, 0x830C, 0x4988, 0x3125, 0xA4F1, 0xF73A, 0xEEF9, 0xB4F2, 0x4126, 0x3063, 
-0x61A6, 0x8268, 0x8248, 0x5185, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6227, 0x7B29, 0xB48F, 0x7ACB, 0x620A, 0x51A8, 0x3125, 0xA4F1, 0xF71A, 0xEF1A, 0x9C30, 
-0x2843, 0x3063, 0x5986, 0x7A47, 0x8268, 0x59C6, 0x3944, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x6AE9, 0xD5B1, 0xAC4E, 0x5A0A, 0x830C, 0x6A6A, 0x20E4, 0x9CB1, 0xF73A, 
-0xEEF9, 0xAC91, 0x40E4, 0x3063, 0x40E5, 0x5166, 0x7207, 0x5985, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA8, 0x5A47, 0xAC6E, 0xB48E, 0xAC4E, 0xC510, 0x7AEA, 0x2925, 
-0xAD12, 0xF71A, 0xE6F9, 0xBCD1, 0x69C6, 0x40E4, 0x3084, 0x3884, 0x40E4, 0x3924, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x3944, 0x6287, 0xB4AE, 0xA44D, 
-0x49E6, 0x736D, 0xE698, 0xE6B8, 0xE6F9, 0xB4B1, 0x71E6, 0x69C6, 0x61A6, 0x4925, 0x2883, 0x3924, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x7268, 
-0x4185, 0x3123, 0x18A2, 0xA4D2, 0xFF5B, 0xDE57, 0xEF3A, 0xBD12, 0x69E6, 0x71E6, 0x7227, 0x7207, 0x5165, 0x3944, 0xBBCD, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xB3AC, 0xABAC, 0x4185, 0xA4B1, 0xF73A, 0xE6B8, 0xD657, 0x9BCE, 0x69C6, 0x69E6, 0x7207, 0x8248, 0x61C6, 0x3944, 
-0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x9CB1, 0xF73A, 0xEEF9, 0xB4F2, 0x61C7, 0x69C6, 0x7207, 0x7207, 0x7A28, 
-0x59A6, 0x3944, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 0x9CB1, 0xF73A, 0xEEF9, 0xB4F2, 0x69C6, 0x69C6, 0x7207, 
-0x7207, 0x7A28, 0x59A6, 0x3944, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 0x9CB1, 0xF73A, 0xEEF9, 0xBD33, 0x7227, 
-0x69C6, 0x7207, 0x7207, 0x7A28, 0x59A6, 0x3944, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0xA4B1, 0xF73A, 0xEEF9, 
-0xBD33, 0x7207, 0x69C6, 0x7207, 0x7207, 0x7A28, 0x59A6, 0x3944, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x9CB1, 
-0xFF5B, 0xEF3A, 0xC553, 0x7227, 0x69C6, 0x7207, 0x7207, 0x8248, 0x61C6, 0x3944, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 
-0x18A3, 0x838E, 0xD616, 0xE6B8, 0xB4F2, 0x7207, 0x71E6, 0x7A27, 0x7207, 0x7A28, 0x59A6, 0x3944, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x1082, 0x2106, 0x6AAB, 0xAC90, 0xB4D2, 0x732D, 0x4987, 0x61C6, 0x6A07, 0x61E7, 0x4987, 0x2905, 0x3944, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x51C6, 0x1084, 0x2106, 0x7B2C, 0xCDD5, 0xCDB4, 0x6ACB, 0x18C5, 0x2926, 0x3146, 0x3146, 0x2106, 0x0884, 0x28E3, 
-0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x18A3, 0x18E6, 0x18C5, 0x628A, 0xDE16, 0xFF5A, 0x938C, 0x0022, 0x10A5, 0x1906, 0x1906, 0x18E5, 
-0x18C5, 0x10A4, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x18C4, 0x2927, 0x1084, 0x2104, 0xC4D1, 0xFEF8, 0xC4B0, 0x2904, 0x0863, 0x2127, 
-0x2126, 0x20E6, 0x18E5, 0x10A4, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x18A3, 0x2106, 0x2927, 0x18C5, 0x1083, 0x830A, 0xEDB4, 0xFE36, 0xB46F, 
-0x3165, 0x10A4, 0x2126, 0x2106, 0x10A4, 0x1083, 0x3104, 0x7A88, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x59C6, 0x18A4, 0x2127, 0x2106, 0x2127, 0x0864, 0x2904, 0xCCF1, 
-0xFE77, 0xFE77, 0x832A, 0x0022, 0x2106, 0x2106, 0x18A4, 0x18C4, 0x18E5, 0x0862, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x1882, 0x2126, 0x2927, 0x2106, 0x2927, 0x0864, 
-0x20E3, 0xCCF1, 0xFED8, 0xD512, 0x41C6, 0x1084, 0x2106, 0x2126, 0x20E5, 0x10A4, 0x18E5, 0x18C4, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x18A3, 0x2106, 0x2927, 0x2126, 
-0x2106, 0x18E5, 0x10A3, 0x6AA9, 0xEDF4, 0x832B, 0x0001, 0x18E6, 0x1906, 0x18E6, 0x10C5, 0x0863, 0x18C4, 0x18A4, 0x6A27, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x18A2, 
-0x18A4, 0x2126, 0x2927, 0x2927, 0x10A5, 0x18C4, 0x51E7, 0x3923, 0x1083, 0x2106, 0x2926, 0x2926, 0x2106, 0x49A7, 0x59C7, 0x4145, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA36B, 0x59E6, 0x18C4, 0x2106, 0x18C5, 0x3967, 0x7A8A, 0x8289, 0x82A9, 0x92EB, 0x4166, 0x59E7, 0x9B2C, 0x8AEB, 0xBBAD, 
-0x7247, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x59E6, 0x1082, 0x18A2, 0x82CA, 0xE4D1, 0xF594, 0xFDF5, 0xED11, 0x59C6, 0x7A68, 0xE46F, 
-0xCBED, 0xD42E, 0x930A, 0x51C6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x4164, 0xBC6F, 0xFE16, 0xEDF5, 0xFE36, 0xC470, 0x4964, 
-0x61E6, 0xBBAD, 0xBBAD, 0xD490, 0xEDB4, 0x7AEA, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0xB490, 0xFE77, 0xEDD4, 0xFE36, 
-0x832B, 0x6227, 0x49A5, 0x9AEA, 0xD46F, 0xE573, 0xFEB8, 0x938C, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x51E6, 0xD532, 0xF615, 
-0xEDD4, 0xFE77, 0x832B, 0x7A68, 0x8AC9, 0x59C6, 0xC40F, 0xF5D5, 0xFE77, 0x834B, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x5A69, 0xD5D5, 
-0xFE36, 0xEDB4, 0xFE56, 0xDD52, 0x5A07, 0xAB8B, 0xC3ED, 0x4144, 0x9B0A, 0xED32, 0xFE56, 0x8B6C, 0x6207, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 
-0x9CF2, 0xFFFF, 0xF636, 0xFE15, 0xDD53, 0x5A07, 0x9B2A, 0xC40D, 0xBBED, 0x41A5, 0x9BAD, 0xDCB1, 0xFE15, 0x8B8C, 0x6207, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x9B4B, 0x5248, 0xDEF9, 0xFFFD, 0xF6B8, 0xCC90, 0x51E6, 0x9B2A, 0xC40D, 0xC40D, 0xBBCD, 0x49C6, 0xB533, 0xFED9, 0xC533, 0x5A07, 
-0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6206, 0x9490, 0xFFFF, 0xFFDC, 0xCDF5, 0x49A6, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x41A5, 0xBD74, 0xFFFE, 
-0x94D1, 0x5A06, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x62EA, 0xE6FA, 0xFFFD, 0xD636, 0x5A68, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x41A5, 
-0xB553, 0xFFFE, 0x9CD2, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x8AC9, 0x732B, 0xEF3B, 0xFFFF, 0xDE78, 0x5248, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBCD, 0x41A5, 0xB553, 0xFFFD, 0xA4D2, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x3103, 0x2944, 0xCE57, 0xFFFF, 0xE6D9, 0x5A89, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xB3CC, 0x4185, 0xC5D5, 0xFFFE, 0x9CD1, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x3103, 0x18A2, 0x20E3, 0x7B8D, 0xC5B5, 0x62CA, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x5A07, 0x942F, 0xFFBC, 0xA512, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3944, 0x20C2, 0x3124, 0x20E3, 0x18A2, 0x2903, 0x8AC9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x49C6, 0xE6D9, 0xAD53, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x18A2, 0x2903, 0x2924, 0x1081, 0x51C6, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4185, 0xE6B9, 0xB553, 0x5A06, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7248, 0x18A2, 0x2903, 0x18A2, 
-0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x41C6, 0xE6D9, 0xEF5B, 0x62A9, 
-0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x20C2, 
-0x2903, 0x20C2, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x41A6, 0xDE98, 
-0xE71A, 0x4A48, 0x5A06, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7A88, 0x18A2, 0x20E3, 0x28E3, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 
-0x3123, 0x5AA9, 0x41E7, 0x0020, 0x20A2, 0x930A, 0xC3ED, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x28E3, 0x20E3, 0x18A2, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xABAC, 0x20C2, 0x0000, 0x0000, 0x0861, 0x0861, 0x18A2, 0x3103, 0x4164, 0x9B4A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x1061, 0x0841, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x20C2, 0x0841, 0x0861, 0x0861, 0x1061, 0x0841, 0x0841, 0x0841, 0x4185, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// girl_walk_right_9.png
-// Size: 34x65 (4420 bytes)
-const uint16_t girl_walk_right_9_bmp[2210] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x59E6, 0x3964, 0x4985, 0x4985, 0x49A5, 
-0x4985, 0x49A5, 0x8AE9, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6226, 0x940B, 0xC56F, 0xBD0E, 
-0xBCEE, 0xB4AD, 0xACAD, 0xA46D, 0x5226, 0x49A5, 0x930A, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x59E6, 0xA46C, 0xFFD5, 
-0xFFF5, 0xFF34, 0xEE52, 0xDDD1, 0xDDD1, 0xE5F1, 0xBD0F, 0x9C2C, 0x62A7, 0x49C5, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 0x49E5, 0x8B8A, 
-0xDE12, 0xFF33, 0xFF12, 0xCD70, 0xB4AE, 0xD5B0, 0xE611, 0xBCCF, 0xCD30, 0xF692, 0xFF53, 0xC58E, 0x51E6, 0xB3AC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x8BAA, 
-0xE611, 0xDDD1, 0x9512, 0x9D31, 0xCD4F, 0xB4AE, 0xD5F1, 0xFFB4, 0xBD2E, 0x7AEB, 0xA40E, 0xE611, 0xFF94, 0xFF74, 0xB4ED, 0x5A06, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x6A27, 
-0x8BAA, 0xEE52, 0xDDD1, 0xBCCE, 0x634E, 0x4390, 0x8C70, 0xCD70, 0xFEF2, 0xF6F3, 0x62C7, 0x72AA, 0xC4B2, 0xA42E, 0xDDD0, 0xF672, 
-0xFEB3, 0x7B29, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8B, 0x41A5, 0xE611, 0xEE32, 0xB4AE, 0x9BCD, 0x3169, 0x11AB, 0x6C51, 0xDE11, 0xFE92, 0x9C0B, 0x5A48, 0xDD32, 0xF5D5, 0x8B4D, 
-0xAC8E, 0xE611, 0xD591, 0x62A8, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8B, 0x49C5, 0xCD6F, 0xD590, 0x9BED, 0x62CC, 0x21AB, 0x21EB, 0x7BAE, 0xE5F1, 0xF672, 0x5A67, 0x59C6, 0xD48F, 
-0xC46F, 0xABEF, 0x93AD, 0xC510, 0x9C0C, 0x49A5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x49E5, 0xC52F, 0xCD50, 0x8B4C, 0x3A2B, 0x4B6F, 0x7BEE, 0x8B6C, 0xCD4F, 0xEE32, 0x6288, 
-0x0821, 0x2882, 0x4965, 0x92EB, 0x934D, 0xB4AF, 0x6AC8, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x49E5, 0xC52F, 0xCD50, 0x8B4C, 0x4A6B, 0x8C4F, 0xAC6E, 0x830B, 0xAC8E, 
-0xD570, 0x62A8, 0x2187, 0x3968, 0x5106, 0x9AEC, 0x934C, 0x6288, 0x6247, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x49E5, 0xC52F, 0xCD50, 0x834C, 0x41A7, 0x93CB, 0xBCCF, 
-0x832C, 0x93CD, 0xC50F, 0x5A67, 0x6B0C, 0xB494, 0x9AAD, 0xD471, 0xBC4F, 0x49A5, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x49C5, 0xD5B0, 0xDDB1, 0x8B4C, 0x30E5, 
-0x6A88, 0xC530, 0xAC4E, 0x8B2C, 0xAC4E, 0x5246, 0x6227, 0xD574, 0xB431, 0xDD12, 0xFE56, 0x938D, 0x6206, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x59E6, 0xA44C, 0xE611, 
-0x938D, 0x4147, 0x4166, 0x8B8C, 0xC4CF, 0xAB6C, 0x8B0C, 0x6ACA, 0xA3CD, 0xE553, 0xE553, 0xE5B4, 0xFE97, 0xBC90, 0x4185, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 
-0x5226, 0xDDB0, 0xB46F, 0x6A8B, 0x4147, 0x4187, 0x8B2B, 0xC3CD, 0xA30B, 0xB42F, 0xF5F5, 0xEDB4, 0xEDB4, 0xEDD4, 0xFE56, 0xB44F, 
-0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6227, 0x838A, 0xD590, 0xAC8F, 0x6A8B, 0x28C4, 0x624A, 0xCC50, 0xC3AD, 0xD490, 0xFE16, 0xFE36, 0xFE15, 0xFE76, 
-0xE5B4, 0x6248, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x932A, 0x5A46, 0xDDF1, 0xC530, 0x7AEB, 0x28C4, 0x6A8A, 0xD512, 0xCBED, 0xC3CD, 0xDD32, 0xE594, 
-0xE593, 0xF616, 0xAC4F, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x5A26, 0xB4CD, 0xCD50, 0x93AD, 0x51C8, 0x28E5, 0x49E8, 0xD573, 0xF5D4, 0xBBAD, 
-0x7248, 0x49C6, 0x49C6, 0x49E6, 0x51C6, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x5206, 0xBCEE, 0xD591, 0x93AD, 0x59E9, 0x3946, 0x30E4, 0x3104, 0xA470, 
-0xFF1A, 0x8BEE, 0x59E6, 0xB3AC, 0x9B4B, 0x9B2A, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0xB4CD, 0xD5B1, 0x93AD, 0x51E9, 0x4147, 0x4987, 0x20A3, 
-0x6248, 0x932B, 0xA3EE, 0x8C0F, 0x5A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41A4, 0xDDD0, 0xC510, 0x51E9, 0x49A7, 0x5A08, 
-0x4167, 0x5248, 0xC5D5, 0xDE16, 0x82C9, 0x8B2B, 0x83CD, 0x6248, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 0x834A, 0x93AE, 0x4147, 
-0x72A9, 0x832B, 0x28E4, 0x9CB1, 0xF73A, 0xCDD5, 0xACB1, 0x932B, 0xA3AD, 0x6A89, 0x4985, 0x8AEA, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x28C3, 
-0x622A, 0x622A, 0x6248, 0x7AEA, 0x3965, 0xA4D1, 0xEEB8, 0x8B8D, 0x9C0F, 0x9BCE, 0x7A07, 0x7A27, 0x5185, 0x3103, 0x49A5, 0x8AEA, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6A27, 0x3946, 0x6A6B, 0x4987, 0x6267, 0x5247, 0x9470, 0xF71A, 0xACD2, 0x836D, 0x7ACA, 0x5965, 0x5125, 0x7207, 0x7227, 
-0x5185, 0x30E3, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x20C3, 0x5207, 0x5A67, 0x736C, 0xD616, 0xF73A, 0xD636, 0x93EF, 0x6228, 0x3884, 0x3064, 
-0x61A6, 0x8268, 0x8268, 0x59A6, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x5246, 0x5A47, 0x8C0F, 0xFF5B, 0xE6B8, 0xC5B5, 0x8B4C, 0x5966, 
-0x3063, 0x3084, 0x5986, 0x7207, 0x8268, 0x59A6, 0x4144, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A8, 0x6267, 0x5226, 0x7B8D, 0xFF7B, 0xDE98, 0x9C2F, 
-0x7207, 0x69C6, 0x5145, 0x38A4, 0x30A4, 0x4905, 0x69C7, 0x4964, 0x61E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x49E5, 0x62A8, 0xACF2, 0xFF9B, 
-0xBD74, 0x72AA, 0x69C6, 0x7227, 0x7207, 0x5166, 0x38C4, 0x3884, 0x3083, 0x3924, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 0x7B8D, 
-0xDE77, 0xC594, 0x8B6D, 0x4925, 0x5986, 0x7227, 0x7227, 0x7207, 0x69E7, 0x5966, 0x30A4, 0x4144, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7268, 0x7BAD, 0xBD33, 0x834C, 0x72CA, 0x28A3, 0x38A4, 0x61C7, 0x7207, 0x7227, 0x7227, 0x7A48, 0x59A5, 0x4144, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6A47, 0x7BAD, 0xCDD5, 0x9BCE, 0x6AAA, 0x1882, 0x1802, 0x5126, 0x7227, 0x7207, 0x7207, 0x7A48, 0x59A6, 0x4144, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x5A27, 0xC5B4, 0xF71A, 0xCDB5, 0x628A, 0x1041, 0x2043, 0x5146, 0x7207, 0x7207, 0x7207, 0x7A28, 
-0x59A6, 0x4144, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x736C, 0xF73A, 0xF73A, 0xD637, 0x49E7, 0x30A2, 0x6186, 0x69C6, 0x7207, 0x7207, 
-0x7207, 0x7A28, 0x59A6, 0x4144, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x6B0B, 0xEEF9, 0xF73A, 0xBD74, 0x4185, 0x5944, 0x8268, 0x7207, 
-0x7207, 0x7207, 0x7207, 0x7A28, 0x59A6, 0x4144, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x6B0B, 0xF71A, 0xE6B8, 0xA470, 0x69E7, 0x69C6, 
-0x7207, 0x7207, 0x7207, 0x7207, 0x7207, 0x7A28, 0x59A6, 0x4144, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x736C, 0xFF7B, 0xE698, 0x93EE, 
-0x61C7, 0x7207, 0x7A27, 0x7207, 0x7207, 0x7207, 0x7207, 0x7A48, 0x59A6, 0x4144, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x5A48, 0xD636, 
-0xF71A, 0x940F, 0x3946, 0x4166, 0x61E7, 0x7A27, 0x7227, 0x7207, 0x7207, 0x8248, 0x5985, 0x4144, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6A27, 0x6AEA, 0xCD94, 0x8BAE, 0x2946, 0x1085, 0x3126, 0x4987, 0x61E7, 0x7A27, 0x7A27, 0x71E7, 0x6228, 0x51E7, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6A47, 0x62AA, 0xC574, 0x8BAE, 0x2926, 0x0863, 0x18E6, 0x1906, 0x3146, 0x4987, 0x51A7, 0x28E5, 0x6AAB, 0x9BEE, 
-0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x83EE, 0xFF5B, 0x940F, 0x1883, 0x0863, 0x2106, 0x2106, 0x2106, 0x1906, 0x1906, 0x0064, 
-0x5A49, 0x9BCD, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x836C, 0xFEF9, 0xC4D1, 0x3145, 0x0863, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x18C5, 0x20E5, 0x7B2C, 0x72C9, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x1061, 0x832B, 0xFE36, 0xFE36, 0xAC2F, 0x20E4, 0x10A4, 0x2126, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x0002, 0x72EC, 0xAC2F, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x0000, 0x832B, 0xFE36, 0xFE36, 0xB46F, 0x20E4, 
-0x1084, 0x2126, 0x2106, 0x2106, 0x2106, 0x20E5, 0x0863, 0x628B, 0x7B0B, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x18A3, 0x0021, 0x938C, 0xFF39, 0xE573, 
-0x41A6, 0x0863, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E5, 0x10A4, 0x2926, 0x2105, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x59E6, 0x10A4, 0x10A4, 0x5207, 
-0xC4B0, 0xC4D0, 0x3145, 0x0043, 0x2927, 0x2106, 0x2106, 0x2106, 0x2126, 0x18E5, 0x0863, 0x10A4, 0x1084, 0x51A5, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x1082, 0x2127, 
-0x2947, 0x1084, 0x18A3, 0x5207, 0x3124, 0x10A4, 0x2127, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x3147, 0x4166, 0x18A3, 0x18A3, 0x8AC9, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 
-0x49A5, 0x18C4, 0x2947, 0x2106, 0x0842, 0x0021, 0x18A4, 0x2126, 0x2106, 0x18C5, 0x18C5, 0x18C5, 0x08A5, 0x49C9, 0x82AA, 0x30E3, 
-0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x51A6, 0x1083, 0x18A3, 0x49A5, 0x3104, 0x10A3, 0x0862, 0x2904, 0x7AAA, 0x82CB, 0x8ACB, 0x6A49, 0x49A7, 
-0x7248, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x82A9, 0x8AC9, 0xBBCC, 0xA36B, 0x8AC9, 0x59E6, 0x5A07, 0xED53, 0xF5B4, 0xF593, 
-0xB3AC, 0x59A5, 0x6A07, 0x51A6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0xBC90, 0xFE56, 
-0xFE56, 0xE5B4, 0x6A89, 0x7A48, 0x9B0A, 0x4985, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x6289, 
-0xF5F5, 0xFE15, 0xFE15, 0xE5B4, 0x49E6, 0x8289, 0xAB4C, 0x4164, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x49A6, 0xC5D5, 0xFE56, 0xE532, 0xFE36, 0xBC70, 0x49A5, 0xA34B, 0xAB8D, 0x4185, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x82A9, 0x6B2B, 0xF7BC, 0xF6F9, 0xE5D5, 0xC512, 0x6ACA, 0x82A9, 0xE44F, 0xC490, 0x41A5, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBCD, 0x49A6, 0xCE16, 0xFFFE, 0xFFBC, 0xBD94, 0x2965, 0x734C, 0xEE36, 0xDD53, 0x7B0B, 0x7268, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4185, 0xCE36, 0xFFFF, 0xD657, 0x5227, 0x3923, 0x83CE, 0xFFFE, 0xCE77, 0x49C6, 0xB3CC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x49A6, 0xCE37, 0xFFFF, 0x8C2F, 0x6A27, 0x7268, 0x83EE, 0xFFDD, 0xD657, 
-0x49C6, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7248, 0x7BCE, 0xFFFE, 0xDE98, 0x5207, 0xB3AC, 0x6A47, 0x83EE, 
-0xFFDC, 0xD657, 0x49E6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x5227, 0xEF3A, 0xFFFF, 0x8C0E, 0x61E6, 0xC40D, 
-0x6206, 0x944F, 0xFFFD, 0xCE37, 0x49E6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51C6, 0x6B4C, 0xEF1A, 0xD657, 0x4A07, 
-0xAB6B, 0xC40D, 0x7A88, 0x6B2B, 0xF75B, 0xD677, 0x49E6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x51C5, 0x18A2, 0x3985, 0x5AA9, 
-0x6B0B, 0x6227, 0xC40D, 0xC40D, 0xBBED, 0x51C6, 0xBD74, 0xE6D9, 0x49C6, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A68, 0x1082, 0x2923, 
-0x20A2, 0x1061, 0x28E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0xAD12, 0xE6F9, 0x49C6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 
-0x28E3, 0x20E3, 0x2924, 0x20C2, 0x28C2, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0xAD12, 0xFFDD, 0x83CE, 0x82A9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xA36B, 0x28E3, 0x20E3, 0x20E3, 0x28E3, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0xAD12, 0xFFDD, 0x83EE, 0x3123, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x18A2, 0x2924, 0x18A2, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x4A28, 0x5ACA, 
-0x1082, 0x0020, 0x7268, 0xBBED, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4185, 0x20C3, 0x20E3, 0x20C2, 0xA36B, 0xC40D, 0xC40D, 0x51A5, 
-0x0000, 0x0000, 0x0841, 0x1061, 0x1061, 0x3103, 0x3123, 0x7AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x28E3, 0x20E3, 0x18A2, 0x59E6, 0xC40D, 
-0xC40D, 0x51A5, 0x0841, 0x0841, 0x0861, 0x1061, 0x0861, 0x0841, 0x0841, 0x20A2, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
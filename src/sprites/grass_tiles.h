@@ -1,446 +0,0 @@
-// Total bitmap data size: 13680 bytes
-
-// grass_tile_right.png
-// Size: 60x38 (4560 bytes)
-const uint16_t grass_tile_right_bmp[2280] = {
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8565, 0x8545, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 
-0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 
-0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 
-0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 
-0x8D85, 0x8D85, 0x8D85, 0x8565, 0x8544, 0x8545, 0x8565, 0x8565, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6464, 0x7D24, 
-0x8545, 0x8545, 0x8565, 0x8545, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53E3, 0x53E3, 0x53E3, 0x53E3, 
-0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53E3, 0x53E3, 0x53E3, 0x53E3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 
-0x53C3, 0x53E3, 0x53E3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53E3, 0x53E3, 0x53E3, 0x53E3, 0x53E3, 0x53C3, 0x53C3, 0x53C3, 
-0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x4BA3, 0x7D24, 0x8585, 0x8565, 0x8565, 0x8545, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5C03, 0x6444, 0x6444, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C4, 0x53A4, 0x5BE3, 
-0x5BE3, 0x5C03, 0x6444, 0x6444, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x5C03, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C3, 0x74C4, 0x7D04, 0x7D24, 0x8565, 0x8545, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5C03, 0x3B25, 0x32E5, 0x32E5, 0x32E5, 0x32E5, 0x5BE3, 0x5BE3, 0x5BE3, 0x53E3, 0x6424, 0x8DA5, 0x95C5, 0x4365, 
-0x2AC5, 0x32E5, 0x32E5, 0x32E5, 0x5BE3, 0x5BE3, 0x5BE3, 0x5C03, 0x53C4, 0x2AC5, 0x2AC5, 0x53C4, 0x53C3, 0x6C84, 0x95C5, 0x8585, 
-0x32E5, 0x32E5, 0x32E5, 0x32E5, 0x3B05, 0x5C03, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x53C3, 0x4BA3, 0x6464, 0x8D85, 0x8545, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C3, 0x5BE3, 0x3B44, 
-0x3325, 0x3B25, 0x3B25, 0x3B25, 0x5C03, 0x5C03, 0x5C03, 0x5BE3, 0x6443, 0x8DA5, 0x95C5, 0x4385, 0x3305, 0x3B25, 0x3B25, 0x3B25, 
-0x5BE3, 0x5C03, 0x53E3, 0x53E3, 0x53C4, 0x3325, 0x3305, 0x53E3, 0x5BE3, 0x6CA4, 0x95C5, 0x8585, 0x3B25, 0x3B25, 0x3B25, 0x3325, 
-0x3B44, 0x5C03, 0x5C03, 0x53E3, 0x53C3, 0x5BE3, 0x5C03, 0x5C03, 0x5C03, 0x5C03, 0x5C03, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x53C3, 0x6C64, 0x8D85, 0x8545, 0x5BE3, 0x5C03, 0x5BE3, 0x53E3, 0x5C24, 0x8545, 0x85A4, 0x31E5, 0x20E6, 0x2126, 0x2126, 0x2126, 
-0x3B24, 0x3B25, 0x3B25, 0x3B25, 0x3B25, 0x4345, 0x4385, 0x2985, 0x2106, 0x2126, 0x2126, 0x2126, 0x5BE3, 0x53C3, 0x6CA4, 0x8584, 
-0x6C65, 0x18C6, 0x20E6, 0x32C5, 0x3B24, 0x3B25, 0x4345, 0x3B45, 0x2126, 0x2126, 0x2126, 0x2106, 0x29A5, 0x5C43, 0x53C3, 0x74E4, 
-0x8564, 0x6464, 0x32C5, 0x3B25, 0x3B25, 0x3305, 0x4BA4, 0x5C03, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C3, 0x6C64, 0x8D85, 0x8545, 
-0x5C03, 0x5C23, 0x5C03, 0x5C03, 0x6463, 0x95C5, 0x9E24, 0x31C6, 0x18A6, 0x20E6, 0x20E6, 0x20E6, 0x3B45, 0x3B45, 0x3B45, 0x3B45, 
-0x3B45, 0x3345, 0x3B84, 0x2146, 0x20C6, 0x20E6, 0x20C6, 0x20E6, 0x5C03, 0x5BE3, 0x7D04, 0x9E05, 0x7CC5, 0x1066, 0x18A6, 0x32C5, 
-0x3B65, 0x3B45, 0x3345, 0x3B25, 0x20E6, 0x20E6, 0x20E6, 0x18C6, 0x2965, 0x6463, 0x5BE3, 0x8564, 0x9E05, 0x6CA5, 0x2AE5, 0x3B45, 
-0x3B45, 0x3325, 0x4B84, 0x53C3, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C3, 0x6C64, 0x8D85, 0x8545, 0x4B84, 0x4B84, 0x4B84, 0x4364, 
-0x4BA4, 0x5C45, 0x6484, 0x2986, 0x18C6, 0x20E6, 0x20E6, 0x20E6, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A25, 0x2126, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4B84, 0x4364, 0x53E4, 0x6465, 0x5385, 0x18A6, 0x20C6, 0x29C5, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 
-0x20E6, 0x20E6, 0x20E6, 0x20C6, 0x2965, 0x4BC4, 0x4364, 0x5C04, 0x6465, 0x4B45, 0x21A5, 0x2A05, 0x2A05, 0x2185, 0x5384, 0x74E4, 
-0x6C84, 0x53E3, 0x5BE3, 0x5BE3, 0x53C3, 0x6C64, 0x8D85, 0x8545, 0x32E5, 0x3305, 0x32E5, 0x32E5, 0x32E5, 0x2AC5, 0x2B05, 0x2146, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18A6, 0x18A6, 0x18A6, 0x18A6, 0x18A6, 0x18A6, 0x18A6, 0x20E6, 0x2106, 0x20E6, 0x20E6, 0x20E6, 
-0x32E5, 0x3305, 0x32C5, 0x2AE5, 0x2A65, 0x20C6, 0x2106, 0x18A6, 0x18A6, 0x18A6, 0x18A6, 0x18A6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2146, 0x3325, 0x32E5, 0x2AC5, 0x2B05, 0x21E5, 0x1866, 0x18A6, 0x18A6, 0x0806, 0x63A5, 0x9E25, 0x8544, 0x53C3, 0x5C03, 0x5BE3, 
-0x53C3, 0x6C64, 0x8D85, 0x8545, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x3305, 0x2146, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x32C5, 0x32C5, 0x32C5, 0x32E5, 
-0x3285, 0x20C6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2145, 0x3B05, 0x32C5, 0x32C5, 
-0x3305, 0x2A25, 0x18A6, 0x20E6, 0x20E6, 0x1066, 0x5B65, 0x8585, 0x74E4, 0x53C3, 0x53E3, 0x5BE3, 0x53C3, 0x6C64, 0x8D85, 0x8545, 
-0x20C6, 0x20C6, 0x20C6, 0x20C6, 0x20C6, 0x20C6, 0x20C6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20C6, 0x20C6, 0x20C6, 0x20C6, 0x20E6, 0x2106, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20C6, 0x20C6, 0x20C6, 0x20C6, 0x20E6, 0x2106, 0x20E6, 
-0x20E6, 0x20A6, 0x2A25, 0x3305, 0x32E5, 0x32E5, 0x32C5, 0x53C4, 0x53E3, 0x6C64, 0x8D85, 0x8545, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18A6, 0x3265, 0x3B84, 
-0x3B45, 0x3B45, 0x3345, 0x53C4, 0x53C3, 0x6C64, 0x8D85, 0x8545, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x3906, 
-0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x4106, 0x2906, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x3906, 0x3906, 0x3906, 0x3906, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x3906, 0x3906, 0x3906, 
-0x3906, 0x3906, 0x3906, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2146, 0x2165, 0x2165, 0x2165, 0x2126, 0x5384, 
-0x53E3, 0x6C64, 0x8D85, 0x8545, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x3906, 0x4926, 0x4106, 0x4106, 0x4106, 
-0x4106, 0x4906, 0x2906, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x4126, 0x4126, 0x4106, 0x4106, 
-0x3906, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4106, 0x4906, 0x20E6, 
-0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x18A6, 0x1046, 0x1866, 0x1886, 0x1026, 0x4B44, 0x5C03, 0x6C64, 0x8D85, 0x8545, 
-0x2906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 0x4106, 0x4106, 0x4146, 0x49A7, 0x4987, 0x4987, 0x49A7, 0x3126, 0x28E6, 
-0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x2906, 0x4126, 0x4106, 0x4167, 0x49A7, 0x4167, 0x28E6, 0x3106, 0x20E6, 
-0x20E6, 0x20E6, 0x3106, 0x2906, 0x4126, 0x4106, 0x4167, 0x4987, 0x4987, 0x4987, 0x4987, 0x3126, 0x2906, 0x2906, 0x20E6, 0x20E6, 
-0x20E6, 0x18C6, 0x31E5, 0x4AA5, 0x4265, 0x31E5, 0x31C5, 0x53A4, 0x53E3, 0x6C64, 0x8D85, 0x8545, 0x4926, 0x4926, 0x3106, 0x18E6, 
-0x2906, 0x4926, 0x4926, 0x4126, 0x40E6, 0x49A8, 0x52AA, 0x4A6A, 0x4A6A, 0x52AA, 0x49A8, 0x4906, 0x4126, 0x18E6, 0x20E6, 0x20E6, 
-0x18E6, 0x3106, 0x4926, 0x4926, 0x4126, 0x40E5, 0x49E8, 0x52AA, 0x4A49, 0x4906, 0x4926, 0x2906, 0x18E6, 0x3106, 0x4926, 0x4926, 
-0x4126, 0x40E5, 0x49E8, 0x52AA, 0x4A6A, 0x4A6A, 0x52AA, 0x4967, 0x4906, 0x3906, 0x18E6, 0x20E6, 0x20E6, 0x1026, 0x6405, 0xA6A4, 
-0x8DA4, 0x5C43, 0x6463, 0x5C03, 0x53C3, 0x6C64, 0x8D85, 0x8545, 0x4126, 0x4926, 0x2906, 0x18E6, 0x2906, 0x4926, 0x4126, 0x4126, 
-0x4106, 0x4987, 0x528A, 0x4A49, 0x4A49, 0x528A, 0x4987, 0x4106, 0x3906, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x2906, 0x4926, 0x4126, 
-0x4126, 0x40E6, 0x49C8, 0x528A, 0x4A09, 0x4106, 0x4926, 0x2906, 0x18E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x40E6, 0x49C8, 0x4A6A, 
-0x4A49, 0x4A49, 0x4A6A, 0x4147, 0x4906, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x1046, 0x5BA5, 0x8DE5, 0x7D04, 0x53C3, 0x5BE3, 0x5BE3, 
-0x53C3, 0x6C64, 0x8D85, 0x8545, 0x4126, 0x4926, 0x2906, 0x18E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x4106, 0x4987, 0x528A, 0x4A49, 
-0x4A49, 0x528A, 0x4987, 0x4106, 0x3906, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4926, 0x2906, 0x18E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x40E6, 0x49C8, 0x4A6A, 0x4A49, 0x4A49, 0x4A6A, 0x4147, 
-0x4906, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x1886, 0x42C4, 0x5C43, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C3, 0x6C64, 0x8D85, 0x8545, 
-0x4926, 0x4926, 0x3106, 0x18E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x40E6, 0x49A8, 0x52AA, 0x4A6A, 0x4A6A, 0x52AA, 0x49A8, 0x40E6, 
-0x3906, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x3106, 0x4926, 0x4926, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4926, 0x4926, 0x2906, 
-0x18E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x40E5, 0x49E8, 0x52AA, 0x4A6A, 0x4A6A, 0x52AA, 0x4167, 0x4906, 0x3106, 0x18E6, 0x20E6, 
-0x20E6, 0x1886, 0x42E4, 0x6463, 0x5C03, 0x5C03, 0x5C23, 0x5C03, 0x53C3, 0x6C64, 0x8D85, 0x8545, 0x2906, 0x3106, 0x2106, 0x18E6, 
-0x2906, 0x4926, 0x4126, 0x4126, 0x4106, 0x4147, 0x49A7, 0x4987, 0x4987, 0x49A7, 0x4146, 0x4106, 0x3906, 0x18E6, 0x20E6, 0x20E6, 
-0x20E6, 0x2106, 0x3106, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x3106, 0x2106, 0x18E6, 0x2906, 0x4926, 0x4126, 
-0x4126, 0x4106, 0x4167, 0x49A7, 0x4987, 0x4987, 0x4987, 0x4126, 0x4926, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x1886, 0x3265, 0x43A4, 
-0x4364, 0x4364, 0x4344, 0x53C3, 0x53E3, 0x6C64, 0x8D85, 0x8545, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x2906, 0x4926, 0x4126, 0x4126, 
-0x4126, 0x4106, 0x40E6, 0x4106, 0x4106, 0x40E6, 0x4106, 0x4926, 0x4106, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 
-0x4126, 0x4126, 0x4126, 0x4926, 0x3906, 0x18E6, 0x18E6, 0x20E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4126, 0x4126, 0x4106, 0x4106, 
-0x4106, 0x4106, 0x40E6, 0x4106, 0x4926, 0x3906, 0x18E6, 0x20E6, 0x20E6, 0x18A6, 0x2A45, 0x3345, 0x3305, 0x3305, 0x32E5, 0x53C4, 
-0x53E3, 0x6C64, 0x8D85, 0x8545, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x3906, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x3926, 0x3906, 0x3906, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x3906, 0x3906, 0x3906, 
-0x3906, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x2906, 0x4126, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 
-0x3906, 0x3106, 0x20E6, 0x2906, 0x2906, 0x28C6, 0x29E5, 0x32C5, 0x3285, 0x3285, 0x2A65, 0x53C4, 0x53E3, 0x6C64, 0x8D85, 0x8545, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4926, 0x2906, 0x18E6, 
-0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4926, 0x20E6, 0x10E6, 0x2906, 0x4926, 0x4926, 
-0x4926, 0x4926, 0x28E6, 0x18A6, 0x20A6, 0x20A6, 0x1846, 0x4B64, 0x5403, 0x6C64, 0x8D85, 0x8545, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x18E6, 0x4126, 0x4926, 0x4126, 0x4126, 0x4126, 0x4126, 0x4926, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4926, 0x20E6, 0x18E6, 0x2906, 0x4906, 0x4106, 0x4106, 0x4906, 0x28E6, 0x18E6, 
-0x20E6, 0x20E6, 0x18A6, 0x5384, 0x5C03, 0x6CA4, 0x95C5, 0x8D85, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x20E6, 0x3906, 0x4106, 0x4187, 0x4A49, 0x4A29, 0x4A29, 0x4A49, 0x4187, 0x4106, 0x3906, 0x18E6, 0x18A6, 0x32C5, 
-0x3B24, 0x3B25, 0x4345, 0x3B45, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x3906, 
-0x4106, 0x4987, 0x528A, 0x4A49, 0x4A49, 0x528A, 0x4987, 0x4106, 0x3906, 0x18E6, 0x18A6, 0x32C5, 0x3B65, 0x3B45, 0x3B66, 0x3B45, 
-0x20E6, 0x18E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x3106, 0x3106, 0x3106, 
-0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 
-0x3106, 0x3106, 0x3106, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x3106, 0x4106, 0x4106, 0x4987, 0x528A, 0x4A49, 
-0x4A49, 0x528A, 0x4987, 0x4106, 0x4126, 0x3106, 0x30E6, 0x29C5, 0x2A25, 0x21C4, 0x21C2, 0x19C2, 0x20E6, 0x18E6, 0x3906, 0x4926, 
-0x4926, 0x4926, 0x4926, 0x2906, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x4926, 0x4926, 0x4926, 0x4926, 0x4106, 0x18E6, 0x20E6, 0x20E6, 
-0x18E6, 0x3106, 0x4926, 0x4926, 0x4926, 0x4926, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x4126, 0x4926, 0x4926, 0x4926, 0x4906, 
-0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x2906, 0x4926, 0x4926, 0x4106, 0x40E6, 0x4987, 0x528A, 0x4A49, 0x4A49, 0x528A, 0x4987, 0x4106, 
-0x4126, 0x4926, 0x4926, 0x20C6, 0x20C7, 0x1043, 0x0000, 0x0000, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4146, 0x4946, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4106, 0x4126, 0x4146, 0x3926, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4926, 0x4126, 
-0x4126, 0x4946, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4146, 0x4146, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x4926, 0x4126, 0x4126, 0x4126, 0x49A7, 0x4A49, 0x4A29, 0x4A29, 0x4A69, 0x4187, 0x4106, 0x4126, 0x4146, 0x4946, 0x2906, 
-0x2906, 0x18A4, 0x0000, 0x0000, 0x4126, 0x4126, 0x4126, 0x4106, 0x4147, 0x528A, 0x4A8A, 0x4167, 0x4106, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x40E6, 0x49E8, 0x52AA, 0x4A29, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4126, 0x4A6A, 0x528A, 0x49A7, 0x4106, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x40E6, 0x49A7, 0x528A, 0x4A69, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4A29, 
-0x52AA, 0x49E8, 0x40C5, 0x4106, 0x4106, 0x4106, 0x4106, 0x4106, 0x4147, 0x528A, 0x4A8A, 0x4167, 0x4927, 0x28A4, 0x0000, 0x0000, 
-0x4126, 0x4126, 0x4126, 0x4106, 0x4167, 0x52AA, 0x52AA, 0x4167, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x40E5, 0x49E8, 0x52AA, 
-0x4A29, 0x40E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4126, 0x526A, 0x52AA, 0x49A7, 0x40E6, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x40E6, 0x49A7, 0x52AA, 0x4A6A, 0x4126, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x40E6, 0x4A49, 0x52AA, 0x49E8, 0x40E5, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4106, 0x4167, 0x52AA, 0x52AA, 0x4167, 0x4927, 0x28A4, 0x0000, 0x0000, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4167, 0x4167, 0x4126, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4147, 0x4167, 0x4147, 0x4106, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4167, 0x4126, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4126, 0x4167, 0x4167, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4147, 0x4167, 0x4147, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4167, 0x4167, 0x4126, 0x4947, 0x28A4, 0x0000, 0x0000, 0x4926, 0x4926, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4126, 
-0x4926, 0x4926, 0x4926, 0x4126, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4926, 0x4926, 0x4926, 0x4926, 0x4126, 0x4126, 0x4126, 
-0x4106, 0x4106, 0x4106, 0x4926, 0x4926, 0x4926, 0x4926, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4126, 0x4926, 0x4926, 0x4926, 
-0x4126, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4926, 0x4926, 0x4926, 0x4926, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4927, 
-0x5168, 0x30C4, 0x0000, 0x0000, 0x3906, 0x3106, 0x3926, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3106, 0x3906, 0x3906, 0x3906, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x3906, 0x3906, 0x3106, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3106, 
-0x3906, 0x3906, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3926, 0x3106, 0x3906, 0x3906, 0x3106, 0x3926, 0x4126, 0x4126, 0x4126, 0x4126, 0x30C4, 0x30C4, 0x1862, 0x0000, 0x0000, 
-0x18E6, 0x10E5, 0x3106, 0x4926, 0x4106, 0x4106, 0x4926, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x4126, 0x4106, 0x4106, 0x4126, 
-0x3906, 0x18E5, 0x18E6, 0x18E6, 0x18E5, 0x2906, 0x4926, 0x4106, 0x4106, 0x4926, 0x2906, 0x18E5, 0x18E6, 0x18E6, 0x18E5, 0x3906, 
-0x4126, 0x4106, 0x4106, 0x4126, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x4926, 0x4106, 0x4106, 0x4926, 0x3106, 0x10E5, 0x18E6, 
-0x18E6, 0x10E5, 0x3106, 0x4926, 0x4106, 0x4106, 0x4947, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x20E6, 0x18E6, 0x3106, 0x4926, 
-0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4106, 0x4126, 0x4126, 0x4126, 0x3906, 0x18E6, 0x20E6, 0x20E6, 
-0x18E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x4926, 0x2906, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x28E6, 0x4926, 0x4126, 0x4126, 0x4926, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x3106, 0x4926, 
-0x4126, 0x4126, 0x4947, 0x1042, 0x2104, 0x10A2, 0x10A2, 0x10A2, 
-};
-
-// grass_tile_middle.png
-// Size: 60x38 (4560 bytes)
-const uint16_t grass_tile_middle_bmp[2280] = {
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 
-0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 
-0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 
-0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 
-0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x53C3, 0x53A3, 0x53C3, 0x53E3, 0x53E3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53E3, 0x53E3, 
-0x53E3, 0x53E3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53E3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53A3, 0x53C3, 0x53E3, 
-0x53E3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53E3, 0x53E3, 0x53E3, 0x53E3, 0x53E3, 0x53C3, 0x53C3, 0x53C3, 
-0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53E3, 0x53E3, 0x53E3, 0x53E3, 0x53E3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53E3, 0x53E3, 
-0x6444, 0x6444, 0x5BE4, 0x4BA4, 0x53C4, 0x5C03, 0x5BE3, 0x5BE3, 0x5C03, 0x53E3, 0x53A4, 0x53C4, 0x53C4, 0x53C4, 0x53E3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x53C4, 0x53A4, 0x53C3, 0x5C03, 0x5BE3, 0x6444, 0x6444, 0x5BE4, 0x4BA4, 0x53C4, 0x5C03, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x5C03, 0x5BE3, 0x5BE3, 0x5BE3, 0x5C03, 0x6444, 0x6444, 
-0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x5C03, 0x5BE3, 0x5BE3, 0x5C03, 0x53E3, 0x53A4, 0x53C4, 0x8585, 0x95E5, 0x53E5, 0x2285, 
-0x3B05, 0x5C03, 0x5BE3, 0x5BE3, 0x5C03, 0x4B84, 0x2AC5, 0x32E5, 0x32E5, 0x2AC5, 0x4B84, 0x5C03, 0x5BE3, 0x5BE3, 0x5C03, 0x3B25, 
-0x2AC5, 0x4344, 0x5C03, 0x5C03, 0x8585, 0x95E5, 0x53E5, 0x2285, 0x3B05, 0x5C03, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x32E5, 0x32E5, 0x32E5, 0x32E5, 0x3B05, 0x5C03, 0x5BE3, 0x5BE3, 0x53C3, 0x6C84, 0x95C5, 0x8585, 0x32E5, 0x32E5, 0x32E5, 0x32E5, 
-0x3B05, 0x5C03, 0x5BE3, 0x5BE3, 0x5C03, 0x4B84, 0x2AC5, 0x32E5, 0x8D85, 0x95C5, 0x5405, 0x2AE5, 0x3B44, 0x5C03, 0x5C03, 0x53E3, 
-0x5BE3, 0x4BA4, 0x3305, 0x3B25, 0x3B25, 0x3305, 0x4BA4, 0x5C03, 0x5BE3, 0x53C3, 0x5BE3, 0x3B44, 0x3305, 0x4384, 0x6423, 0x5C03, 
-0x8D85, 0x95C5, 0x5405, 0x2AE5, 0x3B44, 0x5C03, 0x5BE3, 0x5BE3, 0x5C03, 0x53E3, 0x53C3, 0x53C3, 0x3B25, 0x3B25, 0x3B25, 0x3325, 
-0x4344, 0x6423, 0x5C03, 0x5C03, 0x53E3, 0x6CA4, 0x95C5, 0x8585, 0x3B25, 0x3B25, 0x3B25, 0x3325, 0x3B44, 0x5C03, 0x5C03, 0x53E3, 
-0x5BE3, 0x4BA4, 0x3305, 0x3B25, 0x3B45, 0x4385, 0x2A05, 0x18C6, 0x29A5, 0x5C43, 0x53C3, 0x74E4, 0x8DA4, 0x5BA5, 0x1086, 0x2126, 
-0x2126, 0x18C6, 0x42E4, 0x5C23, 0x5C24, 0x8545, 0x85A4, 0x31E5, 0x18C6, 0x29E5, 0x3B64, 0x3B25, 0x3B45, 0x4385, 0x2A05, 0x18C6, 
-0x29A5, 0x5C43, 0x5BE3, 0x5BE3, 0x53C3, 0x6464, 0x8565, 0x7D24, 0x2126, 0x2126, 0x2126, 0x2106, 0x2985, 0x3B64, 0x3B25, 0x3B25, 
-0x3B25, 0x3B25, 0x4345, 0x3B45, 0x2126, 0x2126, 0x2126, 0x2106, 0x29A5, 0x5C43, 0x53C3, 0x74E4, 0x8DA4, 0x5BA5, 0x1086, 0x2126, 
-0x3345, 0x3B84, 0x29C5, 0x1866, 0x2965, 0x6463, 0x5BE3, 0x8564, 0x9E45, 0x63C5, 0x1026, 0x20E6, 0x20E6, 0x1866, 0x42E4, 0x6463, 
-0x6463, 0x95C5, 0x9E24, 0x31C6, 0x1866, 0x29C5, 0x3BA4, 0x3B45, 0x3345, 0x3B84, 0x29C5, 0x1866, 0x2965, 0x6463, 0x5C03, 0x5C03, 
-0x5BE3, 0x74A4, 0x95E5, 0x8DA5, 0x20E6, 0x20E6, 0x20E6, 0x20C6, 0x2145, 0x3B84, 0x3B45, 0x3B45, 0x3B45, 0x3B45, 0x3345, 0x3B25, 
-0x20E6, 0x20E6, 0x20E6, 0x18C6, 0x2965, 0x6463, 0x5BE3, 0x8564, 0x9E45, 0x63C5, 0x1026, 0x20E6, 0x2A05, 0x2A25, 0x2165, 0x18A6, 
-0x2965, 0x4BC4, 0x4364, 0x5C04, 0x6485, 0x42E5, 0x1886, 0x20E6, 0x20E6, 0x1886, 0x3A85, 0x4BC4, 0x4BA4, 0x5C45, 0x6484, 0x2986, 
-0x18A6, 0x2165, 0x2A25, 0x2A05, 0x2A05, 0x2A25, 0x2165, 0x18A6, 0x2965, 0x4BC4, 0x4B84, 0x4B84, 0x4364, 0x53C4, 0x6445, 0x5C25, 
-0x2106, 0x20E6, 0x20E6, 0x20E6, 0x2126, 0x2A25, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x20E6, 0x20E6, 0x20E6, 0x20C6, 
-0x2965, 0x4BC4, 0x4364, 0x5C04, 0x6485, 0x42E5, 0x1866, 0x20E6, 0x18A6, 0x18A6, 0x20E6, 0x20E6, 0x2146, 0x3325, 0x32E5, 0x2AC5, 
-0x2AE5, 0x2A05, 0x20A6, 0x20E6, 0x20E6, 0x20A6, 0x2A25, 0x3325, 0x32E5, 0x2AC5, 0x2B05, 0x2146, 0x20E6, 0x20C6, 0x18A6, 0x18A6, 
-0x18A6, 0x18A6, 0x20E6, 0x20E6, 0x2146, 0x3325, 0x32E5, 0x32E5, 0x3305, 0x32E5, 0x2AC5, 0x2AC5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x18A6, 0x18A6, 0x18A6, 0x18A6, 0x18A6, 0x18A6, 0x18A6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2146, 0x3325, 0x32E5, 0x2AC5, 
-0x2AE5, 0x2A05, 0x20A6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2145, 0x3B05, 0x32C5, 0x32C5, 0x3305, 0x2A25, 0x18A6, 0x20E6, 
-0x20E6, 0x18A6, 0x2A05, 0x3305, 0x32C5, 0x32C5, 0x3305, 0x2146, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2145, 0x3B05, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2145, 0x3B05, 0x32C5, 0x32C5, 0x3305, 0x2A25, 0x18A6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20C6, 0x20C6, 0x20C6, 0x20C6, 0x20E6, 0x2106, 0x20E6, 0x20E6, 0x2106, 0x20E6, 0x20C6, 
-0x20C6, 0x20C6, 0x20C6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20C6, 0x20C6, 0x20C6, 
-0x20C6, 0x20C6, 0x20C6, 0x20C6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20C6, 0x20C6, 0x20C6, 0x20C6, 0x20E6, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4106, 0x3906, 0x3906, 
-0x3906, 0x3106, 0x18E6, 0x20E6, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x3906, 0x3906, 0x3906, 0x3906, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x3906, 0x3906, 0x3906, 
-0x3906, 0x3906, 0x3906, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4106, 0x3906, 0x3906, 
-0x3906, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x2106, 0x4926, 0x4126, 0x4106, 0x4906, 0x3106, 0x18E6, 0x18E6, 
-0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4106, 0x4906, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x4126, 0x4126, 0x4106, 0x4106, 
-0x3906, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4106, 0x4906, 0x20E6, 
-0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x2106, 0x4926, 0x4126, 0x4106, 0x4906, 0x3106, 0x18E6, 0x18E6, 
-0x20E6, 0x20E6, 0x2906, 0x2906, 0x3106, 0x4126, 0x4106, 0x4167, 0x49A7, 0x3947, 0x28E6, 0x2906, 0x4126, 0x4106, 0x4167, 0x4987, 
-0x4987, 0x4987, 0x4987, 0x3126, 0x2906, 0x2906, 0x2906, 0x2906, 0x4126, 0x4106, 0x4167, 0x49A7, 0x4167, 0x28E6, 0x3106, 0x20E6, 
-0x20E6, 0x20E6, 0x3106, 0x2906, 0x4126, 0x4106, 0x4167, 0x4987, 0x4987, 0x4987, 0x4987, 0x3126, 0x2906, 0x2906, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x2906, 0x2906, 0x3106, 0x4126, 0x4106, 0x4167, 0x49A7, 0x3947, 0x28E6, 0x2906, 0x20E6, 0x18E6, 0x3906, 0x4926, 
-0x4926, 0x4126, 0x40E6, 0x4A49, 0x52AA, 0x4A08, 0x48E6, 0x4926, 0x4126, 0x40E5, 0x49E8, 0x52AA, 0x4A6A, 0x4A6A, 0x52AA, 0x4967, 
-0x4906, 0x4926, 0x4926, 0x4926, 0x4126, 0x40E5, 0x49E8, 0x52AA, 0x4A49, 0x4906, 0x4926, 0x2906, 0x18E6, 0x3106, 0x4926, 0x4926, 
-0x4126, 0x40E5, 0x49E8, 0x52AA, 0x4A6A, 0x4A6A, 0x52AA, 0x4967, 0x4906, 0x3906, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x3906, 0x4926, 
-0x4926, 0x4126, 0x40E6, 0x4A49, 0x52AA, 0x4A08, 0x48E6, 0x4926, 0x20E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4126, 0x4106, 0x4A09, 
-0x528A, 0x49C8, 0x40E5, 0x4126, 0x4126, 0x40E6, 0x49C8, 0x4A6A, 0x4A49, 0x4A49, 0x4A6A, 0x4147, 0x4106, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x40E6, 0x49C8, 0x528A, 0x4A09, 0x4106, 0x4926, 0x2906, 0x18E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x40E6, 0x49C8, 0x4A6A, 
-0x4A49, 0x4A49, 0x4A6A, 0x4147, 0x4906, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4126, 0x4106, 0x4A09, 
-0x528A, 0x49C8, 0x40E6, 0x4126, 0x20E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x40E6, 0x49C8, 0x4A6A, 0x4A49, 0x4A49, 0x4A6A, 0x4147, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4926, 0x2906, 0x18E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x40E6, 0x49C8, 0x4A6A, 0x4A49, 0x4A49, 0x4A6A, 0x4147, 
-0x4906, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x20E6, 0x18E6, 0x3906, 0x4926, 0x4926, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4926, 0x4926, 0x4126, 0x40E5, 0x49E8, 0x52AA, 
-0x4A6A, 0x4A6A, 0x52AA, 0x4167, 0x4106, 0x4126, 0x4926, 0x4926, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4926, 0x4926, 0x2906, 
-0x18E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x40E5, 0x49E8, 0x52AA, 0x4A6A, 0x4A6A, 0x52AA, 0x4167, 0x4906, 0x3106, 0x18E6, 0x20E6, 
-0x20E6, 0x18E6, 0x3906, 0x4926, 0x4926, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4926, 0x4926, 0x20E6, 0x20E6, 0x2906, 0x2906, 
-0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x2906, 0x2906, 0x4126, 0x4106, 0x4167, 0x49A7, 0x4987, 0x4987, 0x4987, 0x4126, 
-0x4106, 0x3906, 0x2906, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x3106, 0x2106, 0x18E6, 0x2906, 0x4926, 0x4126, 
-0x4126, 0x4106, 0x4167, 0x49A7, 0x4987, 0x4987, 0x4987, 0x4126, 0x4926, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 
-0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x20E6, 0x4926, 0x4126, 0x4126, 
-0x4926, 0x3106, 0x18E6, 0x18E6, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4106, 0x40E6, 0x4106, 0x4926, 0x3106, 0x18E6, 0x18E6, 
-0x4126, 0x4126, 0x4126, 0x4926, 0x3906, 0x18E6, 0x18E6, 0x20E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4126, 0x4126, 0x4106, 0x4106, 
-0x4106, 0x4106, 0x40E6, 0x4106, 0x4926, 0x3906, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x20E6, 0x4926, 0x4126, 0x4126, 
-0x4926, 0x3106, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x3906, 0x3906, 0x3906, 0x4106, 0x3106, 0x18E6, 0x20E6, 
-0x3906, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3906, 0x3106, 0x18E6, 0x20E6, 0x3906, 0x3906, 0x3906, 0x3906, 
-0x3906, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x2906, 0x4126, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 
-0x3906, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x3906, 0x3906, 0x3906, 0x4106, 0x3106, 0x18E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x3106, 0x4926, 
-0x4126, 0x4126, 0x4926, 0x20E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4926, 0x20E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x3906, 0x4926, 0x4126, 0x4126, 0x4926, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4926, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 
-0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x18E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x3106, 0x3106, 0x3106, 
-0x3106, 0x3106, 0x3106, 0x20E6, 0x18E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 
-0x3106, 0x3106, 0x3106, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x3106, 0x3106, 0x3106, 0x2906, 0x18E6, 0x20E6, 
-0x20E6, 0x18E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x3906, 0x4926, 
-0x4926, 0x4926, 0x4926, 0x2906, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x4926, 0x4926, 0x4926, 0x4926, 0x4926, 0x4926, 0x4926, 0x2906, 
-0x18E6, 0x3106, 0x4926, 0x4926, 0x4926, 0x4926, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x4126, 0x4926, 0x4926, 0x4926, 0x4906, 
-0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x2906, 0x4926, 0x4926, 0x4926, 0x4926, 0x3906, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x3906, 0x4926, 
-0x4926, 0x4926, 0x4926, 0x2906, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4146, 0x4946, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4106, 0x4126, 0x4146, 0x4126, 0x4106, 0x4926, 0x2906, 0x20E6, 0x3106, 0x4926, 0x4126, 
-0x4126, 0x4946, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4146, 0x4146, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x4926, 0x4126, 0x4126, 0x4946, 0x3926, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4146, 0x4946, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4106, 0x4147, 0x528A, 0x4A8A, 0x4167, 0x4106, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x40E6, 0x49E8, 0x52AA, 0x4A29, 0x40E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4126, 0x4A6A, 0x528A, 0x49A7, 0x4106, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x40E6, 0x49A7, 0x528A, 0x4A69, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4A29, 
-0x52AA, 0x49E8, 0x40E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4147, 0x528A, 0x4A8A, 0x4167, 0x4106, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4106, 0x4167, 0x52AA, 0x52AA, 0x4167, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x40E5, 0x49E8, 0x52AA, 
-0x4A29, 0x40E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4126, 0x526A, 0x52AA, 0x49A7, 0x40E6, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x40E6, 0x49A7, 0x52AA, 0x4A6A, 0x4126, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x40E6, 0x4A49, 0x52AA, 0x49E8, 0x40E5, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4106, 0x4167, 0x52AA, 0x52AA, 0x4167, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4167, 0x4167, 0x4126, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4147, 0x4167, 0x4147, 0x4106, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4167, 0x4126, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4126, 0x4167, 0x4167, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4147, 0x4167, 0x4147, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4167, 0x4167, 0x4126, 0x4106, 0x4126, 0x4126, 0x4126, 0x4926, 0x4926, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4126, 
-0x4926, 0x4926, 0x4926, 0x4126, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4126, 0x4126, 0x4126, 0x4926, 0x4126, 0x4126, 0x4126, 
-0x4106, 0x4106, 0x4106, 0x4926, 0x4926, 0x4926, 0x4926, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4126, 0x4926, 0x4926, 0x4926, 
-0x4126, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4926, 0x4926, 0x4926, 0x4926, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4126, 
-0x4926, 0x4926, 0x4926, 0x4126, 0x3906, 0x3106, 0x3926, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3106, 0x3906, 0x3906, 0x3906, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3106, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3106, 
-0x3906, 0x3906, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3926, 0x3106, 0x3906, 0x3906, 0x3106, 0x3926, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3106, 0x3906, 0x3906, 0x3906, 
-0x18E6, 0x10E5, 0x3106, 0x4926, 0x4106, 0x4106, 0x4926, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x4126, 0x4106, 0x4106, 0x4106, 
-0x4106, 0x4106, 0x4926, 0x20E6, 0x10E5, 0x2906, 0x4926, 0x4106, 0x4106, 0x4926, 0x2906, 0x18E5, 0x18E6, 0x18E6, 0x18E5, 0x3906, 
-0x4126, 0x4106, 0x4106, 0x4126, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x4926, 0x4106, 0x4106, 0x4926, 0x3106, 0x10E5, 0x18E6, 
-0x18E6, 0x10E5, 0x3106, 0x4926, 0x4106, 0x4106, 0x4926, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x18E6, 0x3106, 0x4926, 
-0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x18E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x4926, 0x2906, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x28E6, 0x4926, 0x4126, 0x4126, 0x4926, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x3106, 0x4926, 
-0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-};
-
-// grass_tile_left.png
-// Size: 60x38 (4560 bytes)
-const uint16_t grass_tile_left_bmp[2280] = {
-0x8545, 0x8564, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8565, 0x8545, 0x8544, 
-0x8565, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 
-0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 
-0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 
-0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8D85, 0x8545, 0x8545, 0x8545, 0x8565, 0x7D24, 0x6464, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x8545, 0x8545, 0x8565, 0x8D85, 0x7D04, 0x4BA3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 
-0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53E3, 0x53E3, 0x53E3, 0x53E3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 
-0x53C3, 0x53E3, 0x53E3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53E3, 0x53E3, 0x53E3, 0x53E3, 0x53E3, 0x53C3, 0x53C3, 0x53C3, 
-0x53C3, 0x53C3, 0x53E3, 0x53E3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53E3, 0x53E3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 0x53C3, 
-0x8545, 0x8565, 0x7D24, 0x7D04, 0x74C4, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x5BE3, 0x5BE3, 0x5C23, 0x6444, 0x5C24, 0x53A4, 0x53A4, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x5C03, 0x5BE3, 0x5BE3, 0x5C03, 0x53E3, 0x53A4, 0x53C4, 
-0x5BE3, 0x5BE3, 0x5C23, 0x6444, 0x5C24, 0x53A4, 0x53A4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x8545, 0x8D85, 0x6464, 0x4BA3, 
-0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5C03, 0x3B25, 
-0x32E5, 0x32E5, 0x32E5, 0x32E5, 0x5BE3, 0x53C3, 0x74E4, 0x95C5, 0x7D05, 0x2AA5, 0x2AC5, 0x53C4, 0x5C03, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x32E5, 0x32E5, 0x32E5, 0x32E5, 0x3B05, 0x5C03, 0x5BE3, 0x5BE3, 0x5C03, 0x4B84, 0x2AC5, 0x32E5, 0x5BE3, 0x53C3, 0x74E4, 0x95C5, 
-0x7D05, 0x2AA5, 0x2AC5, 0x53C4, 0x5C03, 0x5BE3, 0x5BE3, 0x5BE3, 0x8545, 0x8D85, 0x6C64, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5C03, 0x5C03, 0x5C03, 0x5C03, 0x5C03, 0x5C03, 0x5BE3, 0x5BE3, 0x53C3, 0x5BE3, 0x3B44, 0x3325, 0x3B25, 0x3B25, 0x3B25, 
-0x5C03, 0x53C3, 0x74E4, 0x95C5, 0x7D05, 0x32E5, 0x3325, 0x53C4, 0x5C03, 0x53E3, 0x53C3, 0x53C3, 0x3B25, 0x3B25, 0x3B25, 0x3325, 
-0x3B44, 0x5C03, 0x5C03, 0x53E3, 0x5BE3, 0x4BA4, 0x3305, 0x3B25, 0x5C03, 0x53C3, 0x74E4, 0x95C5, 0x7D05, 0x32E5, 0x3325, 0x53C4, 
-0x5C03, 0x5BE3, 0x5BE3, 0x5BE3, 0x8545, 0x8D85, 0x6C64, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5C03, 0x4BA4, 0x3305, 0x3B25, 
-0x3B25, 0x3305, 0x4BA4, 0x5C03, 0x5C24, 0x8545, 0x85A4, 0x31E5, 0x20E6, 0x2126, 0x2126, 0x2126, 0x3B24, 0x3B24, 0x3B25, 0x4365, 
-0x3AE5, 0x20E6, 0x18E6, 0x5364, 0x53E3, 0x6464, 0x8565, 0x7D24, 0x2126, 0x2126, 0x2126, 0x2106, 0x29A5, 0x5C43, 0x53C3, 0x74E4, 
-0x8DA4, 0x5BA5, 0x1086, 0x2126, 0x3B24, 0x3B24, 0x3B25, 0x4365, 0x3AE5, 0x20E6, 0x18E6, 0x5364, 0x5C03, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x8545, 0x8D85, 0x6C64, 0x53C3, 0x5BE3, 0x5BE3, 0x5C03, 0x53C3, 0x53C3, 0x4B84, 0x3325, 0x3B45, 0x3B45, 0x3325, 0x53C4, 0x5C03, 
-0x6463, 0x95C5, 0x9E24, 0x31C6, 0x18A6, 0x20E6, 0x20E6, 0x20E6, 0x3B45, 0x3B45, 0x3B45, 0x3B65, 0x32C5, 0x18A6, 0x1886, 0x5384, 
-0x5C03, 0x74A4, 0x95E5, 0x8DA5, 0x20E6, 0x20E6, 0x20E6, 0x18C6, 0x2965, 0x6463, 0x5BE3, 0x8564, 0x9E45, 0x63C5, 0x1026, 0x20E6, 
-0x3B45, 0x3B45, 0x3B45, 0x3B65, 0x32C5, 0x18A6, 0x1886, 0x5384, 0x6443, 0x5C03, 0x5C03, 0x5C03, 0x8545, 0x8D85, 0x6C64, 0x53C3, 
-0x5BE3, 0x5BE3, 0x53E3, 0x6C84, 0x74E4, 0x53A4, 0x21A5, 0x2A05, 0x2A05, 0x29C5, 0x3AE4, 0x4BA4, 0x4BA4, 0x5C45, 0x6484, 0x2986, 
-0x18C6, 0x20E6, 0x20E6, 0x20E6, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x29C5, 0x20C6, 0x18A6, 0x4304, 0x4B84, 0x53C4, 0x6445, 0x5C25, 
-0x2106, 0x20E6, 0x20E6, 0x20C6, 0x2965, 0x4BC4, 0x4364, 0x5C04, 0x6485, 0x42E5, 0x1866, 0x20E6, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 
-0x29C5, 0x20C6, 0x18A6, 0x4304, 0x4BA4, 0x4B84, 0x4B84, 0x4B84, 0x8545, 0x8D85, 0x6C64, 0x53C3, 0x5BE3, 0x5C03, 0x53C3, 0x8544, 
-0x9E25, 0x63A5, 0x1006, 0x18A6, 0x18A6, 0x1846, 0x2A05, 0x3345, 0x32E5, 0x2AC5, 0x2B05, 0x2146, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x18A6, 0x18A6, 0x18A6, 0x18A6, 0x20A6, 0x2106, 0x20A6, 0x32A5, 0x3305, 0x32E5, 0x2AC5, 0x2AC5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2146, 0x3325, 0x32E5, 0x2AC5, 0x2AE5, 0x2A05, 0x20A6, 0x20E6, 0x18A6, 0x18A6, 0x18A6, 0x18A6, 0x20A6, 0x2106, 0x20A6, 0x32A5, 
-0x3305, 0x32E5, 0x32E5, 0x32E5, 0x8545, 0x8D85, 0x6C64, 0x53C3, 0x5BE3, 0x53E3, 0x53C3, 0x74E4, 0x8585, 0x5B65, 0x1066, 0x20E6, 
-0x20E6, 0x18A6, 0x2A05, 0x3305, 0x32C5, 0x32C5, 0x3305, 0x2146, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20C6, 0x3285, 0x32E5, 0x32C5, 0x32C5, 0x32C5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2145, 0x3B05, 0x32C5, 0x32C5, 
-0x3305, 0x2A25, 0x18A6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20C6, 0x3285, 0x32E5, 0x32C5, 0x32C5, 0x32C5, 
-0x8545, 0x8D85, 0x6C64, 0x53E3, 0x53C4, 0x32C5, 0x32E5, 0x32E5, 0x3305, 0x2A25, 0x18A6, 0x20E6, 0x20E6, 0x2106, 0x20E6, 0x20C6, 
-0x20C6, 0x20C6, 0x20C6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x20C6, 
-0x20C6, 0x20C6, 0x20C6, 0x20C6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20C6, 0x20C6, 0x20C6, 0x20C6, 0x20E6, 0x2106, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x20C6, 0x20C6, 0x20C6, 0x20C6, 0x20C6, 0x8545, 0x8D85, 0x6C64, 0x53C3, 
-0x53C4, 0x3345, 0x3B45, 0x3B45, 0x3B84, 0x3265, 0x18A6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 
-0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 
-0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 
-0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x8545, 0x8D85, 0x6C64, 0x53E3, 0x5384, 0x2126, 0x2165, 0x2165, 
-0x2985, 0x2146, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4106, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x20E6, 0x18E6, 0x3106, 0x3906, 
-0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x3106, 0x3906, 0x3906, 0x3906, 0x3906, 0x2106, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x8545, 0x8D85, 0x6C64, 0x5403, 0x4B44, 0x1026, 0x1886, 0x1066, 0x1046, 0x18A6, 0x2106, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x2106, 0x4926, 0x4126, 0x4106, 0x4106, 0x4106, 0x4106, 0x4106, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 
-0x20E6, 0x18E6, 0x18E6, 0x3906, 0x4926, 0x4106, 0x4106, 0x4106, 0x18E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4106, 0x4106, 0x4106, 
-0x4906, 0x3106, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4106, 0x4906, 0x20E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 
-0x8545, 0x8D85, 0x6C64, 0x53E3, 0x53A4, 0x31C5, 0x31E5, 0x4265, 0x4AA5, 0x31E5, 0x18C6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 
-0x3106, 0x4126, 0x4106, 0x4167, 0x4987, 0x4987, 0x4987, 0x4187, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 0x4106, 
-0x4106, 0x4146, 0x49A7, 0x4187, 0x2906, 0x2906, 0x3906, 0x4126, 0x4126, 0x4987, 0x4987, 0x4987, 0x4987, 0x3947, 0x28E6, 0x2906, 
-0x2906, 0x2906, 0x3906, 0x4126, 0x4126, 0x4987, 0x4987, 0x3126, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x8545, 0x8D85, 0x6C64, 0x53C3, 
-0x5C03, 0x6463, 0x5C23, 0x8DA4, 0xA6A4, 0x6405, 0x1026, 0x20E6, 0x20E6, 0x18E6, 0x3906, 0x4926, 0x4926, 0x4126, 0x40E6, 0x4A49, 
-0x528A, 0x4A6A, 0x4A8A, 0x528A, 0x4926, 0x4926, 0x3106, 0x18E6, 0x2906, 0x4926, 0x4926, 0x4126, 0x40E6, 0x49A8, 0x52AA, 0x528A, 
-0x4926, 0x4926, 0x4126, 0x4106, 0x4167, 0x52AA, 0x4A6A, 0x4A6A, 0x52AA, 0x49E8, 0x48E6, 0x4926, 0x4926, 0x4926, 0x4126, 0x4106, 
-0x4167, 0x52AA, 0x52AA, 0x4967, 0x4906, 0x3906, 0x18E6, 0x20E6, 0x8545, 0x8D85, 0x6C64, 0x53C3, 0x5BE3, 0x5BE3, 0x53C3, 0x7D04, 
-0x8DE4, 0x5BA5, 0x1046, 0x20E6, 0x20E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4126, 0x4106, 0x4A09, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 
-0x4126, 0x4926, 0x2906, 0x18E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x4106, 0x4987, 0x528A, 0x4A49, 0x4126, 0x4126, 0x4126, 0x4106, 
-0x4147, 0x4A6A, 0x4A49, 0x4A49, 0x4A6A, 0x49C8, 0x40E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4147, 0x4A6A, 0x4A6A, 0x4147, 
-0x4906, 0x3106, 0x18E6, 0x20E6, 0x8545, 0x8D85, 0x6C64, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6443, 0x42C4, 0x1886, 0x20E6, 
-0x20E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4126, 0x4106, 0x4A09, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4126, 0x4926, 0x2906, 0x18E6, 
-0x2906, 0x4926, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4147, 0x4A6A, 0x4A49, 0x4A49, 
-0x4A6A, 0x49C8, 0x40E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4926, 0x3106, 0x18E6, 0x20E6, 
-0x8545, 0x8D85, 0x6C64, 0x53C3, 0x5C03, 0x5C23, 0x5C03, 0x5C03, 0x6463, 0x42E4, 0x1886, 0x20E6, 0x20E6, 0x18E6, 0x3106, 0x4926, 
-0x4126, 0x4126, 0x40E6, 0x4A49, 0x528A, 0x4A6A, 0x4A8A, 0x4A6A, 0x4126, 0x4926, 0x2906, 0x18E6, 0x2906, 0x4926, 0x4926, 0x4126, 
-0x4126, 0x4126, 0x4106, 0x4106, 0x4926, 0x4926, 0x4126, 0x4106, 0x4167, 0x52AA, 0x4A6A, 0x4A6A, 0x52AA, 0x49E8, 0x40E5, 0x4126, 
-0x4926, 0x4926, 0x4126, 0x4126, 0x4126, 0x4106, 0x4106, 0x4926, 0x4926, 0x3906, 0x18E6, 0x20E6, 0x8545, 0x8D85, 0x6C64, 0x53C3, 
-0x53E3, 0x4344, 0x4364, 0x4364, 0x43A4, 0x3265, 0x18A6, 0x20E6, 0x20E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4126, 0x4106, 0x4187, 
-0x4987, 0x4987, 0x4987, 0x4987, 0x4126, 0x4926, 0x2906, 0x18E6, 0x20E6, 0x3106, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x2906, 0x2906, 0x3906, 0x4106, 0x4126, 0x4987, 0x4987, 0x4987, 0x4987, 0x4167, 0x4106, 0x4126, 0x2906, 0x2906, 0x3906, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x3106, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x8545, 0x8D85, 0x6C64, 0x53E3, 0x53C4, 0x32E5, 0x3305, 0x3305, 
-0x3345, 0x2A45, 0x18A6, 0x20E6, 0x20E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4106, 0x4106, 
-0x4126, 0x4926, 0x3106, 0x18E6, 0x20E6, 0x18E6, 0x18E6, 0x3906, 0x4926, 0x4126, 0x4126, 0x4126, 0x18E6, 0x18E6, 0x3106, 0x4926, 
-0x4106, 0x40E6, 0x4106, 0x4106, 0x40E6, 0x4106, 0x4126, 0x4126, 0x18E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4126, 0x4926, 0x20E6, 
-0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x8545, 0x8D85, 0x6C64, 0x53E3, 0x53C4, 0x2A65, 0x3285, 0x3285, 0x32C5, 0x29E5, 0x18A6, 0x20E6, 
-0x2906, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x4126, 0x2906, 0x18E6, 
-0x20E6, 0x20E6, 0x18E6, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x20E6, 0x18E6, 0x3106, 0x3906, 0x3906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x3906, 0x3906, 0x20E6, 0x18E6, 0x3106, 0x4106, 0x3906, 0x3906, 0x4126, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x8545, 0x8D85, 0x6C64, 0x53E3, 0x4B64, 0x1846, 0x20A6, 0x20A6, 0x18A6, 0x20C6, 0x2106, 0x20E6, 0x4926, 0x4926, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 
-0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x20E6, 0x4926, 0x4126, 0x4126, 0x4926, 0x3106, 0x18E6, 0x18E6, 
-0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x8D65, 0x8DC5, 0x6C84, 0x5C03, 
-0x5384, 0x18A6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x4106, 0x4106, 0x4106, 0x4106, 0x4106, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4926, 0x4126, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x4926, 0x3906, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4345, 0x4345, 0x3B25, 0x3B24, 0x32C5, 0x18A6, 0x20E6, 0x20E6, 
-0x18E6, 0x2906, 0x4106, 0x4126, 0x4A29, 0x4A29, 0x4A29, 0x4A29, 0x4A08, 0x4106, 0x4126, 0x2906, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3B65, 0x3B65, 0x3B45, 0x3B64, 0x32C5, 0x18A6, 0x18E6, 0x18E6, 0x18E6, 0x2906, 0x4926, 0x4126, 
-0x4A49, 0x4A69, 0x4A49, 0x4A6A, 0x4A29, 0x4906, 0x4926, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 
-0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x18E6, 
-0x21A3, 0x19A2, 0x21E4, 0x2A25, 0x29C5, 0x30E6, 0x3106, 0x3106, 0x3106, 0x3906, 0x4126, 0x4126, 0x4A49, 0x4A49, 0x4A49, 0x526A, 
-0x4A09, 0x30E5, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x3106, 0x3106, 
-0x3106, 0x2906, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x2906, 0x18E6, 0x20E6, 
-0x3106, 0x3106, 0x3106, 0x3106, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3106, 0x3106, 0x0000, 0x0000, 0x1044, 0x20C7, 
-0x20C6, 0x4926, 0x4926, 0x4926, 0x4926, 0x4126, 0x4106, 0x4126, 0x4A49, 0x4A49, 0x4A49, 0x526A, 0x4209, 0x10C5, 0x18E6, 0x4126, 
-0x4926, 0x4926, 0x4926, 0x4906, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x2906, 0x4926, 0x4926, 0x4926, 0x4926, 0x3906, 0x18E6, 0x20E6, 
-0x20E6, 0x18E6, 0x3906, 0x4926, 0x4926, 0x4926, 0x4926, 0x4926, 0x4926, 0x3906, 0x18E6, 0x20E6, 0x4926, 0x4926, 0x4926, 0x4926, 
-0x4106, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x3106, 0x4926, 0x4926, 0x1000, 0x0000, 0x18A4, 0x2906, 0x2906, 0x4926, 0x4126, 0x4126, 
-0x4146, 0x4126, 0x4106, 0x4126, 0x4A29, 0x4A29, 0x4A29, 0x4A49, 0x41E8, 0x20C5, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4146, 0x4146, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4926, 0x4126, 0x4126, 0x4946, 0x3926, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 
-0x4126, 0x4146, 0x4146, 0x4126, 0x4926, 0x3906, 0x20E6, 0x20E6, 0x4126, 0x4106, 0x4126, 0x4146, 0x3926, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x3106, 0x4926, 0x4126, 0x1000, 0x0000, 0x28A4, 0x4947, 0x4126, 0x4126, 0x4106, 0x4A29, 0x52AA, 0x49E8, 0x40E6, 0x4126, 
-0x4106, 0x4106, 0x4106, 0x4106, 0x4106, 0x4126, 0x4126, 0x4126, 0x40E6, 0x49A7, 0x528A, 0x4A69, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4106, 0x4A29, 0x52AA, 0x49E8, 0x40E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4147, 0x528A, 0x528A, 0x4147, 
-0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x40E6, 0x49E8, 0x52AA, 0x4A29, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4126, 
-0x1000, 0x0000, 0x28A4, 0x4947, 0x4126, 0x4126, 0x40E6, 0x4A49, 0x52AA, 0x49E8, 0x40E5, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x40E6, 0x49A7, 0x52AA, 0x4A6A, 0x4126, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x40E6, 0x4A49, 
-0x52AA, 0x49E8, 0x40E5, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4167, 0x52AA, 0x52AA, 0x4167, 0x4106, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x40E5, 0x49E8, 0x52AA, 0x4A29, 0x40E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4126, 0x1000, 0x0000, 0x28A4, 0x4947, 
-0x4126, 0x4126, 0x4106, 0x4147, 0x4167, 0x4147, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4106, 0x4126, 0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4147, 0x4167, 0x4147, 0x4106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4167, 0x4126, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4106, 0x4147, 0x4167, 
-0x4147, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x1000, 0x0000, 0x30C4, 0x5168, 0x4927, 0x4106, 0x4126, 0x4106, 
-0x4106, 0x4106, 0x4926, 0x4926, 0x4926, 0x4926, 0x4926, 0x4926, 0x4926, 0x4926, 0x4926, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 
-0x4126, 0x4926, 0x4926, 0x4926, 0x4126, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4926, 0x4926, 0x4926, 0x4926, 0x4126, 0x4126, 
-0x4106, 0x4106, 0x4106, 0x4106, 0x4126, 0x4126, 0x4926, 0x4126, 0x4126, 0x4126, 0x4106, 0x4106, 0x4106, 0x4926, 0x4926, 0x4926, 
-0x4926, 0x4126, 0x4126, 0x4126, 0x1000, 0x0000, 0x1882, 0x30C4, 0x30C5, 0x4126, 0x4126, 0x4126, 0x4126, 0x3926, 0x3106, 0x3906, 
-0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3906, 0x3906, 0x3906, 
-0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3926, 0x3106, 0x3906, 0x3906, 0x3106, 0x3926, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3926, 0x3106, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x3906, 0x3906, 0x3106, 0x3906, 0x4126, 0x4126, 
-0x1000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4947, 0x4106, 0x4106, 0x4926, 0x3106, 0x10E5, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 
-0x18E6, 0x18E6, 0x18E5, 0x3906, 0x4126, 0x4106, 0x4106, 0x4126, 0x18E6, 0x18E6, 0x18E6, 0x18E6, 0x20E6, 0x4926, 0x4106, 0x4106, 
-0x4926, 0x3106, 0x10E5, 0x18E6, 0x18E6, 0x10E5, 0x3106, 0x4926, 0x4106, 0x4106, 0x4106, 0x4106, 0x4926, 0x3106, 0x10E5, 0x18E6, 
-0x4126, 0x4106, 0x4106, 0x4126, 0x3906, 0x18E5, 0x18E6, 0x18E6, 0x18E5, 0x2906, 0x4926, 0x4106, 0x0861, 0x18C3, 0x10A2, 0x0000, 
-0x1042, 0x4947, 0x4126, 0x4126, 0x4926, 0x3106, 0x18E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x18E6, 0x3906, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x28E6, 0x4926, 0x4126, 0x4126, 0x4926, 0x3106, 0x18E6, 0x20E6, 
-0x20E6, 0x18E6, 0x3106, 0x4926, 0x4126, 0x4126, 0x4126, 0x4126, 0x4926, 0x3106, 0x18E6, 0x20E6, 0x4106, 0x4126, 0x4126, 0x4126, 
-0x3906, 0x18E6, 0x20E6, 0x20E6, 0x18E6, 0x2906, 0x4926, 0x4126, 
-};
-
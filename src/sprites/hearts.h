@@ -1,103 +0,0 @@
-// Total bitmap data size: 2772 bytes
-
-// heart_empty.png
-// Size: 22x21 (924 bytes)
-const uint16_t heart_empty_bmp[462] = {
-0x0001, 0x0001, 0x0001, 0x0001, 0x1924, 0x2987, 0x2146, 0x2146, 0x2966, 0x0001, 0x0001, 0x0001, 0x0001, 0x18C4, 0x2967, 0x2146, 
-0x2146, 0x29A7, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0861, 0x3A2B, 0x8453, 0x9D35, 0x9CF4, 0xA576, 0x52AB, 
-0x0001, 0x0001, 0x0001, 0x6B8F, 0xAD77, 0x9CF4, 0x9CF4, 0x73F2, 0x2988, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x2125, 0x73D0, 
-0xA578, 0xDF3F, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD98, 0x2146, 0x0001, 0x424B, 0xCE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xCEBD, 0x9D37, 0x52EC, 
-0x0001, 0x0001, 0x0001, 0x10A3, 0x636F, 0xE73D, 0xF7BF, 0xD6DC, 0xBE3A, 0xC65A, 0xC67A, 0xBE3B, 0x7C13, 0x4A6B, 0x94F7, 0xC63B, 
-0xC67A, 0xC65A, 0xC65A, 0xDF1D, 0xFFFF, 0xBE3A, 0x3A09, 0x0001, 0x10A2, 0x4AAC, 0x9D17, 0xD6FD, 0xF7DF, 0x9D36, 0x426B, 0x52ED, 
-0x428B, 0xADB8, 0xCE7C, 0x8C95, 0xDEFD, 0x8CB3, 0x426B, 0x52CD, 0x52ED, 0xBE3A, 0xFFFF, 0xC67B, 0x7C13, 0x422A, 0x0882, 0x73F1, 
-0xDF1E, 0xDF3D, 0xA556, 0x4AAC, 0x2167, 0x29A8, 0x2167, 0x52CC, 0xB5D8, 0xDEFD, 0x94D4, 0x426B, 0x2166, 0x29A7, 0x31A8, 0x5B2E, 
-0xB5F9, 0xEF9F, 0xBE3A, 0x52CC, 0x0042, 0x7C31, 0xF7DF, 0xE75E, 0x5B4E, 0x1905, 0x31A7, 0x31A7, 0x31A7, 0x1926, 0x5B4E, 0xA556, 
-0x3A2A, 0x2166, 0x31A7, 0x31A7, 0x29A7, 0x1905, 0x8473, 0xFFFF, 0xDEFC, 0x52CC, 0x0862, 0x7C32, 0xF7BF, 0xE75E, 0x634E, 0x1905, 
-0x31C8, 0x31C8, 0x31C8, 0x31A7, 0x31C8, 0x31E9, 0x31A7, 0x31A7, 0x31C8, 0x31C8, 0x31C8, 0x1905, 0x8C72, 0xFFFF, 0xD6DC, 0x52EC, 
-0x0862, 0x7C11, 0xEF9E, 0xE75E, 0x634E, 0x1905, 0x31C8, 0x31C8, 0x31C8, 0x31C8, 0x31C8, 0x31C8, 0x31C8, 0x31C8, 0x31C8, 0x31C8, 
-0x31C8, 0x1925, 0x8C93, 0xFFFF, 0xD6BC, 0x52CC, 0x0001, 0x2145, 0x8452, 0xE75E, 0x5B0D, 0x10A3, 0x39E8, 0x31E8, 0x31E8, 0x31E8, 
-0x31C8, 0x31C8, 0x31E8, 0x31E8, 0x31E8, 0x31E8, 0x31E8, 0x0883, 0x94D4, 0xDF1D, 0x52EC, 0x0001, 0x0001, 0x0001, 0x39E9, 0xB5FA, 
-0xB5F9, 0x52AB, 0x10A4, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x1905, 0x6B8F, 0xCE9B, 0x94F6, 
-0x10A4, 0x0001, 0x0001, 0x0001, 0x2126, 0x5B10, 0xDF1E, 0xA557, 0x18E6, 0x18C5, 0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x18C5, 0x18C5, 0x39CA, 0xCE7B, 0xBE3B, 0x422C, 0x1084, 0x0001, 0x0001, 0x0001, 0x0001, 0x18C5, 0x6B91, 0xA579, 0x73D2, 0x2126, 
-0x20E5, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x18C5, 0x39EA, 0x8C95, 0x9D38, 0x52CE, 0x0862, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x20E5, 0x73D2, 0xA579, 0x73B2, 0x2927, 0x1084, 0x2126, 0x2106, 0x2106, 0x0843, 0x39C9, 0x8C95, 0x9D38, 0x5AEF, 
-0x10A4, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x2126, 0x7BF3, 0xA579, 0x73D2, 0x2947, 0x1064, 0x2106, 
-0x1084, 0x39C9, 0x8CB6, 0x9D58, 0x5AEE, 0x18A4, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x2106, 0x73B2, 0xA579, 0x73F2, 0x2127, 0x18C5, 0x39C9, 0x8C95, 0xA559, 0x52AD, 0x0863, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x2106, 0x6BB1, 0xA579, 0x6B70, 0x3188, 0x8474, 0x9D58, 0x5AEE, 0x0862, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x2106, 0x7BF3, 
-0x9D17, 0x7C33, 0x9D38, 0x6330, 0x10A4, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x2927, 0x7C34, 0xA559, 0x6330, 0x18C5, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x31A8, 0x6350, 0x18C4, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x18A4, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-};
-
-// heart_full.png
-// Size: 22x21 (924 bytes)
-const uint16_t heart_full_bmp[462] = {
-0x0001, 0x0001, 0x0001, 0x0001, 0x2966, 0x2166, 0x2146, 0x2166, 0x2125, 0x0001, 0x0001, 0x0001, 0x0001, 0x2125, 0x2166, 0x2146, 
-0x2166, 0x2966, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x1905, 0x5B0F, 0x8C94, 0x9D15, 0x9D35, 0x8C93, 0x2986, 
-0x0001, 0x0001, 0x2986, 0x8CB3, 0x9D35, 0x9D15, 0x8C94, 0x5B0E, 0x1905, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x3A08, 0x94D5, 
-0xB5FA, 0xE7DF, 0xFFFF, 0xFFFF, 0xEFBF, 0x7412, 0x10A3, 0x10A3, 0x7412, 0xEFBF, 0xFFFF, 0xFFFF, 0xEFDF, 0xB5FA, 0x94D5, 0x3A08, 
-0x0001, 0x0001, 0x0001, 0x18E5, 0x94D5, 0xFFFF, 0xE77E, 0xD65A, 0xD5D8, 0xD619, 0xD5F9, 0xB5DA, 0x5B0E, 0x5B0E, 0xB5DA, 0xD5F9, 
-0xD619, 0xD5D8, 0xD65A, 0xE77E, 0xFFDF, 0x94D5, 0x1905, 0x0001, 0x2966, 0x52EE, 0xB5DA, 0xEFBF, 0xDF5D, 0xBAED, 0xB0C4, 0xB105, 
-0xB9C8, 0xDE9B, 0x9D99, 0x9D99, 0xDE9B, 0xB9C8, 0xB105, 0xB0C4, 0xBAED, 0xDF5D, 0xEFBF, 0xB5DA, 0x5B2F, 0x2146, 0x2987, 0x8CB4, 
-0xE7BF, 0xD65A, 0xBAED, 0xC964, 0xD101, 0xD122, 0xC943, 0xC22A, 0xCE5B, 0xCE5B, 0xC22A, 0xC943, 0xD122, 0xD101, 0xC964, 0xBAED, 
-0xD65A, 0xE7BF, 0x94F5, 0x2166, 0x2146, 0xA535, 0xFFFF, 0xD5B7, 0xC0C2, 0xD962, 0xEA24, 0xE224, 0xE1E3, 0xC080, 0xCB6E, 0xCB6E, 
-0xC080, 0xE1E3, 0xE224, 0xEA24, 0xD962, 0xC0C2, 0xD5B7, 0xFFFF, 0xAD97, 0x2146, 0x2166, 0xA535, 0xF7FF, 0xDDF8, 0xE225, 0xE1A3, 
-0xD9E4, 0xD9E4, 0xE1E4, 0xE224, 0xC0E2, 0xC0E2, 0xEA24, 0xE1E4, 0xD9E4, 0xD9E4, 0xE1A3, 0xE225, 0xDDF8, 0xF7FF, 0xAD97, 0x2146, 
-0x2146, 0x9D15, 0xF7FF, 0xDDF8, 0xDA05, 0xE1A3, 0xD9E4, 0xD9E4, 0xD9E4, 0xE1E4, 0xD9E4, 0xD9E4, 0xE1E4, 0xD9E4, 0xD9E4, 0xD9E4, 
-0xD9A3, 0xDA05, 0xDDF8, 0xF7FF, 0xA576, 0x2146, 0x0001, 0x31A7, 0xA619, 0xF69A, 0xE182, 0xD982, 0xDA04, 0xD9E4, 0xD9E4, 0xD9E4, 
-0xE1E4, 0xE1E4, 0xD9E4, 0xD9E4, 0xD9E4, 0xDA04, 0xD962, 0xE182, 0xF69A, 0xA619, 0x31C8, 0x0001, 0x0001, 0x0000, 0x6390, 0xDEBC, 
-0xE4D2, 0xEA45, 0xE161, 0xE204, 0xE204, 0xE204, 0xE204, 0xE204, 0xE204, 0xE204, 0xE204, 0xE181, 0xEA45, 0xE4D2, 0xDEBC, 0x6390, 
-0x0000, 0x0001, 0x0001, 0x0001, 0x3189, 0x84B6, 0xC73F, 0xCC30, 0xD183, 0xD163, 0xD1A4, 0xD1A4, 0xD1A4, 0xD1A4, 0xD1A4, 0xD1A4, 
-0xD163, 0xD183, 0xCC30, 0xCF3F, 0x84B6, 0x3189, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x39CA, 0x8475, 0x8D38, 0xA2CD, 0xB883, 
-0xB0E5, 0xB105, 0xB105, 0xB105, 0xB105, 0xB0E5, 0xB883, 0x9ACD, 0x8D58, 0x8475, 0x39CA, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x39C9, 0x8496, 0x9D38, 0x9AAD, 0xB862, 0xB0C4, 0xB105, 0xB105, 0xB0C4, 0xB862, 0x9AAC, 0x9D58, 0x8496, 0x39C9, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x39C9, 0x7CD7, 0x9D38, 0xA2AD, 0xB0C4, 0xB0A3, 0xB8A3, 
-0xB0C4, 0xA2AD, 0x9D38, 0x7CD7, 0x39C9, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x39C9, 0x84D6, 0x9538, 0xA2CD, 0xB0C4, 0xB0C4, 0xA2CD, 0x8D38, 0x84B6, 0x39C9, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x39EA, 0x8C95, 0x8D38, 0xAA2A, 0xAA2A, 0x8D38, 0x8C96, 0x39EA, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x420B, 0x8CB6, 
-0x9C95, 0x9C95, 0x8CB6, 0x420B, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x41EA, 0x8CF7, 0x8CF7, 0x39EA, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x52AD, 0x52AD, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x1083, 0x1083, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-};
-
-// heart_half.png
-// Size: 22x21 (924 bytes)
-const uint16_t heart_half_bmp[462] = {
-0x0001, 0x0001, 0x0001, 0x0001, 0x2145, 0x2987, 0x2146, 0x2146, 0x2146, 0x0001, 0x0001, 0x0001, 0x0001, 0x1904, 0x2966, 0x2146, 
-0x2146, 0x2987, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x10A3, 0x4A8D, 0x8C73, 0x9D35, 0x9D15, 0x9D15, 0x4229, 
-0x0001, 0x0001, 0x18E4, 0x7C11, 0xA556, 0x9D15, 0x94D4, 0x6B91, 0x2146, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x2986, 0x8473, 
-0xAD99, 0xE79F, 0xFFFF, 0xFFFF, 0xF7FF, 0x8CD5, 0x18C4, 0x0001, 0x5B0E, 0xDF3E, 0xFFFF, 0xFFFF, 0xF7DF, 0xC65C, 0x9D16, 0x4A6A, 
-0x0001, 0x0001, 0x0001, 0x10C4, 0x7C32, 0xF7BF, 0xEFBF, 0xDE9B, 0xD5D8, 0xD619, 0xD619, 0xBE1B, 0x6390, 0x4AAC, 0xA579, 0xC65A, 
-0xC67A, 0xC63A, 0xC67B, 0xE73E, 0xFFFF, 0xAD97, 0x2167, 0x0001, 0x18E4, 0x52EE, 0xAD79, 0xE75E, 0xE7BF, 0xC3B0, 0xB0A3, 0xB146, 
-0xB126, 0xDDD8, 0xAE3B, 0x94D6, 0xDEFD, 0x73F1, 0x4A8C, 0x4AAC, 0x636F, 0xD6DC, 0xF7DF, 0xBE3B, 0x6B91, 0x31A8, 0x18E4, 0x8473, 
-0xE77F, 0xDEBC, 0xBB90, 0xC165, 0xD101, 0xC922, 0xD122, 0xC1C7, 0xCD98, 0xBF3E, 0x7C32, 0x3A29, 0x2987, 0x2987, 0x31E9, 0x6BB0, 
-0xC65A, 0xEF9F, 0xAD98, 0x3A09, 0x10A3, 0x94F4, 0xFFFF, 0xDE9B, 0xC185, 0xD0E1, 0xEA44, 0xE224, 0xE224, 0xC880, 0xD2AB, 0xA452, 
-0x29A8, 0x2987, 0x31A7, 0x31A7, 0x2987, 0x2146, 0x9D36, 0xFFFF, 0xC65A, 0x39E9, 0x10C3, 0x94F4, 0xF7FF, 0xDEBB, 0xE2C8, 0xE182, 
-0xD9E4, 0xD9E4, 0xD9E4, 0xEA24, 0xE122, 0x9083, 0x29A7, 0x29C8, 0x31C8, 0x31C8, 0x31A7, 0x2146, 0x9D35, 0xFFFF, 0xC63A, 0x3A09, 
-0x10C3, 0x94D4, 0xF7DF, 0xDEBB, 0xDAA8, 0xE182, 0xD9E4, 0xD9E4, 0xD9E4, 0xE1E4, 0xF1E3, 0xB1C5, 0x31C8, 0x29C8, 0x31C8, 0x31C8, 
-0x31A7, 0x2166, 0xA536, 0xFFFF, 0xBE19, 0x39E9, 0x0001, 0x2986, 0x9536, 0xEF1C, 0xE245, 0xD920, 0xDA04, 0xD9E4, 0xD9E4, 0xD9E4, 
-0xF203, 0xB1E5, 0x31E8, 0x29E8, 0x31E8, 0x31E8, 0x29A7, 0x10C4, 0xB5B7, 0xCEBB, 0x4249, 0x0001, 0x0001, 0x0000, 0x4ACD, 0xCE7B, 
-0xE575, 0xEAA7, 0xE161, 0xE204, 0xE204, 0xE204, 0xFA24, 0xB1E5, 0x2967, 0x2167, 0x2967, 0x1905, 0x2966, 0x7C31, 0xCEBC, 0x8453, 
-0x0021, 0x0001, 0x0001, 0x0001, 0x2968, 0x73F3, 0xBF3F, 0xD4F3, 0xC983, 0xD163, 0xD1A4, 0xD1A4, 0xE9C4, 0xA985, 0x20E6, 0x18E6, 
-0x18A5, 0x18A5, 0x52AD, 0xD6FD, 0xAD99, 0x39CA, 0x0842, 0x0001, 0x0001, 0x0001, 0x0001, 0x2947, 0x7BF3, 0x8D79, 0x9B50, 0xB0C4, 
-0xB0E5, 0xB105, 0xC105, 0x9105, 0x2106, 0x1906, 0x10A4, 0x4A6C, 0x94F7, 0x94D7, 0x4A4C, 0x0821, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x2947, 0x7434, 0x9D59, 0x9B2F, 0xB0C4, 0xB0A3, 0xC105, 0x8905, 0x2106, 0x0863, 0x424B, 0x9517, 0x94F7, 0x4A6C, 
-0x1083, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x3168, 0x7C75, 0x9D79, 0x9B4F, 0xB105, 0xC882, 0x88C4, 
-0x10A4, 0x422B, 0x94F7, 0x9D18, 0x4A4C, 0x1062, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x3168, 0x7C54, 0x8D59, 0xA350, 0xB8E4, 0x90C4, 0x424B, 0x8CF7, 0x9D18, 0x422B, 0x0021, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x3188, 0x7C13, 0x8D79, 0xA2CD, 0xA9A8, 0x94D6, 0x9517, 0x4A6C, 0x0821, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x3188, 0x7C54, 
-0x9CD6, 0x9C54, 0x9517, 0x52AD, 0x1083, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x3188, 0x8496, 0x9538, 0x528D, 0x1083, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x422B, 0x5B0F, 0x0842, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x10A4, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-};
@@ -1,1260 +0,0 @@
-// icon_frame.png
-// Size: 100x100 (20000 bytes)
-const uint16_t icon_frame_bmp[10000] = {
-0x8B43, 0xB403, 0xB423, 0xABE3, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 
-0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 
-0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xBC22, 0xB404, 0xABA6, 0xBC42, 0xB3E4, 0xABA6, 0xBC42, 0xB3E4, 0xABA6, 0xBC42, 0xB3E5, 
-0xABA6, 0xABE5, 0xABC6, 0xABC6, 0xABC5, 0xABC6, 0xABC6, 0xABC5, 0xABC6, 0xABC6, 0xABC5, 0xABC6, 0xABC6, 0xABC5, 0xABC5, 0xABA6, 
-0xABC5, 0xABC5, 0xABA6, 0xABC5, 0xABC5, 0xABC6, 0xABC5, 0xABC5, 0xABC6, 0xABC5, 0xABE5, 0xABC6, 0xABC6, 0xABC5, 0xABC6, 0xABC6, 
-0xABC5, 0xABC6, 0xABC6, 0xABC5, 0xABC6, 0xABC6, 0xABC5, 0xABC6, 0xA349, 0xABC6, 0xABC5, 0xA349, 0xABC6, 0xABC6, 0xA349, 0xABC6, 
-0xA3A5, 0xA349, 0x9B67, 0x8324, 0xB403, 0xD4C2, 0xC463, 0xE502, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xBC22, 
-0xBC42, 0xB423, 0xBC22, 0xBC42, 0xB423, 0xBC42, 0xBC22, 0xB423, 0xBC42, 0xBC22, 0xB423, 0xBC42, 0xBC42, 0xBC22, 0xBC22, 0xBC42, 
-0xBC42, 0xBC22, 0xBC42, 0xBC42, 0xBC22, 0xBC42, 0xBC42, 0xBC22, 0xBC42, 0xBC42, 0xB404, 0xABA6, 0xBC42, 0xB404, 0xABA6, 0xBC61, 
-0xB3E4, 0xABC6, 0xBC61, 0xB3E5, 0xABC6, 0xB3E5, 0xABC6, 0xABC6, 0xB3E5, 0xABC6, 0xABC6, 0xB3E5, 0xABC6, 0xABC6, 0xB3E5, 0xB3E5, 
-0xABC6, 0xABE5, 0xB3E5, 0xABC6, 0xABE5, 0xB3E5, 0xABC6, 0xABC5, 0xB3E5, 0xABC6, 0xABC5, 0xB3E5, 0xABC6, 0xB3E5, 0xB3E5, 0xABC6, 
-0xABC5, 0xB3E5, 0xABC5, 0xABC5, 0xB3E5, 0xABC5, 0xABC5, 0xB3E4, 0xABE5, 0xABC5, 0xB3E4, 0xABC5, 0x9B4A, 0xABC6, 0xB3E5, 0x9B4A, 
-0xABC5, 0xABC5, 0x9B4A, 0xABE5, 0xCC29, 0xAB6A, 0xBBAB, 0x9B67, 0xB423, 0xC463, 0xA3A3, 0xD4A3, 0x7AE4, 0x8303, 0x8303, 0x8303, 
-0x8303, 0x8303, 0x8323, 0x7AE5, 0x7AE4, 0x8342, 0x7B04, 0x7AE4, 0x8342, 0x7AE5, 0x7AE5, 0x8323, 0x7AE5, 0x7AE5, 0x8323, 0x7AE5, 
-0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AC5, 0x7B04, 0x8303, 
-0x7AC5, 0x7B04, 0x8303, 0x7AE5, 0x8303, 0x8304, 0x7AE5, 0x8303, 0x8303, 0x7B04, 0x8323, 0x8303, 0x7B04, 0x8323, 0x8303, 0x7B04, 
-0x8323, 0x8303, 0x8304, 0x7AE5, 0x7AE5, 0x7AE4, 0x7AE5, 0x7AE4, 0x7AE4, 0x7AC5, 0x7AE4, 0x7AE4, 0x7AC5, 0x8304, 0x8303, 0x7AC5, 
-0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AC6, 
-0x7AE4, 0x7AE5, 0x7AC6, 0x7AE4, 0x7AE5, 0x7AA6, 0x7AE4, 0x7AC5, 0xB36C, 0x9346, 0xAB89, 0xA368, 0xABE3, 0xE502, 0xD4A2, 0xFD82, 
-0xF582, 0xF582, 0xF582, 0xFD81, 0xF582, 0xF562, 0xFDA1, 0xF544, 0xE4A8, 0xF563, 0xECC7, 0xE4A9, 0xF582, 0xED05, 0xED06, 0xFDC0, 
-0xECE6, 0xED05, 0xFDC0, 0xED06, 0xECE7, 0xED05, 0xECE6, 0xECE6, 0xF525, 0xED06, 0xECE6, 0xF505, 0xED06, 0xECE6, 0xED05, 0xF525, 
-0xECE6, 0xED25, 0xECE6, 0xE489, 0xF525, 0xECE6, 0xE489, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 
-0xE4C7, 0xE4A8, 0xE4A8, 0xE4C7, 0xE4A8, 0xE4A8, 0xECE7, 0xDC2C, 0xDC6A, 0xF563, 0xD40D, 0xDC6A, 0xF563, 0xD3ED, 0xE489, 0xF543, 
-0xD40D, 0xDC6A, 0xECC7, 0xD40C, 0xD40C, 0xDC2C, 0xDC2B, 0xD42C, 0xD42C, 0xDC4B, 0xD42C, 0xD42C, 0xDC4B, 0xD42C, 0xD42C, 0xDC4B, 
-0xD42C, 0xD42C, 0xD42C, 0xE489, 0xDC6A, 0xD40D, 0xE4A8, 0xDC4B, 0xD40D, 0xE4A8, 0xDC4B, 0xD42C, 0xDC2C, 0xB38B, 0xC3CC, 0x9B67, 
-0xBC23, 0xB403, 0x7B03, 0xFD82, 0xFDE2, 0xFDC1, 0xFDE1, 0xF526, 0xFD83, 0xFDE1, 0xFD45, 0xFD45, 0xF4E8, 0xECE8, 0xECC9, 0xECC9, 
-0xFD83, 0xFDE1, 0xFDC2, 0xFDC2, 0xFDC2, 0xFDC2, 0xFDC2, 0xFDC1, 0xFDC1, 0xFDC2, 0xFDE0, 0xFD83, 0xF526, 0xFDE0, 0xFD83, 0xFD46, 
-0xFE00, 0xFD83, 0xFD45, 0xFD64, 0xFD45, 0xFD64, 0xFD26, 0xECC9, 0xFD65, 0xF526, 0xECE8, 0xECE8, 0xECE8, 0xF4E8, 0xECC8, 0xF4E8, 
-0xF4E8, 0xECC8, 0xF4E8, 0xF4E8, 0xDC2D, 0xECC9, 0xF4E8, 0xE44C, 0xECE8, 0xECC8, 0xE46C, 0xE44C, 0xECAA, 0xFD84, 0xF4E8, 0xF507, 
-0xFD65, 0xECE8, 0xF526, 0xFD45, 0xF4E8, 0xECE8, 0xECC8, 0xF4E7, 0xECE8, 0xECE8, 0xF4E8, 0xECE8, 0xF4E8, 0xF4E8, 0xECE8, 0xF4E8, 
-0xF507, 0xF4E8, 0xF4E8, 0xF507, 0xECE8, 0xF4E8, 0xF4E8, 0xFD65, 0xFD46, 0xECC9, 0xFD65, 0xF526, 0xECC8, 0xFD64, 0xF526, 0xF508, 
-0xDC4C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8303, 0xFD82, 0xFDC2, 0xFD83, 0xFD64, 0xF506, 0xF525, 0xFD82, 0xF506, 0xE48A, 
-0xE48A, 0xE48A, 0xECC8, 0xFD83, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFD64, 0xFD63, 0xFDA1, 0xFD64, 0xFD44, 
-0xFD64, 0xFD63, 0xF525, 0xF506, 0xFD83, 0xF525, 0xF506, 0xF545, 0xF525, 0xF506, 0xF544, 0xFD64, 0xE48A, 0xF506, 0xFD63, 0xE489, 
-0xF525, 0xFD63, 0xECA9, 0xE4A9, 0xE48A, 0xECE8, 0xE4A9, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xDC2C, 0xE48A, 0xE48A, 0xDC4C, 0xDC2C, 
-0xDC4B, 0xE48A, 0xFD64, 0xF525, 0xE46B, 0xFD63, 0xF526, 0xE46A, 0xFD63, 0xF526, 0xE4A9, 0xFD63, 0xF506, 0xE4A9, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE46B, 0xECC8, 0xECC8, 0xE46B, 0xECC8, 0xECC8, 0xE48A, 0xE48A, 0xECE7, 0xFD83, 0xE46B, 0xECE7, 
-0xFD83, 0xE48A, 0xF506, 0xFD83, 0xD40D, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8303, 0xFD82, 0xFDC1, 0xF544, 0xF506, 0xF544, 
-0xF545, 0xECC8, 0xECC8, 0xECE7, 0xDC2D, 0xDC4B, 0xFDA2, 0xFDC1, 0xFD82, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA1, 0xF506, 
-0xF545, 0xFDE0, 0xF506, 0xFD44, 0xFDE0, 0xF506, 0xF506, 0xF544, 0xF525, 0xF526, 0xF544, 0xF525, 0xE4A9, 0xF544, 0xF525, 0xECC8, 
-0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECE7, 0xDC6B, 0xDC2C, 0xF506, 0xDC6B, 0xDC4C, 0xF525, 0xDC6B, 0xDC2C, 0xE48A, 
-0xDC4C, 0xDC4C, 0xE48A, 0xDC2C, 0xE48A, 0xFD64, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC2D, 0xECA9, 0xE4A9, 0xD40D, 0xECC8, 0xE4A9, 0xD40E, 0xF525, 
-0xF526, 0xE4A9, 0xF545, 0xF506, 0xECC8, 0xECC8, 0xECC8, 0xF4E8, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8303, 0xF582, 
-0xFDC1, 0xFDC1, 0xFDC0, 0xF525, 0xF526, 0xECE7, 0xECC8, 0xE4A9, 0xECC8, 0xFD82, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 
-0xFDA1, 0xFDA1, 0xFD82, 0xFDC0, 0xFD83, 0xECE7, 0xFDC0, 0xFD83, 0xF506, 0xFDE0, 0xFD83, 0xF525, 0xF544, 0xF525, 0xF544, 0xF525, 
-0xECA9, 0xF525, 0xF506, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECE7, 0xDC0D, 0xE4A9, 0xECE7, 
-0xDC2D, 0xECC8, 0xECE7, 0xDC6B, 0xE46B, 0xDC4B, 0xDC4C, 0xECC8, 0xF506, 0xF545, 0xECC7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xED07, 0xECC8, 0xECC8, 0xF526, 
-0xDC4C, 0xE46B, 0xF506, 0xF525, 0xF506, 0xECA9, 0xF525, 0xF506, 0xECC8, 0xECC8, 0xECC8, 0xF4E7, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xB423, 0x8303, 0xFD82, 0xFD64, 0xF544, 0xFD83, 0xF526, 0xE46B, 0xFD64, 0xF525, 0xE489, 0xFD83, 0xFDC1, 0xFD82, 0xFDA2, 
-0xFDA2, 0xFDA2, 0xFDA2, 0xFDA1, 0xFD44, 0xFD64, 0xFDC1, 0xFD44, 0xF544, 0xFD63, 0xFD64, 0xF525, 0xF506, 0xFD63, 0xF525, 0xF526, 
-0xF525, 0xF525, 0xF525, 0xF545, 0xFD64, 0xE4A9, 0xECE7, 0xFD63, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xE46B, 0xECE7, 0xE489, 
-0xE46A, 0xE48A, 0xE48A, 0xE46A, 0xDC2C, 0xE46B, 0xE46A, 0xDC4C, 0xDC4C, 0xDC4C, 0xDC4B, 0xFD44, 0xF545, 0xE46B, 0xFD64, 0xF525, 
-0xE48A, 0xFD64, 0xF525, 0xE48A, 0xFD63, 0xF526, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xE46B, 0xECA9, 0xECC8, 0xE46B, 0xECC8, 0xECC8, 
-0xE46B, 0xE489, 0xECC8, 0xFD82, 0xE46B, 0xE4A9, 0xFD82, 0xE48A, 0xECE7, 0xFD83, 0xE48A, 0xED06, 0xFD63, 0xE489, 0xF525, 0xFD83, 
-0xD40D, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8303, 0xFD81, 0xFD45, 0xF525, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xFD83, 
-0xFDC1, 0xFD82, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDC1, 0xF526, 0xF525, 0xFDE0, 0xF506, 0xF545, 0xFDE0, 0xF526, 0xF506, 
-0xF544, 0xF525, 0xF526, 0xF544, 0xF525, 0xE48A, 0xF544, 0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 
-0xE46B, 0xDC2C, 0xED07, 0xE46B, 0xDC2C, 0xF526, 0xE46B, 0xDC2C, 0xE48A, 0xDC4C, 0xDC4C, 0xE48A, 0xDC2C, 0xE48A, 0xFD82, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC2D, 0xE489, 
-0xECC8, 0xDC2D, 0xE4A9, 0xECA8, 0xD40E, 0xF506, 0xF525, 0xE48A, 0xF544, 0xF525, 0xE48A, 0xF545, 0xF526, 0xECA9, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8303, 0xFD82, 0xFD65, 0xF545, 0xECE7, 0xECE8, 
-0xE4A9, 0xECA9, 0xFD83, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFD82, 0xFDA1, 0xFDA1, 0xFD82, 0xFDC0, 0xFDA2, 0xECE7, 0xFDC1, 
-0xFDA2, 0xED07, 0xFDE0, 0xFD82, 0xF525, 0xF544, 0xF525, 0xF544, 0xF525, 0xECC8, 0xF526, 0xF506, 0xECC7, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECE7, 0xED06, 0xD40D, 0xE4A9, 0xF506, 0xDC2D, 0xECC8, 0xED07, 0xDC6B, 0xDC6B, 0xDC6B, 0xDC4C, 
-0xECC8, 0xF506, 0xF525, 0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 
-0xECC8, 0xECC8, 0xED06, 0xECC8, 0xECC8, 0xF506, 0xECC8, 0xECC8, 0xECE6, 0xF525, 0xF526, 0xECC8, 0xF525, 0xF506, 0xECC8, 0xF525, 
-0xF506, 0xECC7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF507, 0xDC2B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8303, 0xFDA1, 
-0xFD65, 0xF506, 0xFD63, 0xF525, 0xE489, 0xFD83, 0xFDC1, 0xFD82, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA1, 0xFD44, 0xFD44, 0xFDC1, 
-0xF544, 0xF544, 0xFD82, 0xFD44, 0xF525, 0xF526, 0xFD64, 0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xFD64, 0xE4A9, 0xECE7, 
-0xFD63, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC6B, 0xECE7, 0xE4A9, 0xE46B, 0xE4A9, 0xE48A, 0xE46B, 0xDC4C, 0xDC6B, 0xE46A, 
-0xDC4C, 0xDC2C, 0xDC4C, 0xDC6B, 0xF545, 0xF544, 0xDC6B, 0xF544, 0xF545, 0xE48A, 0xFD64, 0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xDC6B, 0xE4A9, 0xECC8, 0xDC4B, 0xECA9, 0xECC8, 0xDC6B, 0xE489, 0xECC8, 0xFD83, 0xE4A9, 0xECA9, 0xFD83, 
-0xE489, 0xECC8, 0xFD83, 0xE4A9, 0xECE7, 0xFD63, 0xE4A9, 0xF506, 0xFD63, 0xE489, 0xF525, 0xFD83, 0xD40D, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xB423, 0x8323, 0xF524, 0xECC9, 0xECC8, 0xECA9, 0xECC8, 0xFD83, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 
-0xFDC1, 0xF525, 0xF525, 0xFDC1, 0xF525, 0xF525, 0xFDE0, 0xF525, 0xF506, 0xF544, 0xF525, 0xF506, 0xF544, 0xF525, 0xE48A, 0xF545, 
-0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xE48A, 0xDC2C, 0xECE7, 0xE46A, 0xDC4C, 0xF506, 0xE46A, 
-0xDC2C, 0xE46A, 0xDC2C, 0xDC4C, 0xE46A, 0xDC2C, 0xE46B, 0xFD82, 0xECC8, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC2C, 0xE48A, 0xECE8, 0xDC2C, 0xE4A9, 0xECC8, 0xD40E, 0xF506, 0xF544, 
-0xE48A, 0xF525, 0xF525, 0xE48A, 0xF545, 0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC9, 0xECC8, 0xECC8, 0xECC9, 0xECC8, 0xECC8, 0xECC9, 
-0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8322, 0xF563, 0xF4E7, 0xE4A9, 0xECA9, 0xFD83, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 
-0xFDA2, 0xFD82, 0xFDA1, 0xFDA1, 0xFD82, 0xFDC0, 0xFDA1, 0xECE7, 0xFDC1, 0xFDA1, 0xECE7, 0xFDC0, 0xFDA2, 0xF525, 0xF544, 0xF525, 
-0xF544, 0xF545, 0xECC8, 0xF506, 0xF506, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECE8, 0xF506, 0xDC0D, 
-0xE48A, 0xF525, 0xDC2C, 0xE4A9, 0xF506, 0xDC2D, 0xECC8, 0xF506, 0xDC0D, 0xECE8, 0xF526, 0xF526, 0xED07, 0xECE7, 0xECA8, 0xECE7, 
-0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF506, 0xECC8, 0xECC8, 0xF525, 0xDC6B, 
-0xDC2C, 0xF525, 0xF526, 0xF506, 0xECC7, 0xF506, 0xF506, 0xECC7, 0xF526, 0xF506, 0xECE7, 0xECC8, 0xECC8, 0xED07, 0xECC8, 0xECC8, 
-0xED07, 0xECC8, 0xECE7, 0xF507, 0xDC2B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE5, 0xF543, 0xFD45, 0xE489, 0xFD83, 0xFDC1, 
-0xFD82, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA1, 0xF544, 0xF545, 0xFDC1, 0xFD44, 0xF525, 0xF525, 0xF545, 0xF525, 0xF525, 0xF544, 
-0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xFD64, 0xECC8, 0xECC8, 0xFD63, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC4C, 
-0xECE7, 0xE4A9, 0xDC4B, 0xECA9, 0xE48A, 0xE46B, 0xDC4C, 0xDC4C, 0xE46B, 0xE46B, 0xF525, 0xFD64, 0xDC2C, 0xF525, 0xFD44, 0xE46B, 
-0xF544, 0xF544, 0xE48A, 0xFD44, 0xF545, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC4B, 0xE489, 0xECC8, 0xDC4C, 
-0xE4A9, 0xECC8, 0xDC6B, 0xE46B, 0xE4A9, 0xFD83, 0xECC8, 0xE4A9, 0xFD83, 0xE4A9, 0xECA8, 0xFD83, 0xE4A9, 0xECE7, 0xFD63, 0xECA9, 
-0xED06, 0xFD63, 0xE4A9, 0xF506, 0xFD63, 0xE489, 0xF525, 0xFD84, 0xD40D, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7B04, 0xE489, 
-0xECC9, 0xFD83, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA1, 0xF525, 0xF525, 0xFDC1, 0xF545, 0xF506, 0xF545, 
-0xF525, 0xF506, 0xF544, 0xF526, 0xF506, 0xF544, 0xF525, 0xE46A, 0xF525, 0xF545, 0xE48A, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xE489, 0xDC2C, 0xECC8, 0xE48A, 0xDC2C, 0xECE7, 0xE48A, 0xDC4C, 0xE46B, 0xDC2C, 0xDC4C, 0xFD82, 0xECE7, 0xE4A9, 
-0xFD83, 0xECC7, 0xE4A9, 0xECC8, 0xECA9, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xDC2C, 0xE48A, 0xECE7, 0xDC2C, 0xE48A, 0xECC8, 0xD40E, 0xF506, 0xFD63, 0xE46B, 0xF525, 0xF545, 0xE46B, 0xF545, 0xF525, 0xE48A, 
-0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xB423, 0x8342, 0xF582, 0xFD83, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFD82, 0xFDA1, 0xFDC1, 0xFD82, 0xFDC1, 0xFDC1, 
-0xECE7, 0xFDC1, 0xFDC1, 0xF506, 0xFDC1, 0xFDA1, 0xF525, 0xF545, 0xF525, 0xFD44, 0xF545, 0xECE7, 0xF506, 0xF506, 0xED06, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF525, 0xDC2D, 0xE48A, 0xF525, 0xDC2C, 0xE4A9, 0xF525, 0xDC2D, 0xECC8, 
-0xF525, 0xF506, 0xED06, 0xECE7, 0xF506, 0xF506, 0xECE7, 0xECA9, 0xECE7, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF506, 0xECE7, 0xECC8, 0xF525, 0xE46B, 0xDC2D, 0xF545, 0xF506, 0xF506, 0xECE7, 0xF506, 0xF506, 
-0xECE7, 0xF506, 0xF506, 0xED06, 0xECC8, 0xECC8, 0xF506, 0xECC8, 0xECC8, 0xF506, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 
-0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE5, 0xED25, 0xFDC1, 0xFD82, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA1, 0xF544, 
-0xF525, 0xFDC0, 0xF544, 0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xF545, 0xF525, 0xF525, 0xF525, 0xF525, 0xF545, 0xF525, 0xFD64, 
-0xECC8, 0xECC8, 0xFD63, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC4C, 0xECC8, 0xE4A9, 0xDC4C, 0xECC8, 0xE48A, 0xDC6B, 0xDC4C, 
-0xDC4C, 0xE46B, 0xE48A, 0xF506, 0xFD64, 0xDC4B, 0xF525, 0xFD64, 0xE46B, 0xF525, 0xF544, 0xE48A, 0xF544, 0xF545, 0xE4A9, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC4B, 0xE48A, 0xECE7, 0xDC4C, 0xE489, 0xECE7, 0xDC4C, 0xE46A, 0xE4A9, 0xFD83, 0xECE8, 
-0xE489, 0xFD83, 0xECC8, 0xE4A9, 0xFD83, 0xECC8, 0xECC8, 0xFD63, 0xECC8, 0xECE7, 0xFD63, 0xECA8, 0xED07, 0xFD63, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AE5, 0xED06, 0xFDC2, 0xFDA2, 0xFDA2, 0xFDA2, 
-0xFDA2, 0xFDA2, 0xFDA1, 0xF544, 0xF525, 0xFDA1, 0xF545, 0xF525, 0xF525, 0xF525, 0xF525, 0xF545, 0xF526, 0xF506, 0xF545, 0xF525, 
-0xE46B, 0xF526, 0xF544, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC4C, 0xECC8, 0xE48A, 0xDC4C, 
-0xECC8, 0xE48A, 0xDC4B, 0xDC4B, 0xDC2C, 0xDC4C, 0xFD83, 0xECE7, 0xE48A, 0xFD63, 0xECE7, 0xE48A, 0xECC8, 0xE4A9, 0xE4A9, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC4C, 0xE48A, 0xECE7, 0xDC4C, 0xE48A, 0xECC8, 0xD40D, 
-0xECE7, 0xFD63, 0xE46B, 0xF525, 0xFD44, 0xE46B, 0xF525, 0xF544, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 
-0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8323, 0xFDC0, 
-0xFDA2, 0xFDA2, 0xFDA2, 0xFD82, 0xFDA1, 0xFDC1, 0xFD82, 0xFDC1, 0xFDC1, 0xECE7, 0xFDA2, 0xFDC1, 0xF506, 0xFDC1, 0xFDC1, 0xF525, 
-0xF545, 0xF545, 0xFD44, 0xF544, 0xECE7, 0xF506, 0xF506, 0xF506, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 
-0xF525, 0xDC2D, 0xE46B, 0xF545, 0xDC4C, 0xE48A, 0xF525, 0xDC2D, 0xECA9, 0xF545, 0xED07, 0xF506, 0xF506, 0xF506, 0xF506, 0xED06, 
-0xE4A9, 0xED07, 0xF506, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF506, 0xECE7, 0xECA8, 
-0xF526, 0xE48A, 0xDC0D, 0xF544, 0xF506, 0xF507, 0xF506, 0xF506, 0xF506, 0xF506, 0xF506, 0xF506, 0xF506, 0xECC8, 0xECC8, 0xF525, 
-0xECC8, 0xECC8, 0xF526, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xF4E8, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xBC22, 0x7AE5, 0xED06, 0xFDC2, 0xFDA2, 0xFDA2, 0xFDA1, 0xFD44, 0xF526, 0xFDC0, 0xFD44, 0xF526, 0xF525, 0xF526, 0xF525, 
-0xF525, 0xF525, 0xF525, 0xF525, 0xF526, 0xF525, 0xF545, 0xF525, 0xFD44, 0xECE7, 0xE4A9, 0xFD63, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 
-0xE4A9, 0xDC2C, 0xECC8, 0xECA9, 0xDC4C, 0xECC8, 0xE489, 0xDC4B, 0xDC4B, 0xDC4C, 0xDC6B, 0xE489, 0xF506, 0xFD64, 0xE46B, 0xF506, 
-0xFD64, 0xE46A, 0xF525, 0xFD44, 0xE48A, 0xF545, 0xF544, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC4C, 0xE46A, 
-0xECE7, 0xDC4C, 0xE48A, 0xECE7, 0xDC4C, 0xE46A, 0xE4A9, 0xFD63, 0xECE7, 0xE48A, 0xFD63, 0xECE7, 0xE4A9, 0xFD63, 0xECC8, 0xECC8, 
-0xFD63, 0xECC8, 0xECE7, 0xFD63, 0xECC8, 0xECE7, 0xFD63, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 
-0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE5, 0xED05, 0xFDC2, 0xFDA2, 0xFDA2, 0xFDA1, 0xFD44, 0xF525, 0xFDA2, 0xF544, 
-0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xF506, 0xF506, 0xF545, 0xF525, 0xE46B, 0xF506, 0xFD44, 0xE46A, 0xECC8, 0xECC8, 0xE4A9, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECA9, 0xDC4C, 0xE4A9, 0xE48A, 0xDC4B, 0xECA9, 0xE48A, 0xE46B, 0xDC4C, 0xDC2C, 0xDC2C, 0xFD83, 
-0xF506, 0xE46A, 0xFD63, 0xECE7, 0xE48A, 0xECC8, 0xE4A9, 0xE4A9, 0xECC8, 0xECC9, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xDC4B, 0xE48A, 0xECE7, 0xDC4B, 0xE46A, 0xECC8, 0xDC0D, 0xECC7, 0xFD83, 0xDC6B, 0xF506, 0xFD64, 0xDC4B, 0xF525, 
-0xFD44, 0xE46B, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8323, 0xFDC0, 0xFDA2, 0xFDA2, 0xFDA1, 0xFD82, 
-0xFDC1, 0xFDE0, 0xED07, 0xFD82, 0xFDE0, 0xF506, 0xFDA2, 0xFDC1, 0xF525, 0xF545, 0xF545, 0xFD44, 0xF545, 0xF506, 0xF506, 0xECE7, 
-0xF525, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF525, 0xDC2C, 0xDC4B, 0xF544, 0xDC4C, 0xE48A, 0xF545, 
-0xDC2C, 0xE4A9, 0xF544, 0xECE7, 0xF506, 0xF506, 0xECE7, 0xF506, 0xF506, 0xE4A9, 0xED07, 0xF506, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECA8, 0xED07, 0xECE7, 0xECA9, 0xF526, 0xE48A, 0xD40E, 0xF544, 0xF506, 0xECE7, 0xF506, 
-0xF506, 0xECE7, 0xF506, 0xF506, 0xED07, 0xF525, 0xECC8, 0xECC8, 0xF525, 0xECC8, 0xECC8, 0xF525, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xF507, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AE5, 0xECE6, 
-0xFDC1, 0xFD64, 0xF506, 0xFDC0, 0xFD64, 0xF506, 0xF545, 0xF525, 0xF525, 0xF545, 0xF525, 0xF525, 0xF545, 0xF525, 0xF525, 0xF545, 
-0xF525, 0xF544, 0xECE7, 0xE4A9, 0xFD64, 0xECE7, 0xECC9, 0xECC8, 0xECC8, 0xECA9, 0xDC2D, 0xECC8, 0xECC8, 0xDC2D, 0xECC8, 0xE4A9, 
-0xDC4C, 0xDC4B, 0xDC4C, 0xDC4C, 0xE4A9, 0xF506, 0xFD64, 0xE48A, 0xF506, 0xFD44, 0xE48A, 0xF506, 0xF544, 0xE48A, 0xF525, 0xF544, 
-0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xDC4C, 0xE46B, 0xECE7, 0xDC4C, 0xE46A, 0xF506, 0xDC4C, 0xE46B, 0xECC8, 
-0xFD64, 0xED06, 0xE48A, 0xFD64, 0xECE7, 0xE4A9, 0xFD63, 0xECE7, 0xE4A9, 0xFD63, 0xECE7, 0xECC8, 0xFD64, 0xECC8, 0xECE7, 0xFD64, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xE46C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xBC22, 0x7AE5, 0xED05, 0xFDC1, 0xFD63, 0xF545, 0xFD83, 0xF544, 0xF545, 0xF525, 0xF506, 0xF526, 0xF525, 0xF506, 0xF506, 
-0xF525, 0xF525, 0xE46B, 0xECE7, 0xFD64, 0xE46A, 0xECA9, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC4B, 0xE489, 
-0xE48A, 0xDC6B, 0xE4A9, 0xE48A, 0xE46B, 0xDC4C, 0xDC4C, 0xDC2C, 0xFD63, 0xF506, 0xDC6B, 0xFD63, 0xED06, 0xE46A, 0xECC8, 0xE4A9, 
-0xE48A, 0xECC8, 0xECA9, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE46B, 0xE48A, 0xECE7, 0xE46B, 0xE46A, 
-0xE4A9, 0xDC2D, 0xECC8, 0xFD82, 0xE46B, 0xF506, 0xFD63, 0xDC4B, 0xF506, 0xFD63, 0xE46B, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 
-0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xE46B, 
-0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8323, 0xFDC0, 0xFDA2, 0xFDA1, 0xFDE0, 0xED06, 0xFD83, 0xFDE0, 0xF525, 0xF525, 
-0xF545, 0xFD44, 0xF525, 0xF545, 0xFD44, 0xF545, 0xF526, 0xF506, 0xECE7, 0xF525, 0xECE7, 0xECC9, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 
-0xECC8, 0xECC8, 0xF525, 0xDC4C, 0xDC4C, 0xF545, 0xDC4C, 0xE46B, 0xF525, 0xDC2C, 0xE489, 0xFD64, 0xECE7, 0xF506, 0xF525, 0xECE7, 
-0xF506, 0xF525, 0xE4A9, 0xED07, 0xF525, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xECC8, 0xECA8, 0xECE7, 
-0xECE7, 0xECA9, 0xF506, 0xE4A9, 0xD3EE, 0xF544, 0xF526, 0xECC8, 0xF525, 0xF506, 0xECE7, 0xF525, 0xF506, 0xECE7, 0xF525, 0xECE7, 
-0xECC8, 0xF545, 0xECC8, 0xECC8, 0xF525, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECE7, 0xECC8, 0xECE7, 0xF526, 0xDC2B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AC5, 0xECE6, 0xFDE0, 0xFD64, 0xF506, 0xF545, 
-0xF526, 0xF525, 0xF545, 0xF525, 0xF525, 0xF544, 0xF525, 0xF525, 0xF545, 0xF525, 0xF544, 0xED07, 0xE4A9, 0xFD64, 0xED07, 0xECA9, 
-0xECC8, 0xECC8, 0xECC8, 0xDC2D, 0xECA9, 0xECC8, 0xDC2D, 0xECC8, 0xECC8, 0xDC4C, 0xDC6B, 0xDC4C, 0xDC4C, 0xECC9, 0xED06, 0xFD64, 
-0xE4A9, 0xECE7, 0xFD44, 0xE48A, 0xF506, 0xF544, 0xE489, 0xF506, 0xF544, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 
-0xDC4C, 0xDC4B, 0xED06, 0xDC4C, 0xE46B, 0xF506, 0xDC4C, 0xE46B, 0xECC8, 0xF544, 0xF506, 0xE489, 0xFD44, 0xF506, 0xE4A9, 0xFD64, 
-0xECE7, 0xE4A9, 0xFD64, 0xECE7, 0xECC8, 0xFD64, 0xECE7, 0xECC8, 0xFD64, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC7, 0xE48A, 0xDC2C, 0xECE7, 0xE48A, 0xE44C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE5, 0xF525, 
-0xFD83, 0xF544, 0xFD44, 0xF525, 0xF506, 0xF526, 0xF525, 0xF506, 0xF526, 0xF525, 0xF525, 0xE46A, 0xECE7, 0xFD64, 0xE48A, 0xE4A9, 
-0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE46B, 0xE48A, 0xE48A, 0xE46B, 0xE48A, 0xE48A, 0xE48A, 0xDC4C, 0xDC4C, 
-0xDC2C, 0xFD64, 0xF525, 0xE46B, 0xECC8, 0xE4A9, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECA8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE46A, 0xE48A, 0xECE7, 0xE48A, 0xE46A, 0xE4A9, 0xDC4C, 0xECC8, 0xFD82, 0xE46B, 0xECE7, 0xFD83, 
-0xDC6B, 0xF506, 0xFD63, 0xE46B, 0xECA9, 0xECC8, 0xE48A, 0xECA8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC6B, 0xECE8, 0xE4A9, 0xE48B, 0xD42C, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xB423, 0x8323, 0xFDC0, 0xF526, 0xFD63, 0xFDE0, 0xF545, 0xF525, 0xF545, 0xF544, 0xF525, 0xF544, 0xFD44, 0xF545, 0xF525, 
-0xF506, 0xECC8, 0xF545, 0xECE7, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF526, 0xDC4B, 0xDC4C, 0xF545, 0xDC4B, 
-0xDC6B, 0xF525, 0xDC4C, 0xE48A, 0xFD63, 0xECE7, 0xF506, 0xF525, 0xE4A9, 0xECE7, 0xF545, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECE7, 0xECA9, 0xED07, 0xECA9, 0xD3EE, 0xF545, 0xF525, 
-0xECC8, 0xF525, 0xF506, 0xECC8, 0xF525, 0xF506, 0xECC8, 0xF545, 0xECE7, 0xECA9, 0xF545, 0xECE7, 0xECC8, 0xF545, 0xECE7, 0xECC9, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECE8, 0xECE7, 0xECC8, 0xECE8, 0xF507, 
-0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AC5, 0xECE6, 0xFD64, 0xF525, 0xF525, 0xF544, 0xF525, 0xF545, 0xF544, 0xF525, 
-0xF525, 0xF545, 0xF525, 0xF545, 0xF506, 0xE48A, 0xF544, 0xF506, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xDC2D, 0xE4A9, 0xECE7, 0xDC2D, 
-0xECC8, 0xECC8, 0xDC2C, 0xDC4B, 0xDC4C, 0xDC2C, 0xECC8, 0xF506, 0xF544, 0xE4A9, 0xECE7, 0xFD44, 0xECA9, 0xED07, 0xF544, 0xECA8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xDC6B, 0xDC4C, 0xED06, 0xDC4B, 0xDC4C, 0xF506, 0xDC4C, 0xDC4B, 0xF506, 0xDC4C, 
-0xDC6B, 0xECE7, 0xF545, 0xF506, 0xE4A9, 0xF544, 0xF506, 0xE4A9, 0xF544, 0xED07, 0xE4A9, 0xFD44, 0xECE7, 0xECA9, 0xFD44, 0xECE7, 
-0xECC8, 0xFD44, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xDC2D, 0xECE7, 0xE48A, 
-0xDC2D, 0xECE7, 0xE46A, 0xE44C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC23, 0x7AE4, 0xF544, 0xFD45, 0xF506, 0xF525, 0xF525, 
-0xF506, 0xF525, 0xF525, 0xF525, 0xE48A, 0xECC8, 0xFD64, 0xE48A, 0xE4A9, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xE46A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE46B, 0xDC4C, 0xDC4C, 0xDC4C, 0xFD44, 0xF525, 0xDC6B, 0xECC8, 0xECA9, 0xE48A, 
-0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xE48A, 0xECE7, 0xE48A, 0xE48A, 0xECE7, 
-0xE48A, 0xE48A, 0xE48A, 0xDC4C, 0xE4A9, 0xFD82, 0xE48A, 0xECE7, 0xFD83, 0xE46B, 0xECE7, 0xFD83, 0xE46A, 0xE4A9, 0xECC8, 0xE48A, 
-0xECA9, 0xECC8, 0xE48A, 0xECA8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xE4A9, 0xE46B, 0xECC8, 0xE4A9, 0xE46B, 0xECC8, 0xE4A9, 0xE48B, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8323, 0xFDC0, 
-0xFD45, 0xF525, 0xF544, 0xF544, 0xF525, 0xF544, 0xF544, 0xF525, 0xF525, 0xF506, 0xECC8, 0xF545, 0xF506, 0xECA9, 0xECC8, 0xECC8, 
-0xECC8, 0xECE8, 0xECC8, 0xECC8, 0xF506, 0xDC6B, 0xDC4C, 0xF525, 0xDC4C, 0xDC4C, 0xFDA2, 0xDC6B, 0xE46B, 0xFD83, 0xECE7, 0xECE7, 
-0xF544, 0xECC8, 0xECE7, 0xF544, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECE7, 
-0xECC8, 0xECE7, 0xECE7, 0xECC8, 0xECE7, 0xECC8, 0xD3EE, 0xF525, 0xF525, 0xE4A9, 0xF525, 0xF506, 0xE4A9, 0xF545, 0xF506, 0xECC8, 
-0xF545, 0xECE7, 0xE4A9, 0xF544, 0xECE7, 0xECA9, 0xF544, 0xECE7, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECE8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECE8, 0xF507, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xBC42, 0x7AC5, 0xECE6, 0xFD64, 0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xF545, 0xF525, 0xF545, 0xF506, 0xE489, 0xF545, 
-0xF506, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xDC2D, 0xE48A, 0xECE7, 0xDC0D, 0xE4A9, 0xECE7, 0xD40D, 0xECA8, 0xF506, 0xF525, 0xECE7, 
-0xED07, 0xF544, 0xECC8, 0xECE8, 0xF544, 0xECA8, 0xECE7, 0xF544, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xE46B, 
-0xDC2C, 0xF506, 0xDC4B, 0xDC4C, 0xF525, 0xDC4B, 0xDC4C, 0xF525, 0xDC4C, 0xDC4B, 0xED06, 0xF525, 0xF526, 0xECA9, 0xF525, 0xF506, 
-0xECA9, 0xF545, 0xF506, 0xE4A9, 0xF545, 0xED07, 0xE4A9, 0xF544, 0xECE7, 0xECA9, 0xF544, 0xECE7, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xDC2D, 0xECC8, 0xE48A, 0xDC2D, 0xECE7, 0xE48A, 0xDC2D, 0xECE7, 0xE46B, 0xE44D, 
-0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x7B04, 0xF543, 0xFD45, 0xF525, 0xE4A9, 0xE4A9, 0xF544, 0xE48A, 0xECC8, 0xFD64, 
-0xE48A, 0xE4A9, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xDC4C, 
-0xF525, 0xF544, 0xDC2C, 0xF544, 0xF544, 0xDC6B, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xE48A, 0xECC8, 0xE4A9, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xDC6B, 0xE4A9, 0xFD82, 0xE48A, 
-0xECC8, 0xFD83, 0xE48A, 0xECE7, 0xFD83, 0xE48A, 0xE4A9, 0xECC8, 0xE48A, 0xE4A9, 0xECC8, 0xE48A, 0xECA9, 0xECC8, 0xE4A9, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xE46A, 0xECC8, 0xECA9, 0xE46A, 0xECC8, 0xE4A9, 
-0xE48A, 0xECC8, 0xE4A9, 0xECAA, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8323, 0xFDA0, 0xFD65, 0xF526, 0xF545, 0xF545, 
-0xF525, 0xF544, 0xF525, 0xE4A9, 0xF545, 0xF506, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xED06, 0xE46A, 0xDC2C, 
-0xF526, 0xDC4B, 0xDC4C, 0xFD82, 0xECE7, 0xECC8, 0xFD44, 0xECE7, 0xECE7, 0xFD44, 0xECC8, 0xECE7, 0xFD44, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECE7, 0xECC8, 0xDC2D, 0xECC8, 0xECC8, 0xD3EE, 
-0xF525, 0xF544, 0xE48A, 0xF545, 0xF525, 0xE4A9, 0xF545, 0xF526, 0xE4A9, 0xF544, 0xF506, 0xE4A9, 0xF544, 0xF506, 0xE4A9, 0xF544, 
-0xECE7, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 
-0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF507, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AE5, 0xECE6, 
-0xFD45, 0xF545, 0xF525, 0xF525, 0xF545, 0xF525, 0xF506, 0xE4A9, 0xF525, 0xF506, 0xECA9, 0xECC8, 0xECC8, 0xECE8, 0xDC2D, 0xE48A, 
-0xF506, 0xDC0D, 0xE4A9, 0xF506, 0xD40E, 0xECA9, 0xF506, 0xF525, 0xECE7, 0xECE7, 0xF545, 0xECC8, 0xECC8, 0xF544, 0xECC8, 0xECE7, 
-0xF545, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xE46B, 0xDC2D, 0xECE7, 0xDC6B, 0xDC2D, 0xF526, 0xDC6B, 0xDC2C, 
-0xF545, 0xDC4B, 0xDC4C, 0xF506, 0xF525, 0xF526, 0xECC8, 0xF525, 0xF506, 0xE4A9, 0xF525, 0xF506, 0xE4A9, 0xF525, 0xED07, 0xE4A9, 
-0xF525, 0xECE7, 0xE4A9, 0xF545, 0xECE7, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC2D, 
-0xECC8, 0xE4A9, 0xDC2D, 0xECC8, 0xE48A, 0xDC2D, 0xF506, 0xE48A, 0xDC2D, 0xF506, 0xE48A, 0xDC4D, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xBC42, 0x7AE4, 0xE48A, 0xECC9, 0xF544, 0xE4A9, 0xECA9, 0xFD63, 0xE4A9, 0xE4A9, 0xECC8, 0xE4A9, 0xECA9, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xE4A9, 0xE48A, 0xE46B, 0xE4A9, 0xE48A, 0xE46B, 0xDC4B, 0xF526, 0xFD64, 0xDC4C, 0xF525, 0xF544, 0xDC6B, 0xECC8, 
-0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xE48A, 0xECC8, 0xE4A9, 
-0xE48A, 0xE46B, 0xE46A, 0xE48A, 0xE46A, 0xE46B, 0xE4A9, 0xFD82, 0xE4A9, 0xECA9, 0xFD83, 0xE4A9, 0xE4A9, 0xECC8, 0xE48A, 0xE4A9, 
-0xECC8, 0xE48A, 0xE4A9, 0xECC8, 0xE48A, 0xECA9, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECA8, 0xE48A, 0xECC8, 0xECA8, 0xE48A, 0xECC8, 0xECA8, 0xE48A, 0xE46B, 0xE48A, 0xE4A9, 0xE46B, 0xE48A, 0xECA9, 
-0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE5, 0xED05, 0xFD64, 0xF526, 0xF544, 0xF525, 0xE48A, 0xF545, 0xF525, 0xE4A9, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xE48A, 0xDC2C, 0xF506, 0xE46B, 0xDC2D, 0xFD82, 0xECE7, 0xECA9, 0xFD64, 
-0xECE7, 0xECC8, 0xFD64, 0xECC8, 0xECE8, 0xFD64, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xD3EE, 0xF506, 0xFD64, 0xD3EF, 0xF506, 0xFD44, 0xE48A, 0xF525, 0xF525, 0xE48A, 0xF545, 
-0xF525, 0xE48A, 0xF544, 0xF526, 0xE48A, 0xFD44, 0xF506, 0xE4A9, 0xFD44, 0xF506, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xDC2C, 0xE48A, 
-0xED07, 0xDC2C, 0xE48A, 0xF507, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE4, 0xED06, 0xFD46, 0xF544, 0xF525, 0xF506, 
-0xE4A9, 0xF526, 0xF506, 0xECA9, 0xECC8, 0xECC8, 0xECE7, 0xDC2D, 0xE46B, 0xF506, 0xDC0D, 0xE48A, 0xF525, 0xD40E, 0xE4A9, 0xF525, 
-0xF526, 0xED06, 0xECE7, 0xF525, 0xECC8, 0xECC8, 0xF525, 0xECC8, 0xECC8, 0xF525, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECE7, 0xE46A, 0xDC2D, 0xECE7, 0xE46B, 0xDC2D, 0xF506, 0xE46B, 0xDC2D, 0xF525, 0xF526, 0xF526, 0xED06, 0xF526, 0xF506, 0xECC7, 
-0xF526, 0xF506, 0xE4A9, 0xF526, 0xED06, 0xE4A9, 0xF525, 0xED07, 0xE4A9, 0xF525, 0xECE7, 0xE4A9, 0xF525, 0xECE7, 0xECA9, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC2D, 0xE4A9, 0xE4A9, 0xDC2D, 0xECC8, 0xE4A9, 0xDC0D, 0xECE7, 
-0xE4A9, 0xDC0D, 0xF526, 0xE489, 0xDC0D, 0xF525, 0xE48A, 0xDC4D, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AE4, 0xE489, 
-0xECC9, 0xFD64, 0xECA9, 0xE4A9, 0xECC8, 0xE4A9, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xE48A, 0xE46B, 0xECA9, 0xE48A, 
-0xE46B, 0xE46B, 0xF506, 0xFD63, 0xDC4C, 0xF525, 0xFD44, 0xE46B, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xE4A9, 0xECC8, 0xE4A9, 0xE4A9, 0xE46B, 0xE46B, 0xE48A, 0xFD83, 0xECC8, 0xE48A, 
-0xFD83, 0xECC8, 0xE4A9, 0xFD83, 0xECC8, 0xE4A9, 0xECC8, 0xE489, 0xE4A9, 0xECC8, 0xE489, 0xE4A9, 0xECC8, 0xE48A, 0xE4A9, 0xECC8, 
-0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE489, 
-0xECC8, 0xECC8, 0xE4A9, 0xDC6B, 0xE48A, 0xECC8, 0xDC6B, 0xE48A, 0xECA8, 0xDC6B, 0xE48A, 0xECC9, 0xD42C, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xBC42, 0x7AC5, 0xED25, 0xFD65, 0xE48A, 0xF545, 0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC9, 0xECC8, 0xECC8, 0xECC8, 
-0xE48A, 0xDC2C, 0xECE7, 0xE46A, 0xDC2D, 0xFD83, 0xECE7, 0xE4A9, 0xFD64, 0xECE7, 0xECC8, 0xFD64, 0xECE7, 0xECC8, 0xFD64, 0xECE7, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xD40E, 0xECE7, 
-0xFD63, 0xE46B, 0xF525, 0xF544, 0xE46B, 0xF525, 0xF544, 0xE48A, 0xF545, 0xF525, 0xE48A, 0xF544, 0xF525, 0xE48A, 0xFD44, 0xF525, 
-0xE48A, 0xFD64, 0xF506, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECA9, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xDC4C, 0xE46B, 0xECE7, 0xDC4C, 0xE48A, 0xECE7, 0xDC4C, 0xE48A, 0xF4E8, 
-0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE4, 0xECE6, 0xF526, 0xE4A9, 0xF506, 0xED06, 0xECA8, 0xECC8, 0xECC8, 0xECE7, 
-0xDC2D, 0xE46B, 0xF525, 0xDC2D, 0xE48A, 0xF525, 0xD40D, 0xE4A9, 0xF525, 0xF506, 0xED06, 0xECE7, 0xF526, 0xECC8, 0xECC8, 0xF525, 
-0xECC8, 0xECC8, 0xF525, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xDC2D, 0xECE7, 0xE46A, 0xDC2D, 0xF506, 
-0xE46A, 0xDC2D, 0xF525, 0xF526, 0xF506, 0xECE7, 0xF506, 0xF506, 0xECE7, 0xF506, 0xF506, 0xE4A9, 0xF506, 0xED06, 0xE4A9, 0xF506, 
-0xED07, 0xE4A9, 0xF506, 0xECE7, 0xE4A9, 0xF526, 0xECE7, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xDC2D, 0xE4A9, 0xECA8, 0xDC2D, 0xE4A9, 0xE4A9, 0xDC0D, 0xECE7, 0xE4A9, 0xD40E, 0xF506, 0xECA9, 0xD40E, 0xF526, 0xE489, 
-0xD40D, 0xF525, 0xE48A, 0xDC2D, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AE4, 0xE489, 0xECA9, 0xECC8, 0xE4A9, 0xECA9, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECA8, 0xE48A, 0xDC4C, 0xECC8, 0xE48A, 0xDC4B, 0xE48A, 0xF506, 0xFD63, 0xDC6B, 0xF506, 0xFD64, 
-0xE46A, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 
-0xECC8, 0xECC8, 0xECA8, 0xDC4B, 0xE46A, 0xE4A9, 0xFD63, 0xECE7, 0xE48A, 0xFD83, 0xECE8, 0xE489, 0xFD83, 0xECC8, 0xE48A, 0xECC8, 
-0xE4A9, 0xE4A9, 0xECC8, 0xE4A9, 0xE4A9, 0xECC8, 0xE4A9, 0xE4A9, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xE46B, 0xE46B, 0xECC8, 0xDC6B, 
-0xE46A, 0xECC8, 0xDC4B, 0xE48A, 0xECC8, 0xDC4B, 0xE48A, 0xECE8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xBC42, 0xBC42, 0x7AC5, 0xF525, 
-0xFD65, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xECC9, 0xECC8, 0xECC8, 0xE48A, 0xDC4C, 0xECC8, 0xE48A, 0xDC2D, 0xFD83, 0xF506, 
-0xE48A, 0xFD63, 0xED07, 0xE4A9, 0xFD63, 0xECE7, 0xECC8, 0xFD63, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xE4A9, 0xECC8, 0xECC8, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xDC0D, 0xECC8, 0xFD83, 0xE46B, 0xF506, 0xFD44, 0xE46B, 0xF525, 0xFD44, 
-0xE48A, 0xF525, 0xF544, 0xE48A, 0xF545, 0xF545, 0xE48A, 0xF544, 0xF525, 0xE48A, 0xFD44, 0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECA9, 0xECC8, 0xECC8, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 
-0xDC4B, 0xE46B, 0xECE7, 0xDC4B, 0xE46A, 0xECE7, 0xDC4C, 0xE48A, 0xECC8, 0xDC2C, 0xE46A, 0xF4E8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 
-0xB3E4, 0xB3E4, 0x8304, 0xECE6, 0xF507, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xDC2C, 0xDC4B, 0xF525, 0xDC2D, 0xE46B, 0xF545, 0xDC0D, 
-0xE48A, 0xF544, 0xF506, 0xECE7, 0xECA9, 0xF506, 0xECC8, 0xECC8, 0xF526, 0xECC8, 0xECC8, 0xF526, 0xECC8, 0xECA8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xDC0D, 0xECC8, 0xE48A, 0xDC2D, 0xED06, 0xE48A, 0xD40D, 0xF545, 0xF526, 0xED07, 0xF506, 0xF506, 
-0xF506, 0xF506, 0xF506, 0xF507, 0xE4A9, 0xED07, 0xED06, 0xE4A9, 0xED06, 0xECE7, 0xE4A9, 0xED06, 0xECE7, 0xE4A9, 0xF506, 0xECE7, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC2D, 0xE48A, 0xECC8, 0xDC0D, 0xE4A9, 0xECA8, 
-0xDC0D, 0xECC8, 0xECC8, 0xD40E, 0xECE7, 0xECC8, 0xD40E, 0xF506, 0xE4A9, 0xD40E, 0xF526, 0xE4A9, 0xDC2D, 0xE48A, 0xDC2C, 0xE44C, 
-0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABA6, 0xABC6, 0x8303, 0xE4A8, 0xECC9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC4C, 
-0xECC8, 0xE48A, 0xDC4C, 0xE489, 0xED06, 0xFD63, 0xE48A, 0xECA8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xDC4C, 0xE46B, 0xE4A9, 0xFD63, 
-0xED06, 0xE48A, 0xFD63, 0xECE7, 0xE48A, 0xFD63, 0xECE7, 0xE4A9, 0xECC8, 0xE4A9, 0xE4A9, 0xECC8, 0xE4A9, 0xE4A9, 0xECC8, 0xE4A9, 
-0xE4A9, 0xECC8, 0xE4A9, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECA8, 0xECC8, 
-0xECC8, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xDC4B, 0xDC6B, 0xECE7, 0xDC4B, 0xE46B, 0xECE7, 0xDC4C, 0xE46B, 0xECE7, 0xDC4B, 0xE48A, 
-0xECE7, 0xDC2C, 0xE48A, 0xF4E8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xBC42, 0xBC61, 0x7AE5, 0xE4A8, 0xECE8, 0xECC8, 0xE4A9, 0xECA9, 
-0xECC8, 0xECC9, 0xE48A, 0xDC4C, 0xECA9, 0xE48A, 0xDC2D, 0xFD63, 0xF526, 0xE48A, 0xFD63, 0xF506, 0xE4A9, 0xFD63, 0xF506, 0xE4A9, 
-0xFD63, 0xED07, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xE489, 0xECC8, 0xECC8, 0xE489, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECA9, 
-0xDC2D, 0xECC8, 0xFD82, 0xE46B, 0xF506, 0xFD63, 0xDC6B, 0xF506, 0xFD64, 0xE46B, 0xF525, 0xFD44, 0xE48A, 0xF545, 0xF544, 0xE48A, 
-0xF544, 0xF545, 0xE48A, 0xF544, 0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 
-0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC9, 0xE46B, 0xE46B, 0xECC8, 0xE46B, 0xE46B, 0xECC8, 0xDC6B, 
-0xE46A, 0xECC8, 0xDC2C, 0xE46B, 0xECC8, 0xDC2C, 0xE46A, 0xECE8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB3E5, 0xB3E5, 0x8323, 0xE4A8, 
-0xECC8, 0xECE7, 0xDC2C, 0xDC4C, 0xF525, 0xDC2D, 0xDC4B, 0xF544, 0xDC2D, 0xE48A, 0xFD64, 0xED06, 0xECE7, 0xECA8, 0xF506, 0xECC7, 
-0xECC8, 0xF506, 0xECC8, 0xECC8, 0xF506, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC0D, 0xE4A9, 0xE4A9, 0xDC0D, 0xECC8, 0xE489, 
-0xDC0D, 0xECE7, 0xE489, 0xD40E, 0xF545, 0xF526, 0xECE7, 0xF506, 0xF506, 0xECE7, 0xF506, 0xF506, 0xECE7, 0xECA9, 0xECE7, 0xED07, 
-0xECA9, 0xECE7, 0xECE7, 0xE4A9, 0xECE7, 0xECE7, 0xE4A9, 0xED07, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xDC2D, 0xE48A, 0xECE8, 0xDC2D, 0xE48A, 0xECC8, 0xD40D, 0xECA9, 0xECC8, 0xD40E, 0xECE7, 0xECC8, 0xD40E, 
-0xECE7, 0xECC8, 0xD40E, 0xF506, 0xE4A9, 0xDC2D, 0xE48A, 0xDC4C, 0xDC2C, 0xE48A, 0xDC2C, 0xE44C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xABC6, 0xABC6, 0x8304, 0xE4C8, 0xF4E8, 0xECC8, 0xECC8, 0xE4A9, 0xDC2C, 0xECC8, 0xE4A9, 0xDC2C, 0xE4A9, 0xED07, 0xFD64, 0xE4A9, 
-0xECA8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xDC4C, 0xE46B, 0xECA8, 0xFD64, 0xF506, 0xE48A, 0xFD64, 0xED06, 0xE48A, 0xFD64, 0xECE7, 
-0xE4A9, 0xECC8, 0xECA9, 0xECA9, 0xECC8, 0xE4A9, 0xECA9, 0xECC8, 0xECA9, 0xECA9, 0xECC8, 0xECA9, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xDC6B, 0xDC4B, 
-0xF506, 0xDC4B, 0xDC6B, 0xF506, 0xDC4C, 0xE46B, 0xED07, 0xDC4B, 0xE46A, 0xECE7, 0xDC4C, 0xE48A, 0xECE7, 0xDC2C, 0xE48A, 0xF507, 
-0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xBC42, 0xBC61, 0x7AE5, 0xE489, 0xECA9, 0xECC8, 0xE4A9, 0xE48A, 0xDC0D, 0xFD44, 0xF526, 0xD3EE, 
-0xFD64, 0xF525, 0xE46B, 0xFD64, 0xF525, 0xE48A, 0xFD64, 0xF526, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 
-0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xDC2C, 0xECA9, 0xFD82, 0xE46B, 0xECE7, 0xFD63, 0xE46B, 
-0xF506, 0xFD63, 0xE46A, 0xF525, 0xFD64, 0xE48A, 0xF545, 0xFD64, 0xE48A, 0xF544, 0xFD44, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xECC9, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 
-0xECC8, 0xE4A9, 0xE46A, 0xE46B, 0xECC8, 0xE46B, 0xE46B, 0xECC9, 0xE46B, 0xE46A, 0xECC8, 0xDC4C, 0xDC6B, 0xECC8, 0xDC2C, 0xE46B, 
-0xECC8, 0xDC2C, 0xE46B, 0xECC9, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB3E5, 0xABE5, 0x8342, 0xDC4B, 0xE44C, 0xF525, 0xDC2C, 0xDC4B, 
-0xFD63, 0xECE7, 0xF506, 0xF544, 0xECE7, 0xECE8, 0xECA8, 0xECE7, 0xECC8, 0xECA8, 0xED07, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xDC0D, 0xE4A9, 0xECA8, 0xDC0D, 0xECC8, 0xECC8, 0xD40D, 0xECE7, 0xE4A9, 0xD40E, 0xF525, 0xF525, 0xECC8, 
-0xF525, 0xF506, 0xECE8, 0xF525, 0xF506, 0xECE7, 0xECC8, 0xECE8, 0xECE7, 0xECA9, 0xECE7, 0xECE7, 0xECA9, 0xECE7, 0xECE7, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xDC2D, 0xE46A, 0xECE7, 0xDC2D, 
-0xE48A, 0xECE8, 0xDC0D, 0xE4A9, 0xECE7, 0xD40D, 0xECC8, 0xECE7, 0xD40E, 0xECE7, 0xECC8, 0xD40E, 0xECE7, 0xECC8, 0xDC2D, 0xE46B, 
-0xDC4C, 0xDC4C, 0xE48A, 0xDC4C, 0xDC4C, 0xE48A, 0xDC4C, 0xE46C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABC6, 0xABC6, 0x8303, 0xE4C8, 
-0xECC9, 0xDC2D, 0xE4A9, 0xECE7, 0xFD64, 0xECC8, 0xECE7, 0xFD64, 0xECC8, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECA9, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC7, 0xECC8, 0xECC8, 0xECE7, 0xDC4B, 0xDC6B, 0xF506, 0xDC4C, 0xDC6B, 
-0xECC8, 0xF544, 0xF526, 0xE48A, 0xF544, 0xF506, 0xE489, 0xFD44, 0xF506, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECA9, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xE46B, 0xDC4C, 0xF506, 0xDC6B, 0xDC4C, 0xF506, 0xDC4B, 0xDC6B, 0xF506, 
-0xDC4B, 0xE46B, 0xF506, 0xDC4C, 0xE46A, 0xF506, 0xDC4C, 0xE48A, 0xED07, 0xDC4B, 0xDC4C, 0xE46B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xBC42, 0xBC61, 0x7AC6, 0xF524, 0xFD65, 0xD3EE, 0xF545, 0xF544, 0xDC4C, 0xFD44, 0xF545, 0xE46B, 0xFD64, 0xF525, 0xE48A, 0xFD64, 
-0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xECC9, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE48A, 0xE46A, 
-0xE46A, 0xE4A9, 0xDC4C, 0xE4A9, 0xFD82, 0xE48A, 0xECE7, 0xFD83, 0xE46B, 0xECE7, 0xFD63, 0xE46A, 0xF506, 0xFD63, 0xE48A, 0xF525, 
-0xFD64, 0xE48A, 0xF545, 0xFD64, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xE48A, 0xE4A9, 0xECC8, 0xE48A, 0xECA9, 0xECC8, 0xE48A, 0xECC9, 0xECC8, 0xE48A, 0xE46A, 0xE46A, 0xE4A9, 0xE46A, 0xE46A, 
-0xE4A9, 0xE46A, 0xE46A, 0xE4A9, 0xDC4C, 0xDC4C, 0xECC8, 0xDC4C, 0xDC4B, 0xECA9, 0xDC2C, 0xDC6B, 0xE4A9, 0xDC4C, 0xDC2C, 0xE46C, 
-0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8303, 0xE4C7, 0xF507, 0xFD44, 0xECE7, 0xECE7, 0xF525, 0xECE7, 0xECC8, 0xECC8, 
-0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC2D, 0xE48A, 0xECC8, 0xDC0D, 
-0xECA9, 0xECC8, 0xD40D, 0xECE7, 0xECC8, 0xD3EE, 0xF525, 0xF525, 0xECC8, 0xF525, 0xF506, 0xECC8, 0xF525, 0xF506, 0xECC8, 0xECC8, 
-0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECE7, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xDC2D, 0xE46B, 0xECE7, 0xDC2D, 0xE46A, 0xECE7, 0xDC2D, 0xE48A, 0xECE7, 0xD40D, 0xECA9, 
-0xECE7, 0xD40D, 0xECC8, 0xECE7, 0xD40E, 0xECE8, 0xECC8, 0xDC2D, 0xE46B, 0xDC4C, 0xDC4C, 0xE46B, 0xDC4C, 0xDC4C, 0xE46A, 0xDC4C, 
-0xDC4B, 0xE46A, 0xDC4B, 0xE48B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABC5, 0xABC6, 0x8303, 0xE4A8, 0xF4E8, 0xFD44, 0xECC8, 0xECE7, 
-0xFD44, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 
-0xECE7, 0xECC8, 0xECC8, 0xF506, 0xDC4B, 0xDC4C, 0xF525, 0xDC4C, 0xDC4B, 0xECE7, 0xF545, 0xF526, 0xE4A9, 0xF545, 0xF506, 0xE4A9, 
-0xF544, 0xF506, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xED06, 
-0xE46A, 0xDC2C, 0xF526, 0xE46B, 0xDC4C, 0xF525, 0xDC4B, 0xDC4C, 0xF525, 0xDC6B, 0xDC6B, 0xF506, 0xDC6B, 0xE46A, 0xF506, 0xDC4B, 
-0xE48A, 0xF506, 0xDC6B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xE48B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xBC42, 0xBC61, 0x7AC6, 0xF524, 
-0xFD64, 0xDC4C, 0xF544, 0xF544, 0xDC6B, 0xFD44, 0xF545, 0xE48A, 0xFD64, 0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xE46A, 0xECA9, 0xECC8, 0xE46A, 0xECC9, 0xECC8, 0xE48A, 0xE48A, 0xE48A, 0xE489, 0xDC4B, 0xE4A9, 0xFDA2, 0xE48A, 0xECC8, 
-0xFD82, 0xE48A, 0xECE7, 0xFD83, 0xE48A, 0xF506, 0xFD63, 0xE489, 0xF525, 0xFD63, 0xE48A, 0xF525, 0xFD64, 0xE4A9, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xE489, 0xECC8, 0xE48A, 0xE4A9, 0xECC8, 0xE48A, 0xE4A9, 0xECC8, 
-0xE46A, 0xE4A9, 0xECC8, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE4A9, 0xDC4C, 0xDC4C, 0xE4A9, 
-0xDC4C, 0xDC4C, 0xE4A9, 0xDC4C, 0xDC4B, 0xE4A9, 0xDC4C, 0xDC2C, 0xDC4B, 0xDC4C, 0xDC2C, 0xE46C, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 
-0xABC5, 0xABC5, 0x8303, 0xE4C8, 0xF508, 0xF544, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC2D, 0xE48A, 0xECE7, 0xDC2D, 0xE4A9, 0xECE8, 0xDC0D, 0xECC8, 0xECE8, 0xD3EE, 0xF526, 
-0xF544, 0xE4A9, 0xF525, 0xF526, 0xE4A9, 0xF525, 0xF506, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xDC4C, 0xDC4B, 0xED06, 0xDC2C, 0xDC6B, 
-0xED07, 0xDC2C, 0xE46B, 0xECE7, 0xDC2D, 0xE48A, 0xECE7, 0xDC2D, 0xE4A9, 0xED06, 0xDC0D, 0xECA9, 0xECE7, 0xD40D, 0xECC8, 0xECE7, 
-0xDC2C, 0xDC4B, 0xDC4B, 0xDC4C, 0xE46B, 0xDC4C, 0xDC4C, 0xE46B, 0xDC4C, 0xDC4B, 0xE46B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xE48B, 
-0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8303, 0xE4C7, 0xF4E7, 0xF545, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF506, 0xE46B, 0xDC4C, 0xF525, 
-0xDC4B, 0xDC4C, 0xED06, 0xF525, 0xF525, 0xE4A9, 0xF525, 0xF526, 0xECA9, 0xF525, 0xF506, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 
-0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 
-0xECE7, 0xECC8, 0xECE7, 0xECC7, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF506, 0xE48A, 0xDC2D, 0xF525, 0xE46A, 0xDC2C, 0xF525, 0xE46B, 
-0xDC4C, 0xF525, 0xE46B, 0xDC4B, 0xF525, 0xE46B, 0xE46B, 0xF525, 0xE46B, 0xE48A, 0xF526, 0xE46B, 0xDC4C, 0xE46A, 0xE46B, 0xDC4C, 
-0xE46B, 0xE46B, 0xDC4C, 0xE48B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xBC42, 0xBC61, 0x7AC6, 0xF525, 0xFD64, 0xDC6B, 0xF544, 0xF544, 
-0xE48A, 0xFD44, 0xF545, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE46B, 0xE4A9, 0xECC8, 0xE46B, 0xECA9, 0xECC8, 
-0xE46B, 0xE48A, 0xE48A, 0xE48A, 0xE46B, 0xE48A, 0xFD82, 0xE4A9, 0xECA9, 0xFD82, 0xE48A, 0xECC8, 0xFD83, 0xE4A9, 0xECE7, 0xFD63, 
-0xE4A9, 0xF506, 0xFD63, 0xE489, 0xF525, 0xFD63, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xE48A, 0xE48A, 0xECE7, 0xE48A, 0xE48A, 0xECE7, 0xE46A, 0xE489, 0xECC7, 0xE46B, 0xE4A9, 0xECE7, 0xE46A, 0xE48A, 0xE48A, 0xE48A, 
-0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xDC4C, 0xDC4C, 0xE4A9, 0xDC4C, 0xDC4C, 0xE4A9, 0xDC4C, 0xDC4C, 0xE4A9, 0xDC4C, 
-0xDC2C, 0xDC4B, 0xDC4C, 0xDC2C, 0xDC4B, 0xDC4C, 0xDC2C, 0xE46C, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xABC6, 0xABC6, 0x8303, 0xE4A8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC2C, 0xE48A, 
-0xECE7, 0xDC2D, 0xE48A, 0xECE7, 0xDC2D, 0xE4A9, 0xECE7, 0xD3EE, 0xF506, 0xFD44, 0xE48A, 0xF525, 0xF525, 0xE48A, 0xF545, 0xF525, 
-0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xDC4C, 0xDC4C, 0xF506, 0xDC4C, 0xDC6B, 0xED06, 0xDC2C, 0xE46B, 0xED07, 0xDC2C, 0xE46A, 0xECE7, 
-0xDC2D, 0xE48A, 0xED06, 0xDC2D, 0xE4A9, 0xECE7, 0xDC2D, 0xE4A9, 0xECE7, 0xDC2C, 0xDC4C, 0xDC4B, 0xDC4B, 0xDC4B, 0xDC4C, 0xDC4B, 
-0xDC6B, 0xDC4C, 0xDC6B, 0xDC6B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xE48B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xABC5, 0xB3E5, 0x8303, 0xECC7, 0xF4E8, 0xECC8, 0xECE7, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 
-0xECC8, 0xECC8, 0xED07, 0xECC8, 0xECC8, 0xF526, 0xE46A, 0xDC2D, 0xF545, 0xDC6B, 0xDC2C, 0xF506, 0xF525, 0xF526, 0xECC8, 0xF526, 
-0xF526, 0xECC8, 0xF525, 0xF506, 0xECC7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECE7, 0xECC9, 0xECE7, 0xECE7, 0xECC9, 0xECE7, 0xECE7, 
-0xECC8, 0xF506, 0xE48A, 0xDC0D, 0xF525, 0xE48A, 0xDC2D, 0xF525, 0xE46A, 0xDC2D, 0xF525, 0xE46A, 0xDC4C, 0xF525, 0xE46A, 0xE46B, 
-0xF525, 0xE46B, 0xE46A, 0xF525, 0xE46B, 0xDC4B, 0xE48A, 0xE46B, 0xDC4B, 0xE48A, 0xE46B, 0xDC4B, 0xE46A, 0xE46A, 0xDC4B, 0xE48B, 
-0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xBC42, 0xBC61, 0x7AC6, 0xF525, 0xFD64, 0xE48A, 0xF544, 0xF544, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xE46B, 0xE489, 0xECE7, 0xDC6B, 0xE4A9, 0xECE7, 0xE46B, 0xE48A, 0xE4A9, 0xE46B, 0xE46B, 0xE48A, 0xFD82, 
-0xECC8, 0xE4A9, 0xFD83, 0xE4A9, 0xECA9, 0xFD83, 0xE4A9, 0xECE7, 0xFD63, 0xECA9, 0xF506, 0xFD63, 0xE4A9, 0xF506, 0xFD63, 0xECA9, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xE46A, 0xECE7, 0xE46A, 0xE48A, 0xECE7, 0xE46B, 
-0xE48A, 0xECE7, 0xE46B, 0xE48A, 0xECE7, 0xE46B, 0xE48A, 0xE4A9, 0xE46B, 0xE48A, 0xE4A9, 0xE46B, 0xE48A, 0xE4A9, 0xE48A, 0xDC4C, 
-0xDC4C, 0xE48A, 0xDC4C, 0xDC4C, 0xE48A, 0xDC4C, 0xDC4C, 0xE48A, 0xDC4C, 0xDC2C, 0xDC4B, 0xDC4C, 0xDC2C, 0xDC4B, 0xDC4C, 0xDC2C, 
-0xDC4C, 0xDC4B, 0xDC4B, 0xE46C, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xABC6, 0xABC6, 0x8323, 0xE4A8, 0xECC9, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xDC2C, 0xE46A, 0xECE7, 0xDC2C, 0xE48A, 0xECE7, 0xDC2C, 0xE4A9, 0xECE7, 
-0xD3EE, 0xF506, 0xFD64, 0xE48A, 0xF525, 0xF525, 0xE48A, 0xF525, 0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC9, 0xECC8, 0xECC8, 0xECC9, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xDC6B, 0xDC4C, 0xED07, 
-0xDC4B, 0xDC4B, 0xF507, 0xDC4C, 0xDC6B, 0xED07, 0xDC4C, 0xE46B, 0xECE7, 0xDC2C, 0xE48A, 0xED07, 0xDC2C, 0xE48A, 0xECE7, 0xDC2C, 
-0xE4A9, 0xECE7, 0xDC4C, 0xDC4C, 0xDC4B, 0xDC6B, 0xDC4C, 0xDC4C, 0xDC6B, 0xDC4B, 0xDC4C, 0xDC6B, 0xDC4B, 0xDC4C, 0xE46B, 0xDC6B, 
-0xDC4C, 0xE46B, 0xDC6B, 0xDC4C, 0xE46B, 0xDC4C, 0xCBB0, 0xE46C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB3E5, 0xB3E5, 0x8304, 0xECE7, 
-0xF507, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF506, 0xECE7, 0xECC8, 0xF526, 0xE48A, 
-0xDC0D, 0xF525, 0xE46A, 0xDC2D, 0xF525, 0xF526, 0xF506, 0xECE8, 0xF506, 0xF506, 0xECC7, 0xF506, 0xF506, 0xECE7, 0xECC8, 0xECC8, 
-0xED06, 0xECC8, 0xECC8, 0xED07, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 
-0xECC8, 0xECE7, 0xECE7, 0xECA9, 0xECE7, 0xECE7, 0xECA9, 0xED07, 0xECE7, 0xECA9, 0xF506, 0xE4A9, 0xD40D, 0xF526, 0xE489, 0xDC0D, 
-0xF525, 0xE48A, 0xDC2C, 0xF525, 0xE48A, 0xDC4C, 0xF525, 0xE48A, 0xDC6B, 0xF525, 0xE46A, 0xE46B, 0xF525, 0xE48A, 0xDC4B, 0xE48A, 
-0xE46B, 0xDC4B, 0xE48A, 0xE46B, 0xDC4B, 0xE46A, 0xE46B, 0xDC4B, 0xE48A, 0xDC6B, 0xD3EE, 0xE48B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xBC42, 0xBC61, 0x7AC6, 0xF525, 0xFD64, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC6B, 0xE48A, 0xECE7, 0xDC6B, 
-0xE48A, 0xECE7, 0xDC4B, 0xE48A, 0xECA9, 0xE46B, 0xE46B, 0xE48A, 0xFD83, 0xECC8, 0xE48A, 0xFD83, 0xECC8, 0xE4A9, 0xFD83, 0xECC8, 
-0xECC8, 0xFD63, 0xECC8, 0xECE7, 0xFD63, 0xECA9, 0xED06, 0xFD63, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xE48A, 0xE46B, 0xECE7, 0xE46A, 0xE46B, 0xECE7, 0xE46B, 0xE46A, 0xECE7, 0xE46B, 0xE48A, 0xECE7, 0xE46B, 0xE46A, 
-0xECC8, 0xDC6B, 0xE48A, 0xECA8, 0xE46B, 0xDC4C, 0xDC4C, 0xE48A, 0xDC4C, 0xDC4C, 0xE48A, 0xDC4C, 0xDC4C, 0xE48A, 0xDC4C, 0xDC4C, 
-0xE48A, 0xDC4C, 0xDC4C, 0xDC4B, 0xDC4C, 0xDC4C, 0xDC4B, 0xDC4C, 0xDC4C, 0xDC4B, 0xDC4C, 0xDC4B, 0xDC4B, 0xDC6B, 0xE46B, 0xE46C, 
-0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8304, 0xE4A8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 
-0xDC4C, 0xE46B, 0xECE7, 0xDC4C, 0xE46A, 0xECE8, 0xDC4C, 0xE48A, 0xECE7, 0xD40E, 0xECE7, 0xFD63, 0xE46B, 0xF525, 0xF544, 0xE46B, 
-0xF525, 0xF545, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xE46B, 0xDC4C, 0xED07, 0xDC6B, 0xDC4B, 0xECE7, 0xDC4B, 0xDC6B, 0xED07, 0xDC4B, 
-0xE46B, 0xECE7, 0xDC4C, 0xE46A, 0xECE7, 0xDC4C, 0xE48A, 0xECE7, 0xDC4C, 0xDC4C, 0xDC4B, 0xE46B, 0xDC4C, 0xDC4B, 0xE46B, 0xDC4C, 
-0xDC4B, 0xE46B, 0xDC4C, 0xDC4C, 0xDC4B, 0xDC4C, 0xDC4C, 0xE46B, 0xDC4B, 0xDC4C, 0xE46B, 0xDC4B, 0xDC4C, 0xE46B, 0xDC4C, 0xCBB0, 
-0xDC4C, 0xDC4B, 0xCBB1, 0xE46C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABC6, 0xABA6, 0x8323, 0xE4A8, 0xECC9, 0xECC8, 0xECE8, 0xECC8, 
-0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF507, 0xECE7, 0xECA8, 0xF506, 0xE48A, 0xD40D, 0xF525, 0xE48A, 0xDC0D, 0xF525, 0xF526, 0xF506, 
-0xECE7, 0xF506, 0xF506, 0xECE7, 0xF506, 0xF506, 0xED06, 0xECC8, 0xECC8, 0xF506, 0xECC8, 0xECC8, 0xF506, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECE7, 0xECE7, 0xECA9, 0xECE7, 0xECE7, 0xECA9, 
-0xECE7, 0xECE7, 0xECA9, 0xF506, 0xECA8, 0xD40E, 0xF506, 0xECA9, 0xD40E, 0xF526, 0xE4A9, 0xDC2C, 0xF525, 0xE4A9, 0xDC4C, 0xF525, 
-0xE489, 0xDC6B, 0xF525, 0xE48A, 0xDC6B, 0xF525, 0xE48A, 0xDC6B, 0xE48A, 0xE46B, 0xDC6B, 0xE48A, 0xE46B, 0xDC6B, 0xE48A, 0xE46B, 
-0xDC6B, 0xE48A, 0xE46B, 0xD3EE, 0xE46B, 0xE46B, 0xD3EE, 0xE48B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABC5, 0xABE5, 0x8304, 0xE4A8, 
-0xECE8, 0xECC8, 0xE46B, 0xE46B, 0xECE7, 0xDC6B, 0xE48A, 0xECE7, 0xDC4B, 0xE48A, 0xECE7, 0xDC4B, 0xE48A, 0xECC8, 0xDC4B, 0xE46A, 
-0xE4A9, 0xFD63, 0xECE7, 0xE48A, 0xFD63, 0xECE7, 0xE4A9, 0xFD63, 0xECC8, 0xECC8, 0xFD63, 0xECC8, 0xECE7, 0xFD63, 0xECC8, 0xECE7, 
-0xFD63, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xDC4B, 0xECE7, 0xE46A, 0xDC6B, 
-0xECE7, 0xE46B, 0xE46B, 0xECE7, 0xE46B, 0xE46B, 0xECE7, 0xDC6B, 0xE46B, 0xECC8, 0xDC6B, 0xE46A, 0xECC8, 0xE46B, 0xDC4C, 0xDC4B, 
-0xE46B, 0xDC4C, 0xDC4C, 0xE46A, 0xDC4C, 0xDC4C, 0xE48A, 0xDC4C, 0xDC4C, 0xE48A, 0xDC4C, 0xDC4C, 0xDC6B, 0xDC4C, 0xDC4C, 0xDC6B, 
-0xDC4C, 0xDC4C, 0xDC6B, 0xDC4C, 0xDC4B, 0xDC6B, 0xDC4B, 0xE46B, 0xDC6B, 0xDC4B, 0xE46B, 0xE46B, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 
-0xABC5, 0xABC5, 0x8304, 0xE4A8, 0xECE8, 0xECE8, 0xE46B, 0xE46B, 0xECE7, 0xDC4B, 0xE46B, 0xECC8, 0xDC4B, 0xE46B, 0xECC8, 0xDC2C, 
-0xE46B, 0xECC7, 0xDC0D, 0xECC8, 0xFD83, 0xE46B, 0xF506, 0xFD44, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 
-0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 
-0xDC4C, 0xECE7, 0xE46A, 0xDC4B, 0xECE7, 0xE46B, 0xDC6B, 0xECE8, 0xE46B, 0xE46B, 0xECE8, 0xDC4B, 0xE46B, 0xECE7, 0xDC4B, 0xE46A, 
-0xECE7, 0xDC6B, 0xDC4C, 0xDC4B, 0xE46B, 0xDC4C, 0xDC4B, 0xE46B, 0xDC4C, 0xDC4B, 0xE46B, 0xDC4C, 0xDC4C, 0xDC4B, 0xDC4C, 0xDC4C, 
-0xDC6B, 0xDC4C, 0xDC4C, 0xE46B, 0xDC4C, 0xDC4C, 0xE46B, 0xDC4C, 0xCBB1, 0xDC4C, 0xDC4B, 0xCB91, 0xDC4C, 0xDC4C, 0xCB91, 0xE46C, 
-0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABC6, 0xABA6, 0x8323, 0xECC7, 0xF4E8, 0xECC8, 0xECE7, 0xECE7, 0xECA9, 0xF506, 0xECC8, 0xD40E, 
-0xF506, 0xE4A9, 0xD40E, 0xFD44, 0xECA9, 0xD40E, 0xF545, 0xF526, 0xED07, 0xF506, 0xF506, 0xF506, 0xF506, 0xECC8, 0xECC8, 0xF526, 
-0xECC8, 0xECC8, 0xF525, 0xECC8, 0xECC8, 0xF525, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECE7, 0xECC8, 0xECE7, 0xED06, 0xECA9, 0xECE7, 0xECE7, 0xECA9, 0xECE7, 0xECE7, 0xD40E, 0xECE7, 0xECC8, 0xD40E, 0xECE7, 
-0xECC8, 0xD40E, 0xF506, 0xECC8, 0xDC2D, 0xF506, 0xECA9, 0xDC4C, 0xF526, 0xE4A9, 0xDC4B, 0xF525, 0xE489, 0xDC6B, 0xF525, 0xE48A, 
-0xDC6B, 0xE48A, 0xDC6B, 0xE46B, 0xE48A, 0xE46B, 0xDC6B, 0xE48A, 0xE46B, 0xDC6B, 0xE48A, 0xE46B, 0xD40E, 0xE46B, 0xE46B, 0xD40E, 
-0xE46B, 0xE46B, 0xDC0D, 0xDC4D, 0xD40C, 0x7B04, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8323, 0xDC4B, 0xE46B, 0xECE7, 0xDC6B, 0xE46B, 
-0xED06, 0xDC4B, 0xE46B, 0xECE7, 0xDC4B, 0xE46B, 0xE4A9, 0xFD64, 0xF506, 0xE48A, 0xFD63, 0xED06, 0xE48A, 0xFD63, 0xECE7, 0xE4A9, 
-0xFD63, 0xECE7, 0xECC8, 0xFD63, 0xECE7, 0xECC8, 0xFD63, 0xECC8, 0xECE7, 0xFD63, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xDC4C, 0xECE7, 0xE48A, 0xDC4C, 0xECE7, 0xE46B, 0xDC4B, 0xF506, 0xE46B, 0xDC4B, 0xECE7, 
-0xDC4B, 0xDC6B, 0xECE7, 0xDC4B, 0xE46B, 0xECE7, 0xDC6B, 0xDC4C, 0xDC6B, 0xE46B, 0xDC4C, 0xDC4B, 0xE46B, 0xDC4C, 0xDC4B, 0xE46B, 
-0xDC4C, 0xDC4B, 0xE48A, 0xDC4C, 0xDC4C, 0xE46B, 0xDC4C, 0xDC4C, 0xE46B, 0xDC4C, 0xDC4C, 0xDC6B, 0xDC4C, 0xDC4C, 0xDC6B, 0xDC4B, 
-0xE46B, 0xE46B, 0xDC4B, 0xE46B, 0xE46B, 0xDC6B, 0xE48A, 0xD3EF, 0xCBCF, 0x8303, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8323, 0xDC6B, 
-0xE48B, 0xECE7, 0xE46B, 0xE46B, 0xECC8, 0xE46B, 0xE46B, 0xECC8, 0xDC2C, 0xE4A9, 0xFD82, 0xE46A, 0xED07, 0xFD83, 0xE46B, 0xF506, 
-0xFD63, 0xE48A, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xDC4B, 0xECE7, 0xE48A, 0xDC6B, 0xECE7, 0xE46A, 0xDC6B, 
-0xECC8, 0xE46B, 0xE46B, 0xECC8, 0xE46B, 0xE46B, 0xECC8, 0xE46B, 0xE46B, 0xECC8, 0xE46B, 0xDC4C, 0xDC4C, 0xE46B, 0xDC4C, 0xDC4C, 
-0xE46B, 0xDC4C, 0xDC4C, 0xE48A, 0xDC4C, 0xDC4C, 0xDC4B, 0xDC4C, 0xDC4C, 0xDC6B, 0xDC4C, 0xDC4C, 0xDC6B, 0xDC4C, 0xDC4C, 0xDC6B, 
-0xDC4C, 0xCB91, 0xDC2D, 0xDC4B, 0xCB91, 0xDC2C, 0xDC4C, 0xCB91, 0xDC4B, 0xDC6B, 0xCB91, 0xE46B, 0xDC6A, 0x7AE4, 0xA368, 0xA368, 
-0xABC6, 0xABA6, 0x8323, 0xECE7, 0xF507, 0xECA9, 0xED07, 0xECC8, 0xD40E, 0xECE7, 0xECC8, 0xD3EE, 0xF525, 0xF525, 0xECE7, 0xF506, 
-0xF506, 0xECE7, 0xF506, 0xF506, 0xECE7, 0xF526, 0xECE7, 0xECC8, 0xF525, 0xECE8, 0xECC8, 0xF525, 0xECC8, 0xECC8, 0xF525, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECE7, 0xF506, 0xECA9, 0xECE7, 
-0xED07, 0xECA9, 0xECE7, 0xECE7, 0xD40E, 0xECC8, 0xECE7, 0xD40E, 0xECE7, 0xECC8, 0xD40E, 0xECE7, 0xECC8, 0xDC2D, 0xF506, 0xECC8, 
-0xDC4C, 0xF506, 0xECA9, 0xDC4C, 0xF526, 0xE4A9, 0xDC4B, 0xF525, 0xE4A9, 0xDC6B, 0xE48A, 0xDC6B, 0xE46B, 0xE48A, 0xDC6B, 0xDC6B, 
-0xE48A, 0xE46B, 0xE46B, 0xE48A, 0xE46B, 0xDC2D, 0xE46B, 0xE46B, 0xDC0D, 0xE46B, 0xE46B, 0xDC2D, 0xDC2D, 0xDC2D, 0xDC2C, 0xDC2D, 
-0xD40D, 0x7B04, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8323, 0xDC4B, 0xE46C, 0xF506, 0xDC4B, 0xDC6B, 0xF506, 0xDC4C, 0xDC6B, 0xECA8, 
-0xF544, 0xF526, 0xE48A, 0xFD64, 0xF506, 0xE48A, 0xFD64, 0xED06, 0xE48A, 0xFD64, 0xED06, 0xECA9, 0xFD64, 0xECE7, 0xECC8, 0xFD64, 
-0xECE7, 0xECC8, 0xFD64, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xDC2C, 0xECE7, 
-0xE48A, 0xDC4C, 0xECE7, 0xE46B, 0xDC4C, 0xED06, 0xE46B, 0xDC4C, 0xED06, 0xDC6B, 0xDC4B, 0xF506, 0xDC4B, 0xDC6B, 0xF506, 0xDC6B, 
-0xDC4C, 0xE46B, 0xDC4B, 0xDC4C, 0xE46B, 0xDC4B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xDC6B, 0xE46B, 0xDC4C, 0xDC4B, 0xE46B, 0xDC4C, 
-0xDC4B, 0xE46B, 0xDC4C, 0xDC4C, 0xE46B, 0xDC4C, 0xDC4C, 0xE46B, 0xDC4B, 0xDC6B, 0xE46B, 0xDC4B, 0xDC6B, 0xE46B, 0xDC6B, 0xE48A, 
-0xD3EE, 0xD3EE, 0xE48A, 0xD3EF, 0xCBCE, 0x8303, 0xA368, 0xA368, 0xABE5, 0xB3E5, 0x8303, 0xDC6A, 0xE48B, 0xECA9, 0xE46B, 0xE46B, 
-0xECC8, 0xDC4C, 0xE4A9, 0xFD82, 0xE48A, 0xECE7, 0xFD83, 0xE46B, 0xECE7, 0xFD63, 0xE48A, 0xECA9, 0xECC8, 0xE48A, 0xECA9, 0xECC8, 
-0xE48A, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xE4A9, 0xDC4B, 0xECE7, 0xE48A, 0xDC6B, 0xECE7, 0xE48A, 0xDC6B, 0xECA9, 0xE46A, 0xE46B, 0xECC8, 0xE46A, 0xE46B, 0xECC8, 
-0xE46B, 0xE46B, 0xECC9, 0xE46A, 0xDC4B, 0xDC4C, 0xE46A, 0xDC4B, 0xDC4C, 0xE46A, 0xDC4B, 0xDC4C, 0xE48A, 0xDC4C, 0xDC4C, 0xDC4B, 
-0xDC2C, 0xDC4C, 0xDC4B, 0xDC4C, 0xDC4C, 0xDC4B, 0xDC4C, 0xDC4C, 0xDC4B, 0xDC4B, 0xCB91, 0xDC0D, 0xE46B, 0xCB91, 0xDC2D, 0xDC4B, 
-0xCB91, 0xDC4C, 0xDC6B, 0xCB72, 0xE46B, 0xE46B, 0xCB72, 0xE46B, 0xDC6A, 0x7AE4, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8303, 0xECE6, 
-0xF4E8, 0xD40E, 0xECE7, 0xECC8, 0xD3EE, 0xF525, 0xF525, 0xECC8, 0xF526, 0xF506, 0xECC8, 0xF525, 0xF506, 0xECE7, 0xF525, 0xECE7, 
-0xECA9, 0xF525, 0xECE7, 0xECA8, 0xF525, 0xECE7, 0xECC8, 0xF545, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECE8, 0xF506, 0xECC8, 0xECE7, 0xED07, 0xECA9, 0xECE7, 0xED07, 0xD40E, 0xECA9, 0xED06, 
-0xD40E, 0xECC8, 0xECE7, 0xD40E, 0xECE7, 0xECE8, 0xDC2D, 0xECE7, 0xECC8, 0xDC4C, 0xF506, 0xECC8, 0xDC4C, 0xF506, 0xECA9, 0xDC4C, 
-0xF526, 0xE4A9, 0xDC6B, 0xE48A, 0xDC6B, 0xE46B, 0xE48A, 0xDC6B, 0xE46B, 0xE48A, 0xDC6B, 0xE46B, 0xE48A, 0xE46B, 0xDC2C, 0xE46B, 
-0xE46B, 0xDC2D, 0xE46B, 0xE46B, 0xDC2C, 0xDC2D, 0xDC0D, 0xDC4C, 0xDC2D, 0xDC2D, 0xDC4C, 0xDC2D, 0xD40D, 0x7B04, 0xA368, 0xA368, 
-0xA369, 0xA349, 0x8342, 0xDC4B, 0xE46C, 0xF506, 0xDC4B, 0xDC4B, 0xECC8, 0xF545, 0xF525, 0xE48A, 0xF544, 0xF526, 0xE48A, 0xF544, 
-0xF506, 0xE48A, 0xFD44, 0xF506, 0xE4A9, 0xFD64, 0xECE7, 0xECA9, 0xFD64, 0xECE7, 0xECC8, 0xFD64, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xDC2C, 0xECE7, 0xE48A, 0xDC2C, 0xECE7, 0xE46A, 0xDC2C, 0xF506, 0xE46A, 
-0xDC2C, 0xF506, 0xE46B, 0xDC4C, 0xF506, 0xDC6B, 0xDC4C, 0xF506, 0xDC4B, 0xDC2C, 0xE46A, 0xDC4C, 0xDC4C, 0xE46A, 0xDC4C, 0xDC4C, 
-0xE46B, 0xE46B, 0xDC4C, 0xDC6B, 0xE46B, 0xDC4C, 0xDC6B, 0xE46B, 0xDC4C, 0xDC6B, 0xE46B, 0xDC4C, 0xDC4C, 0xE46B, 0xDC4B, 0xDC4C, 
-0xE46B, 0xDC4B, 0xDC4B, 0xE46A, 0xDC4B, 0xDC4B, 0xE46B, 0xDC6B, 0xE46B, 0xD40D, 0xD3EE, 0xE48A, 0xD40E, 0xD3EE, 0xE48A, 0xDC0F, 
-0xCBCE, 0x8303, 0xA368, 0xA368, 0xABA7, 0xAB87, 0x8323, 0xDC4B, 0xE46B, 0xECA9, 0xDC4C, 0xE48A, 0xFDA2, 0xE48A, 0xECC8, 0xFD83, 
-0xE48A, 0xECE7, 0xFD83, 0xE48A, 0xE4A9, 0xECC8, 0xE48A, 0xE4A9, 0xECC8, 0xE48A, 0xECA9, 0xECC8, 0xE48A, 0xECA8, 0xECC8, 0xE4A9, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC6B, 0xECC8, 0xE4A9, 0xDC6B, 0xECE8, 
-0xE4A9, 0xE46B, 0xE4A9, 0xE48A, 0xE46A, 0xE4A9, 0xE46A, 0xE46A, 0xE4A9, 0xE46A, 0xE46A, 0xE4A9, 0xE48A, 0xDC6B, 0xDC4C, 0xE46A, 
-0xDC6B, 0xDC4C, 0xE48A, 0xDC6B, 0xDC4C, 0xDC4C, 0xDC2C, 0xDC4B, 0xDC4C, 0xDC2C, 0xDC4C, 0xDC4B, 0xDC2C, 0xDC4C, 0xDC4B, 0xDC4B, 
-0xCBB0, 0xD3EE, 0xE46B, 0xCBB1, 0xD40E, 0xE46B, 0xCB91, 0xD40D, 0xE46B, 0xCB91, 0xDC2C, 0xE46B, 0xCB72, 0xDC4B, 0xE48A, 0xCB72, 
-0xE46B, 0xE46B, 0xC372, 0xE48B, 0xDC6A, 0x7AE5, 0xA368, 0xA368, 0xB3E5, 0xB3E5, 0x7AE4, 0xF525, 0xF546, 0xD3EF, 0xF506, 0xF545, 
-0xECA8, 0xF525, 0xF526, 0xECC8, 0xF525, 0xF506, 0xECC8, 0xF525, 0xED07, 0xE4A9, 0xF545, 0xECE7, 0xECA9, 0xF545, 0xECE7, 0xECA9, 
-0xF545, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xED07, 
-0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECE8, 0xF506, 0xDC0D, 0xE4A9, 0xF506, 0xD40D, 0xECA9, 0xECE7, 0xD40D, 0xECC8, 0xECE7, 0xDC2D, 
-0xECE7, 0xECC8, 0xDC4C, 0xECE7, 0xECC8, 0xDC4C, 0xED07, 0xECA8, 0xDC6B, 0xE46B, 0xDC4B, 0xE46A, 0xE46A, 0xDC4B, 0xE46B, 0xE46A, 
-0xDC4B, 0xE46B, 0xE48A, 0xDC6B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xDC2D, 0xD40E, 
-0xDC6B, 0xDC2D, 0xD40D, 0xDC6B, 0xDC0D, 0xDC0D, 0xDC6B, 0xDC2E, 0xD40D, 0x8304, 0xA368, 0xA368, 0xA369, 0xA349, 0x8323, 0xED05, 
-0xFD45, 0xECA9, 0xF525, 0xF525, 0xE489, 0xF545, 0xF525, 0xE4A9, 0xF545, 0xF506, 0xE48A, 0xF544, 0xF506, 0xE4A9, 0xF544, 0xF506, 
-0xE4A9, 0xFD44, 0xECE7, 0xECA9, 0xFD44, 0xECE7, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE489, 
-0xDC2D, 0xECC8, 0xE48A, 0xDC2D, 0xECE7, 0xE48A, 0xDC2D, 0xED06, 0xE48A, 0xDC2D, 0xF506, 0xE46A, 0xDC2C, 0xF526, 0xE46B, 0xDC4C, 
-0xF525, 0xDC6B, 0xDC2C, 0xE48A, 0xDC4C, 0xDC4C, 0xE48A, 0xDC4C, 0xDC4C, 0xE46A, 0xDC6B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xE46B, 
-0xE46B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4B, 0xDC4B, 0xE46B, 0xDC4B, 0xDC4B, 0xE46B, 0xDC4B, 0xDC4B, 0xE46A, 0xDC6B, 0xDC4C, 0xE46B, 
-0xDC6B, 0xE46B, 0xDC2D, 0xD3EE, 0xE46A, 0xD40D, 0xD3EE, 0xE46A, 0xD40E, 0xD40E, 0xE48A, 0xDC0F, 0xCBCE, 0x8303, 0xA368, 0xA368, 
-0xABA7, 0xABA7, 0x8323, 0xDC6A, 0xECC9, 0xFD82, 0xE4A9, 0xECA9, 0xFD82, 0xE48A, 0xECC8, 0xFD82, 0xE48A, 0xE4A9, 0xECC8, 0xE48A, 
-0xE4A9, 0xECC8, 0xE48A, 0xE4A9, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xE46B, 0xECC8, 0xECA9, 0xE46B, 0xECC8, 0xE4A9, 0xE46A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 
-0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE46A, 0xDC2C, 0xE46A, 0xE46B, 0xDC2C, 0xE48A, 0xE46B, 0xDC4C, 0xDC4C, 0xDC2C, 
-0xDC4B, 0xDC4C, 0xDC2C, 0xDC4B, 0xDC4C, 0xDC2C, 0xDC4C, 0xDC4B, 0xDC4B, 0xCBB0, 0xD3EF, 0xE46B, 0xCBB0, 0xD3EE, 0xE46B, 0xCB91, 
-0xD40E, 0xE46B, 0xCB91, 0xDC2D, 0xE48A, 0xCB92, 0xDC4C, 0xE48A, 0xC372, 0xDC4B, 0xE48A, 0xC372, 0xE46B, 0xE46B, 0xCB91, 0xD3EF, 
-0xD3EE, 0x8304, 0xA368, 0xA368, 0xB3E5, 0xB3E5, 0x7B04, 0xED05, 0xFD45, 0xE4A9, 0xF525, 0xF525, 0xE4A9, 0xF525, 0xF526, 0xECA9, 
-0xF525, 0xF506, 0xE4A9, 0xF545, 0xF506, 0xE4A9, 0xF544, 0xED07, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xED06, 0xDC2D, 
-0xE48A, 0xF506, 0xDC0D, 0xE4A9, 0xED06, 0xDC0D, 0xECA9, 0xECE7, 0xDC2D, 0xECC8, 0xECE7, 0xDC4C, 0xECE8, 0xECC8, 0xDC4C, 0xECE7, 
-0xECC8, 0xDC4B, 0xE46B, 0xDC4B, 0xE46B, 0xE46B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xE46A, 0xE48A, 0xDC4C, 0xDC4B, 0xE46B, 0xDC4B, 
-0xDC4C, 0xE46B, 0xDC6B, 0xDC4C, 0xE46B, 0xDC6B, 0xDC4B, 0xDC2D, 0xD3EE, 0xE46B, 0xDC2D, 0xD3EE, 0xE46B, 0xDC0D, 0xD40E, 0xE46B, 
-0xDC0D, 0xD40D, 0xE46B, 0xDC0E, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xA349, 0x9B4A, 0x8323, 0xED05, 0xFD45, 0xE4A9, 0xF525, 0xF525, 
-0xE4A9, 0xF525, 0xF506, 0xE48A, 0xF525, 0xF506, 0xE4A9, 0xF545, 0xF506, 0xE4A9, 0xF545, 0xED07, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC2D, 0xECC8, 0xE4A9, 0xDC2D, 0xECC8, 0xE48A, 0xDC2D, 
-0xED07, 0xE48A, 0xDC2D, 0xF506, 0xE48A, 0xDC2D, 0xF525, 0xE46A, 0xDC2C, 0xF525, 0xE46B, 0xDC2D, 0xE48A, 0xDC2C, 0xDC4C, 0xE48A, 
-0xDC4C, 0xDC2C, 0xE48A, 0xDC4B, 0xDC4C, 0xE46A, 0xE46B, 0xDC4B, 0xE46A, 0xE46B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4B, 0xDC4B, 0xE46B, 
-0xDC6B, 0xDC4B, 0xE46B, 0xDC6B, 0xDC4C, 0xE46B, 0xDC6B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4B, 0xDC2D, 0xD3EE, 0xE46B, 0xDC2D, 0xD3EE, 
-0xE46B, 0xDC2D, 0xD40E, 0xE46B, 0xD3EE, 0xD3EE, 0xE46B, 0xDC0E, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xABA6, 0xABA6, 0x8303, 0xDC6A, 
-0xECC9, 0xFD82, 0xE4A9, 0xECA9, 0xFD82, 0xE4A9, 0xE489, 0xECC8, 0xE48A, 0xE4A9, 0xECC8, 0xE48A, 0xE4A9, 0xECC8, 0xE4A9, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECA8, 0xE46A, 0xECC8, 0xECC8, 
-0xE46A, 0xECC8, 0xECA9, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 0xE48A, 
-0xDC2C, 0xE48A, 0xE48A, 0xDC2C, 0xE48A, 0xE48A, 0xDC4C, 0xDC4C, 0xDC2C, 0xDC4B, 0xDC4C, 0xDC2C, 0xDC4B, 0xDC4C, 0xDC2C, 0xDC4B, 
-0xDC4C, 0xDC4B, 0xCBD0, 0xD3CF, 0xE46A, 0xCBB0, 0xD3EF, 0xE46B, 0xCBB0, 0xD3EE, 0xE46B, 0xCB91, 0xDC0D, 0xE48A, 0xCB91, 0xDC2C, 
-0xE489, 0xCB72, 0xDC4C, 0xE48A, 0xC372, 0xDC6B, 0xE48A, 0xCB91, 0xD3EF, 0xD3EF, 0xCBB0, 0xD3EF, 0xD3EE, 0x8304, 0xA368, 0xA368, 
-0xABE5, 0xABE5, 0x7B04, 0xED05, 0xFD45, 0xE48A, 0xF525, 0xF525, 0xE4A9, 0xF545, 0xF525, 0xE489, 0xF545, 0xF506, 0xE4A9, 0xF544, 
-0xF506, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xED07, 0xDC2C, 0xE48A, 0xF506, 0xDC2D, 0xE48A, 0xED06, 0xDC2D, 0xE4A9, 
-0xECE7, 0xDC2D, 0xE4A9, 0xECE7, 0xDC2C, 0xECC8, 0xECC8, 0xDC2C, 0xECC8, 0xECC8, 0xDC4B, 0xDC4B, 0xDC4B, 0xE46A, 0xDC6B, 0xDC4C, 
-0xE46B, 0xE46B, 0xDC4C, 0xE46A, 0xE46A, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4B, 0xDC6B, 0xE46A, 0xDC4B, 0xE46B, 
-0xDC2C, 0xD3CF, 0xE46A, 0xDC2D, 0xD3CF, 0xE46A, 0xDC2D, 0xD3EF, 0xE46A, 0xDC2D, 0xD40E, 0xE48A, 0xD40E, 0xD40E, 0xE48A, 0xDC0E, 
-0xD3EE, 0x8304, 0xA368, 0xA368, 0xA349, 0x9B2A, 0x8323, 0xED06, 0xFD26, 0xECC8, 0xF525, 0xF506, 0xE489, 0xF525, 0xF506, 0xE4A9, 
-0xF525, 0xF506, 0xE4A9, 0xF525, 0xED07, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC2D, 
-0xE4A9, 0xECC8, 0xDC2D, 0xE4A9, 0xE4A9, 0xDC2D, 0xECC8, 0xE4A9, 0xDC0D, 0xECE7, 0xE4A9, 0xDC0D, 0xF506, 0xE489, 0xDC0D, 0xF525, 
-0xE48A, 0xDC2D, 0xF525, 0xE46A, 0xDC2D, 0xE48A, 0xDC2C, 0xDC2C, 0xE48A, 0xDC2C, 0xDC2C, 0xE48A, 0xDC4C, 0xDC4C, 0xE48A, 0xE46B, 
-0xDC4B, 0xE48A, 0xE46B, 0xDC4B, 0xE48A, 0xE46B, 0xDC6B, 0xDC4B, 0xDC4B, 0xE46B, 0xDC4B, 0xDC6B, 0xE46B, 0xDC4C, 0xE46B, 0xE46B, 
-0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xDC2C, 0xD40E, 0xDC4B, 0xDC2C, 0xD40E, 0xDC4B, 0xDC2D, 0xD40E, 0xDC6B, 0xD40E, 0xD3EE, 0xE46B, 
-0xD40E, 0xD40E, 0xE46B, 0xDC0E, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xABA6, 0xABA6, 0x8303, 0xE48A, 0xECC9, 0xFD83, 0xECA9, 0xE48A, 
-0xECC8, 0xE48A, 0xE4A9, 0xECC8, 0xE48A, 0xE4A9, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECA8, 0xE48A, 0xE46B, 0xE48A, 0xE4A9, 
-0xE46B, 0xE48A, 0xE4A9, 0xE46B, 0xE48A, 0xE4A9, 0xE46B, 0xE48A, 0xE4A9, 0xDC2C, 0xE48A, 0xE4A9, 0xDC2C, 0xE48A, 0xE48A, 0xDC4C, 
-0xDC4C, 0xDC4C, 0xDC4B, 0xDC4C, 0xDC2C, 0xDC4B, 0xDC4C, 0xDC2C, 0xDC4B, 0xDC4C, 0xDC4B, 0xD3CF, 0xD3CF, 0xE46A, 0xD3D0, 0xD3EF, 
-0xE46A, 0xCBD0, 0xD3EF, 0xE46B, 0xCBB0, 0xD40E, 0xE48A, 0xCB91, 0xDC2D, 0xE4A9, 0xCB91, 0xDC2C, 0xE489, 0xCB72, 0xDC4C, 0xE48A, 
-0xCB91, 0xD3EF, 0xD3EE, 0xCBB0, 0xD3EE, 0xD3EF, 0xCBB0, 0xD3EF, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x7AE4, 0xED05, 
-0xFD45, 0xE48A, 0xF525, 0xF525, 0xE48A, 0xF544, 0xF525, 0xE48A, 0xF544, 0xF526, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECE7, 0xDC4C, 0xE46B, 0xF506, 0xDC2C, 0xE48A, 0xED07, 0xDC2C, 0xE48A, 0xECE7, 0xDC2D, 0xE489, 0xECE7, 0xDC2C, 0xE4A9, 0xECC8, 
-0xDC2C, 0xECC9, 0xECC8, 0xDC4B, 0xDC4B, 0xDC4C, 0xE46B, 0xDC4B, 0xDC4C, 0xE46B, 0xDC6B, 0xDC4C, 0xE46A, 0xE46B, 0xDC4C, 0xE46B, 
-0xE46B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xE46B, 0xE46A, 0xDC4C, 0xE46A, 0xDC4C, 0xCBB0, 0xE48A, 0xDC2C, 0xD3D0, 0xE48A, 0xDC2D, 
-0xD3CF, 0xE48A, 0xDC2D, 0xD3EE, 0xE48A, 0xD40D, 0xD3EE, 0xE48A, 0xD40E, 0xD40E, 0xE48A, 0xDC0E, 0xD3EE, 0x8304, 0xA368, 0xA368, 
-0xA349, 0x9B2A, 0x8323, 0xED06, 0xF526, 0xE4A9, 0xF506, 0xF506, 0xE4A9, 0xF526, 0xED06, 0xE4A9, 0xF525, 0xED07, 0xECA9, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC2D, 0xE48A, 0xECC8, 0xDC2D, 0xE4A9, 0xECA8, 0xDC2D, 0xE4A9, 
-0xE4A9, 0xDC0D, 0xECE7, 0xE4A9, 0xD40D, 0xF506, 0xECA9, 0xD40D, 0xF526, 0xE489, 0xDC0D, 0xF525, 0xE48A, 0xDC2D, 0xE48A, 0xDC2C, 
-0xDC2C, 0xE48A, 0xDC2C, 0xDC2C, 0xE48A, 0xDC4C, 0xDC4C, 0xE48A, 0xE46B, 0xDC4B, 0xE48A, 0xE46B, 0xDC4B, 0xE48A, 0xE46B, 0xE46B, 
-0xDC4B, 0xDC4C, 0xE46B, 0xDC4B, 0xDC4C, 0xE46B, 0xDC4C, 0xDC4B, 0xE46B, 0xDC4C, 0xDC4B, 0xE46B, 0xDC4C, 0xDC2C, 0xD40E, 0xDC4C, 
-0xDC4C, 0xD40D, 0xDC4C, 0xDC0D, 0xD3CF, 0xDC4B, 0xD40D, 0xD3EF, 0xDC4B, 0xD40E, 0xD3EE, 0xDC4B, 0xD3EE, 0xD40E, 0xDC6B, 0xDC0E, 
-0xD3EE, 0x8304, 0xA368, 0xA368, 0xABC6, 0xABA6, 0x8303, 0xE489, 0xECAA, 0xECC8, 0xE4A9, 0xE4A9, 0xECC8, 0xE489, 0xE4A9, 0xECC8, 
-0xE4A9, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4AA, 
-0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xECC8, 0xE4A9, 0xE46B, 0xE46A, 0xECC8, 0xDC6B, 0xE48A, 0xECC8, 0xDC6B, 0xE48A, 0xECA9, 0xE46B, 
-0xE48A, 0xECA9, 0xDC2C, 0xE48A, 0xE4A9, 0xDC2C, 0xE48A, 0xE4A9, 0xDC4C, 0xDC4C, 0xDC4C, 0xDC6B, 0xDC4C, 0xDC4C, 0xDC4B, 0xDC4C, 
-0xDC4C, 0xDC4B, 0xDC4C, 0xDC6B, 0xD3EF, 0xCBD0, 0xE48A, 0xD3CF, 0xD3CF, 0xE48A, 0xD3D0, 0xD3EF, 0xE48A, 0xCBB0, 0xD3EE, 0xE48A, 
-0xCBB0, 0xD40D, 0xE4A9, 0xCB91, 0xDC2D, 0xE4A9, 0xCBB0, 0xD3CF, 0xD3EE, 0xCBB0, 0xD3EF, 0xD3EE, 0xCBB0, 0xD3EF, 0xD3EE, 0xCBB0, 
-0xD3EF, 0xD3EE, 0xD3CF, 0xDBEF, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x7AE5, 0xED25, 0xFD65, 0xE48A, 0xF545, 0xF525, 
-0xE48A, 0xF544, 0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC9, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xDC4B, 0xE46B, 0xECE7, 0xDC4C, 0xE46B, 0xECE7, 
-0xDC4C, 0xE48A, 0xECE7, 0xDC2C, 0xE48A, 0xECE7, 0xDC2C, 0xE48A, 0xECC8, 0xDC2C, 0xE4A9, 0xECC8, 0xDC4C, 0xDC4C, 0xDC4C, 0xE46B, 
-0xDC4C, 0xDC4C, 0xE46B, 0xDC4B, 0xDC4C, 0xE46A, 0xE46B, 0xDC4C, 0xE46A, 0xE46B, 0xDC2C, 0xE46B, 0xE46A, 0xDC4C, 0xE48A, 0xDC4C, 
-0xCB91, 0xE46A, 0xDC4C, 0xCBB1, 0xE48A, 0xDC4C, 0xCBB0, 0xE48A, 0xDC2C, 0xD3CF, 0xE48A, 0xDC2C, 0xD3CF, 0xE48A, 0xDC2D, 0xD3EF, 
-0xE48A, 0xDC0D, 0xD3EE, 0xE48A, 0xD40D, 0xD3EF, 0xD3EE, 0xDC0F, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xA349, 0x9B2A, 0x8323, 0xECE6, 
-0xF526, 0xE4A9, 0xF506, 0xED06, 0xE4A9, 0xF506, 0xED07, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xDC2D, 0xE48A, 0xECE7, 0xDC2D, 0xE48A, 0xECC8, 0xDC2D, 0xE4A9, 0xECA8, 0xDC0D, 0xECC8, 0xECC8, 0xD40E, 0xECE7, 0xECC8, 
-0xD40E, 0xF506, 0xECA9, 0xD40E, 0xF526, 0xE489, 0xDC2D, 0xE48A, 0xDC2C, 0xDC2C, 0xE48A, 0xDC2C, 0xDC2C, 0xE48A, 0xDC4C, 0xDC4C, 
-0xE48A, 0xDC6B, 0xE46B, 0xE48A, 0xE46B, 0xDC6B, 0xE48A, 0xE46B, 0xE46B, 0xDC4B, 0xDC2C, 0xE46B, 0xDC4B, 0xDC4C, 0xE46B, 0xDC4C, 
-0xDC4C, 0xE46B, 0xDC4C, 0xDC2C, 0xDC0D, 0xDC2C, 0xDC4C, 0xDC0D, 0xDC2C, 0xDC4C, 0xDC0D, 0xDC4C, 0xDC0D, 0xD3CF, 0xDC4C, 0xDC0D, 
-0xD3EF, 0xDC4C, 0xD40D, 0xD3EF, 0xDC4C, 0xD40E, 0xD3EE, 0xDC4C, 0xD40E, 0xD3EE, 0xD3EE, 0xDC0F, 0xD3EE, 0x8304, 0xA368, 0xA368, 
-0xABC6, 0xABC6, 0x8303, 0xE489, 0xECA9, 0xECC8, 0xE4A9, 0xE4A9, 0xECC8, 0xE4A9, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xE46B, 
-0xE46B, 0xECC8, 0xE46B, 0xE46B, 0xECC8, 0xDC6B, 0xE46A, 0xECC8, 0xDC6B, 0xE48A, 0xECC8, 0xDC2C, 0xE48A, 0xECC8, 0xDC2C, 0xE48A, 
-0xECC8, 0xDC4C, 0xDC4C, 0xDC4C, 0xE46B, 0xDC4C, 0xDC4C, 0xDC6B, 0xDC4C, 0xDC4C, 0xDC6B, 0xDC4C, 0xDC6B, 0xD3EE, 0xCBD0, 0xE46A, 
-0xD3EE, 0xD3CF, 0xE48A, 0xD3CF, 0xD3EF, 0xE48A, 0xD3CF, 0xD3EE, 0xE4A9, 0xCBD0, 0xD40E, 0xE4A9, 0xCBB0, 0xD40D, 0xE4A9, 0xCBB0, 
-0xD3CF, 0xD3EE, 0xCBD0, 0xD3EF, 0xD3EE, 0xCBD0, 0xD3EF, 0xD3EE, 0xCBD0, 0xD3EF, 0xD3EE, 0xD3CF, 0xD3EE, 0xD3EE, 0xD3EE, 0xDC0F, 
-0xD3EE, 0x8304, 0xA368, 0xA368, 0xABC6, 0xABC5, 0x7AE5, 0xF525, 0xFD65, 0xE48A, 0xF545, 0xF545, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECA9, 0xECC8, 0xECC8, 0xECA9, 0xECC8, 0xECC8, 0xECA9, 
-0xECC8, 0xECC8, 0xECC8, 0xE46B, 0xE46B, 0xECE7, 0xDC4B, 0xE46B, 0xECE7, 0xDC4B, 0xE46A, 0xECE7, 0xDC2C, 0xE46B, 0xECE7, 0xDC2C, 
-0xE48A, 0xECC8, 0xDC2C, 0xE48A, 0xECC8, 0xDC4C, 0xDC4C, 0xDC4C, 0xDC6B, 0xDC4C, 0xDC4C, 0xDC6B, 0xDC4C, 0xDC4C, 0xE46B, 0xE46B, 
-0xDC2C, 0xE46A, 0xE46A, 0xDC2C, 0xE48A, 0xE46A, 0xDC2C, 0xE48A, 0xDC6B, 0xCB91, 0xE46B, 0xDC6B, 0xCB91, 0xE48A, 0xDC4C, 0xCB91, 
-0xE48A, 0xDC4C, 0xCBB0, 0xE48A, 0xDC4C, 0xD3CF, 0xE48A, 0xDC2C, 0xD3CF, 0xE48A, 0xDC2D, 0xD3EF, 0xE48A, 0xDC0D, 0xD3EF, 0xD3EE, 
-0xD3EE, 0xD3EE, 0xD3EE, 0xDC0F, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xA349, 0x9B2A, 0x8322, 0xECE6, 0xF507, 0xE4A9, 0xED06, 0xED07, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xDC2D, 0xE46A, 0xECE7, 0xDC2D, 0xE48A, 0xECE7, 
-0xDC2D, 0xE48A, 0xECC8, 0xDC0D, 0xECA9, 0xECC8, 0xD40E, 0xECE7, 0xECC8, 0xD40E, 0xECE7, 0xECC8, 0xD40E, 0xF506, 0xE4A9, 0xDC2D, 
-0xE48A, 0xDC4C, 0xDC4C, 0xE48A, 0xDC2C, 0xDC2C, 0xE48A, 0xDC4C, 0xDC4B, 0xE48A, 0xDC6B, 0xE46B, 0xE48A, 0xDC6B, 0xE46B, 0xE48A, 
-0xE46B, 0xE46B, 0xDC6B, 0xDC0D, 0xE46A, 0xDC4B, 0xDC2D, 0xE46A, 0xDC4C, 0xDC2C, 0xE46A, 0xDC4C, 0xDC2C, 0xDC2D, 0xDC2C, 0xDC2C, 
-0xDC2D, 0xDC2C, 0xDC4C, 0xDC2D, 0xDC2C, 0xDC0D, 0xD3CF, 0xDC4C, 0xDC0D, 0xD3EF, 0xDC4C, 0xD40D, 0xD3EF, 0xDC4C, 0xD40E, 0xD3EF, 
-0xDC4C, 0xD40E, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xDC0F, 0xD3EE, 0x8303, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x7B03, 0xE4A8, 
-0xF4E9, 0xECE8, 0xECC9, 0xECC9, 0xECC8, 0xECC8, 0xECE8, 0xECC8, 0xECE8, 0xF4E8, 0xECC8, 0xECC8, 0xF4E8, 0xECC8, 0xECC9, 0xECE8, 
-0xECE8, 0xECC9, 0xECE8, 0xECE8, 0xECC9, 0xECE8, 0xECE8, 0xECE8, 0xE48B, 0xE46B, 0xF507, 0xE46B, 0xE48B, 0xF4E7, 0xE46B, 0xE48B, 
-0xF4E7, 0xE46C, 0xE48B, 0xF4E8, 0xE44C, 0xE48B, 0xF4E8, 0xE44C, 0xEC8A, 0xF4E8, 0xE46C, 0xE44C, 0xE46C, 0xE46B, 0xE44C, 0xE46C, 
-0xE46B, 0xE46C, 0xE46C, 0xE46B, 0xE46C, 0xE46B, 0xDC2E, 0xD3D0, 0xE48B, 0xDC0E, 0xD3F0, 0xE48B, 0xDC0E, 0xD3EF, 0xE48B, 0xDBEF, 
-0xDBEF, 0xECAA, 0xD3EF, 0xDC0E, 0xECAA, 0xD3D0, 0xDC0E, 0xECAA, 0xD3EF, 0xD3EF, 0xDC0F, 0xD3EF, 0xD3EF, 0xDC0F, 0xD3EF, 0xD3EF, 
-0xDBEF, 0xD3EF, 0xD3EF, 0xDBEF, 0xD3F0, 0xD3EF, 0xD40F, 0xD3EF, 0xD3EF, 0xD3EF, 0xD3EF, 0xDC0F, 0xD3EE, 0x7B03, 0xA368, 0xA368, 
-0xA386, 0xDCA5, 0xBC08, 0xE48A, 0xE4C8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xD40D, 0xE489, 0xE4A8, 
-0xD40D, 0xE4A9, 0xE4A8, 0xD40D, 0xE4A8, 0xE4A8, 0xD40D, 0xE4C8, 0xE489, 0xD42C, 0xDC2C, 0xDC4B, 0xD3EE, 0xD3CE, 0xDC4B, 0xD3EE, 
-0xD3EE, 0xDC4B, 0xCBCF, 0xD3EE, 0xDC4B, 0xCBCF, 0xD3ED, 0xDC4B, 0xCBCF, 0xD40D, 0xDC4B, 0xCBAF, 0xD40D, 0xDC4B, 0xCBCF, 0xCBCE, 
-0xCBCE, 0xCBCE, 0xCBCE, 0xCBCE, 0xCBCE, 0xCBCE, 0xCBCE, 0xCBCE, 0xCBCE, 0xCBCE, 0xD3EE, 0xD3EE, 0xCBCE, 0xD3EE, 0xD3EE, 0xCBCE, 
-0xD3EE, 0xD3EE, 0xCBCE, 0xD3EE, 0xD3EE, 0xCBCE, 0xD3EE, 0xD3EE, 0xCBCE, 0xD3EE, 0xD3EE, 0xCBCE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 
-0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 0xD3EE, 
-0xD3EE, 0xB3AA, 0xC3CC, 0x9B67, 0xA349, 0xAB89, 0xA3C3, 0xC407, 0x7B03, 0x8342, 0x8323, 0x8323, 0x8342, 0x8323, 0x8323, 0x8342, 
-0x8323, 0x7AC5, 0x8323, 0x8323, 0x7AE5, 0x8323, 0x8323, 0x7AE5, 0x8323, 0x8323, 0x7AC5, 0x8323, 0x8323, 0x7AE5, 0x7AE4, 0x7AE4, 
-0x8304, 0x8304, 0x7AE5, 0x8304, 0x8304, 0x7AE5, 0x8304, 0x8304, 0x7AE5, 0x8304, 0x8304, 0x7AE5, 0x8323, 0x7B04, 0x7AE5, 0x8323, 
-0x7B04, 0x7AE4, 0x8303, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 
-0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 
-0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 
-0x8304, 0x8304, 0x8304, 0x7B03, 0xB3AA, 0x9346, 0xAB89, 0xA368, 0xA367, 0xB38C, 0xABA8, 0xCC48, 0xA349, 0xA349, 0xA369, 0xA368, 
-0xA369, 0xA369, 0xA368, 0xA349, 0xA369, 0xA368, 0xA369, 0xA369, 0xA368, 0xA369, 0xA369, 0xA368, 0xA369, 0xA369, 0xA368, 0xA369, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xC3CC, 0xAB89, 0xBBAB, 0x9B67, 0x8324, 0xA367, 0xA368, 0x9B48, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0x9B67, 0xA368, 0xA368, 0x8324, 
-
-};
-
-// icon_school_girl.png
-// Size: 100x100 (20000 bytes)
-const uint16_t icon_school_girl_bmp[10000] = {
-0x8B43, 0xB403, 0xB423, 0xABE3, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 
-0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 
-0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xBC22, 0xB404, 0xABA6, 0xBC42, 0xB3E4, 0xABA6, 0xBC42, 0xB3E4, 0xABA6, 0xBC42, 0xB3E5, 
-0xABA6, 0xABE5, 0xABC6, 0xABC6, 0xABC5, 0xABC6, 0xABC6, 0xABC5, 0xABC6, 0xABC6, 0xABC5, 0xABC6, 0xABC6, 0xABC5, 0xABC5, 0xABA6, 
-0xABC5, 0xABC5, 0xABA6, 0xABC5, 0xABC5, 0xABC6, 0xABC5, 0xABC5, 0xABC6, 0xABC5, 0xABE5, 0xABC6, 0xABC6, 0xABC5, 0xABC6, 0xABC6, 
-0xABC5, 0xABC6, 0xABC6, 0xABC5, 0xABC6, 0xABC6, 0xABC5, 0xABC6, 0xA349, 0xABC6, 0xABC5, 0xA349, 0xABC6, 0xABC6, 0xA349, 0xABC6, 
-0xA3A5, 0xA349, 0x9B67, 0x8324, 0xB403, 0xD4C2, 0xC463, 0xE502, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xB423, 0xBC22, 
-0xBC42, 0xB423, 0xBC22, 0xBC42, 0xB423, 0xBC42, 0xBC22, 0xB423, 0xBC42, 0xBC22, 0xB423, 0xBC42, 0xBC42, 0xBC22, 0xBC22, 0xBC42, 
-0xBC42, 0xBC22, 0xBC42, 0xBC42, 0xBC22, 0xBC42, 0xBC42, 0xBC22, 0xBC42, 0xBC42, 0xB404, 0xABA6, 0xBC42, 0xB404, 0xABA6, 0xBC61, 
-0xB3E4, 0xABC6, 0xBC61, 0xB3E5, 0xABC6, 0xB3E5, 0xABC6, 0xABC6, 0xB3E5, 0xABC6, 0xABC6, 0xB3E5, 0xABC6, 0xABC6, 0xB3E5, 0xB3E5, 
-0xABC6, 0xABE5, 0xB3E5, 0xABC6, 0xABE5, 0xB3E5, 0xABC6, 0xABC5, 0xB3E5, 0xABC6, 0xABC5, 0xB3E5, 0xABC6, 0xB3E5, 0xB3E5, 0xABC6, 
-0xABC5, 0xB3E5, 0xABC5, 0xABC5, 0xB3E5, 0xABC5, 0xABC5, 0xB3E4, 0xABE5, 0xABC5, 0xB3E4, 0xABC5, 0x9B4A, 0xABC6, 0xB3E5, 0x9B4A, 
-0xABC5, 0xABC5, 0x9B4A, 0xABE5, 0xCC29, 0xAB6A, 0xBBAB, 0x9B67, 0xB423, 0xC463, 0xA3A3, 0xD4A3, 0x7AE4, 0x8303, 0x8303, 0x8303, 
-0x8303, 0x8303, 0x8323, 0x7AE5, 0x7AE4, 0x8342, 0x7B04, 0x7AE4, 0x8342, 0x7AE5, 0x7AE5, 0x8323, 0x7AE5, 0x7AE5, 0x8323, 0x7AE5, 
-0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AC5, 0x7B04, 0x8303, 
-0x7AC5, 0x7B04, 0x8303, 0x7AE5, 0x8303, 0x8304, 0x7AE5, 0x8303, 0x8303, 0x7B04, 0x8323, 0x8303, 0x7B04, 0x8323, 0x8303, 0x7B04, 
-0x8323, 0x8303, 0x8304, 0x7AE5, 0x7AE5, 0x7AE4, 0x7AE5, 0x7AE4, 0x7AE4, 0x7AC5, 0x7AE4, 0x7AE4, 0x7AC5, 0x8304, 0x8303, 0x7AC5, 
-0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AE5, 0x7AE5, 0x7AC5, 0x7AC6, 
-0x7AE4, 0x7AE5, 0x7AC6, 0x7AE4, 0x7AE5, 0x7AA6, 0x7AE4, 0x7AC5, 0xB36C, 0x9346, 0xAB89, 0xA368, 0xABE3, 0xE502, 0xD4A2, 0xFD82, 
-0xF582, 0xF582, 0xF582, 0xFD81, 0xF582, 0xF562, 0xFDA1, 0xF544, 0xE4A8, 0xF563, 0xECC7, 0xE4A9, 0xF582, 0xED05, 0xED06, 0xFDC0, 
-0xECE6, 0xED05, 0xFDC0, 0xED06, 0xECE7, 0xED05, 0xECE6, 0xECE6, 0xF525, 0xED06, 0xECE6, 0xF505, 0xED06, 0xECE6, 0xED05, 0xF525, 
-0xECE6, 0xED25, 0xECE6, 0xE489, 0xF525, 0xECE6, 0xE489, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 0xE4A8, 
-0xE4C7, 0xE4A8, 0xE4A8, 0xE4C7, 0xE4A8, 0xE4A8, 0xECE7, 0xDC2C, 0xDC6A, 0xF563, 0xD40D, 0xDC6A, 0xF563, 0xD3ED, 0xE489, 0xF543, 
-0xD40D, 0xDC6A, 0xECC7, 0xD40C, 0xD40C, 0xDC2C, 0xDC2B, 0xD42C, 0xD42C, 0xDC4B, 0xD42C, 0xD42C, 0xDC4B, 0xD42C, 0xD42C, 0xDC4B, 
-0xD42C, 0xD42C, 0xD42C, 0xE489, 0xDC6A, 0xD40D, 0xE4A8, 0xDC4B, 0xD40D, 0xE4A8, 0xDC4B, 0xD42C, 0xDC2C, 0xB38B, 0xC3CC, 0x9B67, 
-0xBC23, 0xB403, 0x7B03, 0xFD82, 0xFDE2, 0xFDC1, 0xFDE1, 0xF526, 0xFD83, 0xFDE1, 0xFD45, 0xFD45, 0xF4E8, 0xECE8, 0xECC9, 0xECC9, 
-0xFD83, 0xFDE1, 0xFDC2, 0xFDC2, 0xFDC2, 0xFDC2, 0xFDC2, 0xFDC1, 0xFDC1, 0xFDC2, 0xFDE0, 0xFD83, 0xF526, 0xFDE0, 0xFD83, 0xFD46, 
-0xFE00, 0xFD83, 0xFD45, 0xFD64, 0xFD45, 0xFD64, 0xFD26, 0xECC9, 0xFD65, 0xF526, 0xECC8, 0xECE8, 0xECE8, 0xF4E8, 0xECC8, 0xF4E8, 
-0xF4E8, 0xECC8, 0xDCC9, 0x9B45, 0x92E8, 0xA366, 0xAB86, 0x7AA8, 0x5A26, 0x5A25, 0x5A25, 0x5A06, 0x5A06, 0x5A27, 0x72A6, 0x9B65, 
-0xBC45, 0xDC88, 0xF526, 0xFD45, 0xF4E8, 0xECE8, 0xECC8, 0xF4E7, 0xECE8, 0xECE8, 0xF4E8, 0xECE8, 0xF4E8, 0xF4E8, 0xECE8, 0xF4E8, 
-0xF507, 0xF4E8, 0xF4E8, 0xF507, 0xECE8, 0xF4E8, 0xF4E8, 0xFD65, 0xFD46, 0xECC9, 0xFD65, 0xF526, 0xECC8, 0xFD64, 0xF526, 0xF508, 
-0xDC4C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8303, 0xFD82, 0xFDC2, 0xFD83, 0xFD64, 0xF506, 0xF525, 0xFD82, 0xF506, 0xE48A, 
-0xE48A, 0xE48A, 0xECC8, 0xFD83, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFD64, 0xFD63, 0xFDA1, 0xFD64, 0xFD44, 
-0xFD64, 0xFD63, 0xF525, 0xF506, 0xFD83, 0xF525, 0xF506, 0xF545, 0xF525, 0xF506, 0xF544, 0xFD64, 0xE48A, 0xF506, 0xFD63, 0xE489, 
-0xF505, 0xF543, 0xDC88, 0xB3A8, 0x9B48, 0xA3A7, 0x8B48, 0x6AA7, 0x6A86, 0x6A65, 0x6A65, 0x8349, 0xAC8E, 0xB4CF, 0xAC8E, 0xAC6E, 
-0xB4AF, 0xB4AF, 0x8B8A, 0x62A6, 0x6AC6, 0x8B64, 0xC426, 0xDC6A, 0xFD63, 0xF526, 0xE4A9, 0xFD63, 0xF506, 0xE4A9, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE46B, 0xECC8, 0xECC8, 0xE46B, 0xECC8, 0xECC8, 0xE48A, 0xE48A, 0xECE7, 0xFD83, 0xE46B, 0xECE7, 
-0xFD83, 0xE48A, 0xF506, 0xFD83, 0xD40D, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8303, 0xFD82, 0xFDC1, 0xF544, 0xF506, 0xF544, 
-0xF545, 0xECC8, 0xECC8, 0xECE7, 0xDC2D, 0xDC4B, 0xFDA2, 0xFDC1, 0xFD82, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA1, 0xF506, 
-0xF545, 0xFDE0, 0xF506, 0xFD44, 0xFDE0, 0xF506, 0xF506, 0xF544, 0xF525, 0xF526, 0xF544, 0xF525, 0xE4A9, 0xF544, 0xF525, 0xECC8, 
-0xECC8, 0xECC8, 0xE4A7, 0xBBE8, 0x9B48, 0x9327, 0x8B07, 0x5A27, 0x4145, 0x4164, 0x836B, 0xC572, 0xCD71, 0xC52F, 0xBD0E, 0xD5B0, 
-0xF6B4, 0xF6B5, 0xF694, 0xFE94, 0xFE94, 0xFE94, 0xE5D1, 0xD5B0, 0xC550, 0x838A, 0x6A86, 0x8B07, 0xBC07, 0xE4A8, 0xECC8, 0xECE7, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC2D, 0xE4A9, 0xE4A9, 0xD40D, 0xECC8, 0xE4A9, 0xD40E, 0xF525, 
-0xF526, 0xE4A9, 0xF545, 0xF506, 0xECC8, 0xECC8, 0xECC8, 0xF4E8, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8303, 0xF582, 
-0xFDC1, 0xFDC1, 0xFDC0, 0xF525, 0xF526, 0xECE7, 0xECC8, 0xE4A9, 0xECC8, 0xFD82, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 
-0xFDA1, 0xFDA1, 0xFD82, 0xFDC0, 0xFD83, 0xECE7, 0xFDC0, 0xFD83, 0xF506, 0xFDE0, 0xFD83, 0xF525, 0xF544, 0xF525, 0xF544, 0xF525, 
-0xE4A9, 0xF525, 0xF506, 0xECC8, 0xDC88, 0xBBE8, 0x9348, 0x7B09, 0x832B, 0x5A07, 0x4123, 0x6A68, 0x830A, 0x9BCC, 0xCD31, 0xE5D2, 
-0xE5F2, 0xEDF2, 0xF652, 0xF653, 0xF632, 0xF612, 0xF611, 0xF611, 0xF5F1, 0xF631, 0xFE93, 0xFF35, 0xFF36, 0xEE54, 0xB4CF, 0x836A, 
-0x6A87, 0x7AC6, 0xC428, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xDC87, 0xD467, 0xECC8, 0xED07, 0xECC8, 0xECC8, 0xF526, 
-0xDC4C, 0xE46B, 0xF506, 0xF525, 0xF506, 0xECA9, 0xF525, 0xF506, 0xECC8, 0xECC8, 0xECC8, 0xF4E7, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xB423, 0x8303, 0xFD82, 0xFD64, 0xF544, 0xFD83, 0xF526, 0xE46B, 0xFD64, 0xF525, 0xE489, 0xFD83, 0xFDC1, 0xFD82, 0xFDA2, 
-0xFDA2, 0xFDA2, 0xFDA2, 0xFDA1, 0xFD44, 0xFD64, 0xFDC1, 0xFD44, 0xF544, 0xFD63, 0xFD64, 0xF525, 0xF506, 0xFD63, 0xF525, 0xF526, 
-0xF525, 0xF525, 0xF525, 0xF545, 0xFD64, 0xE4A9, 0xECE7, 0xDCC4, 0x9389, 0x7B4A, 0x7B4B, 0x9C0E, 0xAC70, 0x8B4B, 0x8309, 0xA3EC, 
-0xC50F, 0xE5F2, 0xE5B0, 0xDD4F, 0xDD6F, 0xE590, 0xEDD1, 0xF5F2, 0xF5F1, 0xFE11, 0xEDAF, 0xDD4D, 0xDD2D, 0xDD6E, 0xEDD0, 0xF632, 
-0xFE94, 0xFEB5, 0xF695, 0xE613, 0xB4CE, 0x7B69, 0x8348, 0xC449, 0xECC8, 0xECC8, 0xE46B, 0xDC89, 0xB3C7, 0x72C7, 0x6A85, 0xA387, 
-0xDC4B, 0xE489, 0xECC8, 0xFD82, 0xE46B, 0xE4A9, 0xFD82, 0xE48A, 0xECE7, 0xFD83, 0xE48A, 0xED06, 0xFD63, 0xE489, 0xF525, 0xFD83, 
-0xD40D, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8303, 0xFD81, 0xFD45, 0xF525, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xFD83, 
-0xFDC1, 0xFD82, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDC1, 0xF526, 0xF525, 0xFDE0, 0xF506, 0xF545, 0xFDE0, 0xF526, 0xF506, 
-0xF544, 0xF525, 0xF526, 0xF544, 0xF525, 0xE48A, 0xF544, 0xF525, 0xE4A9, 0xD468, 0x9B47, 0x6A66, 0x6AC9, 0x8BCD, 0xAC91, 0xAC50, 
-0xA3EE, 0xB4B0, 0xDDB2, 0xE5F2, 0xEE11, 0xEE31, 0xEDF0, 0xEDEF, 0xF5F0, 0xF611, 0xF5F2, 0xFDF2, 0xFDF2, 0xFDF1, 0xEDB0, 0xDD6F, 
-0xD52E, 0xCD0D, 0xCD2E, 0xCD0E, 0xDD70, 0xEDF2, 0xF653, 0xFE94, 0xF6B4, 0xE633, 0xA42B, 0x8327, 0xCC28, 0xECC8, 0xBBAB, 0x8B07, 
-0x72A6, 0x9C0A, 0x9C0B, 0x7B28, 0x934A, 0xECE6, 0xF525, 0xE48A, 0xF544, 0xF525, 0xE48A, 0xF545, 0xF526, 0xECA9, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8303, 0xFD82, 0xFD65, 0xF545, 0xECE7, 0xECE8, 
-0xE4A9, 0xECA9, 0xFD83, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFD82, 0xFDA1, 0xFDA1, 0xFD82, 0xFDC0, 0xFDA2, 0xECE7, 0xFDC1, 
-0xFDA2, 0xED07, 0xFDE0, 0xFD82, 0xF525, 0xF544, 0xF525, 0xF544, 0xF525, 0xECC8, 0xF526, 0xED06, 0xB408, 0x7B08, 0x72E9, 0x6AC8, 
-0x5A46, 0x6247, 0x6247, 0x6226, 0x72A8, 0x9BEC, 0xD591, 0xF694, 0xF673, 0xF631, 0xEE10, 0xF610, 0xF610, 0xF631, 0xF631, 0xF611, 
-0xF5F1, 0xF5F1, 0xF612, 0xEE32, 0xE611, 0xDDD1, 0xCD4F, 0xBC8D, 0xC48D, 0xCCCE, 0xD52F, 0xEE12, 0xFE93, 0xFEB4, 0xEE53, 0xB48E, 
-0x8B07, 0x9B46, 0x82E7, 0x8BAB, 0xC52F, 0xF673, 0xFE94, 0xCD50, 0x7B28, 0x9B86, 0xED06, 0xECC8, 0xF525, 0xF506, 0xECC8, 0xF525, 
-0xF506, 0xECC7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF507, 0xDC2B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8303, 0xFDA1, 
-0xFD65, 0xF506, 0xFD63, 0xF525, 0xE489, 0xFD83, 0xFDC1, 0xFD82, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA1, 0xFD44, 0xFD44, 0xFDC1, 
-0xF544, 0xF544, 0xFD82, 0xFD44, 0xF525, 0xF526, 0xFD64, 0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xFD64, 0xE4A9, 0xABE7, 
-0x836A, 0xACD0, 0xBD31, 0x7B2A, 0x49C4, 0x51C4, 0x5A05, 0x6A86, 0x8328, 0x8B68, 0x9389, 0x9389, 0xAC2B, 0xDDB0, 0xF673, 0xFE93, 
-0xFE72, 0xF631, 0xEE0F, 0xEE0F, 0xF5F0, 0xF632, 0xFEB4, 0xFED4, 0xEE93, 0xE652, 0xE5F2, 0xD550, 0xC48E, 0xB40C, 0xA3AA, 0xB42C, 
-0xD570, 0xEE33, 0xEE35, 0xDDF4, 0x7B08, 0x4141, 0x9C0C, 0xF696, 0xFED6, 0xFE74, 0xFE73, 0xFE73, 0xC52F, 0x7B29, 0xA3A9, 0xFD63, 
-0xE489, 0xECC8, 0xFD83, 0xE4A9, 0xECE7, 0xFD63, 0xE4A9, 0xF506, 0xFD63, 0xE489, 0xF525, 0xFD83, 0xD40D, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xB423, 0x8323, 0xF524, 0xECC9, 0xECC8, 0xECA9, 0xECC8, 0xFD83, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 
-0xFDC1, 0xF525, 0xF525, 0xFDC1, 0xF525, 0xF525, 0xFDE0, 0xF525, 0xF506, 0xF544, 0xF525, 0xF506, 0xF544, 0xF525, 0xE48A, 0xF545, 
-0xF525, 0xE489, 0xABC7, 0x838A, 0xC594, 0xDE56, 0x8BAC, 0x6226, 0x9BEC, 0xD5D3, 0xDE33, 0xDE52, 0xE692, 0xE652, 0xAC8C, 0x8326, 
-0x7AE6, 0xA3CA, 0xD550, 0xE5D2, 0xE5D1, 0xEE52, 0xFEB2, 0xF672, 0xEE31, 0xF652, 0xFED4, 0xFF14, 0xF692, 0xEE31, 0xEE32, 0xEDF3, 
-0xDD51, 0xC4AF, 0xAC0D, 0x8309, 0x8B4A, 0x940E, 0x7B8D, 0x732A, 0x6B08, 0x9C4C, 0xE634, 0xEE14, 0xDD51, 0xDD51, 0xEDD2, 0xEE12, 
-0xFE94, 0xD591, 0x8328, 0xAB68, 0xF525, 0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC9, 0xECC8, 0xECC8, 0xECC9, 0xECC8, 0xECC8, 0xECC9, 
-0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8322, 0xF563, 0xF4E7, 0xE4A9, 0xECA9, 0xFD83, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 
-0xFDA2, 0xFD82, 0xFDA1, 0xFDA1, 0xFD82, 0xFDC0, 0xFDA1, 0xECE7, 0xFDC1, 0xFDA1, 0xECE7, 0xFDC0, 0xFDA2, 0xF525, 0xF544, 0xF525, 
-0xF544, 0xF525, 0xECC8, 0xF506, 0xED06, 0xABE7, 0x7B69, 0xACF0, 0xC573, 0x7AE9, 0x4963, 0x9BCC, 0xEE76, 0xFEF6, 0xFF15, 0xFF54, 
-0xFF54, 0xFF34, 0xF6D3, 0xF6B4, 0xD5B1, 0x9389, 0x7286, 0x7A86, 0x8B08, 0xBCAD, 0xD590, 0xE5F1, 0xF693, 0xF6B3, 0xF6B3, 0xF692, 
-0xF651, 0xEE10, 0xF632, 0xF633, 0xDD93, 0xC4F2, 0x9BEF, 0x6269, 0x39A6, 0x4A49, 0x6BB0, 0x4AAA, 0x5AA8, 0xCDB2, 0xD591, 0xABEB, 
-0x9349, 0x9349, 0xBC6D, 0xE5D2, 0xF654, 0xFE94, 0xD52F, 0x7AE7, 0xABE7, 0xED06, 0xECE7, 0xECC8, 0xECC8, 0xED07, 0xECC8, 0xECC8, 
-0xED07, 0xECC8, 0xECE7, 0xF507, 0xDC2B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE5, 0xF543, 0xFD45, 0xE489, 0xFD83, 0xFDC1, 
-0xFD82, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA1, 0xF544, 0xF545, 0xFDC1, 0xFD44, 0xF525, 0xF525, 0xF545, 0xF525, 0xF525, 0xF544, 
-0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xFD64, 0xE4A8, 0xABE8, 0x8BCA, 0xACCE, 0x9C2C, 0x6205, 0x38E1, 0x6206, 0xB46E, 
-0xCD30, 0xC50E, 0xD58F, 0xDE30, 0xDE30, 0xE651, 0xF6B2, 0xFEF4, 0xFEF5, 0xD570, 0x9BAA, 0x9BAA, 0x9B8A, 0x82C7, 0x7265, 0x9369, 
-0xBCEE, 0xC54E, 0xDDF0, 0xF672, 0xF672, 0xF652, 0xF653, 0xE614, 0xB4B0, 0x6AEB, 0x4A29, 0x31E8, 0x29E9, 0x63D0, 0x9DD8, 0x6BCF, 
-0x4227, 0x93EC, 0xC4EF, 0xCCEF, 0xB42D, 0x8AC8, 0x7A87, 0xAC0B, 0xDD91, 0xFE33, 0xFE94, 0xCD30, 0x8369, 0xB409, 0xF563, 0xECA9, 
-0xED06, 0xFD63, 0xE4A9, 0xF506, 0xFD63, 0xE489, 0xF525, 0xFD84, 0xD40D, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7B04, 0xE489, 
-0xECC9, 0xFD83, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA1, 0xF525, 0xF525, 0xFDC1, 0xF545, 0xF506, 0xF545, 
-0xF525, 0xF506, 0xF544, 0xF526, 0xF506, 0xF544, 0xF525, 0xE46A, 0xF525, 0xF545, 0xE48A, 0xABA8, 0x8BCB, 0xACCE, 0xA44D, 0x8B69, 
-0x8B29, 0x936A, 0xA3ED, 0xA3CC, 0x9B89, 0x9BA9, 0xAC2B, 0xC4EF, 0xCD50, 0xD590, 0xE5F1, 0xE5F0, 0xEE31, 0xF673, 0xF653, 0xEE33, 
-0xE5F3, 0xC4EF, 0xA40B, 0x8B68, 0x7285, 0x7285, 0x9388, 0xC4ED, 0xEE32, 0xF674, 0xDDF3, 0xACD0, 0x5AEA, 0x3208, 0x536E, 0x6C93, 
-0x5C53, 0x7D35, 0x6C30, 0x29E6, 0x41E6, 0x836B, 0xBCAF, 0xEDD3, 0xF5F4, 0xDD51, 0xA3AB, 0x7A65, 0xA3AA, 0xE591, 0xFE74, 0xFED5, 
-0xC50F, 0x72A7, 0xABA7, 0xECC8, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xB423, 0x8342, 0xF582, 0xFD83, 0xFDC1, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFD82, 0xFDA1, 0xFDC1, 0xFD82, 0xFDC1, 0xFDC1, 
-0xECE7, 0xFDC1, 0xFDC1, 0xF506, 0xFDC1, 0xFDA1, 0xF525, 0xF545, 0xF525, 0xF544, 0xF545, 0xECE7, 0xF506, 0xED06, 0xABC7, 0x8B8B, 
-0xA46E, 0x9C2D, 0x93CB, 0xBCAE, 0xCD31, 0xCD10, 0xCD10, 0xCD10, 0xCD0F, 0xB44C, 0x9B6A, 0x9B6C, 0xAC0E, 0xC4D0, 0xCD30, 0xDD70, 
-0xDDB0, 0xE5D0, 0xDDB0, 0xCD2E, 0xDD90, 0xEE53, 0xF694, 0xDDD1, 0xBCAE, 0xAC2D, 0x8B08, 0x82C7, 0x9B69, 0x9BCB, 0x8BEC, 0x5AC9, 
-0x42AA, 0x7D35, 0xA6DC, 0x969B, 0x6D77, 0x43CF, 0x2A05, 0x4226, 0x838C, 0xA40E, 0xABCC, 0xAB8A, 0xC46D, 0xF613, 0xF614, 0xABEB, 
-0x7A46, 0xA3AA, 0xDDB2, 0xFEB5, 0xF654, 0x93AA, 0x8306, 0xDC88, 0xECC8, 0xF506, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 
-0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE5, 0xED25, 0xFDC1, 0xFD82, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA2, 0xFDA1, 0xF544, 
-0xF525, 0xFDC0, 0xF544, 0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xF545, 0xF525, 0xF525, 0xF525, 0xC425, 0x9B65, 0xA384, 0xE4E4, 
-0xECC8, 0xABA8, 0x8B8B, 0xA44E, 0x93EC, 0x93AB, 0xBCAE, 0xC510, 0xC4CF, 0xBCAE, 0xD530, 0xEDF3, 0xF654, 0xEDF2, 0xD530, 0x9B8C, 
-0x82A9, 0x9B4C, 0xB44F, 0xC4F0, 0xC4EE, 0xC4AD, 0xBCAC, 0xB46B, 0xB46B, 0xC4ED, 0xDDB0, 0xF673, 0xFED6, 0xFE75, 0xDD92, 0xB44D, 
-0x8B08, 0x59E4, 0x3963, 0x4268, 0x8554, 0xA73C, 0x8E9A, 0x6576, 0x5472, 0x2A48, 0x4A66, 0xACCF, 0xD5B2, 0xDDB2, 0xCD10, 0xA3AA, 
-0x9B48, 0xC48D, 0xEE14, 0xF635, 0xA3EC, 0x7287, 0xB46E, 0xF634, 0xFE94, 0xC54F, 0x6AC6, 0xA367, 0xED07, 0xFD63, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AE5, 0xED06, 0xFDC2, 0xFDA2, 0xFDA2, 0xFDA2, 
-0xFDA2, 0xFDA2, 0xFDA1, 0xF544, 0xF525, 0xFDA1, 0xF545, 0xF525, 0xF525, 0xF525, 0xF525, 0xF545, 0xF526, 0xF506, 0xF545, 0xE4C5, 
-0x6A46, 0x5A46, 0x72E8, 0x7AC7, 0x82A5, 0x6A67, 0x832B, 0x93AC, 0x9BEC, 0xAC2C, 0xA3EB, 0xAC2C, 0xBCAE, 0xBC8E, 0xD530, 0xEDF3, 
-0xF632, 0xF631, 0xF653, 0xDD91, 0x9B8B, 0x6A07, 0x7A8A, 0xAC2F, 0xBCAF, 0xBC8D, 0xBCAD, 0xBCAD, 0xBC6C, 0xB46C, 0xBCAD, 0xDD90, 
-0xF633, 0xFE74, 0xEE13, 0xCD2F, 0xCD30, 0xBCAF, 0x7B4A, 0x6BAC, 0x7D52, 0x6DB4, 0x4CB1, 0x3C10, 0x330C, 0x29A6, 0x8BAB, 0xEE54, 
-0xF694, 0xF673, 0xF653, 0xEDD2, 0xCCEF, 0xB44D, 0xCD30, 0xFE75, 0xDDB3, 0x8B49, 0x938A, 0xDD91, 0xFE74, 0xEE52, 0x8BC9, 0x7AC6, 
-0xDC68, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8323, 0xFDC0, 
-0xFDA2, 0xFDA2, 0xFDA2, 0xFD82, 0xFDA1, 0xFDC1, 0xFD82, 0xFDC1, 0xFDC1, 0xECE7, 0xFDA2, 0xFDC1, 0xF506, 0xFDC1, 0xFDC1, 0xF525, 
-0xF545, 0xF545, 0xFD44, 0xB3E6, 0x72E8, 0xACAF, 0xC571, 0x9C0C, 0x5A05, 0x51A4, 0x72A8, 0x938B, 0xAC6E, 0xA40C, 0x9369, 0x936A, 
-0xA3EC, 0xC4AF, 0xCCEF, 0xDD91, 0xF632, 0xEE10, 0xEE11, 0xF654, 0xDD92, 0x9B6B, 0x61C5, 0x82A9, 0xB46E, 0xC4CE, 0xD52F, 0xDD90, 
-0xDD70, 0xC4CD, 0xB46C, 0xC4CD, 0xDD8F, 0xF632, 0xE5F2, 0xBC8D, 0xBCAE, 0xE614, 0xF6D6, 0xBD92, 0x5BAB, 0x3B4B, 0x338D, 0x22EB, 
-0x0986, 0x1103, 0x8BAC, 0xEE34, 0xF654, 0xF632, 0xF632, 0xFE33, 0xEE12, 0xD530, 0xCCAE, 0xE591, 0xF634, 0xB44E, 0x82E8, 0xBC8E, 
-0xEE13, 0xF6B4, 0xBD4F, 0x62A6, 0xABA7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xF4E8, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xBC22, 0x7AE5, 0xED06, 0xFDC2, 0xFDA2, 0xFDA2, 0xFDA1, 0xFD44, 0xF526, 0xFDC0, 0xFD44, 0xF526, 0xF525, 0xF526, 0xF525, 
-0xF525, 0xF525, 0xF525, 0xF525, 0xF526, 0xF525, 0xE4E5, 0x8307, 0x8BAA, 0xC570, 0xE654, 0xEE95, 0xC531, 0xA40D, 0xAC4E, 0x9BCC, 
-0x8B29, 0xA40D, 0xCD11, 0xB44E, 0x9B8B, 0xAC0D, 0xBC8E, 0xD530, 0xEDF1, 0xEE31, 0xEDF0, 0xEE12, 0xF654, 0xE5B3, 0x934A, 0x6A05, 
-0x9B6A, 0xCD0F, 0xEDD2, 0xF632, 0xEE11, 0xDD90, 0xC4CD, 0xBC6C, 0xC4AC, 0xD54F, 0xEE12, 0xE5F2, 0xB48D, 0xB44C, 0xE633, 0xF6F6, 
-0xAD30, 0x4AC8, 0x21E6, 0x11A6, 0x00E3, 0x0082, 0x5248, 0xAC6F, 0xDD51, 0xF5F2, 0xFE32, 0xF612, 0xF612, 0xEDD1, 0xDD2E, 0xDD0F, 
-0xFE13, 0xDD51, 0x8B09, 0x936A, 0xDD91, 0xF694, 0xE653, 0x93EB, 0x7AE6, 0xDC88, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE8, 
-0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE5, 0xED05, 0xFDC2, 0xFDA2, 0xFDA2, 0xFDA1, 0xFD44, 0xF525, 0xFDA2, 0xF544, 
-0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xF506, 0xF506, 0xF545, 0xF525, 0xE46B, 0xABC6, 0x6AA6, 0xB4ED, 0xDDF1, 0xEE53, 0xFEB5, 
-0xEE54, 0xCD31, 0xB46F, 0x9BAB, 0x9BAB, 0xD572, 0xFE97, 0xE5F5, 0xCCD1, 0xA3AC, 0xA3AC, 0xC4CE, 0xDD90, 0xEE11, 0xEDF0, 0xEDF1, 
-0xF632, 0xFE74, 0xDDB2, 0x9B69, 0x82A6, 0xC4AE, 0xF633, 0xF632, 0xF611, 0xF611, 0xE5B0, 0xC4CC, 0xBC6B, 0xCD0D, 0xE5D1, 0xF694, 
-0xE5D1, 0xB46B, 0xBC6B, 0xEE12, 0xFED6, 0xB4F0, 0x4206, 0x1103, 0x08E3, 0x0041, 0x0882, 0x41A6, 0x936B, 0xD510, 0xFE13, 0xFE33, 
-0xEE11, 0xF631, 0xF5F0, 0xED6F, 0xF5D1, 0xEE13, 0xAC2D, 0x82C7, 0xB46D, 0xEE33, 0xF6B4, 0xC52F, 0x6AA7, 0xABA7, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECE8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8323, 0xFDC0, 0xFDA2, 0xFDA2, 0xFDA1, 0xFD82, 
-0xFDC1, 0xFDE0, 0xED07, 0xFD82, 0xFDE0, 0xF506, 0xFDA2, 0xFDC1, 0xF525, 0xF545, 0xF545, 0xFD44, 0xF545, 0xDC86, 0x7AC5, 0x8BA9, 
-0xDDF0, 0xEE52, 0xEE31, 0xEE12, 0xD530, 0x9B6A, 0x934A, 0xCCF1, 0xEE15, 0xFEB7, 0xFED9, 0xFE98, 0xF636, 0xCCF1, 0xA38B, 0xABCB, 
-0xD52F, 0xEDF1, 0xEE11, 0xEE11, 0xEE11, 0xF631, 0xF673, 0xDD90, 0xA3CA, 0xB42B, 0xEDF2, 0xF652, 0xF610, 0xEE10, 0xEDF0, 0xDD8F, 
-0xCD2E, 0xDD8F, 0xEE11, 0xEE11, 0xEE52, 0xE5D1, 0xAC0A, 0xBC2B, 0xF633, 0xFEB6, 0xBD10, 0x5267, 0x1103, 0x00A3, 0x0082, 0x18C3, 
-0x49A5, 0x934A, 0xD530, 0xEE33, 0xF632, 0xF611, 0xF610, 0xEDEF, 0xEDF0, 0xF674, 0xDDD2, 0x8B49, 0x9349, 0xD570, 0xFEB4, 0xEE33, 
-0x93AB, 0x7286, 0xDC68, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xF507, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AE5, 0xECE6, 
-0xFDC1, 0xFD64, 0xF506, 0xFDC0, 0xFD64, 0xF506, 0xF545, 0xF525, 0xF525, 0xF545, 0xF525, 0xF525, 0xF545, 0xF525, 0xF525, 0xF545, 
-0xF525, 0xA3A5, 0x72C6, 0xC56F, 0xEE51, 0xEE10, 0xEE31, 0xE5B1, 0xABEC, 0x7A46, 0xABED, 0xFE97, 0xFF19, 0xFED8, 0xFEB7, 0xFEB8, 
-0xFE97, 0xF616, 0xD511, 0xA3AB, 0xB40B, 0xE591, 0xF632, 0xEE10, 0xEE0F, 0xEE0F, 0xF651, 0xF672, 0xD570, 0xC4AD, 0xDD90, 0xEE11, 
-0xEE10, 0xEDEF, 0xEE10, 0xEE11, 0xE5B0, 0xE5D0, 0xEE10, 0xEE0F, 0xEE31, 0xF653, 0xCCCE, 0xA389, 0xCCAD, 0xFE74, 0xFED5, 0x940C, 
-0x3184, 0x21A6, 0x2A29, 0x2A08, 0x2903, 0x4184, 0x8B4A, 0xC530, 0xEE13, 0xEE32, 0xEE10, 0xEE30, 0xEE50, 0xFEF4, 0xFED5, 0xB46D, 
-0x8B08, 0xCCEE, 0xFE73, 0xFE74, 0xAC2C, 0x6A66, 0xD448, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xE46C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xBC22, 0x7AE5, 0xED05, 0xFDC1, 0xFD63, 0xF545, 0xFD83, 0xF544, 0xF545, 0xF525, 0xF506, 0xF526, 0xF525, 0xF506, 0xF506, 
-0xF525, 0xF525, 0xE46B, 0xECE7, 0xDCC4, 0x72A6, 0x9C2B, 0xE651, 0xEE51, 0xEE10, 0xF632, 0xDD91, 0x9B4A, 0x7226, 0xC490, 0xFEF9, 
-0xFEF9, 0xFEB7, 0xFE97, 0xFEB7, 0xFEB7, 0xFE96, 0xFE56, 0xCCF0, 0xA38B, 0xBC6E, 0xEDD2, 0xF631, 0xEE0F, 0xEE4F, 0xFEB1, 0xFEB2, 
-0xEE31, 0xDDB0, 0xDDB0, 0xEDF0, 0xF630, 0xF670, 0xFE92, 0xF672, 0xE5F0, 0xEDF0, 0xF651, 0xFE71, 0xF631, 0xEE12, 0xDDB2, 0xAC0C, 
-0xA3A9, 0xD54E, 0xF674, 0xCD71, 0x62C8, 0x4ACA, 0x5BAF, 0x3269, 0x08A2, 0x18A1, 0x41A5, 0x836B, 0xCD51, 0xEE13, 0xF672, 0xF6D2, 
-0xF6F2, 0xFF34, 0xFEF5, 0xD591, 0xB44D, 0xCCEE, 0xEDF1, 0xFE53, 0xD550, 0x8B4A, 0xA387, 0xECC8, 0xECC8, 0xECC8, 0xE48A, 0xE46B, 
-0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8323, 0xFDC0, 0xFDA2, 0xFDA1, 0xFDE0, 0xED06, 0xFD83, 0xFDE0, 0xF525, 0xF525, 
-0xF545, 0xFD44, 0xF525, 0xF545, 0xFD44, 0xF545, 0xF526, 0xF506, 0xABC7, 0x7307, 0xCDB0, 0xF6D3, 0xEE51, 0xEE11, 0xE5D2, 0xD510, 
-0x9B4B, 0x9B6C, 0xE5B5, 0xFED9, 0xFED8, 0xFEB7, 0xFEB6, 0xFED6, 0xFED6, 0xFED7, 0xFE96, 0xF635, 0xCCD0, 0xA38C, 0xD510, 0xF652, 
-0xEE50, 0xFED1, 0xFF12, 0xFEF2, 0xF692, 0xEE52, 0xEE11, 0xEE10, 0xEE30, 0xFED2, 0xFF13, 0xFED3, 0xEE51, 0xEE30, 0xFEB2, 0xFEF4, 
-0xFE73, 0xD550, 0xB48E, 0xAC6D, 0x9BA9, 0xAC0A, 0xE5D1, 0xF695, 0x9C4D, 0x6B4B, 0x5B8C, 0x21A5, 0x10E3, 0x18E3, 0x20C3, 0x5A08, 
-0xAC2F, 0xDD72, 0xF673, 0xFF54, 0xFF53, 0xFF33, 0xFED4, 0xEE13, 0xCD10, 0xC4AD, 0xE570, 0xFE53, 0xFE74, 0x93CB, 0x7265, 0xE4A8, 
-0xECE7, 0xECA8, 0xECE7, 0xF526, 0xDC2B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AC5, 0xECE6, 0xFDE0, 0xFD64, 0xF506, 0xF545, 
-0xF526, 0xF525, 0xF545, 0xF525, 0xF525, 0xF544, 0xF525, 0xF525, 0xF545, 0xF525, 0xF544, 0xDCA7, 0x7AC6, 0x9C6B, 0xF714, 0xFF13, 
-0xF651, 0xEE32, 0xE5D2, 0xB44E, 0x8AEA, 0xB42F, 0xFE78, 0xFED9, 0xFEB8, 0xFEB7, 0xFEB6, 0xFEB6, 0xFEB6, 0xFEF7, 0xFE96, 0xFE97, 
-0xEDD4, 0xABCD, 0xAC0C, 0xE5D1, 0xFEB2, 0xFF13, 0xFF33, 0xFF13, 0xFEF3, 0xF692, 0xEE51, 0xEE10, 0xEE30, 0xFED2, 0xFF13, 0xFEF3, 
-0xFED2, 0xF670, 0xFE51, 0xFE93, 0xFE94, 0xD570, 0x9BCA, 0x9BEB, 0xA40B, 0xA3CB, 0xCD10, 0xF674, 0xD5D1, 0x6AE8, 0x2123, 0x3A07, 
-0x4A89, 0x29A6, 0x18C3, 0x3105, 0x8B0C, 0xCCD1, 0xEDF3, 0xF6D3, 0xF713, 0xFED3, 0xFE93, 0xEE12, 0xBCAD, 0xABEA, 0xDD2F, 0xFE53, 
-0xF653, 0xA42B, 0x7AE7, 0xCC09, 0xDC2C, 0xECE7, 0xE48A, 0xE44C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE5, 0xF525, 
-0xFD83, 0xF544, 0xFD44, 0xF525, 0xF506, 0xF526, 0xF525, 0xF506, 0xF526, 0xF525, 0xF525, 0xE46A, 0xECE7, 0xFD64, 0xE48A, 0xBBE7, 
-0x6284, 0xBD6E, 0xFFB6, 0xFF13, 0xF671, 0xF633, 0xEDD3, 0xA3AC, 0x69E6, 0xABCE, 0xFE78, 0xFED9, 0xFEB7, 0xFEB7, 0xFEB6, 0xFEB6, 
-0xFEB6, 0xFEB6, 0xFEB7, 0xFED7, 0xFE77, 0xCCB1, 0x9B6A, 0xC4CD, 0xF693, 0xFEF4, 0xFF13, 0xFF33, 0xFF33, 0xFED2, 0xEE31, 0xE5F0, 
-0xEE11, 0xFE92, 0xFEF3, 0xFF13, 0xFF12, 0xF691, 0xEDF0, 0xEDD1, 0xFE53, 0xEE33, 0xB48D, 0x9BEB, 0xAC6E, 0xA3CC, 0xB44E, 0xE5D3, 
-0xF6B4, 0x8B89, 0x3942, 0x83AC, 0x736C, 0x3A08, 0x2986, 0x1883, 0x6229, 0xC471, 0xDD71, 0xE611, 0xEE91, 0xF671, 0xFE32, 0xF632, 
-0xCD2E, 0x9B69, 0xBC6D, 0xF612, 0xFE73, 0xDDD1, 0x8389, 0x8B06, 0xDC6B, 0xECE8, 0xE4A9, 0xE48B, 0xD42C, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xB423, 0x8323, 0xFDC0, 0xF526, 0xFD63, 0xFDE0, 0xF545, 0xF525, 0xF545, 0xF544, 0xF525, 0xF544, 0xFD44, 0xF545, 0xF525, 
-0xF506, 0xECC8, 0xF525, 0x9345, 0x7B68, 0xE671, 0xFF94, 0xFEF2, 0xF651, 0xEDF2, 0xDD72, 0xA38C, 0x7A88, 0xBC90, 0xFE97, 0xFEB8, 
-0xFE97, 0xFEB7, 0xFED7, 0xFEB6, 0xFED6, 0xFEB6, 0xFEB7, 0xFED8, 0xFED8, 0xEDF5, 0xABCC, 0xABEB, 0xE5F2, 0xFED4, 0xFF14, 0xFF33, 
-0xFF12, 0xFF13, 0xF692, 0xEE11, 0xEE11, 0xEE31, 0xFEB2, 0xFF13, 0xFEF2, 0xF670, 0xEDF0, 0xEDF0, 0xEE12, 0xF653, 0xDD90, 0xAC2C, 
-0xA3AC, 0x9B6C, 0xABED, 0xD571, 0xFEB4, 0xD5B0, 0x93AA, 0xA44E, 0x7B6B, 0x3A48, 0x3A49, 0x08A3, 0x3925, 0xA3CE, 0xD530, 0xDDD0, 
-0xE630, 0xEE11, 0xF5D1, 0xF652, 0xE5F1, 0xABCA, 0xABCB, 0xEDD2, 0xFED4, 0xF6B3, 0x93EA, 0x72A5, 0xECE6, 0xECC8, 0xECE8, 0xF507, 
-0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AC5, 0xECE6, 0xFD64, 0xF525, 0xF525, 0xF544, 0xF525, 0xF545, 0xF544, 0xF525, 
-0xF525, 0xF545, 0xF525, 0xF545, 0xF506, 0xE48A, 0xE4E4, 0x72C5, 0xACCC, 0xFF95, 0xFF53, 0xF6B1, 0xEE31, 0xEDD2, 0xCCF0, 0x9B6B, 
-0xABED, 0xE5D4, 0xFE97, 0xFE97, 0xFE97, 0xFEF8, 0xFF18, 0xFEF8, 0xFEF8, 0xFF18, 0xFEF7, 0xFEB7, 0xFEB7, 0xFE97, 0xD511, 0xA3CB, 
-0xD550, 0xFE94, 0xFED3, 0xFEF3, 0xFF12, 0xFF33, 0xFED2, 0xEE11, 0xEDF1, 0xEE11, 0xEE31, 0xF691, 0xF691, 0xEE30, 0xE610, 0xEE31, 
-0xE5F0, 0xF632, 0xEDF2, 0xB40C, 0xA36B, 0xABAD, 0xA3AC, 0xC4CF, 0xF673, 0xF693, 0xB48D, 0xA42D, 0x940D, 0x4A88, 0x3269, 0x1986, 
-0x1081, 0x7288, 0xCCF0, 0xE5D1, 0xE631, 0xEE11, 0xF5F2, 0xF652, 0xEE11, 0xABEB, 0xABAB, 0xE5B2, 0xF693, 0xFEF4, 0xC54F, 0x7307, 
-0xAB8A, 0xECE7, 0xE46A, 0xE44C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC23, 0x7AE4, 0xF544, 0xFD45, 0xF506, 0xF525, 0xF525, 
-0xF506, 0xF525, 0xF525, 0xF525, 0xE48A, 0xECC8, 0xFD64, 0xE48A, 0xE4A9, 0xECC8, 0xCC28, 0x6264, 0xACEC, 0xFF95, 0xFF53, 0xF690, 
-0xF631, 0xEDF2, 0xBC4E, 0x8288, 0xABCD, 0xEE15, 0xFE76, 0xFE97, 0xFEF8, 0xFEB7, 0xE614, 0xE5D4, 0xE614, 0xEE14, 0xF656, 0xFE97, 
-0xFE97, 0xFEB7, 0xF615, 0xB42D, 0xBC4D, 0xEE13, 0xFEB3, 0xFF13, 0xFF12, 0xFF33, 0xFED2, 0xCD0D, 0xCD0E, 0xF632, 0xEE31, 0xEE10, 
-0xEE30, 0xEE30, 0xEE30, 0xEE30, 0xEE30, 0xF652, 0xF613, 0xC44D, 0xABAC, 0xBC0E, 0xA38C, 0xB44D, 0xE5F2, 0xF693, 0xCD2F, 0xAC2C, 
-0xA46F, 0x5B0A, 0x2A68, 0x2A49, 0x0061, 0x4164, 0xB46E, 0xDDB1, 0xE631, 0xEE32, 0xF612, 0xF632, 0xE5F1, 0xA3CA, 0xA3CB, 0xE5B2, 
-0xEE51, 0xFF34, 0xEEB4, 0x6AE7, 0xAC0B, 0xECC8, 0xE4A9, 0xE48B, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8323, 0xFDC0, 
-0xFD45, 0xF525, 0xF544, 0xF544, 0xF525, 0xF544, 0xF544, 0xF525, 0xF525, 0xF506, 0xECC8, 0xF545, 0xF506, 0xECA9, 0xBBE7, 0x6AC5, 
-0xBD6E, 0xFF74, 0xFF33, 0xFE91, 0xF631, 0xEDD2, 0xB40D, 0x69E6, 0x9B4C, 0xEDD5, 0xFE98, 0xFEF8, 0xFEB6, 0xCD30, 0xA3CB, 0xA3EC, 
-0xB42D, 0x9BAB, 0xAC4E, 0xF676, 0xFED8, 0xFE97, 0xFE97, 0xD4F0, 0xABCC, 0xD551, 0xF693, 0xFEF2, 0xFF11, 0xFF53, 0xFEF3, 0xBCAC, 
-0xB44B, 0xEE12, 0xF672, 0xEE11, 0xEE10, 0xF651, 0xEE30, 0xEE10, 0xF652, 0xF673, 0xF613, 0xC48E, 0xA38C, 0xABCE, 0x9B4B, 0xAC0D, 
-0xDD91, 0xF694, 0xE5D1, 0xAC0C, 0xA42E, 0x632A, 0x3268, 0x2A8A, 0x00A3, 0x2082, 0x8B8B, 0xCD50, 0xDDF1, 0xEE32, 0xF612, 0xF632, 
-0xE5D1, 0xA3CB, 0xA3EB, 0xDDF1, 0xE651, 0xFF34, 0xEED4, 0x7327, 0xAC09, 0xECC8, 0xECE8, 0xF507, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xBC42, 0x7AC5, 0xECE6, 0xFD64, 0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xF545, 0xF525, 0xF545, 0xF506, 0xE489, 0xF545, 
-0xF506, 0xE4A9, 0x9326, 0x8BC9, 0xEED3, 0xFF75, 0xFF33, 0xFEB2, 0xEE11, 0xDD71, 0xABED, 0x69E7, 0x9B2C, 0xF5B6, 0xFED9, 0xFEB7, 
-0xCD30, 0xAC4C, 0xC4CE, 0xDD51, 0xCCCF, 0x9329, 0x9BAC, 0xEE76, 0xFF39, 0xFEB7, 0xFEB7, 0xF5F4, 0xB3ED, 0xB44E, 0xEE32, 0xFED2, 
-0xFF31, 0xFF32, 0xFF35, 0xDDD1, 0xA3EA, 0xC4ED, 0xF653, 0xF632, 0xEE10, 0xF650, 0xE5F0, 0xDD8F, 0xE5B0, 0xE5D1, 0xDD71, 0xBC6E, 
-0xA3AC, 0x9B6C, 0x7248, 0x934A, 0xCD10, 0xEE32, 0xD56F, 0xA3CB, 0xAC4E, 0x632A, 0x3268, 0x32AB, 0x08E5, 0x1882, 0x7B09, 0xBCEF, 
-0xDDB1, 0xEE32, 0xF611, 0xF632, 0xEDD2, 0xA3CB, 0xA3CA, 0xDDF0, 0xEE91, 0xFF54, 0xEEB3, 0x7B28, 0x9329, 0xECE7, 0xE46B, 0xE44D, 
-0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x7B04, 0xF543, 0xFD45, 0xF525, 0xE4A9, 0xE4A9, 0xF544, 0xE48A, 0xECC8, 0xFD64, 
-0xE48A, 0xE4A9, 0xECC8, 0xE4A9, 0xECC8, 0xDC88, 0x7264, 0x9C4B, 0xFF35, 0xFF54, 0xFF33, 0xFED3, 0xEE11, 0xCD0F, 0xA38C, 0x82AA, 
-0xB40F, 0xFDF6, 0xFE36, 0xD4F0, 0xBC6D, 0xDD91, 0xFE75, 0xF614, 0xCCCF, 0xBC6E, 0xE5F4, 0xFED7, 0xFEF7, 0xFEB6, 0xFED6, 0xFE97, 
-0xCCD0, 0xABCC, 0xD550, 0xF6B2, 0xFF32, 0xFF33, 0xFF34, 0xF693, 0xB46B, 0x9BC9, 0xD56F, 0xF633, 0xEE11, 0xF651, 0xE5F1, 0xCD0E, 
-0xBCAD, 0xC4CD, 0xC4CF, 0xB44E, 0xA3CD, 0x9B6C, 0x61A5, 0x7A88, 0xC4EF, 0xE612, 0xD56F, 0xAC2C, 0xA40D, 0x5AC9, 0x3248, 0x32AB, 
-0x1125, 0x20A3, 0x7B29, 0xBCEF, 0xD5B0, 0xEE12, 0xF611, 0xF633, 0xDD91, 0x9B8A, 0xA3CA, 0xDDD0, 0xF6B2, 0xFF95, 0xEE93, 0x7307, 
-0x9348, 0xECC8, 0xE4A9, 0xECAA, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xB423, 0x8323, 0xFDA0, 0xFD65, 0xF526, 0xF545, 0xF545, 
-0xF525, 0xF544, 0xF525, 0xE4A9, 0xF545, 0xF506, 0xE4A9, 0xECC8, 0xECC8, 0xDC67, 0x7264, 0xA44B, 0xF6B3, 0xFED2, 0xFE92, 0xF692, 
-0xEE12, 0xCD10, 0xA3AC, 0xABCE, 0xE595, 0xF5D6, 0xCC6F, 0xAB8B, 0xCCAF, 0xE572, 0xC48F, 0xB40D, 0xC48F, 0xF615, 0xFF19, 0xFED8, 
-0xF6B6, 0xF6D6, 0xFED7, 0xFED7, 0xEDF5, 0xABED, 0xB42C, 0xF672, 0xFF33, 0xFF33, 0xFEB3, 0xF673, 0xD56F, 0x9B88, 0xABEB, 0xDD91, 
-0xEE32, 0xF673, 0xE5F1, 0xC4CE, 0xB46C, 0xBC8D, 0xC4CE, 0xB42D, 0xA3CD, 0x9B8D, 0x5964, 0x7226, 0xC4D0, 0xE5D2, 0xEE32, 0xCD0F, 
-0x938B, 0x5247, 0x3A48, 0x3ACC, 0x1925, 0x20A2, 0x7B09, 0xC4EE, 0xD5B0, 0xEE11, 0xF632, 0xF653, 0xC4CE, 0x9B89, 0xB44C, 0xDDB0, 
-0xF6B2, 0xFFB6, 0xEEB4, 0x7307, 0xA387, 0xECA8, 0xECC8, 0xF507, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AE5, 0xECE6, 
-0xFD45, 0xF545, 0xF525, 0xF525, 0xF545, 0xF525, 0xF506, 0xE4A9, 0xF525, 0xF506, 0xECA9, 0xECC8, 0xECC8, 0xAB85, 0x7AC7, 0xCD6F, 
-0xF631, 0xEE10, 0xEE30, 0xEE31, 0xE5F2, 0xCD10, 0xA38B, 0xABCE, 0xFE17, 0xED95, 0x9B2B, 0x92EA, 0xB3CD, 0xA38C, 0x934B, 0x934B, 
-0xCCF1, 0xFE98, 0xFED9, 0xFEB8, 0xFEB7, 0xFED7, 0xFEB6, 0xFEF7, 0xFE77, 0xB44E, 0xAC0C, 0xEE12, 0xFEB3, 0xFE92, 0xF651, 0xF672, 
-0xDDB0, 0x9BA9, 0x9BAA, 0xC4EF, 0xE5D2, 0xEDF2, 0xDD70, 0xC4AE, 0xBC8D, 0xC4AE, 0xC4CF, 0xB42D, 0xA3AD, 0x9B8D, 0x69E6, 0x6A06, 
-0xA3CC, 0xDDB1, 0xFE94, 0xD550, 0x9B8B, 0x5A68, 0x4A89, 0x4B0C, 0x2987, 0x3944, 0x8349, 0xBCCE, 0xDDB0, 0xEE11, 0xF632, 0xF633, 
-0xB44C, 0x9369, 0xC4EE, 0xE611, 0xFEB2, 0xFF96, 0xEE94, 0x72E7, 0x9B6A, 0xF506, 0xE48A, 0xDC4D, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xBC42, 0x7AE4, 0xE48A, 0xECC9, 0xF544, 0xE4A9, 0xECA9, 0xFD63, 0xE4A9, 0xE4A9, 0xECC8, 0xE4A9, 0xECA9, 0xECC8, 0xECC8, 
-0xECC8, 0x8AE5, 0x8B69, 0xE5F2, 0xEE10, 0xF610, 0xF631, 0xEE11, 0xD591, 0xC4D0, 0x9B4B, 0x8AC9, 0xE553, 0xF5D6, 0xA38D, 0x9B2C, 
-0x8ACA, 0x6165, 0x7228, 0x8B0B, 0x936C, 0xBC70, 0xDD13, 0xEDB5, 0xFE97, 0xFED8, 0xFEB6, 0xFED7, 0xFED8, 0xDD72, 0xB42D, 0xD50F, 
-0xF632, 0xF611, 0xEE10, 0xF672, 0xDD8F, 0xA3EA, 0xA3CB, 0xBCAF, 0xCD0F, 0xCD2F, 0xCCEF, 0xC4AE, 0xBC8E, 0xC4AE, 0xC4EF, 0xB44D, 
-0xA3CC, 0x9B8C, 0x82A9, 0x6A06, 0x82E8, 0xDDB2, 0xFEB4, 0xCCEF, 0x934A, 0x6267, 0x39C6, 0x29A7, 0x2946, 0x5207, 0x9BCB, 0xCD2F, 
-0xEE12, 0xF632, 0xFE52, 0xE5D1, 0xA3EB, 0x9B89, 0xD570, 0xFE93, 0xFEF3, 0xFF96, 0xE653, 0x6A86, 0xABEA, 0xE46B, 0xE48A, 0xECA9, 
-0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE5, 0xED05, 0xFD64, 0xF526, 0xF544, 0xF525, 0xE48A, 0xF545, 0xF525, 0xE4A9, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0x9326, 0x8308, 0xDD70, 0xF5F0, 0xF610, 0xF631, 0xEDF1, 0xCD30, 0xC4CF, 0x934B, 0x5963, 
-0xABAD, 0xFE37, 0xED75, 0xB3AE, 0x71E7, 0x61A6, 0x938D, 0xCD54, 0xBCD2, 0x934C, 0x9B0A, 0xBBED, 0xD4D0, 0xF5D4, 0xFEB7, 0xFEF7, 
-0xFF18, 0xF655, 0xABEC, 0xB40C, 0xEDF2, 0xF611, 0xF610, 0xF651, 0xEDF1, 0xB46C, 0x9369, 0xAC2E, 0xC4CE, 0xC4AE, 0xBC8E, 0xB44D, 
-0xBC6E, 0xBCAE, 0xC4EF, 0xB44D, 0xA3CC, 0xA3AC, 0x7A88, 0x69E5, 0x8B29, 0xE5B2, 0xFE94, 0xCCEF, 0x82C8, 0x6267, 0x41C6, 0x0021, 
-0x1042, 0x6AA9, 0xBC8E, 0xE5B1, 0xF632, 0xF632, 0xFE52, 0xCCEE, 0x9B89, 0xB46C, 0xE5F2, 0xFED4, 0xFF14, 0xFF97, 0xE634, 0x6266, 
-0xAC09, 0xDC2C, 0xE48A, 0xF507, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE4, 0xED06, 0xFD46, 0xF544, 0xF525, 0xF506, 
-0xE4A9, 0xF526, 0xF506, 0xECA9, 0xECC8, 0xECC8, 0xECE7, 0xDC2D, 0xE46B, 0x9B44, 0x8308, 0xD550, 0xEDD0, 0xF5F0, 0xF631, 0xEDF1, 
-0xCD30, 0xC4F0, 0x9B6B, 0x5102, 0x9B0B, 0xFE57, 0xE513, 0x8228, 0x92CA, 0xDD95, 0xFEFA, 0xFFBD, 0xFF5B, 0xD594, 0xCCD1, 0xCC6F, 
-0xB3AC, 0xC44E, 0xF614, 0xFEF7, 0xFF38, 0xF676, 0xB44D, 0xA3AA, 0xE570, 0xFE32, 0xF611, 0xF631, 0xF631, 0xBC8D, 0x8B29, 0xAC4E, 
-0xC4CF, 0xC4AE, 0xB42D, 0x9B8B, 0xB42D, 0xBCAF, 0xBC8E, 0xAC2D, 0xA3EC, 0x9B6B, 0x8AE9, 0x7246, 0x8B08, 0xDDB2, 0xFE74, 0xCCCF, 
-0x8AC8, 0x936C, 0xACD2, 0x62AB, 0x1841, 0x6A68, 0xCD10, 0xEDD1, 0xEDF1, 0xF632, 0xFE52, 0xB46C, 0x9B89, 0xCD2F, 0xF632, 0xFEB3, 
-0xFF14, 0xFEF5, 0xBD10, 0x72C8, 0xA32A, 0xF525, 0xE48A, 0xDC4D, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AE4, 0xE489, 
-0xECC9, 0xFD64, 0xECA9, 0xE4A9, 0xECC8, 0xE4A9, 0xECA9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xE46A, 0x82A7, 0x834A, 0xDD91, 
-0xEDD1, 0xF5F1, 0xF611, 0xEE11, 0xD550, 0xC4EF, 0x936B, 0x40E1, 0x7A28, 0xDCF2, 0xA2EB, 0x71C7, 0xD534, 0xEE79, 0xB4F3, 0x9C91, 
-0x9C90, 0x940E, 0x9BCD, 0xBC90, 0xCCF1, 0xC4B0, 0xDDB4, 0xFEF8, 0xFEF7, 0xFEB6, 0xD551, 0xA3AA, 0xCCCF, 0xFE53, 0xF611, 0xF631, 
-0xEE11, 0xB48D, 0x934A, 0xAC4E, 0xC4EF, 0xC4EF, 0xB42D, 0x932A, 0xAC0D, 0xC4F0, 0xBC6E, 0xA3CB, 0x934A, 0x82C9, 0x9BAC, 0x82E8, 
-0x8AE8, 0xE5D2, 0xFE95, 0xCCCF, 0xA36B, 0xB44F, 0xDDF7, 0xBD14, 0x4966, 0x61E6, 0xCD10, 0xF612, 0xF5F1, 0xFE32, 0xEDD1, 0xAC2B, 
-0xAC0B, 0xDDB1, 0xEE31, 0xEE10, 0xFED3, 0xEE74, 0x8BAB, 0x7AA7, 0xDC88, 0xDC6B, 0xE48A, 0xECC9, 0xD42C, 0x7AE4, 0xA368, 0xA368, 
-0xB423, 0xBC42, 0x7AC5, 0xED25, 0xFD65, 0xE48A, 0xF545, 0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC9, 0xECC8, 0xECC8, 0xECC8, 
-0xE48A, 0xA3AB, 0x72C8, 0xD592, 0xEDF2, 0xF5F1, 0xF611, 0xEDF1, 0xD52F, 0xCD10, 0x9BAB, 0x3081, 0x3882, 0x826A, 0x8AAA, 0x8AEC, 
-0x8B4D, 0x4186, 0x1082, 0x1082, 0x0861, 0x0840, 0x1040, 0x49A5, 0x72CA, 0x7AEA, 0xBCD2, 0xFED8, 0xFF18, 0xFF17, 0xEDF3, 0xA3AB, 
-0xBC4D, 0xF613, 0xF632, 0xF631, 0xE5D1, 0xAC2C, 0x82E9, 0x9B8C, 0xBCCF, 0xCD30, 0xB44E, 0x82C9, 0x9B6B, 0xCCF1, 0xBCAF, 0x936A, 
-0x6A25, 0x7A67, 0xAC0E, 0x8B09, 0x9B6A, 0xF634, 0xFE95, 0xC46E, 0xA36C, 0xE594, 0xE5D6, 0x8B6D, 0x59C6, 0x8B2A, 0xD570, 0xF632, 
-0xF612, 0xF612, 0xD52F, 0xB42B, 0xCD0E, 0xEE32, 0xEE11, 0xE5EF, 0xF672, 0xDDF2, 0x7B4A, 0x82A6, 0xECE7, 0xDC4C, 0xE48A, 0xF4E8, 
-0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC22, 0x7AE4, 0xECE6, 0xF526, 0xE4A9, 0xF506, 0xED06, 0xECA8, 0xECC8, 0xECC8, 0xECE7, 
-0xDC2D, 0xE46B, 0xF525, 0xDC2D, 0xE48A, 0xCC85, 0x6A67, 0xB48E, 0xE5B1, 0xEDF1, 0xF631, 0xEDF0, 0xD54F, 0xCD30, 0x9BAB, 0x38C2, 
-0x2821, 0x5166, 0x6209, 0x4167, 0x1022, 0x0822, 0x0022, 0x0001, 0x0021, 0x0000, 0x0821, 0x5A6A, 0x62AB, 0x2083, 0x51E8, 0xC513, 
-0xFEF8, 0xFF38, 0xEE14, 0xA38B, 0xABEC, 0xEDD3, 0xF633, 0xEE12, 0xD550, 0xAC2C, 0x7A88, 0x830A, 0xBCAF, 0xCD31, 0xB46F, 0x7A68, 
-0x82A9, 0xB44F, 0xAC0E, 0xAC0E, 0xA3ED, 0x9B8B, 0xAC0D, 0x82E8, 0x9BAA, 0xF675, 0xEDF3, 0x9B4A, 0x82A8, 0xDD53, 0xDDB5, 0x59E7, 
-0x59C6, 0xBCD0, 0xEDF2, 0xF611, 0xF612, 0xEDF2, 0xCD0E, 0xC4EE, 0xEDF1, 0xF652, 0xEE30, 0xF651, 0xEE52, 0xACAE, 0x7B07, 0xBBC8, 
-0xD40D, 0xF525, 0xE48A, 0xDC2D, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB423, 0xBC42, 0x7AE4, 0xE489, 0xECA9, 0xECC8, 0xE4A9, 0xECA9, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECA8, 0xE48A, 0xDC4C, 0xECC8, 0xE48A, 0xCC0B, 0x7A86, 0x93AB, 0xD591, 0xEDF1, 0xF611, 0xF610, 
-0xEDF0, 0xCD2F, 0x936B, 0x4944, 0x3904, 0x4146, 0x2063, 0x0000, 0x420A, 0x9494, 0x4A4B, 0x0823, 0x20C5, 0x1884, 0x20A4, 0x8BB1, 
-0xBD37, 0x72AE, 0x61EA, 0x9BAE, 0xE615, 0xFF58, 0xF675, 0xB40D, 0xA3AC, 0xD531, 0xE5D2, 0xDD90, 0xCCEF, 0xAC0D, 0x7A88, 0x82EA, 
-0xBCAF, 0xC4F0, 0xB44F, 0x8AEA, 0x8AEB, 0xABEF, 0x9B6C, 0xC4F1, 0xFED9, 0xDDB4, 0xA3CD, 0x7225, 0x9369, 0xEE34, 0xD551, 0xABCD, 
-0xB40E, 0xCCF2, 0xCD33, 0x6A27, 0x5184, 0xC4F0, 0xF673, 0xF611, 0xF5F2, 0xDD91, 0xBCCD, 0xD54F, 0xF632, 0xEE31, 0xEE10, 0xF671, 
-0xF6B3, 0x93EB, 0x6A26, 0xDC4A, 0xECC8, 0xDC4B, 0xE48A, 0xECE8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xBC42, 0xBC42, 0x7AC5, 0xF525, 
-0xFD65, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xECC9, 0xECC8, 0xECC8, 0xE48A, 0xDC4C, 0xECC8, 0xE48A, 0xCBED, 0x7B05, 0x8BAC, 
-0xDDB2, 0xEE32, 0xF611, 0xF630, 0xF631, 0xD570, 0x8B6A, 0x5186, 0x51C8, 0x30E5, 0x0000, 0x41E9, 0xBDD8, 0xEF5F, 0x8BD2, 0x2065, 
-0x4128, 0x5189, 0x3085, 0x4128, 0x82CF, 0x9331, 0xB434, 0xCD35, 0xE5F5, 0xFED7, 0xFED7, 0xD531, 0xA38B, 0xB42D, 0xCD0F, 0xC4CE, 
-0xCCF0, 0xAC2E, 0x7268, 0x82EA, 0xC4D0, 0xBC8F, 0xA3CD, 0x9BAE, 0x9B6D, 0x9B8D, 0xA3AE, 0xD554, 0xFF3B, 0xFED9, 0xB44F, 0x7266, 
-0xB44D, 0xE5D3, 0xABEC, 0x9B8B, 0xD532, 0xE5D5, 0xBC90, 0x6207, 0x6A47, 0xC4F0, 0xF653, 0xF652, 0xEDF1, 0xD52F, 0xBCCE, 0xD570, 
-0xF611, 0xEE10, 0xEE10, 0xF691, 0xDDF1, 0x8369, 0x82C7, 0xE46A, 0xECC8, 0xDC2C, 0xE46A, 0xF4E8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 
-0xB3E4, 0xB3E4, 0x8304, 0xECE6, 0xF507, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xDC2C, 0xDC4B, 0xF525, 0xDC2D, 0xE46B, 0xF545, 0xDC0D, 
-0xE48A, 0xF544, 0x9366, 0x838A, 0xB4AE, 0xCD0F, 0xEDF1, 0xFE52, 0xEDF0, 0xD54F, 0xA3EB, 0x6228, 0x4147, 0x1042, 0x20E4, 0xA515, 
-0xEF7F, 0xEF7F, 0xCE19, 0x5A0A, 0x4927, 0x7A8D, 0x48E7, 0x2804, 0x40A6, 0x61AA, 0xCD57, 0xFF1C, 0xEE36, 0xF655, 0xFED8, 0xE5B3, 
-0x9B8B, 0xABEC, 0xC4AF, 0xBC8E, 0xCD10, 0xB42F, 0x7A68, 0x82CA, 0xC4D1, 0xB46F, 0x9B8C, 0xABEF, 0x932B, 0x934C, 0xCD12, 0xF657, 
-0xFEF9, 0xFEB8, 0xBC6F, 0x938B, 0xD592, 0xC4CF, 0x7246, 0x7A88, 0xC4F1, 0xEE16, 0x82EA, 0x5165, 0x9BED, 0xD5B2, 0xEE12, 0xF612, 
-0xE571, 0xC4AE, 0xC4EE, 0xE5F1, 0xF611, 0xEDF0, 0xEE31, 0xF693, 0xACAD, 0x6A67, 0xCC65, 0xE4A9, 0xDC2D, 0xE48A, 0xDC2C, 0xE44C, 
-0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABA6, 0xABC6, 0x8303, 0xE4A8, 0xECC9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A9, 0xDC4C, 
-0xECC8, 0xE48A, 0xDC4C, 0xE489, 0xED06, 0xFD63, 0xB3C8, 0x7328, 0x7308, 0x8B49, 0xDD71, 0xFE93, 0xEDF0, 0xD54E, 0xC4EF, 0x832B, 
-0x2042, 0x0000, 0x20E4, 0x8411, 0xD6BB, 0xF7BF, 0xFFDF, 0xA4B3, 0x59A8, 0x7A8C, 0x69EA, 0x40C6, 0x4127, 0x834E, 0xE638, 0xFED9, 
-0xF5F6, 0xF636, 0xFED8, 0xE593, 0xA38B, 0xAC0C, 0xC4CF, 0xC4F0, 0xBCAF, 0xA3ED, 0x932B, 0x9B6C, 0xBC70, 0xA3ED, 0xA3ED, 0xCCF1, 
-0xB44F, 0xC4D1, 0xFEB8, 0xFF19, 0xFEB8, 0xEE15, 0xB46E, 0x936A, 0xB46E, 0xB48F, 0x8B6B, 0x938C, 0xEDF5, 0xEE16, 0x61E6, 0x4904, 
-0xB490, 0xEE33, 0xF612, 0xEDB1, 0xCC8F, 0xABAC, 0xC4AD, 0xEE10, 0xF610, 0xEE10, 0xF693, 0xD5D2, 0x7B29, 0x8B25, 0xDC4B, 0xE48A, 
-0xECC7, 0xDC2C, 0xE48A, 0xF4E8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xBC42, 0xBC61, 0x7AE5, 0xE4A8, 0xECE8, 0xECC8, 0xE4A9, 0xECA9, 
-0xECC8, 0xECC9, 0xE48A, 0xDC4C, 0xECA9, 0xE48A, 0xDC2D, 0xFD63, 0xF526, 0xE48A, 0xDCE3, 0x7306, 0x62A7, 0x72C8, 0xCD10, 0xFE74, 
-0xF631, 0xE5AF, 0xCD2F, 0x830A, 0x30C3, 0x2062, 0x0801, 0x1883, 0x7BAF, 0xEF3D, 0xFFFF, 0xFF9D, 0xB4F3, 0x8B2D, 0x7A6C, 0x59A8, 
-0x7AAC, 0xB4D4, 0xC513, 0xDD32, 0xF5F5, 0xFE57, 0xFEB8, 0xDD93, 0xA3AB, 0xAC0C, 0xC4D0, 0xBCD0, 0xAC2D, 0xAC0D, 0xB42F, 0xABCE, 
-0xABED, 0x9B8B, 0xBCB0, 0xF656, 0xFE97, 0xFEB8, 0xFEF8, 0xFEF8, 0xFEB7, 0xEE15, 0xD552, 0xB46E, 0xBCD0, 0xEE56, 0xC532, 0x8B4B, 
-0xD573, 0xE616, 0x6A28, 0x4103, 0xAC4E, 0xEE53, 0xF632, 0xDD30, 0xA38B, 0x9B4A, 0xCCEE, 0xEE10, 0xF610, 0xEE11, 0xEE53, 0xAC8D, 
-0x6245, 0xC3E7, 0xDC2C, 0xE46B, 0xECC8, 0xDC2C, 0xE46A, 0xECE8, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB3E5, 0xB3E5, 0x8323, 0xE4A8, 
-0xECC8, 0xECE7, 0xDC2C, 0xDC4C, 0xF525, 0xDC2D, 0xDC4B, 0xF544, 0xDC2D, 0xE48A, 0xFD64, 0xED06, 0xECE7, 0xECA8, 0xED06, 0x9B86, 
-0x6AE8, 0x72E9, 0xA40C, 0xEE13, 0xFE72, 0xEDF0, 0xCD2F, 0x934A, 0x59C7, 0x3925, 0x1841, 0x0000, 0x3905, 0xACB3, 0xE679, 0xFFBD, 
-0xFFFE, 0xCDB6, 0x8B8E, 0x832D, 0x8B4D, 0x8B4C, 0xA3EE, 0xE593, 0xF5F5, 0xF5F5, 0xFE98, 0xE573, 0x9B8B, 0xAC0D, 0xC510, 0xB46E, 
-0x9B8B, 0xC4F1, 0xCCF1, 0x8B0A, 0x934B, 0xC4D0, 0xEE15, 0xFEB8, 0xFEF8, 0xFED8, 0xFEB7, 0xFEB7, 0xFEB7, 0xF696, 0xF676, 0xF697, 
-0xFED8, 0xFF5A, 0xDDD4, 0x830A, 0x938C, 0xAC6F, 0x6A68, 0x59C5, 0xB46E, 0xEE33, 0xEE11, 0xC4AE, 0x9309, 0xA3AB, 0xE5B1, 0xF631, 
-0xF631, 0xF673, 0xD591, 0x8328, 0x8AE6, 0xD40D, 0xE48A, 0xDC2C, 0xDC2C, 0xE48A, 0xDC2C, 0xE44C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xABC6, 0xABC6, 0x8304, 0xE4C8, 0xF4E8, 0xECC8, 0xECC8, 0xE4A9, 0xDC2C, 0xECC8, 0xE4A9, 0xDC2C, 0xE4A9, 0xED07, 0xFD64, 0xE4A9, 
-0xECA8, 0xECC8, 0xE4A9, 0xD448, 0x8328, 0x6AC9, 0x7B09, 0xCD50, 0xFE93, 0xF632, 0xE5B0, 0xBC8E, 0x7AA8, 0x4165, 0x28A3, 0x1000, 
-0x4925, 0xA3F0, 0x9BCE, 0xAC6F, 0xD5F5, 0xBD53, 0x838C, 0x7B0B, 0x9BCD, 0xB470, 0xE5D5, 0xFE98, 0xFE16, 0xF5D5, 0xFE57, 0xE573, 
-0xA38C, 0xB42E, 0xC4F0, 0xA3EC, 0x9BAB, 0xDD93, 0xDD73, 0x934B, 0xB42E, 0xF676, 0xFEF8, 0xFEB7, 0xFEB7, 0xFE97, 0xFE97, 0xFE97, 
-0xFEB7, 0xFED8, 0xFEB7, 0xFEF8, 0xFF18, 0xFF19, 0xF6B8, 0xBD12, 0x9C0E, 0x7B0A, 0x59E6, 0x8B4A, 0xD571, 0xEE53, 0xDDD0, 0xB44C, 
-0x8B2A, 0xB44D, 0xEE12, 0xF632, 0xF611, 0xFEB4, 0xC50F, 0x6265, 0xBC2B, 0xECE7, 0xDC4C, 0xE48A, 0xECE7, 0xDC2C, 0xE48A, 0xF507, 
-0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xBC42, 0xBC61, 0x7AE5, 0xE489, 0xECA9, 0xECC8, 0xE4A9, 0xE48A, 0xDC0D, 0xFD44, 0xF526, 0xD3EE, 
-0xFD64, 0xF525, 0xE46B, 0xFD64, 0xF525, 0xE48A, 0xFD64, 0xF526, 0xBBE8, 0x72A7, 0x51E5, 0x93CB, 0xF674, 0xFE93, 0xEE11, 0xD52F, 
-0x82C8, 0x4985, 0x3945, 0x1800, 0x61A7, 0xDD75, 0xDD34, 0x932A, 0x6A46, 0x8349, 0xACB0, 0xBD11, 0xDDF5, 0xFEF8, 0xFEF9, 0xFE77, 
-0xF5D5, 0xF5F5, 0xFE77, 0xE574, 0xA38C, 0xA3CD, 0xAC2E, 0xA3EC, 0xCD31, 0xEE15, 0xE5F4, 0xE5B4, 0xF636, 0xFED8, 0xFED7, 0xFEB7, 
-0xFEB7, 0xFEB7, 0xFE96, 0xFE96, 0xFED7, 0xFEB7, 0xFEB7, 0xFED7, 0xFEB7, 0xFEB7, 0xFF1A, 0xFF3A, 0xEEB9, 0x834C, 0x4143, 0xA40D, 
-0xE613, 0xEE32, 0xCD4F, 0x9BCB, 0x938B, 0xC4CF, 0xEE12, 0xF632, 0xF612, 0xEE33, 0xA44C, 0x72A6, 0xCC4C, 0xECC8, 0xDC2C, 0xE46B, 
-0xECC8, 0xDC2C, 0xE46B, 0xECC9, 0xD42C, 0x7AE4, 0xA368, 0xA368, 0xB3E5, 0xABE5, 0x8342, 0xDC4B, 0xE44C, 0xF525, 0xDC2C, 0xDC4B, 
-0xFD63, 0xECE7, 0xF506, 0xF544, 0xECE7, 0xECE8, 0xECA8, 0xECE7, 0xECC8, 0xECA8, 0xECE7, 0xECC8, 0xECC8, 0xC407, 0x7265, 0x6A66, 
-0xCD71, 0xFEB4, 0xF653, 0xD54F, 0x7AC6, 0x49A4, 0x5207, 0x3082, 0x40A3, 0xBC31, 0xFE79, 0xED94, 0xBC8E, 0xCD51, 0xF6B7, 0xFF39, 
-0xFF18, 0xFF18, 0xFEB6, 0xFE15, 0xF5B4, 0xF5F5, 0xFE77, 0xEDB5, 0x9B4B, 0x82A8, 0xA3AC, 0xD572, 0xFED7, 0xFE96, 0xF676, 0xFED8, 
-0xFEF8, 0xFEB7, 0xFEB7, 0xFEB7, 0xFEB6, 0xFEB7, 0xFEB6, 0xFEB6, 0xFEB6, 0xFEB6, 0xFEB7, 0xFED7, 0xFEF8, 0xEE35, 0xCD12, 0xEE57, 
-0xDE37, 0x6228, 0x4123, 0xA3ED, 0xE5D2, 0xE5F2, 0xBCEE, 0x936A, 0x9BAC, 0xC4F0, 0xE5D1, 0xF632, 0xFE74, 0xD591, 0x7B08, 0x9307, 
-0xDC4C, 0xDC4C, 0xE48A, 0xDC4C, 0xDC4C, 0xE48A, 0xDC4C, 0xE46C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABC6, 0xABC6, 0x8303, 0xE4C8, 
-0xECC9, 0xDC2D, 0xE4A9, 0xECE7, 0xFD64, 0xECC8, 0xECE7, 0xFD64, 0xECC8, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECA9, 0xECC8, 
-0xECC8, 0xECC8, 0xDC88, 0x82C6, 0x93CB, 0xEE74, 0xFEB4, 0xE5B1, 0xA3CA, 0x51E4, 0x5207, 0x5186, 0x2800, 0x7208, 0xF5F7, 0xFE77, 
-0xFE76, 0xFEB7, 0xFEF8, 0xFED7, 0xFED7, 0xFEF7, 0xFEB6, 0xFE34, 0xF5F4, 0xEDB4, 0xD4F1, 0xD512, 0xD4F2, 0xB44E, 0xCD31, 0xFED8, 
-0xFF18, 0xFEB7, 0xFEB7, 0xFEB7, 0xFEB7, 0xFEB7, 0xFEB6, 0xFEB7, 0xFED7, 0xFEB6, 0xFEB6, 0xFEB6, 0xFE96, 0xFEB6, 0xFEB7, 0xFEB7, 
-0xFF59, 0xEE15, 0x8AE9, 0x7289, 0x6A89, 0x30C3, 0x5185, 0xA3CC, 0xD551, 0xE5D2, 0xBCAE, 0x8B4A, 0x9B8C, 0xC4CF, 0xE5B1, 0xF612, 
-0xFE94, 0xD570, 0x72A6, 0x92C7, 0xE46A, 0xED06, 0xDC4C, 0xE48A, 0xED07, 0xDC4B, 0xDC4C, 0xE46B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xBC42, 0xBC61, 0x7AC6, 0xF524, 0xFD65, 0xD3EE, 0xF545, 0xF544, 0xDC4C, 0xFD44, 0xF545, 0xE46B, 0xFD64, 0xF525, 0xE48A, 0xFD64, 
-0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xC407, 0x7B08, 0xB4CF, 0xF674, 0xFE94, 0xCD2F, 0x6A66, 0x51C6, 0x6248, 
-0x38C3, 0x69C7, 0xDD54, 0xFE56, 0xFE35, 0xFE96, 0xFEB7, 0xFE97, 0xFEB6, 0xFED7, 0xFEB6, 0xFE55, 0xFE35, 0xEDB4, 0xA34B, 0x8AC9, 
-0xDD53, 0xFED8, 0xFED8, 0xFEF8, 0xFEF8, 0xFED7, 0xFEB7, 0xFEB7, 0xFEB7, 0xFEB7, 0xFEB6, 0xFEB7, 0xFEB6, 0xFED6, 0xFED6, 0xFEB6, 
-0xFEB6, 0xFEB7, 0xFEB7, 0xFEB7, 0xFF19, 0xEDF5, 0x8AEA, 0x61E7, 0x6A28, 0x4125, 0x59A6, 0xA3CD, 0xD551, 0xE5B2, 0xC4D0, 0x932B, 
-0x7AA8, 0xB44E, 0xEDF2, 0xF632, 0xFE94, 0xD591, 0x72A7, 0x8AC8, 0xDC4B, 0xECA9, 0xDC2C, 0xDC6B, 0xE4A9, 0xDC4C, 0xDC2C, 0xE46C, 
-0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8303, 0xE4C7, 0xF507, 0xFD44, 0xECE7, 0xECE7, 0xF525, 0xECE7, 0xECC8, 0xECC8, 
-0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xAB6A, 0x8B29, 0xBCEF, 0xF694, 
-0xEE13, 0x9BCC, 0x5185, 0x59E7, 0x6A29, 0x5186, 0x9BAD, 0xF657, 0xFEB7, 0xFEB7, 0xFE97, 0xFE97, 0xFEB7, 0xFEB6, 0xFEB6, 0xFEB6, 
-0xFE76, 0xFE35, 0xCCB0, 0x8AC9, 0xB42E, 0xFEB8, 0xFF19, 0xFEB7, 0xFED7, 0xFED7, 0xFEB7, 0xFEB7, 0xFEB7, 0xFEB7, 0xFEB7, 0xFEB6, 
-0xFEB6, 0xFEF7, 0xFED6, 0xFEB6, 0xFED6, 0xFED7, 0xFED7, 0xFEF8, 0xFEB8, 0xAC0D, 0x7A68, 0xAC0F, 0xA3CE, 0x4925, 0x5165, 0xA3EE, 
-0xCCF0, 0xCD11, 0xBC90, 0x82A9, 0x69E5, 0xABEB, 0xEDD2, 0xF632, 0xFE74, 0xD571, 0x72C7, 0x8AC6, 0xDC4C, 0xDC4C, 0xE46A, 0xDC4C, 
-0xDC4B, 0xE46A, 0xDC4B, 0xE48B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABC5, 0xABC6, 0x8303, 0xE4A8, 0xF4E8, 0xFD44, 0xECC8, 0xECE7, 
-0xFD44, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECA8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 
-0xECE7, 0xABA7, 0x8308, 0xBCCE, 0xF6B5, 0xE5D3, 0x7268, 0x4924, 0x6A49, 0x4965, 0x6227, 0xD5B4, 0xFF18, 0xFEB7, 0xFE97, 0xFE97, 
-0xFE97, 0xFE96, 0xFEB6, 0xFED7, 0xFEB7, 0xFEB7, 0xFE97, 0xE5F4, 0xDDB3, 0xF676, 0xFEF8, 0xFED7, 0xFEB6, 0xFEB7, 0xFEB7, 0xFEB7, 
-0xFE97, 0xFEB7, 0xFEB7, 0xFED7, 0xFED6, 0xFED6, 0xFED6, 0xFED6, 0xFEB6, 0xFED7, 0xFEB7, 0xFF19, 0xF6B8, 0x82C9, 0x61A5, 0xBC70, 
-0xAC0F, 0x4904, 0x5165, 0xAC0E, 0xB46F, 0x9B6B, 0x930B, 0x8289, 0x8AE9, 0xB44C, 0xD550, 0xEDD1, 0xFE94, 0xD570, 0x6AA7, 0x9308, 
-0xE48A, 0xF506, 0xDC6B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xE48B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xBC42, 0xBC61, 0x7AC6, 0xF524, 
-0xFD64, 0xDC4C, 0xF544, 0xF544, 0xDC6B, 0xFD44, 0xF545, 0xE48A, 0xFD64, 0xF525, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xE46A, 0xE4A9, 0xECC8, 0xE46A, 0xECA8, 0xA386, 0x8328, 0xC510, 0xF696, 0xCD12, 0x7A89, 0x59C7, 0x51C7, 0x4964, 0x9BED, 
-0xFED8, 0xFEF8, 0xFEB7, 0xFE97, 0xFE96, 0xFEB6, 0xFEB6, 0xFEB6, 0xFED7, 0xFED7, 0xFEF8, 0xFF39, 0xFEF8, 0xFED7, 0xFEB7, 0xFED7, 
-0xFED7, 0xFED7, 0xFEB7, 0xFE97, 0xFEB8, 0xFEF8, 0xFED7, 0xFEB6, 0xFEB6, 0xFEB6, 0xFEB6, 0xFED7, 0xFED7, 0xFEB7, 0xFED8, 0xFEF9, 
-0xE5D5, 0x8B0A, 0x7247, 0xB42E, 0xB42F, 0x61E7, 0x5985, 0xA3ED, 0xAC4E, 0x7247, 0x69E7, 0xA38C, 0xD530, 0xC4EE, 0xC4ED, 0xEDD1, 
-0xFE73, 0xDDD1, 0x8B8A, 0x8B09, 0xD42B, 0xE4A9, 0xDC4C, 0xDC2C, 0xDC4B, 0xDC4C, 0xDC2C, 0xE46C, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 
-0xABC5, 0xABC5, 0x8303, 0xE4C8, 0xF508, 0xF544, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC7, 0xE4C8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xDC2D, 0xE48A, 0xECC7, 0xDC2D, 0xE4A9, 0xECC8, 0x9B09, 0x7AE8, 0xAC2C, 0xDDB3, 0xBCD1, 
-0x6A48, 0x5166, 0x4124, 0x6206, 0xD573, 0xFF19, 0xFEF8, 0xFEB7, 0xFEB6, 0xFED6, 0xFED6, 0xFED6, 0xFED6, 0xFED7, 0xFED7, 0xFEF8, 
-0xFF18, 0xFEF7, 0xFED6, 0xFED7, 0xFED7, 0xFEB7, 0xFE97, 0xFEB8, 0xFE97, 0xFE97, 0xFEB7, 0xFEB7, 0xFEB6, 0xFEB6, 0xFEB6, 0xFED6, 
-0xFED7, 0xFEB7, 0xFF19, 0xFEB8, 0xB46F, 0x934B, 0x936B, 0xB44E, 0xCCF1, 0x932B, 0x5164, 0x7AC9, 0xAC6F, 0x82EA, 0x7A48, 0xCCB0, 
-0xF633, 0xCD0E, 0xC4ED, 0xEDF1, 0xFE32, 0xF674, 0xB4CF, 0x5A67, 0xC40C, 0xDC4B, 0xE46B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xE48B, 
-0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8303, 0xE4C7, 0xF4E7, 0xF545, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 
-0xABC8, 0x82E8, 0xB3C7, 0xECC8, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xECE7, 0xECC8, 0xECC8, 0xF506, 0xDC6B, 0xDC4C, 0xED05, 
-0x7A86, 0x72A6, 0xB48E, 0xB48F, 0x8B0A, 0x7A69, 0x69E7, 0x40C2, 0x936C, 0xFED8, 0xFF19, 0xFEB7, 0xFED7, 0xFED6, 0xFED6, 0xFED6, 
-0xFED7, 0xFED7, 0xFED7, 0xEE55, 0xEE55, 0xFED8, 0xFEF8, 0xFED7, 0xFEB7, 0xFEB8, 0xFE77, 0xF5D5, 0xC46F, 0xABCC, 0xDD72, 0xFEF8, 
-0xFED7, 0xFEB6, 0xFED6, 0xFEB6, 0xFEB7, 0xFF19, 0xFEF9, 0xCCF2, 0xAC0E, 0xAC0E, 0x938B, 0xBC6E, 0xD552, 0x9B4B, 0x40E2, 0x59E6, 
-0xAC70, 0xA3EE, 0x9B6C, 0xDD51, 0xF612, 0xCD0D, 0xC4ED, 0xE5D0, 0xF611, 0xFEB4, 0xC530, 0x62A7, 0xB40C, 0xE46A, 0xE46B, 0xDC4C, 
-0xE46B, 0xE46B, 0xDC4C, 0xE48B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xBC42, 0xBC61, 0x7AC6, 0xF525, 0xFD64, 0xDC6B, 0xF544, 0xF544, 
-0xE48A, 0xFD44, 0xF545, 0xE489, 0x8286, 0x3903, 0x6A27, 0xBBE7, 0xECC8, 0xECC8, 0xE46B, 0xE4A9, 0xECC8, 0xE46B, 0xECA9, 0xECC8, 
-0xE46B, 0xE48A, 0xE48A, 0xE48A, 0x92E7, 0x7309, 0xBCEF, 0xC50F, 0xC4AE, 0xC48F, 0x9B6D, 0x5166, 0x61C7, 0xBCB1, 0xFED8, 0xFEF8, 
-0xFEB7, 0xFEB7, 0xFE96, 0xFEB7, 0xFEF7, 0xFF18, 0xEE76, 0xABED, 0xABCD, 0xF5D5, 0xFE57, 0xFE17, 0xFE17, 0xFDF6, 0xF554, 0xE4B2, 
-0xAB4C, 0x92A9, 0xCCD0, 0xFEF7, 0xFEF6, 0xFED6, 0xFED6, 0xFEB7, 0xFF19, 0xFF1B, 0xCD13, 0x8A89, 0xC44F, 0xD532, 0x8B29, 0xB48E, 
-0xD551, 0x9B4B, 0x5123, 0x59C6, 0xAC2F, 0xBCB0, 0xC4CE, 0xEDD1, 0xF652, 0xCD0E, 0xA3EB, 0xCD2F, 0xF652, 0xF652, 0xE5F2, 0x9BEC, 
-0x7A87, 0xCC0B, 0xDC4C, 0xDC2C, 0xDC4B, 0xDC4C, 0xDC2C, 0xE46C, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xABC6, 0xABC6, 0x8303, 0xE4A8, 
-0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xCC48, 0x82A8, 0x7AEB, 0x7AEA, 0x9B89, 0xE4A8, 0xECC8, 0xDC2C, 0xE48A, 
-0xECE7, 0xDC2D, 0xE48A, 0xECE7, 0xDC2D, 0xE4A9, 0xECE7, 0xD3EE, 0xD466, 0x7B27, 0xB4AE, 0xFEB5, 0xFE53, 0xE592, 0xC471, 0x82CB, 
-0x4904, 0x59C6, 0xC4D1, 0xFED8, 0xFEB8, 0xFE97, 0xFEB7, 0xFE97, 0xFEB7, 0xFF38, 0xEE56, 0xA3AC, 0xA30B, 0xDC71, 0xF514, 0xF514, 
-0xF4F4, 0xECB3, 0xEC93, 0xEC93, 0xDC72, 0xD4D2, 0xF616, 0xFEF7, 0xFED6, 0xFED6, 0xFED7, 0xFF19, 0xFF1B, 0xD534, 0x7207, 0x8248, 
-0xED94, 0xE5B3, 0x8B49, 0xBCAE, 0xE5F3, 0xB44E, 0x7227, 0x5165, 0x934C, 0xC4F0, 0xDD90, 0xF631, 0xFE72, 0xD52E, 0x9349, 0xBCAD, 
-0xF652, 0xF651, 0xFE93, 0xBCAE, 0x59E6, 0xBB89, 0xE46B, 0xDC4C, 0xE46B, 0xE46B, 0xDC4C, 0xE48B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xABC5, 0xB3E5, 0x8303, 0xECC7, 0xF4E8, 0xECC8, 0xECE7, 0xECE7, 0xECC8, 0xECC8, 0xECC8, 0x9B46, 0x72CA, 0xDDF6, 0xBD32, 0x7309, 
-0xBBE7, 0xECC8, 0xED07, 0xECC8, 0xECC8, 0xF526, 0xE46A, 0xDC2D, 0xF545, 0xDC6B, 0xDC2C, 0xF506, 0xED05, 0x7AC5, 0x9BEB, 0xFEB4, 
-0xFE73, 0xEDD3, 0xD512, 0x934D, 0x7248, 0x59C5, 0x61C4, 0xC4AF, 0xFED8, 0xFEB8, 0xFEB8, 0xFEB7, 0xFEB7, 0xFEF8, 0xFEB7, 0xEDD5, 
-0xDCD2, 0xE471, 0xF4B3, 0xFCF4, 0xF4B3, 0xEC93, 0xFCD4, 0xFCF4, 0xF555, 0xFE77, 0xFED8, 0xFED7, 0xFEB6, 0xFEB6, 0xFF18, 0xFF19, 
-0xCD12, 0x7207, 0x5924, 0xBC0F, 0xFE57, 0xB40D, 0x7286, 0xCD50, 0xF675, 0xCD10, 0x82C9, 0x40E2, 0x6A48, 0xB48F, 0xDD90, 0xEE11, 
-0xF652, 0xDD90, 0xA3AA, 0xAC0C, 0xE5D1, 0xFE52, 0xFE73, 0xB44D, 0x6206, 0xBBC9, 0xE46B, 0xDC4B, 0xE46A, 0xE46A, 0xDC4B, 0xE48B, 
-0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xBC42, 0xBC61, 0x7AC6, 0xF525, 0xFD64, 0xE48A, 0xF544, 0xF544, 0xE4A9, 0xECC8, 0xE4A8, 0x7A85, 
-0x8BAD, 0xFF9C, 0xDE37, 0x6288, 0x9B47, 0xECE7, 0xDC6B, 0xE4A9, 0xECE7, 0xE46B, 0xE48A, 0xE4A9, 0xE46B, 0xE46B, 0xE48A, 0xFD82, 
-0xECC8, 0x9B27, 0x8B68, 0xCD6F, 0xF653, 0xF613, 0xC4B0, 0x9B4B, 0xAC4E, 0xB44E, 0x61E4, 0x61C3, 0xBCB0, 0xFED9, 0xFF3A, 0xFEF8, 
-0xFED8, 0xFED7, 0xFED8, 0xFED8, 0xFE57, 0xFDB5, 0xFD54, 0xF534, 0xF514, 0xF534, 0xFD55, 0xFD96, 0xFE37, 0xFE98, 0xFE97, 0xFEB7, 
-0xFEB7, 0xFF39, 0xFF19, 0xCCF1, 0x61A5, 0x5923, 0xAB8D, 0xFE17, 0xF5D5, 0x69E6, 0x30A0, 0x9BEB, 0xF655, 0xE5D3, 0x9B6B, 0x5163, 
-0x61C5, 0xAC2E, 0xDD71, 0xEDF1, 0xF652, 0xEE32, 0xBC8D, 0x9B69, 0xCCEF, 0xFE33, 0xFE53, 0xCD0F, 0x8309, 0x9B29, 0xDC4C, 0xDC2C, 
-0xDC4C, 0xDC4B, 0xDC4B, 0xE46C, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xABC6, 0xABC6, 0x8323, 0xE4A8, 0xECC9, 0xECC8, 0xECC8, 0xECC8, 
-0xECC8, 0xECC8, 0xBBE7, 0x72A7, 0xC574, 0xFFBC, 0xC5B4, 0x6AC9, 0xAB88, 0xECE7, 0xDC2C, 0xE48A, 0xECE7, 0xDC2C, 0xE4A9, 0xECE7, 
-0xD3EE, 0xF506, 0xFD64, 0xE48A, 0xF525, 0xDCA4, 0x7265, 0xA42B, 0xFE93, 0xF633, 0xB40C, 0x9B8B, 0xD551, 0xE5F3, 0xC4CE, 0x61E3, 
-0x61C4, 0xBCD0, 0xF697, 0xFF39, 0xFF39, 0xFEF8, 0xFEF8, 0xFED8, 0xFEB7, 0xFE98, 0xFE36, 0xFDD5, 0xFDF5, 0xFE16, 0xFE16, 0xFE78, 
-0xFEB8, 0xFEB7, 0xFEB7, 0xFE97, 0xFF1A, 0xFF1A, 0xC4D1, 0x6184, 0x5103, 0xAB8D, 0xF5F6, 0xFEB9, 0xED94, 0x61A5, 0x0800, 0x59E4, 
-0xE5D2, 0xF654, 0xC4CF, 0x7A87, 0x4922, 0x8B29, 0xD571, 0xF653, 0xF632, 0xF652, 0xDDB0, 0xA3AA, 0xABCB, 0xE591, 0xFE53, 0xF654, 
-0xAC4D, 0x6A46, 0xCBEA, 0xDC4C, 0xE46B, 0xDC4C, 0xCBB0, 0xE46C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xB3E5, 0xB3E5, 0x8304, 0xECE7, 
-0xF507, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A8, 0x8B26, 0x8BAC, 0xF6FA, 0xF6D9, 0x93ED, 0x8B47, 0xE4A7, 0xECC8, 0xF526, 0xE48A, 
-0xDC0D, 0xF525, 0xE46A, 0xDC2D, 0xF525, 0xF526, 0xF506, 0xECE8, 0xF506, 0xE4C6, 0x7264, 0xA42A, 0xFE93, 0xEDF1, 0xC4AD, 0xC4CE, 
-0xE5F2, 0xF653, 0xEE13, 0xB46D, 0x6A25, 0x4963, 0x72A8, 0xC4F1, 0xEE76, 0xFF39, 0xFF38, 0xFEF7, 0xFEB7, 0xFEB7, 0xFEB7, 0xFE96, 
-0xFEB6, 0xFEB7, 0xFEB7, 0xFEB7, 0xFEB6, 0xFED7, 0xFEB7, 0xFEF9, 0xFF3B, 0xC4F2, 0x6165, 0x50E2, 0xABAD, 0xF5F6, 0xFE16, 0xFE57, 
-0xEDB4, 0x6A07, 0x0800, 0x59C4, 0xD571, 0xFE94, 0xEDF2, 0xAC0C, 0x4942, 0x6205, 0xCD31, 0xF654, 0xEE12, 0xEE31, 0xF672, 0xC4CE, 
-0xA38A, 0xD50E, 0xFE32, 0xFE94, 0xAC4C, 0x6224, 0xCC0A, 0xDC4B, 0xE48A, 0xDC6B, 0xD3EE, 0xE48B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 
-0xBC42, 0xBC61, 0x7AC6, 0xF525, 0xFD64, 0xE4A9, 0xECC8, 0xECC8, 0xECC8, 0xC427, 0x6AA7, 0xC553, 0xFFBD, 0xDE16, 0x6A88, 0x92E8, 
-0xE48A, 0xECE7, 0xDC4B, 0xE48A, 0xECA9, 0xE46B, 0xE46B, 0xE48A, 0xFD83, 0xECC8, 0xE48A, 0xFD83, 0xECC8, 0xBBE8, 0x8326, 0xCD6F, 
-0xFED4, 0xE58F, 0xDD6F, 0xEDF1, 0xEE31, 0xEE31, 0xE5D1, 0xDD91, 0xA40D, 0x38C2, 0x1000, 0x3902, 0x7B09, 0xBD11, 0xEE76, 0xFF59, 
-0xFF18, 0xFED7, 0xFED6, 0xFE95, 0xEE54, 0xF675, 0xFED6, 0xFED6, 0xFED6, 0xF6B6, 0xFF18, 0xFF1A, 0xC4F2, 0x5965, 0x50E3, 0xAB8D, 
-0xF5F6, 0xFE37, 0xF5D5, 0xFE57, 0xF5F6, 0x6A27, 0x1000, 0x59E5, 0xDD71, 0xFEB4, 0xFE74, 0xDD91, 0x7A86, 0x5183, 0xAC0D, 0xE5D3, 
-0xF633, 0xEE51, 0xF671, 0xDDD0, 0xC4AD, 0xCCCD, 0xE5D0, 0xF652, 0xB4AC, 0x72E6, 0xBBCA, 0xDC4B, 0xDC4B, 0xDC6B, 0xE46B, 0xE46C, 
-0xDC2C, 0x7AE4, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8304, 0xE4A8, 0xECC8, 0xECC8, 0xECC8, 0xECC8, 0xE4A8, 0x8AE5, 0x8B6B, 0xF6B9, 
-0xFF5B, 0xB4B1, 0x72A8, 0xAB6A, 0xE46A, 0xECE8, 0xDC4C, 0xE48A, 0xECE7, 0xD40E, 0xECE7, 0xFD63, 0xE46B, 0xF525, 0xF544, 0xE46B, 
-0xF525, 0x8B24, 0x9C0C, 0xFEB4, 0xF672, 0xD54E, 0xE5AF, 0xF631, 0xEE30, 0xEE10, 0xEDF1, 0xE5B3, 0xBCB0, 0x51A5, 0x1000, 0x1000, 
-0x1820, 0x3903, 0x832A, 0xCD32, 0xF676, 0xFF39, 0xFF38, 0xFEB6, 0xF634, 0xF634, 0xFEB5, 0xFED6, 0xFED6, 0xFF18, 0xFF39, 0xCD12, 
-0x5985, 0x48C3, 0xAB8E, 0xF5F7, 0xFE37, 0xF5D5, 0xF5F5, 0xFE57, 0xCCF2, 0x5164, 0x1000, 0x59C5, 0xDD91, 0xFE94, 0xFE53, 0xEE12, 
-0xA3EB, 0x5162, 0x7A87, 0xD531, 0xF633, 0xEE31, 0xEE30, 0xEE52, 0xDDB0, 0xC4CC, 0xD54E, 0xEE51, 0xE652, 0x944B, 0x82C7, 0xCB90, 
-0xDC4C, 0xDC4B, 0xCBB1, 0xE46C, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABC6, 0xABA6, 0x8323, 0xE4A8, 0xECC9, 0xECC8, 0xECE8, 0xECC8, 
-0xA346, 0x8329, 0xDDF5, 0xFF5B, 0xE5F6, 0x7ACA, 0x82E7, 0xED06, 0xE48A, 0xD40D, 0xF525, 0xE48A, 0xDC0D, 0xF525, 0xF526, 0xF506, 
-0xECE7, 0xF506, 0xF506, 0xECE7, 0xC446, 0x72E7, 0xCD71, 0xFED5, 0xE5AF, 0xD54E, 0xE5D0, 0xEE30, 0xEE0F, 0xEE10, 0xFE74, 0xE5F4, 
-0x9BCD, 0x51A6, 0x2882, 0x1841, 0x1000, 0x1000, 0x2861, 0x4123, 0x7AC9, 0xC511, 0xFEF8, 0xFF5A, 0xFEF8, 0xFE96, 0xFE96, 0xFEF8, 
-0xFF7A, 0xFF39, 0xBCD0, 0x5985, 0x5124, 0xABAE, 0xF5F7, 0xFE58, 0xF5D5, 0xF5D5, 0xFE36, 0xF616, 0x8ACA, 0x2020, 0x1000, 0x6227, 
-0xE5D3, 0xFE93, 0xF631, 0xEE32, 0xCD30, 0x7266, 0x59A4, 0xA3EC, 0xE5D2, 0xEE31, 0xEE50, 0xF6B2, 0xEE52, 0xD54E, 0xDD8E, 0xFEB3, 
-0xFF96, 0xACED, 0x6224, 0xCBCD, 0xE46B, 0xE46B, 0xD3EE, 0xE48B, 0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABC5, 0xABE5, 0x8304, 0xE4A8, 
-0xECE8, 0xECC8, 0xDC4B, 0xA328, 0x8349, 0xDE15, 0xFF7B, 0xFED9, 0xAC30, 0x6A88, 0xBC07, 0xDC4B, 0xCC2A, 0xCC48, 0xDC4B, 0xE46A, 
-0xE489, 0xFD63, 0xECE7, 0xE48A, 0xFD63, 0xECE7, 0xE4A9, 0xF543, 0x8B67, 0x940C, 0xEE74, 0xEE52, 0xD54E, 0xDD8F, 0xEE31, 0xF651, 
-0xEE2F, 0xEE30, 0xFE94, 0xD572, 0x72A9, 0x4965, 0x30E4, 0x1801, 0x2883, 0x4946, 0x4105, 0x2041, 0x1000, 0x3103, 0x7B2B, 0xCD94, 
-0xFF3B, 0xFF7B, 0xFF3A, 0xFF5A, 0xFEF9, 0xBCB0, 0x5963, 0x4902, 0xABCE, 0xFE37, 0xFE37, 0xF5D5, 0xFE15, 0xFE36, 0xFE77, 0xEE15, 
-0x7248, 0x1800, 0x1800, 0x6226, 0xDDB2, 0xFE73, 0xF611, 0xF632, 0xEE13, 0xA3EC, 0x4921, 0x7A66, 0xDD91, 0xF652, 0xF6B2, 0xFF13, 
-0xF692, 0xD54E, 0xE5B0, 0xFF35, 0xFF35, 0x9C6B, 0x6265, 0xD42A, 0xDC6B, 0xDC4B, 0xE46B, 0xE46B, 0xDC2C, 0x7AE4, 0xA368, 0xA368, 
-0xABC5, 0xABC5, 0x8304, 0xE4A8, 0xECC8, 0xDC87, 0x9308, 0x8BAC, 0xDE15, 0xFF7A, 0xFF3A, 0xDDB5, 0x72AA, 0x8B4A, 0xDCA8, 0xA3AB, 
-0x62E9, 0x7328, 0x9B2B, 0xE4C7, 0xFD83, 0xE46B, 0xF506, 0xFD44, 0xE48A, 0xECC8, 0xECC8, 0xBBC8, 0x72E7, 0xCD91, 0xF6B4, 0xDDB0, 
-0xD54E, 0xE5F0, 0xF672, 0xFED2, 0xF691, 0xF651, 0xEDF2, 0xAC0D, 0x59C6, 0x3904, 0x2083, 0x1801, 0x4947, 0x726B, 0x726B, 0x51A7, 
-0x2082, 0x0000, 0x0800, 0x49C6, 0xBCF2, 0xEE98, 0xEE98, 0xC533, 0x82C9, 0x4902, 0x5123, 0xABCD, 0xF5F6, 0xFE36, 0xF5D5, 0xFE15, 
-0xFE77, 0xFE76, 0xFE97, 0xEE36, 0x7AA9, 0x1000, 0x1000, 0x38E2, 0xA3AB, 0xF612, 0xFE32, 0xF632, 0xEE33, 0xB44D, 0x5162, 0x7246, 
-0xD570, 0xF673, 0xFEF3, 0xFF34, 0xEE72, 0xB46B, 0xBC8D, 0xFE94, 0xF6D4, 0x8BE9, 0x6A86, 0xC370, 0xDC4C, 0xDC4C, 0xCB91, 0xE46C, 
-0xDC4B, 0x7AE4, 0xA368, 0xA368, 0xABC6, 0xABA6, 0x8323, 0xB3C6, 0x82E6, 0x72A6, 0x6AA7, 0xCDB3, 0xFFBB, 0xFF7A, 0xEE36, 0x9BCD, 
-0x82C8, 0xBC2A, 0x9BCD, 0x536A, 0x5BCD, 0x73CE, 0x7369, 0x9BA6, 0xECE7, 0xF506, 0xF506, 0xF506, 0xF506, 0xECC8, 0xECC8, 0xA385, 
-0x72E7, 0xDDF2, 0xF693, 0xDDAF, 0xDD4E, 0xEDF0, 0xFE93, 0xFF13, 0xFED2, 0xF652, 0xD570, 0x82A9, 0x5145, 0x3904, 0x1800, 0x30A3, 
-0x6A29, 0x726B, 0x726A, 0x728B, 0x49C7, 0x0800, 0x0000, 0x28C2, 0x51C6, 0x6208, 0x6A28, 0x5144, 0x3000, 0x5904, 0xABCE, 0xF5F6, 
-0xFE36, 0xF5F4, 0xFE35, 0xFE76, 0xFE97, 0xFE97, 0xFE98, 0xE616, 0x72A9, 0x2040, 0x1000, 0x1800, 0x7A66, 0xF5F2, 0xFE52, 0xF631, 
-0xEE12, 0xAC4C, 0x7AA7, 0x82E8, 0xBC8D, 0xF652, 0xF692, 0xFF13, 0xF692, 0xABEA, 0x9B8A, 0xE5D3, 0xF6D5, 0x942B, 0x6245, 0xCBCD, 
-0xE46B, 0xE46B, 0xDC0D, 0xDC4D, 0xD40C, 0x7B04, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8323, 0x7309, 0xA490, 0xB532, 0x9C2D, 0xAC8F, 
-0xF6B7, 0xF697, 0x9BED, 0x82E7, 0xC3EB, 0xB3EB, 0x530B, 0x5C70, 0x9E77, 0x9552, 0x534A, 0x6AE7, 0xDC6A, 0xFD63, 0xECE7, 0xE4A9, 
-0xFD63, 0xECE7, 0xDC68, 0x8B25, 0x93AA, 0xD590, 0xEE11, 0xE5AF, 0xD54E, 0xE5D0, 0xFEB3, 0xFF14, 0xFF13, 0xFE93, 0xBC8D, 0x61E6, 
-0x5186, 0x30E4, 0x1000, 0x49A6, 0x938D, 0x936D, 0x726A, 0x6A29, 0x5A29, 0x4165, 0x28C3, 0x728A, 0x8AEC, 0x4062, 0x3000, 0x50C3, 
-0x7A08, 0xBC10, 0xF5D6, 0xFE37, 0xF5D4, 0xF635, 0xFE96, 0xFE96, 0xFE97, 0xFEB8, 0xFED9, 0xDDD5, 0x72A9, 0x5A27, 0x5207, 0x1800, 
-0x7246, 0xF5F2, 0xFE73, 0xF632, 0xDDB0, 0xAC4C, 0xAC2D, 0x8B29, 0xA3AA, 0xEE32, 0xEE71, 0xF692, 0xEE32, 0xABEB, 0xA3AC, 0xE5D4, 
-0xDE13, 0x8BCA, 0x82C6, 0xDC4B, 0xE46B, 0xDC6B, 0xE48A, 0xD3EF, 0xCBCF, 0x8303, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8323, 0xD616, 
-0xFF1A, 0xFF9B, 0xE676, 0x9C0D, 0x836A, 0x836B, 0x8B09, 0xCC48, 0xB3CC, 0x6B6A, 0x6C70, 0x7D95, 0x7534, 0x5C30, 0x3ACA, 0x7B06, 
-0xF543, 0xE48A, 0xECC8, 0xECC8, 0xE48A, 0xECC8, 0xB3A6, 0x72E7, 0xC550, 0xDDD2, 0xE5D1, 0xE5D0, 0xD54E, 0xE5B0, 0xF693, 0xFEF4, 
-0xFF14, 0xFEB4, 0xAC2C, 0x59A5, 0x4125, 0x2042, 0x28A2, 0x832A, 0xBCD1, 0xBCD1, 0x9B8D, 0x5186, 0x51E7, 0xB534, 0xA471, 0x8B4D, 
-0xC492, 0xAB6D, 0x8A48, 0xB38D, 0xE533, 0xFDF6, 0xFE16, 0xF5F5, 0xF615, 0xFE97, 0xFEB6, 0xFEB6, 0xFEB7, 0xFEB7, 0xFEF9, 0xE636, 
-0x93AD, 0x8B6C, 0x836D, 0x28A2, 0x6A05, 0xEDF3, 0xFE94, 0xF632, 0xCD0E, 0xB44D, 0xCD11, 0x934A, 0x9B8A, 0xEE32, 0xF691, 0xEE32, 
-0xD550, 0xA38B, 0xB42E, 0xF635, 0xB48E, 0x6A86, 0xB38A, 0xCB91, 0xDC4B, 0xDC6B, 0xCB91, 0xE46B, 0xDC6A, 0x7AE4, 0xA368, 0xA368, 
-0xABC6, 0xABA6, 0x8323, 0xFEBA, 0xFEFA, 0xFF19, 0xFF9A, 0xD5F4, 0x5225, 0x6204, 0xD469, 0xB3AD, 0x5B49, 0x6C0D, 0x74D1, 0x43AE, 
-0x11C8, 0x19A7, 0x3A6A, 0x8B47, 0xECE7, 0xF526, 0xECE7, 0xECC8, 0xF525, 0xECE8, 0x9B46, 0x72C7, 0xCDB2, 0xCD51, 0xB46D, 0xDDB0, 
-0xDDB0, 0xD54E, 0xEE11, 0xFE93, 0xFED4, 0xDDD0, 0x8348, 0x51A5, 0x38E4, 0x1801, 0x51C6, 0xB48E, 0xCD31, 0xCD32, 0xB4B1, 0x59E6, 
-0x51C6, 0xEEDB, 0xEEDB, 0x6A89, 0x9BAD, 0xF616, 0xF594, 0xFD94, 0xFE15, 0xF614, 0xF5F4, 0xF636, 0xFE97, 0xFEB7, 0xFEB7, 0xFEB6, 
-0xFED6, 0xFEF7, 0xFED7, 0xFED8, 0xCD53, 0x834C, 0x72CB, 0x38E3, 0x6A47, 0xEDF3, 0xFE94, 0xF632, 0xC48C, 0xB40C, 0xDD73, 0x9B4A, 
-0x9B69, 0xEE31, 0xFE92, 0xEDF2, 0xBC4E, 0x9B4A, 0xCCF0, 0xF655, 0xA40C, 0x6A25, 0xCC0A, 0xDC2D, 0xDC2D, 0xDC2D, 0xDC2C, 0xDC2D, 
-0xD40D, 0x7B04, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8323, 0x9BAD, 0xE5D5, 0xFF19, 0xFF7A, 0xF718, 0x9C4E, 0x6AA8, 0x938A, 0x6B6B, 
-0x5BCD, 0x6C70, 0x42EC, 0x0925, 0x0083, 0x1166, 0x3A4A, 0x8347, 0xE489, 0xFD64, 0xED06, 0xECA9, 0xFD64, 0xECE7, 0xA366, 0x6AC7, 
-0xC551, 0xB46E, 0x7266, 0xBCAD, 0xEE12, 0xCD0E, 0xDD6F, 0xF653, 0xF693, 0xBCCD, 0x6204, 0x59E6, 0x4145, 0x1000, 0x5A07, 0xBCAF, 
-0xCD31, 0xC532, 0x9BEE, 0x4985, 0x838D, 0xFF7D, 0xE6DA, 0x6A89, 0x830A, 0xFE77, 0xFE77, 0xFDD4, 0xF5D3, 0xF5F3, 0xFE35, 0xFE97, 
-0xFEB8, 0xFE97, 0xFEB7, 0xFED6, 0xFEB6, 0xFED7, 0xFF18, 0xFF19, 0xB470, 0x7B0B, 0xACB2, 0x7B0B, 0x72A8, 0xDDB2, 0xFE94, 0xF611, 
-0xBC2C, 0xB3EC, 0xD532, 0x9B6A, 0xA3CA, 0xEE52, 0xFEB3, 0xD550, 0x9B6A, 0xAC0C, 0xEE13, 0xD591, 0x8B49, 0x6A86, 0xA369, 0xDC6A, 
-0xD3EE, 0xD3EE, 0xE48A, 0xD3EF, 0xCBCE, 0x8303, 0xA368, 0xA368, 0xABE5, 0xB3E5, 0x8303, 0x9BCD, 0x93AC, 0xD5D3, 0xFF59, 0xFF7A, 
-0xD615, 0x4A27, 0x3206, 0x6C6F, 0x6CD1, 0x3B0C, 0x08C4, 0x0883, 0x1967, 0x29E8, 0x3A49, 0x8307, 0xE4C8, 0xE48A, 0xECA9, 0xECC8, 
-0xE48A, 0xECC8, 0xA386, 0x7309, 0xC552, 0xAC2E, 0x7245, 0x8B28, 0xDD90, 0xDD70, 0xD550, 0xEE33, 0xFE94, 0xBC8D, 0x59C4, 0x59E7, 
-0x4125, 0x1000, 0x51C6, 0xB48F, 0xCD52, 0xBCD1, 0x6A68, 0x49A5, 0xCDB6, 0xFFFF, 0xF73B, 0x9C4F, 0x6A88, 0xCD52, 0xFEF9, 0xF5F4, 
-0xF5F4, 0xFE95, 0xFEB7, 0xFEB7, 0xFEB7, 0xFEB7, 0xFED7, 0xFED6, 0xFED6, 0xFED6, 0xFF59, 0xEE56, 0x72C9, 0x93AD, 0xFF9D, 0xBD13, 
-0x7288, 0xD571, 0xFED5, 0xE5B1, 0xABEB, 0xC490, 0xB44E, 0x9349, 0xC4EE, 0xFEB4, 0xFED5, 0xBCAD, 0x9369, 0xCD0F, 0xF674, 0xAC2B, 
-0x7AE6, 0xAC6D, 0x8B8B, 0x92ED, 0xDC6B, 0xE46B, 0xC372, 0xE46B, 0xDC6A, 0x7AE4, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x8303, 0xEEB8, 
-0x9C2D, 0x8BAB, 0xDE35, 0xFF7B, 0xDDB5, 0x59E7, 0x3A07, 0x642F, 0x3B4C, 0x00E3, 0x0000, 0x2967, 0x4A8B, 0x3A29, 0x3A08, 0x8B26, 
-0xE4A9, 0xF525, 0xECE7, 0xECA8, 0xF525, 0xECE7, 0xB3E7, 0x7308, 0xAC8F, 0xA42E, 0x82A8, 0x7245, 0xC4CE, 0xEE13, 0xCD0F, 0xDD91, 
-0xFEB5, 0xC4EF, 0x61E5, 0x59C6, 0x4125, 0x1821, 0x5A07, 0xB4B1, 0xCD53, 0x8B4B, 0x4123, 0x836C, 0xF75C, 0xFFFE, 0xFFBD, 0xD657, 
-0x6AE9, 0x8B8B, 0xF6D8, 0xFF19, 0xFE96, 0xFEB6, 0xFED7, 0xFEB7, 0xFEB7, 0xFED7, 0xFEB6, 0xFEB6, 0xFED6, 0xFEF7, 0xFF39, 0xAC6F, 
-0x72C9, 0xD5F6, 0xFFFF, 0xCD95, 0x7B0A, 0xC4F0, 0xFED5, 0xD570, 0xABEC, 0xC490, 0x9B6A, 0xA3EB, 0xFEB4, 0xFEB5, 0xB48E, 0x8328, 
-0xAC4C, 0xEE54, 0xD5B1, 0x7285, 0x8B68, 0xEE55, 0xCD72, 0x834A, 0x9B2A, 0xDC2D, 0xDC4C, 0xDC2D, 0xD40D, 0x7B04, 0xA368, 0xA368, 
-0xA369, 0xA349, 0x8342, 0xFF9B, 0xE697, 0x838A, 0x9C0D, 0xFED9, 0xF5D6, 0x92CC, 0x4125, 0x2186, 0x0944, 0x0041, 0x0000, 0x39C8, 
-0x5B0D, 0x4249, 0x3A08, 0x9346, 0xE4A9, 0xFD64, 0xECE7, 0xECA9, 0xFD44, 0xECE7, 0xE4A8, 0x9365, 0x72C8, 0x9BAC, 0x936B, 0x7A87, 
-0xA3CB, 0xE5D3, 0xD530, 0xC4CF, 0xE5D3, 0xC4CF, 0x6A46, 0x59C6, 0x4124, 0x1821, 0x51E7, 0xA44F, 0x9C0F, 0x51A5, 0x49A5, 0xC5B6, 
-0xFFFE, 0xFF7C, 0xFF9C, 0xFF9C, 0xBDB4, 0x7B6B, 0xAC8F, 0xF6F8, 0xFF59, 0xFEF7, 0xFED7, 0xFEB7, 0xFEB7, 0xFEB7, 0xFEB6, 0xFEB6, 
-0xF6B6, 0xFF38, 0xDE15, 0x7B2A, 0xA46F, 0xFF9C, 0xFFFE, 0xF73B, 0x93EE, 0x8B8A, 0xE613, 0xCD2F, 0xA3CC, 0x9BAC, 0xAC2D, 0xDDF2, 
-0xFEF6, 0xB4AE, 0x4102, 0x4962, 0xCD71, 0xFEF7, 0x9BCC, 0x5183, 0xA3EC, 0xEE35, 0xF6D7, 0xB4CF, 0x6A46, 0xB36C, 0xE48A, 0xDC0E, 
-0xCBCE, 0x8303, 0xA368, 0xA368, 0xABA7, 0xAB87, 0x8323, 0xEE98, 0xFF9C, 0x942E, 0x51C4, 0xCCD2, 0xFDF8, 0xCC12, 0x6167, 0x1001, 
-0x0021, 0x0041, 0x0062, 0x4229, 0x5AEC, 0x31C7, 0x3186, 0x8B07, 0xECC8, 0xE48A, 0xECA9, 0xECC8, 0xE48A, 0xECA8, 0xDC88, 0x8B07, 
-0x6226, 0x82EA, 0xA3CD, 0x8B09, 0x7A87, 0xC4AF, 0xDD72, 0xC4AF, 0xC4CF, 0xC4D0, 0x82E9, 0x5184, 0x4144, 0x2881, 0x4144, 0x72CA, 
-0x5A07, 0x5A27, 0xB513, 0xFF9D, 0xFFDD, 0xEF5B, 0xF77B, 0xFFBC, 0xFFBC, 0xCE15, 0x838B, 0xA46E, 0xE6B6, 0xFF59, 0xFF59, 0xFEF8, 
-0xFEB7, 0xFED7, 0xFED7, 0xFEB6, 0xFF17, 0xFF38, 0x9C4D, 0x7B4B, 0xE6B8, 0xFFBD, 0xFFBC, 0xFFFE, 0xC594, 0x7B29, 0xA44D, 0x9BCB, 
-0x7AC7, 0x9BAB, 0xD572, 0xC550, 0x8BA9, 0x5A05, 0x2860, 0x6226, 0xD5B3, 0xCD32, 0x7267, 0x7267, 0xAC0E, 0xCD31, 0xEE55, 0xE613, 
-0x8B89, 0x9328, 0xC352, 0xE48B, 0xDC6A, 0x7AE5, 0xA368, 0xA368, 0xB3E5, 0xB3E5, 0x7AE4, 0xCD33, 0xFFDD, 0x9C4F, 0x2080, 0x51A6, 
-0xA36E, 0xC412, 0x8AAD, 0x2043, 0x0001, 0x0022, 0x0883, 0x52AC, 0x632E, 0x1905, 0x18C3, 0x9325, 0xECA9, 0xF545, 0xECE7, 0xECA9, 
-0xF545, 0xDC87, 0x9347, 0x93EC, 0x832A, 0x7AC9, 0xAC4F, 0x9BAC, 0x7246, 0x82C8, 0xBC8F, 0xCD31, 0xC4D0, 0xC4D0, 0xAC2E, 0x6A68, 
-0x4984, 0x38E2, 0x2881, 0x3903, 0x28A2, 0x7B4C, 0xFF9D, 0xFFFE, 0xF77B, 0xF77B, 0xF77B, 0xF77B, 0xFFBC, 0xFFBC, 0xCE15, 0x83AB, 
-0x7B6A, 0xB510, 0xE6B6, 0xFF59, 0xFF59, 0xFF18, 0xFED7, 0xFF18, 0xFF59, 0xCDB3, 0x7B6A, 0xAD11, 0xFFBD, 0xFFBD, 0xF77B, 0xFFDD, 
-0xF75A, 0x93ED, 0x5A46, 0x6225, 0x4982, 0x7285, 0x93CA, 0x7B08, 0x4162, 0x28A0, 0x4143, 0x8B6B, 0xAC2D, 0x936B, 0xBC6F, 0xBC70, 
-0xA3AC, 0xB44E, 0xDD92, 0xFEB5, 0xBCCE, 0x6245, 0xB389, 0xDC2E, 0xD40D, 0x8304, 0xA368, 0xA368, 0xA369, 0xA349, 0x8323, 0xAC30, 
-0xFF3C, 0x942F, 0x3144, 0x2903, 0x30C4, 0x59C9, 0x59A9, 0x2044, 0x0802, 0x0002, 0x1064, 0x5AED, 0x632E, 0x10E4, 0x10C3, 0x8B25, 
-0xE4A9, 0xFD44, 0xECE7, 0xECA9, 0xED04, 0x9366, 0x93EB, 0xDDD4, 0xB44E, 0x7AC9, 0x9BCD, 0x936C, 0x6205, 0x59A4, 0x7AC8, 0xAC2D, 
-0xC4D0, 0xC511, 0xD593, 0xBCD1, 0x72A9, 0x38C2, 0x1800, 0x2882, 0x30E3, 0x5A48, 0xD617, 0xFFFE, 0xF79C, 0xF77B, 0xF77B, 0xF77B, 
-0xF75A, 0xFF9B, 0xFFBC, 0xD656, 0x8C0D, 0x7349, 0x838A, 0xB511, 0xDE15, 0xEE76, 0xFF39, 0xFF5A, 0xD5D3, 0x8BCC, 0xAD11, 0xF75B, 
-0xFFBD, 0xF79C, 0xEF7A, 0xF79B, 0xFFFD, 0xC5D5, 0x6AA9, 0x6AA8, 0x8B8A, 0x93A9, 0x9BEB, 0xAC6F, 0x6A68, 0x28A1, 0x3942, 0x6A45, 
-0x8B28, 0xBCAE, 0xFE97, 0xDD53, 0x932A, 0xABEB, 0xDD90, 0xFED5, 0xCD90, 0x72C7, 0xAB88, 0xDC0F, 0xCBCE, 0x8303, 0xA368, 0xA368, 
-0xABA7, 0xABA7, 0x8323, 0x6249, 0xB4F3, 0x8BCF, 0x41E8, 0x31A7, 0x2946, 0x524A, 0x3968, 0x1023, 0x0002, 0x0001, 0x2106, 0x6B4F, 
-0x4A6B, 0x0883, 0x10E3, 0x8B06, 0xECC8, 0xE4A9, 0xECC8, 0xECC8, 0x9326, 0x8BA9, 0xDE13, 0xEE55, 0xCD12, 0x9BED, 0x6A88, 0x51A5, 
-0x6A88, 0x93AC, 0x72C8, 0x6205, 0x8B6B, 0xB490, 0xAC4F, 0xAC4E, 0x8B4B, 0x4903, 0x2840, 0x4965, 0x59E7, 0x3903, 0x838D, 0xF77B, 
-0xFFDD, 0xF75B, 0xF77B, 0xF77B, 0xF73A, 0xF75B, 0xFF9C, 0xFFDD, 0xF77B, 0xC5F5, 0x944E, 0x7329, 0x6AC8, 0x9BED, 0xE656, 0xDE15, 
-0x93AC, 0xA490, 0xF73A, 0xFFDD, 0xF79C, 0xF79B, 0xEF7A, 0xF77A, 0xFFBB, 0xFF9C, 0xC5B6, 0x93EE, 0xBD30, 0xF6B5, 0xFEF7, 0xD594, 
-0x6A69, 0x51E6, 0x72E9, 0x8B68, 0xC50D, 0xF694, 0xF675, 0xC4CF, 0x9B69, 0xB42B, 0xDD6F, 0xF673, 0xF6D5, 0xAC8E, 0x7AAA, 0xCBAE, 
-0xD3EE, 0x8304, 0xA368, 0xA368, 0xB3E5, 0xB3E5, 0x7B04, 0x0861, 0x39A6, 0x524A, 0x20E4, 0x10C4, 0x4AAC, 0x94B4, 0x5ACD, 0x0843, 
-0x0002, 0x0001, 0x2947, 0x7370, 0x3A0A, 0x0021, 0x10A2, 0x9345, 0xECA9, 0xECC8, 0xECC8, 0xC407, 0x7284, 0xBD0E, 0xFED6, 0xD552, 
-0xC4D2, 0xC512, 0x838C, 0x49A5, 0x6AA9, 0xACD1, 0xA48F, 0x5205, 0x4122, 0x6207, 0x59C5, 0x5163, 0x5984, 0x5984, 0x61A6, 0x7228, 
-0x7249, 0x4944, 0x51A5, 0xCDD5, 0xFFFE, 0xFF7B, 0xF75B, 0xF75B, 0xF75B, 0xF75B, 0xF75B, 0xFF9C, 0xFFDD, 0xFFFD, 0xF77B, 0xBD73, 
-0x9C2E, 0x9C0E, 0x9BEE, 0x832B, 0x8B6C, 0xD616, 0xFF5B, 0xFF7C, 0xFFBC, 0xF77B, 0xF77B, 0xF77A, 0xF75A, 0xFFBD, 0xFFDF, 0xCD95, 
-0x7AE9, 0xA44D, 0xE5F4, 0x938C, 0x4965, 0x93AE, 0xD5D4, 0xEE74, 0xFF15, 0xFF77, 0xEE33, 0xA40B, 0xA3EA, 0xBC8C, 0xC4AC, 0xDDB0, 
-0xFF57, 0xC591, 0x5A26, 0xBB6C, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xA349, 0x9B4A, 0x8323, 0x2A68, 0x2986, 0x18A4, 0x0001, 0x0823, 
-0x5ACD, 0x9CF6, 0x630E, 0x0864, 0x0022, 0x0042, 0x31C9, 0x7390, 0x420A, 0x0001, 0x1081, 0x9B45, 0xECA9, 0xECC8, 0xE4A8, 0x9327, 
-0x8389, 0xEE94, 0xE613, 0x82E9, 0x7248, 0x832B, 0x6ACA, 0x4185, 0x3123, 0x5226, 0x732A, 0x732A, 0x6A89, 0x4985, 0x38E2, 0x4923, 
-0x5984, 0x69E6, 0x8228, 0x8208, 0x8248, 0x6A07, 0x4102, 0x836C, 0xF75B, 0xFFFD, 0xFF5B, 0xF73A, 0xF75B, 0xF77B, 0xF77B, 0xF77B, 
-0xF77B, 0xFF9C, 0xFF5C, 0xDE37, 0xC574, 0xC554, 0xA430, 0x8B6D, 0x93CF, 0xB4D2, 0xDE58, 0xF71B, 0xFF7C, 0xF75B, 0xF75B, 0xF77B, 
-0xF77B, 0xFFBC, 0xFFDE, 0xC554, 0x4102, 0x40E1, 0x7A87, 0x5144, 0x3061, 0x832B, 0xE635, 0xFEF7, 0xFEF5, 0xEE95, 0xBCEF, 0x9BCB, 
-0xBCAE, 0xC4EE, 0xBC6C, 0xD56F, 0xFEF6, 0xC550, 0x5A25, 0xBB6C, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xABA6, 0xABA6, 0x8303, 0x9E77, 
-0x63CF, 0x0863, 0x0000, 0x0823, 0x5AAD, 0x9494, 0x5AAD, 0x0864, 0x0001, 0x08A4, 0x528B, 0x7BB0, 0x420A, 0x0021, 0x1061, 0x8AE5, 
-0xECC8, 0xECC8, 0xC3E7, 0x7AC7, 0xC550, 0xEE74, 0x9389, 0x59A5, 0x7269, 0x834C, 0x7B4C, 0x732C, 0x730C, 0x62EA, 0x734B, 0xBD94, 
-0xEEFB, 0xBD34, 0x6A48, 0x5184, 0x7227, 0x7A48, 0x8208, 0x89E7, 0x81E7, 0x7A08, 0x61A5, 0x4984, 0x9C2E, 0xF75B, 0xFFFD, 0xFF7B, 
-0xF75B, 0xF77B, 0xF77B, 0xF77B, 0xFF9C, 0xFF5C, 0xCDD6, 0x838D, 0x8BAE, 0xCD75, 0xD5B7, 0xDDF8, 0xA431, 0x72CB, 0xBD34, 0xEEBA, 
-0xF73B, 0xFF7C, 0xF73B, 0xF75B, 0xFF7B, 0xFFFE, 0xEEFA, 0x72AA, 0x4103, 0x5985, 0x5143, 0x48C1, 0x40A1, 0x5164, 0x8309, 0x93AC, 
-0x9C0C, 0x834A, 0x6266, 0x834A, 0xAC4E, 0xBCCF, 0xCD50, 0xE5F2, 0xF695, 0xAC8D, 0x6A88, 0xC3CE, 0xD3EE, 0x8304, 0xA368, 0xA368, 
-0xABE5, 0xABE5, 0x7B04, 0x8DD5, 0x4B0C, 0x0042, 0x0001, 0x1864, 0x62AE, 0x8BF2, 0x4A0B, 0x0823, 0x0001, 0x18C5, 0x5ACD, 0x6B4F, 
-0x3147, 0x0001, 0x18A2, 0x9B46, 0xECC8, 0xECC8, 0x9B46, 0x836B, 0xF6F7, 0xBCEF, 0x6204, 0xA3EF, 0xD596, 0xD5B6, 0xDE78, 0xEF3C, 
-0xF75C, 0xEF3B, 0xE6FA, 0xFF9C, 0xFFFF, 0xFF5D, 0xC533, 0x6A47, 0x5144, 0x71E7, 0x8208, 0x89C7, 0x81C7, 0x79E7, 0x7A27, 0x59C5, 
-0x4984, 0x940E, 0xF73B, 0xFFFD, 0xFF9C, 0xF77B, 0xEF7B, 0xF79C, 0xFF9D, 0xFF3C, 0xB4F3, 0x5A07, 0x9C10, 0xE639, 0xE618, 0xF69B, 
-0xC515, 0x6A6A, 0x93AF, 0xDE38, 0xF71B, 0xFF5C, 0xFF7C, 0xF77B, 0xFFDD, 0xFF9C, 0xA470, 0x4945, 0x61A6, 0x7A48, 0x69E6, 0x71E6, 
-0x7226, 0x61A4, 0x3060, 0x38C2, 0x832B, 0xA450, 0x8BAD, 0x6288, 0x5A06, 0x8309, 0xD571, 0xF695, 0xF695, 0xA44C, 0x72C7, 0xC3EE, 
-0xD3EE, 0x8304, 0xA368, 0xA368, 0xA349, 0x9B2A, 0x8323, 0x2A08, 0x08A2, 0x0020, 0x0001, 0x18C5, 0x62EE, 0x7BB1, 0x41A9, 0x0823, 
-0x0001, 0x18C5, 0x5AEE, 0x5ACD, 0x1064, 0x0000, 0x6A66, 0xE4A8, 0xECC8, 0xE4A8, 0x8B07, 0xA46E, 0xDE14, 0x9BEC, 0xA42E, 0xEE58, 
-0xEE39, 0xD595, 0xDE38, 0xFF5C, 0xFFFF, 0xFFFE, 0xFFBD, 0xFF9C, 0xFF5C, 0xFF7C, 0xFF3B, 0xBD13, 0x6A07, 0x5945, 0x79C8, 0x81E8, 
-0x81E8, 0x79E7, 0x7A07, 0x8248, 0x5964, 0x4923, 0x9BCE, 0xF71B, 0xFFFF, 0xFFDD, 0xF7BC, 0xF79C, 0xEF3B, 0xE69A, 0xACB2, 0x72EB, 
-0xCD55, 0xF6BB, 0xEE39, 0xFEDB, 0xDDD7, 0x8B4D, 0x72CB, 0xC534, 0xEE9A, 0xFF3C, 0xFFBD, 0xFFFE, 0xFF9C, 0xAC90, 0x5164, 0x6185, 
-0x7A08, 0x7A08, 0x7A28, 0x7A28, 0x8268, 0x7A47, 0x5944, 0x4924, 0x938E, 0xF6FA, 0xF75B, 0xB553, 0x940E, 0x834A, 0x9BEC, 0xE614, 
-0xFED6, 0xA44D, 0x6A86, 0xC3CE, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xABA6, 0xABA6, 0x8303, 0x18E4, 0x0021, 0x0021, 0x0021, 0x1084, 
-0x52AD, 0x7B91, 0x41CA, 0x0823, 0x0001, 0x18C5, 0x634F, 0x52AD, 0x0022, 0x1061, 0xA388, 0xDCA8, 0xBBE7, 0x82A5, 0x8B8A, 0xCD93, 
-0x93AC, 0x93ED, 0xF71A, 0xFF7C, 0xEE79, 0xDDD7, 0xCD75, 0xCDD6, 0xEEDA, 0xFFBD, 0xFF9C, 0xFF5B, 0xFF5B, 0xFF7C, 0xFF7C, 0xFF3B, 
-0xBCD3, 0x5966, 0x5905, 0x8209, 0x8208, 0x79E7, 0x8207, 0x7A07, 0x7A06, 0x5944, 0x5965, 0x9BCE, 0xDE37, 0xFF9D, 0xFFFF, 0xFFFD, 
-0xF75C, 0xD618, 0x836D, 0x8BAE, 0xEEBA, 0xEE9A, 0xEE59, 0xFEFB, 0xE638, 0xBCD3, 0x72CB, 0x93AE, 0xE639, 0xFF7C, 0xFFFF, 0xFFBD, 
-0xACB1, 0x5164, 0x5123, 0x7A07, 0x8207, 0x7A07, 0x7A07, 0x7A07, 0x7A27, 0x8248, 0x8248, 0x69C6, 0x59A6, 0xA44F, 0xFF7B, 0xFFFE, 
-0xFFDD, 0xD636, 0x72E8, 0xA42D, 0xFF38, 0xAC8E, 0x6A88, 0xC3EF, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x7AE4, 0x4A07, 
-0x10A3, 0x0021, 0x0001, 0x0863, 0x4A4C, 0x6B30, 0x3169, 0x0002, 0x0001, 0x2967, 0x7BD1, 0x4A6B, 0x0000, 0x20C1, 0x7AC7, 0x82E8, 
-0x6A47, 0x7AC9, 0xC4F1, 0xBCB0, 0x832A, 0xC553, 0xFFDD, 0xFFBD, 0xF75C, 0xFF3C, 0xEE78, 0xC595, 0xC5B5, 0xEEFA, 0xFF9D, 0xFF5C, 
-0xFF5B, 0xFF5C, 0xF75C, 0xFF9D, 0xEEBA, 0x8B0C, 0x48E4, 0x71A7, 0x8228, 0x8207, 0x7A07, 0x79E6, 0x7A07, 0x7A07, 0x6186, 0x5124, 
-0x6207, 0x9C0F, 0xBD53, 0xDE57, 0xFF5C, 0xCDD6, 0x6289, 0x9C50, 0xFF9E, 0xE6BA, 0xDE38, 0xF6DB, 0xEE59, 0xD5B6, 0x72CB, 0x6AAA, 
-0xDE38, 0xF73B, 0xCE37, 0x940E, 0x51A5, 0x5964, 0x7A07, 0x8207, 0x79E7, 0x79E7, 0x8207, 0x7A07, 0x7A07, 0x7A07, 0x8227, 0x7A28, 
-0x4924, 0x4944, 0xBD53, 0xFFFE, 0xFFFF, 0xFFBC, 0xA46F, 0x834A, 0xCDB2, 0x9C4D, 0x7AE7, 0xCBCD, 0xD3EE, 0x8304, 0xA368, 0xA368, 
-0xA349, 0x9B2A, 0x8323, 0x49E6, 0x1082, 0x0001, 0x0822, 0x3189, 0x6330, 0x5ACE, 0x18A5, 0x0001, 0x0842, 0x41C8, 0x62CC, 0x2924, 
-0x18C1, 0x5268, 0x838C, 0xB4F2, 0xE616, 0xE616, 0xC4F1, 0x7AC9, 0x9C0E, 0xF73B, 0xFFDD, 0xEF7C, 0xF77C, 0xFF7C, 0xFF5C, 0xE698, 
-0xC594, 0xCDD5, 0xF6FA, 0xFF7D, 0xFF5C, 0xF75B, 0xF77C, 0xFF9C, 0xFF5C, 0xC554, 0x61E7, 0x5924, 0x7A28, 0x7A27, 0x79E6, 0x7A07, 
-0x7A06, 0x8207, 0x8228, 0x69A6, 0x5124, 0x4903, 0x4102, 0x7268, 0x9BEE, 0x832C, 0x5207, 0xB554, 0xFFFE, 0xDE99, 0xDE59, 0xEEBB, 
-0xE638, 0xE658, 0xAC92, 0x6ACA, 0x83CE, 0x8BEE, 0x5A06, 0x38E2, 0x59A5, 0x7A28, 0x8207, 0x79E7, 0x81E7, 0x81E7, 0x81E7, 0x8207, 
-0x8207, 0x79E7, 0x79E7, 0x8228, 0x7207, 0x4103, 0x72CA, 0xEEB9, 0xFFDE, 0xFFFE, 0xDE57, 0x836A, 0x7308, 0x7308, 0xABAA, 0xDC0E, 
-0xD3EE, 0x8304, 0xA368, 0xA368, 0xABC6, 0xABA6, 0x8303, 0x28E4, 0x0821, 0x0000, 0x1063, 0x62CE, 0x8C34, 0x5AAE, 0x1084, 0x0001, 
-0x1062, 0x3104, 0x49A7, 0x6269, 0x9C6F, 0xDE36, 0xEEB8, 0xFF5A, 0xFFFD, 0xD5F5, 0x6A88, 0x6A88, 0xD5F6, 0xFFFD, 0xFF9C, 0xEF5B, 
-0xF75B, 0xFF3B, 0xFF5B, 0xFF5B, 0xE698, 0xCD95, 0xD5D6, 0xF6DA, 0xFF5C, 0xF75B, 0xF77C, 0xFFBD, 0xFF9C, 0xE6B9, 0x938D, 0x5103, 
-0x69C6, 0x8248, 0x7A07, 0x7A06, 0x79E6, 0x8207, 0x8207, 0x8228, 0x7A28, 0x69A6, 0x6185, 0x5944, 0x3040, 0x30A2, 0x834C, 0xEEFA, 
-0xFFFE, 0xD658, 0xDE79, 0xEEDB, 0xDDF7, 0xF6DB, 0xFF5C, 0xBD54, 0x41C5, 0x2080, 0x5144, 0x69A5, 0x7A07, 0x8207, 0x81E7, 0x81E7, 
-0x81E7, 0x81E7, 0x81E7, 0x81E7, 0x8207, 0x8207, 0x8207, 0x8207, 0x7A28, 0x5985, 0x4964, 0xBD13, 0xFFDE, 0xFF9D, 0xE6B9, 0x9C4E, 
-0x5225, 0x82E9, 0xCBCF, 0xDBEF, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x7AE5, 0x28E2, 0x0821, 0x0001, 0x1043, 0x62EF, 
-0x8C35, 0x528E, 0x1084, 0x0001, 0x0800, 0x2061, 0x830C, 0xE617, 0xFF3A, 0xFF7B, 0xFFBC, 0xFF9C, 0xCDF5, 0x732A, 0x3163, 0x8C0E, 
-0xFFBC, 0xFFDD, 0xF75B, 0xF75B, 0xFF5B, 0xFF3B, 0xFF1A, 0xFF5B, 0xFF5C, 0xE658, 0xC554, 0xD596, 0xF6FB, 0xFF7D, 0xF77C, 0xF79C, 
-0xF79C, 0xF75B, 0xC554, 0x6A07, 0x5945, 0x7A28, 0x8228, 0x79E7, 0x81E7, 0x81E7, 0x81E7, 0x8207, 0x8208, 0x8228, 0x8248, 0x7A07, 
-0x48E3, 0x4944, 0xAC50, 0xF6FB, 0xFFDE, 0xEEFB, 0xE679, 0xEEBB, 0xDE18, 0xEEBA, 0xFFFF, 0xF77C, 0x6AC9, 0x30A1, 0x7A27, 0x8A69, 
-0x8207, 0x8207, 0x8207, 0x81E7, 0x81E7, 0x8207, 0x81E7, 0x81E7, 0x81E7, 0x81E7, 0x81E7, 0x81E7, 0x8228, 0x71E7, 0x4903, 0x7AEB, 
-0xE679, 0xEEBA, 0xDE58, 0xCDD5, 0x7329, 0x932B, 0xD3EE, 0xDC0F, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xA349, 0x9B2A, 0x8323, 0x28E2, 
-0x0842, 0x0001, 0x0823, 0x62EF, 0x8C35, 0x4A2C, 0x1063, 0x0000, 0x0800, 0x4124, 0xBCB2, 0xFF5C, 0xFFBC, 0xFF5A, 0xEE98, 0xBD32, 
-0x7B8C, 0x4A06, 0x5AA8, 0xCE37, 0xFFFD, 0xF77C, 0xFF5B, 0xFF5B, 0xFF5B, 0xFF5B, 0xF75B, 0xF73B, 0xFF5C, 0xF71B, 0xDDF7, 0xC4F3, 
-0xDDF7, 0xFF7C, 0xFF9C, 0xF77B, 0xF79C, 0xF79B, 0xE698, 0x9BAE, 0x5124, 0x69A6, 0x7A08, 0x8208, 0x8228, 0x8207, 0x8207, 0x81E7, 
-0x81E7, 0x8207, 0x8207, 0x8228, 0x7A48, 0x61C7, 0x6207, 0x832C, 0xCD75, 0xEEBA, 0xEEBA, 0xF6DB, 0xF6DA, 0xF6BA, 0xFF3B, 0xBD12, 
-0x6247, 0x61C6, 0x8227, 0x8207, 0x81E7, 0x8208, 0x8208, 0x81E7, 0x8207, 0x8207, 0x8207, 0x8207, 0x81E7, 0x81E7, 0x81E7, 0x81C7, 
-0x8207, 0x8228, 0x5103, 0x5165, 0xBCF4, 0xDE59, 0xDE99, 0xF77C, 0xAD32, 0x72E9, 0xBBAD, 0xDC0F, 0xD3EE, 0x8304, 0xA368, 0xA368, 
-0xABC6, 0xABC6, 0x8303, 0x20E3, 0x0842, 0x0001, 0x0844, 0x62EF, 0x8C14, 0x4A2C, 0x1043, 0x0000, 0x4985, 0xAC30, 0xCD13, 0xCD33, 
-0xD5B5, 0xBD33, 0x836C, 0x6AA8, 0x8B69, 0x6A87, 0x83AD, 0xEF3B, 0xFFDD, 0xF75B, 0xF75B, 0xF75B, 0xF75B, 0xF77B, 0xF77B, 0xF77B, 
-0xF75B, 0xFF5C, 0xF69A, 0xCD34, 0xCD55, 0xF6FB, 0xFF9D, 0xF77B, 0xF77B, 0xF77B, 0xFF5B, 0xBCB2, 0x4904, 0x5104, 0x7A29, 0x7A08, 
-0x79C7, 0x79A7, 0x81E7, 0x8207, 0x8207, 0x79E7, 0x71A6, 0x71A6, 0x7A28, 0x7228, 0x5145, 0x48E4, 0x5986, 0x8B0C, 0xB472, 0xEE79, 
-0xFFBE, 0xEE58, 0xA3EE, 0x59A5, 0x5985, 0x7A27, 0x81E7, 0x81E6, 0x81E7, 0x8228, 0x8228, 0x79E7, 0x71A6, 0x71A6, 0x79E6, 0x8207, 
-0x8207, 0x79E7, 0x81E7, 0x81E7, 0x81E7, 0x8228, 0x5924, 0x5165, 0xAC72, 0xE65A, 0xF75D, 0xFFFF, 0xC616, 0x5AA8, 0xABAD, 0xDC0F, 
-0xD3EE, 0x8304, 0xA368, 0xA368, 0xABC6, 0xABC5, 0x7AE5, 0x18C2, 0x0842, 0x0022, 0x18E6, 0x6B30, 0x8BF3, 0x4A0B, 0x1843, 0x4165, 
-0xBCF3, 0xFE99, 0xAC10, 0x4965, 0x49A5, 0x6AC8, 0x9349, 0xABC8, 0x9B69, 0x8B8D, 0xBD54, 0xEEBA, 0xFF5C, 0xFF5C, 0xFF7B, 0xF75B, 
-0xF75A, 0xF77B, 0xEF7B, 0xF77B, 0xFF7C, 0xFF5C, 0xF6BB, 0xD576, 0xCD14, 0xE638, 0xFF7C, 0xFF7C, 0xF77B, 0xFF9B, 0xFF7C, 0xCD55, 
-0x6A09, 0x5125, 0x7209, 0x71C7, 0x58E4, 0x6124, 0x79C7, 0x8A48, 0x8248, 0x79C6, 0x6145, 0x50E3, 0x5945, 0x69E7, 0x7208, 0x69C8, 
-0x5925, 0x48C4, 0x5966, 0x936E, 0xBCD2, 0x8B6D, 0x5185, 0x5944, 0x71E7, 0x7A07, 0x81E7, 0x81E7, 0x8208, 0x8228, 0x79E8, 0x6966, 
-0x5903, 0x5923, 0x71A5, 0x7A07, 0x7A07, 0x79E7, 0x79E7, 0x81E7, 0x81E7, 0x7A07, 0x6986, 0x5945, 0x830C, 0xD5F8, 0xFFBE, 0xFFFE, 
-0xDED8, 0x6B8B, 0x8B2B, 0xD3EF, 0xD3EE, 0x8304, 0xA368, 0xA368, 0xA349, 0x9B2A, 0x8322, 0x0861, 0x0021, 0x0001, 0x39C9, 0x9474, 
-0x7B91, 0x28C5, 0x51A7, 0xB4B2, 0xC4F2, 0x9BCE, 0x82C9, 0x7224, 0x9326, 0xCC27, 0xD40D, 0xC40A, 0x72C7, 0xBD75, 0xF71C, 0xD617, 
-0xDE58, 0xF71A, 0xFF9C, 0xFF7B, 0xF77A, 0xF77B, 0xEF7B, 0xF79B, 0xFF9C, 0xFF5C, 0xF69A, 0xE5B7, 0xCD15, 0xD576, 0xF6FB, 0xFF9C, 
-0xFF7B, 0xFF9B, 0xFF9C, 0xF69B, 0x9BD0, 0x5146, 0x5125, 0x5905, 0x50C3, 0x6965, 0x7A07, 0x8227, 0x7A07, 0x7A07, 0x71C6, 0x5924, 
-0x48E3, 0x48E4, 0x5925, 0x69A7, 0x79E8, 0x69A7, 0x6186, 0x5145, 0x4103, 0x4924, 0x61A6, 0x7207, 0x79E7, 0x81E7, 0x8208, 0x7A08, 
-0x71C7, 0x6186, 0x5925, 0x48C3, 0x50E3, 0x6164, 0x71E6, 0x7A07, 0x7A07, 0x7A07, 0x7A07, 0x79E7, 0x79E7, 0x7A07, 0x7A08, 0x4904, 
-0x5186, 0xC576, 0xFFBE, 0xFFDD, 0xFFFD, 0xA532, 0x6AC9, 0xBBAE, 0xD3EE, 0x8303, 0xA368, 0xA368, 0xABC5, 0xABC5, 0x7B03, 0x0841, 
-0x0000, 0x0001, 0x39E9, 0x83D1, 0x5A4B, 0x51C9, 0xAC31, 0xBCB2, 0x82E9, 0x8AE7, 0xCC28, 0xE4A8, 0xECE8, 0xECC8, 0xECC9, 0xB3C8, 
-0x72EA, 0xD658, 0xFFDE, 0xE6B9, 0xDE57, 0xE6B8, 0xF71A, 0xF75B, 0xFF7B, 0xF79B, 0xF79B, 0xF77B, 0xF75C, 0xF6DB, 0xE619, 0xDD77, 
-0xCCF5, 0xC4F4, 0xDE38, 0xFF5C, 0xFF9C, 0xFF7B, 0xFFBD, 0xFF5D, 0xAC72, 0x4105, 0x3862, 0x48E4, 0x6166, 0x79E7, 0x7A07, 0x79E6, 
-0x71E6, 0x7A07, 0x7A07, 0x71E7, 0x5145, 0x40C4, 0x40A4, 0x50E4, 0x5925, 0x6987, 0x69E7, 0x61C7, 0x5985, 0x69E6, 0x7228, 0x7A07, 
-0x79C7, 0x79E7, 0x71C7, 0x6186, 0x5125, 0x48C4, 0x40A3, 0x50E4, 0x6186, 0x71E7, 0x7A07, 0x7A07, 0x79E7, 0x7A07, 0x7A08, 0x7A07, 
-0x7A07, 0x7A28, 0x7A28, 0x48E4, 0x4925, 0xBD14, 0xFF9D, 0xFFDD, 0xFFFD, 0xE739, 0x73AC, 0x6A48, 0xD3EE, 0x7B03, 0xA368, 0xA368, 
-0xA386, 0xDCA5, 0xBC08, 0x10A2, 0x0862, 0x10A3, 0x39E9, 0x526B, 0x49C9, 0xA432, 0xCD15, 0x8B2B, 0xABA8, 0xCBED, 0xE489, 0xE4A8, 
-0xD40D, 0xE4A9, 0xE4A8, 0xA3CD, 0x8BED, 0xE6FA, 0xFF9C, 0xF75B, 0xE6D9, 0xDE98, 0xE698, 0xEED9, 0xF75B, 0xF77B, 0xEF7B, 0xEF3A, 
-0xE6DA, 0xDE38, 0xD556, 0xCCF5, 0xC4B4, 0xBCB3, 0xCDB6, 0xF71B, 0xFF7B, 0xF73A, 0xFF7C, 0xFF3C, 0xA452, 0x4925, 0x40A4, 0x6167, 
-0x7A28, 0x8249, 0x8228, 0x7A27, 0x7A27, 0x7A27, 0x7A27, 0x7A69, 0x6A08, 0x5166, 0x4905, 0x50E4, 0x5105, 0x5905, 0x6166, 0x7208, 
-0x7A48, 0x7A69, 0x8249, 0x8228, 0x8208, 0x8208, 0x69A6, 0x5125, 0x48E4, 0x48E4, 0x5125, 0x6187, 0x7208, 0x7A48, 0x8248, 0x7A27, 
-0x7A27, 0x8248, 0x8248, 0x7A48, 0x7A28, 0x7A28, 0x7A28, 0x5125, 0x5986, 0xB4B3, 0xEEFA, 0xF77B, 0xF7BB, 0xFFBC, 0x9CB0, 0x4165, 
-0xD3EE, 0xB3AA, 0xC3CC, 0x9B67, 0xA349, 0xAB89, 0xA3C3, 0xC407, 0x7B03, 0x8342, 0x8323, 0x8323, 0x8342, 0x8323, 0x8323, 0x8342, 
-0x8323, 0x7AC5, 0x8323, 0x8323, 0x7AE5, 0x8323, 0x8323, 0x7AE5, 0x8323, 0x8323, 0x7AC5, 0x8323, 0x8323, 0x7AE5, 0x7AE4, 0x7AE4, 
-0x8304, 0x8304, 0x7AE5, 0x8304, 0x8304, 0x7AE5, 0x8304, 0x8304, 0x7AE5, 0x8304, 0x8304, 0x7AE5, 0x8323, 0x7B04, 0x7AE5, 0x8323, 
-0x7B04, 0x7AE4, 0x8303, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 
-0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 
-0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 0x8304, 
-0x8304, 0x8304, 0x8304, 0x7B03, 0xB3AA, 0x9346, 0xAB89, 0xA368, 0xA367, 0xB38C, 0xABA8, 0xCC48, 0xA349, 0xA349, 0xA369, 0xA368, 
-0xA369, 0xA369, 0xA368, 0xA349, 0xA369, 0xA368, 0xA369, 0xA369, 0xA368, 0xA369, 0xA369, 0xA368, 0xA369, 0xA369, 0xA368, 0xA369, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xC3CC, 0xAB89, 0xBBAB, 0x9B67, 0x8324, 0xA367, 0xA368, 0x9B48, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 
-0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0xA368, 0x9B67, 0xA368, 0xA368, 0x8324, 
-};
\ No newline at end of file
@@ -1,1925 +0,0 @@
-// jungle_background.png
-// Size: 240x128 (61440 bytes)
-const uint16_t jungle_background_bmp[30720] = {
-0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC40E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCCB0, 0xCC6F, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC8F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC8F, 0xCCB0, 0xCC8F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC6F, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xCC4F, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC4F, 0xC3ED, 0xC3ED, 0xC44E, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCC8F, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC8F, 0xCCB0, 0xCC8F, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC6F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC8F, 0xCCB0, 0xCC8F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xCC4E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 
-0xCC8F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCCB0, 0xCCB0, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC40D, 0xC40E, 0xC42E, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC8F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC8F, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC8F, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC44E, 0xCC4F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC40D, 0xC42E, 0xCC4E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC8F, 
-0xCCB0, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 
-0xC44E, 0xC40D, 0xC3ED, 0xC40E, 0xCC90, 0xCC90, 0xC44E, 0xCC4F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC3ED, 0xC3ED, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC6F, 0xC40D, 0xC3ED, 0xC40D, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC8F, 0xCCB0, 0xCC6F, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC3ED, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xC44E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC8F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xC42E, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC8F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC8F, 0xCC6F, 0xCC6F, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCCB0, 0xCC8F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC6F, 0xCC6F, 0xCC6F, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC4F, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCC6F, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0x3944, 0x1882, 0x20C2, 0x20C2, 0x20C2, 0x20C2, 0x20A2, 0x20A2, 0x20A2, 
-0x1061, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 0xCCB0, 0xCCB0, 0xCCB0, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC3ED, 0xC40D, 0xC44E, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 
-0xCC4F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC8F, 0xCCB0, 0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0xC44E, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC3ED, 0xC3ED, 0xCC6F, 0xCC90, 0xC42E, 0xC3ED, 0xC40E, 0xC44E, 0xCC4F, 0xC44E, 0xC40D, 0xC40D, 0xC40E, 0xC44E, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC8F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC8F, 0xC46F, 0xB40E, 0xBC2E, 0xBC2E, 0x2103, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 
-0x18C2, 0x2103, 0xB3AC, 0xB3CC, 0xABAC, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC4F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC3ED, 0xC40D, 0xC40D, 0xC42E, 0xCC8F, 0xCC90, 0xCC6F, 0xCC8F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC42E, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xC44E, 0xC3ED, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4F, 
-0xC40D, 0xC40D, 0xCC4F, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC8F, 0xCCB0, 0xCC8F, 0xC42E, 0xC3ED, 0xC42E, 0xCC90, 0xCC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 
-0xCC8F, 0xCC90, 0xCC90, 0x936B, 0x0000, 0x0820, 0x0820, 0xC5F2, 0xEF57, 0xF7B9, 0xF799, 0xF7B9, 0xF7B9, 0xF7B9, 0xF7B9, 0xF7B9, 
-0xFFDB, 0xCE76, 0x0820, 0x0820, 0x0000, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC3ED, 0xC42E, 0xCC90, 0xCC90, 0xCC4F, 0xC40E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC8F, 0xCC6F, 
-0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC40D, 0xC3ED, 0xC44E, 0xCC90, 0xCCB0, 
-0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC8F, 0xCC6F, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC3ED, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 
-0xCC6F, 0xCC6F, 0xCC4E, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 0xCCB0, 0xCC6F, 0xC40E, 0xC3EC, 0xC40E, 0xCC8F, 0xCC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 
-0xCC90, 0xC46F, 0xA3AD, 0x936C, 0x39E6, 0x3185, 0x31A5, 0xD694, 0xF798, 0xFFF9, 0xFFF9, 0xFFF9, 0xFFF9, 0xFFF9, 0xFFF9, 0xFFF9, 
-0xFFFA, 0xE716, 0x31A5, 0x39C5, 0x4227, 0x7288, 0x9B4B, 0xBBED, 0xC40D, 0xCC4E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC42E, 0xCC6F, 0xCCB0, 0xCC90, 0xC44E, 0xC3ED, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC8F, 0xCCB0, 0xCC90, 
-0xCCB0, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC42E, 0xCC6F, 0xCC6F, 0xCC4F, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCCB0, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCB0, 0xC44E, 0xC3EC, 0xC3ED, 0xC42E, 0xCC4F, 0xCC8F, 0xCC90, 0xCC8F, 0xCC4F, 0xC44E, 0xCC4F, 0xCC90, 0xCC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x6A47, 0x3944, 0x1881, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x5AE9, 0xFFDB, 0xFFD8, 0xFFD9, 0xFFF9, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 
-0xFFB8, 0xFFF9, 0xFFFC, 0xFFFC, 0xFFFF, 0x738C, 0x0000, 0xA34B, 0xC3ED, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC42E, 0xCC8F, 0xCCB0, 0xCC90, 0xCC90, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCC90, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 
-0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC6F, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC4F, 0xC40D, 0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x0840, 0x0000, 0x18E2, 0x5AA8, 0x738B, 0x738B, 0x738B, 
-0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 
-0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 
-0x738B, 0x6309, 0x0000, 0x632A, 0xFFD8, 0xEF57, 0xF797, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 
-0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFFC, 0x632A, 0x0000, 0xAB8C, 0xC40D, 0xCC4F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xCC6F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCC8F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC8F, 
-0xCC6F, 0xCC6F, 0xCC6F, 0xCC6F, 0xCC6F, 0xC42E, 0xC40D, 0xCC6F, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC8F, 0xCC8F, 0xC42E, 0xC3ED, 0xC3ED, 0xC42E, 0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC8F, 0xCC6F, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x0000, 0x39C5, 0xB571, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xDED5, 0x0000, 0x52A8, 0xFFFA, 0xFFB8, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 
-0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFFD, 0x4A68, 0x0000, 0xBC2E, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC4F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC8F, 0xC42E, 0xC40D, 0xC40D, 0xC3ED, 0xCC4F, 0xCC8F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 0xCCB0, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xC44E, 0xC40E, 0xCC6F, 0xCCB0, 0xCC8F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCCB0, 0xCC6F, 0xC44E, 0xC44E, 0xCC90, 0xCCB0, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x0000, 0x738B, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0x738B, 0x6B4A, 0x9CCF, 0xBDB2, 0xF797, 0xF797, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 
-0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF9, 0xCE34, 0xAD51, 0x6248, 0x6248, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCC8F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCCB0, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4F, 0xC40D, 0xC3ED, 0xC40D, 0xC42E, 
-0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xCC4F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0000, 0x738B, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0x0000, 0x31A5, 0xFFDA, 0xEF57, 0xE6F5, 0xF798, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 
-0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFB8, 0xFFFA, 0xFFFE, 0x31A5, 0x0000, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC8F, 0xCC8F, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC8F, 0xCC8F, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCCB0, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC8F, 0xCCB0, 0xCC90, 
-0xCC90, 0xC44E, 0xC3ED, 0xC3ED, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC6F, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 
-0xCC4E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC8F, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1881, 0x18E2, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0x0841, 0x3164, 0xEF37, 0xE716, 0xFFD8, 0xFFF9, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFF9, 0xFFB8, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFFA, 
-0xFFFA, 0xFFFA, 0xFFFA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFFB, 0x2964, 0x0840, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC8F, 0xCCB0, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCCB0, 0xCC4F, 0xC3ED, 0xC40D, 0xCC4F, 0xCCB0, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCCB0, 0xCC6F, 0xC40D, 0xC3ED, 0xC40E, 0xC44E, 0xCC6F, 0xCC90, 
-0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC3ED, 0xC42E, 0xCC6F, 0xCCB0, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xCC4E, 0xCCB0, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0000, 0xB571, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0x0861, 0x3164, 0xEF57, 0xEF36, 0xFFF9, 0xEF57, 0xDED6, 0xDED6, 0xDED6, 0xDED6, 0xE737, 0xFFF9, 0xFFD8, 0xFFF8, 0xE737, 0xDED6, 
-0xDED6, 0xDED6, 0xDEB6, 0xEF57, 0xFFF9, 0xFFD8, 0xFFFB, 0x2964, 0x0840, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCCB0, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCCB0, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC3ED, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4F, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xCC6F, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3944, 0x18E2, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0x0861, 0x3185, 0xFFB8, 0xFFD8, 0xFFFF, 0x630A, 0x0000, 0x0840, 0x0840, 0x0000, 0x4A47, 0xFFFC, 0xF797, 0xFFF9, 0x4206, 0x0000, 
-0x0840, 0x0840, 0x0000, 0x6B4A, 0xFFFF, 0xFFF9, 0xFFFB, 0x2964, 0x0840, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC40E, 0xC3EC, 0xC40D, 0xCC6F, 0xCCB0, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC44E, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCCB0, 0xCC90, 0xCC8F, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC6F, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 0xCC90, 0xCC8F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20C2, 0x4A47, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0x0861, 0x3185, 0xFFDA, 0xD694, 0xBDD4, 0x39E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A47, 0xFFFD, 0xF777, 0xFFD9, 0x39E6, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x4207, 0xBDD3, 0xE6F6, 0xFFFC, 0x2964, 0x0840, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC4F, 0xC44E, 0xCC4F, 0xCC8F, 0xCCB0, 0xCC8F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC4F, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xCC4F, 0xC42E, 0xC3ED, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCCB0, 0xCC6F, 0xC40D, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC8F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC8F, 0xCCB0, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0000, 0x738B, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0x0861, 0x3184, 0xFFFD, 0x83EC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A67, 0xFFFD, 0xEF36, 0xEF57, 0x39E6, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x946E, 0xFFFE, 0x2964, 0x0840, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0000, 0x738B, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0x0861, 0x3184, 0xFFFC, 0x8C4D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A67, 0xFFFD, 0xEF36, 0xF777, 0x39E6, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CCF, 0xFFFE, 0x2964, 0x0820, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC3ED, 0xC3ED, 0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xCC4F, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1881, 0x5AA8, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0x0861, 0x3184, 0xFFFD, 0x83EC, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x31A5, 0xFFFE, 0xEF36, 0xEF57, 0x2944, 0x0000, 
-0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x8C6E, 0xFFFE, 0x2964, 0x0840, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xCC8F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC3ED, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xC44E, 0xCC4F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC4F, 0xC42E, 0xC40D, 0xC3ED, 0xCC4E, 0xCCB0, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3944, 0x18E2, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0x0861, 0x3184, 0xF798, 0xCE74, 0xC634, 0x41E6, 0x0000, 0x0000, 0x10A2, 0xB5B2, 0xD674, 0xFFB8, 0xF798, 0xFFF9, 0xBDB2, 0x9CAE, 
-0x1081, 0x0000, 0x0000, 0x4226, 0xC613, 0xE716, 0xFFFC, 0x2964, 0x0840, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC42E, 0xC40D, 
-0xC3ED, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC4F, 0xC40D, 0xC40D, 0xCC4F, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x0000, 0xB571, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0x0841, 0x3164, 0xE716, 0xF777, 0xFFFF, 0x5AEA, 0x0000, 0x0000, 0x2103, 0xFFFD, 0xFFFB, 0xEF36, 0xF799, 0xFFDB, 0xF7B8, 0xEF78, 
-0x18C2, 0x0020, 0x0000, 0x6B2A, 0xFFFF, 0xFFF9, 0xFFFB, 0x2964, 0x0841, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCC6F, 0xC40D, 
-0xC3ED, 0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC6F, 0xCC6F, 0xCC8F, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x0840, 0x39C5, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0x0020, 0x31A5, 0xFFFB, 0xFFD9, 0xFFFB, 0xF799, 0xDED6, 0xDEF6, 0xE716, 0xFFD9, 0xAD50, 0x0840, 0x18E2, 0x1081, 0xB5B2, 0xFFFB, 
-0xE717, 0xDEF6, 0xD695, 0xF7B9, 0xFFFD, 0xFFFC, 0xFFFE, 0x31A5, 0x0020, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCC90, 0xCC4F, 
-0xC42E, 0xCC4F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC3ED, 0xC40D, 0xC44E, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x0000, 0x73AB, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0x2103, 0x39E6, 0xBDB2, 0xB571, 0xB591, 0xD694, 0xFFFB, 0xFFFA, 0xFFF9, 0xFFD9, 0xA50F, 0x0000, 0x0000, 0x0000, 0xB592, 0xFFFB, 
-0xFFFA, 0xFFFA, 0xFFFC, 0xCDB2, 0xA40D, 0xA44E, 0xAC6F, 0x3144, 0x18A2, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x0000, 0x73AB, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xCE54, 0x1081, 0x18C2, 0x39C5, 0xAD71, 0xFFFF, 0xFFFA, 0xFFB8, 0xFFD9, 0x9CCF, 0x0000, 0x0000, 0x0000, 0xAD51, 0xFFFB, 
-0xFF97, 0xFFFA, 0xFFFF, 0x9BCD, 0x3103, 0x1061, 0x1061, 0xABAC, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC8F, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x0000, 0x18E2, 0xB571, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xDEB5, 0x39C5, 0x4226, 0x5288, 0xBDB2, 0xAD50, 0xCE54, 0xFFFA, 0xFFF9, 0xC5F2, 0x39E6, 0x52A9, 0x4206, 0xCE54, 0xFFFA, 
-0xFFFA, 0xC592, 0x938C, 0x9B4B, 0x4164, 0x3924, 0x3103, 0xB3CC, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x1881, 0x0000, 0x18E2, 0x4A47, 0x738B, 0x738B, 0x738B, 
-0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 
-0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 
-0x738B, 0x738B, 0x738B, 0x738B, 0x738B, 0x3184, 0x18E2, 0x7BEC, 0xFFFB, 0xFFFD, 0xFFFC, 0xFFFC, 0xFFFC, 0xFFFD, 0xFFFC, 0xFFFC, 
-0xFFFD, 0xA42E, 0x28E3, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC40D, 0xC40E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x3944, 0x20C2, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52A8, 0xEF78, 0x5AC9, 0x94AF, 0xFFFA, 0xF797, 0xF797, 0x8C6E, 0x5AEA, 
-0xFFBB, 0xB4AF, 0x1041, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC3ED, 0xC44E, 0xCC6F, 0xC40D, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC6F, 0xCC6F, 0xCC6F, 0xC40D, 0xC3ED, 0x3103, 0x1061, 0xB4AF, 0xE718, 0x0000, 0x39E6, 0xFFFF, 0xFFD9, 0xFFFA, 0x2964, 0x0000, 
-0xF79C, 0xBD11, 0x0841, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xCC8F, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC42E, 0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCCB0, 0xCC90, 0xCC4F, 0xC44E, 0xB3ED, 0xB3CD, 0x41C5, 0x31A5, 0x0000, 0x1081, 0x4207, 0x31A5, 0x39C5, 0x0861, 0x0000, 
-0x39C6, 0x41E6, 0xABAC, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC4F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0x18A2, 0x0020, 0x0841, 0x0820, 0x0820, 0x0820, 0x0840, 0x0820, 0x0841, 
-0x0000, 0x20A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC6F, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 
-0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC40D, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC8F, 
-0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC40D, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC8F, 
-0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC8F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC3ED, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC4F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4F, 0xC40D, 0xC40D, 0xCC4F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC6F, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC8F, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC40D, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC40D, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC8F, 
-0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC40D, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC8F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC6F, 0xCC6F, 0xCC6F, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC42E, 0xC42E, 0xC40D, 0xC42E, 0xCC90, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC4F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC8F, 0xCC90, 0xCCB0, 
-0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC4E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCB1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCB1, 0xCCD1, 0xCCD1, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCB0, 0xCCD1, 0xD4F1, 0xD4F1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCC90, 
-0xCCD1, 0xD4F2, 0xD4D1, 0xD4F1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F2, 0xCCD1, 0xCC90, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC8F, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F1, 0xCCD1, 0xCCB0, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xCC4F, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC8F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC3ED, 0xCC4E, 0xCCB0, 0xCC8F, 0xCCB0, 0xCC90, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 
-0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC4F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC90, 
-0xCCD1, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xD4F1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC4F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB1, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCCB1, 0xD512, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC4F, 0xCCD1, 0xCCB1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xD4F1, 0xD4F1, 0xD4D1, 0xD4D1, 
-0xD4D1, 0xD4D1, 0xD4D1, 0xD4F1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xD4F1, 0xCC90, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC6F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCB0, 0xCC90, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xCC8F, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4D1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xCC90, 0xD4D1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC8F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCB1, 0xCC90, 0xCC6F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCB0, 0xCC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xD4F1, 0xD4F1, 0xCCD1, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCC6F, 
-0xC44E, 0xCC4E, 0xCC4E, 0xC44E, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xD4D1, 0xD4F1, 0xCCB0, 0xCC6F, 0xCC8F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCB1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xD4F1, 0xD4D1, 0xD4D1, 0xD4D1, 0xD4D1, 
-0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F2, 0xD4F1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F2, 0xD4F1, 0xCCB0, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC8F, 0xCC8F, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCB0, 0xC42E, 0xC3EC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xD4F2, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xD4D1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 
-0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC6F, 0xCC90, 0xCCD1, 0xCC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40E, 0xCC90, 0xCCD1, 0xCCB0, 0xCCB0, 0xCCB1, 0xCC90, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xD4F1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCB1, 0xC44E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCB1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xD4F1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xD4D1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 
-0xCC90, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB1, 0xD4F2, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCB0, 0xCCD1, 0xCC90, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB1, 0xD4F1, 0xD4F1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCCB0, 0xD4F1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC4F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC90, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCD1, 0xD4F2, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xD4F1, 0xD512, 0xCCD1, 0xC42E, 0xC3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCC90, 0xCCB0, 0xCCB0, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCC90, 0xCC6F, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xD4D1, 0xD4D1, 0xD4D1, 
-0xD4D1, 0xD4D1, 0xD4D1, 0xD4D1, 0xD4D1, 0xD4D1, 0xD4D1, 0xD4D1, 0xD4D1, 0xD4D1, 0xD4D1, 0xD4F2, 0xCCB0, 0xC42D, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCD1, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC4F, 0xCCB0, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC4F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC90, 0xCCD1, 
-0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xD4F1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xD4F1, 0xCCB1, 0xC44E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xCC6F, 0xD4F2, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F2, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCD1, 0xCC90, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xD4F1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xCC6F, 0xD4F2, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F2, 0xD4D1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F1, 0xCCD1, 
-0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xD512, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC90, 
-0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4D1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCD1, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F2, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F2, 0xCCD1, 
-0xCC90, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB1, 
-0xCCD1, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCB0, 0xCC8F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB1, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCC90, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F2, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F1, 0xCCB1, 
-0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB0, 0xC42E, 0xC3EC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB1, 
-0xCCD1, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD512, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xCCD1, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 
-0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F2, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCD1, 0xCC8F, 0xCC6F, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB1, 
-0xD4D1, 0xCCB0, 0xCC90, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC90, 0xCC6F, 0xC44E, 0xCC4E, 0xCC4E, 0xCC4E, 0xCC4E, 0xC44E, 
-0xCC4F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC8F, 
-0xCC8F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCC8F, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCF1, 0xD4F2, 0xCC8F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC90, 0xD4D1, 0xCC8F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCB0, 0xCC90, 0xCC6F, 
-0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC6F, 0xCCB0, 0xD4F1, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 
-0xCCB0, 0xCC4F, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCF1, 0xD512, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC4F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xCC90, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCD1, 0xCC90, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F2, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xD4F2, 0xCCB0, 0xC42E, 0xC3EC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC8F, 0xCC8F, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB1, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCD1, 0xCC90, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F2, 0xCCB1, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCD1, 0xCC8F, 0xCC6F, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F1, 0xCCD1, 0xCCD1, 0xD4F1, 0xD4F2, 0xD4F2, 0xD512, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC8F, 0xCC8F, 
-0xCC8F, 0xCC8F, 0xCC90, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB0, 0xC42D, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCD1, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC4E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F2, 0xD4D1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC8F, 0xCC90, 0xCCB0, 0xCCD1, 0xD4F1, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCF1, 0xD512, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB1, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCB0, 0xCCD1, 0xCC90, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xD4F2, 0xCCB1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCD1, 
-0xD512, 0xD4F2, 0xD4F2, 0xCC90, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCB1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC90, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCB1, 
-0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC8F, 0xCC6F, 0xCC8F, 0xC42E, 0xC3ED, 0xC3ED, 0xC3ED, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 
-0xCC4F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F2, 0xD4D1, 
-0xD4D1, 0xD4D1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 
-0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 
-0xCC8F, 0xCC6F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 
-0xCCB1, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC8F, 0xCCB0, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCF1, 0xD4F2, 0xCC8F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCB0, 0xCCD1, 0xD4F1, 
-0xD4F1, 0xD4D1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCC8F, 0xCC8F, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xD4F1, 0xCC6F, 0xC3EC, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC42E, 0xCC6F, 0xCCB0, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xD4D1, 0xCCB0, 0xCC6F, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xD4D1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC3ED, 0xCC4F, 0xCCB1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC6F, 0xCCB0, 0xD4F2, 0xCCB1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3EC, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xCC6F, 0xD4F2, 0xD4F2, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC8F, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC3ED, 0xCC6F, 0xD4F2, 0xD4F1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC6F, 0xCCB0, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F2, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xD4F2, 0xD4F2, 0xCC6F, 0xC3EC, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 0xCC90, 0xCC4F, 0xC44E, 0xCC4E, 0xCC4E, 0xC44E, 0xC44E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F2, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC4F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC8F, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCC90, 0xC40E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F2, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC4F, 0xCCB1, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCD1, 0xCC4F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC90, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xD4F2, 0xD4F2, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC3ED, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 
-0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC40D, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xD4F2, 0xD4F2, 0xCCB1, 0xC44F, 0xC40E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCF1, 0xD4F2, 0xCC6F, 0xC3EC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCB0, 0xD4D1, 0xCCB1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40E, 0xCC90, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 
-0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC8F, 0xC40E, 0xC40E, 0xCC90, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3EC, 0xC40E, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 
-0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3CC, 0xC3CC, 0xCC90, 0xD4D1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC6F, 0xCC90, 0xCCD1, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCD1, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 
-0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F1, 0xCCD1, 0xD4F2, 0xCCD1, 0xCC4F, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC3ED, 0xCC6F, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCD1, 
-0xD512, 0xCCF1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 
-0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB1, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCC4F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB1, 
-0xD4F2, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC90, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 
-0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCD1, 
-0xD512, 0xCCD1, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xC44F, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3EC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3CC, 0xCC4F, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 
-0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC4F, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F2, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCD1, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xCC90, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB1, 
-0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCCB1, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCC90, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xC44E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xD4F1, 0xD4F1, 0xD512, 0xCCD1, 
-0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC8F, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xD4D1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xD4F2, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB1, 0xC44F, 0xC40E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC6F, 0xCC8F, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xD4F1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3EC, 0xC42E, 0xCCD1, 0xD512, 0xD4F2, 0xD4F2, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC6F, 0xCC6F, 0xCC8F, 0xCC6F, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC90, 0xCCD1, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCF1, 0xD4F2, 0xCC8F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xCC4E, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCD1, 0xD4D1, 0xCCB0, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3EC, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC6F, 0xCC8F, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCCD1, 0xD4D1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCD1, 0xD4F2, 0xCC90, 0xC40E, 0xC40E, 0xCC90, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3EC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F2, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC6F, 0xCC8F, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCCB0, 0xCCD1, 0xD4D1, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xD4F2, 0xD4F2, 0xD4F2, 0xD4F2, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCD1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC3ED, 0xCC90, 0xD512, 0xCC90, 0xC42E, 0xC3EC, 0xC3CC, 0xCC4F, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xC44F, 0xC40D, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCCD1, 0xD4F2, 0xD4F2, 0xD4D1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCCB0, 0xCCD1, 0xD4D1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB1, 0xCCB0, 0xCCB0, 0xCCB0, 0xD4F1, 0xCCB1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40E, 0xCC90, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 0xCC4F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC8F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC6F, 0xCC6F, 0xCC6F, 0xCC90, 0xCCB1, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCCB0, 0xCCD1, 0xD4F1, 
-0xCC4F, 0xCCB1, 0xD4F1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB1, 0xCC4E, 0xC42E, 0xC42E, 0xC42E, 0xCCB0, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC40D, 0xC3EC, 0xC40D, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xD4F2, 0xD4F2, 0xCCD1, 0xCC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xD512, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCD1, 0xCC90, 0xCC4E, 0xC40E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xCC90, 0xD4F2, 0xD4D1, 
-0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCCB0, 0xD4F1, 0xD4F2, 
-0xC40E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB0, 0xC40D, 0xBBCC, 0xC3EC, 0xC3ED, 0xC44E, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC42E, 0xCC90, 0xCCD1, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC4F, 0xCC90, 0xD4F2, 0xCC90, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC6F, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC4F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC4F, 0xC3ED, 0xC3ED, 0xC3ED, 0xC3ED, 0xC3ED, 0xC42E, 0xCC90, 0xCCD1, 
-0xD4F1, 0xD4F1, 0xD4F2, 0xCC8F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4E, 0xCC90, 0xCC6F, 0xCC6F, 
-0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCB1, 0xC44E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xCC6F, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB0, 0xC42E, 0xC3CC, 0xC42E, 0xCCD1, 0xCC90, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB0, 0xC42E, 0xC3EC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F1, 0xCCD1, 0xCCD1, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCC6F, 0xC40D, 0xC3ED, 
-0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCD1, 0xCC90, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xD4F2, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xCC6F, 0xD4F2, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB0, 0xC42E, 0xC3CC, 0xC42E, 0xCCD1, 0xCC90, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB0, 0xC40D, 0xC3EC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCC90, 
-0xCCD1, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCC6F, 0xC42E, 0xC3ED, 
-0xCC90, 0xCCD1, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xD4F2, 0xD4D1, 0xCC90, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCD1, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC6F, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xCCB1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 
-0xCCD1, 0xCC90, 0xCC6F, 0xCC8F, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC4E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCD1, 0xCC90, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xD4F2, 0xD4F2, 0xD4D1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC4F, 0xC42E, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCB0, 0xC42E, 0xC40D, 
-0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xD4F2, 0xCC8F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCC90, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3EC, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB0, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC8F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCB0, 0xCCB0, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCCD1, 0xC42E, 0xC3ED, 
-0xD4F2, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xD4F2, 0xD512, 0xCC8F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3EC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC90, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xD4F2, 0xD4F1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC8F, 0xCCB0, 0xD4F2, 0xD4F2, 0xCC90, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xD4F2, 0xD4F1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xD4F2, 0xD4F1, 0xD4D1, 0xCCD1, 0xD4D1, 0xCCD1, 0xCC90, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xCC4F, 0xCCB1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xD4F1, 0xCC8F, 0xC40E, 0xC40E, 0xCC90, 0xD4F2, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xD4D1, 0xC42E, 0xC3ED, 
-0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC6F, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xC44F, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC4F, 0xCC90, 0xCCD1, 0xD4F1, 
-0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC8F, 0xCCB0, 0xCCB1, 0xCCD1, 0xC44E, 0xC3EC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC6F, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC6F, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC4F, 0xCCD1, 0xD4F1, 0xCC90, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 
-0xD512, 0xCC6F, 0xC3CC, 0xC3EC, 0xC42E, 0xCC90, 0xD4F1, 0xCCD1, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCC6F, 0xC42E, 0xC40D, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3EC, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xD4F2, 0xCCB0, 0xC42E, 0xC3CC, 0xC42E, 0xCCB0, 0xD4F2, 
-0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3EC, 0xC3EC, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3EC, 0xC3EC, 0xCC6F, 0xD4F1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCD1, 0xD4F2, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB1, 
-0xCCD1, 0xCC6F, 0xC42E, 0xC40D, 0xC3ED, 0xC40D, 0xCC90, 0xD4F2, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xD4F2, 0xD4F2, 0xCCD1, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F1, 0xCCD1, 0xD4F2, 0xCCB0, 0xC42E, 0xC3CC, 0xC42E, 0xCCB0, 0xD4F2, 
-0xCCD1, 0xCC90, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC3ED, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC3ED, 0xCC6F, 0xD4F1, 0xCCD1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCCB1, 0xD4F2, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xD4F1, 0xCC8F, 0xC40E, 
-0xC42E, 0xCC90, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC42E, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCCD1, 0xCCB1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xD4F2, 0xD4F1, 0xCCD1, 0xCC90, 0xCC8F, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC4F, 0xCC90, 0xD512, 0xCC90, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xD4F2, 0xD4D1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3EC, 0xC42E, 0xCCD1, 0xD512, 
-0xD4F1, 0xCCB0, 0xCCB0, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC8F, 0xC40E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC3ED, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC3ED, 0xCC6F, 0xD4F2, 0xD4D1, 0xD4F1, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xD4F1, 0xD4F2, 0xD512, 0xCC6F, 0xC3CC, 
-0xC3EC, 0xCC4F, 0xCC90, 0xC42E, 0xC40D, 0xC40D, 0xC3ED, 0xC3ED, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xCC6F, 0xCCB0, 0xCCF1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCB0, 0xCCD1, 0xCCD1, 0xCC90, 0xCC6F, 
-0xCC6F, 0xCC6F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC90, 
-0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB0, 0xC42E, 0xC3CC, 0xC42E, 0xCCB0, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB1, 0xC42E, 0xC3EC, 0xC42E, 0xCC90, 0xCCD1, 
-0xCCB1, 0xCCD1, 0xD4F1, 0xCCD1, 0xCC8F, 0xCC6F, 0xCC6F, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC3ED, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xCC4F, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xCC6F, 0xCC6F, 0xCC90, 0xCC8F, 0xCC90, 0xCCD1, 0xCCD1, 0xCCB1, 0xCCD1, 0xCC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xC40D, 0xCC90, 0xD4F2, 0xD4D1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F2, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC8F, 0xC40E, 0xC40E, 0xCC90, 0xD4F1, 0xCCB0, 0xCC4F, 
-0xC40D, 0xC40D, 0xCC4F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCB0, 0xC40D, 0xC3EC, 0xC40D, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCD1, 0xD512, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 0xC42E, 0xC42E, 
-0xCC4E, 0xCCB1, 0xD4F2, 0xCCB1, 0xC44E, 0xC40D, 0xC42E, 0xCC6F, 0xCC90, 0xCC90, 0xCC8F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xD4F2, 0xD4D1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC3ED, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xD4F1, 0xD4F1, 0xD4F2, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xCC4F, 0xCCB1, 0xD4F2, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC42E, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCC90, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC3ED, 0xC42E, 0xCC90, 0xCCD1, 0xD4F2, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC90, 0xCCD1, 0xD4D1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F1, 0xD4F2, 0xCC6F, 0xC3CC, 0xC3EC, 0xCC6F, 0xCCD1, 0xCC6F, 0xC42E, 
-0xC3ED, 0xC3ED, 0xCC4E, 0xCC90, 0xCC6F, 0xC44E, 0xCC4F, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC4F, 0xC42E, 0xCC6F, 
-0xCCB1, 0xD4F1, 0xCCD1, 0xCCD1, 0xD4F1, 0xCCD1, 0xCC90, 0xC42E, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC3ED, 0xC3EC, 
-0xC40E, 0xCCB0, 0xD512, 0xCCB0, 0xC42E, 0xC3CC, 0xC40D, 0xCC8F, 0xCCB0, 0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC90, 0xCCD1, 0xD4F2, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC3ED, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xD4F2, 0xD4F2, 0xD4F2, 
-0xCCB1, 0xCC90, 0xCC6F, 0xCC6F, 0xCC8F, 0xC44E, 0xC40D, 0xC40D, 0xC3EC, 0xC42E, 0xCCD1, 0xD512, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC3ED, 0xCC6F, 0xD512, 0xD4D1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC8F, 0xCC4F, 0xC44E, 
-0xCC4F, 0xCC8F, 0xCCB0, 0xCC6F, 0xC40D, 0xC3EC, 0xC40D, 0xC42E, 0xCC6F, 0xCCB0, 0xD4F2, 0xCC6F, 0xC3EC, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC90, 0xD4D1, 0xCCD1, 0xD4F1, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCC6F, 0xC3ED, 0xC40D, 0xCC4E, 0xCC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCC6F, 0xC40D, 0xC3ED, 0xC40E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC40D, 0xC3EC, 0xC42E, 
-0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0xC42E, 0xCCB1, 0xD512, 0xCCB1, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCC8F, 0xCC8F, 0xCC90, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC40D, 0xCC90, 0xD4D1, 0xD4D1, 0xD4F2, 0xCC6F, 0xC3ED, 0xC3ED, 0xCC6F, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCB0, 0xD4F1, 
-0xCCB0, 0xC42E, 0xC3EC, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCC90, 0xD4F2, 0xCCB1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40E, 0xCC90, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC40E, 0xC3ED, 
-0xC40E, 0xCC6F, 0xCCB0, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCC90, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC3ED, 0xC3ED, 0xC40D, 0xC40D, 0xCC90, 0xD4F1, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xCCB0, 0xD4F1, 0xCCD1, 0xD4F2, 0xCCD1, 0xCC90, 0xCCB0, 0xCC4F, 0xC40D, 0xC40D, 0xC40E, 0xC42E, 0xC40D, 0xC40D, 
-0xC42E, 0xCC6F, 0xCC4F, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC6F, 0xCC90, 0xCC90, 0xCCB0, 0xCC6F, 0xC40D, 0xC40D, 0xC3ED, 0xC42E, 
-0xCCB0, 0xD4F2, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCC6F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0xC42E, 0xCCD1, 0xD512, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 0xC42E, 0xC40D, 0xC42E, 0xCC90, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xD512, 0xD512, 0xCC6F, 0xC3ED, 0xC3ED, 0xCC6F, 0xD4F2, 0xD4F2, 0xCC8F, 0xC40E, 0xC40E, 0xCCB0, 
-0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xCC90, 0xCCD1, 0xD4F1, 0xD4D1, 0xD4F1, 0xCCD1, 0xCC90, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC42E, 0xC3ED, 
-0xC42E, 0xCC8F, 0xCCB0, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xCC6F, 0xC44E, 0xC3ED, 0xC3EC, 0xCC6F, 0xD512, 0xD512, 0xCC8F, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xCCD1, 0xD512, 0xCCD1, 0xCC90, 0xCC4E, 0xCC4E, 0xCC8F, 0xCC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC90, 0xCC4F, 0xC3ED, 0xC40D, 0xC42E, 0xCC4F, 0xCC8F, 0xCC90, 0xCC8F, 0xCC6F, 0xC42E, 0xC3ED, 0xC3ED, 0xC40D, 0xCC6F, 
-0xCCD1, 0xD4F2, 0xD4F1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4D1, 0xCCB0, 0xCC4F, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC6F, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC3ED, 0xC42E, 0xCC8F, 0xCC90, 0xC44E, 0xC40D, 0xC3ED, 0xCC6F, 0xD512, 0xD4F2, 0xC44F, 0xC3CC, 0xC3EC, 0xC44E, 
-0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xCC90, 0xD4D1, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xD4D1, 0xD4F2, 0xCCB0, 0xCCB1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC8F, 0xC42E, 0xC3ED, 
-0xC40E, 0xC44E, 0xCC4F, 0xCC4F, 0xCC6F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xD4F2, 0xD512, 0xCC8F, 0xC3ED, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xCC90, 0xD4F2, 0xCCB0, 0xC42E, 0xC3CC, 0xC42E, 0xCC8F, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC8F, 0xCC6F, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCC90, 0xCC90, 0xCC6F, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xCC6F, 0xCCB0, 
-0xCCB0, 0xCCB0, 0xCCB1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xD4F2, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCD1, 0xD4F1, 0xCC90, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC42E, 0xCCB0, 0xCCB0, 0xCC6F, 0xCC6F, 0xCC6F, 0xCC6F, 0xCC6F, 0xCC6F, 0xCC6F, 0xCC6F, 0xCC8F, 0xCC6F, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xD4F2, 0xD512, 0xCC8F, 0xC3ED, 0xC40D, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCCB0, 0xCCD1, 0xC42E, 0xC3EC, 0xC42E, 0xCC90, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC90, 0xCC6F, 0xC40D, 0xC40D, 0xCC4E, 0xCC90, 0xCC90, 0xCCB0, 0xCC8F, 0xC42E, 0xC3ED, 0xC42E, 0xCC6F, 0xCCB0, 0xCC90, 
-0xC44E, 0xC40D, 0xCC4E, 0xCCB0, 0xD4F2, 0xD4F2, 0xD4F1, 0xD4F2, 0xCCB1, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC4F, 0xCCD1, 0xD512, 0xCCB0, 0xC42E, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC6F, 0xCC8F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC3ED, 0xC44E, 0xCC6F, 0xC42E, 0xC3ED, 0xC42E, 0xCC4E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xCC4E, 0xC42E, 0xC40D, 0xC40D, 0xCC4F, 0xCCB0, 0xCCB0, 0xCC6F, 0xC42E, 0xC40D, 0xC3ED, 0xC42E, 0xCC90, 0xCC90, 0xC42E, 
-0xC40D, 0xC3CC, 0xC42E, 0xCCD1, 0xCCD1, 0xCC6F, 0xCC6F, 0xCCD1, 0xCCD1, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xCC4F, 0xCC90, 0xCC6F, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC3ED, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC8F, 0xCC8F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xCC6F, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC42E, 0xCCB0, 0xCC6F, 0xC3EC, 0xC3ED, 0xCC6F, 0xCCB0, 0xC42E, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-
-};
\ No newline at end of file
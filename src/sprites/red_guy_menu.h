@@ -1,511 +0,0 @@
-// Image size: 58x140 = 8120 bits
-const uint16_t red_guy_menu_bmp[8120] = {
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0xAD75, 0x18A2, 
-0x1061, 0x1061, 0x20E3, 0x20E3, 0x1061, 0x1041, 0x1041, 0x1041, 0x1061, 0x1041, 0x1061, 0x1861, 0x2924, 0x20E3, 0x1882, 0x2924, 
-0x18A2, 0x1882, 0x1862, 0x1061, 0x1041, 0x0820, 0x630C, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x0820, 0x2945, 0x1882, 0x1061, 0x1061, 0x1041, 0x1041, 0x1041, 
-0x1041, 0x0820, 0x1041, 0x0820, 0x1020, 0x1041, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x2924, 0x20E3, 0x1041, 0x1041, 0x1021, 
-0x0820, 0x39C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0x7BEF, 0x2945, 0x1041, 0x1882, 0x1862, 0x1061, 0x1041, 0x1041, 0x1041, 0x1041, 0x1041, 0x1041, 0x2924, 0x1061, 0x1041, 0x1041, 
-0x1861, 0x1061, 0x1021, 0x1061, 0x1061, 0x1862, 0x1882, 0x1061, 0x1041, 0x1041, 0x1041, 0x1061, 0x39A6, 0xF79E, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AEB, 0x0820, 0x1041, 0x1041, 0x1041, 0x2904, 
-0x1882, 0x0820, 0x0800, 0x1021, 0x0820, 0x0820, 0x2945, 0x1041, 0x0820, 0x0820, 0x1020, 0x0800, 0x0800, 0x1041, 0x1041, 0x1020, 
-0x1020, 0x1041, 0x1021, 0x0800, 0x0820, 0x0820, 0x0800, 0x630C, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x52AA, 0x0841, 0x1021, 0x1041, 0x1061, 0x20C3, 0x1061, 0x0820, 0x0800, 0x0820, 0x1021, 0x1041, 
-0x20C3, 0x0841, 0x0820, 0x1041, 0x1021, 0x0820, 0x1021, 0x1061, 0x1041, 0x0820, 0x1021, 0x1041, 0x1020, 0x0820, 0x0820, 0x0820, 
-0x0820, 0x0800, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x18C3, 0x1882, 
-0x0820, 0x1061, 0x1041, 0x1021, 0x1020, 0x0820, 0x0820, 0x0820, 0x1041, 0x1041, 0x0820, 0x0820, 0x1041, 0x1041, 0x1041, 0x0820, 
-0x1861, 0x1041, 0x0820, 0x0800, 0x1020, 0x1041, 0x0800, 0x1021, 0x1041, 0x1020, 0x0820, 0x0800, 0xAD75, 0xEF5D, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x4208, 0x20E3, 0x1882, 0x0820, 0x1861, 0x0820, 0x1041, 0x1861, 0x1861, 
-0x1861, 0x0820, 0x1041, 0x1041, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0800, 0x0800, 0x0820, 
-0x0800, 0x0800, 0x1021, 0x1021, 0x0820, 0x1041, 0x0841, 0x8430, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xDEDB, 0x5ACB, 0x0841, 0x1041, 0x1861, 0x0820, 0x1021, 0x1041, 0x1041, 0x1041, 0x1020, 0x1041, 0x28C2, 0xABAA, 0xBBEA, 
-0xBBEA, 0xBBEA, 0xBBEA, 0xBBEA, 0xAB89, 0x1020, 0x0820, 0x0820, 0x0820, 0x0800, 0x0820, 0x1041, 0x1021, 0x1020, 0x1841, 0x1861, 
-0x0800, 0x8410, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x2104, 0x0820, 0x1061, 0x1861, 
-0x0820, 0x1041, 0x59E5, 0x9308, 0x9308, 0x9308, 0x9308, 0x9B48, 0xECED, 0xF50D, 0xF50D, 0xF50D, 0xF50D, 0xF4ED, 0xECCD, 0x82A7, 
-0x61A3, 0x5983, 0x38E1, 0x0800, 0x0800, 0x1020, 0x0820, 0x0820, 0x1861, 0x0820, 0x0000, 0x8410, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x7BEF, 0x2945, 0x0020, 0x1041, 0x1861, 0x0820, 0x5184, 0xB3AA, 0xF50D, 0xF4ED, 0xF50D, 
-0xF50D, 0xF50D, 0xF50D, 0xF50D, 0xF50D, 0xF50D, 0xF50D, 0xF50D, 0xF4ED, 0xE48C, 0x9285, 0x9264, 0x6183, 0x1041, 0x0820, 0x1041, 
-0x1021, 0x1020, 0x1861, 0x0800, 0x5269, 0xAD75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0x83F0, 0x18C3, 0x0000, 0x1020, 0x1020, 0xCC0B, 0xF4ED, 0xF4ED, 0xF4ED, 0xF4ED, 0xF4ED, 0xF4ED, 0xF50D, 0xF50D, 0xF4ED, 0xF50D, 
-0xF50D, 0xF4ED, 0xF4ED, 0xECAC, 0xA306, 0x9AC5, 0x61C3, 0x1841, 0x0820, 0x1041, 0x1040, 0x0820, 0x1020, 0x0000, 0xE73C, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BCF, 0x0000, 0x0000, 0x0820, 0xCC0B, 
-0xF4ED, 0xF4ED, 0xF4ED, 0xF4ED, 0xF4ED, 0xF50D, 0xF50D, 0xF50D, 0xF50D, 0xF50D, 0xF4ED, 0xF4ED, 0xF4ED, 0xF4ED, 0xF50D, 0xF50D, 
-0x9B28, 0x1841, 0x1861, 0x1021, 0x1041, 0x1841, 0x0820, 0x0800, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB, 0x9492, 0x0000, 0x0800, 0xC3EA, 0xF4CD, 0xF4ED, 0xF4ED, 0xF4ED, 0xF4ED, 0xF4ED, 
-0xF50D, 0xF50D, 0xF50D, 0xF50D, 0xF4ED, 0xF4ED, 0xF4ED, 0xF4ED, 0xF4ED, 0xF4ED, 0xE48C, 0xBBCA, 0x2081, 0x1841, 0x1020, 0x1020, 
-0x0800, 0xAD55, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xDEFB, 0x632C, 0x0000, 0xBBA9, 0xA349, 0x82C7, 0x82C7, 0x82C7, 0x82C7, 0x9328, 0xF4ED, 0xF4ED, 0xF4ED, 0xC42B, 0x82C7, 0x82C7, 
-0x82C7, 0x82C7, 0x82C7, 0x82C7, 0xC3EA, 0xE42B, 0x28A2, 0x2061, 0x1840, 0x28C3, 0x6B4D, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0xCE59, 0x0000, 0x92A7, 0x4963, 0x0820, 
-0x0800, 0x0800, 0x2081, 0x4143, 0xECCD, 0xF4ED, 0xF4ED, 0x9B28, 0x2081, 0x0800, 0x0820, 0x0820, 0x0820, 0x0800, 0x7246, 0xC3A9, 
-0x30A1, 0x2061, 0x2040, 0x51E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B08, 0xE46B, 0xF4CD, 0xF4CD, 
-0xF4AC, 0xE44B, 0xC389, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5184, 0x30A1, 0x2861, 0x2860, 0x5A07, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A49, 0x18E3, 0x0000, 
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0000, 0x20C2, 0x6205, 0xECCC, 0xECCC, 0x59C4, 0x3923, 0x3102, 0x0841, 0x0841, 0x0841, 
-0x0861, 0x0841, 0x0020, 0x1040, 0x0820, 0x3060, 0x3860, 0x48E2, 0x7269, 0xF77D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0020, 0x1061, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x0841, 
-0x0000, 0x1061, 0x6A46, 0x6A46, 0x1061, 0x0000, 0x0841, 0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x1082, 0x0820, 0x0000, 0x0000, 0x69A4, 
-0x8A05, 0x89E4, 0x8A04, 0xAC91, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0x0000, 0x0000, 0x0020, 0x1061, 0x2924, 0x2945, 0x2945, 0x2945, 0x1082, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-0x1082, 0x2924, 0x2945, 0x2945, 0x2945, 0x18A2, 0x0821, 0x0000, 0x0000, 0xBB08, 0xF3CA, 0xF3CA, 0xF3CA, 0x4880, 0xDE9A, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0020, 0x1061, 0x2124, 
-0x2945, 0x2124, 0x1061, 0x1081, 0x0020, 0x28E2, 0xECAC, 0xEC8C, 0x28E2, 0x0020, 0x1082, 0x2924, 0x2945, 0x2124, 0x1082, 0x1081, 
-0x0820, 0x0000, 0x0000, 0xBB08, 0xAAC6, 0x9264, 0xF3EA, 0x4880, 0xDE9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0020, 0x1061, 0x18A2, 0x18A2, 0x10A2, 0x1082, 0x1061, 0x0020, 0x2902, 
-0xECAC, 0xEC8C, 0x28E2, 0x0020, 0x1061, 0x18A2, 0x18A2, 0x18A2, 0x1082, 0x1082, 0x0820, 0x1061, 0xC328, 0xE389, 0xAAC6, 0x9264, 
-0xF3EA, 0x4880, 0xDE9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 
-0x2104, 0x0000, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x28C1, 0x61C3, 0xECAC, 0xECAC, 0x9B08, 0x51A4, 0x0820, 0x0820, 
-0x0840, 0x0820, 0x0820, 0x0820, 0x4123, 0x8246, 0xEBC9, 0xAAA6, 0xAAC6, 0xAAC6, 0x89E4, 0xA471, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ACB, 0x1020, 0x2081, 0x1840, 0x2081, 0x30E2, 
-0x30E2, 0x30E2, 0x61A2, 0x8A64, 0xECAC, 0xF4CC, 0xF4CC, 0xA369, 0x3102, 0x30E2, 0x30E2, 0x30E2, 0x30E2, 0x30E2, 0x9266, 0xF3CA, 
-0xF3CA, 0x9265, 0x9A86, 0xB308, 0x61A6, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x6186, 0xA205, 0x68E2, 0xA245, 0xF3C9, 0xF3C9, 0xF3C9, 0xAAC6, 0x9AA5, 0xECAC, 0xF4CC, 
-0xF4CC, 0xF4AC, 0xF48C, 0xF3EA, 0xF3CA, 0xF3CA, 0xF3C9, 0xF3C9, 0xF3C9, 0xF3CA, 0xF3C9, 0xF3C9, 0x9204, 0x69E7, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5C, 
-0x69C7, 0x4020, 0xA225, 0xF3CA, 0xF3CA, 0xF3CA, 0xEC2A, 0xD3EA, 0x8A85, 0xEC8C, 0xF4CC, 0xF4CC, 0xF4AC, 0xF3EA, 0xF3CA, 0xF3CA, 
-0xF3CA, 0xF3CA, 0xF3A9, 0xD328, 0x5881, 0x5881, 0xAC30, 0xEF1B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB4D3, 0x6145, 0x7102, 0xAA66, 0xF3CA, 0xF3CA, 
-0xF46B, 0xEC8B, 0xC3C9, 0xF4CC, 0xF4CC, 0xF4CC, 0xF4AC, 0xF3EA, 0xF3CA, 0xF3CA, 0xF3CA, 0xF3CA, 0xCAE7, 0x9247, 0x9BAE, 0x9BAE, 
-0xCDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9C10, 0x58C3, 0x7123, 0xF3CA, 0xF3EA, 0xCB89, 0xC3C9, 0xD42A, 0xD42A, 0xD40A, 0xD40A, 
-0xD3E9, 0xBAE7, 0xE3A9, 0xF3CA, 0xF3A9, 0xC2E7, 0x89C4, 0x6104, 0xCDD7, 0xC5D7, 0xEF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0x9BAE, 0x79E6, 0xDB89, 0xF3EA, 0x81C4, 0x5922, 0x9AA5, 0x9AC5, 0x9AC5, 0x9AA5, 0x9265, 0x50C2, 0xBAE7, 0xF3CA, 0xE389, 0x7101, 
-0x5820, 0x5800, 0x6000, 0x5800, 0xA3CF, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xC596, 0x58A1, 0xE3A9, 0xEC0A, 0xE42A, 
-0xEC8B, 0xEC8B, 0xEC6B, 0xEC6B, 0xEC4B, 0xEBA9, 0xEBCA, 0xEBA9, 0xC307, 0x60C1, 0x7801, 0xB002, 0xC802, 0xC802, 0x8821, 0x7A28, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xAC92, 0x82CB, 0x81E7, 0x8821, 0x89A4, 0xCB89, 0xF46B, 0xF4AC, 0xF4AC, 0xF4AC, 0xF48C, 0xF46B, 0xF3EA, 
-0xF3CA, 0xE389, 0x8A24, 0x5080, 0x7801, 0xB802, 0xD002, 0xD802, 0xB802, 0xA0C4, 0x82CB, 0xF77D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCD96, 0x89A7, 0x7800, 0x9001, 
-0xB802, 0x6800, 0x91E5, 0xBB28, 0xEC8B, 0xF4AC, 0xF4AC, 0xF4AC, 0xF44B, 0xB2C7, 0xC307, 0xBB07, 0x8A64, 0x4860, 0x7000, 0xA801, 
-0xC002, 0xD002, 0xD802, 0xB801, 0x7800, 0xB492, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF75D, 0x60C3, 0xA801, 0xD802, 0xD802, 0xD002, 0xA001, 0x6800, 0x6081, 0xD42A, 0xE46B, 
-0xE46B, 0xE44B, 0xD3C9, 0x50C1, 0x71A2, 0x8A44, 0xE3A9, 0x60C2, 0x6800, 0x9001, 0xB001, 0xC802, 0xD802, 0xD802, 0xD802, 0x4800, 
-0xDE9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xD618, 0x5841, 
-0xB802, 0xD002, 0xD802, 0xD802, 0xD002, 0xA001, 0x9801, 0x9001, 0x5020, 0x4820, 0x4820, 0x4840, 0x4860, 0x71A2, 0xC327, 0xF3C9, 
-0xEBA9, 0x60C2, 0x6800, 0x9001, 0xB001, 0xD002, 0xD802, 0xD802, 0xD802, 0x4800, 0xDE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAC30, 0x78E4, 0xB802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD002, 0xA001, 
-0xA001, 0xA001, 0x9801, 0x5000, 0x6101, 0x81E3, 0x8203, 0xCB48, 0xEBC9, 0xF3CA, 0xEB89, 0x60C2, 0x6800, 0x9001, 0xD002, 0xD802, 
-0xD802, 0xD802, 0xD802, 0x5000, 0xDE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xA3EF, 0x9125, 0xB002, 0xD002, 0xD002, 0xD002, 0xD802, 0xD802, 0xD002, 0xC802, 0xA801, 0x9801, 0x7001, 0x5000, 0x81C4, 0xCB48, 
-0xD348, 0xEBA9, 0xF3CA, 0xF3AA, 0xEB89, 0x60A2, 0x7801, 0xC002, 0xD002, 0xD802, 0xD802, 0xC002, 0x8001, 0x5000, 0xDE79, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8B0C, 0x98C4, 0xB802, 0xC802, 0xD002, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xA001, 0x8842, 0x58C3, 0x4800, 0x9205, 0xF3EA, 0xF3CA, 0xF3CA, 0xF3CA, 0xEB89, 0xC2A7, 0x8082, 
-0x9801, 0xD002, 0xD802, 0xD802, 0xC802, 0xA001, 0x6800, 0x6800, 0xB472, 0xC596, 0xD659, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA36E, 0x6800, 0xA801, 0xC802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0x7800, 0x58E3, 
-0xBD95, 0x58C3, 0x9205, 0xF3CA, 0xF3CA, 0xF3CA, 0xF3AA, 0xD308, 0x5820, 0xB802, 0xD002, 0xD802, 0xD002, 0xD802, 0x9001, 0x6800, 
-0xA801, 0xB002, 0x6800, 0x5000, 0x7A49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8ACB, 0x8883, 
-0x9001, 0x6000, 0x8801, 0x9801, 0xB802, 0xD802, 0xD802, 0xD802, 0x7800, 0x58E3, 0xBD74, 0xCDB5, 0x934C, 0x58C2, 0x58C1, 0x58C1, 
-0x60C1, 0x70A2, 0xB802, 0xD002, 0xD002, 0xD002, 0xA801, 0x7000, 0x7801, 0xA001, 0xC802, 0xD002, 0xC002, 0xA801, 0x7821, 0x5041, 
-0x5061, 0xD659, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x79C7, 0x9001, 0xC002, 0xA801, 0x6800, 0x6800, 0x9001, 0xB802, 
-0xD002, 0xD802, 0xB802, 0x9842, 0x71E7, 0xCDB5, 0xC574, 0xBD12, 0xBD12, 0xBD12, 0x6124, 0x6800, 0xD002, 0xC002, 0xA001, 0x7800, 
-0x7000, 0x8801, 0xA801, 0xC802, 0xD002, 0xD002, 0xD002, 0xC802, 0xB802, 0xA001, 0x9801, 0x79A7, 0xC596, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFBE, 0xC555, 0x8945, 0xB001, 0xD002, 0xD002, 0x8001, 0x7000, 0x7800, 0x9801, 0xC002, 0xD802, 0xD802, 0xB802, 0x4800, 0xC594, 
-0xD636, 0xE698, 0xE677, 0xBCF1, 0x8986, 0x8001, 0xC002, 0x9801, 0x8001, 0x7000, 0x8000, 0xA801, 0xC802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD002, 0xC802, 0x8801, 0x9AEB, 0xCDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF1C, 0x5020, 0xB002, 0xD002, 0xD002, 0xD002, 
-0xD002, 0xB002, 0x7000, 0x6000, 0xA801, 0xD002, 0xD002, 0xB802, 0x5000, 0xDE16, 0xDE57, 0xC5D6, 0xBD74, 0x58A2, 0xA801, 0xC802, 
-0xA001, 0x6000, 0x7000, 0x9801, 0xD002, 0xD002, 0xD002, 0xD802, 0xD002, 0xD002, 0xD002, 0xD002, 0xD002, 0xD002, 0xD802, 0xC002, 
-0x7801, 0x6986, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF1C, 0x5000, 0xB802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xC002, 0x9001, 0x5000, 0xC802, 
-0xD802, 0xC002, 0x5000, 0xDE36, 0xF6F8, 0xF6F9, 0xE657, 0x58C2, 0xA801, 0xC002, 0x6000, 0x9001, 0xB802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0x8801, 0x6986, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC596, 0x8A8A, 0xA801, 
-0xC802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xC802, 0xB002, 0x8001, 0x7801, 0xB802, 0xC002, 0x5000, 0xDE16, 0xF6D8, 0xD5B4, 
-0x7A28, 0xA042, 0x9001, 0x8001, 0x8001, 0xB802, 0xC802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xB802, 0x9863, 0x8ACB, 0xEF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB492, 0x5800, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD002, 0xB002, 0x7800, 0x9801, 0xA801, 0x4800, 0xDE16, 0xF6D8, 0xC533, 0x5000, 0xC002, 0x9801, 0x8001, 0xB001, 0xD002, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xC802, 0xC802, 0xD802, 0xD802, 0xD802, 0xD802, 0xB802, 
-0x5041, 0xDE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xEF5D, 0xAC30, 0x6000, 0xD802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xB002, 0x8001, 0x6800, 
-0x4800, 0xDE16, 0xF6D8, 0xC533, 0x5000, 0xC002, 0xB802, 0xB002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xB802, 0xB002, 0xD802, 0xD802, 0xD802, 0xD802, 0xB802, 0x5841, 0xCDB6, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7A08, 0x6800, 0x9001, 0xD802, 0xD802, 0xD002, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xD802, 0xB802, 0x9801, 0x4800, 0xDE16, 0xF6D8, 0xC533, 0x5000, 0xC002, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0x9801, 0x8001, 0xD802, 
-0xD802, 0xD802, 0xD002, 0xD002, 0xB802, 0x6000, 0xA3CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7A08, 0x7000, 0x9001, 0xD802, 0xD002, 0xD002, 0xD802, 0xD802, 0xD002, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xB002, 0x9801, 0x4800, 0xDE16, 0xF6D8, 0xCD33, 0x5000, 0xC002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xA001, 0x9001, 0x9801, 0xD002, 0xD802, 0xD802, 0xC802, 0xB802, 0xB002, 0x6000, 
-0xA3CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D, 0xC555, 0x9987, 0x8001, 
-0x8801, 0xB002, 0xC802, 0xD002, 0xD002, 0xD802, 0xD802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD002, 0xA801, 0x9001, 0x4800, 0xDE16, 
-0xCD73, 0xA38D, 0x6800, 0xC002, 0xD802, 0xD802, 0xD802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 
-0x8801, 0x8801, 0xA001, 0xD002, 0xC802, 0xC802, 0xC002, 0xB002, 0xA802, 0x6000, 0xA3CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE6FB, 0x5861, 0xB002, 0xB002, 0x9001, 0x7800, 0xB001, 0xD002, 0xD002, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xA001, 0x8001, 0x4800, 0xDE16, 0x8B0B, 0x5800, 0x9801, 0xC802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xC802, 0x6000, 0x7000, 0xA001, 0xC002, 0xB001, 0xB002, 
-0xB002, 0xB002, 0xB001, 0x6800, 0xA34D, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xDE9A, 0x6062, 0xB802, 0xD002, 0xC002, 0x8001, 0xA001, 0xB802, 0xC002, 0xD802, 0xD002, 0xD002, 0xD002, 0xD002, 0xD002, 0xD002, 
-0xB002, 0x9001, 0x4800, 0xDE15, 0x8B0B, 0x5800, 0xA001, 0xC802, 0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD002, 0xD802, 0xA001, 0x6000, 0x7000, 0x9001, 0x9001, 0xB002, 0xB002, 0xB002, 0xB802, 0xB802, 0xC002, 0x8821, 0xC5B6, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD618, 0x70C3, 0xC002, 0xD002, 0xD002, 0xC802, 0x7800, 
-0xA001, 0xC002, 0xD002, 0xD002, 0xD002, 0xC802, 0xB802, 0xB802, 0xB802, 0xB802, 0xA801, 0x9001, 0x4800, 0xDDF5, 0x8B0B, 0x6000, 
-0xA801, 0xB802, 0xB802, 0xB802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD002, 0xD802, 0xD802, 0xD002, 0xD002, 0x9801, 0x6000, 0x6800, 
-0x8001, 0x9801, 0xB002, 0xB002, 0xC002, 0xD002, 0xD002, 0xD002, 0x9801, 0xC596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xD618, 0x6000, 0xC802, 0xD002, 0xD002, 0xC802, 0x5800, 0x9001, 0xC002, 0xD002, 0xD002, 0xD002, 0xD002, 
-0xC802, 0xC802, 0xC802, 0xC802, 0xB002, 0x9001, 0x5000, 0x6965, 0x7082, 0x9801, 0xC802, 0xC802, 0xC802, 0xC802, 0xD002, 0xD802, 
-0xD802, 0xD802, 0xD002, 0xD002, 0xC802, 0xC002, 0xC002, 0x9001, 0x5800, 0x7000, 0x9001, 0xA801, 0xC802, 0xC802, 0xD002, 0xD002, 
-0xD002, 0xD002, 0x9801, 0xC575, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD618, 0xAB8E, 0x8801, 0xD002, 
-0xC002, 0xC002, 0xC802, 0x4800, 0x9001, 0xC002, 0xD002, 0xD002, 0xD002, 0xD002, 0xD002, 0xD002, 0xD802, 0xD002, 0xB001, 0x9001, 
-0x5000, 0x6800, 0x8801, 0xB001, 0xD002, 0xD002, 0xD002, 0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xC802, 0xB802, 
-0xB002, 0x9801, 0x6000, 0x7000, 0xA001, 0xB802, 0xD002, 0xD002, 0xD002, 0xD002, 0xD802, 0xD802, 0xA801, 0xABAF, 0xE6DB, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B8E, 0x6800, 0xD002, 0xD002, 0xA001, 0xA801, 0xC002, 0x4800, 0x9001, 0xC002, 
-0xD002, 0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xB002, 0x9001, 0x5000, 0x9801, 0xA801, 0xB802, 0xD002, 0xD002, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xD802, 0xC802, 0xB002, 0xA801, 0x6000, 0x7000, 0xA801, 0xD002, 
-0xD002, 0xD002, 0xD002, 0xD002, 0xD002, 0xD802, 0xD002, 0x7000, 0xB4D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0x936D, 0x6800, 0xD002, 0xA801, 0x8801, 0x9001, 0xA001, 0x4800, 0x9001, 0xC002, 0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xB001, 0x9001, 0x5000, 0x9801, 0xB802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xC802, 0xB001, 0xB001, 0x6000, 0x7000, 0xA801, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD002, 0x7000, 0xB4D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x7A28, 0x98C4, 0xC002, 0xD002, 0xC802, 0xB001, 0x9801, 
-0x8000, 0x4800, 0x9001, 0xC002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0x8001, 0x6000, 0x7000, 0xA801, 
-0xC002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xD002, 0xB001, 
-0x6000, 0x6800, 0x9001, 0xC002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xC002, 0x88E4, 0x8269, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xF77D, 0x60C3, 0x9801, 0xD802, 0xD002, 0xD002, 0xB802, 0x9801, 0x7800, 0x4800, 0x9801, 0xC802, 0xD002, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0x7800, 0x5800, 0x9001, 0xC002, 0xC802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xB002, 0x6000, 0x6800, 0x8801, 0xB001, 0xC002, 0xD002, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0x8001, 0x6104, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0xD618, 0x78A3, 0x9001, 0xB802, 
-0xB802, 0xB802, 0xC002, 0xA801, 0x8801, 0x4800, 0xA001, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xC002, 
-0x7000, 0x5800, 0xA001, 0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xB001, 0x6000, 0x6800, 0x8801, 0xB001, 0xB001, 0xC002, 0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 
-0x8001, 0x6104, 0xFFFF, 0xFFFF, 0xFFFF, 0xBD14, 0x5000, 0xC802, 0x9801, 0x7800, 0x7800, 0x7800, 0xA801, 0xB802, 0xA801, 0x4800, 
-0xA001, 0xD002, 0xD002, 0xD002, 0xD802, 0xD802, 0xD002, 0xD002, 0xD002, 0xA001, 0x6800, 0x6000, 0xA001, 0xD002, 0xD002, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xD802, 0xB001, 0x6000, 0x6800, 
-0x8801, 0xB001, 0xB001, 0xB001, 0xC002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0x8001, 0x6104, 0xFFFF, 0xFFFF, 0xFFFF, 0xBD14, 
-0x5800, 0xC802, 0xB001, 0xA001, 0x8801, 0x9001, 0x8001, 0x8001, 0x8001, 0x5000, 0xA001, 0xD002, 0xD802, 0xD802, 0xD802, 0xD002, 
-0xD002, 0xD002, 0xC802, 0x8001, 0x9001, 0xA001, 0xC802, 0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xA801, 0x6000, 0x6800, 0x8801, 0xB001, 0xB001, 0x9001, 0x8001, 0x8801, 
-0x8801, 0x8001, 0x8001, 0xC002, 0xC802, 0xB022, 0x6124, 0xDE9A, 0xD618, 0x9AEC, 0x9001, 0xC802, 0xB001, 0x9801, 0x8801, 0x8801, 
-0x8001, 0x7800, 0x7800, 0x5000, 0xA001, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xC802, 0x8000, 0x9801, 0xB001, 
-0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xA801, 0x6000, 0x6800, 0x9001, 0xA801, 0x8801, 0xA001, 0xA801, 0xA801, 0xA801, 0xA801, 0xA001, 0xC802, 0xD802, 0xC002, 
-0x4800, 0xD659, 0x934D, 0x7800, 0xD002, 0xC002, 0xA001, 0x8801, 0x8801, 0x9001, 0x9001, 0x9001, 0x8801, 0x5000, 0xA001, 0xD002, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xC802, 0x7800, 0xA001, 0xB001, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xA801, 0x6000, 0x6800, 0x8000, 0x9001, 
-0x8000, 0xB802, 0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xC002, 0x4800, 0xD659, 0x934D, 0x7800, 0xD002, 0x9801, 
-0x8801, 0x8801, 0x9001, 0xD002, 0xD002, 0xD002, 0xC002, 0x4800, 0xA001, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xC802, 0x5800, 0x9001, 0xB001, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xA001, 0x6000, 0x6000, 0x7000, 0x7800, 0xD002, 0xD802, 0xD002, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xC002, 0x4800, 0xD659, 0x934D, 0x7800, 0xD002, 0xC802, 0xC802, 0xC802, 0xC802, 0xB802, 0xB802, 0xB802, 
-0xB001, 0x5000, 0xA001, 0xD002, 0xD802, 0xD802, 0xD802, 0xD002, 0xD002, 0xD002, 0xC802, 0x5800, 0x9001, 0xB001, 0xD002, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xA001, 
-0x6000, 0x7800, 0xA001, 0x9801, 0x8801, 0x8001, 0x8001, 0x7800, 0x7800, 0xC802, 0xD002, 0xD802, 0xD002, 0xC002, 0x5000, 0xD659, 
-0x934D, 0x7800, 0xD002, 0xD002, 0xD002, 0xC802, 0xB802, 0xB001, 0xB001, 0xB001, 0xA801, 0x4800, 0x9001, 0xC802, 0xD802, 0xD802, 
-0xD802, 0xC802, 0xB802, 0xB802, 0xB001, 0x5800, 0x9001, 0xB001, 0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD002, 0xD802, 0xD002, 0xD002, 0xD002, 0xD802, 0x6000, 0x7800, 0x9801, 0xA001, 0x8001, 0x8000, 0x8000, 
-0x8001, 0x8000, 0x7800, 0x8801, 0x9001, 0xC802, 0xD002, 0xC002, 0x4800, 0xD659, 0x934D, 0x7000, 0xC002, 0xD002, 0xC802, 0xC002, 
-0xB002, 0xB001, 0xB001, 0xB001, 0xA001, 0x4800, 0x9001, 0xC802, 0xD002, 0xD002, 0xD002, 0xC802, 0xC002, 0xC002, 0xA801, 0x5800, 
-0x9001, 0xB001, 0xD002, 0xD002, 0xD002, 0xC802, 0xC802, 0xC802, 0xC802, 0xC802, 0xC802, 0xC802, 0xC802, 0xC802, 0xD002, 0xD002, 
-0xD802, 0xC002, 0x9001, 0x6000, 0x7800, 0x8001, 0x8001, 0x7800, 0x7000, 0x8801, 0x9801, 0xA001, 0xA001, 0xA801, 0xA801, 0xC802, 
-0xD002, 0xC002, 0x5000, 0xD659, 0xA410, 0x7904, 0xA001, 0xD002, 0xC002, 0xB001, 0xB001, 0xB001, 0xA001, 0xA001, 0x9001, 0x5800, 
-0x9801, 0xC002, 0xD802, 0xD002, 0xD802, 0xD002, 0xD002, 0xC802, 0xA001, 0x5800, 0x9001, 0xB801, 0xD002, 0xD002, 0xD002, 0xC802, 
-0xC002, 0xB802, 0xB801, 0xB801, 0xB801, 0xB802, 0xB802, 0xC002, 0xD002, 0xD002, 0xC802, 0xA801, 0x5000, 0x7800, 0x7800, 0x7800, 
-0x7800, 0x7000, 0x7000, 0x8801, 0xA801, 0xB802, 0xD002, 0xD002, 0xD002, 0xD002, 0xD002, 0xC002, 0x5000, 0xD659, 0xFFDF, 0xBCD3, 
-0x5800, 0xC802, 0xC002, 0xB001, 0xA801, 0x9001, 0x6000, 0x5000, 0x5800, 0x8801, 0x9001, 0xB802, 0xD802, 0xD802, 0xD802, 0xD002, 
-0xD002, 0xD002, 0xA001, 0x5800, 0x9001, 0xB801, 0xD002, 0xD802, 0xD802, 0xD002, 0xD002, 0xD002, 0xD002, 0xD002, 0xD002, 0xD002, 
-0xD002, 0xD002, 0xD002, 0xB001, 0x9801, 0x8000, 0x5000, 0x9001, 0xB802, 0xC802, 0xD002, 0xD002, 0xD002, 0x7000, 0x7000, 0x9001, 
-0xB001, 0xB802, 0xB802, 0xD002, 0xD802, 0xB802, 0x4800, 0xD659, 0xFFFF, 0xBCF3, 0x5000, 0xC802, 0xC002, 0xB001, 0xA001, 0x6800, 
-0x8801, 0x9801, 0xA001, 0x8801, 0x9001, 0xB802, 0xD802, 0xD002, 0xD802, 0xD802, 0xD002, 0xC002, 0x5000, 0x8801, 0xB801, 0xD002, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xA001, 0xA801, 0x8000, 0x6800, 
-0x8000, 0x9801, 0xC002, 0xD002, 0xD002, 0xD802, 0xD802, 0xD002, 0xC802, 0xC002, 0xB001, 0xB001, 0xB002, 0xD002, 0xC002, 0xA801, 
-0x4800, 0xD659, 0xFFFF, 0xDE9A, 0xAC30, 0x9083, 0xA001, 0xA801, 0x8801, 0x6000, 0x8801, 0xA001, 0xB001, 0x8801, 0xA001, 0xC002, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xB802, 0x4800, 0x9801, 0xC002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xB802, 0xA001, 0x9801, 0x8000, 0x6000, 0x9801, 0xB001, 0xC002, 0xC802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD002, 0xB001, 0xB001, 0xB001, 0xD002, 0xC002, 0xB083, 0xAC72, 0xEF7D, 0xFFFF, 0xFFFF, 0xF77D, 0x60C3, 
-0x8001, 0x9801, 0x7000, 0x7000, 0x9001, 0xA001, 0xA001, 0x9801, 0xB002, 0xC802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD002, 0xB802, 
-0x4800, 0x9801, 0xC802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD002, 0xA001, 0xB001, 0xA801, 0x5000, 0xA001, 0x9801, 0xA801, 0xB802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xC002, 0xB802, 
-0xB002, 0xD002, 0xC002, 0xC106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x6945, 0x7001, 0x8001, 0x5800, 0x9001, 0xA801, 0x9801, 
-0x8000, 0xB001, 0xC802, 0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD002, 0xB802, 0x4800, 0xA001, 0xC802, 0xD002, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xA801, 0xC002, 0xB001, 0x5800, 0xA001, 
-0x8801, 0x9801, 0xB801, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xC002, 0xB802, 0xC002, 0xC002, 0xC106, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xEF3C, 0x9A8A, 0x6800, 0x5800, 0xA801, 0xB001, 0x9801, 0x8801, 0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD002, 0xB802, 0x4800, 0xA001, 0xC802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xB802, 0xC802, 0xD002, 0xC002, 0x6000, 0x9001, 0xA801, 0xB801, 0xD002, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD002, 0xD002, 0xD002, 0x7800, 0x9801, 0xC926, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8AEB, 0x5000, 
-0x5800, 0xA801, 0x7800, 0x8000, 0xA801, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xC002, 0xA801, 0x4800, 0xA001, 
-0xC802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 
-0xB801, 0xB001, 0xD802, 0x5800, 0x9001, 0x9801, 0xA001, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0x6800, 
-0x9801, 0xC906, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBD34, 0x8249, 0x5800, 0x9001, 0x6800, 0x7800, 0xB001, 0xD002, 
-0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xC002, 0xA001, 0x4800, 0xA001, 0xC802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xB801, 0xA801, 0xD002, 0x8801, 0x8001, 0x9001, 
-0xA001, 0xB802, 0xD002, 0xD802, 0xD002, 0xD802, 0xD002, 0xB802, 0xB002, 0x6800, 0xA229, 0xE431, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xBD14, 0x5000, 0x8000, 0x6000, 0x7800, 0xB001, 0xD002, 0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xC002, 0xA001, 0x4000, 0x9801, 0xC802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xC002, 0xB001, 0xC802, 0xB001, 0x6000, 0x8001, 0xA801, 0xA801, 0xD002, 0xD002, 0xD002, 0xD002, 
-0xC802, 0x9801, 0x9801, 0x70E4, 0xBD34, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBD14, 0x5000, 0x7800, 
-0x6000, 0x7800, 0xB001, 0xB001, 0xC802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD002, 0xC002, 0xA001, 0x4000, 0x9801, 0xC802, 0xD002, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xB802, 
-0x8001, 0xA801, 0x6000, 0x8001, 0xB001, 0xC802, 0xD002, 0xD002, 0xD002, 0xC802, 0xB001, 0x8801, 0x8801, 0xE659, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D, 0xC575, 0x5841, 0x5000, 0x7800, 0xB001, 0xB001, 0xB802, 0xC002, 
-0xD002, 0xD002, 0xD002, 0xD002, 0xC002, 0xA001, 0x4000, 0xA001, 0xC802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xD002, 0xD002, 0xC002, 0x9001, 0xB001, 0x6000, 0x7000, 0x9801, 0xA801, 
-0xB802, 0xB802, 0xB001, 0xA801, 0xA001, 0x6000, 0x5800, 0xDE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xE6DB, 0x5061, 0x5000, 0x7800, 0xB001, 0xB001, 0xB001, 0xC002, 0xD002, 0xD002, 0xD002, 0xD002, 0xC002, 0xA001, 
-0x4800, 0xA001, 0xC802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD002, 0xD002, 0xD002, 0xC002, 0x9001, 0xA001, 0x5800, 0x6000, 0x7800, 0xA001, 0xA801, 0xA001, 0x8801, 0x7800, 0x7841, 0x9B6D, 
-0xA410, 0xEF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x82CB, 0x5882, 0x7000, 
-0xA001, 0xB001, 0xB001, 0xB802, 0xC802, 0xD002, 0xD002, 0xD002, 0xC002, 0xA001, 0x4800, 0xA001, 0xC802, 0xD002, 0xD002, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xD002, 0xD002, 0xC002, 0x7800, 0x9801, 
-0x6800, 0x5000, 0x6000, 0x8801, 0x8801, 0x8801, 0x8166, 0x8269, 0x8ACB, 0xEF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x934D, 0x70A3, 0x8801, 0xA801, 0xA801, 0xA801, 0xB001, 0xD002, 
-0xD002, 0xD802, 0xC002, 0xA001, 0x4800, 0xA001, 0xC802, 0xD802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xC002, 0x7800, 0x9801, 0x9801, 0x7000, 0x5000, 0x5800, 0x6800, 0x5000, 
-0xAC92, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xAC71, 0x5000, 0x9001, 0x9001, 0x9801, 0x9801, 0x9801, 0xC802, 0xD002, 0xC002, 0xA001, 0x4800, 0xA001, 
-0xC802, 0xD002, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD802, 0xD002, 0xD002, 0xD002, 0xC802, 0xB001, 0xB001, 0xB001, 
-0xB001, 0xA001, 0x8801, 0x9801, 0xB802, 0xA801, 0x8001, 0x5800, 0x8801, 0x5800, 0xAC92, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0xC555, 0x5800, 
-0x6000, 0x7800, 0x8801, 0x8801, 0x9801, 0xC002, 0xB802, 0x9001, 0x4800, 0xA001, 0xC802, 0xD002, 0xD802, 0xD802, 0xD802, 0xD802, 
-0xD802, 0xC802, 0xC002, 0xC002, 0xB802, 0xB802, 0xB802, 0xB001, 0xB001, 0xB001, 0xB001, 0xA801, 0xA001, 0xB001, 0xB802, 0xA001, 
-0x7000, 0x6000, 0x9801, 0x5800, 0xAC92, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D, 0x936D, 0x60E3, 0x6800, 0x8801, 0x8801, 0x9001, 0xB001, 
-0xA801, 0x9001, 0x4800, 0x9001, 0xB801, 0xC002, 0xD002, 0xD002, 0xD002, 0xD002, 0xD002, 0xB802, 0xB001, 0xB001, 0xB001, 0xB001, 
-0xB001, 0xB001, 0xB001, 0xB001, 0xB001, 0xB001, 0xB001, 0xA801, 0x9801, 0x8801, 0x6800, 0x5800, 0x7800, 0x92CB, 0xCDF7, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x82CB, 0x7082, 0x8001, 0x8801, 0xA001, 0xA801, 0xA801, 0x9801, 0x5000, 0x8001, 0xA801, 0xB801, 
-0xC802, 0xC802, 0xC802, 0xD002, 0xD002, 0xB802, 0xB001, 0xB001, 0xB001, 0xB001, 0xB001, 0xA801, 0xA801, 0xA001, 0xA001, 0xA801, 
-0xA801, 0xA001, 0x8801, 0x8000, 0x7000, 0x5841, 0x6965, 0xD638, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x936D, 
-0x5800, 0x8801, 0xB001, 0xB802, 0xC002, 0xC002, 0x9001, 0x6000, 0x9001, 0xA001, 0xA801, 0xA001, 0xA001, 0xA001, 0xA801, 0xA801, 
-0xA001, 0xA001, 0xA001, 0xA001, 0xA001, 0x9801, 0x8001, 0x7801, 0x8001, 0x8001, 0x8001, 0xA801, 0xB802, 0xB002, 0x9001, 0x6104, 
-0xF77D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x936D, 0x5000, 0x5800, 0x7000, 0x9801, 0xB802, 0xB802, 
-0x8001, 0x5000, 0x9801, 0xC002, 0xC802, 0xA001, 0xA001, 0xB002, 0xB802, 0xC802, 0xB002, 0xB002, 0xC802, 0xB002, 0xB802, 0xC802, 
-0xA001, 0xC002, 0xA802, 0x9801, 0xB002, 0x9801, 0xA802, 0xA802, 0x9001, 0x5904, 0xF77D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xCDD7, 0xA410, 0xA410, 0x5104, 0x5000, 0x6801, 0x6801, 0x4800, 0x4000, 0x8801, 0xB802, 0xD002, 0xA001, 
-0xA801, 0xB002, 0xB002, 0xC802, 0xB002, 0xB001, 0xC802, 0xB002, 0xB802, 0xD002, 0xA001, 0x8801, 0x7001, 0x6801, 0x7801, 0x6000, 
-0x7001, 0x7801, 0x8105, 0xAC92, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0x4208, 0x0800, 0x0820, 0x1020, 0x1000, 0x3000, 0x6000, 0x7801, 0xA802, 0x7801, 0x9001, 0x9001, 0x8001, 0xA002, 0x9001, 0x8801, 
-0xA002, 0x8801, 0x9802, 0xA002, 0x7801, 0x3800, 0x2800, 0x2800, 0x2800, 0x2800, 0x5124, 0x69E7, 0x9BCF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4208, 0x0820, 0x0861, 0x0861, 0x0841, 0x0800, 
-0x0800, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0800, 
-0x0800, 0x0800, 0x0800, 0x0800, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4208, 0x0020, 0x1061, 0x1061, 0x0861, 0x0861, 0x0841, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0000, 0xB5B6, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0x0840, 
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x0000, 0x0861, 0x0861, 0x0861, 
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0000, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0x0020, 0x1061, 0x1082, 0x1061, 0x1061, 0x1061, 0x0861, 
-0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081, 0x1061, 
-0x1061, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0x4228, 0x0020, 0x0861, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0841, 0x0000, 0x0841, 0x31A6, 
-0x0000, 0x0861, 0x1061, 0x1061, 0x1082, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0x0020, 0x0861, 0x1061, 
-0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x0861, 0x0841, 0x0000, 0x2965, 0xF79E, 0x0000, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A28, 0x0820, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
-0x0841, 0x0020, 0x2965, 0xF79E, 0x0000, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0000, 
-0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0x4228, 0x0020, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0841, 0x0020, 0x2965, 0xF7BE, 0x0000, 0x0841, 
-0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8410, 0x2965, 0x0841, 0x1082, 0x1082, 0x1082, 
-0x1082, 0x1082, 0x1082, 0x1082, 0x0841, 0x0020, 0x2965, 0xF7BE, 0x3186, 0x0020, 0x0841, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
-0x1082, 0x1082, 0x1062, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0000, 
-0x2965, 0xFFFF, 0xFFFF, 0x18C3, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0000, 0xB596, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 
-0x0020, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x0841, 0x0020, 0x2965, 0xFFFF, 0xFFFF, 0x18E3, 0x0841, 0x1082, 
-0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1061, 0x0861, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x0020, 0x0861, 0x0861, 0x0861, 0x1061, 0x1062, 
-0x1082, 0x1061, 0x0841, 0x0020, 0x2965, 0xFFFF, 0xFFFF, 0x18E3, 0x0841, 0x0861, 0x1082, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 
-0x0861, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x0020, 0x1061, 0x1061, 0x1061, 0x1082, 0x1082, 0x1082, 0x1061, 0x0841, 0x0020, 0x2965, 0xFFFF, 
-0xFFFF, 0x18E3, 0x0841, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x1061, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x0020, 0x0861, 
-0x0861, 0x1061, 0x1061, 0x0881, 0x1081, 0x0861, 0x0841, 0x0020, 0x2965, 0xFFFF, 0xFFFF, 0x18E3, 0x0841, 0x1062, 0x1082, 0x1081, 
-0x0882, 0x1081, 0x0861, 0x0861, 0x0861, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x0020, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
-0x0841, 0x0020, 0x2965, 0xFFFF, 0xFFFF, 0x2104, 0x0841, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0000, 
-0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0x7BEF, 0x0020, 0x0861, 0x0861, 0x1061, 0x1081, 0x1061, 0x1082, 0x0861, 0x0841, 0x0020, 0x2965, 0xFFFF, 0xFFFF, 0x2104, 
-0x0841, 0x1082, 0x1082, 0x1081, 0x1061, 0x1061, 0x1062, 0x1061, 0x0861, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x0020, 0x0861, 0x0861, 0x1061, 
-0x1062, 0x1061, 0x1081, 0x0861, 0x0841, 0x0020, 0x2965, 0xFFFF, 0xFFFF, 0x8430, 0x2965, 0x0841, 0x1082, 0x1082, 0x1081, 0x1082, 
-0x1061, 0x1061, 0x0861, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x0020, 0x1062, 0x0862, 0x1082, 0x1082, 0x1082, 0x1082, 0x0862, 0x0841, 0x0020, 
-0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ACB, 0x0020, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0000, 0xB596, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 
-0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0841, 0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ACB, 0x0020, 
-0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x0020, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 
-0x1061, 0x0861, 0x0841, 0x0000, 0x2124, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ACB, 0x0020, 0x1062, 0x1082, 0x1061, 0x1082, 0x1061, 0x1061, 
-0x0861, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x6B4D, 0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x1082, 0x632C, 
-0xEF7D, 0xFFFF, 0x5ACB, 0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x4A49, 0x9CD3, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD3, 0x0000, 
-0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0xE71C, 0xFFFF, 0x5ACB, 0x0020, 0x1062, 0x1062, 
-0x1082, 0x1061, 0x1061, 0x0861, 0x0861, 0x0841, 0x0000, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD3, 0x0000, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-0x0841, 0x0841, 0x0020, 0x0000, 0xE71C, 0xFFFF, 0x5AEB, 0x0020, 0x0861, 0x1062, 0x1061, 0x1062, 0x1061, 0x1061, 0x0861, 0x0841, 
-0x0000, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0x9CD3, 0x0000, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0000, 0xE71C, 0xFFFF, 
-0x5AEB, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0841, 0x0000, 0x0000, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD3, 0x0000, 0x0861, 0x0861, 
-0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0000, 0xE71C, 0xFFFF, 0x5ACB, 0x0000, 0x0841, 0x0841, 0x0841, 0x0841, 
-0x0841, 0x0841, 0x0841, 0x0020, 0x0000, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x9CD3, 0x0000, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 
-0x0020, 0x0000, 0xE71C, 0xFFFF, 0xC618, 0x5ACB, 0x0020, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0000, 0x5AEB, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xF7BE, 0x0000, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0840, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0x94B2, 
-0x0000, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0000, 0x0841, 0x0861, 0x0861, 
-0x0861, 0x0861, 0x0841, 0x0841, 0x0021, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0x94B2, 0x0000, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-0x0861, 0x0861, 0x0020, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0841, 0x0841, 0x0821, 0x0000, 
-0xE71C, 0xFFFF, 0xFFFF, 0x94B2, 0x0000, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x5AEB, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0x0000, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0021, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0x9CD3, 0x0000, 0x0861, 
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0861, 0x0861, 0x0882, 0x1082, 0x0861, 
-0x0841, 0x0841, 0x0821, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0x9CD3, 0x0000, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 
-0x0020, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0861, 0x0861, 0x1061, 0x1062, 0x0861, 0x0841, 0x0841, 0x0820, 0x0000, 0xE71C, 0xFFFF, 
-0xFFFF, 0x9CF3, 0x0000, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0841, 
-0x0861, 0x0861, 0x1082, 0x0861, 0x0841, 0x0841, 0x0841, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0x9CF3, 0x0000, 0x0861, 0x0861, 0x1081, 
-0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0861, 0x1062, 0x1082, 0x1082, 0x1062, 0x0861, 0x0841, 
-0x0841, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0x9CF3, 0x0000, 0x0861, 0x0861, 0x1061, 0x1081, 0x0861, 0x0861, 0x0861, 0x0020, 0x5ACB, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFDF, 0x0000, 0x0841, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0841, 0x0821, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0xC618, 
-0x5AEB, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0841, 0x0861, 0x1061, 
-0x1082, 0x0861, 0x0841, 0x0841, 0x0821, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x1082, 0x0861, 0x0861, 0x1061, 0x0861, 
-0x0861, 0x0861, 0x0020, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0000, 
-0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x5ACB, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0x0000, 0x0861, 0x0861, 0x0861, 0x1062, 0x0861, 0x0861, 0x0861, 0x0841, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x1082, 
-0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0020, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 
-0x0861, 0x0841, 0x0841, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-0x0020, 0x5AAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0000, 0xE71C, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xDEFB, 0x1082, 0x1062, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x0020, 0x52AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0841, 
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0821, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x1082, 0x0861, 0x0861, 
-0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x39C7, 0xAD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 
-0x0841, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x1082, 0x0861, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0020, 0x0000, 
-0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0x0000, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xDEFB, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0841, 0x0861, 0x0861, 
-0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0000, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB, 0x18C3, 0x0841, 0x0841, 0x0841, 
-0x0861, 0x0841, 0x0841, 0x0020, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A69, 0x10A2, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000, 
-0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18E3, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0021, 0x0020, 0x0000, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0x39C7, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x1062, 0x4228, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0x18E3, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0x0020, 0x0841, 0x0841, 0x0841, 
-0x0841, 0x0020, 0x18E3, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18E3, 0x0820, 0x0861, 0x0861, 0x0841, 0x0841, 
-0x0841, 0x0020, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4208, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x18E3, 0xF7BE, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18E3, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x7BCF, 0x5ACB, 0x10A2, 
-0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 0x4208, 
-0x0020, 0x0020, 0x0021, 0x0020, 0x0020, 0x3186, 0x9492, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x6B6D, 0x18C3, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 
-0x18E3, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52AA, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0xAD75, 
-0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x18E3, 0xCE59, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xD69A, 0x5ACB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-};
\ No newline at end of file
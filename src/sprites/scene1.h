@@ -1,3604 +0,0 @@
-// Image size: 240x240 = 57600 bits
-const uint16_t scene1_bmp[57600] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xC44E, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC42E, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC42E, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC44E, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC42E, 0xC44E, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC6F, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC42E, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xC44E, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xC44E, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xC44E, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xC44E, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xC44E, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xC44E, 
-0xC44E, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC44E, 0xC44E, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xCC6F, 0xCC90, 0xC44E, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 
-0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC6F, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC42E, 
-0xC44E, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC44E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xC44E, 0xC44E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xCC6F, 0xCC90, 0xC44E, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCB0, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 
-0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCB0, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 
-0xCCB0, 0xCC6F, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCB0, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xCC6F, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 
-0xC44E, 0xC44E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCB1, 
-0x49E6, 0x4185, 0x41A6, 0x4185, 0x4185, 0x4185, 0x4185, 0x4185, 0xA3CD, 0xCCD1, 0x9BAD, 0x4185, 0x3944, 0x4144, 0x4164, 0x4164, 
-0x7248, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCB0, 
-0x1082, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0020, 0xA3CD, 0xCCD1, 0x7AEA, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x3124, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC490, 0xB42F, 0xA3CE, 
-0x0861, 0x0020, 0x0821, 0x0020, 0x0020, 0x0021, 0x0020, 0x0020, 0x6A89, 0x830B, 0x51E6, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x3123, 0xA36B, 0xB3AC, 0xB3CC, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AEA, 0x0841, 0x0820, 
-0x0020, 0x0021, 0x0020, 0x0021, 0x0020, 0x0841, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0820, 0x0861, 0x1041, 0x1881, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6268, 0x0020, 0x0020, 
-0x0020, 0x0021, 0x0020, 0x0021, 0x0020, 0x0821, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x6A47, 0x3944, 0x0020, 0x0020, 
-0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0841, 0x0841, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x3944, 0x6206, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC6F, 0xCC6F, 0xCC6F, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x1061, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0820, 0x0020, 0x0020, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x1061, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0041, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x3124, 0x6207, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x1061, 0x0020, 0x0020, 0x0821, 0x0820, 
-0x0040, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x7AA8, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1061, 0x0020, 0x0020, 0x0820, 0x0020, 
-0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 
-0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x3124, 0x3103, 0x3103, 0x3103, 0x2903, 0x2903, 0x4164, 0xC40D, 0xA36B, 0x3123, 
-0x3944, 0x3944, 0x3144, 0x3965, 0x4185, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1061, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x0821, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x18A2, 0xC40D, 0x932A, 0x0020, 
-0x0820, 0x0020, 0x0020, 0x0020, 0x1061, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x1061, 0x0020, 0x0000, 0x0020, 0x0020, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x7A88, 0x4164, 0x0021, 0x0020, 0x0020, 0x0020, 0x0040, 0x0020, 0x0841, 0x51A5, 0x4165, 0x0020, 
-0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x9B6C, 0x9B6C, 0x9B6C, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC6F, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1061, 0x0000, 0x0000, 0x0020, 0x0020, 
-0x0000, 0x0000, 0x3143, 0x7306, 0x7306, 0x72E6, 0x7306, 0x7306, 0x7306, 0x7306, 0x7307, 0x7306, 0x72E6, 0x72E6, 0x72E6, 0x72C6, 
-0x20E2, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x20C2, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1061, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x5A24, 0xD4EA, 0xCCCA, 0xCCCA, 0xCCCA, 0xD4EA, 0xD4EA, 0xD4EA, 0xD4EA, 0xD4EA, 0xD4EA, 0xCCCA, 0xCCCA, 0xCCCA, 
-0x41A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7AA8, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBCC, 0x9B2B, 0x0020, 0x0020, 0x0020, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x18A2, 0xB3ED, 0xBC4F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x28E2, 0x1061, 0x0840, 0x0000, 0x0000, 
-0x0820, 0x1081, 0x5A24, 0xCCCA, 0xD4EA, 0xD4EA, 0xD4EA, 0xD4EA, 0xD4EA, 0xD4EA, 0xD4EA, 0xD4EA, 0xD4CA, 0xD4CA, 0xD4CA, 0xC489, 
-0x51E4, 0x20C2, 0x1081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x49A5, 0x0840, 0x0021, 0x0020, 0x0021, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x6247, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51E6, 0x1060, 0x8B26, 
-0xAC49, 0xEE4F, 0xEE6F, 0xF66F, 0xF68F, 0xF690, 0xF690, 0xF690, 0xF690, 0xF68F, 0xF68F, 0xF690, 0xF690, 0xF690, 0xF690, 0xF68F, 
-0xF6B0, 0xF690, 0xBD2C, 0x8B67, 0x3143, 0x0000, 0x0020, 0x51C5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x49A5, 0x0840, 0x0840, 0x0040, 0x0040, 0x0841, 0x0020, 0x0020, 0x0820, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 
-0x0021, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0021, 0x0020, 0x0020, 0x4165, 0x830A, 0x934B, 0xB40E, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51E6, 0x20E1, 0xCCAA, 
-0xCCEB, 0xEE0E, 0xEE2E, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF66F, 0xF64F, 
-0xF64F, 0xF64F, 0xDD8C, 0xC489, 0x5A24, 0x0020, 0x0020, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0x0020, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x6A48, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x20C1, 0xD52B, 
-0xDD4B, 0xE5ED, 0xEE2E, 0xEE4E, 0xEE4F, 0xEE4F, 0xEE4F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF66F, 0xF66F, 0xF66F, 0xF66F, 0xF64F, 
-0xEE4F, 0xEE4F, 0xDD8C, 0xC4A9, 0x5A65, 0x0020, 0x0020, 0x51C5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x6248, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xCC6F, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49C6, 0x1081, 0x5225, 
-0x5246, 0x5A66, 0x62A7, 0x62A7, 0x5A66, 0x5246, 0x9BE9, 0xDD4B, 0xDD6C, 0xDD8C, 0xD50B, 0xCCEB, 0x7B48, 0x5A86, 0x5A66, 0x5A66, 
-0x5266, 0x5266, 0x8B67, 0xC469, 0x5A44, 0x0820, 0x0020, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x6248, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51E6, 0x0020, 0x0841, 
-0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x7B27, 0xE58C, 0xE5AC, 0xDD8C, 0xD52B, 0xD50A, 0x3983, 0x0841, 0x0841, 0x0841, 
-0x0841, 0x0840, 0x6265, 0xCCCA, 0x5A24, 0x0841, 0x0020, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x6248, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x0840, 0x0840, 0x0861, 
-0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0820, 0x0840, 0x0841, 0x0820, 0x0820, 0x0841, 0x0841, 
-0x0821, 0x0840, 0x0820, 0x0820, 0x0841, 0x0861, 0x0861, 0x0840, 0x0840, 0x0840, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5204, 0x8B67, 
-0x8B47, 0x8B47, 0x8B67, 0x8B47, 0x8B67, 0x8B67, 0x3963, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x6248, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x5A28, 0x3124, 0x3124, 0x3124, 0x28E3, 0x28E3, 
-0x7288, 0xC40D, 0x6227, 0x3103, 0x2903, 0x28E3, 0x2903, 0x936C, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x0020, 0x1101, 0x3364, 
-0x3384, 0x3384, 0x3344, 0x1982, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x2AC3, 0x33A4, 0x33A4, 0x3384, 
-0x3344, 0x1942, 0x0840, 0x0841, 0x1061, 0x1081, 0x1061, 0x0841, 0x0840, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9367, 0xD4EA, 
-0xD4EA, 0xD4EA, 0xD4EA, 0xD4EA, 0xD4EA, 0xD4CA, 0x51E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6248, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x3944, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x59E6, 0xC40D, 0x49A5, 0x0020, 0x0020, 0x0020, 0x0020, 0x830B, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x0020, 0x1141, 0x3364, 
-0x3364, 0x3364, 0x3344, 0x1982, 0x0841, 0x0841, 0x2902, 0x5204, 0x51E4, 0x3983, 0x0841, 0x0841, 0x2AC3, 0x3384, 0x3384, 0x3364, 
-0x3364, 0x19A2, 0x0820, 0x0841, 0x5A45, 0x6265, 0x41A3, 0x1081, 0x0841, 0x0840, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x7A88, 0x7A88, 0x0840, 0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0xA44A, 0xA44A, 0xD56D, 0xE5CD, 
-0xE5CD, 0xE5CD, 0xE5CD, 0xE5CD, 0xE5CD, 0xE5CD, 0xBD0C, 0xA44A, 0x0020, 0x0840, 0x0840, 0x82EA, 0xABCD, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xAC0E, 0x51E7, 0x51E6, 0x18A2, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x1081, 0x20E2, 0x1061, 0x0020, 0x0020, 0x0020, 0x0020, 0x3144, 0x51E7, 0x51E7, 0xCCB1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x0020, 0x1162, 0x3364, 
-0x3364, 0x3364, 0x3364, 0x1962, 0x0820, 0x0841, 0x3983, 0xC469, 0xC469, 0x8B66, 0x0841, 0x0840, 0x2AC3, 0x3384, 0x3384, 0x3384, 
-0x3364, 0x19E2, 0x0020, 0x0020, 0xBCAA, 0xCCAA, 0xAC08, 0x2902, 0x18A1, 0x0840, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC6F, 0xCC6F, 0xCC6F, 0x0861, 0x1061, 0x1081, 0x1081, 0x1081, 0x1061, 0x18A2, 0x3963, 0xE62E, 0xEE0E, 0xEE4E, 0xF64F, 
-0xF64F, 0xF64F, 0xF66F, 0xF66F, 0xF66F, 0xF66F, 0xF64F, 0xF66F, 0x0820, 0x0861, 0x0861, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xA3CD, 0x0820, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0040, 0x0840, 0x0020, 0x0820, 0x0021, 0x0841, 0x0020, 0x0020, 0x0020, 0xC490, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x0000, 0x08A1, 0x1982, 
-0x1181, 0x19A2, 0x1981, 0x08A1, 0x0820, 0x0841, 0x3983, 0xC4A9, 0xC469, 0x8B46, 0x0020, 0x0020, 0x1101, 0x1161, 0x1161, 0x1981, 
-0x1961, 0x10C1, 0x0020, 0x0020, 0xC4CA, 0xD54B, 0xE5CD, 0xEDED, 0x7B47, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0x0841, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x41C4, 0xCCA9, 0xEE2E, 0xEE4F, 0xF64F, 0xF64F, 
-0xF66F, 0xF66F, 0xF66F, 0xF66F, 0xF66F, 0xF66F, 0xF64F, 0xF66F, 0x9367, 0x2902, 0x1061, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x830B, 0x49A6, 0x0040, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0820, 0x0041, 0x0020, 0x0020, 0x0020, 0x0841, 0x0821, 0x0020, 0x0040, 0x49C6, 0xA3CD, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x0000, 0x0820, 0x5204, 
-0x2902, 0x0020, 0x0000, 0x18A1, 0x4183, 0x62C7, 0x8BA8, 0xD52B, 0xD52B, 0xA429, 0x5A45, 0x18C2, 0x0840, 0x0820, 0x0820, 0x0820, 
-0x0820, 0x1081, 0x62A6, 0x62A6, 0xDD8D, 0xE5CD, 0xEE2E, 0xEE2E, 0x7B68, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0x0841, 0x1061, 0x1081, 0x1081, 0x1081, 0x39A4, 0x6A85, 0xCCCA, 0xD52B, 0x6286, 0x5A86, 0x5A66, 
-0x5A86, 0x5A86, 0x5A86, 0x6AC7, 0xEE0D, 0xEE0E, 0xDD8C, 0xDDAC, 0x49A3, 0x1061, 0x1061, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x51E7, 0x0020, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0821, 0x0840, 0x0821, 0x6A89, 0x9BAD, 0xB44F, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x18A2, 0x20E2, 0xCCEA, 
-0x6A65, 0x0840, 0x0820, 0x51E4, 0xA3A7, 0xE60E, 0xEE4F, 0xF64F, 0xEE4F, 0xE5CD, 0xDD4B, 0x41A3, 0x0841, 0x0841, 0x0841, 0x0841, 
-0x0841, 0x3163, 0xE5AD, 0xEE2E, 0xEE0E, 0xDDEE, 0xCD6D, 0xC56D, 0x62E7, 0x0020, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xC490, 0xA3AD, 0x0841, 0x1061, 0x1081, 0x1061, 0x1081, 0x7B06, 0xA3E8, 0xAC49, 0x93A7, 0x0840, 0x0841, 0x0841, 
-0x0861, 0x0841, 0x0841, 0x20E2, 0xBCEB, 0xBCEB, 0xB4AA, 0xAC69, 0x0020, 0x0840, 0x0841, 0xA3AC, 0xBC4F, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x51E6, 0x0821, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x3124, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xBC4F, 0x2903, 0x20E3, 0x28E3, 0x28E3, 0x20E3, 
-0xABEE, 0x9B8C, 0x28C3, 0x20C2, 0x20C2, 0x28E3, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCC6F, 0xCC6F, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49C6, 0x2102, 0xDDAD, 
-0xCD2C, 0xBCEB, 0xC52C, 0xCD6C, 0xDD8D, 0xEE2E, 0xF64F, 0xF64F, 0xF64F, 0xEE0E, 0xEE0E, 0xCD4D, 0xB4EC, 0xB4CB, 0xBCCC, 0xB4AB, 
-0xB4AB, 0xBCEB, 0xEDEE, 0xEE0E, 0xCCCA, 0x9387, 0x0000, 0xA36B, 0xAB8C, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0x830B, 0x0840, 0x0861, 0x1061, 0x1081, 0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x1101, 0x19A2, 0x19A2, 
-0x19A2, 0x1982, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0881, 0x10A1, 0x10A1, 0x0881, 0x0841, 0x6A68, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x49C6, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0040, 0x0021, 0x0020, 0x0020, 0x2903, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xB42F, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 
-0x9BAD, 0x832B, 0x0020, 0x0020, 0x0020, 0x0020, 0x5A06, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x2102, 0xB48A, 
-0xC50B, 0xEE2E, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xEE4F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 
-0xEE2E, 0xEE0E, 0xEE0E, 0xEDEE, 0xD50B, 0x8B47, 0x0820, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0x830B, 0x0841, 0x0841, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x2203, 0x3384, 0x3364, 
-0x3364, 0x3364, 0x0820, 0x0841, 0x0861, 0x0861, 0x0841, 0x1962, 0x2A83, 0x21C2, 0x1122, 0x0820, 0x6A68, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x49C6, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x28E3, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x9BAD, 0x20C3, 0x18A2, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x1061, 0x1061, 0x0020, 0x0020, 0x0020, 0x0020, 0x1061, 0x1882, 0x4165, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCC90, 0xCC6F, 0xCC6F, 0xCCB0, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x1061, 0x0000, 
-0x49C4, 0xAC8A, 0xDD8C, 0xE60E, 0xEE2E, 0xE5AD, 0xE5CD, 0xF64F, 0xF64F, 0xEE0E, 0xE5ED, 0xEE0E, 0xF64F, 0xF66F, 0xF64F, 0xF64F, 
-0xEE4F, 0xE5CD, 0xCCCB, 0xCCCB, 0x9BE8, 0x5A65, 0x1040, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0x830B, 0x0820, 0x7327, 0xD5AD, 0xBCEB, 0x72C6, 0x18A1, 0xBC89, 0xB448, 0x3142, 0x0841, 0x2223, 0x3384, 0x3384, 
-0x3B84, 0x3364, 0x0820, 0x18C1, 0xB449, 0xAC69, 0x0020, 0x2202, 0x3364, 0x3364, 0x3364, 0x0820, 0x6248, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x49C6, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x18C1, 0x20E2, 0x20E2, 0x20E2, 0x2102, 0x20E2, 0x1061, 0x0000, 0x0020, 0x0020, 0x0020, 0x2903, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xB44F, 0x6248, 0x0020, 0x0020, 0x0821, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x20A2, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xCC6F, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA38C, 0x2040, 
-0x0840, 0x1040, 0xC48A, 0xE5AC, 0xE5CD, 0xCC89, 0xCCCA, 0xF66F, 0xF64F, 0xE58C, 0xCCA9, 0xCCCA, 0xF66F, 0xF64F, 0xF64F, 0xF64F, 
-0xEE0E, 0xDD6C, 0x9942, 0x90E2, 0x9AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0x830B, 0x0020, 0x7B68, 0xF66F, 0xE5AD, 0xA3E8, 0x3983, 0xCCCA, 0xC469, 0x3963, 0x0820, 0x1982, 0x2AA3, 0x2AA3, 
-0x2AC3, 0x2263, 0x0020, 0x20E2, 0xCCA9, 0xC4A9, 0x0020, 0x2202, 0x3384, 0x3384, 0x3B84, 0x0020, 0x6A48, 0xCC90, 0xCC90, 0xCC90, 
-0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x49C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x9BC8, 0xD52B, 0xD52B, 0xD52B, 0xD52B, 0xDD2B, 0x5204, 0x0000, 0x0000, 0x0000, 0x0000, 0x2903, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x51C6, 0x0020, 0x0020, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xCC6F, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x8820, 
-0xE001, 0xE801, 0xDCCA, 0xE5CD, 0xE5CD, 0xCCA9, 0xCCCA, 0xF66F, 0xF64F, 0xDD8C, 0xC489, 0xCCCA, 0xF66F, 0xF64F, 0xF64F, 0xEE4E, 
-0xEDED, 0xDD4B, 0xB081, 0xC001, 0xAAA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0x830B, 0x0020, 0x7B68, 0xF64E, 0xEE2E, 0xEE0E, 0x7327, 0xDD6C, 0xD54B, 0x7B27, 0x41A4, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x39A4, 0x5A86, 0xDD4B, 0xD52B, 0x0841, 0x1921, 0x2263, 0x2202, 0x19E2, 0x0040, 0x6248, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x82EA, 0x49C6, 0x18C2, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x2922, 
-0x6B07, 0x6AE7, 0xBCCB, 0xDD8C, 0xDD8C, 0xDD8D, 0xDD8D, 0xDD8C, 0x9C09, 0x62C6, 0x5A85, 0x0020, 0x2903, 0x6248, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x51E6, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 
-0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x1081, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 
-0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA32B, 0x8041, 
-0xA000, 0xA000, 0x89C4, 0x8285, 0x8AA5, 0xBC28, 0xC489, 0xD50B, 0xD50B, 0xCCCA, 0xCC89, 0xCCAA, 0xD50B, 0xD50B, 0xCCAA, 0x8B06, 
-0x8AA6, 0x8A44, 0x9820, 0xA800, 0x8820, 0x7985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0x936C, 0x18C2, 0x41E5, 0x4205, 0x4205, 0x41E4, 0x3163, 0xF66F, 0xEE2F, 0xDD6C, 0xB4AA, 0x0820, 0x0820, 0x0820, 
-0x0820, 0x0820, 0x9409, 0xE5AD, 0xEE4F, 0xEE4F, 0x1061, 0x0841, 0x0841, 0x0841, 0x0841, 0x3144, 0x82EA, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x51E7, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0xAC09, 0xDD4C, 
-0xEE4E, 0xF64F, 0xF64F, 0xF66F, 0xF66F, 0xF64F, 0xF64F, 0xF64F, 0xF64E, 0xE5AD, 0xD54B, 0x0020, 0x6A68, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x49C6, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB6B, 0x8082, 
-0x8000, 0x8000, 0x6800, 0x6000, 0x5800, 0xC449, 0xCC89, 0xCCA9, 0xCCC9, 0xCCEA, 0xCCEA, 0xD4EA, 0xCCC9, 0xCC88, 0xBBE7, 0x5000, 
-0x5800, 0x6000, 0x9000, 0x9000, 0x8800, 0x7103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x0000, 0x9409, 0xA409, 0x18C1, 0xF66F, 0xF64F, 0xF64F, 0xF64F, 0xD5AE, 0xD5AE, 0xCDAE, 
-0xD5AE, 0xD5AE, 0xE62F, 0xF64F, 0xF64F, 0xEE4F, 0xBD2C, 0xBCEC, 0xB48A, 0x4A05, 0x3124, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x51E7, 0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x9BC8, 0xDD6C, 
-0xF66F, 0xF68F, 0xF690, 0xF690, 0xF690, 0xF66F, 0xF66F, 0xF64F, 0xF64F, 0xE5CD, 0xDD6B, 0x0020, 0x6A89, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x49C6, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8207, 0x70E3, 0x7800, 
-0x8000, 0x8800, 0x8800, 0x7800, 0x6800, 0x4881, 0x50E1, 0x50E1, 0x50C1, 0x50E1, 0x50E1, 0x50E1, 0x58E1, 0x58C1, 0x58C1, 0x6000, 
-0x8800, 0xA000, 0x9800, 0x9800, 0x8800, 0x80A2, 0x7A07, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x0020, 0xD5CE, 0xDD8C, 0x18A1, 0xEE4E, 0xEE2E, 0xF64F, 0xF66F, 0xF66F, 0xF66F, 0xF66F, 
-0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xEE2E, 0xE5AD, 0x5A65, 0x3944, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x5A27, 0x1081, 0x1082, 0x1082, 0x1082, 0x49C3, 0xB449, 0xD52B, 
-0xCD0B, 0x3163, 0x3984, 0x3184, 0x3164, 0x3184, 0x93C8, 0xDD4C, 0xD52B, 0xB449, 0x41A4, 0x0820, 0x6A89, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x49C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-0x41C4, 0x5224, 0x5224, 0x5224, 0x5224, 0x5224, 0x5224, 0x1061, 0x0020, 0x0000, 0x0020, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC42E, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x71A5, 0x5800, 0x8800, 
-0x9000, 0xA000, 0xA000, 0x9800, 0x8000, 0x6000, 0x6986, 0x828A, 0x828A, 0x7A8A, 0x826A, 0x828A, 0x828A, 0x6881, 0x6000, 0x7000, 
-0xA000, 0xB000, 0xB000, 0xB000, 0x9800, 0x8000, 0x4820, 0x9B0A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x3964, 0x2103, 0x2902, 0x1820, 0x61C4, 0x61E4, 0x9367, 0xD4EA, 0xD50A, 0xEE2E, 0xF64F, 
-0xF66F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xF64F, 0xEE0E, 0xD54C, 0x5225, 0x20C1, 0x3944, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x9BAD, 0x3144, 0x1081, 0x10A2, 0x10A2, 0x1081, 0x6245, 0x6AC5, 0x72C6, 
-0x72C6, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x41A3, 0x72E6, 0x72C6, 0x5A24, 0x0841, 0x0861, 0x3985, 0x832B, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x49C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x9387, 0xD4EA, 0xD4EA, 0xD4EA, 0xD4CA, 0xD4CA, 0xCCCA, 0x49C3, 0x0000, 0x0000, 0x0000, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xCC6F, 0xCC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x79C5, 0x5000, 0xC001, 
-0xC001, 0xD801, 0xD801, 0xD001, 0xB801, 0x7000, 0xAC51, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7DF, 0xF79E, 0x70C3, 0x7000, 0xC801, 
-0xD001, 0xE001, 0xD801, 0xD801, 0xB001, 0x9000, 0x4820, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x7185, 0x5821, 0x6021, 0x6021, 0x6821, 0x6020, 0x89C3, 0xAB67, 0xD50B, 0xEE2E, 0xF64F, 
-0xF64F, 0xF64E, 0xCCCA, 0xCCA9, 0xF66F, 0xF64F, 0xEE2E, 0xC4EB, 0x0820, 0x4165, 0x82EA, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x6A89, 0x0840, 0x1081, 0x10A2, 0x1082, 0x1061, 0x1061, 0x0861, 0x0861, 
-0x0881, 0x2AE4, 0x2AC3, 0x2AC3, 0x2A83, 0x0841, 0x0861, 0x0861, 0x0861, 0x1122, 0x2AE4, 0x2A83, 0x1962, 0x20C2, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xAC0E, 0x9B8D, 0x4185, 0x0841, 0x0841, 0x0861, 0x0861, 0x6AA6, 0xB46A, 
-0xE5EE, 0xEE2E, 0xEE2E, 0xEE2E, 0xEE2E, 0xEE2E, 0xEE2E, 0xCD0B, 0x7B27, 0x1061, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9AEA, 0x7903, 0x7000, 0xD001, 
-0xD001, 0xE001, 0xD801, 0xD801, 0xC801, 0x7800, 0xA410, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BF, 0xF7BE, 0x78E3, 0x8000, 0xD001, 
-0xD801, 0xE001, 0xD801, 0xD801, 0xC001, 0xA001, 0x6820, 0x79C6, 0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x6800, 0xB001, 0xD801, 0xD801, 0xD801, 0xD801, 0xA800, 0x88A1, 0xCD4B, 0xD58C, 0xDDAC, 
-0xEDEE, 0xEE0E, 0xCC89, 0xC469, 0xEE2E, 0xEE0E, 0xD58C, 0xB4CB, 0x1040, 0x830A, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x6A69, 0x0020, 0x5A66, 0x5A86, 0x49C4, 0x0841, 0x5204, 0x41A3, 0x0841, 
-0x10C1, 0x3384, 0x3384, 0x3384, 0x3324, 0x0020, 0x49C3, 0x5204, 0x2902, 0x1982, 0x3BA5, 0x3384, 0x2202, 0x18C2, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0x51E7, 0x0861, 0x1081, 0x1061, 0x1081, 0x9BA8, 0xDD6C, 
-0xEE2E, 0xF66F, 0xF66F, 0xF66F, 0xF66F, 0xF66F, 0xF64F, 0xE5AD, 0xA3E8, 0x51C3, 0x0841, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC6F, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5020, 0x8800, 0xA800, 0xE001, 
-0xE001, 0xE001, 0xD801, 0xD801, 0xC801, 0x7800, 0x9BEF, 0xF79E, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0x80E3, 0x8800, 0xD801, 
-0xE001, 0xE001, 0xE001, 0xE001, 0xD801, 0xC801, 0x8800, 0x6000, 0x7185, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x40A2, 0x6800, 0xB001, 0xD801, 0xD801, 0xD801, 0xA800, 0x7800, 0x5800, 0x5000, 0x6020, 
-0xCCAA, 0xC489, 0xCC89, 0xC469, 0xC468, 0xC448, 0x2800, 0x40A2, 0xB40E, 0xC44F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x6A69, 0x0020, 0xF6B0, 0xEE4F, 0xB429, 0x0020, 0xCCC9, 0x8B67, 0x0020, 
-0x0881, 0x3344, 0x3364, 0x3364, 0x3303, 0x0020, 0xA3C7, 0xC489, 0x5A04, 0x1962, 0x3BA4, 0x3B84, 0x2203, 0x18C2, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0xCCD1, 0x51E7, 0x0861, 0x1082, 0x1081, 0x20E2, 0xA3E8, 0xD50B, 
-0x7307, 0x5AA6, 0x5A86, 0x5AA6, 0x5A86, 0xA429, 0xDDAC, 0xD50A, 0x9387, 0x3122, 0x0841, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0xC3ED, 0x7021, 0x9800, 0xB800, 0xE001, 
-0xE001, 0xE001, 0xD801, 0xC801, 0xA000, 0x7000, 0x6904, 0x8AEB, 0xC5F7, 0xDEDB, 0xDEBA, 0x9BAF, 0x79C7, 0x7000, 0x8000, 0xD801, 
-0xE001, 0xE001, 0xE001, 0xE001, 0xD801, 0xC801, 0xA000, 0x5000, 0x7185, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0x8A89, 0x58A2, 0x6800, 0x8000, 0x9000, 0x9000, 0xB000, 0xC000, 0xA800, 0xA000, 0xA000, 0x8820, 
-0x8A64, 0x8244, 0x8A64, 0x8A64, 0x8244, 0x9244, 0x6020, 0x5861, 0x8247, 0xA38C, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x6A89, 0x0020, 0xF6D0, 0xF64F, 0xF66F, 0x6AC6, 0xD52B, 0xA429, 0x20E2, 
-0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x2102, 0xAC49, 0xD50B, 0x7B27, 0x2962, 0x1141, 0x1962, 0x1142, 0x20C3, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0x936C, 0x2924, 0x1061, 0x1081, 0x1081, 0x2102, 0x72C5, 0x72C6, 
-0x20C2, 0x0841, 0x0841, 0x0841, 0x0840, 0x41C3, 0x72E6, 0x72E6, 0x49E4, 0x0861, 0x0861, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6944, 0x6882, 0xA801, 0xB800, 0xD801, 0xE001, 
-0xE001, 0xE001, 0xD801, 0xC001, 0xA800, 0x6800, 0x6000, 0x6965, 0xBD76, 0xD69A, 0xCE39, 0x8229, 0x6000, 0x8800, 0x9000, 0xD801, 
-0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 0xD801, 0xC801, 0x6000, 0x7144, 0xAB4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0x5020, 0x6800, 0x6800, 0x6800, 0x6800, 0x6000, 0x9800, 0xD801, 0xE001, 0xE001, 0xD801, 0x9800, 
-0x5000, 0x4800, 0x4800, 0x4800, 0x5800, 0x8800, 0x9000, 0x8000, 0x5820, 0x8268, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x8B4B, 0x3124, 0x41C4, 0x4A05, 0x41E4, 0x1081, 0xF66F, 0xEE2E, 0xAC6A, 
-0x0820, 0x0841, 0x1061, 0x0841, 0x0020, 0xDD4B, 0xE5CD, 0xEE2E, 0xDD6C, 0x8B67, 0x0841, 0x0841, 0x18C2, 0x5A07, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCB0, 0x51E6, 0x0861, 0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x0820, 
-0x1121, 0x2AC3, 0x2AA3, 0x2AC3, 0x0840, 0x0861, 0x0841, 0x0841, 0x1101, 0x2AA3, 0x2AA3, 0x0040, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6903, 0x6000, 0xB801, 0xC801, 0xD801, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xC001, 0xA800, 0x6800, 0x6000, 0x6945, 0xB514, 0xD69A, 0xCE38, 0x81E7, 0x6800, 0x9800, 0x9800, 0xD801, 
-0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 0xD801, 0xD001, 0x6800, 0x5020, 0x4840, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0x5800, 0x8800, 0xA000, 0xA000, 0xA000, 0xA000, 0xA800, 0xB000, 0xA000, 0x8800, 0x7000, 0x930C, 
-0xDE79, 0xDEBA, 0xE6BA, 0xD5F7, 0x6800, 0xD001, 0xB801, 0x8000, 0x8227, 0xB3ED, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xB42F, 0x0000, 0xDDCE, 0xD58D, 0x2902, 0xF68F, 0xF64F, 0xEE2E, 
-0xD5CE, 0xD5CE, 0xD5CE, 0xDDCE, 0xD5AD, 0xEE4F, 0xEE2F, 0xF64F, 0xEE2E, 0xD56D, 0xC50C, 0x3163, 0x6A68, 0xCC6F, 0xCC6F, 0xCC6F, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0x51E6, 0x3163, 0x9C09, 0x8BA8, 0x5204, 0x72A5, 0x8326, 0x0840, 
-0x19A2, 0x3384, 0x3364, 0x3BA4, 0x0020, 0x41A3, 0x8306, 0x2102, 0x1962, 0x3384, 0x3364, 0x0840, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC6F, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC6F, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCB0, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6924, 0x7800, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xE001, 0xD001, 0xC001, 0x9800, 0x7000, 0x60C3, 0xC5D7, 0xA410, 0x6000, 0x8800, 0xA800, 0xC801, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 0xD801, 0xD801, 0xB000, 0x8800, 0x5820, 0xB38C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x8A48, 0x7800, 0x9800, 0xB801, 0xC801, 0xD001, 0xC801, 0xD001, 0xC001, 0xA000, 0x7000, 0x5800, 0x934D, 
-0xD6BA, 0xEF3C, 0xEF7D, 0xDE9A, 0x6800, 0xD801, 0xC801, 0x7861, 0xCC8F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xB44F, 0x1061, 0xDDCE, 0xEE2E, 0x3963, 0xF6B0, 0xF6B0, 0xF66F, 
-0xF66F, 0xF66F, 0xF66F, 0xF64F, 0xF66F, 0xF64F, 0xF64F, 0xF64F, 0xF66F, 0xF68F, 0xF66F, 0x41E4, 0x6A89, 0xC40D, 0xC40D, 0xC40D, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0x51C6, 0x41E5, 0xF64F, 0xE5CD, 0x93A8, 0x9B87, 0xC489, 0x1061, 
-0x10E1, 0x19E2, 0x19E2, 0x21E2, 0x0000, 0x6A85, 0xC469, 0x41A3, 0x1141, 0x2B04, 0x2AC3, 0x0860, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0x9AEA, 0x60E3, 0xA862, 0xD001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xE001, 0xD001, 0xB801, 0x9800, 0x7800, 0x68A3, 0xB534, 0x9B8E, 0x6800, 0xA000, 0xB801, 0xD001, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 0xD801, 0xB000, 0x8800, 0x5820, 0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8268, 0x4800, 0x9800, 0xB001, 0xD801, 0xD801, 0xE001, 0xE001, 0xE001, 0xD001, 0xB800, 0x7800, 0x6000, 0x82CB, 
-0xC5B6, 0xCE38, 0xEF5D, 0xDE7A, 0x6000, 0xD801, 0xD801, 0x7862, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x830B, 0x1020, 0x0800, 0x1000, 0x2020, 0x8264, 0xBC07, 
-0xC468, 0xC449, 0xF66F, 0xF64F, 0xF64F, 0xEE0E, 0xEE2E, 0xF64F, 0xD50B, 0x9347, 0x1040, 0x0020, 0x7ACA, 0xC40D, 0xC40D, 0xC40D, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0x5A07, 0x3984, 0xB4CB, 0xB4CB, 0x6AE6, 0xB4EB, 0xEE2E, 0xCD6C, 
-0x3163, 0x0020, 0x0000, 0x0000, 0x9C29, 0xDDCD, 0xEE0E, 0xAC49, 0x4163, 0x0020, 0x0020, 0x0841, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0x92A9, 0x5800, 0xB000, 0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xE001, 0xC801, 0xB801, 0xA000, 0x8800, 0x70A3, 0xACB2, 0x932C, 0x7800, 0xA800, 0xC001, 0xD001, 0xE001, 
-0xD801, 0xE001, 0xE001, 0xD801, 0xD801, 0xD801, 0xE001, 0xB801, 0x9000, 0x6000, 0x6103, 0x8AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA32A, 0x6985, 0x5800, 0xC801, 0xD801, 0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 0xC000, 0x8000, 0x7000, 
-0x5800, 0x58E4, 0xDEFB, 0xC5B6, 0x5000, 0x9000, 0xA000, 0x4082, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xB3ED, 0x5061, 0xB801, 0xB801, 0xC001, 0xC801, 0x9061, 0x80C1, 
-0xA2A6, 0xE5ED, 0xEE4F, 0xEE4E, 0xEE0E, 0xC469, 0xD52B, 0xF64F, 0xE5CD, 0xB3C8, 0x2840, 0x9BAD, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCB0, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0x9B6C, 0x0000, 0x41E4, 0x3983, 0xB4EB, 0xF64F, 0xEE2E, 
-0xBD0C, 0x9C6B, 0x9C6B, 0x9C6B, 0xD5CE, 0xEE4F, 0xF66F, 0xDDCD, 0xBCEC, 0x8C0A, 0x1061, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AA8, 0x5800, 0xC001, 0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xD001, 0xB801, 0xD801, 0xE001, 0xD801, 0xD001, 0xC801, 0xB000, 0x8862, 0x932C, 0x8208, 0x8800, 0xB801, 0xD801, 0xE001, 0xE001, 
-0xD801, 0xD801, 0xB801, 0xA000, 0xD001, 0xD801, 0xD801, 0xD001, 0xA000, 0x8000, 0x5800, 0x8A68, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7185, 0x5000, 0x8000, 0xC801, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 0xD801, 0xD001, 0x9000, 0x8000, 
-0x6800, 0x60A2, 0xB555, 0x9C10, 0x5000, 0x8000, 0x9800, 0x4020, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xBBCC, 0x81E6, 0xA001, 0xC001, 0xD801, 0xD801, 0xB800, 0x9000, 
-0x78A1, 0x71A3, 0x71A3, 0xBC49, 0xCCCA, 0xCC89, 0xCCAA, 0xCCCA, 0x8B06, 0x59C5, 0x7AC9, 0xAC0E, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0x9B8C, 0x0020, 0xBD0C, 0x93E9, 0xB4EB, 0xF66F, 0xF66F, 
-0xF66F, 0xF64F, 0xF66F, 0xF66F, 0xF66F, 0xF66F, 0xF64F, 0xF66F, 0xF66F, 0xD5AD, 0x1882, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8A89, 0x8985, 0x8821, 0xD001, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0x9800, 0x5800, 0xE001, 0xD801, 0xD801, 0xD801, 0xD001, 0xC001, 0x9800, 0x6041, 0x6800, 0x9800, 0xC001, 0xD801, 0xE001, 0xE001, 
-0xE001, 0xD801, 0x8000, 0x4000, 0xA801, 0xD801, 0xE001, 0xD801, 0xB800, 0x9000, 0x6800, 0x7985, 0x9B0A, 0xC40D, 0xC40D, 0xC40D, 
-0xB38C, 0x7944, 0x7000, 0xC001, 0xD801, 0xE001, 0xE001, 0xC801, 0xA000, 0xD001, 0xE001, 0xE001, 0xE001, 0xE001, 0xC001, 0xC801, 
-0x9800, 0x6862, 0xAD14, 0x9BAF, 0x5800, 0xA800, 0xC801, 0x4800, 0xBC0E, 0xCC6F, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xBBCC, 0x79A5, 0x7800, 0x9000, 0x9000, 0x9000, 0xC000, 0xB800, 
-0xA000, 0x9000, 0x6000, 0x8A64, 0x92E5, 0x92E5, 0x92E5, 0x92A5, 0x7922, 0x68A2, 0x9B0B, 0xBC4F, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x932B, 0x20E2, 0x18A1, 0x1881, 0x2902, 0xBC08, 
-0xBC28, 0xE5CD, 0xD52B, 0xEDED, 0xCCCA, 0xDD4C, 0xF64E, 0xDD4B, 0xA3C8, 0x3964, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCC6F, 0xCC6F, 0xCCB0, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCB0, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4000, 0x8000, 0xD001, 0xD801, 0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 
-0x9800, 0x5800, 0xE001, 0xE001, 0xE001, 0xD001, 0xB801, 0xC001, 0xA000, 0x6800, 0x8000, 0xC001, 0xD801, 0xE001, 0xE001, 0xE001, 
-0xE001, 0xD801, 0x7800, 0x4000, 0xA801, 0xD001, 0xE001, 0xE001, 0xC801, 0xA801, 0x9000, 0x6000, 0x5123, 0xC40D, 0xC40D, 0xC40D, 
-0x5082, 0x7000, 0xA001, 0xD801, 0xE001, 0xE001, 0xE001, 0xA800, 0x4800, 0xB001, 0xE001, 0xE001, 0xE001, 0xE001, 0xD001, 0xD801, 
-0xA800, 0x7041, 0xA492, 0x9B8E, 0x5800, 0xC801, 0xE001, 0x5800, 0x4820, 0x8A68, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 
-0xC44E, 0xC44E, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x92EA, 0x6000, 0x6800, 0x6000, 0x5800, 0x5800, 0xB000, 0xD001, 
-0xD801, 0xD801, 0x7800, 0x5000, 0x5000, 0x5000, 0x5000, 0x6000, 0x8000, 0x8800, 0x5020, 0x8AEA, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xBC0E, 0x68C3, 0xB021, 0xC801, 0xB801, 0xB801, 0x9102, 
-0xB326, 0xE5CD, 0xE58C, 0xEE2E, 0xCCEA, 0xD54B, 0xEE4E, 0xE5AC, 0xAC08, 0x28A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xCC6F, 0xCC6F, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4000, 0x8800, 0xD801, 0xD801, 0xD801, 0xC001, 0x9800, 0xC001, 0xD801, 
-0xA800, 0x7000, 0xD801, 0xD801, 0xD801, 0xD801, 0xD801, 0xD001, 0xB000, 0x6800, 0x8000, 0xC001, 0xD801, 0xE001, 0xE001, 0xD801, 
-0xD801, 0xD801, 0x7800, 0x4000, 0xA001, 0xC801, 0xD801, 0xD801, 0xC801, 0xB801, 0xA800, 0x6800, 0x5903, 0xC40D, 0xC40D, 0xC3ED, 
-0x4861, 0x8000, 0xB001, 0xE001, 0xE001, 0xE001, 0xE001, 0xA801, 0x5000, 0xB001, 0xE001, 0xE001, 0xE001, 0xE001, 0xD801, 0xD801, 
-0xB801, 0x7821, 0xA451, 0x934D, 0x6000, 0xD001, 0xD801, 0x7000, 0x5800, 0x8268, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 
-0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0x92CA, 0x6800, 0x8000, 0x8800, 0x8800, 0x9000, 0x9800, 0x9800, 
-0x8000, 0x6000, 0xB430, 0xDEBA, 0xDEDA, 0xDEBA, 0xE6DA, 0x7021, 0xC001, 0xB001, 0x6985, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x92CA, 0xC001, 0xD801, 0xD801, 0xD801, 0x8800, 
-0x6800, 0x5000, 0x68E1, 0xC469, 0xCC89, 0xC469, 0xC469, 0x61C3, 0x38C2, 0x9B0A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0x4000, 0x8000, 0xE001, 0xD801, 0xD801, 0xB001, 0x5800, 0xB000, 0xD801, 
-0xB800, 0x8800, 0xD801, 0xD801, 0xD801, 0xD801, 0xD801, 0xD001, 0xB801, 0x6800, 0x8000, 0xB801, 0xD801, 0xE001, 0xD801, 0xD801, 
-0xD801, 0xC801, 0x7000, 0x4800, 0xA000, 0xB801, 0xD801, 0xD801, 0xD001, 0xC001, 0xA800, 0x6800, 0x5924, 0xC40D, 0xBBCD, 0xAB4B, 
-0x5041, 0x9801, 0xD001, 0xE001, 0xD801, 0xC001, 0xE001, 0xB001, 0x6800, 0xB801, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 0xD801, 
-0xC001, 0x9800, 0x8A8A, 0x828A, 0x6800, 0xD001, 0xD801, 0x9800, 0x7800, 0x89E6, 0xAB8C, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x8AA9, 0x5800, 0x9000, 0xD001, 0xE001, 0xE001, 0xE001, 0xD801, 0xB800, 
-0x8800, 0x6000, 0xA410, 0xE6FB, 0xEF7D, 0xEF7D, 0xF77D, 0x6841, 0xD001, 0x9001, 0x92A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6103, 0x5800, 0x5800, 0x7000, 0xA000, 0xD001, 
-0xC801, 0xC001, 0x7800, 0x58E1, 0x58E1, 0x58C1, 0x60C1, 0x6860, 0x6000, 0x50C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 
-0xC40D, 0xCC6F, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xCC6F, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC44E, 0xCC6F, 0xCC90, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0x4000, 0x8800, 0xD801, 0xD801, 0xD001, 0xA000, 0x6000, 0x9800, 0xC801, 
-0xA800, 0x9000, 0xB801, 0xC001, 0xD001, 0xD801, 0xD801, 0xD801, 0xB801, 0x6800, 0x8800, 0xB000, 0xC801, 0xC801, 0xC001, 0xC001, 
-0xC001, 0xB801, 0x7800, 0x4800, 0x7000, 0x8000, 0xD801, 0xD801, 0xD001, 0xC001, 0xA800, 0x7000, 0x5923, 0xC40D, 0x8A88, 0x4820, 
-0x8800, 0xC001, 0xE001, 0xE001, 0xB000, 0x6000, 0xE001, 0xC801, 0xB001, 0xC001, 0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xC801, 0xB800, 0x6020, 0x71E7, 0x7000, 0xD001, 0xD801, 0xD801, 0xB000, 0x8000, 0x4020, 0xCC6F, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 
-0xC42E, 0xC44E, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x8A69, 0x6000, 0xA000, 0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 0xD801, 
-0xB000, 0x7000, 0x8229, 0xAC71, 0xDEBA, 0xE6FB, 0xB4B2, 0x7000, 0xD001, 0x8800, 0x9AA8, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCC6F, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0x7A07, 0x6841, 0x7000, 0x8000, 0x8000, 0x9800, 0xA800, 
-0x8800, 0x8000, 0x7082, 0xB4F3, 0xB4D3, 0x8AEB, 0x8000, 0xB800, 0x6082, 0x71E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xCC6F, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 
-0xC40D, 0xC44E, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCB0, 0xCCB0, 0xCCB0, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0x4000, 0x8800, 0xD801, 0xD801, 0xD001, 0xB000, 0xA000, 0xA800, 0x8000, 
-0x7800, 0x7800, 0xC001, 0xD001, 0xD801, 0xD801, 0xD801, 0xD801, 0xC801, 0x8800, 0xA000, 0xD001, 0xD001, 0xD001, 0xD001, 0xD801, 
-0xD801, 0xC801, 0x7800, 0x4800, 0x9000, 0xC001, 0xE001, 0xD801, 0xD801, 0xD001, 0xB000, 0x7000, 0x5923, 0xC40D, 0x8A88, 0x4800, 
-0xB001, 0xD001, 0xE001, 0xE001, 0xB801, 0x6000, 0xE001, 0xD001, 0xB001, 0xB800, 0xD001, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xD001, 0xC801, 0x6800, 0x6986, 0x7800, 0xD801, 0xD801, 0xD801, 0xB801, 0x8800, 0x4800, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xCC90, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0x8A89, 0x6061, 0x8000, 0xC001, 0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xC001, 0x9000, 0x7000, 0x79E7, 0xBD96, 0xCDF7, 0x5800, 0x7000, 0xA800, 0x5800, 0x92A8, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AA9, 0x6861, 0x8800, 0xC801, 0xD801, 0xD801, 0xC801, 0xC800, 
-0x7800, 0x6000, 0x7104, 0xF79E, 0xF79E, 0xB4D3, 0xA000, 0xD801, 0x6903, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCB0, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCCD1, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4000, 0x9000, 0xE001, 0xD801, 0xD801, 0xC801, 0xC800, 0xA800, 0x5800, 
-0x5800, 0x5800, 0xC801, 0xD801, 0xE001, 0xE001, 0xD801, 0xE001, 0xC801, 0x9800, 0xB000, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xD801, 0xD801, 0x7800, 0x5000, 0xA000, 0xD801, 0xE001, 0xE001, 0xE001, 0xD801, 0xB801, 0x7000, 0x5923, 0xC40D, 0x8A88, 0x4800, 
-0xC801, 0xD801, 0xE001, 0xE001, 0xC001, 0x7800, 0x8000, 0xB801, 0xD001, 0xA000, 0xA000, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xD801, 0xC801, 0x8000, 0x6800, 0xD001, 0xE001, 0xD801, 0xD801, 0xC801, 0xB000, 0xA000, 0x4820, 0x7207, 0xC40D, 0xC40D, 0xCC90, 
-0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0x79C6, 0x7000, 0x9800, 0xD801, 0xE001, 0xE001, 0xD801, 0xD801, 0xE001, 0xE001, 
-0xD001, 0xB000, 0x9800, 0x8924, 0xA410, 0xC5D7, 0x6000, 0x8800, 0xC801, 0x5800, 0x9288, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6923, 0x8000, 0xA800, 0xD801, 0xE001, 0xE001, 0xE001, 0xD801, 
-0x9800, 0x8000, 0x7904, 0xF7BE, 0xF7BE, 0xB4D3, 0xA000, 0xD801, 0x5923, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xC44E, 0xC44E, 0xCCB0, 
-0xCC90, 0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCB0, 
-0xCC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4000, 0x8800, 0xD801, 0xD801, 0xD801, 0xD801, 0xD001, 0xB000, 0x5000, 
-0x5800, 0x5800, 0xC001, 0xD001, 0xE001, 0xE001, 0xE001, 0xE001, 0xD001, 0xA000, 0xB800, 0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xE001, 0xD801, 0x7800, 0x5000, 0x9000, 0xB801, 0xE001, 0xE001, 0xE001, 0xD801, 0xB000, 0x6820, 0x5124, 0xC40D, 0x8A88, 0x4800, 
-0xC801, 0xD801, 0xE001, 0xE001, 0xC801, 0x8800, 0x7800, 0xB001, 0xD001, 0x9000, 0x8000, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xD801, 0xD001, 0x9800, 0x6800, 0xD001, 0xD801, 0xD001, 0xC001, 0xD001, 0xB801, 0xA800, 0x4800, 0x7A07, 0xC40D, 0xC40D, 0xCC90, 
-0xCC6F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0x6965, 0x8041, 0xB001, 0xD801, 0xD801, 0xE001, 0xC801, 0x4800, 0xC001, 0xE001, 0xE001, 
-0xE001, 0xD801, 0xC001, 0x9800, 0x70A3, 0xBD35, 0x6000, 0x9800, 0xD801, 0x8000, 0x6861, 0x79E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6944, 0x7041, 0xB000, 0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xC001, 0xB800, 0x9800, 0x5000, 0xD69A, 0x9BEF, 0x6000, 0x9800, 0x5944, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCC6F, 0xCC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC44E, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 
-0xCCB0, 0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC6F, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 0xCCD1, 
-0xCCD1, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3820, 0x7000, 0xA801, 0xD001, 0xD801, 0xD801, 0xD801, 0xB800, 0x7800, 
-0x8800, 0xA800, 0xC801, 0xD801, 0xE001, 0xE001, 0xD801, 0xE001, 0xC001, 0x8000, 0xA800, 0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xE001, 0xD801, 0x7800, 0x5000, 0x8000, 0x9800, 0xE001, 0xE001, 0xE001, 0xD001, 0x6000, 0x8207, 0xAB8C, 0xC40D, 0x8A88, 0x4800, 
-0xD001, 0xD801, 0xE001, 0xE001, 0xD801, 0xD001, 0xD001, 0xC001, 0xA000, 0x7000, 0x6800, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xD801, 0xD001, 0xB000, 0x8000, 0xD001, 0xD801, 0xC001, 0xA000, 0xC801, 0xB801, 0xA000, 0x4000, 0x7A07, 0xC40D, 0xC40D, 0xCC90, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6903, 0x9000, 0xC001, 0xE001, 0xE001, 0xE001, 0xC801, 0x4800, 0xB801, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xC801, 0xA000, 0x7061, 0xAC92, 0x6000, 0xA000, 0xE001, 0xA800, 0x7000, 0x71A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB38C, 0x6081, 0x8800, 0xC001, 0xE001, 0xE001, 0xB001, 0xB801, 0xE001, 0xE001, 
-0xD801, 0xC801, 0xB000, 0x6800, 0xB534, 0x8B2C, 0x8000, 0xC001, 0x50E3, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xCC90, 0xCC90, 0xCC90, 0xCC90, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4924, 0x70C3, 0x9000, 0xB801, 0xC001, 0xC001, 0xC001, 0xA800, 0x9000, 
-0xA000, 0xB800, 0xD801, 0xE001, 0xE001, 0xD801, 0xD801, 0xD801, 0xB000, 0x7800, 0xA000, 0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xE001, 0xD001, 0xA800, 0x9000, 0x7000, 0x7800, 0xB001, 0xB801, 0xC001, 0xA000, 0x4800, 0x92A9, 0xC40D, 0xC40D, 0x8A88, 0x5000, 
-0xD801, 0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 0xB800, 0x8000, 0x6000, 0x7000, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xE001, 0xD801, 0xB001, 0x8800, 0xE001, 0xE001, 0xB800, 0x7800, 0xBA65, 0xC2C6, 0xC327, 0x4000, 0x7A07, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x92C9, 0x7861, 0xA000, 0xC801, 0xE001, 0xC801, 0xD801, 0xC801, 0x4800, 0xB801, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xD001, 0xC001, 0x9821, 0x7A28, 0x5800, 0xA000, 0xE001, 0xC001, 0x8000, 0x7185, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4020, 0x8000, 0xC801, 0xD801, 0xE001, 0xD801, 0x6800, 0x6000, 0xD801, 0xE001, 
-0xE001, 0xD801, 0xC801, 0x7800, 0x936E, 0x8269, 0x9000, 0xE001, 0x4000, 0xB38C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8A88, 0x4800, 0x6800, 0x7800, 0x8000, 0x8000, 0x8000, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 0xD801, 0xD801, 0xD001, 0xA800, 0x7800, 0xA000, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xD801, 0xD801, 0xB000, 0x9800, 0x6800, 0x5800, 0x6800, 0x6800, 0x6000, 0x6020, 0x4820, 0x8AA8, 0xC40D, 0xC40D, 0x8288, 0x4000, 
-0xD801, 0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 0xD001, 0xB800, 0x8000, 0x7800, 0x8000, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xB800, 0x8800, 0xE001, 0xE001, 0xA800, 0x5000, 0xD4EB, 0xEDCD, 0xF62E, 0x3800, 0x7A07, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4800, 0xB001, 0xD001, 0xE001, 0xD801, 0x9000, 0xC801, 0xC801, 0x4800, 0xB801, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xD801, 0xD001, 0xA800, 0x6020, 0x6000, 0xB000, 0xE001, 0xD001, 0x8800, 0x8185, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5000, 0xA801, 0xD001, 0xE001, 0xE001, 0xD801, 0x6000, 0x5800, 0xD801, 0xE001, 
-0xE001, 0xD801, 0xD001, 0x9800, 0x92EB, 0x7A08, 0x9000, 0xD801, 0x5000, 0x9AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB6B, 0x7A06, 0x6082, 0x5820, 0x6000, 0x7000, 0x7000, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 0xD801, 0xC001, 0x8000, 0x5800, 0x9000, 0xD801, 0xD801, 0xE001, 0xE001, 0xE001, 
-0xD801, 0xD001, 0xA800, 0x8800, 0x6800, 0x5800, 0x6000, 0x81C6, 0xAB4B, 0xAB8C, 0xB3AC, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 
-0x7020, 0xA801, 0xC001, 0xE001, 0xD801, 0xD801, 0xB000, 0xA000, 0x9800, 0xB000, 0xB801, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xB000, 0x7800, 0xE001, 0xE001, 0xA800, 0x5000, 0xD50B, 0xEDCD, 0xEE0D, 0x3000, 0x7207, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5000, 0xC001, 0xD801, 0xE001, 0xD001, 0x7000, 0xC001, 0xD001, 0x8800, 0xC801, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xD801, 0xB000, 0x5800, 0x7000, 0xC001, 0xD801, 0xD801, 0xA001, 0x88A2, 0x7924, 0x69A5, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6985, 0x8800, 0xC801, 0xE001, 0xB801, 0x9000, 0xD801, 0xA800, 0xA000, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xD801, 0xB000, 0x6862, 0x6041, 0xA000, 0xD801, 0x6000, 0x5820, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x9B0A, 0x8A68, 0x4800, 0x5800, 0x7000, 0xD001, 
-0xD801, 0xE001, 0xE001, 0xE001, 0xE001, 0xD801, 0xD801, 0xC801, 0x9000, 0x6000, 0x9800, 0xE001, 0xD801, 0xE001, 0xE001, 0xE001, 
-0xD801, 0xD801, 0xB000, 0x8800, 0x7000, 0x6800, 0x5800, 0x9288, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x8227, 0x80E3, 0x8000, 0xB800, 0xB801, 0xB801, 0x8000, 0x8800, 0xB000, 0xD001, 0xD001, 0xE001, 0xE001, 0xE001, 0xE001, 0xE001, 
-0xD801, 0xE001, 0xA800, 0x6800, 0xE001, 0xD801, 0xB000, 0x5000, 0x79C4, 0x8265, 0x7A45, 0x7A47, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5000, 0xC801, 0xD801, 0xE001, 0xD001, 0x7800, 0x9800, 0xB800, 0xA800, 0xD001, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xD801, 0xB801, 0x6000, 0x9000, 0xE001, 0xE001, 0xD801, 0xC801, 0xA800, 0x8000, 0x58A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4800, 0xB801, 0xD801, 0xE001, 0xB800, 0x8000, 0xC801, 0xB801, 0xB801, 0xC001, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xD001, 0x8800, 0x8000, 0xC801, 0xD801, 0xA800, 0x5820, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x5144, 0x6103, 0x4800, 0xA000, 
-0xB000, 0xB000, 0xB001, 0xB001, 0xB001, 0xB001, 0xA801, 0xA800, 0x8800, 0x5000, 0x7800, 0xB000, 0xB000, 0xB000, 0xB000, 0xB001, 
-0xB001, 0xA800, 0x9000, 0x7000, 0x6000, 0x6041, 0x5903, 0x9B0A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x79A5, 0x5800, 0x8800, 0x8800, 0x9000, 0x7000, 0x8000, 0xA800, 0xC001, 0xC001, 0xC801, 0xC801, 0xC001, 0xC001, 0xC001, 
-0xC001, 0xC001, 0x9800, 0x6000, 0xB801, 0xB001, 0x8800, 0x5000, 0x5841, 0x5881, 0x5923, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5800, 0xC001, 0xD801, 0xD801, 0xD801, 0xD801, 0x6800, 0x7800, 0xA800, 0x6000, 0xA000, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xE001, 0xC001, 0x6800, 0xA000, 0xD801, 0xD001, 0xC001, 0xD001, 0xB001, 0x8800, 0x50A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4000, 0xB801, 0xD801, 0xE001, 0xB801, 0x7000, 0xA000, 0xC001, 0xB000, 0x8000, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xD801, 0x9800, 0x9800, 0xE001, 0xE001, 0xD801, 0x8021, 0x9AC9, 0x9B0A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x2000, 0x7800, 
-0x9800, 0x9800, 0xA000, 0xA000, 0xA000, 0x9800, 0x9800, 0x9800, 0x7000, 0x5000, 0x6800, 0x9800, 0x9800, 0xA000, 0x9800, 0x9800, 
-0x9800, 0x9000, 0x8000, 0x7000, 0x2800, 0x5123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7A27, 0x50A2, 0x5000, 0x5800, 0x7000, 0x7800, 0x8000, 0x9000, 0x9800, 0x9800, 0x9800, 0x9800, 0x9800, 0x9800, 0x9000, 
-0x9000, 0x9000, 0x7800, 0x5800, 0x6800, 0x6000, 0x4800, 0x48C2, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5000, 0xC001, 0xD801, 0xD801, 0xD801, 0xD801, 0x6800, 0x7800, 0xA000, 0x5800, 0xB000, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xD801, 0xC801, 0x6800, 0x9000, 0xD001, 0xB801, 0x7800, 0xD225, 0xBA05, 0x8923, 0x50A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4800, 0xB801, 0xE001, 0xE001, 0xE001, 0xC001, 0x6000, 0x9800, 0xA000, 0x9000, 0xE001, 
-0xE001, 0xE001, 0xD801, 0xD801, 0x9800, 0x9000, 0xE001, 0xD801, 0xC801, 0xA000, 0x7800, 0x4000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x40C2, 0x6800, 
-0x7800, 0x7800, 0x8000, 0x8000, 0x8000, 0x7800, 0x7800, 0x7800, 0x6000, 0x4000, 0x5800, 0x7800, 0x7800, 0x8000, 0x8800, 0x8000, 
-0x7800, 0x7800, 0x6800, 0x5800, 0x3081, 0x7227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC3ED, 0x4020, 0x5800, 0x8000, 0x9800, 0xA000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 
-0xB000, 0xA800, 0x8800, 0x7800, 0x8000, 0x8000, 0x5800, 0x48C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5000, 0xC001, 0xD801, 0xD801, 0xD801, 0xD001, 0x6000, 0x6000, 0x7800, 0xA800, 0xD001, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xD801, 0xD001, 0x7000, 0x9801, 0xE001, 0xB001, 0x4800, 0xF60E, 0xEDCD, 0x9B27, 0x50A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4000, 0xB001, 0xD801, 0xD801, 0xD801, 0xB000, 0x5000, 0x5800, 0x7000, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xD801, 0x9000, 0xA000, 0xE001, 0xC001, 0xA0E2, 0xBAA6, 0xBB07, 0x4020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x92EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x9B0A, 0x4985, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A88, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5020, 0xAB67, 0xD429, 0xDC29, 0xD3C8, 0x7000, 0x5800, 0x6000, 0x7800, 0xD001, 0xD801, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xD801, 0xD001, 0x8800, 0xA801, 0xE001, 0xB801, 0x5000, 0xF62E, 0xEDED, 0x9B27, 0x48A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3800, 0x88E2, 0xB8E2, 0xC0E2, 0xA061, 0x8800, 0x6000, 0x6000, 0x7800, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xD801, 0x9800, 0x9800, 0xE001, 0xB000, 0x9225, 0xF62E, 0xF62E, 0x4041, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-0x0020, 0x0020, 0x0020, 0x0000, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x40C2, 0xBCCB, 0xEDED, 0xE5CD, 0xCD0B, 0x5000, 0x7800, 0x9800, 0xA000, 0xD801, 0xD801, 0xE001, 
-0xE001, 0xD801, 0xE001, 0xD801, 0xD001, 0x7800, 0xA801, 0xD801, 0xB801, 0x6000, 0x9B68, 0x9B47, 0x61E4, 0x40A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3020, 0xB42A, 0xE58C, 0xE5AC, 0xA347, 0x7000, 0xB801, 0xB000, 0xB000, 0xE001, 0xE001, 
-0xE001, 0xE001, 0xE001, 0xD801, 0x9800, 0x9000, 0xD801, 0xA800, 0x8A45, 0xF64E, 0xF64E, 0x3020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x0000, 
-0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0861, 
-0x1082, 0x1082, 0x0841, 0x0000, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x4144, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 
-0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x4144, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA32B, 0x8286, 0x7A45, 0x8245, 0x7A05, 0x5800, 0x7800, 0x9800, 0x9800, 0xB000, 0xB001, 0xB001, 
-0xB001, 0xB000, 0xB001, 0xA800, 0xA000, 0x5000, 0x7000, 0x8800, 0x7800, 0x5800, 0x4820, 0x71C6, 0x92C9, 0xA34B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B08, 0x9BA8, 0x9367, 0x71C4, 0x6800, 0xA800, 0xB000, 0xC001, 0xC001, 0xC000, 
-0xC001, 0xC001, 0xC001, 0xB800, 0x8000, 0x8000, 0xB000, 0x8800, 0x4820, 0x71C4, 0x8226, 0x61C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0000, 
-0x0821, 0x1082, 0x1061, 0x1081, 0x0861, 0x0861, 0x0841, 0x0840, 0x4144, 0x7A88, 0x7A88, 0x4165, 0x0000, 0x0020, 0x1061, 0x1082, 
-0x1082, 0x10A2, 0x0841, 0x0000, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x3944, 0x0020, 0x1061, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 
-0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA30A, 0x6103, 0x4800, 0x4800, 0x6800, 0x8000, 0x9000, 0x9000, 0x9800, 0x9800, 0x9800, 
-0x9800, 0x9800, 0x9800, 0x9800, 0x8800, 0x4800, 0x5000, 0x5800, 0x5000, 0x4800, 0x58E3, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x69C6, 0x4081, 0x4800, 0x7000, 0x8800, 0x9000, 0x9800, 0x9800, 0xA000, 
-0xA000, 0x9800, 0x9000, 0x8800, 0x6800, 0x6800, 0x7800, 0x6000, 0x5000, 0x50A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0000, 
-0x0841, 0x10A2, 0x1082, 0x1082, 0x1061, 0x0861, 0x0840, 0x0020, 0x6227, 0xC40D, 0xC40D, 0x7248, 0x0000, 0x0020, 0x1082, 0x1082, 
-0x10A2, 0x10A2, 0x0841, 0x0000, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x3944, 0x0040, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x0841, 0x0841, 
-0x0020, 0x0841, 0x0840, 0x0020, 0x0000, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B0A, 0x5964, 0x2000, 0x3800, 0x3800, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 
-0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x2000, 0x2800, 0x48C2, 0x9268, 0x9268, 0x92C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x2000, 0x4800, 0x4800, 0x5000, 0x5800, 0x5800, 0x5800, 
-0x5800, 0x5800, 0x5000, 0x5000, 0x4000, 0x3800, 0x60C2, 0x9206, 0x8A06, 0x8A68, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0000, 
-0x0841, 0x10A2, 0x10A2, 0x1082, 0x1061, 0x0861, 0x0020, 0x0000, 0x6207, 0xC40D, 0xC40D, 0x7268, 0x0000, 0x0841, 0x1082, 0x1082, 
-0x10A2, 0x10A2, 0x0841, 0x0000, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x0000, 0x0020, 0x1081, 0x1082, 0x18A2, 0x10A2, 0x1082, 0x0000, 0x0000, 
-0x0000, 0x0820, 0x0841, 0x0821, 0x0020, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x0000, 
-0x0841, 0x10A2, 0x10A2, 0x1082, 0x1061, 0x0841, 0x0020, 0x0000, 0x6207, 0xC40D, 0xC40D, 0x7268, 0x0000, 0x0020, 0x0841, 0x0861, 
-0x1082, 0x10A2, 0x0861, 0x0000, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x3124, 0x0000, 0x0020, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x51A5, 0x0000, 0x0821, 0x0841, 0x0840, 0x1082, 0x0841, 0x0020, 
-0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x1061, 
-0x1082, 0x0020, 0x0020, 0x0841, 0x0821, 0x0020, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x0000, 
-0x0841, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0020, 0x0000, 0x6207, 0xC40D, 0xC40D, 0x7268, 0x0000, 0x0000, 0x0020, 0x0841, 
-0x1082, 0x10A2, 0x1061, 0x0000, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20C2, 0x0020, 0x0000, 0x0020, 0x0020, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x0000, 0x1061, 0x1081, 0x0841, 0x10A2, 0x0020, 0x51A5, 
-0x59E6, 0x0000, 0x0020, 0x0841, 0x0020, 0x0000, 0x0000, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x0000, 0x0000, 0x0000, 0x0820, 0x0000, 0x0020, 
-0x0000, 0x0000, 0x0000, 0x0841, 0x0861, 0x0020, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x0000, 
-0x0840, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0020, 0x0000, 0x0000, 0x6A27, 0xC40D, 0xC40D, 0x7288, 0x0000, 0x0000, 0x0020, 0x0841, 
-0x1082, 0x1082, 0x1082, 0x0000, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28E3, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x3123, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x20A2, 0x0020, 0x1082, 0x1082, 0x0020, 0x0861, 0x0020, 0x7A88, 
-0x7A88, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3103, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0xA36B, 
-0x932A, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x0000, 
-0x0841, 0x10A2, 0x18A2, 0x10A2, 0x0841, 0x0000, 0x0000, 0x1081, 0x7A88, 0xC40D, 0xC40D, 0x930A, 0x3103, 0x0000, 0x0041, 0x0861, 
-0x1082, 0x1082, 0x1082, 0x0020, 0x6227, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x1061, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x18A2, 0x0020, 
-0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0000, 0x0841, 0x0861, 0x0020, 0x0000, 0x0000, 0x0841, 0xA36B, 
-0xA34B, 0x51C6, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0xC40D, 
-0xB3CC, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x0000, 
-0x0841, 0x10A2, 0x18A2, 0x1082, 0x0020, 0x0000, 0x1881, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA9, 0x0020, 0x0841, 0x0841, 
-0x0861, 0x0861, 0x0861, 0x0000, 0x0000, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0xAB8B, 0x3924, 
-0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x1882, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x3123, 0x0020, 0x0841, 0x0020, 0x0000, 0x0020, 0x0020, 0x1882, 0xC40D, 
-0xC40D, 0xABAC, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x28E3, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x20A2, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x18A2, 0xC40D, 
-0xBBED, 0x6206, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x0000, 
-0x0841, 0x0861, 0x0841, 0x0841, 0x0020, 0x0000, 0x1881, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0000, 0x0020, 0x0841, 
-0x0020, 0x0841, 0x0020, 0x0000, 0x0020, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0xAB8C, 0x3103, 
-0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x1881, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x0020, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x3103, 0x8AE9, 0xC40D, 
-0xC40D, 0xBBCD, 0x20A2, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x18A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x0841, 0x0000, 0x0020, 0x0020, 0x0000, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x0841, 0x0000, 
-0x0000, 0x0040, 0x0020, 0x0020, 0x0020, 0x0000, 0x1881, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0000, 0x0000, 0x0020, 
-0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x20A2, 0x28E2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0xB3CC, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x1882, 0x8AEA, 0xC40D, 0xAB8C, 
-0x6A27, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x1081, 0xB3AC, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x1061, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x4985, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x51C5, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x1882, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x3124, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x1882, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x1882, 0x0000, 0x0000, 0x0020, 0x0000, 0x20A2, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1881, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6207, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2903, 0xC40D, 0xC40D, 0xC40D, 
-0x82C9, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x0020, 0x0840, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x4985, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x5A06, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x1061, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x1061, 0x51A5, 0x8AC9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x28E3, 0x0000, 0x0000, 0x0020, 0x0000, 0x51C5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x0000, 0x0000, 0x0841, 
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0000, 0x1881, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0020, 0x0000, 0x0020, 
-0x0841, 0x0861, 0x0861, 0x0841, 0x1081, 0x0000, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6207, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x7268, 0x7A88, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 
-0xB3AC, 0x7A88, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1881, 0x7A88, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0020, 0x0020, 0x0040, 0x0020, 0x0020, 0x0020, 0x0000, 0x7268, 0xBBED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x28E3, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0861, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x3103, 0x0000, 0x0020, 0x0020, 0x0000, 0x0841, 0x28C2, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x0000, 0x0820, 0x18C3, 
-0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18A2, 0x0000, 0x1881, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0000, 0x0000, 0x0841, 
-0x18C2, 0x18A2, 0x18A2, 0x18A2, 0x18C2, 0x0000, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6207, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x28E3, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0820, 0x82C9, 0x8AE9, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20A2, 0x0841, 0x0000, 0x0000, 0x0000, 0x20A2, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7AA8, 0x20C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x0000, 0x0020, 0x1082, 
-0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x0000, 0x1881, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0000, 0x0000, 0x0841, 
-0x1081, 0x1082, 0x1082, 0x1061, 0x1082, 0x0000, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6207, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4144, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6227, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x51C6, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x6207, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x4165, 0x7A88, 0xBBCC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1881, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xB3CC, 0xA36B, 0x7AA8, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4165, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x9B4B, 0x4985, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x51C5, 0xA36B, 0xAB8B, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x3944, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x3103, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x3944, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x28E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x20C2, 0x0840, 0x0000, 0x0000, 0x0000, 0x51A5, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1882, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6206, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18A2, 0x28E3, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x59E6, 0x0000, 0x0000, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x7D04, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 
-0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x6C64, 0x7D24, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x8545, 0x8545, 0x74E4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x7CE4, 0x8545, 0x8545, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x7D24, 0x7CE4, 0x74A4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x53C3, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x5BE3, 0x5BE3, 0x5C23, 0x6444, 0x5C24, 0x53C4, 0x53C4, 0x53E3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53E3, 0x53C4, 0x53C4, 
-0x5BE3, 0x5BE3, 0x5C23, 0x6444, 0x5C24, 0x53C4, 0x53C4, 0x53E3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6444, 0x6444, 0x5C04, 0x53C4, 
-0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53E3, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C3, 
-0x53C4, 0x53C3, 0x5BE3, 0x5BE3, 0x6444, 0x6444, 0x5C04, 0x53C4, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5C03, 0x6444, 0x6444, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 
-0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53E3, 0x53C4, 0x53C4, 0x6444, 0x6444, 0x5C04, 0x53C4, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x53E3, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C3, 0x53C4, 0x53C3, 0x5BE3, 0x5BE3, 
-0x6444, 0x6444, 0x5C04, 0x53C4, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 
-0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5C03, 0x6444, 0x6444, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x53E3, 0x53C4, 0x53C4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x53C3, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5C03, 0x6444, 0x6444, 0x53E4, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x53E3, 0x53C4, 0x53C4, 0x53E3, 0x5BE3, 0x5C03, 0x6444, 0x6444, 0x53C4, 0x53C4, 0x53C4, 0x53C4, 0x53C3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x74A4, 0x7CE4, 0x7D04, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x4344, 0x3305, 0x3305, 0x3305, 0x3305, 0x5BE3, 0x5BE3, 0x74C4, 0x8545, 0x6CC5, 0x3305, 0x3305, 0x53C4, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x3305, 0x3305, 0x3305, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4BA4, 0x3305, 0x3305, 
-0x5BE3, 0x5BE3, 0x74C4, 0x8545, 0x6CC5, 0x3305, 0x3305, 0x53C4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x8545, 0x8545, 0x53E5, 0x3305, 
-0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4BA4, 0x3305, 0x3305, 0x3305, 0x3305, 0x4BA4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4344, 
-0x3305, 0x4364, 0x5BE3, 0x5BE3, 0x8545, 0x8545, 0x53E5, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x3305, 0x3305, 0x3305, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 0x3305, 0x3305, 0x3305, 0x3305, 
-0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4BA4, 0x3305, 0x3305, 0x8545, 0x8545, 0x53E5, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x4BA4, 0x3305, 0x3305, 0x3305, 0x3305, 0x4BA4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4344, 0x3305, 0x4364, 0x5BE3, 0x5BE3, 
-0x8545, 0x8545, 0x53E5, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x3305, 0x3305, 0x3305, 0x3305, 
-0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 0x3305, 0x3305, 0x3305, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x4BA4, 0x3305, 0x3305, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4344, 0x3305, 0x3305, 0x3305, 0x3305, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6444, 0x8545, 0x8545, 0x4B85, 0x3305, 0x3305, 0x3305, 0x3305, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x53A4, 0x3305, 0x3305, 0x53C4, 0x5BE3, 0x6C64, 0x8545, 0x8545, 0x3305, 0x3305, 0x3305, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x4344, 0x3305, 0x3305, 0x3305, 0x3305, 0x5BE3, 0x5BE3, 0x74C4, 0x8545, 0x6CC5, 0x3305, 0x3305, 0x53C4, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x3305, 0x3305, 0x3305, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4BA4, 0x3305, 0x3305, 
-0x5BE3, 0x5BE3, 0x74C4, 0x8545, 0x6CC5, 0x3305, 0x3305, 0x53C4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x8545, 0x8545, 0x53E5, 0x3305, 
-0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4BA4, 0x3305, 0x3305, 0x3305, 0x3305, 0x4BA4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4344, 
-0x3305, 0x4364, 0x5BE3, 0x5BE3, 0x8545, 0x8545, 0x53E5, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x3305, 0x3305, 0x3305, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 0x3305, 0x3305, 0x3305, 0x3305, 
-0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4BA4, 0x3305, 0x3305, 0x8545, 0x8545, 0x53E5, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x4BA4, 0x3305, 0x3305, 0x3305, 0x3305, 0x4BA4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4344, 0x3305, 0x4364, 0x5BE3, 0x5BE3, 
-0x8545, 0x8545, 0x53E5, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x3305, 0x3305, 0x3305, 0x3305, 
-0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 0x3305, 0x3305, 0x3305, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x4BA4, 0x3305, 0x3305, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4344, 0x3305, 0x3305, 0x3305, 0x3305, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6444, 0x8545, 0x8545, 0x4B85, 0x3305, 0x3305, 0x3305, 0x3305, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x53A4, 0x3305, 0x3305, 0x53C4, 0x5BE3, 0x6C64, 0x8545, 0x8545, 0x3305, 0x3305, 0x3305, 0x3305, 0x3B44, 0x5BE3, 0x5BE3, 0x5BE3, 
-0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4BA4, 0x3B25, 0x3B25, 0x3B25, 0x3B25, 0x4BA4, 0x5BE3, 
-0x6444, 0x7D24, 0x7D24, 0x3A05, 0x2126, 0x2126, 0x2126, 0x2126, 0x3B25, 0x3B25, 0x3B45, 0x4345, 0x3AC5, 0x2126, 0x2126, 0x4B44, 
-0x5BE3, 0x6464, 0x7D24, 0x7D24, 0x2126, 0x2126, 0x2126, 0x2126, 0x31E5, 0x5BE3, 0x5BE3, 0x74E4, 0x7D24, 0x5BA5, 0x2126, 0x2126, 
-0x3B25, 0x3B25, 0x3B45, 0x4345, 0x3AC5, 0x2126, 0x2126, 0x4B44, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4345, 0x4345, 0x2A05, 0x2126, 
-0x31E5, 0x5BE3, 0x5BE3, 0x74E4, 0x7D24, 0x5BA5, 0x2126, 0x2126, 0x2126, 0x2126, 0x42E4, 0x5BE3, 0x6444, 0x7D24, 0x7D24, 0x3A05, 
-0x2126, 0x29E5, 0x3B25, 0x3B25, 0x4345, 0x4345, 0x2A05, 0x2126, 0x31E5, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6464, 0x7D24, 0x7D24, 
-0x2126, 0x2126, 0x2126, 0x2126, 0x29C5, 0x3B25, 0x3B25, 0x3B25, 0x3B25, 0x3B45, 0x4345, 0x4345, 0x2126, 0x2126, 0x2126, 0x2126, 
-0x31E5, 0x5BE3, 0x5BE3, 0x74E4, 0x7D24, 0x5BA5, 0x2126, 0x2126, 0x4345, 0x4345, 0x2A05, 0x2126, 0x31E5, 0x5BE3, 0x5BE3, 0x74E4, 
-0x7D24, 0x5BA5, 0x2126, 0x2126, 0x2126, 0x2126, 0x42E4, 0x5BE3, 0x6444, 0x7D24, 0x7D24, 0x3A05, 0x2126, 0x29E5, 0x3B25, 0x3B25, 
-0x4345, 0x4345, 0x2A05, 0x2126, 0x31E5, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6464, 0x7D24, 0x7D24, 0x2126, 0x2126, 0x2126, 0x2126, 
-0x29C5, 0x3B25, 0x3B25, 0x3B25, 0x3B25, 0x3B45, 0x4345, 0x4345, 0x2126, 0x2126, 0x2126, 0x2126, 0x31E5, 0x5BE3, 0x5BE3, 0x74E4, 
-0x7D24, 0x5BA5, 0x2126, 0x2126, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6444, 0x7D24, 0x7D24, 0x3A05, 0x2126, 0x2126, 0x2126, 0x2126, 
-0x3B25, 0x3B25, 0x3B25, 0x3B25, 0x3B25, 0x4345, 0x4345, 0x29C5, 0x2126, 0x2126, 0x2126, 0x2126, 0x5BE3, 0x5BE3, 0x74A4, 0x7D24, 
-0x6405, 0x2126, 0x2126, 0x32A5, 0x3B25, 0x3B45, 0x4345, 0x4345, 0x2126, 0x2126, 0x2126, 0x2126, 0x31E5, 0x5BE3, 0x5BE3, 0x74E4, 
-0x7D24, 0x6464, 0x3B25, 0x3B25, 0x3B25, 0x3B25, 0x4BA4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x4BA4, 0x3305, 0x3305, 0x3305, 0x3305, 0x4BA4, 0x5BE3, 
-0x6444, 0x8545, 0x8545, 0x3A05, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3305, 0x3305, 0x3305, 0x3305, 0x3285, 0x20E6, 0x20E6, 0x4B24, 
-0x5BE3, 0x6C64, 0x8545, 0x8545, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x31A5, 0x5BE3, 0x5BE3, 0x7CE4, 0x8545, 0x5BA5, 0x20E6, 0x20E6, 
-0x3305, 0x3305, 0x3305, 0x3305, 0x3285, 0x20E6, 0x20E6, 0x4B24, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x3305, 0x3305, 0x29C5, 0x20E6, 
-0x31A5, 0x5BE3, 0x5BE3, 0x7CE4, 0x8545, 0x5BA5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x42C4, 0x5BE3, 0x6444, 0x8545, 0x8545, 0x3A05, 
-0x20E6, 0x29C5, 0x3305, 0x3305, 0x3305, 0x3305, 0x29C5, 0x20E6, 0x31A5, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2185, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x31A5, 0x5BE3, 0x5BE3, 0x7CE4, 0x8545, 0x5BA5, 0x20E6, 0x20E6, 0x3305, 0x3305, 0x29C5, 0x20E6, 0x31A5, 0x5BE3, 0x5BE3, 0x7CE4, 
-0x8545, 0x5BA5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x42C4, 0x5BE3, 0x6444, 0x8545, 0x8545, 0x3A05, 0x20E6, 0x29C5, 0x3305, 0x3305, 
-0x3305, 0x3305, 0x29C5, 0x20E6, 0x31A5, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2185, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x31A5, 0x5BE3, 0x5BE3, 0x7CE4, 
-0x8545, 0x5BA5, 0x20E6, 0x20E6, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6444, 0x8545, 0x8545, 0x3A05, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x2165, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x5BE3, 0x5BE3, 0x74C4, 0x8545, 
-0x6C25, 0x20E6, 0x20E6, 0x3285, 0x3305, 0x3305, 0x3305, 0x3305, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x31A5, 0x5BE3, 0x5BE3, 0x7CE4, 
-0x8545, 0x6465, 0x3305, 0x3305, 0x3305, 0x3305, 0x4BA4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x6CA4, 0x53A4, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x3AE4, 0x4B84, 
-0x4BA4, 0x5C25, 0x5C25, 0x31C5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x29C5, 0x20E6, 0x20E6, 0x3AC4, 
-0x4B84, 0x53C4, 0x5C25, 0x5C25, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2985, 0x4B84, 0x4B84, 0x5404, 0x5C25, 0x42E5, 0x20E6, 0x20E6, 
-0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x29C5, 0x20E6, 0x20E6, 0x3AC4, 0x4B84, 0x4B84, 0x4B84, 0x4B84, 0x2A05, 0x2A05, 0x2146, 0x20E6, 
-0x2985, 0x4B84, 0x4B84, 0x5404, 0x5C25, 0x42E5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3A85, 0x4B84, 0x4BA4, 0x5C25, 0x5C25, 0x31C5, 
-0x20E6, 0x2146, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2146, 0x20E6, 0x2985, 0x4B84, 0x4B84, 0x4B84, 0x4B84, 0x53C4, 0x5C25, 0x5C25, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2126, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2985, 0x4B84, 0x4B84, 0x5404, 0x5C25, 0x42E5, 0x20E6, 0x20E6, 0x2A05, 0x2A05, 0x2146, 0x20E6, 0x2985, 0x4B84, 0x4B84, 0x5404, 
-0x5C25, 0x42E5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3A85, 0x4B84, 0x4BA4, 0x5C25, 0x5C25, 0x31C5, 0x20E6, 0x2146, 0x2A05, 0x2A05, 
-0x2A05, 0x2A05, 0x2146, 0x20E6, 0x2985, 0x4B84, 0x4B84, 0x4B84, 0x4B84, 0x53C4, 0x5C25, 0x5C25, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2126, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2985, 0x4B84, 0x4B84, 0x5404, 
-0x5C25, 0x42E5, 0x20E6, 0x20E6, 0x4B84, 0x4B84, 0x4B84, 0x4B84, 0x4BA4, 0x5C25, 0x5C25, 0x31C5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x2126, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4B84, 0x4B84, 0x53E4, 0x5C25, 
-0x4B45, 0x20E6, 0x20E6, 0x29A5, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2985, 0x4B84, 0x4B84, 0x5404, 
-0x5C25, 0x4B45, 0x2A05, 0x2A05, 0x2A05, 0x2A05, 0x53A4, 0x6CA4, 0x6C64, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x7CE4, 0x8545, 0x5BA5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2A45, 0x3305, 
-0x3305, 0x3305, 0x3305, 0x2165, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3285, 
-0x3305, 0x3305, 0x3305, 0x3305, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2185, 0x3305, 0x3305, 0x3305, 0x3305, 0x2A45, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3285, 0x3305, 0x3305, 0x3305, 0x3305, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2185, 0x3305, 0x3305, 0x3305, 0x3305, 0x2A45, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2A45, 0x3305, 0x3305, 0x3305, 0x3305, 0x2165, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2185, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2185, 0x3305, 0x3305, 0x3305, 0x3305, 0x2A45, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2185, 0x3305, 0x3305, 0x3305, 
-0x3305, 0x2A45, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2A45, 0x3305, 0x3305, 0x3305, 0x3305, 0x2165, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2185, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2185, 0x3305, 0x3305, 0x3305, 
-0x3305, 0x2A45, 0x20E6, 0x20E6, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x3305, 0x2165, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3305, 0x3305, 0x3305, 0x3305, 
-0x3285, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2185, 0x3305, 0x3305, 0x3305, 
-0x3305, 0x2A45, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x5BA5, 0x8545, 0x74E4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x53E3, 0x53C3, 0x53C3, 0x6CA4, 0x7D05, 0x5B85, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2A25, 0x32C5, 
-0x32C5, 0x32C5, 0x32C5, 0x2165, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2A45, 
-0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2145, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x2A25, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2A45, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2145, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x2A25, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2A25, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x2165, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2145, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2145, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x2A25, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2145, 0x32C5, 0x32C5, 0x32C5, 
-0x32C5, 0x2A25, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2A25, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x2165, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2145, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2145, 0x32C5, 0x32C5, 0x32C5, 
-0x32C5, 0x2A25, 0x20E6, 0x20E6, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 0x2165, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x32C5, 0x32C5, 0x32C5, 0x32C5, 
-0x3265, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2145, 0x32C5, 0x32C5, 0x32C5, 
-0x32C5, 0x2A25, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x5B85, 0x7D05, 0x74C4, 0x53C3, 0x53C3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x53A4, 0x3305, 0x3305, 0x3305, 0x3305, 0x2A45, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2A45, 0x3305, 0x3305, 0x3305, 0x3305, 0x53C4, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x53A4, 0x3305, 0x3305, 0x3305, 0x3305, 0x2A45, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2A45, 0x3305, 0x3305, 0x3305, 0x3305, 0x53C4, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x4B44, 0x2185, 0x2185, 0x2185, 0x2185, 0x2126, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 
-0x3906, 0x3906, 0x3906, 0x3906, 0x20E6, 0x20E6, 0x3106, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3106, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x3106, 0x3906, 0x3906, 0x3906, 0x3906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3106, 0x20E6, 0x20E6, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x3906, 0x3906, 0x3906, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3906, 0x3906, 0x3906, 
-0x3906, 0x3106, 0x20E6, 0x20E6, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x3906, 0x3906, 0x3906, 0x3906, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x3906, 0x3906, 0x3906, 
-0x3906, 0x3906, 0x3906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3906, 0x3906, 0x3906, 
-0x3906, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x3906, 0x3906, 0x3906, 0x3906, 
-0x3906, 0x3906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x3906, 0x3906, 0x3906, 
-0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2145, 0x2185, 0x2185, 0x2185, 0x2185, 0x4B44, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x4B24, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4B24, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x5384, 0x3205, 0x3205, 0x4285, 0x4285, 0x3A05, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 
-0x3106, 0x4126, 0x4126, 0x4187, 0x4987, 0x4987, 0x4987, 0x4987, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 0x3906, 
-0x4126, 0x4146, 0x4987, 0x4987, 0x2906, 0x2906, 0x3906, 0x4126, 0x4146, 0x4987, 0x4987, 0x4987, 0x4987, 0x3967, 0x2906, 0x2906, 
-0x2906, 0x2906, 0x3906, 0x4126, 0x4146, 0x4987, 0x4987, 0x3126, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 
-0x3106, 0x4126, 0x4126, 0x4187, 0x4987, 0x3967, 0x2906, 0x2906, 0x4126, 0x4126, 0x4167, 0x4987, 0x4987, 0x4987, 0x4987, 0x3126, 
-0x2906, 0x2906, 0x2906, 0x2906, 0x4126, 0x4126, 0x4167, 0x4987, 0x4167, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 
-0x4126, 0x4126, 0x4167, 0x4987, 0x4987, 0x4987, 0x4987, 0x3126, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 
-0x3106, 0x4126, 0x4126, 0x4187, 0x4987, 0x3967, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x2906, 0x2906, 0x3106, 0x4126, 0x4126, 0x4187, 
-0x4987, 0x3967, 0x2906, 0x2906, 0x4126, 0x4126, 0x4167, 0x4987, 0x4987, 0x4987, 0x4987, 0x3126, 0x2906, 0x2906, 0x2906, 0x2906, 
-0x4126, 0x4126, 0x4167, 0x4987, 0x4167, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 0x4126, 0x4126, 0x4167, 0x4987, 
-0x4987, 0x4987, 0x4987, 0x3126, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 0x3106, 0x4126, 0x4126, 0x4187, 
-0x4987, 0x3967, 0x2906, 0x2906, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 0x3906, 0x4126, 0x4146, 0x4987, 0x4987, 
-0x4987, 0x4987, 0x3926, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 0x4126, 0x4126, 0x4167, 0x4987, 
-0x4167, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 0x4126, 0x4126, 0x4167, 0x4987, 0x4987, 0x4987, 0x4987, 0x3126, 
-0x2906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3A05, 0x4285, 0x4265, 0x3205, 0x3205, 0x4B64, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x7CE4, 0x8545, 0x5BA5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4987, 0x4A49, 0x4A49, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x49C8, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A09, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x49C8, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A08, 
-0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A09, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 
-0x4A49, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A08, 
-0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4987, 0x4A49, 0x4A49, 
-0x4A49, 0x4A49, 0x4987, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 
-0x4A09, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x5BA5, 0x8545, 0x74E4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x7CE4, 0x8545, 0x5BA5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4987, 0x4A49, 0x4A49, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x49C8, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A09, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x49C8, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A08, 
-0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A09, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 
-0x4A49, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A08, 
-0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4987, 0x4A49, 0x4A49, 
-0x4A49, 0x4A49, 0x4987, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 
-0x4A09, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x5BA5, 0x8545, 0x74E4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x42C4, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x49C8, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 
-0x4A49, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4987, 0x4A49, 0x4A49, 
-0x4A49, 0x4A49, 0x4987, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x42C4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x42C4, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x49C8, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 
-0x4A49, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4987, 0x4A49, 0x4A49, 
-0x4A49, 0x4A49, 0x4987, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4167, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x42C4, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x53C4, 0x4364, 0x4364, 0x4364, 0x4364, 0x3A85, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4167, 0x4987, 0x4987, 0x4987, 0x4987, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x2906, 0x2906, 0x4106, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x2906, 0x3906, 0x4126, 0x4126, 0x4987, 0x4987, 0x4987, 0x4987, 0x4167, 0x4126, 0x4126, 
-0x2906, 0x2906, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 
-0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x2906, 0x2906, 0x4126, 0x4126, 0x4167, 0x4987, 0x4987, 0x4987, 0x4987, 0x4146, 
-0x4126, 0x3906, 0x2906, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x2906, 0x2906, 0x2106, 0x20E6, 0x2906, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4167, 0x4987, 0x4987, 0x4987, 0x4987, 0x4146, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 
-0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x2906, 0x2906, 0x20E6, 0x20E6, 0x2906, 0x2906, 0x3106, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3906, 0x2906, 0x2906, 0x4126, 0x4126, 0x4167, 0x4987, 0x4987, 0x4987, 0x4987, 0x4146, 0x4126, 0x3906, 0x2906, 0x2906, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x2906, 0x2906, 0x2106, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4987, 
-0x4987, 0x4987, 0x4987, 0x4146, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x2906, 0x3106, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3906, 0x2906, 0x2906, 0x2906, 0x2906, 0x2106, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4146, 0x4987, 0x4987, 
-0x4987, 0x4987, 0x4146, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x2906, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x3906, 0x2906, 0x2906, 0x2106, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4987, 0x4987, 0x4987, 0x4987, 0x4146, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3A85, 0x4364, 0x4364, 0x4364, 0x4364, 0x53C3, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x53A4, 0x3305, 0x3305, 0x3305, 0x3305, 0x2A45, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2A45, 0x3305, 0x3305, 0x3305, 0x3305, 0x53C4, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x4B84, 0x3285, 0x3285, 0x3285, 0x3285, 0x29E5, 0x20E6, 0x20E6, 0x2906, 0x2906, 0x3906, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 
-0x3906, 0x3906, 0x3906, 0x3906, 0x20E6, 0x20E6, 0x3106, 0x3906, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3906, 
-0x20E6, 0x20E6, 0x3106, 0x3906, 0x3906, 0x3906, 0x3906, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3106, 0x20E6, 0x20E6, 0x3906, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 
-0x3906, 0x3106, 0x20E6, 0x20E6, 0x3906, 0x3906, 0x3906, 0x3906, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3906, 0x3906, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3906, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3906, 0x3906, 0x3906, 
-0x3906, 0x3106, 0x20E6, 0x20E6, 0x3906, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3906, 0x3106, 0x20E6, 0x20E6, 
-0x3906, 0x3906, 0x3906, 0x3906, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3906, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x3906, 0x3906, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3906, 0x3906, 0x3906, 
-0x3906, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3906, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x3906, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x3906, 0x3906, 0x3906, 
-0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3906, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 
-0x3906, 0x3106, 0x2906, 0x2906, 0x2906, 0x2906, 0x3205, 0x3285, 0x3285, 0x3285, 0x3285, 0x4B84, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x4B24, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4B24, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x8545, 0x8545, 0x6C64, 0x5BE3, 0x4B24, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4B24, 0x5BE3, 0x6C64, 0x8545, 0x8545, 
-0x4345, 0x4345, 0x3B45, 0x3B25, 0x32A5, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4106, 0x4106, 0x4A29, 0x4A29, 0x4A29, 0x4A29, 
-0x49C8, 0x4126, 0x4126, 0x2906, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x3906, 
-0x4106, 0x4187, 0x4A29, 0x4A29, 0x4A29, 0x4A29, 0x4167, 0x4106, 0x3106, 0x20E6, 0x20E6, 0x3285, 0x3B25, 0x3B45, 0x4345, 0x4345, 
-0x3305, 0x3305, 0x3305, 0x3305, 0x3285, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 
-0x4A09, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 
-0x4126, 0x4987, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4987, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x3285, 0x3305, 0x3305, 0x3305, 0x3305, 
-0x7B89, 0x7B89, 0x4A87, 0x2A05, 0x29C5, 0x3106, 0x3106, 0x3106, 0x3106, 0x3906, 0x4126, 0x4126, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 
-0x4208, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x3106, 0x3106, 
-0x3106, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x2906, 0x20E6, 0x20E6, 
-0x3106, 0x3106, 0x3106, 0x3106, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3106, 0x3106, 0x20E6, 0x20E6, 0x2906, 0x3106, 
-0x3106, 0x3106, 0x3106, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x2106, 
-0x20E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x3106, 0x3106, 0x3106, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3106, 
-0x3106, 0x3106, 0x3106, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x2106, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x2106, 0x20E6, 0x2906, 0x3106, 0x3106, 
-0x3106, 0x3106, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x3106, 0x3106, 0x3106, 0x3106, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x2106, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x2106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x3106, 0x3106, 0x3106, 0x3106, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x2906, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x2906, 0x3106, 0x3106, 0x3106, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x3106, 0x4106, 
-0x4126, 0x4987, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4987, 0x4126, 0x3926, 0x3106, 0x3106, 0x29C5, 0x2A05, 0x4A87, 0x7B89, 0x7B89, 
-0xC40D, 0xC40D, 0x5A28, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 
-0x41E8, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4987, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4987, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x5A29, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6228, 0x2106, 0x2906, 0x4126, 0x4126, 0x4146, 0x4146, 0x4126, 0x4126, 0x4126, 0x4A29, 0x4A29, 0x4A29, 0x4A29, 
-0x41E8, 0x2106, 0x2106, 0x3906, 0x4126, 0x4126, 0x4146, 0x4146, 0x2106, 0x2106, 0x2106, 0x2106, 0x2906, 0x4126, 0x4126, 0x4146, 
-0x4146, 0x3926, 0x2106, 0x2106, 0x2106, 0x2106, 0x3906, 0x4126, 0x4126, 0x4146, 0x4146, 0x4126, 0x4126, 0x3906, 0x2106, 0x2106, 
-0x4126, 0x4126, 0x4126, 0x4146, 0x3926, 0x2106, 0x2106, 0x2106, 0x2106, 0x3106, 0x4126, 0x4126, 0x2106, 0x2106, 0x3906, 0x4126, 
-0x4126, 0x4146, 0x4146, 0x2906, 0x2106, 0x2106, 0x2106, 0x2106, 0x4126, 0x4126, 0x4126, 0x4146, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x2106, 0x3106, 0x4126, 0x4126, 0x4146, 0x4146, 0x3106, 0x2106, 0x2106, 0x2106, 0x2106, 0x3906, 0x4126, 0x4126, 0x4146, 0x4146, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x2906, 0x4126, 0x4126, 0x4146, 0x4146, 0x3926, 0x2106, 0x2106, 0x2106, 0x2106, 0x3906, 0x4126, 
-0x4126, 0x4146, 0x4146, 0x2906, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x3906, 0x4126, 0x4126, 0x4146, 0x4146, 0x2906, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x4126, 0x4126, 0x4126, 0x4146, 0x4126, 0x4126, 0x4126, 0x2906, 0x2106, 0x3106, 0x4126, 0x4126, 
-0x4146, 0x4146, 0x3106, 0x2106, 0x2106, 0x2106, 0x2106, 0x3906, 0x4126, 0x4126, 0x4146, 0x4146, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x2906, 0x4126, 0x4126, 0x4146, 0x4146, 0x3926, 0x2106, 0x2106, 0x2106, 0x2106, 0x3906, 0x4126, 0x4126, 0x4146, 0x4146, 0x2906, 
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x3906, 0x4126, 0x4126, 0x4146, 0x4146, 0x2906, 0x2106, 0x2106, 0x2106, 0x2106, 
-0x4126, 0x4126, 0x4126, 0x4146, 0x3926, 0x2106, 0x2106, 0x2106, 0x2106, 0x3106, 0x4126, 0x4126, 0x4146, 0x4146, 0x3106, 0x2106, 
-0x2106, 0x2106, 0x2106, 0x3906, 0x4126, 0x4126, 0x4146, 0x4146, 0x2106, 0x2106, 0x2106, 0x2106, 0x2906, 0x4126, 0x4126, 0x4146, 
-0x4146, 0x4987, 0x4A29, 0x4A29, 0x4A29, 0x4A29, 0x4187, 0x4126, 0x4126, 0x4146, 0x4146, 0x2906, 0x2106, 0x6229, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7229, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4987, 0x4A49, 0x4A49, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A08, 
-0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A09, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4167, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A09, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4A49, 0x4A49, 0x4987, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4987, 0x4A49, 0x4A49, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4167, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4167, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A09, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4A49, 0x4A49, 0x4987, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4987, 0x4A49, 0x4A49, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4167, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A09, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A49, 0x4A49, 0x4987, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4987, 0x4A49, 0x4A49, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A08, 
-0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x7229, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7229, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4987, 0x4A49, 0x4A49, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A08, 
-0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A09, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4167, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A09, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4A49, 0x4A49, 0x4987, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4987, 0x4A49, 0x4A49, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4167, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4167, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A09, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4A49, 0x4A49, 0x4987, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4987, 0x4A49, 0x4A49, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4A08, 0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4167, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x49E8, 0x4A49, 0x4A09, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A49, 0x4A49, 0x4987, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4987, 0x4A49, 0x4A49, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4A08, 
-0x4A49, 0x49C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4A49, 0x4A49, 0x4167, 0x4126, 0x7229, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7229, 0x4126, 0x4126, 0x4126, 0x4126, 0x4147, 0x4167, 0x4146, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4146, 0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4147, 
-0x4167, 0x4146, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4147, 0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4147, 0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4146, 0x4167, 0x4167, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4147, 0x4167, 0x4146, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4167, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4147, 0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4146, 0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4147, 0x4167, 0x4146, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4167, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4147, 0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4167, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4146, 0x4167, 0x4167, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4147, 
-0x4167, 0x4146, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4167, 0x4167, 0x4126, 0x4126, 0x7229, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7229, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x7229, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x92EB, 0x7229, 0x61C8, 0x4126, 0x4126, 0x4126, 0x4126, 0x3926, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 
-0x3106, 0x3106, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x3106, 0x3106, 0x3106, 0x3906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3926, 0x3106, 0x3106, 0x3106, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3926, 0x3106, 0x3106, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x3926, 0x3106, 0x3106, 0x3106, 0x3106, 0x3906, 0x4126, 0x4126, 0x3106, 0x3106, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x3906, 0x3106, 0x3106, 0x3106, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 
-0x3106, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3106, 0x3106, 0x3106, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x3106, 0x3106, 0x3106, 0x3106, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3926, 0x3106, 0x3106, 0x3106, 0x3106, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x3906, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 
-0x3106, 0x3106, 0x3106, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3106, 0x3906, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x3906, 0x3106, 0x3106, 0x3106, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x3106, 0x3106, 0x3106, 
-0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3926, 0x3106, 0x3106, 0x3106, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 
-0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3106, 0x3106, 0x3106, 0x3106, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x3926, 0x3106, 0x3106, 0x3106, 0x3106, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x3106, 
-0x3106, 0x3106, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x3106, 0x3106, 0x3106, 0x3906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3926, 0x3106, 0x3106, 0x3106, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x6A08, 0x7229, 0x92EB, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34C, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 
-0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x2906, 0x4126, 0x4126, 
-0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 
-0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 
-0x4126, 0x4126, 0x4126, 0x4126, 0x3906, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 0x4126, 0x2906, 0x20E6, 
-0x20E6, 0x20E6, 0x20E6, 0x3906, 0x4126, 0x4126, 0x4126, 0x4126, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x2906, 0x4126, 0x4126, 0x4126, 
-0x4126, 0x3106, 0x20E6, 0x20E6, 0x20E6, 0x20E6, 0x3106, 0x4126, 0x4126, 0x4126, 0x4126, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-
-};
\ No newline at end of file
@@ -1,165 +0,0 @@
-// Total bitmap data size: 4848 bytes
-
-// skeleton_frame.png
-// Size: 64x31 (3968 bytes)
-const uint16_t skeleton_frame_bmp[1984] = {
-0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x632A, 0x0020, 
-0x0861, 0x0861, 0x0840, 0xCE53, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xCE33, 0x0020, 
-0x0861, 0x0861, 0x0020, 0x6B4A, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xE6F6, 0xEF36, 0x6B6A, 0x1081, 
-0x1061, 0x1061, 0x10A2, 0xC613, 0xE6F6, 0xE716, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xE716, 0xE6F5, 0xC5F2, 0x1081, 
-0x1061, 0x1061, 0x1081, 0x738B, 0xEF36, 0xE6F6, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x3164, 0x10A2, 0x8C4D, 0xF79A, 
-0xE737, 0xE738, 0xEF79, 0x39A5, 0x0861, 0x840C, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x7BCC, 0x0861, 0x39C5, 0xF79A, 
-0xE738, 0xE737, 0xF7BA, 0x842D, 0x1081, 0x31A5, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x2103, 0x0000, 0x946E, 0xFFFC, 
-0xFFF9, 0xFFFA, 0xFFFB, 0x18C2, 0x0000, 0x8C2D, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 
-0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x840C, 0x0000, 0x18E2, 0xFFFB, 
-0xFFFA, 0xFFF9, 0xFFFC, 0x8C4D, 0x0000, 0x2103, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x2123, 0x0000, 0x8C4D, 0xFFFB, 
-0xFFD8, 0xFFF9, 0xFFF9, 0xBDD2, 0xBDF3, 0x736B, 0x4A47, 0x4226, 0x4226, 0x4226, 0x4226, 0x4226, 0x4226, 0x4226, 0x4226, 0x4226, 
-0x4226, 0x4226, 0x4226, 0x4226, 0x4226, 0x4226, 0x4226, 0x4226, 0x4226, 0x4226, 0x4226, 0x4A67, 0x738B, 0xBDF3, 0xBDD2, 0xFFF9, 
-0xFFF8, 0xFFD8, 0xFFFB, 0x842D, 0x0000, 0x2944, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0xEF36, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CCF, 0xFFFE, 
-0xFFFA, 0xFFB8, 0xFFD8, 0xFFFA, 0xFFFE, 0x6B4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73AB, 0xFFFE, 0xFFFA, 0xFFD8, 
-0xFFB8, 0xFFFA, 0xFFFE, 0x948E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A27, 0x9CF0, 
-0xAD31, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFFA, 0xA510, 0x5267, 0x62E9, 0x62E9, 0x62E9, 0x62E9, 0x62E9, 0x62E9, 0x62E9, 0x62E9, 0x62E9, 
-0x62E9, 0x62E9, 0x62E9, 0x62E9, 0x62E9, 0x62E9, 0x62E9, 0x62E9, 0x62E9, 0x62E9, 0x62E9, 0x4A67, 0xAD50, 0xFFFA, 0xFFD8, 0xFFD8, 
-0xFFF9, 0xA530, 0x9CF0, 0x4206, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 
-0x18C2, 0xFFFC, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF9, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 
-0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD8, 
-0xFFFB, 0x18A2, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0861, 0x18A2, 
-0x4206, 0xFFFB, 0xFFD8, 0xFFD8, 0xFFF9, 0xE716, 0xCE54, 0xD674, 0xD674, 0xD674, 0xD674, 0xD674, 0xD674, 0xD674, 0xD674, 0xD674, 
-0xD674, 0xD674, 0xD674, 0xD674, 0xD674, 0xD674, 0xD674, 0xD674, 0xD674, 0xD674, 0xD674, 0xCE54, 0xE716, 0xFFF9, 0xFFB8, 0xFFD8, 
-0xFFFB, 0x39E5, 0x10A2, 0x1081, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x8C4D, 0xFFFB, 
-0xF798, 0xFFD8, 0xFFD8, 0xEF36, 0xFFF9, 0x6309, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B2A, 0xFFF9, 0xEF36, 0xFFF8, 
-0xFFD8, 0xF798, 0xFFFB, 0x840C, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x840C, 0xFFF9, 
-0xEF57, 0xFFF9, 0xFFF9, 0xFFB8, 0xFFFC, 0x73AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BCC, 0xFFFC, 0xFFD8, 0xFFF9, 
-0xFFF9, 0xEF57, 0xFFF9, 0x7BCC, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x73AB, 0xF777, 
-0xD695, 0xDED5, 0xE716, 0x41E6, 0x2943, 0x18C2, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x18C2, 0x2944, 0x4206, 0xEF36, 
-0xDED5, 0xD695, 0xF777, 0x738B, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x840C, 0xFFFA, 
-0xEF57, 0xF777, 0xF7B8, 0x18C2, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x18E2, 0xFFB9, 
-0xF777, 0xEF57, 0xFFFA, 0x7BEC, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x39E6, 0x738B, 
-0x632A, 0x6B2A, 0x736B, 0x1081, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x1081, 0x738B, 
-0x6B2A, 0x632A, 0x738B, 0x39E5, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-
-};
-
-// skull.png
-// Size: 20x22 (880 bytes)
-const uint16_t skull_bmp[440] = {
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x18E3, 0x6329, 0x632A, 0x632A, 0x632A, 0x632A, 0x632A, 
-0x632A, 0x738B, 0x18E3, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x3184, 0xFFFB, 0xFFFC, 
-0xFFFC, 0xFFFC, 0xFFFC, 0xFFFC, 0xFFFC, 0xFFFF, 0x31A6, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x1081, 0xEF78, 
-0xE716, 0xEF77, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xF7B9, 0xF799, 0xFFFC, 0x10A2, 0x0000, 0x0001, 
-0x0001, 0x0000, 0x18C2, 0xFFB9, 0xEF57, 0xF798, 0xFFF8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF8, 
-0xFFFC, 0x10A2, 0x0000, 0x0001, 0x0001, 0x0001, 0x18C2, 0xFFFA, 0xFFD8, 0xFFF9, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 
-0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFFC, 0x10A2, 0x0001, 0x0001, 0x0000, 0x8C6E, 0xF778, 0xE6F5, 0xFFB8, 0xFFD8, 0xFFD8, 0xFFD8, 
-0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFFC, 0x94AF, 0x0000, 0x0000, 0x840C, 0xEF36, 0xF7B8, 
-0xFFD8, 0xFFF8, 0xFFF8, 0xFFF8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFD8, 0xFFF8, 0xFFF8, 0xFFF8, 0xFFF8, 0xFFD8, 0xFFFA, 0x946E, 0x0000, 
-0x0000, 0x840C, 0xEF37, 0xFFF9, 0xEF78, 0xE718, 0xE738, 0xE718, 0xEF78, 0xFFD8, 0xFFD8, 0xF778, 0xE718, 0xE738, 0xE718, 0xEF58, 
-0xFFD8, 0xFFFB, 0x8C6E, 0x0000, 0x0000, 0x946E, 0xFFF9, 0xFFFF, 0x31A5, 0x0000, 0x0000, 0x0000, 0x62E9, 0xFFFC, 0xFFFA, 0x5288, 
-0x0000, 0x0000, 0x0000, 0x39E6, 0xFFFF, 0xFFFB, 0x8C6E, 0x0000, 0x0000, 0x946E, 0xEF58, 0x4228, 0x1082, 0x0000, 0x0000, 0x0000, 
-0x6B6A, 0xFFFC, 0xFFB8, 0x5AE9, 0x0000, 0x0000, 0x0000, 0x10A2, 0x4207, 0xF79A, 0x948E, 0x0000, 0x0000, 0x946E, 0xE717, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x6B6A, 0xFFFC, 0xF777, 0x5AC8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7A, 0x948E, 0x0000, 
-0x0000, 0x948E, 0xE718, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x52A8, 0xFFFD, 0xEF57, 0x4206, 0x0000, 0x0020, 0x0000, 0x0000, 
-0x0000, 0xEF5A, 0x948E, 0x0000, 0x0000, 0x842D, 0xEF57, 0xD6B7, 0x2944, 0x0000, 0x0000, 0xBDD2, 0xE6F5, 0xFFD8, 0xFFFA, 0xCE54, 
-0x9CCF, 0x0000, 0x0000, 0x2964, 0xD696, 0xFFFB, 0x946E, 0x0000, 0x0000, 0x840C, 0xEF36, 0xFFFC, 0x630A, 0x2964, 0x2124, 0xF799, 
-0xE716, 0xB591, 0xCE54, 0xDED5, 0xE716, 0x2124, 0x2944, 0x6B4B, 0xFFFC, 0xFFFA, 0x8C6E, 0x0000, 0x0000, 0x8C4D, 0xEF78, 0xEF37, 
-0xFFFC, 0xFFFD, 0xFFFE, 0xFFD8, 0x73AB, 0x0000, 0x0000, 0x842D, 0xFFFC, 0xFFFD, 0xFFFD, 0xFFFC, 0xF79A, 0xFFDD, 0x948F, 0x0000, 
-0x0001, 0x0001, 0x0000, 0x0000, 0xA510, 0xFFFC, 0xFFF9, 0xFFB8, 0x83EC, 0x0000, 0x0000, 0x8C6E, 0xFFFB, 0xFFB8, 0xFFFD, 0xA531, 
-0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0001, 0x7BCC, 0xFFFA, 0xFFD8, 0xAD50, 0x39E6, 0x39E6, 0xB592, 
-0xFFFA, 0xFFFA, 0x7BEC, 0x0001, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0840, 0xFFDA, 0xFFFC, 
-0xFFFC, 0xFFFC, 0xFFFD, 0xFFFC, 0xFFFB, 0xFFFD, 0x0020, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0000, 0x0841, 0xFFFD, 0x18E2, 0x7BCC, 0xFFFD, 0xFFDA, 0x632A, 0x18E3, 0xFFFF, 0x0841, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0xAD30, 0x0020, 0x39E6, 0xA511, 0x946E, 0x3184, 0x0861, 0xB593, 0x0001, 0x0001, 
-0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 
-};
-
@@ -1,520 +0,0 @@
-// Total bitmap data size: 16200 bytes
-
-// zombie1_attack_left_1.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_attack_left_1_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x2924, 0x18C3, 0x20E3, 
-0x20E3, 0x0841, 0x836C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 
-0xBC6F, 0x2924, 0x41C6, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x41A6, 0x2104, 0x834B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xBC4F, 0x3144, 0x20E3, 0x3145, 0x5A8A, 0x62AA, 0x628A, 0x628A, 0x62CB, 0x49E7, 0x2904, 
-0x8B6C, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x3986, 0x20E3, 0x6AEB, 0x628A, 0x4A08, 
-0x4A08, 0x49E8, 0x5249, 0x5A69, 0x62CB, 0x3965, 0x1081, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x5A48, 0x0820, 0x62CB, 0x4A08, 0x5249, 0x838C, 0x83AC, 0x8BCD, 0x6AEA, 0x5249, 0x5A8A, 0x49E7, 0x3165, 0xAC2F, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EB, 0x20C2, 0x83AD, 0x730B, 0x838C, 0xD5F2, 0xDE12, 0xE653, 0x83AC, 0x41E8, 
-0x5249, 0x5A6A, 0x4A28, 0x0000, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6ACA, 0x4A05, 0xEE94, 0xD5D2, 
-0xCDB1, 0xC550, 0xC550, 0xD5D2, 0x93ED, 0x5249, 0x5A69, 0x6AEB, 0x5A69, 0x0841, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6ACA, 0x49E5, 0xE653, 0xCD91, 0xC550, 0xA42C, 0x9C0B, 0xBD30, 0xDDF2, 0x83AC, 0x6B0B, 0xDE12, 0xB4CF, 0x0861, 
-0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A48, 0x49E5, 0xE633, 0x9C2C, 0x9C0B, 0x9BEB, 0xA42C, 0xBD30, 
-0xDE13, 0x83AC, 0x6AEB, 0xDE33, 0xB50F, 0x0841, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x836C, 
-0x41A4, 0xC52F, 0xFFB7, 0xF756, 0x6A48, 0xA42D, 0xDE13, 0xA46D, 0x93EC, 0xD5F2, 0xB4EF, 0x1041, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0x9BAD, 0x1060, 0xB4AE, 0x93AD, 0x93CD, 0x938C, 0xBD10, 0xCDB2, 0xC550, 0xC550, 0xD5F2, 
-0xB4EF, 0x1041, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x832C, 0x1880, 0xBCCE, 0x7269, 0x8B2B, 
-0xDE33, 0xD5F2, 0xC571, 0xCDD2, 0xC571, 0xBD2F, 0xB4EF, 0x1061, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBC4F, 0x49E6, 0x8BCB, 0xE673, 0xAC6E, 0x93CC, 0xC551, 0xD5F2, 0xC571, 0xAC8D, 0xAC6D, 0xB4EF, 0x0820, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xB42F, 0x0840, 0xAC6E, 0x3063, 0x1802, 0x832B, 0xC571, 0xB4CE, 
-0x93CA, 0xACAD, 0xBD10, 0x3164, 0xB44F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0841, 
-0x3084, 0x38A4, 0x38A4, 0x3043, 0x7AC9, 0xACAD, 0x9C2B, 0xAC8D, 0xCDB2, 0xD5D2, 0x0840, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0020, 0x3063, 0x3063, 0x7AE9, 0xAC6C, 0xA44C, 0xA42B, 0xAC8D, 0xD5D2, 0xD5D2, 
-0x0840, 0xB44F, 0xC40D, 0xC42E, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0000, 0xBCEF, 0xA42D, 0xC4EE, 
-0x5225, 0x2105, 0x5AED, 0x5AAC, 0x62ED, 0x62ED, 0x420B, 0x41C7, 0x49E6, 0x3124, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xBC6F, 0x4A26, 0x3163, 0x3122, 0x2104, 0x31AA, 0x422C, 0x3A0C, 0x39EB, 0x39EB, 0x4A6D, 0x2968, 0x18C5, 0x18C5, 
-0x3187, 0x72C9, 0x7B2B, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0x938D, 0x18C5, 0x10A5, 0x1084, 0x39CA, 0x528E, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x4A6D, 0x4A6D, 0x52AE, 0x39CA, 0x0842, 0x1083, 0x832B, 0xC40E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC42E, 0x7B0B, 0x0021, 0x4A6D, 
-0x528E, 0x4A8E, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x528E, 0x4A4D, 0x0021, 
-0x834C, 0xC40E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0x7B0B, 0x0001, 0x52AE, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x528E, 0x0000, 0x8B6C, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0xC44F, 0xC44F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0xC42E, 0x7B2B, 0x0021, 0x52AE, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x52AE, 0x0000, 0x9BCD, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x41C6, 0x0820, 0x0000, 0x93AD, 0xC40D, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0x5A48, 0x0820, 0x2946, 0x4A6D, 0x424C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x4A6D, 0x0001, 0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x41C6, 0x8BEC, 0xACCE, 0xBD0F, 0x6AE9, 0x18A2, 0x6AAA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC44F, 0x3965, 
-0x3124, 0x31A8, 0x31CA, 0x420B, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A4C, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A4C, 0x422C, 0x18C4, 0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0841, 0xAC8E, 0xDE33, 0xDE13, 0xACCF, 0x7B6A, 0x7309, 0x72EA, 0xC40E, 0xC40D, 
-0xC40D, 0xC40D, 0xC46F, 0x41A6, 0x5A48, 0x2127, 0x2127, 0x420B, 0x4A6D, 0x4A4C, 0x422C, 0x424C, 0x4A4C, 0x4A4C, 0x4A6D, 0x31C9, 
-0x2967, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x31A8, 0x420B, 0x52CF, 
-0x0021, 0x832B, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1882, 0xA48E, 0xDE13, 0xC591, 
-0xCDB1, 0xF6B5, 0xB4EE, 0x0000, 0x7B0A, 0x8B6C, 0x834B, 0x8B8C, 0x5228, 0x0021, 0x0883, 0x4A6D, 0x4A6D, 0x424C, 0x422C, 0x4A4C, 
-0x4A6D, 0x422C, 0x31CA, 0x39EA, 0x31C9, 0x2967, 0x1905, 0x31A9, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x424C, 0x422B, 0x2147, 0x420B, 0x4A6D, 0x3189, 0x41C8, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x0020, 0x9C2C, 0xC550, 0xC550, 0xDE12, 0xC571, 0x734D, 0x18E5, 0x0842, 0x0022, 0x0842, 0x0021, 0x10A4, 0x29A8, 
-0x2988, 0x422C, 0x422C, 0x4A4C, 0x4A4D, 0x422B, 0x3A0B, 0x31A8, 0x0862, 0x1082, 0x2126, 0x2147, 0x2988, 0x420B, 0x4A4C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x2988, 0x31A9, 0x420B, 0x5AEF, 0x0863, 0x41A5, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x49C4, 0x8B89, 0xC54F, 0xC571, 0x736E, 0x29AB, 0x4A8D, 
-0x4A8D, 0x4A8D, 0x4A8D, 0x52AE, 0x422B, 0x2988, 0x31C9, 0x422C, 0x4A6D, 0x422B, 0x424C, 0x1906, 0x0862, 0x18C4, 0x0841, 0x0861, 
-0x2146, 0x2146, 0x39EA, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422B, 0x2105, 
-0x1905, 0x39EA, 0x4A8D, 0x2147, 0x4A08, 0xBC6F, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6AAA, 
-0x5226, 0x8348, 0x5269, 0x39EC, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A6D, 0x4A6D, 0x4A4C, 0x31A9, 0x18E5, 
-0x10A3, 0x3986, 0x3144, 0x0841, 0x31C9, 0x2988, 0x2967, 0x2967, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x4A4C, 0x420B, 0x0020, 0x18E4, 0x420B, 0x4A4C, 0x52AE, 0x2107, 0x18C2, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0B, 0x0841, 0x2946, 0x422C, 0x39EB, 0x39EB, 0x39EB, 0x39EB, 0x39EB, 0x39EB, 
-0x39EB, 0x39EB, 0x3A0B, 0x39EA, 0x20E3, 0x20E3, 0x0840, 0xB44F, 0xBC4F, 0x0000, 0x4A4C, 0x2968, 0x2147, 0x3A0B, 0x4A4C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422B, 0x0841, 0x18E5, 0x39EB, 0x4A4C, 0x4A6D, 
-0x2947, 0x3165, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC44E, 0xC42E, 0x9BCE, 0x0000, 
-0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0020, 0x18C2, 0xC44F, 0xC44E, 0xC44F, 0xC40D, 0xB42F, 0x0000, 
-0x4A6D, 0x422B, 0x2967, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 
-0x422B, 0x0841, 0x1905, 0x2967, 0x39EA, 0x4A4D, 0x424C, 0x31A9, 0x2924, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x5248, 0xC46F, 0xC40D, 0xC40D, 0xC44E, 0xC46F, 0xC44F, 0xC46F, 0xC46F, 0xC46F, 0xC46F, 0xC46F, 0xC46F, 0xC46F, 0xC46F, 0xC46F, 
-0xC40D, 0xC40D, 0xC40D, 0xB42F, 0x20E4, 0x39EA, 0x4A4C, 0x424C, 0x420B, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x2988, 0x0000, 0x18E5, 0x2967, 0x39CA, 0x4A6D, 0x4A6D, 0x31A9, 0x1081, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0000, 0xC44F, 0xC40D, 0xC42E, 0xC40D, 0xBC4F, 0x7B2B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8C, 0x0000, 0x52AE, 0x422C, 0x422C, 0x4A4C, 0x424C, 
-0x422C, 0x422C, 0x424C, 0x4A4D, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x31C9, 0x20E4, 0xB44F, 0x4A07, 0x10A4, 
-0x2988, 0x39EA, 0x4A4C, 0x420B, 0x3188, 0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x6ACA, 0xC44F, 0xC40D, 
-0xC40D, 0xC46F, 0x7B2B, 0x72EB, 0x72EA, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCD, 
-0x0001, 0x4A8D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x420B, 0x31A9, 0x39CA, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x422C, 
-0x4A6D, 0x31A9, 0x20E3, 0xC40D, 0x41A5, 0x0042, 0x2988, 0x31A9, 0x4A6D, 0x4A6D, 0x528E, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x834C, 0x72EA, 0xC44F, 0xC40D, 0xC40D, 0xC42E, 0x5227, 0x5228, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3ED, 0x0000, 0x4A8D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x39EA, 0x1905, 
-0x2147, 0x39CA, 0x424C, 0x4A4C, 0x422C, 0x4A4C, 0x424C, 0x2126, 0x20E3, 0xC42E, 0xAC2F, 0x3166, 0x10C5, 0x2988, 0x422B, 0x422C, 
-0x3167, 0x72EB, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x834C, 0xBC4F, 0xB42F, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x7B2B, 0x1084, 0x4A6D, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x4A4C, 0x3A0B, 0x2968, 0x2147, 0x2146, 0x39CA, 0x424C, 0x4A4C, 0x422C, 0x39EA, 0x18E5, 0x20C2, 0xC44F, 
-0xC40D, 0x72EA, 0x0000, 0x2988, 0x31A9, 0x2988, 0x0861, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x9BCE, 0x0020, 0x1061, 0x5228, 0xC44F, 0xC44F, 0xC44F, 0xC44F, 0xC44F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6A89, 0x0842, 0x52AE, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422B, 0x2967, 0x2147, 0x2126, 0x39CA, 
-0x4A4C, 0x31A9, 0x31A8, 0x39CA, 0x18C2, 0xC44F, 0xC40D, 0x938D, 0x0862, 0x1906, 0x1905, 0x10C4, 0x41A6, 0xC44F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xC42E, 0xBC6F, 0x1061, 0x0841, 0x1061, 0x1061, 0x0000, 
-0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0A, 0x0862, 0x4A8D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x424C, 0x422B, 0x2967, 0x2147, 0x2967, 0x2967, 0x2147, 0x31C9, 0x31A9, 0x18C2, 0xC44E, 0xC40D, 0xC40D, 0x93AD, 0x0000, 
-0x0861, 0x3985, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xC44F, 0xC44F, 0xC46F, 0xC46F, 0xC44F, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0B, 0x0862, 0x4A8D, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x420B, 0x420B, 0x420B, 0x420B, 0x420B, 0x4A4C, 0x3188, 
-0x20C2, 0xC42E, 0xC40D, 0xC40D, 0xC44E, 0xC46F, 0xC44F, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7B0B, 0x0862, 0x4A8D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 
-0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x420B, 0x31A8, 0x5228, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A47, 0x0022, 0x5AEF, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4D, 0x422C, 0x0000, 0xBC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x5229, 
-0x2948, 0x4A6D, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x4A4C, 0x420B, 0x0820, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xA3EE, 0x0000, 0x422C, 0x3A0A, 0x4A4C, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x4A4D, 0x420B, 0x0820, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCE, 0x0000, 0x2167, 0x2967, 0x420B, 
-0x420B, 0x422C, 0x4A4C, 0x424C, 0x424C, 0x424C, 0x424C, 0x424C, 0x424C, 0x424C, 0x4A4C, 0x422C, 0x3A0B, 0x422B, 0x39EA, 0x0820, 
-0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x9BCE, 0x0000, 0x2988, 0x2967, 0x2147, 0x2147, 0x39EA, 0x424C, 0x422B, 0x422C, 0x422C, 0x422C, 0x422B, 0x422B, 0x422B, 
-0x4A4C, 0x39C9, 0x2146, 0x2967, 0x2126, 0x0820, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BED, 0x0000, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2968, 0x2968, 0x2967, 0x2967, 0x2967, 0x2968, 0x2967, 0x2147, 0x2967, 0x2126, 0x0820, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BEE, 0x18C3, 0x2126, 0x2967, 
-0x2147, 0x18A4, 0x10A4, 0x2126, 0x2967, 0x2967, 0x2126, 0x10A4, 0x18C4, 0x2147, 0x2967, 0x2147, 0x2147, 0x2147, 0x2967, 0x2967, 
-0x2126, 0x0820, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6AA9, 0x0000, 0x31A9, 0x2967, 0x2147, 0x1062, 0x0862, 0x2146, 0x29A8, 0x2147, 0x1083, 0x0821, 0x1083, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x0820, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x0001, 0x2988, 0x2967, 0x2147, 0x1905, 0x1083, 0x18C4, 
-0x2106, 0x18C4, 0x0821, 0x0000, 0x10A4, 0x18E5, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x0820, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x0001, 
-0x2988, 0x2967, 0x2967, 0x2988, 0x10A4, 0x1063, 0x1063, 0x1083, 0x1063, 0x0841, 0x0862, 0x1063, 0x2147, 0x2968, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2126, 0x0820, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x0001, 0x2988, 0x2967, 0x2967, 0x2967, 0x10A4, 0x1083, 0x1083, 0x18A4, 0x1063, 0x0000, 
-0x0000, 0x1083, 0x2106, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x0840, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x0001, 0x2988, 0x2967, 0x2967, 0x2967, 
-0x10A4, 0x1083, 0x1083, 0x1063, 0x20C3, 0x39A5, 0x3165, 0x1083, 0x1062, 0x2126, 0x2968, 0x2967, 0x2967, 0x2967, 0x2146, 0x0841, 
-0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7B2B, 0x0001, 0x2988, 0x2967, 0x2967, 0x2967, 0x10A4, 0x1083, 0x10A4, 0x0000, 0x730B, 0xC40D, 0xC44F, 0x20C3, 0x0821, 0x2126, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0020, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x0001, 0x2988, 0x2967, 0x2967, 0x2967, 0x10A4, 0x1083, 0x18C4, 0x0000, 
-0x6AA9, 0xC40D, 0xC44E, 0x1081, 0x0841, 0x18A4, 0x2106, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x0000, 0xB44F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x0001, 0x2988, 0x2967, 
-0x2967, 0x2968, 0x10A4, 0x1083, 0x0000, 0x730B, 0xC44F, 0xC40D, 0xC42E, 0xBC6F, 0x3165, 0x0001, 0x2126, 0x2988, 0x2947, 0x2967, 
-0x2967, 0x2967, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7B2B, 0x0001, 0x2988, 0x2967, 0x2147, 0x18E5, 0x1083, 0x18C5, 0x0000, 0x8B8C, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 
-0x2903, 0x0000, 0x18E5, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x0000, 0xBC4F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x0001, 0x2988, 0x2967, 0x2147, 0x1083, 0x1083, 0x0001, 
-0x5228, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xAC2F, 0x3165, 0x0000, 0x18E5, 0x2988, 0x2967, 0x2967, 0x2967, 0x0863, 0x72EA, 
-0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x0000, 
-0x2147, 0x2967, 0x2147, 0x1083, 0x1083, 0x0000, 0xBC4F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6AA9, 0x0000, 0x20E5, 
-0x2146, 0x2967, 0x2967, 0x2967, 0x31C9, 0x0000, 0x9BCD, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0B, 0x1081, 0x4229, 0x2147, 0x2147, 0x1083, 0x1083, 0x0000, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x93CD, 0x1082, 0x0842, 0x18C4, 0x2988, 0x2967, 0x2967, 0x2988, 0x0001, 0x8B8C, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6ACA, 0x6286, 0xACD0, 0x10E6, 0x2147, 0x1083, 
-0x1083, 0x0000, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x0000, 0x18E5, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x31A8, 0x0000, 0x7B2B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6ACA, 0x6286, 0xACD0, 0x10E6, 0x2147, 0x1083, 0x1083, 0x0000, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8B6C, 0x0000, 0x18A4, 0x18C4, 0x2967, 0x2967, 0x2967, 0x2988, 0x0000, 0x834C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0B, 0x1061, 0x4229, 0x2147, 0x2147, 0x1083, 0x1083, 0x0000, 0xAC2F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x8B8D, 0x0000, 0x18A4, 0x2988, 0x2968, 0x2967, 0x2988, 0x0000, 0x8B8C, 
-0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x0000, 0x2147, 0x2967, 
-0x2147, 0x1063, 0x1083, 0x0000, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xA3EE, 0x0000, 0x18E5, 
-0x18C5, 0x18C4, 0x2147, 0x2968, 0x18E5, 0x2945, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6268, 0x0000, 0x31C9, 0x2967, 0x2147, 0x1905, 0x10A4, 0x0000, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x72EB, 0x0021, 0x1063, 0x0842, 0x2126, 0x2967, 0x31C9, 0x0021, 0x41A5, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x39A7, 0x10C4, 0x2967, 0x2967, 0x2988, 0x18C4, 0x0000, 
-0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC46F, 0x0000, 0x1083, 0x18E5, 0x2147, 0x2967, 
-0x2988, 0x0042, 0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xA40E, 
-0x0000, 0x2988, 0x2967, 0x2967, 0x18A4, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBC6F, 0x0000, 0x10A4, 0x2967, 0x2967, 0x2967, 0x2988, 0x0041, 0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCD, 0x0000, 0x2988, 0x2967, 0x2967, 0x10A4, 0x0000, 0x9BEE, 0xC40E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x20E3, 0x1083, 0x2147, 0x2967, 0x2967, 0x2988, 0x0862, 0x5A48, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCD, 0x0000, 0x2988, 0x2967, 0x2967, 
-0x10A4, 0x1083, 0x0000, 0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1061, 0x2126, 
-0x2967, 0x2967, 0x2967, 0x2968, 0x10A3, 0x41A6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x9BCD, 0x0000, 0x2988, 0x2967, 0x2967, 0x10A4, 0x10A4, 0x0000, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0861, 0x2126, 0x2967, 0x2967, 0x2967, 0x2988, 0x1083, 0x3144, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCD, 0x0000, 0x2988, 0x2147, 0x18C4, 0x1083, 0x1084, 0x0000, 0x9BCD, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0861, 0x2126, 0x2967, 0x2967, 0x2967, 0x2988, 
-0x1083, 0x3985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xA40E, 0x0000, 0x29A9, 
-0x2147, 0x1083, 0x1083, 0x18C5, 0x0000, 0x834C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 
-0x0000, 0x2126, 0x2988, 0x2147, 0x2167, 0x2967, 0x2126, 0x2125, 0x8B6C, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC46F, 0x5227, 0x1041, 0x2946, 0x2105, 0x1083, 0x1083, 0x0001, 0x5228, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC42E, 0xA3EE, 0x1904, 0x2925, 0x4186, 0x2967, 0x2147, 0x2988, 0x18E6, 0x0000, 0xC44F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xB44F, 0xB44F, 0xBC6F, 0x3985, 0x0000, 0x3924, 0x28C3, 0x28C3, 0x18A3, 0x18A4, 0x0000, 
-0xBC4F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0xAC2F, 0xBC6F, 0xBC6F, 0x3124, 0x4123, 0x59C5, 
-0x4186, 0x3167, 0x3187, 0x2905, 0x18A2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xAC2F, 0x0000, 0x0000, 0x0000, 0x1862, 0x3904, 
-0x28C3, 0x28C3, 0x28C3, 0x30E3, 0x30E4, 0x0000, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x834C, 
-0x0000, 0x0000, 0x0000, 0x49A5, 0x51C6, 0x49A5, 0x51A5, 0x51A5, 0x51C6, 0x4144, 0x10A2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 
-0x0000, 0x28C3, 0x30E3, 0x28E3, 0x28C3, 0x28E3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x30E4, 0x0000, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x834C, 0x0800, 0x59E7, 0x51A6, 0x51A6, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x51A6, 0x3924, 
-0x10A2, 0xC44F, 
-};
-
-// zombie1_attack_left_2.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_attack_left_2_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0x3985, 
-0x18C2, 0x20E3, 0x20E3, 0x0861, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40E, 0xC40D, 0xC44F, 0x3144, 0x41C6, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x41A6, 0x2924, 0x72CA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC44F, 0x3165, 0x20E3, 0x2924, 0x5A69, 0x62AA, 0x628A, 0x628A, 0x62CB, 
-0x4A08, 0x2904, 0x7B0B, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x41E7, 0x20C3, 0x6AEB, 
-0x62AA, 0x4A08, 0x4A08, 0x49E8, 0x5249, 0x5A69, 0x62AA, 0x49E7, 0x0020, 0xC44E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x72EA, 0x0000, 0x6ACB, 0x4A08, 0x5229, 0x838C, 0x83AC, 0x8BCD, 0x6AEB, 0x5249, 0x5A69, 0x4A28, 0x2924, 0x9BEE, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x1081, 0x83AD, 0x732B, 0x7B6C, 0xCDB2, 0xDE12, 0xE673, 
-0x8BED, 0x41C8, 0x5A69, 0x5269, 0x5A69, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x832C, 0x3984, 
-0xEE74, 0xD5D2, 0xD5B1, 0xC570, 0xC550, 0xD5D2, 0x942E, 0x5249, 0x5A69, 0x6AEB, 0x62AA, 0x0020, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC42E, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x832C, 0x3963, 0xE653, 0xCD91, 0xC571, 0xA44C, 0x9C0B, 0xBD0F, 0xDE12, 0x93ED, 0x6ACA, 0xD5D2, 
-0xC550, 0x0840, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xB44F, 0x0820, 0x5A69, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72CA, 0x3163, 0xE653, 0xA42C, 0x9C0B, 0x9BEB, 
-0x9C2B, 0xBD2F, 0xDE13, 0x93ED, 0x62CA, 0xDDF2, 0xC571, 0x0840, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x41A6, 0x6289, 0x940B, 0x7B4A, 0x5208, 0x41A6, 0xC44E, 
-0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0x8BAD, 0x4184, 0xB4EE, 0xF797, 0xFF97, 0x7289, 0x9BCC, 0xDE33, 0xAC8E, 0x93CB, 0xD5D2, 0xC550, 0x0840, 0xBC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5228, 0x1060, 
-0xA48E, 0xEE95, 0xC571, 0x6287, 0x6287, 0x5228, 0xC42E, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xAC0E, 0x0820, 0xB48D, 0x9BCD, 0x93CD, 0x936C, 0xB4EF, 0xCDD2, 0xC550, 
-0xC550, 0xD5D2, 0xC550, 0x0840, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6289, 0x5A46, 0xE653, 0xCD91, 0xCD91, 0xE633, 0xE674, 0x6AC7, 0x834B, 0x9BAD, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x0840, 0xBCCE, 
-0x7A89, 0x82EA, 0xD5F2, 0xDE13, 0xC551, 0xCDB2, 0xCD91, 0xBD0F, 0xC550, 0x0840, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5228, 0x3102, 0xCD4F, 0xCD91, 0xCD91, 0xCD91, 
-0xD5D2, 0xCDB2, 0x2944, 0x0000, 0x5228, 0xBC4F, 0xB44F, 0xB44F, 0xB44F, 0xAC2F, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x5207, 0x838A, 0xDE53, 0xACAF, 0x93AC, 0xBD30, 0xD612, 0xC571, 0xACAE, 0xA44C, 0xC550, 0x0000, 
-0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x93AD, 0x49C5, 0x72E7, 0x8BAA, 0xCDB1, 0xC570, 0xB4F0, 0x31A8, 0x10C6, 0x4A6C, 0x3188, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x93AD, 0xC44F, 0xC46F, 0xC46F, 0xC46F, 0xC46F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0000, 0xAC6E, 0x38A4, 0x1801, 0x7B0A, 
-0xCD91, 0xB4CE, 0x93CA, 0xAC8D, 0xC570, 0x3164, 0xAC2F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCE, 0x0020, 0x39A5, 0x9C2B, 0x8BAA, 0x2987, 0x2127, 0x2147, 0x39CA, 
-0x4A4D, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x528E, 0x18E5, 0x0820, 0x0840, 0x0840, 0x0840, 0x0841, 0xBC4F, 0xC42E, 0xC44E, 0xC42E, 
-0xB44F, 0x0000, 0x3083, 0x30A4, 0x30A4, 0x2022, 0x6A68, 0xACAD, 0x9C2C, 0xA46D, 0xCD91, 0xDE33, 0x1081, 0xAC0E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC42E, 0xC42E, 0xB44F, 
-0x0000, 0x0841, 0x2126, 0x2967, 0x39EA, 0x4A4C, 0x4A4C, 0x4A4C, 0x424C, 0x424C, 0x424C, 0x4A4C, 0x420B, 0x39EA, 0x39EA, 0x39EA, 
-0x39EB, 0x3A0B, 0x2104, 0x20E3, 0x20E3, 0x2103, 0x18A2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A46, 0xBCEE, 0xA42B, 0xAC6D, 
-0xCDB1, 0xDE13, 0x1060, 0xAC0E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4A07, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0xBC4F, 0x1082, 0x0000, 0x18E5, 0x3A0A, 0x31A8, 0x39CA, 0x4A6D, 0x4A4C, 
-0x4A4C, 0x422C, 0x424C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x31A9, 0x2968, 0x2988, 0x2968, 0x3189, 0x39C9, 0x31C9, 0x31C9, 
-0x31C9, 0x39EA, 0x20E4, 0x3144, 0x5ACD, 0x5AAC, 0x62ED, 0x62ED, 0x420B, 0x41C7, 0x3123, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x834C, 0x9BCE, 0xC44F, 0xC40D, 0xB44F, 0x93CD, 0xC40D, 0xC40D, 0xBC6F, 0xBC4F, 
-0x41C7, 0x0000, 0x0000, 0x0021, 0x3A0A, 0x31CA, 0x31C9, 0x422C, 0x4A6D, 0x4A4C, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x4A4D, 0x4A6D, 
-0x4A6D, 0x4A6D, 0x4A6D, 0x4A6D, 0x4A6D, 0x4A6D, 0x4A6D, 0x528E, 0x31A9, 0x2968, 0x422D, 0x3A0C, 0x39EB, 0x39EB, 0x4A6D, 0x2988, 
-0x10A4, 0x39A7, 0x72C9, 0x836C, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0000, 0xC44F, 0xC40D, 0xC40D, 
-0x7B0B, 0x1081, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x93AD, 0xAC2E, 0x834C, 0x0000, 0x0000, 0x0000, 0x2147, 0x422B, 0x39EA, 
-0x420B, 0x4A4D, 0x4A4C, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A4D, 0x422C, 0x4A6D, 0x4A6D, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x5ACE, 0x31A9, 0x0842, 0x18C4, 0x8B8C, 0x8B4C, 0xC44E, 0xC40D, 0xC40E, 0xC40D, 
-0xC40D, 0xC40D, 0x0000, 0xC44F, 0xC40D, 0xC40D, 0xBC6F, 0x9BEE, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0x7B0A, 0x834C, 0x8B8C, 0x20E4, 0x0021, 0x0020, 0x10A4, 0x424C, 0x3A0B, 0x3A0B, 0x424C, 0x4A4C, 0x4A4C, 0x424C, 0x422C, 0x424C, 
-0x424C, 0x39EA, 0x39CA, 0x422B, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x52AE, 0x422C, 
-0x0021, 0x0000, 0x730B, 0xC42E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0x6ACA, 0xAC4F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCD, 0x41C6, 0x6AA9, 0x41E7, 0x0863, 0x0883, 0x0863, 
-0x31CA, 0x422B, 0x3A0B, 0x422B, 0x4A4C, 0x424C, 0x39EA, 0x2147, 0x1906, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x4A6D, 0x5ACF, 0x0001, 0x7B0B, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x18C3, 
-0xAC0E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBC6F, 0x20C2, 0x3165, 0x3965, 0x1905, 0x18E5, 0x10C4, 0x2968, 0x4A4C, 0x39EA, 0x2147, 0x2147, 0x2967, 0x39EA, 
-0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x52AE, 0x0001, 
-0x834B, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x2924, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xC42E, 0xC44E, 0x49E7, 0x0841, 0x1882, 0x18C4, 
-0x2988, 0x2967, 0x2147, 0x2167, 0x3A0B, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x4A8D, 0x0021, 0x938C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x6269, 0xA40E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44F, 0xC46F, 0xC44E, 0x9BCE, 0x0000, 0x2988, 0x422B, 0x420B, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A8D, 0x0021, 0x938D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x2903, 0x836C, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2E, 0x0000, 0x422C, 0x4A4C, 0x4A4C, 
-0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x528E, 0x0000, 0x9BCD, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x6ACA, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA40E, 0x0000, 0x4A8D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x528E, 0x3A0B, 0x2127, 0x41E8, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xB44F, 
-0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x0000, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x2967, 0x1905, 0x4A6D, 0x0863, 0x51E6, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x0000, 0x4A6D, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 
-0x4A6D, 0x0020, 0x10A3, 0x424C, 0x1084, 0x72CA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x0000, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39CA, 0x1082, 0x18E4, 0x422C, 0x1083, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x0000, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x420B, 0x0020, 0x2126, 0x2967, 0x422B, 
-0x10A4, 0x6AA9, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 
-0x0000, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x4A4D, 0x420B, 0x0020, 0x1905, 0x3A0B, 0x4A4C, 0x4A4C, 0x2106, 0x5A48, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x0000, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x39EA, 0x2967, 0x31C9, 0x4A6D, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x39C9, 0x1082, 0x2105, 0x2146, 0x3A0B, 0x4A4C, 0x528D, 0x18E6, 0x3985, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xB42E, 0x0000, 0x4A6D, 0x422C, 0x422C, 
-0x422C, 0x4A6D, 0x31A9, 0x1905, 0x2967, 0x31C9, 0x4A4C, 0x4A6D, 0x424C, 0x422C, 0x422C, 0x4A6D, 0x31A8, 0x0000, 0x2967, 0x2147, 
-0x3A0A, 0x4A4C, 0x4A6D, 0x18C5, 0x49C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC46F, 0x5A69, 0x2127, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x420B, 0x2988, 0x1926, 0x2146, 0x31C9, 0x31C9, 0x422C, 0x4A6D, 
-0x4A4C, 0x4A8E, 0x39C9, 0x0020, 0x2968, 0x2147, 0x420B, 0x4A6D, 0x4A4C, 0x31A9, 0x39A7, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 0x0001, 0x5AEF, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x420B, 
-0x31A9, 0x31A8, 0x2126, 0x1926, 0x31A9, 0x39EA, 0x39EA, 0x3A0B, 0x2967, 0x0000, 0x18C4, 0x2147, 0x31A9, 0x422B, 0x422C, 0x528E, 
-0x3189, 0x0840, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8C, 0x0021, 0x4A6D, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x4A6D, 0x422C, 0x3188, 0x3188, 0x2147, 0x2126, 0x2126, 0x2967, 0x2146, 0x0000, 
-0x0000, 0x2126, 0x2147, 0x39CA, 0x4A4D, 0x4A6D, 0x3189, 0x1081, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8B8C, 0x0021, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A4C, 
-0x31A9, 0x2967, 0x2967, 0x39EA, 0x39CA, 0x0820, 0x39A6, 0x2125, 0x2126, 0x39EA, 0x4A4C, 0x422C, 0x2947, 0x49E7, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8C, 0x0021, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x2968, 0x3144, 0xC44E, 0x49E7, 0x0883, 0x2147, 
-0x39EA, 0x2106, 0x49E6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8C, 0x0021, 
-0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x424C, 0x424C, 0x424C, 
-0x422C, 0x39C9, 0x39A6, 0xC46F, 0x5A48, 0x0000, 0x0000, 0x5A48, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8C, 0x0021, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x39EA, 0x0840, 0xC44F, 0xC44F, 0xBC4F, 0xBC4F, 0xC46F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8C, 0x0021, 0x4A6D, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x39CA, 0x1061, 0xC46F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7B0A, 0x0001, 0x5ACF, 0x4A4C, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x4A4C, 0x39CA, 0x1061, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x39A7, 0x2988, 0x39EA, 0x39EA, 0x424C, 0x4A4C, 0x4A4C, 0x424C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x39CA, 0x1061, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xB42E, 0x0000, 0x2167, 
-0x2147, 0x3A0B, 0x420B, 0x3A0B, 0x422C, 0x4A4C, 0x424C, 0x424C, 0x424C, 0x424C, 0x424C, 0x424C, 0x424C, 0x424C, 0x4A6D, 0x39EA, 
-0x0841, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAC2E, 0x0000, 0x2988, 0x2967, 0x2147, 0x2147, 0x2126, 0x31C9, 0x4A4C, 0x422C, 0x422B, 0x422B, 0x422B, 
-0x422B, 0x422B, 0x422B, 0x422C, 0x422C, 0x39C9, 0x2904, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2E, 0x0000, 0x2988, 0x2967, 0x2147, 0x2147, 0x2147, 
-0x2967, 0x2968, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x18C5, 0x3144, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2E, 0x18C3, 
-0x2106, 0x2967, 0x2967, 0x2967, 0x2147, 0x2988, 0x2106, 0x1083, 0x18E5, 0x2967, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x2967, 
-0x10A3, 0x3144, 0xC40E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x834B, 0x0000, 0x31C9, 0x2146, 0x18C5, 0x2967, 0x2988, 0x2106, 0x1083, 0x0842, 0x18C4, 0x2988, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x2105, 0x72EA, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8D, 0x0000, 0x2988, 0x2126, 0x1063, 0x18E5, 
-0x2988, 0x18C5, 0x1062, 0x1083, 0x18A4, 0x2105, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x2126, 0x0000, 0xC44F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8B8D, 0x0000, 0x2988, 0x2126, 0x1063, 0x1062, 0x18E5, 0x18C4, 0x1083, 0x1083, 0x0842, 0x1083, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2126, 0x1081, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8D, 0x0000, 0x2988, 0x2147, 0x18C4, 0x1083, 0x1063, 0x1083, 0x10A4, 0x0841, 
-0x0020, 0x18A4, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x1081, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x0000, 0x2988, 0x2967, 
-0x2967, 0x10A4, 0x1083, 0x1083, 0x10A4, 0x0841, 0x0000, 0x0862, 0x1083, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 
-0x1081, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8B8C, 0x0000, 0x2988, 0x2967, 0x2947, 0x10A4, 0x1083, 0x1083, 0x10A4, 0x1082, 0x18A2, 0x1082, 0x1083, 0x1083, 
-0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x1081, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x1083, 0x2147, 0x2967, 0x2967, 0x2967, 0x10A4, 0x1083, 0x1084, 
-0x0000, 0x7B2B, 0xC42E, 0xBC6F, 0x1082, 0x0842, 0x2147, 0x2968, 0x2947, 0x2967, 0x2967, 0x2126, 0x1081, 0xC44F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A68, 0x0021, 0x31A8, 
-0x2967, 0x2147, 0x18C4, 0x1083, 0x1083, 0x18E5, 0x0000, 0x72EA, 0xC40D, 0xC44F, 0x0020, 0x0842, 0x18C4, 0x2126, 0x2967, 0x2967, 
-0x2967, 0x1906, 0x1081, 0xC44E, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6ACA, 0x0021, 0x2988, 0x2967, 0x2126, 0x1063, 0x1083, 0x1083, 0x0000, 0x6AAA, 0xC46F, 0xC40D, 0xC42E, 
-0xAC2F, 0x20E4, 0x0821, 0x2126, 0x2988, 0x2947, 0x2967, 0x2147, 0x1062, 0x6AAA, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6ACA, 0x0021, 0x2988, 0x2967, 0x2147, 0x1083, 0x1083, 
-0x18C4, 0x0000, 0xA3EE, 0xC40D, 0xC42E, 0xC40D, 0xC42E, 0x20E3, 0x0001, 0x20E5, 0x2146, 0x2967, 0x2147, 0x18E5, 0x1083, 0x0000, 
-0xBC4F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6ACA, 
-0x0001, 0x2168, 0x2967, 0x1905, 0x1083, 0x1083, 0x0822, 0x3986, 0xBC70, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x8B8D, 0x20E3, 0x0021, 
-0x18E5, 0x2988, 0x2126, 0x10A4, 0x18C4, 0x0841, 0x93AD, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6AA9, 0x18A2, 0x4A4A, 0x18E5, 0x1062, 0x1083, 0x1083, 0x0000, 0xBC4F, 0xC40D, 0xC40E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A48, 0x0000, 0x2105, 0x2147, 0x2967, 0x2967, 0x2968, 0x31A9, 0x0000, 0xA40E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A48, 0x6AC7, 0x9C6F, 0x0885, 0x1063, 
-0x1083, 0x1083, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x6ACA, 0x0021, 0x1063, 0x18C5, 0x2968, 0x2967, 
-0x2967, 0x2988, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6268, 0x0841, 0x39E9, 0x1906, 0x1063, 0x1083, 0x1083, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0x7B0B, 0x0000, 0x18E5, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x0841, 0x9BCE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x72EB, 0x0001, 0x2988, 0x2106, 0x1083, 0x1083, 0x0000, 0xB44F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72CA, 0x0000, 0x2126, 0x2988, 0x2967, 0x2967, 0x2947, 0x31A8, 0x0000, 
-0x8B8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x0000, 
-0x29A8, 0x2147, 0x1083, 0x1083, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x72EA, 0x0000, 
-0x18E5, 0x18E5, 0x2167, 0x2967, 0x2988, 0x0000, 0xA3EE, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8D, 0x0000, 0x2988, 0x2126, 0x1083, 0x1083, 0x0000, 0xBC6F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC42E, 0xC40D, 0x9BCD, 0x0000, 0x18A4, 0x1083, 0x2147, 0x2967, 0x2968, 0x10A4, 0x49E7, 0xBC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8D, 0x0000, 0x2988, 0x2126, 0x1063, 0x1083, 
-0x0000, 0x7B2B, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x49E7, 0x0021, 0x10A4, 0x2147, 0x2967, 
-0x2147, 0x31C9, 0x0000, 0x5207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8B8D, 0x0000, 0x2988, 0x2147, 0x18C4, 0x1083, 0x18C4, 0x0000, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 
-0xC40D, 0xBC6F, 0x0000, 0x10A4, 0x2147, 0x2967, 0x2967, 0x2988, 0x0021, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8D, 0x0000, 0x2988, 0x2967, 0x2967, 0x10A4, 0x1083, 0x0000, 0xA40E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0000, 0x18A4, 0x2147, 0x2967, 0x2967, 0x2988, 0x0021, 0x72EA, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8D, 0x0000, 0x2988, 0x2967, 
-0x2947, 0x10A4, 0x1083, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0000, 0x10A4, 
-0x2947, 0x2967, 0x2967, 0x2988, 0x0021, 0x72CA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8B8D, 0x0000, 0x2988, 0x2967, 0x2967, 0x10A4, 0x1083, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0820, 0x2147, 0x2967, 0x2967, 0x2967, 0x2147, 0x10C3, 0x72CA, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8D, 0x0000, 0x2988, 0x2147, 0x18C4, 0x1083, 0x1083, 0x0000, 
-0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 0x2147, 0x2967, 0x2967, 0x2947, 
-0x29A8, 0x0862, 0x3965, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCD, 0x0000, 
-0x29A9, 0x2147, 0x1063, 0x1083, 0x18C5, 0x0000, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC46F, 0x0020, 0x1947, 0x2168, 0x2167, 0x2967, 0x2988, 0x0863, 0x49E6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x49E7, 0x1041, 0x2946, 0x2105, 0x1083, 0x1083, 0x0021, 0x5A69, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 0x3146, 0x3986, 0x2967, 0x2147, 0x2968, 0x0863, 0x49E6, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xB44F, 0xB44F, 0xBC4F, 0x2924, 0x0800, 0x3904, 0x28C3, 0x28C3, 0x18A3, 0x18A3, 
-0x0000, 0xBC6F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0xAC2F, 0xBC4F, 0xA40E, 0x1881, 0x5185, 0x59A5, 
-0x3986, 0x3167, 0x3987, 0x1082, 0x49E6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xA40E, 0x0000, 0x0000, 0x0000, 0x1882, 
-0x3104, 0x28C3, 0x28C3, 0x28C3, 0x30E3, 0x30E3, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x5A48, 
-0x0000, 0x0000, 0x1020, 0x59E6, 0x51A6, 0x49A5, 0x51A5, 0x51A5, 0x59C6, 0x2881, 0x41E7, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB44F, 0x0000, 0x30E4, 0x28E3, 0x28C3, 0x28C3, 0x28E3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28E3, 0x0000, 0xB44F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x49E7, 0x1861, 0x59E7, 0x51A6, 0x51A6, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x51C6, 0x2082, 
-0x49E7, 0xC42E, 
-};
-
@@ -1,405 +0,0 @@
-// Total bitmap data size: 12600 bytes
-
-// zombie1_die_left_1.png
-// Size: 42x75 (6300 bytes)
-const uint16_t zombie1_die_left_1_bmp[3150] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x1061, 
-0x2924, 0x2924, 0x2924, 0x0841, 0x9BEE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC44E, 0x6289, 0x6AAA, 0x41A6, 0x28E3, 0x2924, 0x2924, 0x2924, 0x28E3, 0x2904, 0x9BCD, 
-0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x6ACA, 
-0x0841, 0x0820, 0x41C7, 0x730C, 0x62AA, 0x62AA, 0x62AA, 0x730C, 0x3145, 0x18A2, 0xA40E, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x72CA, 0x0000, 0x62CB, 0x62AA, 0x5249, 0x5229, 0x5249, 0x5249, 
-0x5A69, 0x5A69, 0x6AEB, 0x3986, 0x0000, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6AAA, 0x0841, 0x62AA, 0x5A69, 0x5A89, 0x5A8A, 0x5A8A, 0x5A8A, 0x5A8A, 0x5A69, 0x5A69, 0x62AA, 0x41A6, 0x1082, 0xBC4F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6AA9, 0x0841, 0x5A8A, 0x5249, 0xA48E, 
-0xBD30, 0xB4F0, 0xBD10, 0xB4EF, 0x6AEA, 0x5229, 0x5A69, 0x5249, 0x4A07, 0x2904, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 0x0000, 0x62CA, 0xA46E, 0xCD91, 0xDE12, 0xDE13, 0xDE13, 0xCDB1, 0x62AA, 0x49E8, 
-0x5249, 0x4A29, 0x4A29, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6ACA, 
-0x1881, 0xACAF, 0xDDF2, 0xD5D2, 0xBD30, 0xB4CE, 0xBD30, 0xC571, 0x942D, 0x5A8A, 0x62CA, 0x8BED, 0x838C, 0x0000, 0xAC0E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6289, 0x41C4, 0xEE94, 0xCD91, 0xC550, 0xA44C, 0x93AA, 
-0xAC6D, 0xCD91, 0xDE33, 0x732B, 0x7B4C, 0xEE73, 0xCDD1, 0x1060, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6289, 0x41A4, 0xE653, 0xC571, 0xA46D, 0x9C0B, 0x9C0B, 0xAC8D, 0xCD91, 0xD5F2, 0x732B, 0x734B, 0xDE13, 
-0xC571, 0x1040, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49E7, 0x28C1, 0xCD70, 
-0xACAE, 0xEF15, 0xFFFA, 0xAC8F, 0x61E7, 0xCD91, 0xD5D2, 0x9C0C, 0x9C2C, 0xD5F2, 0xC571, 0x1040, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x6ACA, 0x5205, 0x9C0C, 0xA42E, 0xA44F, 0x93AC, 0x9BCD, 0xCD91, 
-0xCDB1, 0xBD2F, 0xC550, 0xD5F2, 0xC571, 0x1040, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x9BCE, 0x0000, 0xAC6D, 0x7A89, 0x5146, 0x9BCC, 0xE673, 0xC591, 0xC571, 0xCDB2, 0xC571, 0xC550, 0xC571, 0x0820, 
-0xAC0E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2F, 0x20E2, 0x93EB, 0xC591, 
-0xD613, 0xCDD2, 0xCD91, 0xCD91, 0xC591, 0xCDB2, 0xB4CE, 0xAC6D, 0xC571, 0x2902, 0x9BEE, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x18C2, 0xA48E, 0xDE33, 0xD5F2, 0xD5D2, 0xCDD2, 0xCD91, 0xCDB2, 
-0xB4CE, 0xA44C, 0xCD91, 0xCDB1, 0x3984, 0x8B6C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 
-0xC40D, 0xBC4F, 0x0000, 0xBD2F, 0xAC4E, 0x51A7, 0x6208, 0x6A48, 0xB4EF, 0xDE13, 0xBD0F, 0x9C0B, 0xACAE, 0xEE74, 0x18A1, 0x6A8A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x93AD, 0x5266, 0x30A3, 0x2823, 
-0x1802, 0x1822, 0xAC6E, 0xDE12, 0xB4CE, 0x9BEB, 0x9C0B, 0xCD91, 0x8BEC, 0x5A88, 0xB42E, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0x832B, 0x0800, 0x2022, 0x4905, 0x7269, 0xCD91, 0x940C, 0x72E8, 0xA44C, 
-0xA42C, 0xBD30, 0xF6D5, 0x838B, 0x18C4, 0xBC6F, 0xBC4F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x836C, 0x0000, 0x59C7, 0xC571, 0xD5D2, 0x3985, 0x2923, 0xB48D, 0xA42C, 0xBD30, 0xD5B1, 0xC5B5, 0x7BF4, 0x1062, 
-0x0000, 0xA40E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x834C, 0x0000, 0x2903, 
-0x18A1, 0x5226, 0x9C0B, 0xA42C, 0x9C0B, 0xBD30, 0xD5D0, 0xC594, 0x8435, 0x39CA, 0x3189, 0x3987, 0x2903, 0x6AA9, 0xC42E, 0xC40D, 
-0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0x9BED, 0x0020, 0x0862, 0x8C0E, 0xC54F, 0x9C0B, 0xBD0F, 0xCD90, 
-0xBD73, 0xA4F7, 0x8415, 0x4A6D, 0x528D, 0x2968, 0x1083, 0x2126, 0x7B0B, 0x6288, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC46F, 0xB42E, 0xAC2F, 0x2105, 0x31CB, 0xA4D1, 0xD5B0, 0xB4CE, 0xD5B1, 0xC573, 0x9495, 0xA53A, 0xA538, 0x4A4C, 0x420B, 0x4A6D, 
-0x5ACF, 0x420B, 0x0022, 0x0000, 0x6ACA, 0xB42E, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x5228, 0x0000, 0x0862, 0x4A6D, 0x39EB, 0x8C0F, 
-0xD5F3, 0xCDB1, 0xBD52, 0x9CB6, 0x94B8, 0xB599, 0x9D16, 0x4A4C, 0x420B, 0x422C, 0x422C, 0x424C, 0x4A6D, 0x5ACF, 0x18E5, 0x0000, 
-0x18C3, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0x41A5, 0x18C5, 0x4A4D, 0x422C, 0x422C, 0x39EB, 0x73B3, 0xBD95, 0xC571, 0x9CD6, 0x9496, 0xC61B, 0x9CF6, 
-0x39EB, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x424C, 0x422C, 0x424C, 0x31A9, 0x1081, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x4A07, 0x2147, 0x39EB, 0x4A6D, 
-0x422C, 0x4A4C, 0x9CD6, 0xA518, 0x9C96, 0xA4D5, 0x9496, 0xB599, 0xDEDD, 0x94B5, 0x31AA, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x4A4C, 0x4A6D, 0x422C, 0x2968, 0x2904, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x31CA, 0x528E, 0x422C, 0x420B, 0x4A6C, 0xBDFA, 0xD69C, 0x9CD7, 0x9497, 
-0xB599, 0xC65B, 0xDEFE, 0x94B5, 0x39CA, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A4D, 0x4A4C, 0x4A4C, 0x528E, 
-0x0000, 0x938C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 
-0x0841, 0x31C9, 0x4A6D, 0x424C, 0x420B, 0x4A4C, 0xAD98, 0xDEDD, 0xBDDA, 0xAD59, 0xCE7C, 0xC65B, 0xDEFE, 0x9CF6, 0x39CA, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x3A0B, 0x39CA, 0x420B, 0x4A4C, 0x4A4C, 0x0000, 0x9BEE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0841, 0x3189, 0x424C, 0x422C, 0x420B, 0x4A4C, 
-0xAD98, 0xD69D, 0xC65B, 0xCE5C, 0xC63B, 0xC65B, 0xCE7C, 0x8C54, 0x39CA, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x422B, 0x2988, 
-0x1906, 0x31A8, 0x4A4C, 0x4A4C, 0x0000, 0x9BEE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0841, 0x1905, 0x2967, 0x31C9, 0x422C, 0x4A4C, 0xAD98, 0xD69D, 0xC65B, 0xC65B, 0xC65B, 0xD6BD, 
-0x8413, 0x39EB, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422B, 0x2988, 0x2147, 0x2126, 0x31A8, 0x4A4C, 0x4A4C, 0x0000, 0x9BEE, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0841, 0x18E5, 
-0x2126, 0x31A8, 0x422C, 0x4A4C, 0xAD98, 0xD69D, 0xC63B, 0xC63B, 0xC65B, 0xD6BD, 0x73B2, 0x2989, 0x424C, 0x422C, 0x422C, 0x4A4C, 
-0x3A0B, 0x2988, 0x2988, 0x2147, 0x31A9, 0x422B, 0x4A4C, 0x4A4C, 0x0000, 0xAC0E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0841, 0x18E5, 0x31A9, 0x420B, 0x39EB, 0x39EB, 0xAD78, 0xD6BD, 
-0xC63B, 0xC63B, 0xC65B, 0xD6BD, 0x7BD2, 0x31AA, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x39EA, 0x1906, 0x10C4, 0x1905, 0x3A0B, 0x528D, 
-0x422C, 0x424C, 0x2106, 0x5A69, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBC6F, 0x0841, 0x10C4, 0x420B, 0x4A4C, 0x4A4C, 0x6B71, 0xB5B9, 0xCE7C, 0xC63B, 0xC63B, 0xC65B, 0xD6BD, 0x7BD2, 0x31AA, 
-0x422C, 0x422C, 0x422C, 0x4A4C, 0x3A0B, 0x1905, 0x0000, 0x18E4, 0x39EA, 0x422B, 0x422C, 0x422C, 0x5AEF, 0x0021, 0x41C6, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0841, 0x18E5, 0x420B, 0x39EB, 
-0x6330, 0xCE7C, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 0xC65B, 0xD6BD, 0x7BD2, 0x31AA, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x3A0B, 0x2105, 
-0x0821, 0x18E5, 0x2147, 0x31A9, 0x4A4C, 0x422C, 0x4A8D, 0x0842, 0x6AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44F, 0x0840, 0x3188, 0x4A4D, 0x39CA, 0x6330, 0xCE9C, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 
-0xC65B, 0xD6BD, 0x7BD2, 0x31AA, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x3A0A, 0x2147, 0x2126, 0x0861, 0x10A3, 0x31C9, 0x4A4C, 0x422C, 
-0x4A8D, 0x0842, 0x6AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x5228, 
-0x2968, 0x422B, 0x4A4C, 0x39EA, 0x5AEF, 0xAD59, 0xCE5C, 0xCE7C, 0xC63B, 0xC63B, 0xC65B, 0xD6BD, 0x7BD2, 0x31AA, 0x422C, 0x422C, 
-0x4A6D, 0x3A0B, 0x2968, 0x2967, 0x2988, 0x0821, 0x0862, 0x39EA, 0x4A6D, 0x424C, 0x4A8D, 0x0842, 0x6AA9, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x938D, 0x0000, 0x528E, 0x4A6D, 0x422C, 0x39EB, 0x52AE, 0x9496, 
-0xAD79, 0xC61B, 0xC65B, 0xC63B, 0xC65B, 0xD6BD, 0x7BD2, 0x31AA, 0x422C, 0x422C, 0x3A0B, 0x2968, 0x2126, 0x2147, 0x2967, 0x0020, 
-0x1083, 0x31C9, 0x39EA, 0x422C, 0x4A8E, 0x0842, 0x6AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xA3EE, 0x0000, 0x424C, 0x4A4C, 0x422C, 0x39EB, 0x5ACE, 0x9CB7, 0x9476, 0xB599, 0xCE7C, 0xC63B, 0xC65B, 0xD6BD, 
-0x7BD2, 0x31AA, 0x424C, 0x422C, 0x2968, 0x2126, 0x2967, 0x2988, 0x2967, 0x1082, 0x10A3, 0x2126, 0x2967, 0x422B, 0x528E, 0x0842, 
-0x6AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x0000, 0x424C, 0x4A4C, 
-0x422C, 0x39EB, 0x5ACE, 0x9CD7, 0x9CB7, 0xB5BA, 0xCE7C, 0xC63B, 0xC65B, 0xD6BD, 0x7BD2, 0x31AA, 0x424C, 0x424C, 0x2988, 0x2126, 
-0x31C9, 0x422B, 0x2967, 0x2968, 0x1082, 0x0841, 0x2988, 0x422C, 0x528E, 0x0842, 0x6AA9, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x0000, 0x424C, 0x4A4C, 0x422C, 0x39CA, 0x630F, 0xBDFA, 0xBDFB, 0xC61B, 
-0xC65B, 0xC63B, 0xC65B, 0xE71F, 0x8413, 0x3189, 0x422C, 0x422C, 0x420B, 0x39EA, 0x422B, 0x4A4C, 0x420B, 0x31C9, 0x0862, 0x0841, 
-0x2988, 0x4A4C, 0x4A4D, 0x39EB, 0x2967, 0x6ACA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA3EE, 0x0000, 0x424C, 0x4A4C, 0x4A4C, 0x3189, 0x52AE, 0xCE7C, 0xCE9C, 0xC65B, 0xC65B, 0xCE9C, 0xCE7C, 0x94B5, 0x52AE, 0x39EB, 
-0x422C, 0x422C, 0x4A4C, 0x4A4C, 0x4A4C, 0x424C, 0x4A4C, 0x31C9, 0x0862, 0x0841, 0x2968, 0x3188, 0x420B, 0x5ACF, 0x18E6, 0x18A2, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x0000, 0x4A4C, 0x4A4C, 0x420B, 0x528D, 
-0x8C74, 0xC65B, 0xC65B, 0xCE7C, 0xC61B, 0xBDDA, 0xB5B9, 0x4A6D, 0x3189, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 
-0x424C, 0x31C9, 0x0862, 0x0841, 0x2988, 0x3188, 0x420B, 0x528E, 0x2106, 0x2924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x93AD, 0x0021, 0x424C, 0x424C, 0x31A9, 0x8433, 0xE73E, 0xC63B, 0xC63B, 0xC65B, 0xAD59, 0x9476, 
-0x9496, 0x52AE, 0x39EB, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x424C, 0x31C9, 0x0862, 0x0841, 0x2988, 0x422B, 
-0x424C, 0x4A8D, 0x2106, 0x2924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x832B, 0x1063, 0x4A4C, 
-0x422C, 0x422C, 0x31AA, 0x8413, 0xDEFE, 0xC63B, 0xCE7C, 0xAD59, 0x9496, 0x9CB7, 0x94B6, 0x52AE, 0x39EB, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x424C, 0x424C, 0x31C9, 0x0861, 0x0841, 0x2988, 0x2967, 0x3A0B, 0x528E, 0x2106, 0x2924, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6289, 0x0021, 0x52AE, 0x422C, 0x422C, 0x422C, 0x3A0A, 0x73D1, 0xDEFE, 
-0xE71F, 0xC63B, 0xB599, 0xBDFA, 0xB5DA, 0x5AEF, 0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x424C, 0x2968, 
-0x2988, 0x2126, 0x0882, 0x2126, 0x3A0B, 0x528E, 0x2106, 0x2924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x72EA, 0x0842, 0x4A8D, 0x422C, 0x422C, 0x4A6D, 0x2147, 0x2147, 0x73D1, 0x6B90, 0xB5D9, 0xEF7F, 0xE73F, 0xDEFE, 0x6330, 
-0x31CA, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39CA, 0x4A6D, 0x31A8, 0x0000, 0x2126, 0x420B, 0x528E, 
-0x2106, 0x2924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 0x0842, 0x4A8E, 0x422C, 0x422C, 
-0x4A4C, 0x39EA, 0x1926, 0x10A4, 0x0042, 0x632F, 0xAD58, 0x9CF6, 0x94D5, 0x52CE, 0x39EB, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x4A4C, 0x528E, 0x2967, 0x0020, 0x2126, 0x3A0B, 0x528E, 0x2106, 0x2924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 0x0021, 0x4A6D, 0x424C, 0x422C, 0x4A6D, 0x39EA, 0x2146, 0x2147, 0x2967, 0x2146, 
-0x1906, 0x1926, 0x2126, 0x3A0B, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A8D, 0x2967, 
-0x0000, 0x2126, 0x420B, 0x528E, 0x2106, 0x2924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 
-0x0000, 0x39EA, 0x4A4C, 0x4A4C, 0x4A6D, 0x39EA, 0x2147, 0x2967, 0x2967, 0x2147, 0x2147, 0x2126, 0x2147, 0x3A0B, 0x4A4C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x52AE, 0x3188, 0x0000, 0x2126, 0x3A0B, 0x528E, 0x2106, 0x2924, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x832B, 0x0000, 0x2988, 0x31A9, 0x31C9, 0x2967, 0x18E5, 
-0x18E5, 0x2988, 0x2967, 0x2967, 0x2967, 0x2167, 0x2988, 0x424C, 0x528E, 0x4A6D, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 
-0x4A4C, 0x528E, 0x3188, 0x10A3, 0x18E5, 0x2147, 0x420B, 0x52AE, 0x2106, 0x2924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xB44F, 0x49E7, 0x0883, 0x2967, 0x2146, 0x2147, 0x1083, 0x0821, 0x1083, 0x2106, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2105, 0x2967, 0x3188, 0x31A9, 0x39EA, 0x39CA, 0x39CA, 0x39CA, 0x39CA, 0x39CA, 0x39CA, 0x424C, 0x0842, 0x0000, 0x1928, 0x10E6, 
-0x2988, 0x4A6D, 0x2106, 0x2924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x18A2, 0x0042, 0x31C9, 0x2967, 
-0x2967, 0x2967, 0x1905, 0x1083, 0x1063, 0x1083, 0x2105, 0x2967, 0x2967, 0x2106, 0x1083, 0x0862, 0x0821, 0x10A4, 0x2167, 0x2147, 
-0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x1905, 0x2103, 0x39C6, 0x526A, 0x4A69, 0x2146, 0x39EB, 0x2127, 0x20C2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x3144, 0x0862, 0x2988, 0x2967, 0x2967, 0x2967, 0x2988, 0x1905, 0x1063, 0x1083, 
-0x1063, 0x2126, 0x2106, 0x1062, 0x1083, 0x1083, 0x1063, 0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0000, 
-0x6AE8, 0xE633, 0xCD91, 0xCDB1, 0x5289, 0x298A, 0x2127, 0x3164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x41A6, 
-0x2105, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x1905, 0x1083, 0x1083, 0x20E5, 0x0021, 0x0000, 0x0821, 0x1083, 
-0x18E5, 0x2167, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x0000, 0x5A66, 0xD5B0, 0xB4CE, 0xCDB1, 0xC591, 0x41C5, 
-0x5229, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC44F, 0x0000, 0x1905, 0x31A8, 0x2147, 0x2967, 0x2967, 0x2967, 
-0x2147, 0x2988, 0x2947, 0x1083, 0x18C4, 0x0000, 0x5207, 0xA40E, 0x1061, 0x0821, 0x2126, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2126, 0x10A3, 0x62A8, 0x4183, 0x4183, 0xBD0E, 0xC571, 0xF6B4, 0x41C4, 0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44F, 0x8B8D, 0x0862, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x2147, 0x18E5, 0x1083, 0x0000, 0x2904, 
-0xC44F, 0xC42E, 0x18A2, 0x0021, 0x2106, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x1906, 0x0000, 0x49A3, 0x836C, 0x7B2B, 
-0x6287, 0xBD30, 0xF6D5, 0x41A4, 0x49C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x0000, 0x2988, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E5, 0x0842, 0x0842, 0x18C2, 0xC46F, 0xC40D, 0xC46F, 0x1082, 0x0841, 0x2126, 0x2988, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x2126, 0x0020, 0x1061, 0xBC6F, 0xBC6F, 0x18C2, 0xBD30, 0xC571, 0x49E5, 0x834C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x0000, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x18E5, 0x1083, 
-0x0021, 0x18A2, 0xBC4F, 0xC40D, 0xC40D, 0xC46F, 0x1082, 0x10C4, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x1905, 
-0x0841, 0xC44F, 0xA3EE, 0x3143, 0xCDB1, 0xD5F2, 0x20C1, 0x8B6C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x2104, 
-0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E5, 0x18C4, 0x0000, 0x18C2, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 
-0x1082, 0x18C5, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x18E5, 0x0841, 0xC44E, 0x9BAD, 0x3122, 0xDE33, 0x20E1, 
-0x8B8D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A47, 0x0000, 0x31E9, 0x2967, 0x2967, 0x2967, 0x2968, 0x2967, 
-0x18E5, 0x18A4, 0x0000, 0x2904, 0xBC6F, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC46F, 0x1082, 0x10C4, 0x2988, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2968, 0x1905, 0x0841, 0xC44F, 0x9BAD, 0x0000, 0x4A06, 0x8B6C, 0xC42E, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC46F, 0x5228, 0x0842, 0x2988, 0x2967, 0x2967, 0x2967, 0x2147, 0x18E5, 0x1062, 0x0822, 0x2924, 0xBC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x1082, 0x10C4, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E5, 0x0020, 0xC46F, 
-0xBC70, 0x3165, 0x7B2B, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20E3, 0x0863, 0x31A8, 0x2967, 0x2967, 
-0x2967, 0x2988, 0x18E5, 0x1063, 0x1063, 0x0000, 0xBC6F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x1081, 0x10C4, 
-0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x1905, 0x3144, 0xC46F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x2903, 0x0863, 0x2988, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E5, 0x1063, 0x1063, 0x0000, 
-0xBC6F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0840, 0x10C4, 0x31A8, 0x2147, 0x2967, 0x2967, 0x2967, 0x2988, 
-0x0862, 0x39A6, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 
-0x0862, 0x2988, 0x08A5, 0x10C6, 0x10E6, 0x2147, 0x2947, 0x18E5, 0x1062, 0x0821, 0x3985, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xB44F, 0x39A6, 0x1083, 0x2988, 0x2967, 0x2967, 0x2147, 0x31A9, 0x10A4, 0x0840, 0x7B0A, 0xC42E, 0xC40D, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x0862, 0x3165, 0x9C6F, 0x83CD, 0x62EA, 0x31A7, 
-0x2147, 0x2167, 0x18E5, 0x18C5, 0x0000, 0x836C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0x5227, 0x0021, 0x2988, 
-0x2967, 0x2967, 0x2967, 0x18E5, 0x10A3, 0x0862, 0x0000, 0x6ACA, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCD, 0x5246, 0xACAD, 0xA46D, 0xBCED, 0x5A89, 0x10E6, 0x2967, 0x2967, 0x18A4, 0x0000, 0x72EA, 
-0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x4A07, 0x0041, 0x2988, 0x2967, 0x2967, 0x2988, 0x1082, 0x1083, 0x31A9, 
-0x2988, 0x0000, 0x6ACA, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 
-0x0000, 0x20C2, 0x93CA, 0x5A89, 0x1907, 0x2967, 0x2147, 0x18A4, 0x10A4, 0x0000, 0x5207, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0x49E7, 0x0021, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x0000, 0x6ACA, 0xC42E, 0xC42E, 
-0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xC44F, 0xBC4F, 0x20E2, 0x10A3, 0x31A9, 0x2967, 
-0x2967, 0x2126, 0x2147, 0x1906, 0x10A3, 0x5207, 0xC42E, 0xC40D, 0xC42E, 0xC40D, 0xC42E, 0x3144, 0x0021, 0x31C9, 0x2147, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x1906, 0x2105, 0x49E6, 0x49E6, 0x49E6, 0x2103, 0x93CD, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x41C7, 0x0883, 0x2968, 0x2967, 0x2967, 0x2988, 0x29C9, 0x1906, 0x0800, 
-0x5A48, 0xC44E, 0xC40D, 0xC40D, 0xC42E, 0xBC6F, 0x3165, 0x0000, 0x31C9, 0x2988, 0x2988, 0x2988, 0x2126, 0x18E5, 0x2147, 0x2967, 
-0x31A8, 0x1906, 0x0021, 0x0021, 0x0021, 0x0821, 0x28C2, 0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6AA9, 0x0000, 0x31C9, 0x2967, 0x2967, 0x2946, 0x2926, 0x3126, 0x28E3, 0x0000, 0x62A9, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 
-0xC46F, 0x3145, 0x0021, 0x0842, 0x0041, 0x10C4, 0x20E5, 0x1083, 0x2147, 0x2967, 0x2147, 0x2967, 0x2988, 0x2988, 0x2168, 0x4A08, 
-0x38C2, 0x0820, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x10A3, 0x2126, 0x2967, 0x2947, 
-0x28E4, 0x28A2, 0x28C3, 0x28E3, 0x3904, 0x0000, 0x730B, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xBC6F, 0x2103, 0x41A6, 0x49E6, 0x20C3, 
-0x0021, 0x0863, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2167, 0x2967, 0x3986, 0x59E6, 0x4964, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BEE, 0x0000, 0x2967, 0x2904, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x30E4, 0x0000, 
-0x8B6C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xC44E, 0xC42E, 0x8B6C, 0x0000, 0x0861, 0x2147, 0x2967, 0x2967, 0x2967, 
-0x2167, 0x2147, 0x4186, 0x51A5, 0x51A6, 0x4144, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB42F, 0x0000, 0x28E4, 0x28E3, 0x28C3, 0x28C3, 0x28E3, 0x30E4, 0x3925, 0x0000, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC46F, 0xBC6F, 0xAC2F, 0x0020, 0x10A4, 0x31A9, 0x1947, 0x2167, 0x4186, 0x49A5, 0x51A5, 0x59E6, 0x4965, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xA40F, 0x93CD, 0x6289, 0x1020, 0x28C3, 0x28C3, 0x30E4, 0x3925, 
-0x2082, 0x0000, 0x0000, 0x5A48, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xB44F, 0x39A7, 0x1083, 0x41A7, 0x4186, 0x51A5, 0x51A5, 0x5A07, 0x38E3, 0x0840, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xAC0E, 0x1061, 0x0000, 0x1020, 0x3925, 0x28C3, 0x28C3, 0x20A3, 0x1041, 0x3945, 0x7B2B, 0x62A9, 0xC46F, 0xC40D, 0xC40E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC44F, 0x5207, 0x2081, 0x59C6, 0x51A5, 0x51A5, 
-0x51A6, 0x3924, 0x3144, 0x8B8D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x2082, 0x3104, 0x28E3, 0x28C3, 
-0x28C3, 0x30E4, 0x1041, 0x0000, 0x5A69, 0xC42E, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1082, 0x28C2, 0x59E7, 0x49A5, 0x49A5, 0x49A5, 0x59C6, 0x0800, 0x6AEA, 0xC40D, 
-};
-
-// zombie1_die_left_2.png
-// Size: 42x75 (6300 bytes)
-const uint16_t zombie1_die_left_2_bmp[3150] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA34B, 0x4985, 0x4985, 0x4985, 0x4985, 0x4985, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x7A88, 0x6A68, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 
-0x20E3, 0x20E3, 0x7A88, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x3964, 0x0861, 0x18C3, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x0861, 0x7A88, 0xBBCC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x41C7, 0x5A69, 0x5A69, 
-0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x18A2, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x18A2, 0x4A08, 0x5249, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 
-0x5A69, 0x18A2, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 
-0x5A69, 0x5A69, 0x732B, 0x93ED, 0x93ED, 0x93ED, 0x93ED, 0x732B, 0x5A69, 0x5A69, 0x5A69, 0x3986, 0x49A6, 0x7A88, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0x5A69, 0x6AEB, 0x9C4E, 0xC591, 0xC591, 0xC591, 
-0xC591, 0x93ED, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x2945, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x930A, 0x0020, 0x5A69, 0xACAF, 0xC591, 0xC591, 0xC591, 0xC591, 0xC591, 0x93ED, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 
-0x2945, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0xC591, 0xC591, 
-0xC591, 0xBD30, 0xA42C, 0xA42C, 0xBD30, 0xC591, 0xACAF, 0x5A69, 0xC591, 0xC591, 0x62C8, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0xC591, 0xC591, 0xBD0F, 0xAC6D, 0xA42C, 0xA42C, 0xBD30, 0xC591, 
-0xACAF, 0x5A69, 0xC591, 0xC591, 0x62C8, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x0020, 0xB4CE, 0xB4CE, 0xC570, 0xCDF2, 0xCDF2, 0x7AC9, 0xB4CF, 0xC591, 0xB4EF, 0x7B4A, 0xC591, 0xC591, 0x62C8, 0x3123, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x3103, 0x7B29, 0x93EB, 0xBD30, 0xD613, 
-0xD613, 0x7289, 0xB4CF, 0xC591, 0xC550, 0xAC8D, 0xC591, 0xC591, 0x62C8, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x7B29, 0x7AC9, 0x5987, 0x5987, 0xC591, 0xC591, 0xC591, 0xC591, 0xC591, 
-0xC591, 0xC591, 0x62C8, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x0020, 0x7B29, 0xAC8E, 0xBD10, 0xBD10, 0xC591, 0xC591, 0xC591, 0xC591, 0xC591, 0xA44C, 0xC550, 0x62C8, 0x3123, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x41A5, 0x838B, 0xC591, 0xC591, 0xC591, 
-0xC591, 0xC591, 0xC591, 0xC591, 0xA42C, 0xBD30, 0xA46E, 0x62A8, 0x4985, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x62C8, 0xB4EF, 0x93AC, 0x93AC, 0x93AC, 0xACAF, 0xC591, 0xC591, 0xA42C, 0xB4CE, 
-0xBD50, 0x942D, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 
-0x62A8, 0x9BED, 0x38A4, 0x38A4, 0x38A4, 0x830B, 0xC571, 0xC550, 0xA42C, 0xA42C, 0xB4CE, 0x942D, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x1041, 0x38A4, 0x38A4, 0x38A4, 0x830B, 
-0xBD30, 0xA42C, 0xA42C, 0xA42C, 0xB4CE, 0x942D, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0020, 0x0820, 0x38A4, 0x9C0D, 0xBD30, 0x942D, 0x18A1, 0xA42C, 0xA42C, 0xB4CE, 0xBD52, 
-0x8434, 0x3124, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x3986, 0x2967, 
-0x2967, 0x1842, 0x3985, 0x4A26, 0x5A87, 0x62A7, 0xA42C, 0xB4CE, 0xBD30, 0xBD52, 0x9CB7, 0x39C9, 0x41A6, 0x4985, 0x59C6, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x3145, 0x2967, 0x422C, 0x422C, 0x10A3, 0x2105, 0x3165, 0x5226, 0xA42C, 
-0xAC8D, 0xC550, 0xC572, 0xB554, 0xA518, 0x52AD, 0x2126, 0x10A3, 0x2925, 0x930A, 0x930A, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0x422C, 0x8414, 0xB514, 0xBD30, 0xA42C, 0xC591, 0xC591, 0xB514, 0xA518, 0xC63B, 0x52AE, 
-0x422C, 0x422C, 0x39EA, 0x0020, 0x0020, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x8414, 0x9CB7, 0xA4F5, 0xC591, 0xC591, 0xA4F5, 0x9CB7, 0x8414, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x18E4, 
-0x0020, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0x422C, 0x9CF6, 0xAD58, 0xA4F5, 0xC591, 0xA4F5, 0x9CD6, 
-0xAD58, 0x9CF6, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39CA, 0x31A9, 0x39C9, 0x3123, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x31A9, 
-0x422C, 0x422C, 0x422C, 0x422C, 0xA537, 0xAD79, 0x9CD6, 0xB514, 0x9CB7, 0xAD58, 0x9CD6, 0x73B2, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x420B, 0x2126, 0x59E6, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0x6330, 0xAD78, 0xB5B9, 
-0xA518, 0x9CB7, 0xA518, 0xBDFA, 0x8433, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x3A0B, 0x3A0B, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x0861, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0xC63B, 0xC63B, 0xC63B, 0xBDDA, 0x9CB7, 0xC63B, 0xC63B, 0x8433, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x39EA, 0x2967, 0x2967, 0x420B, 0x422C, 0x422C, 0x422C, 0x422C, 0x0861, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x31A9, 0x422C, 0x422C, 
-0x422C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x8433, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x2967, 0x2967, 
-0x420B, 0x422C, 0x422C, 0x422C, 0x422C, 0x0861, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 
-0xC63B, 0xC63B, 0x8433, 0x422C, 0x422C, 0x422C, 0x39EA, 0x3188, 0x2967, 0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x0861, 
-0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x8433, 0x422C, 0x422C, 0x422C, 
-0x31A9, 0x2126, 0x2105, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x0861, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0xC63B, 
-0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x8433, 0x422C, 0x422C, 0x422C, 0x31A9, 0x18E4, 0x0861, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x0861, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 
-0x8433, 0x422C, 0x422C, 0x422C, 0x31A9, 0x18E4, 0x0861, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x0861, 0x7A88, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x31A9, 
-0x422C, 0x422C, 0x422C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x6B71, 0x4A6D, 0x422C, 0x422C, 0x2988, 0x2967, 0x18E4, 
-0x0861, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x0861, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0xC63B, 0xC63B, 0xC63B, 
-0xC63B, 0xC63B, 0xC63B, 0x6330, 0x422C, 0x420B, 0x31A9, 0x2967, 0x2967, 0x18E4, 0x0861, 0x422C, 0x422C, 0x422C, 0x422C, 0x420B, 
-0x18E4, 0x7268, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x6330, 0x420B, 0x31C9, 
-0x2967, 0x2967, 0x2967, 0x18E4, 0x0861, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x31A9, 0x422C, 0x422C, 
-0x422C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x6330, 0x31C9, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E4, 0x0861, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x39EA, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 
-0xC63B, 0x6330, 0x31C9, 0x2967, 0x2967, 0x420B, 0x31A9, 0x18E4, 0x0861, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x0020, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0xA518, 0xBDFA, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x6330, 0x420B, 0x3A0B, 0x3A0B, 0x422C, 
-0x31A9, 0x18E4, 0x0861, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x31A9, 0x422C, 0x422C, 0x422C, 0x9CB7, 
-0xAD58, 0xBDDA, 0xC63B, 0xC63B, 0xC63B, 0x6330, 0x422C, 0x422C, 0x422C, 0x39CA, 0x2988, 0x18E4, 0x0861, 0x422C, 0x422C, 0x422C, 
-0x39CA, 0x2946, 0x6207, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBCC, 0x930A, 0x10A3, 0x39CA, 0x422C, 0x422C, 0x422C, 0x9CB7, 0x9CB7, 0xAD79, 0xC63B, 0xC63B, 0xC63B, 0x6330, 
-0x422C, 0x422C, 0x422C, 0x2968, 0x2126, 0x18C4, 0x18E4, 0x422C, 0x422C, 0x422C, 0x2967, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x9CB7, 0x9CB7, 0xAD79, 0xC63B, 0xC63B, 0xC63B, 0x6330, 0x422C, 0x422C, 0x422C, 0x2968, 0x1083, 0x18E4, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x2967, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0xC63B, 0xC63B, 0xC63B, 
-0xC63B, 0xC63B, 0xC63B, 0x6330, 0x422C, 0x422C, 0x422C, 0x2968, 0x1083, 0x18E4, 0x422C, 0x422C, 0x422C, 0x422C, 0x2967, 0x18A2, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x0020, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0xC63B, 0xC63B, 0xC63B, 0xBDFA, 0xA518, 0xA518, 0x5AEF, 0x422C, 0x422C, 
-0x422C, 0x2968, 0x1083, 0x18E4, 0x422C, 0x422C, 0x422C, 0x422C, 0x2967, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0xC63B, 0xC63B, 0xC63B, 0xC61B, 0xAD58, 0x9CB7, 0x5ACF, 0x422C, 0x422C, 0x422C, 0x2968, 0x1083, 0x18E4, 0x422C, 0x422C, 
-0x422C, 0x31A9, 0x2126, 0x2104, 0x7A88, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 
-0x9CF7, 0x5ACF, 0x422C, 0x422C, 0x422C, 0x2968, 0x1083, 0x18E4, 0x422C, 0x422C, 0x422C, 0x18E4, 0x18E4, 0x39EA, 0x0020, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x6330, 0x422C, 0x422C, 0x422C, 0x2968, 
-0x1083, 0x18E4, 0x422C, 0x422C, 0x422C, 0x18E4, 0x18E4, 0x39EA, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 
-0xA557, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x6330, 0x422C, 0x422C, 0x422C, 0x420B, 0x18C4, 0x10A3, 0x3188, 0x422C, 0x422C, 0x18E4, 
-0x18E4, 0x39EA, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x930A, 0x0020, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x2967, 0x4A8C, 0x632F, 0x632F, 0x632F, 0x632F, 0x52AD, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x18E4, 0x1083, 0x2967, 0x31A9, 0x31A9, 0x10A3, 0x18E4, 0x39EA, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4985, 0x2967, 0x2967, 
-0x39CA, 0x422C, 0x422C, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x3A0B, 0x422C, 0x422C, 0x422C, 0x3188, 0x4207, 0x41E7, 
-0x2967, 0x2967, 0x18E5, 0x18E5, 0x2967, 0x39EA, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x0020, 0x2126, 0x420B, 0x420B, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x3A0B, 0x422C, 0x422C, 0x422C, 0x0861, 0x7B8B, 0x942E, 0x39E8, 0x39E8, 0x0841, 0x2967, 0x422C, 0x39EA, 
-0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x3103, 0x10C3, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x3A0B, 0x422C, 0x422C, 
-0x422C, 0x0861, 0x7B8B, 0xC591, 0xC591, 0xC591, 0x18C2, 0x2967, 0x422C, 0x39EA, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3123, 0x2105, 0x2126, 0x2967, 
-0x2967, 0x18C4, 0x18C4, 0x2106, 0x2967, 0x2967, 0x2967, 0x2988, 0x2947, 0x20E5, 0x20E5, 0x0020, 0x7B8B, 0xC591, 0xC591, 0xC591, 
-0x18C2, 0x2105, 0x3188, 0x2967, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x1905, 0x2967, 0x2967, 0x2967, 0x1083, 0x1083, 0x18C4, 0x2106, 0x2967, 
-0x2967, 0x2106, 0x18C4, 0x1083, 0x1083, 0x0020, 0x7B8B, 0xC591, 0xC591, 0xC591, 0x7329, 0x3185, 0x1905, 0x2126, 0x0020, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x0020, 0x1905, 0x2967, 0x2967, 0x2967, 0x18C4, 0x1083, 0x1083, 0x10A4, 0x2126, 0x2126, 0x18A4, 0x1083, 0x1083, 0x18C4, 0x0821, 
-0x7B8B, 0xC591, 0xC591, 0xC591, 0xC591, 0x4A26, 0x1083, 0x2126, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x1905, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x18C4, 0x1083, 0x1083, 0x1083, 0x1083, 0x1083, 0x1083, 0x18C4, 0x2967, 0x0841, 0x7B8B, 0xC591, 0xC591, 0xC591, 0xC591, 0x4A26, 
-0x1083, 0x2126, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0020, 0x1905, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E5, 0x1083, 0x1083, 0x1083, 0x0841, 
-0x0842, 0x18C4, 0x2967, 0x0841, 0x7B8B, 0xC591, 0xC591, 0xC591, 0xC591, 0xC591, 0x7B8B, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x3123, 0x1905, 0x2147, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E5, 0x1083, 0x1083, 0x0841, 0x0020, 0x0842, 0x18C4, 0x2967, 0x1905, 0x3185, 0x62C8, 
-0xC591, 0xC591, 0xACAE, 0xBD0F, 0x7B8B, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E5, 
-0x1083, 0x0842, 0x6207, 0x18A2, 0x0842, 0x18C4, 0x2967, 0x2967, 0x1083, 0x4A26, 0xC591, 0xC591, 0x6287, 0x9C4D, 0x7B8B, 0x18A2, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x0020, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x18E5, 0x1062, 0x0020, 0xC40D, 0x3103, 0x0842, 0x18C4, 
-0x2967, 0x2967, 0x10A3, 0x41E6, 0xACCF, 0xACCF, 0x20E3, 0x732A, 0x7B6A, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x18C4, 0x1083, 0x1062, 0x0020, 0xC40D, 0x3103, 0x0842, 0x18C4, 0x2967, 0x2967, 0x2967, 0x18E4, 0x0020, 0x0020, 
-0x2126, 0x1083, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18C4, 0x0862, 0x3124, 0xAB8C, 
-0xC40D, 0xBBCC, 0x59E6, 0x0841, 0x10A4, 0x2147, 0x2967, 0x2147, 0x2126, 0x2126, 0x2967, 0x1083, 0x4985, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0020, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18C4, 0x0842, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0821, 0x1083, 0x2147, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x1083, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x1083, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2106, 
-0x18A4, 0x0842, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0821, 0x1083, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E4, 
-0x3965, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x7A88, 0x930A, 
-0xC40D, 0xC40D, 0x0862, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x1083, 0x1083, 0x0842, 0x28E3, 0xAB8C, 0xAB8C, 0xC40D, 
-0x6207, 0x0821, 0x1083, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E5, 0x20C2, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 
-0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 0x3944, 0x0841, 0x28E3, 0xAB8C, 0xC40D, 0x0862, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x1083, 0x0841, 0x0842, 0x1062, 0x0020, 0x0020, 0x930A, 0x6207, 0x0821, 0x1083, 0x2147, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x3944, 0x49A5, 0x3944, 0x0020, 0xC40D, 0x0862, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x1083, 0x0841, 0x0842, 
-0x1083, 0x1083, 0x1083, 0x1061, 0x1061, 0x0821, 0x1083, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2126, 0x2126, 0x2126, 0x2126, 0x2126, 0x2126, 0x2126, 0x2126, 0x2126, 0x2946, 0x4165, 0x4985, 0x49A5, 0x49A5, 0x4165, 0x18A2, 
-0x0862, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x1083, 0x0862, 0x1062, 0x1083, 0x1083, 0x1083, 0x0862, 0x0821, 0x0821, 
-0x1083, 0x18E5, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x3986, 0x4986, 0x49A5, 0x49A5, 0x49A5, 0x0020, 0x2904, 0x1905, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x18C4, 0x1083, 0x1083, 0x1083, 0x1083, 0x1083, 0x1083, 0x0862, 0x0841, 0x1062, 0x1083, 0x2106, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2147, 0x2146, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x4186, 
-0x49A5, 0x49A5, 0x49A5, 0x0020, 0x930A, 0x0020, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18C4, 0x1083, 0x1083, 0x1083, 
-0x1083, 0x1083, 0x1083, 0x1062, 0x0020, 0x1083, 0x2106, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E5, 0x18E5, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x4186, 0x49A5, 0x49A5, 0x49A5, 0x0020, 
-};
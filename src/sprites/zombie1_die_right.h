@@ -1,405 +0,0 @@
-// Total bitmap data size: 12600 bytes
-
-// zombie1_die_right_1.png
-// Size: 42x75 (6300 bytes)
-const uint16_t zombie1_die_right_1_bmp[3150] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BEE, 0x0861, 0x2924, 0x2924, 0x2924, 0x0841, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0x9BCD, 0x2904, 
-0x28E3, 0x2924, 0x2924, 0x2924, 0x28E3, 0x41A6, 0x6AAA, 0x6289, 0xC44E, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xA3EE, 0x18A2, 0x3145, 0x730C, 0x62AA, 0x62AA, 0x62AA, 0x730C, 0x41C7, 
-0x0820, 0x0841, 0x6ACA, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44F, 0x0000, 0x3986, 0x6AEB, 0x5A69, 0x5A69, 0x5249, 0x5249, 0x5229, 0x5249, 0x62AA, 0x62CB, 0x0000, 0x72EA, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x1082, 0x41A6, 0x62AA, 0x5A69, 0x5A69, 
-0x5A8A, 0x5A8A, 0x5A8A, 0x5A8A, 0x5A89, 0x5A69, 0x62AA, 0x0841, 0x6AAA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x2904, 0x49E7, 0x5249, 0x5A69, 0x5229, 0x6AEA, 0xB4EF, 0xBD10, 0xB4F0, 0xBD30, 0xA48E, 0x5249, 
-0x628A, 0x0840, 0x6AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x0000, 0x5229, 
-0x4A09, 0x5249, 0x49E8, 0x62AA, 0xCDB1, 0xDE13, 0xDE12, 0xDE12, 0xCD91, 0xA46E, 0x62CA, 0x0000, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0F, 0x0000, 0x838C, 0x8BED, 0x62CA, 0x5A8A, 0x942E, 0xC571, 0xBD30, 
-0xB4CE, 0xBD30, 0xD5D2, 0xDE12, 0xACAF, 0x1081, 0x6ACA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA40E, 0x1060, 0xD5B1, 0xEE73, 0x7B4B, 0x734B, 0xDE33, 0xCD91, 0xAC6D, 0x93AA, 0xA44C, 0xC550, 0xCD91, 0xEE94, 0x41C4, 
-0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x1040, 0xC571, 0xDE13, 0x734B, 
-0x732B, 0xD5F2, 0xCD91, 0xAC8D, 0x9C0B, 0x9C0B, 0xA46D, 0xC571, 0xE654, 0x41A4, 0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x1040, 0xC571, 0xD5F2, 0x9C2C, 0x9C0C, 0xD5D2, 0xCD91, 0x61C7, 0xAC8F, 0xFFFA, 
-0xEF15, 0xACAE, 0xCD70, 0x28E1, 0x49C7, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 
-0x1040, 0xC571, 0xD5F2, 0xC550, 0xBD2F, 0xCD91, 0xC591, 0x9BCD, 0x93AD, 0xA44F, 0xA42E, 0x9C0C, 0x5205, 0x6ACA, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x0820, 0xC571, 0xC550, 0xC571, 0xCDB2, 0xC571, 
-0xC591, 0xDE73, 0x9BCC, 0x5146, 0x7A89, 0xAC6D, 0x0000, 0x9BCE, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40E, 0x9BEE, 0x2923, 0xC571, 0xAC6D, 0xB4CE, 0xCDB2, 0xCD91, 0xCD91, 0xCD91, 0xCDD2, 0xD613, 0xC591, 0x93EB, 
-0x20C2, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x3984, 0xCDB1, 0xCD91, 
-0xA44C, 0xB4CE, 0xCDB1, 0xCD91, 0xCDD2, 0xCDD2, 0xD5D2, 0xDE33, 0xA48E, 0x18A1, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6AAA, 0x18A1, 0xEE74, 0xACAE, 0x9C0B, 0xBD0F, 0xDE33, 0xB4EF, 0x6A48, 0x6208, 
-0x51A7, 0xAC4E, 0xBD30, 0x0000, 0xBC4F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xB42E, 
-0x5A88, 0x8BEC, 0xCD91, 0x9C0B, 0x9C0B, 0xB4CE, 0xDE12, 0xAC6E, 0x2022, 0x1801, 0x2823, 0x30A3, 0x5266, 0x93AD, 0xC44F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0xBC6F, 0xBC4F, 0x18E4, 0x838B, 0xF6D5, 0xBD30, 0xA42C, 0xA44C, 0x72E8, 
-0x940C, 0xCD91, 0x7269, 0x4905, 0x2022, 0x0800, 0x7B2B, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 
-0xA3EE, 0x0000, 0x1062, 0x7BF4, 0xC5B5, 0xD5B1, 0xBD30, 0xA42C, 0xAC8D, 0x2923, 0x3985, 0xD5F2, 0xC571, 0x59A7, 0x0000, 0x836C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC42E, 0x6AA9, 0x2903, 0x3987, 0x3189, 0x39CA, 0x8435, 0xC594, 0xD5D0, 
-0xBD30, 0x9C0B, 0xA42C, 0x9C0B, 0x5226, 0x18C1, 0x2903, 0x0000, 0x836C, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 
-0x6288, 0x7B0B, 0x2126, 0x1083, 0x2968, 0x528D, 0x4A6D, 0x8415, 0xA4F7, 0xBD73, 0xCD90, 0xBD0F, 0x9C0B, 0xCD4F, 0x8BEE, 0x0843, 
-0x0020, 0x9BED, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xB44F, 0xB42E, 0x6ACA, 0x0000, 0x0842, 0x420B, 0x5ACF, 0x4A6D, 0x420B, 
-0x4A4C, 0xAD38, 0xA53A, 0x9495, 0xC573, 0xD5B1, 0xB4CE, 0xD5B0, 0xA4D1, 0x31AB, 0x2105, 0xAC2F, 0xB42E, 0xC46F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBC4F, 0x18C3, 0x0000, 0x18E5, 0x5ACF, 0x4A6D, 0x424C, 0x422C, 0x422C, 0x420B, 0x4A4C, 0x9D16, 0xB599, 0x94B8, 0x9CB6, 0xBD52, 
-0xCDB1, 0xD5F3, 0x8C0F, 0x39EB, 0x4A6D, 0x0862, 0x0000, 0x5248, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x1061, 0x31A9, 0x424C, 0x422C, 0x424C, 0x424C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EB, 0x9CF6, 0xC61B, 0x9496, 0x9CD6, 0xC571, 0xBD75, 0x73B3, 0x39EB, 0x422C, 0x422C, 
-0x4A4D, 0x18C5, 0x41A6, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xB44F, 0x2904, 0x2968, 0x422C, 0x4A6D, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x31AA, 
-0x94B5, 0xDEDD, 0xB599, 0x9496, 0xA4D5, 0x9C96, 0xA518, 0x9CD6, 0x4A4C, 0x422C, 0x4A6D, 0x39EB, 0x2127, 0x4A07, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8C, 0x0000, 0x528E, 0x4A4C, 
-0x4A4C, 0x4A4D, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39CA, 0x94B5, 0xDEFE, 0xC65B, 0xB599, 0x9497, 0x9CD7, 
-0xD69C, 0xBDFA, 0x4A6C, 0x420B, 0x422C, 0x528E, 0x31AA, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BEE, 0x0000, 0x4A4C, 0x4A4C, 0x3A0B, 0x39EA, 0x3A0B, 0x4A4C, 0x424C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x39CA, 0x9CF6, 0xDEFE, 0xC65B, 0xCE7C, 0xAD59, 0xBDDA, 0xDEFD, 0xAD78, 0x4A4C, 0x420B, 0x424C, 0x4A6D, 
-0x31AA, 0x0841, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x9BEE, 0x0000, 0x4A4C, 0x4A4D, 0x3188, 0x1905, 0x2988, 0x422B, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39CA, 0x8454, 0xCE7C, 
-0xC65B, 0xC63B, 0xCE5B, 0xC65B, 0xD69C, 0xAD98, 0x4A4C, 0x420B, 0x422B, 0x424C, 0x3189, 0x0841, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BEE, 0x0000, 0x4A4C, 0x4A4D, 0x31A8, 0x2126, 
-0x2147, 0x2988, 0x422B, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EB, 0x8433, 0xD6BD, 0xC65B, 0xC65B, 0xC65B, 0xD69D, 0xAD98, 
-0x4A4C, 0x422C, 0x31C9, 0x2967, 0x1905, 0x0841, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x0000, 0x4A4C, 0x4A4C, 0x422B, 0x31A9, 0x2147, 0x2988, 0x2988, 0x3A0B, 0x4A4C, 0x422C, 
-0x422C, 0x424C, 0x2969, 0x73B1, 0xD6BD, 0xC65B, 0xC63B, 0xC63B, 0xD69D, 0xAD98, 0x4A4C, 0x422C, 0x31A8, 0x2126, 0x18E5, 0x0841, 
-0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x5A69, 0x2106, 
-0x424C, 0x422C, 0x528D, 0x3A0B, 0x1905, 0x10C4, 0x1905, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x31AA, 0x7BF2, 0xD6BD, 0xC65B, 
-0xC63B, 0xC63B, 0xD6BD, 0xAD78, 0x39EB, 0x39EB, 0x420B, 0x31A9, 0x18E5, 0x0841, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x41C6, 0x0021, 0x5AEF, 0x422C, 0x422C, 0x422B, 0x39EA, 0x18E4, 0x0000, 
-0x1905, 0x3A0B, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x31AA, 0x7BF2, 0xD6BD, 0xC65B, 0xC63B, 0xC63B, 0xCE9C, 0xB5D9, 0x6B71, 0x4A4C, 
-0x4A4C, 0x420B, 0x10C4, 0x0841, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40E, 0x6AA9, 0x0842, 0x4A8D, 0x422C, 0x4A4C, 0x31A9, 0x2147, 0x18E5, 0x0841, 0x1905, 0x3A0B, 0x4A4C, 0x422C, 0x422C, 0x422C, 
-0x31AA, 0x7BF2, 0xD6BD, 0xC65B, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xCE7C, 0x6330, 0x39EB, 0x3A0B, 0x18E5, 0x0841, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x6AA9, 0x0842, 0x4A6D, 0x422C, 0x4A4C, 
-0x31C9, 0x10A3, 0x0862, 0x2126, 0x2147, 0x3A0B, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x31AA, 0x7BF2, 0xD6BD, 0xC65B, 0xC63B, 0xC63B, 
-0xC63B, 0xCE7C, 0xCE7C, 0x6330, 0x39CA, 0x4A4D, 0x3188, 0x0840, 0xC46F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x6AA9, 0x0842, 0x4A6D, 0x424C, 0x4A6D, 0x39EA, 0x0862, 0x0840, 0x2988, 0x2967, 0x2968, 
-0x3A0B, 0x4A6D, 0x422C, 0x422C, 0x31AA, 0x7BF2, 0xD6BD, 0xC65B, 0xC63B, 0xC63B, 0xCE7C, 0xCE5C, 0xAD59, 0x5AEE, 0x39EA, 0x4A4C, 
-0x422B, 0x2988, 0x5228, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x6AA9, 
-0x0842, 0x4A8E, 0x422C, 0x39EA, 0x31CA, 0x1083, 0x0020, 0x2967, 0x2147, 0x2126, 0x2968, 0x3A0B, 0x422C, 0x422C, 0x31AA, 0x7BF2, 
-0xD6BD, 0xC65B, 0xC63B, 0xCE5B, 0xC61B, 0xAD79, 0x9496, 0x52AE, 0x39EB, 0x422C, 0x4A6D, 0x528E, 0x0000, 0x93AD, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6AC9, 0x0822, 0x528E, 0x422B, 0x2967, 0x2126, 0x10A3, 
-0x1082, 0x2967, 0x2988, 0x2967, 0x2126, 0x2968, 0x422C, 0x424C, 0x31AA, 0x7BF2, 0xD6BD, 0xC65B, 0xC63B, 0xCE7C, 0xB599, 0x9476, 
-0x9CB7, 0x5ACE, 0x39EB, 0x422C, 0x4A4C, 0x424C, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC42E, 0x6AA9, 0x0842, 0x528E, 0x422C, 0x2988, 0x0841, 0x1082, 0x2968, 0x2967, 0x422B, 0x31C9, 0x2126, 0x2988, 
-0x422C, 0x424C, 0x31AA, 0x7BF2, 0xD6BD, 0xC65B, 0xC63B, 0xCE7C, 0xB5B9, 0x9CB7, 0x9CD7, 0x5ACE, 0x39EB, 0x422C, 0x4A4C, 0x424C, 
-0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6ACA, 0x2967, 0x39EB, 0x4A6D, 
-0x424C, 0x2988, 0x0841, 0x0862, 0x31C9, 0x420B, 0x424C, 0x422B, 0x3A0B, 0x420B, 0x422C, 0x422C, 0x31A9, 0x8413, 0xE71F, 0xC65B, 
-0xC63B, 0xC65B, 0xC61B, 0xBE1B, 0xBDFA, 0x630F, 0x39CA, 0x422C, 0x4A4C, 0x424C, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x18E6, 0x5ACF, 0x420B, 0x3188, 0x2968, 0x0841, 0x0862, 0x31C9, 0x4A4C, 
-0x424C, 0x4A4C, 0x4A4C, 0x4A4C, 0x422C, 0x422C, 0x3A0B, 0x52AE, 0x94B5, 0xCE7C, 0xCE9C, 0xC65B, 0xC65B, 0xCE9C, 0xCE7C, 0x52AE, 
-0x2989, 0x4A4C, 0x4A4C, 0x424C, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x2924, 0x2106, 0x528E, 0x420B, 0x3188, 0x2988, 0x0841, 0x0862, 0x31C9, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x4A4C, 0x31A9, 0x4A6D, 0xB5B9, 0xBDDA, 0xC61B, 0xCE7C, 0xC65B, 0xC65B, 0x8C74, 0x528D, 0x420B, 0x4A4C, 0x424C, 0x0000, 0xAC0E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x2924, 0x2106, 0x4A6D, 0x4A4C, 0x422B, 0x31A8, 
-0x0841, 0x0862, 0x31C9, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x3A0B, 0x52AE, 0x9496, 0x9496, 0xAD59, 
-0xC65B, 0xC63B, 0xC63B, 0xE73E, 0x8433, 0x31A9, 0x4A4C, 0x424C, 0x0021, 0x93AD, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x2924, 0x2106, 0x528E, 0x3A0B, 0x2967, 0x2988, 0x0841, 0x0861, 0x31C9, 0x424C, 0x424C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EB, 0x52AE, 0x9496, 0x9CB7, 0x9496, 0xAD59, 0xCE7C, 0xC65B, 0xDEFE, 0x8413, 0x31AA, 
-0x422C, 0x424C, 0x4A4C, 0x1083, 0x834B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x2924, 0x2106, 
-0x528E, 0x3A0B, 0x2126, 0x0882, 0x2926, 0x2988, 0x2968, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 
-0x5AEF, 0xBDDA, 0xBDFA, 0xB599, 0xC63B, 0xE71F, 0xDEFE, 0x73D1, 0x3A0A, 0x422C, 0x422C, 0x422C, 0x52AE, 0x0021, 0x6289, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x2924, 0x2106, 0x528E, 0x420B, 0x2126, 0x0000, 0x31A8, 0x4A6D, 
-0x39CA, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x31CA, 0x6330, 0xDEFE, 0xE73F, 0xEF7F, 0xB5D9, 0x6B90, 
-0x73D1, 0x2147, 0x2147, 0x4A6D, 0x422C, 0x422C, 0x4A8D, 0x0022, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x2924, 0x2106, 0x528E, 0x420B, 0x2126, 0x0020, 0x2967, 0x528E, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x39EB, 0x52CE, 0x94D5, 0x9CF6, 0xAD58, 0x632F, 0x0043, 0x10A4, 0x2126, 0x39EA, 0x4A4D, 0x422C, 0x422C, 
-0x4A8E, 0x0022, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x2924, 0x2106, 0x528E, 0x420B, 
-0x2126, 0x0000, 0x2967, 0x4A8D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x3A0B, 0x2126, 
-0x1906, 0x1906, 0x2147, 0x2967, 0x2147, 0x2147, 0x39EA, 0x4A4D, 0x422C, 0x422C, 0x4A6D, 0x0021, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x2924, 0x2106, 0x528E, 0x420B, 0x2126, 0x0000, 0x3188, 0x528E, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x3A0B, 0x2147, 0x2126, 0x2147, 0x2147, 0x2967, 0x2967, 0x2147, 
-0x39EA, 0x4A6D, 0x4A4C, 0x4A4C, 0x39CA, 0x0000, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x2924, 0x2106, 0x52AE, 0x420B, 0x2147, 0x18E5, 0x10A3, 0x3188, 0x528E, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 
-0x4A6D, 0x528E, 0x424C, 0x2988, 0x2147, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E5, 0x18E5, 0x2967, 0x31C9, 0x31A9, 0x2988, 0x0000, 
-0x832B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x2924, 0x2126, 0x4A6D, 0x2988, 0x10E6, 0x1927, 
-0x0000, 0x0862, 0x424C, 0x39CA, 0x39CA, 0x39CA, 0x39CA, 0x39CA, 0x39EA, 0x39EA, 0x31A9, 0x3188, 0x2967, 0x2105, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2105, 0x1083, 0x0821, 0x1083, 0x2167, 0x2146, 0x2967, 0x0883, 0x49E7, 0xB44F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20E3, 0x2127, 0x39EB, 0x2146, 0x4A6A, 0x526A, 0x39C6, 0x2104, 0x1905, 0x2147, 0x2147, 0x2147, 
-0x2147, 0x2147, 0x2147, 0x2167, 0x10A4, 0x0821, 0x0862, 0x1083, 0x2106, 0x2967, 0x2967, 0x2105, 0x1083, 0x1063, 0x1083, 0x1905, 
-0x2967, 0x2967, 0x2967, 0x31C9, 0x0842, 0x18A2, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3164, 0x2127, 
-0x298A, 0x5289, 0xCDB1, 0xCD91, 0xE633, 0x6AE8, 0x0000, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E5, 0x1063, 
-0x1083, 0x1083, 0x1063, 0x2126, 0x2126, 0x1083, 0x1083, 0x1063, 0x2105, 0x2988, 0x2967, 0x2967, 0x2967, 0x2988, 0x0862, 0x3144, 
-0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x5228, 0x41A5, 0xC592, 0xCDB1, 0xB4AE, 0xD590, 0x5A66, 
-0x0000, 0x2988, 0x2967, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x18E5, 0x1063, 0x0821, 0x0000, 0x0021, 0x20E5, 0x1063, 
-0x1083, 0x2105, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x2105, 0x39A6, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6289, 0x49C4, 0xF6B4, 0xC571, 0xBD0E, 0x4183, 0x3983, 0x62A8, 0x10A3, 0x2126, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2988, 0x2126, 0x0821, 0x1061, 0xA40E, 0x5207, 0x0000, 0x18C4, 0x1083, 0x2167, 0x2988, 0x2147, 0x2967, 0x2967, 
-0x2967, 0x2147, 0x31A8, 0x1905, 0x0000, 0xC44F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x41C6, 0x41A4, 0xF6D5, 
-0xBD30, 0x6287, 0x7B0B, 0x836C, 0x49C3, 0x0000, 0x2106, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x2106, 0x0021, 0x18A2, 
-0xC42E, 0xC44F, 0x2904, 0x0000, 0x1083, 0x1905, 0x2147, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x0862, 0x8B8D, 
-0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x834C, 0x49E6, 0xC571, 0xBD30, 0x18C2, 0xBC6F, 0xBC6F, 0x1082, 0x0020, 
-0x2126, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x2126, 0x0842, 0x1082, 0xC46F, 0xC40D, 0xBC6F, 0x18C2, 0x0842, 0x0842, 
-0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x0000, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8B6C, 0x20C1, 0xD5F2, 0xCDB2, 0x3143, 0xA3EE, 0xC44F, 0x0841, 0x18E5, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2968, 0x10C4, 0x1082, 0xC46F, 0xC40D, 0xC40D, 0xBC4F, 0x18A2, 0x0021, 0x1083, 0x18E5, 0x2968, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x8B8D, 0x20E1, 0xE633, 
-0x3123, 0x9BAD, 0xC44E, 0x0841, 0x18E5, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x18C5, 0x1082, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xBC4F, 0x18C3, 0x0000, 0x18C4, 0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x1905, 0x2104, 0xA3EE, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC42E, 0x8B6C, 0x4A06, 0x0000, 0x9BAD, 0xC44F, 0x0841, 0x18E5, 0x2968, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x10C4, 0x1082, 0xC46F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xBC6F, 0x2104, 0x0000, 
-0x18A4, 0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x31C9, 0x0000, 0x5A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40E, 0xC40D, 0xC40D, 0x7B0B, 0x3985, 0xC46F, 0xC46F, 0x0000, 0x18E5, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 
-0x10C4, 0x1082, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x2904, 0x0842, 0x1062, 0x18E5, 0x2147, 0x2967, 0x2967, 
-0x2967, 0x2988, 0x0842, 0x5228, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 
-0xC46F, 0x2924, 0x1905, 0x2167, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x10C4, 0x1061, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40E, 0xC40D, 0xBC4F, 0x0000, 0x1063, 0x1063, 0x18E5, 0x2988, 0x2967, 0x2967, 0x2967, 0x31A8, 0x0862, 0x20E3, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x39A6, 0x0862, 0x2988, 0x2967, 
-0x2967, 0x2967, 0x2147, 0x29A8, 0x10C4, 0x0841, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xBC4F, 0x0000, 0x1063, 
-0x1063, 0x18E5, 0x2988, 0x2967, 0x2967, 0x2967, 0x2988, 0x0863, 0x2103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC42E, 0x7B0A, 0x0840, 0x10A4, 0x31A9, 0x2147, 0x2967, 0x2967, 0x2988, 0x0883, 0x39A6, 0xB44F, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x3985, 0x0821, 0x1062, 0x18E5, 0x2947, 0x2147, 0x10E6, 0x10C6, 0x08A5, 
-0x2988, 0x0862, 0x1061, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x6ACA, 0x0000, 
-0x0862, 0x10A3, 0x1905, 0x2967, 0x2967, 0x2967, 0x2988, 0x0021, 0x5227, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8B6C, 0x0000, 0x18C5, 0x18E5, 0x2967, 0x2147, 0x31A7, 0x6AEA, 0x83CD, 0x9C6F, 0x3165, 0x0862, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x6ACA, 0x0000, 0x2988, 0x31A9, 0x1082, 0x1083, 0x2988, 0x2967, 0x2967, 
-0x2988, 0x0021, 0x4A07, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x72EA, 0x0000, 0x18A4, 0x2967, 0x2967, 0x10E6, 
-0x5A89, 0xBCED, 0xA46D, 0xACAD, 0x5246, 0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xC42E, 0xC42E, 0xC42E, 
-0x6ACA, 0x0000, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x0021, 0x49E7, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0x5207, 0x0000, 0x10A3, 0x18A4, 0x2147, 0x2967, 0x1906, 0x5A89, 0x93CA, 0x20E2, 0x0000, 0xA40E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93CD, 0x20E3, 0x49E6, 0x49E6, 0x49E6, 0x2105, 0x1906, 0x2988, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2147, 0x31C9, 0x0021, 0x2924, 0xC42E, 0xC40D, 0xC40E, 0xC40D, 0xC44E, 0x5207, 0x10A3, 0x1906, 0x2147, 
-0x2126, 0x2147, 0x2967, 0x31A9, 0x1083, 0x20E2, 0xBC4F, 0xC44F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCD, 0x28C2, 
-0x0820, 0x0021, 0x0041, 0x0021, 0x1906, 0x31A8, 0x2967, 0x2147, 0x18E5, 0x2126, 0x2988, 0x2988, 0x2988, 0x31C9, 0x0000, 0x3165, 
-0xC46F, 0xC42E, 0xC40D, 0xC40D, 0xC44E, 0x5A48, 0x0800, 0x1905, 0x29C9, 0x2988, 0x2967, 0x2967, 0x2968, 0x0863, 0x41E7, 0xB44F, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0820, 0x38C2, 0x4A08, 0x2168, 0x2988, 0x2988, 0x2967, 0x2147, 
-0x2967, 0x2147, 0x1083, 0x2105, 0x10C4, 0x0021, 0x0042, 0x0041, 0x3145, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x6289, 0x0000, 
-0x30E3, 0x2926, 0x2926, 0x2946, 0x2968, 0x2967, 0x31C9, 0x0000, 0x6AA9, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x4164, 0x59E6, 0x3986, 0x2967, 0x2167, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x0863, 0x0021, 0x20E3, 0x49E6, 
-0x41A6, 0x2903, 0xBC6F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0x730B, 0x0000, 0x3904, 0x28E3, 0x28C3, 0x28A3, 0x28E4, 0x2967, 0x2967, 
-0x2126, 0x1082, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4144, 0x51C6, 0x51A5, 0x4186, 
-0x2147, 0x2167, 0x2967, 0x2967, 0x2968, 0x2147, 0x1061, 0x0000, 0x8B6C, 0xC42E, 0xC44E, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x836C, 0x0000, 0x30E4, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x2904, 0x2967, 0x0000, 0x9BEE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4965, 0x59E6, 0x51A5, 0x51A5, 0x4186, 0x2167, 0x1947, 0x31A9, 0x10A4, 0x0020, 
-0xB44F, 0xBC6F, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 0x0000, 0x3925, 0x30E4, 0x28E3, 
-0x28C3, 0x28C3, 0x28E3, 0x28E4, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x1020, 0x38E3, 0x5A07, 0x51A5, 0x51A5, 0x4186, 0x41A7, 0x1083, 0x39C7, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x5A48, 0x0000, 0x0000, 0x2082, 0x3924, 0x30E4, 0x28C3, 0x28C3, 0x1021, 0x62A9, 
-0x93CD, 0xA40F, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8D, 0x3144, 0x3924, 0x51A6, 0x49A5, 0x51A5, 
-0x59C6, 0x2081, 0x5207, 0xC44F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 
-0xC46F, 0x62A9, 0x7B2B, 0x3945, 0x1041, 0x20A3, 0x28C3, 0x28C3, 0x3925, 0x1020, 0x0000, 0x0841, 0xAC0E, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6AEA, 0x0800, 0x59C6, 0x49A5, 0x49A5, 0x49A5, 0x59E7, 0x28C2, 0x1082, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC42E, 0x5A69, 0x0000, 0x1041, 
-0x30E4, 0x28C3, 0x28C3, 0x28E3, 0x3104, 0x2082, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-};
-
-// zombie1_die_right_2.png
-// Size: 42x75 (6300 bytes)
-const uint16_t zombie1_die_right_2_bmp[3150] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x4985, 0x4985, 0x4985, 0x4985, 0x4985, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x7A88, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x5A06, 0x7A88, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x8AEA, 0x0861, 0x5A69, 0x5A69, 
-0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x20E3, 0x0861, 0x2903, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x18A2, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 
-0x41C7, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 
-0x18A2, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x4A08, 0x18A2, 0xA34B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x49A6, 0x3986, 0x5A69, 0x5A69, 0x5A69, 0x732B, 0x93ED, 
-0x93ED, 0x93ED, 0x93ED, 0x732B, 0x5A69, 0x5A69, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3103, 0x2945, 0x5A69, 0x5A69, 0x5A69, 0x5A69, 0x93ED, 0xC591, 0xC591, 0xC591, 0xC591, 0x9C4E, 0x6AEB, 0x5A69, 
-0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x2945, 0x5A69, 0x5A69, 
-0x5A69, 0x5A69, 0x93ED, 0xC591, 0xC591, 0xC591, 0xC591, 0xC591, 0xACAF, 0x5A69, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x62C8, 0xC591, 0xC591, 0x5A69, 0xACAF, 0xC591, 0xBD30, 0xA42C, 0xA42C, 
-0xBD30, 0xC591, 0xC591, 0xC591, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x3103, 0x62C8, 0xC591, 0xC591, 0x5A69, 0xACAF, 0xC591, 0xBD30, 0xA42C, 0xA42C, 0xA46D, 0xBD0F, 0xC591, 0xC591, 0x0020, 0x930A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x62C8, 0xC591, 0xC591, 0x7B4A, 0xB4EF, 
-0xC591, 0xB4CF, 0x7AC9, 0xCDF2, 0xCDF2, 0xC570, 0xB4CE, 0xB4CE, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x62C8, 0xC591, 0xC591, 0xAC8D, 0xC550, 0xC591, 0xB4CF, 0x7289, 0xD613, 0xD613, 0xBD30, 
-0x93EB, 0x7B29, 0x3103, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x62C8, 
-0xC591, 0xC591, 0xC591, 0xC591, 0xC591, 0xC591, 0xC591, 0x5987, 0x5987, 0x7AC9, 0x7B29, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x62C8, 0xBD30, 0xA44C, 0xC591, 0xC591, 0xC591, 0xC591, 
-0xC591, 0xBD10, 0xBD10, 0xAC8E, 0x7B29, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBCC, 0x4985, 0x7B4A, 0xA46E, 0xBD30, 0xA42C, 0xC591, 0xC591, 0xC591, 0xC591, 0xC591, 0xC591, 0xC591, 0x838B, 0x5A26, 0x7A88, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x942D, 0xBD50, 0xB4CE, 0xA42C, 
-0xC591, 0xC591, 0xACAF, 0x93AC, 0x93AC, 0x93AC, 0xBD30, 0x62C8, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x942D, 0xB4CE, 0xA42C, 0xA42C, 0xC550, 0xC591, 0x830B, 0x38A4, 0x38A4, 0x38A4, 
-0x8BAC, 0x62A8, 0x4144, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 
-0x942D, 0xB4CE, 0xA42C, 0xA42C, 0xA42C, 0xBD30, 0x830B, 0x38A4, 0x38A4, 0x38A4, 0x1041, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x3124, 0x8434, 0xB511, 0xB4CE, 0xA42C, 0xA42C, 0x18A1, 0xA46D, 
-0xBD30, 0x93AC, 0x38A4, 0x0820, 0x0820, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 
-0x4985, 0x41A6, 0x39E9, 0x9CB7, 0xBD52, 0xBD30, 0xB4CE, 0xA42C, 0x62A7, 0x49E6, 0x4A26, 0x41C5, 0x1842, 0x2967, 0x2967, 0x3986, 
-0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x930A, 0x930A, 0x18C3, 0x10A3, 0x2947, 0x528D, 0xA518, 0xB554, 0xC572, 
-0xC550, 0xAC8D, 0xA42C, 0x5226, 0x3165, 0x2105, 0x10A3, 0x422C, 0x422C, 0x2967, 0x3145, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7A88, 0x0020, 0x0020, 0x39EA, 0x422C, 0x422C, 0x52AE, 0xC63B, 0xA518, 0xB514, 0xC591, 0xC591, 0xA42C, 0xBD30, 0xB514, 0x8414, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x0020, 0x18E4, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x8414, 0x9CB7, 0xA4F5, 0xC591, 0xC591, 0xA4F5, 0x9CB7, 0x8414, 0x422C, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBCC, 0x3123, 0x2967, 0x31A9, 0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x9CF6, 0xAD58, 0x9CD6, 0xA4F5, 
-0xC591, 0xA4F5, 0xAD58, 0x9CF6, 0x422C, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x59E6, 0x2126, 0x420B, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x73B2, 0x9CD6, 0xAD58, 0x9CB7, 0xB514, 0xA4D6, 0xAD79, 0xA537, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x31A9, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0861, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x3A0B, 0x3A0B, 0x422B, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x8433, 0xBDFA, 0xA518, 0x9CB7, 0xA518, 0xB5B9, 0xAD78, 0x6330, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0861, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x420B, 0x2967, 0x2967, 0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 0x8433, 0xC63B, 0xC63B, 0x9CB7, 0xBDDA, 
-0xC63B, 0xC63B, 0xC63B, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0861, 0x422C, 0x422C, 0x422C, 0x422C, 0x420B, 0x2967, 0x2967, 
-0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 0x8433, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x422C, 0x422C, 0x422C, 
-0x31A9, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7A88, 0x0861, 0x422C, 0x422C, 0x422C, 0x422C, 0x422B, 0x39EA, 0x2967, 0x3188, 0x39EA, 0x422C, 0x422C, 0x422C, 0x8433, 
-0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0861, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x2105, 0x2126, 0x31A9, 0x422C, 0x422C, 0x422C, 0x8433, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 
-0xC63B, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0861, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x0861, 0x18E4, 0x31A9, 
-0x422C, 0x422C, 0x422C, 0x8433, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 
-0x0861, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x0861, 0x18E4, 0x31A9, 0x422C, 0x422C, 0x422C, 0x8433, 0xC63B, 0xC63B, 
-0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0861, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x0861, 0x18E4, 0x2967, 0x3188, 0x422C, 0x422C, 0x4A6D, 0x73B2, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x422C, 
-0x422C, 0x422C, 0x31A9, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x7268, 0x18E4, 0x420B, 0x422C, 0x422C, 0x422C, 0x422C, 0x0861, 0x18E4, 0x2967, 0x2967, 0x31A9, 
-0x420B, 0x422C, 0x6330, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 
-0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 0x0861, 0x18E4, 0x2967, 0x2967, 0x2967, 0x31C9, 0x420B, 0x6330, 0xC63B, 0xC63B, 0xC63B, 
-0xC63B, 0xC63B, 0xC63B, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 0x0861, 
-0x18E4, 0x2967, 0x2967, 0x2967, 0x2967, 0x31C9, 0x6330, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x422C, 0x422C, 0x422C, 
-0x31A9, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 0x0861, 0x18E4, 0x31A9, 0x420B, 0x2967, 0x2967, 0x31C9, 
-0x6330, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x39EA, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x0861, 0x18E4, 0x31A9, 0x422B, 0x3A0B, 0x3A0B, 0x420B, 0x6330, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xBDFA, 
-0xA518, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x6207, 0x2946, 0x39CA, 0x422C, 0x422C, 0x422C, 0x0861, 0x18E4, 0x2988, 
-0x39CA, 0x422C, 0x422C, 0x422C, 0x6330, 0xC63B, 0xC63B, 0xC63B, 0xBDDA, 0xAD58, 0x9CB7, 0x422C, 0x422C, 0x422C, 0x31A9, 0x0020, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x18A2, 0x2967, 0x422C, 0x422C, 0x422C, 0x18C4, 0x1905, 0x2126, 0x2968, 0x422C, 0x422C, 0x422C, 0x6330, 0xC63B, 
-0xC63B, 0xC63B, 0xAD79, 0x9CB7, 0x9CB7, 0x422C, 0x422C, 0x422C, 0x39CA, 0x10A3, 0x930A, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x2967, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x18E4, 0x1083, 0x2968, 0x422C, 0x422C, 0x422C, 0x6330, 0xC63B, 0xC63B, 0xC63B, 0xAD79, 0x9CB7, 0x9CB7, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x2967, 0x422C, 0x422C, 0x422C, 0x422C, 0x18E4, 0x1083, 0x2968, 0x422C, 
-0x422C, 0x422C, 0x6330, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x0020, 0x930A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A2, 0x2967, 0x422C, 0x422C, 0x422C, 0x422C, 0x18E4, 0x1083, 0x2968, 0x422C, 0x422C, 0x422C, 0x5AEF, 0xA518, 0xA518, 0xBDFA, 
-0xC63B, 0xC63B, 0xC63B, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x7A88, 0x2104, 0x2126, 0x31A9, 0x422C, 0x422C, 0x422C, 
-0x18E4, 0x1083, 0x2968, 0x422C, 0x422C, 0x422C, 0x5ACE, 0x9CB7, 0xAD58, 0xBDFA, 0xC63B, 0xC63B, 0xC63B, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x39EA, 0x18E4, 0x18E4, 0x422C, 0x422C, 0x422C, 0x18E4, 0x1083, 0x2968, 0x422C, 0x422C, 0x422C, 
-0x5AEF, 0x9CF7, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x0020, 0x930A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x39EA, 0x18E4, 
-0x18E4, 0x422C, 0x422C, 0x422C, 0x18E4, 0x1083, 0x2968, 0x422C, 0x422C, 0x422C, 0x6330, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 
-0xC63B, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x39EA, 0x18E4, 0x18E4, 0x422C, 0x422C, 0x2988, 0x10A3, 0x18C4, 
-0x420B, 0x422C, 0x422C, 0x422C, 0x6330, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0x9D16, 0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x0020, 0x39EA, 0x18E4, 0x10A3, 0x31A9, 0x31A9, 0x2967, 0x1083, 0x18E4, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x632F, 
-0x632F, 0x632F, 0x632F, 0x5AED, 0x2967, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x39EA, 0x2967, 0x18E5, 0x1905, 
-0x2967, 0x2967, 0x41E7, 0x41E7, 0x3188, 0x422C, 0x422C, 0x422C, 0x3A0B, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x422C, 
-0x422C, 0x39CA, 0x2967, 0x2967, 0x4985, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x39EA, 0x422C, 0x2967, 0x0841, 0x39E8, 0x39E8, 0x942E, 0x7B8B, 0x0861, 0x422C, 
-0x422C, 0x422C, 0x3A0B, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x420B, 0x420B, 0x2126, 0x1041, 0x18A2, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 
-0x39EA, 0x422C, 0x2967, 0x18C2, 0xC591, 0xC591, 0xC591, 0x7B8B, 0x0861, 0x422C, 0x422C, 0x422C, 0x3A0B, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x10C3, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x2967, 0x3188, 0x1905, 0x18C2, 0xC591, 0xC591, 
-0xC591, 0x7B8B, 0x0841, 0x20E5, 0x20E5, 0x2947, 0x2988, 0x2967, 0x2967, 0x2967, 0x2106, 0x18C4, 0x18C4, 0x2967, 0x2967, 0x2126, 
-0x2105, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x2126, 0x18E5, 0x3185, 0x732A, 0xC591, 0xC591, 0xC591, 0x7B8B, 0x0020, 0x1083, 0x1083, 0x18C4, 
-0x2106, 0x2967, 0x2967, 0x2106, 0x18C4, 0x1083, 0x1083, 0x2967, 0x2967, 0x2967, 0x1905, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x2126, 0x1083, 
-0x4A26, 0xC591, 0xC591, 0xC591, 0xC591, 0x7B8B, 0x0020, 0x18C4, 0x1083, 0x1083, 0x10A4, 0x2126, 0x2126, 0x18A4, 0x1083, 0x1083, 
-0x18C4, 0x2967, 0x2967, 0x2967, 0x1905, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0020, 0x2126, 0x1083, 0x4A26, 0xC591, 0xC591, 0xC591, 0xC591, 0x7B8B, 
-0x0841, 0x2967, 0x18C4, 0x1083, 0x1083, 0x1083, 0x1083, 0x1083, 0x1083, 0x18C4, 0x2967, 0x2967, 0x2967, 0x2967, 0x1905, 0x0020, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x18A2, 0x7B8B, 0xC591, 0xC591, 0xC591, 0xC591, 0xC591, 0x7B8B, 0x0841, 0x2967, 0x18C4, 0x0842, 0x0821, 0x1083, 
-0x1083, 0x1083, 0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x1905, 0x0020, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x7B8B, 0xBD30, 0xAC8D, 
-0xC591, 0xC591, 0x7329, 0x2124, 0x2126, 0x2967, 0x18C4, 0x0842, 0x0020, 0x0841, 0x1083, 0x1083, 0x18E5, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2147, 0x1905, 0x3123, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x7B8B, 0x9C2D, 0x6287, 0xC591, 0xC591, 0x4A26, 0x1083, 0x2967, 0x2967, 
-0x18C4, 0x0842, 0x1882, 0x6207, 0x0842, 0x1083, 0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0020, 0x930A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x3103, 0x7B6A, 0x732A, 0x20E3, 0xACCF, 0xACCF, 0x41E6, 0x10A3, 0x2967, 0x2967, 0x18C4, 0x0842, 0x3123, 0xC40D, 0x0020, 0x1062, 
-0x18E5, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x1083, 0x2126, 0x0020, 0x0020, 
-0x18E4, 0x2967, 0x2967, 0x2967, 0x18C4, 0x0842, 0x3123, 0xC40D, 0x0020, 0x1062, 0x1083, 0x18C4, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x1083, 0x2967, 0x2126, 0x2126, 0x2147, 0x2967, 0x2147, 0x10A4, 0x0841, 0x59E6, 
-0xAB8C, 0xC40D, 0xAB8C, 0x28E3, 0x0862, 0x18C4, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0020, 0x930A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 
-0x1083, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x1083, 0x0841, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x0842, 0x18C4, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0020, 0x930A, 0xC40D, 0xC40D, 0x8AC9, 0x7A88, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x3965, 0x18E4, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2147, 0x1083, 0x0841, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x0842, 0x10A4, 0x2106, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x1083, 0x59E6, 0xC40D, 0xAB8C, 0x3944, 0x0841, 0x28E3, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 0xAB8C, 
-0xAB8C, 0xAB8C, 0x20C2, 0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x1083, 0x0841, 0x6207, 0xBBCC, 0xAB8C, 
-0xAB8C, 0x3124, 0x0842, 0x1083, 0x1083, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0862, 0xC40D, 0x0020, 0x3944, 0x49A5, 
-0x3944, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x2126, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x1083, 0x0841, 0x6207, 0x930A, 0x0020, 0x0020, 0x1062, 0x0842, 0x0821, 0x1083, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0862, 0x18A2, 0x4165, 0x4985, 0x49A5, 0x49A5, 0x4165, 0x2946, 0x2126, 0x2126, 0x2126, 
-0x2126, 0x2126, 0x2126, 0x2126, 0x2126, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x1083, 
-0x0841, 0x1061, 0x20A2, 0x1083, 0x1083, 0x1083, 0x0842, 0x0821, 0x1083, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0862, 
-0x0020, 0x49A5, 0x49A5, 0x49A5, 0x4986, 0x3986, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x18E5, 0x1083, 0x0841, 0x0821, 0x0862, 0x1083, 0x1083, 0x1083, 
-0x1062, 0x0862, 0x1083, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0862, 0x0020, 0x49A5, 0x49A5, 0x49A5, 0x4186, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x2146, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2106, 0x1083, 0x1062, 0x0841, 0x0862, 0x1083, 0x1083, 0x1083, 0x1083, 0x1083, 0x1083, 0x18C4, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x1905, 0x2904, 0x0020, 0x49A5, 0x49A5, 0x49A5, 0x4186, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E5, 0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 0x2106, 0x1083, 0x0020, 0x1062, 0x1083, 
-0x1083, 0x1083, 0x1083, 0x1083, 0x1083, 0x18C4, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0020, 0x930A, 
-};
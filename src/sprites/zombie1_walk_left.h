@@ -1,2592 +0,0 @@
-// Total bitmap data size: 81000 bytes
-
-// zombie1_walk_left_10.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_left_10_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x834C, 0x0861, 0x20E3, 0x1061, 0x5A69, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0B, 0x18A3, 0x39A6, 
-0x41C7, 0x41C7, 0x3165, 0x5A48, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7B0B, 0x5A87, 0xACAE, 0x7B6C, 0x4A08, 0x62AA, 0x5249, 0x2924, 0x6268, 0xC42E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x832B, 0x2902, 0xBD0F, 0xEE94, 0xBD30, 0x6B0B, 0x41C8, 0x628A, 0x5A69, 
-0x18A2, 0x6289, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0x834C, 0x2902, 0xDE52, 0xC52F, 
-0xBD10, 0xDE33, 0xBD30, 0x6B0B, 0x49E8, 0x5A8A, 0x62AA, 0x1041, 0x730B, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 
-0xC40D, 0x8B6C, 0x20A0, 0xBD0F, 0xCDB3, 0xCDB1, 0xC550, 0xC550, 0xD5F2, 0xBD50, 0x6AEB, 0x5249, 0x5A69, 0x6AEB, 0x0000, 0xA40E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x28E1, 0xCD70, 0xCD91, 0x61E7, 0xCD92, 0xAC6E, 0xA42C, 0xCDD2, 0xD5F2, 
-0xC550, 0x5229, 0x5A69, 0x628A, 0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x832C, 0x20C1, 0xDE13, 0xCD91, 0xCD91, 
-0xD5F2, 0x7289, 0x48E5, 0x9BCD, 0xD612, 0xCD91, 0xA48F, 0x5249, 0x5A69, 0x628A, 0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8B8D, 0x0000, 0x3064, 0x6208, 0xD5D2, 0xCD91, 0xCD91, 0xC551, 0xC550, 0xC571, 0xD5D2, 0xA48F, 0x5229, 0x5A69, 0x5A69, 0x628A, 
-0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x832C, 0x6B09, 0x8B4B, 0x2002, 0x59A7, 0xD5D2, 0xCD91, 0xC571, 0xCD91, 0xD5F2, 0xB4EF, 
-0x9C0B, 0xACAE, 0xA48F, 0x5249, 0x5A69, 0x6ACB, 0x0000, 0xAC0E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3965, 0x5A24, 0xA3CC, 0x0801, 0x5166, 
-0xD5D2, 0xCD91, 0xC591, 0xCDB1, 0xACAE, 0xACAE, 0xBD0F, 0xCDB1, 0xC591, 0x628A, 0x62AA, 0x0000, 0x9BCD, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44F, 0x4A06, 0x4143, 0x936B, 0x8B6B, 0xD5F2, 0xCDB2, 0xCDB2, 0xCDD2, 0xBD0F, 0xBD0F, 0xE653, 0xD5F3, 0x6ACA, 0x0000, 
-0x0820, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44F, 0x49E6, 0x6285, 0xCD6F, 0xB4CE, 0xB4CE, 0xB4EE, 0xACAD, 
-0xBD50, 0xEE94, 0xA48E, 0x18C1, 0x18A3, 0x9BCD, 0x9BCD, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC44F, 
-0x49E7, 0x7308, 0x9C0B, 0x9C0B, 0x93EB, 0xA44C, 0xCD91, 0xACAE, 0x6AEA, 0x6A89, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xB42F, 0x0000, 0xB4AD, 0xA42C, 0xA46D, 0xCD91, 0xF6B4, 0x2922, 0x832C, 0xC40D, 
-0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x2923, 0x93CB, 0xAC6D, 
-0xCDB1, 0xBD51, 0xCDB2, 0x3143, 0x834C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x1061, 0xC550, 0xCDD2, 0x62ED, 0x424D, 0x0842, 0x8B6C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44E, 0x0020, 0x528C, 0x52AD, 0x424C, 0x422C, 0x422C, 
-0x18A4, 0x834B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC44F, 0x2904, 
-0x39CA, 0x420C, 0x420C, 0x422C, 0x422C, 0x4A6D, 0x39EB, 0x18C4, 0x834B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40E, 0xC40D, 0xBC4F, 0x5A47, 0x5228, 0x2107, 0x4A8D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A8D, 0x39CA, 0x18C4, 0x8B4B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x3145, 0x0022, 0x2127, 0x52AE, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x4A6D, 0x39EB, 0x1083, 0x8B6C, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x2904, 0x18E6, 0x5AEF, 
-0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x422C, 0x0021, 0x93AD, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40E, 0x2903, 0x18E5, 0x52AE, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x4A4C, 0x4A6D, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x41C6, 0x2947, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x20E3, 0x3189, 0x4A6D, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x0020, 
-0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44E, 0x20E3, 0x31A9, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A4C, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x2988, 0x0861, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44E, 0x2904, 0x3189, 0x424C, 0x424C, 0x422C, 0x424C, 0x4A6D, 0x422B, 0x2967, 
-0x2988, 0x2988, 0x422B, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x31A9, 0x0000, 0xB42F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC44E, 0x3145, 0x2127, 0x4A6D, 0x424C, 
-0x422C, 0x4A4D, 0x422C, 0x2125, 0x10A3, 0x2167, 0x2126, 0x2126, 0x420B, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x424C, 0x2988, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44F, 0x3986, 0x18C5, 0x528E, 0x422C, 0x422C, 0x4A4D, 0x422C, 0x18E5, 0x0041, 0x18C4, 0x2968, 0x39EA, 0x39CA, 0x422C, 0x424C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x4A4D, 0x2988, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0xA3EE, 0x5248, 0x1084, 0x52CE, 0x422C, 0x422C, 0x4A4C, 0x422C, 0x18E5, 0x0841, 0x18E4, 
-0x29A9, 0x39EA, 0x4A6D, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39CA, 0x39EA, 0x0000, 0xBC4F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xB44F, 0xB44F, 0xBC4F, 0x3986, 0x0000, 0x2127, 0x5ACF, 0x422C, 0x422C, 
-0x4A4C, 0x422B, 0x1905, 0x0841, 0x18E5, 0x2988, 0x39EA, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x4A4C, 0x422C, 0x2147, 0x424C, 0x10A4, 0x836C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xBC4F, 0xB42F, 0x0000, 0x0000, 0x0000, 
-0x31A9, 0x52CF, 0x4A4D, 0x422C, 0x4A4C, 0x4A4C, 0x3A0B, 0x1905, 0x0020, 0x1905, 0x2988, 0x39EA, 0x4A6D, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x39EA, 0x2967, 0x420B, 0x5ACF, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 
-0xA40E, 0x0000, 0x18A2, 0x4A4C, 0x424C, 0x4A4C, 0x424C, 0x424C, 0x422C, 0x422C, 0x422B, 0x39CA, 0x2126, 0x0020, 0x2126, 0x2967, 
-0x39EA, 0x4A4C, 0x422C, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x39EA, 0x2147, 0x2147, 0x422B, 
-0x4A8E, 0x0001, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x834C, 0x0020, 0x5A67, 0xDE33, 0xA4AF, 0x2147, 0x2147, 0x422B, 0x4A4C, 0x4A4C, 0x31C9, 0x2967, 
-0x2125, 0x1061, 0x0021, 0x2126, 0x2147, 0x39EA, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x424C, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 
-0x4A4C, 0x39EA, 0x2147, 0x2147, 0x2167, 0x422B, 0x4A8E, 0x0001, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72CA, 0x5A87, 0xB4CE, 0xB50F, 0xDE33, 0xB510, 0x2147, 
-0x2967, 0x2988, 0x39EA, 0x1083, 0x0000, 0x0000, 0x5A48, 0xC44F, 0x1061, 0x39CA, 0x422C, 0x422C, 0x424C, 0x422C, 0x4A4C, 0x420B, 
-0x2967, 0x2988, 0x422C, 0x4A4C, 0x424C, 0x422C, 0x4A4C, 0x3A0B, 0x2126, 0x2967, 0x420B, 0x422C, 0x4A8D, 0x0001, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x62C8, 
-0xBD2F, 0xDE33, 0xCD91, 0xC54F, 0x9C0C, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B6C, 0xC44F, 0xBC6F, 0xB46F, 0x5A69, 0x31A9, 0x422C, 
-0x4A4C, 0x424C, 0x422C, 0x422C, 0x4A4C, 0x3A0A, 0x2126, 0x2146, 0x2988, 0x2988, 0x420B, 0x528D, 0x39EA, 0x2967, 0x2147, 0x2167, 
-0x422C, 0x424C, 0x4A8D, 0x0001, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x93EB, 0xE653, 0xD5F2, 0x8349, 0x0820, 0x3164, 0xB44F, 0xB44F, 0xB44F, 0xA40E, 0xC44F, 
-0xC40D, 0xC40D, 0xBC4F, 0x0000, 0x4A6D, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x422B, 0x39EA, 0x39EA, 0x2146, 0x1906, 
-0x2968, 0x3188, 0x31A9, 0x31A9, 0x2967, 0x39EA, 0x422C, 0x4A6D, 0x5AF0, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1082, 0x93EC, 0xF6D5, 0x72E8, 0x6A89, 0xA3CE, 
-0xAC0F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xBC6F, 0x0000, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x424C, 0x4A4D, 0x4A4C, 0x39CA, 0x31C9, 0x31C9, 0x3188, 0x420B, 0x3A0B, 0x2988, 0x52AE, 0x528D, 0x1084, 0x0021, 0x5A69, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x9BCD, 0x5227, 0xC550, 0x8BEB, 0x7B2B, 0xC44E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44F, 0x0000, 
-0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4D, 0x4A4D, 0x3A0B, 
-0x2147, 0x10A4, 0x10A4, 0x72EA, 0x6A89, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x5226, 0xB4EF, 0x3163, 0x3145, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xA40E, 0x0863, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x4A4D, 0x39CA, 0x2945, 0x5A48, 0x5A47, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x1061, 
-0x20E3, 0x836C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x0000, 0x52AE, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x18E6, 0x49E6, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 
-0x0000, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x4A6D, 0x2106, 0x49E6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xB44F, 0x0000, 0x4A6D, 0x4A4C, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x2106, 0x49E6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x20E3, 0x2126, 0x3188, 0x2988, 0x2988, 
-0x422B, 0x4A6D, 0x4A4C, 0x4A4C, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x2106, 0x49E6, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 
-0xA3EE, 0x0000, 0x31A9, 0x2147, 0x2147, 0x2147, 0x31A9, 0x31C9, 0x31A9, 0x2988, 0x39EA, 0x4A6D, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 
-0x4A4C, 0x4A4C, 0x528E, 0x2126, 0x49E6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x4A08, 0x10A4, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E5, 0x18C4, 0x2126, 0x2167, 
-0x2988, 0x39EA, 0x39EA, 0x39EA, 0x39EA, 0x39EA, 0x31C9, 0x31C9, 0x39EA, 0x10A4, 0x49E6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6AA9, 0x0000, 0x31C9, 0x2147, 0x2967, 
-0x2967, 0x2967, 0x10A4, 0x0842, 0x18C4, 0x2126, 0x2106, 0x18E5, 0x18E5, 0x18E5, 0x18E5, 0x18E5, 0x2126, 0x2147, 0x2167, 0x0862, 
-0x49E7, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x836C, 0x0000, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x18A4, 0x1083, 0x18A3, 0x0021, 0x0000, 0x1062, 0x1063, 0x1063, 
-0x1063, 0x0842, 0x2105, 0x2968, 0x2988, 0x0883, 0x49E7, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x0000, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x18A4, 0x1083, 
-0x0842, 0x2924, 0x3164, 0x0000, 0x10A4, 0x1083, 0x1083, 0x1083, 0x2126, 0x2967, 0x2988, 0x0883, 0x49E7, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x7B2B, 0x0021, 0x2988, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x18A4, 0x1083, 0x0000, 0xAC2E, 0xC44F, 0x0841, 0x1083, 0x1083, 0x1083, 0x2126, 0x2967, 0x2967, 
-0x2988, 0x0863, 0x49E7, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x72EA, 0x0862, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18C4, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xBC4F, 
-0x0020, 0x1083, 0x1083, 0x2126, 0x2967, 0x2967, 0x2988, 0x0883, 0x49E7, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A68, 0x0041, 0x29A8, 0x2967, 0x2967, 0x2967, 0x2147, 0x18C4, 
-0x18C4, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x1083, 0x1083, 0x2146, 0x2968, 0x2967, 0x2967, 0x2147, 0x1905, 0x6268, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A89, 0x0842, 
-0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x1083, 0x0000, 0x93AD, 0xC44E, 0xC40D, 0xC40D, 0xC42E, 0xAC2F, 0x1082, 0x0862, 0x18A4, 
-0x2126, 0x2967, 0x2967, 0x2988, 0x10C4, 0x20C2, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72CA, 0x0021, 0x2988, 0x2967, 0x2967, 0x2147, 0x18E5, 0x18C4, 0x0000, 0xBC4F, 0xC40D, 0xC42E, 
-0xC40D, 0xC40D, 0xC44E, 0x0020, 0x0842, 0x1083, 0x2105, 0x2967, 0x2967, 0x2968, 0x18C4, 0x2924, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xB44F, 0x41C7, 0x10C4, 0x2968, 0x2967, 0x2967, 0x2147, 
-0x1063, 0x0841, 0x72EA, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x93AD, 0x18C3, 0x0842, 0x2126, 0x2988, 0x2967, 0x2968, 
-0x18C4, 0x2924, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x20E3, 
-0x0863, 0x31A9, 0x2147, 0x2967, 0x2147, 0x2105, 0x1063, 0x0020, 0xC44F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 
-0x2903, 0x0021, 0x2105, 0x2147, 0x2967, 0x2968, 0x10C4, 0x2924, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x41A6, 0x1083, 0x2988, 0x2967, 0x2968, 0x2126, 0x0842, 0x1062, 0x41C6, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x72EA, 0x1083, 0x0021, 0x10A5, 0x2967, 0x2967, 0x18E5, 0x2104, 0xBC4F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x3985, 0x0883, 0x2988, 0x2967, 0x2967, 
-0x2126, 0x0842, 0x18C2, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5227, 0x0841, 0x39A7, 
-0x31A8, 0x2147, 0x2967, 0x2126, 0x0841, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0x41C6, 0x0883, 0x2988, 0x2968, 0x2106, 0x1083, 0x0842, 0x18C2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40E, 0x49C7, 0x6AE8, 0xEE74, 0x83AD, 0x10C6, 0x2967, 0x2126, 0x1061, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x5A69, 0x0000, 0x2126, 0x2126, 0x1063, 0x0842, 0x18C2, 0xC44F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x5A48, 0x5A25, 0xC52F, 0x6AE9, 0x1927, 0x2106, 
-0x1081, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6AA9, 0x0021, 
-0x2968, 0x2106, 0x1063, 0x0842, 0x18C2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0x72CA, 0x6265, 0x9C2D, 0x1906, 0x2147, 0x1905, 0x41C6, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6289, 0x0842, 0x31A9, 0x1905, 0x1062, 0x0842, 0x18C2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0x93AD, 0x0000, 0x4A08, 0x2168, 0x2967, 0x2968, 0x0000, 0xBC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A89, 0x0842, 0x2988, 0x2147, 0x18C5, 0x0842, 
-0x18C2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x834C, 0x0000, 0x1084, 
-0x2126, 0x2967, 0x2147, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x4A07, 0x0021, 0x31A9, 0x2967, 0x2147, 0x0842, 0x18C2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x39A6, 0x0001, 0x10A4, 0x2967, 0x2967, 0x0000, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCE, 0x2104, 0x1906, 0x2968, 0x2126, 0x0842, 0x18C2, 0xC44F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xB44F, 0x0000, 0x18C4, 0x2968, 0x2947, 0x0841, 
-0xA40E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8C, 0x0000, 0x29A8, 
-0x2126, 0x0842, 0x18C2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAC2F, 0x0000, 0x18C4, 0x2147, 0x2967, 0x31A8, 0x0000, 0xAC2E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x836C, 0x0000, 0x2988, 0x2126, 0x0842, 0x18C2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2F, 0x0000, 0x1083, 0x10A4, 0x2947, 0x2988, 0x0000, 0xB44F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x836C, 0x0000, 0x2988, 0x2126, 0x0842, 0x18C2, 0xC44F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2F, 0x0000, 0x10A4, 
-0x2147, 0x2988, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x836C, 
-0x0000, 0x29A8, 0x2126, 0x0821, 0x18C2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x10A4, 0x2147, 0x2988, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x938C, 0x0000, 0x2988, 0x2947, 0x10A4, 0x18C2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC46F, 0x0000, 0x1083, 0x2167, 0x2988, 0x0000, 0xB44F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x3186, 0x10A4, 0x2168, 0x2968, 0x1906, 
-0x18A2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44E, 0x5A69, 
-0x0883, 0x2126, 0x2968, 0x2988, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 
-0x20C2, 0x1862, 0x41E8, 0x3167, 0x2168, 0x18E5, 0x18C2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x5207, 0x0000, 0x3187, 0x2946, 0x2926, 0x2926, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xB44F, 0xBC6F, 0xBC4F, 0x18A2, 0x30C2, 0x61E6, 0x51A5, 0x4986, 0x3187, 0x2105, 0x18C2, 0xC44F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0xBC6F, 0xC44F, 0x5A48, 0x0000, 0x3925, 0x28C3, 0x28C3, 0x28C3, 0x30C3, 
-0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xA3EE, 0x0000, 0x0000, 0x0000, 0x4165, 0x51C6, 0x49A5, 0x49A5, 0x51A5, 
-0x51C6, 0x4124, 0x18A2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x18C2, 0x0000, 0x0000, 0x1041, 
-0x3904, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x30E4, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x0000, 0x59E6, 0x51A6, 
-0x51A6, 0x49A6, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x51A6, 0x3924, 0x18A2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44F, 0x18A2, 0x2082, 0x30E4, 0x28E3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x30E4, 0x0000, 0xB44F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_left_1.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_left_1_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x18C2, 0x20C3, 0x20E3, 0x20E3, 
-0x0820, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 
-0xC44F, 0x18A2, 0x3166, 0x3166, 0x39A6, 0x41C7, 0x41C7, 0x18A2, 0xA3EE, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xBC4F, 0x3985, 0x8BCB, 0xACD0, 0xACCF, 0x5A8A, 0x5249, 0x6ACB, 0x41A6, 0x2904, 0xA3EE, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xBC4F, 0x3124, 0x6AA6, 0xEE95, 0xD5D2, 0xD5D2, 
-0xA48F, 0x5A69, 0x4A08, 0x730C, 0x1082, 0x49E7, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 
-0x3144, 0x7B48, 0xF6D4, 0xAC8D, 0xCDB2, 0xC591, 0xDE12, 0xA48F, 0x62CA, 0x5A69, 0x39A6, 0x4A07, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x3144, 0x6265, 0xDE13, 0xCDD2, 0xC590, 0xC550, 0xC571, 0xC571, 0xE633, 0x8BCD, 0x49E8, 
-0x6AEB, 0x3124, 0x18C2, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x3985, 0x72E7, 0xE653, 0x938C, 0x82EB, 0xDE54, 
-0x8B4A, 0xC571, 0xCD91, 0xDE12, 0x83AC, 0x4A08, 0x62AA, 0x3145, 0x41A6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x18C3, 
-0x8BAB, 0xDDF3, 0xCD91, 0xD5F2, 0xAC6E, 0x4905, 0x6A28, 0xC571, 0xCDB1, 0xCD91, 0x7B4C, 0x4A08, 0x62AA, 0x3145, 0x41A6, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x2103, 0x2863, 0x3063, 0x9BED, 0xD612, 0xCD91, 0xC571, 0xC550, 0xC571, 0xCD91, 0xD5B2, 0x7B4B, 
-0x5229, 0x5A69, 0x62AA, 0x3145, 0x39A5, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1061, 0x2022, 0x3064, 0x30A4, 0x93AC, 0xD612, 
-0xCD91, 0xCDB1, 0xCDB1, 0xC591, 0xA46D, 0xACAE, 0xC571, 0x83AC, 0x5A6A, 0x3124, 0x2924, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 
-0x0000, 0xA46E, 0x59A7, 0x0800, 0x7AEA, 0xDE33, 0xC591, 0xCD91, 0xCDB2, 0xC591, 0xBD0F, 0xC571, 0xEEB4, 0xB4F0, 0x1082, 0x3144, 
-0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xAC2F, 0x41C5, 0x7AE8, 0x7AC9, 0xA44D, 0xD613, 0xCDD2, 0xC571, 0xACAE, 0xC571, 
-0xCD91, 0xF6B5, 0x7349, 0x0020, 0x39A6, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x3163, 0x93C9, 
-0xC54F, 0xB4CE, 0xB4EF, 0xAC8D, 0x9BEB, 0xC571, 0xE674, 0x6AC7, 0x6ACA, 0x8B6C, 0xC46F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x3164, 0x8348, 0xAC8D, 0x93EB, 0x9C0B, 0xB4CE, 0xC591, 0x8BEC, 0x5227, 0xC42E, 0xC40D, 
-0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3CE, 0x41A5, 0x93AA, 0xA44C, 0xB4CE, 
-0xDE12, 0xCDB1, 0x0000, 0xBC2F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40E, 0xC40D, 0x938D, 0x18A0, 0xCD90, 0xCDB2, 0xB510, 0xB510, 0x0820, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x834C, 0x3163, 0xE653, 0xACD0, 0x420C, 0x422C, 0x0020, 0xBC4F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0x8B8D, 0x0000, 0x2105, 
-0x62EE, 0x526C, 0x422C, 0x422C, 0x422B, 0x1062, 0xBC4F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x72CA, 0x41A5, 0x3187, 0x3188, 0x39EA, 0x420C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x31A9, 0x18A3, 0xBC4F, 0xC40D, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x7B0B, 0x2105, 0x18C4, 0x39EA, 0x528E, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x528D, 0x2148, 0x20E4, 0xBC4F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x0820, 0x39CA, 0x52AE, 0x4A4C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x52AE, 0x2107, 0x2104, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0x9BCE, 0x2125, 0x39EB, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x52AE, 
-0x2107, 0x20E4, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0000, 0x4A6D, 0x4A4C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x424C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x52AE, 0x2106, 0x20C2, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x0020, 0x422B, 0x424C, 
-0x422C, 0x422C, 0x422B, 0x420B, 0x422B, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x2126, 0x41A5, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBC4F, 0x0821, 0x422B, 0x424C, 0x422C, 0x4A4D, 0x31C9, 0x2126, 0x31A8, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x4A6D, 0x2127, 0x41A5, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x1062, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x31C9, 0x2126, 
-0x3188, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x2127, 0x41A5, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xBC4F, 0x0000, 0x4A6D, 
-0x424C, 0x422C, 0x4A4C, 0x31C9, 0x2126, 0x2988, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x420B, 0x1083, 
-0x41A6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBC6F, 0x39A6, 0x31A9, 0x4A4C, 0x422C, 0x422C, 0x4A6D, 0x2988, 0x2988, 0x422C, 0x4A4C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x4A6D, 0x3A0B, 0x0862, 0x49C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xA3ED, 0x0000, 0x5ACF, 0x422C, 0x422C, 0x422C, 0x39EA, 0x2147, 
-0x39CA, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x3A0B, 0x2988, 0x18E5, 0x2125, 0x93AD, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x62AA, 0x2106, 
-0x4A6D, 0x422C, 0x422C, 0x4A6D, 0x2988, 0x1905, 0x31C9, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4D, 0x31A9, 
-0x1926, 0x31C9, 0x2127, 0x0840, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7B0A, 0x0001, 0x5AEF, 0x422C, 0x422C, 0x422C, 0x3A0B, 0x2968, 0x2968, 0x3A0B, 0x4A4C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x39CA, 0x2126, 0x31A9, 0x39CA, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x72EB, 0x10A4, 0x4A6D, 0x422C, 0x424C, 0x422C, 0x2967, 
-0x2126, 0x3A0B, 0x4A6D, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x31A9, 0x2147, 0x39EA, 0x31A9, 0x20E3, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x5227, 0x10A4, 
-0x52AE, 0x422C, 0x422C, 0x422C, 0x422B, 0x2967, 0x2147, 0x39EB, 0x424C, 0x422B, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 0x4A4C, 
-0x31A9, 0x2126, 0x31C9, 0x4A6D, 0x3189, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC42E, 0x5207, 0x2106, 0x4A6D, 0x424C, 0x422C, 0x4A4C, 0x422B, 0x2967, 0x2147, 0x3A0B, 0x4A6D, 0x31C9, 0x2126, 
-0x31A9, 0x4A4C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x31A9, 0x2126, 0x31A9, 0x4A6D, 0x3189, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x5207, 0x2127, 0x422C, 0x4A4C, 0x424C, 0x4A6D, 0x420B, 0x2967, 
-0x2147, 0x2146, 0x3A0B, 0x4A6D, 0x31A9, 0x2126, 0x2147, 0x31A9, 0x4A4D, 0x4A4C, 0x2988, 0x2968, 0x2147, 0x31A9, 0x424C, 0x4A4D, 
-0x3189, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC42E, 0x5227, 0x2126, 0x422C, 
-0x4A6D, 0x4A6D, 0x3A0B, 0x2988, 0x2988, 0x2968, 0x2988, 0x39EA, 0x422C, 0x4A4C, 0x422C, 0x31A9, 0x1926, 0x2147, 0x2988, 0x2988, 
-0x39EA, 0x2988, 0x39EA, 0x4A8D, 0x528E, 0x52AE, 0x31A9, 0x0840, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 
-0xC44F, 0x5A68, 0x730B, 0x18E5, 0x4A6D, 0x39EA, 0x31A8, 0x39CA, 0x31A9, 0x2988, 0x2126, 0x0041, 0x0861, 0x420B, 0x4A4C, 0x422C, 
-0x4A4C, 0x422B, 0x39CA, 0x39EA, 0x31CA, 0x39CA, 0x4A6D, 0x2126, 0x0021, 0x0021, 0x0001, 0x0000, 0x18C4, 0xB44F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x834C, 0x7B4B, 0x20E2, 0x0000, 0x420B, 0x39EA, 0x2968, 0x2988, 0x18C4, 0x0841, 0x0862, 
-0x10A3, 0x2105, 0x2105, 0x420B, 0x424C, 0x422C, 0x422C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A6D, 0x0021, 0x6AA9, 0xA3EE, 
-0x9BCD, 0x938D, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x5248, 0x1080, 0x7B49, 0xDE13, 0x528A, 0x2147, 
-0x2147, 0x18E4, 0x10A3, 0x10A3, 0x18C4, 0x1083, 0x2126, 0x528E, 0x4A8D, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x4A6D, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x3165, 
-0x838A, 0xF6F5, 0xD5D2, 0xD5F2, 0xCD91, 0x10A3, 0x0883, 0x10A3, 0x0841, 0x31A8, 0x52AF, 0x4A8D, 0x4A6D, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x2924, 0x93EB, 0xDE33, 0xC571, 0xCDB1, 0xCD91, 0x93EC, 0x3965, 0x3965, 0x39EA, 0x4A6D, 0x4A4C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x0000, 
-0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20E3, 0xA46D, 0xACAD, 0xB4CE, 0xCDB2, 0xD5D2, 0x83AB, 
-0x3965, 0xC44E, 0xC42E, 0x49E6, 0x2106, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1082, 
-0x9BEB, 0x3143, 0x7329, 0xF6B5, 0x7329, 0x5228, 0xC42E, 0xC40D, 0xC42E, 0x49E6, 0x2106, 0x4A8D, 0x4A4C, 0x424C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0861, 0x0000, 0x0000, 0x7329, 0xFFB8, 0x62A7, 0x3144, 0xC40D, 0xC40D, 0xC42E, 0x49E7, 
-0x1083, 0x31A9, 0x2968, 0x39CA, 0x4A6D, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 
-0x52AE, 0x0000, 0xAC0E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0xB42F, 0xBC4F, 0x6AEA, 0x1060, 
-0x5A88, 0xC44F, 0xC40D, 0xC40D, 0xC42E, 0x49E7, 0x0862, 0x2967, 0x2147, 0x2988, 0x31C9, 0x31A9, 0x31A9, 0x31A9, 0x31A9, 0x31A9, 
-0x31A9, 0x31A9, 0x31A9, 0x31A9, 0x31A9, 0x31A9, 0x1083, 0x93CE, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x72EB, 0xBC6F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0x5207, 0x0862, 0x2988, 0x2126, 0x18C4, 
-0x18E5, 0x2967, 0x2167, 0x2167, 0x2167, 0x2167, 0x2967, 0x2147, 0x2146, 0x2146, 0x2147, 0x2967, 0x0000, 0xBC4F, 0xC40D, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC42E, 
-0xB44F, 0x3186, 0x18E5, 0x2988, 0x18E5, 0x0821, 0x1083, 0x2106, 0x2106, 0x2105, 0x2106, 0x2106, 0x1905, 0x2126, 0x2968, 0x2967, 
-0x2147, 0x18E4, 0x72EB, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x1061, 0x10C4, 0x31A8, 0x2967, 0x2126, 0x18C4, 0x10A4, 0x1062, 0x1063, 0x1083, 
-0x0842, 0x0862, 0x1062, 0x18A4, 0x2147, 0x2967, 0x2106, 0x1061, 0xC44E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x2903, 0x10C4, 0x2968, 0x2967, 
-0x2967, 0x2988, 0x2147, 0x10A4, 0x1083, 0x1083, 0x0020, 0x0862, 0x10A4, 0x1063, 0x18C4, 0x2988, 0x2126, 0x0841, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44E, 0x2903, 0x10C4, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x1083, 0x0020, 0x1062, 0x1083, 0x1083, 0x1083, 
-0x18C5, 0x2968, 0x2126, 0x2904, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x2903, 0x10C4, 0x2968, 0x2967, 0x2967, 0x2967, 0x2126, 0x1083, 
-0x1083, 0x0020, 0x0862, 0x1083, 0x1063, 0x18E5, 0x2988, 0x18E5, 0x2924, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x2903, 0x10C4, 
-0x2968, 0x2967, 0x2967, 0x2968, 0x2147, 0x1062, 0x0821, 0x1062, 0x1083, 0x1083, 0x1063, 0x18E5, 0x29A8, 0x10C4, 0x2903, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x2903, 0x10C4, 0x2968, 0x2967, 0x2967, 0x2126, 0x18A4, 0x1083, 0x0000, 0x1083, 0x1083, 0x1083, 
-0x1062, 0x18C4, 0x31C9, 0x10C4, 0x1061, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x2903, 0x10C4, 0x2968, 0x2967, 0x2988, 0x2126, 
-0x0842, 0x0841, 0x0862, 0x1083, 0x1083, 0x1083, 0x18C4, 0x2147, 0x18E5, 0x3186, 0xB44F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 
-0x2923, 0x10C4, 0x2968, 0x2967, 0x2146, 0x20E5, 0x0821, 0x0000, 0x10A4, 0x1084, 0x1083, 0x1063, 0x2106, 0x31A9, 0x0862, 0x5207, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xB44F, 0x2104, 0x1905, 0x2968, 0x2988, 0x1905, 0x0021, 0x3145, 0x730B, 0x1083, 0x1083, 
-0x1083, 0x1063, 0x1905, 0x29A8, 0x0862, 0x5207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x0000, 0x2126, 0x2988, 0x2146, 0x2147, 
-0x18E5, 0x0000, 0x6AA9, 0xC40D, 0x18C2, 0x0822, 0x0843, 0x0863, 0x2105, 0x2988, 0x10A4, 0x41C6, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC46F, 0x1061, 0x2126, 0x2988, 0x18C4, 0x1063, 0x1083, 0x0000, 0x6289, 0xC42E, 0x18A2, 0x18C4, 0x2925, 0x1083, 0x18E5, 0x2967, 
-0x2988, 0x10C4, 0x20C3, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x18A2, 0x2126, 0x2988, 0x18C4, 0x1063, 0x1083, 0x0000, 0x6289, 0xC44E, 
-0x18C3, 0xA48E, 0xDE33, 0x4A28, 0x0001, 0x18E5, 0x2988, 0x18C4, 0x2903, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x2904, 0x18E5, 
-0x2947, 0x2147, 0x18E5, 0x0862, 0x1082, 0x5A68, 0xC46F, 0x2924, 0x8BAA, 0xB4CE, 0x41C6, 0x0884, 0x29A8, 0x10C4, 0x2924, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x2924, 0x10C4, 0x2968, 0x2988, 0x18E5, 0x1063, 0x0021, 0x2904, 0xC42E, 0xBC4E, 0x49E7, 0x93CA, 
-0x6AE9, 0x0002, 0x2106, 0x10C4, 0x2923, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x1061, 0x10C4, 0x31A8, 0x2967, 0x2147, 0x18E5, 
-0x0021, 0x3144, 0xC42E, 0xC40D, 0x3144, 0x1881, 0x39A6, 0x0842, 0x18C4, 0x2147, 0x2105, 0x7B2B, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 
-0xAC0E, 0x3166, 0x18E5, 0x2967, 0x2988, 0x2126, 0x0021, 0x3144, 0xC42E, 0xC40D, 0xBC4F, 0x3145, 0x0001, 0x1083, 0x18C4, 0x31A9, 
-0x2126, 0x0000, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5207, 0x0862, 0x2988, 0x2968, 0x2106, 0x0021, 0x3144, 0xC42E, 0xC40D, 
-0xC40D, 0x72EA, 0x0000, 0x18A4, 0x10A4, 0x2146, 0x2126, 0x1061, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x49E7, 0x0863, 0x2988, 
-0x2967, 0x2126, 0x0842, 0x3144, 0xC42E, 0xC40D, 0xC40D, 0xA40E, 0x18C3, 0x0842, 0x1063, 0x10A4, 0x2147, 0x1082, 0xB42F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC42E, 0x41A6, 0x0863, 0x2988, 0x2967, 0x2988, 0x10C4, 0x3144, 0xC42E, 0xC40D, 0xC40E, 0xC40D, 0x9BCD, 0x0000, 
-0x10A4, 0x10A4, 0x2967, 0x2968, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x5207, 0x0883, 0x2968, 0x2967, 0x2968, 0x10C4, 0x3144, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0x9BCD, 0x0000, 0x1083, 0x1083, 0x10A4, 0x2147, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 
-0x62A9, 0x0842, 0x2988, 0x2968, 0x10A4, 0x3144, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BEE, 0x0000, 0x1083, 0x10A3, 0x2147, 
-0x0000, 0xC44F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 0x0021, 0x2988, 0x2967, 0x2147, 0x2105, 0x5248, 0xC44F, 0xC40D, 0xC40D, 
-0xC40D, 0xAC2F, 0x0000, 0x2167, 0x2126, 0x28E4, 0x20A2, 0x20E3, 0xC44F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 0x0021, 0x2988, 0x2967, 
-0x2988, 0x1906, 0x0841, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xAC2E, 0x0000, 0x3126, 0x2905, 0x28C3, 0x30E4, 0x0820, 0x3124, 0xBC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAC2F, 0x4185, 0x20E4, 0x2168, 0x2147, 0x2967, 0x1906, 0x1882, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xAC2F, 0x0000, 0x30C3, 
-0x28C3, 0x28C3, 0x28C3, 0x3925, 0x0000, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB42F, 0x1081, 0x38E2, 0x51E7, 0x3166, 0x3167, 0x2968, 0x1906, 0x0840, 0xC44F, 
-0xC40D, 0xC40D, 0xC40D, 0xB42F, 0x0000, 0x30E4, 0x28C3, 0x28C3, 0x30E4, 0x3925, 0x0000, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xB44F, 0xBC6F, 0xB44F, 0x0841, 0x4124, 0x59E6, 0x51A5, 
-0x59A5, 0x49A6, 0x2946, 0x2125, 0x6ACA, 0xC44E, 0xC40D, 0xC46F, 0xBC4F, 0x8B8C, 0x0000, 0x30E4, 0x30E4, 0x30E4, 0x1041, 0x0820, 
-0x2904, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x93AD, 0x0000, 
-0x0000, 0x0000, 0x4985, 0x51C6, 0x49A5, 0x49A5, 0x49A5, 0x51C6, 0x30E2, 0x3145, 0xC42E, 0xC40D, 0xC44E, 0x5207, 0x0000, 0x0821, 
-0x3904, 0x28C3, 0x20A3, 0x20C3, 0x41C6, 0x3165, 0xBC6F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x0000, 0x59E7, 0x51A6, 0x51A6, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x51C6, 0x30E3, 0x3144, 
-0xC42E, 0xC40E, 0x41C6, 0x0820, 0x3104, 0x28C3, 0x30E4, 0x20A3, 0x0000, 0x1081, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_left_2.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_left_2_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x1082, 0x4A08, 0x5228, 0x5228, 0x5228, 0x5A49, 0x3986, 
-0x1061, 0x5A69, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x20E3, 0x3966, 
-0x5229, 0x5229, 0x5A69, 0x5A8A, 0x5A8A, 0x5228, 0x39A6, 0x3165, 0x5A48, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xC40D, 0xB42E, 0x0000, 0xBD10, 0xACAF, 0xACAF, 0x5A8A, 0x41C8, 0x5229, 0x5A8A, 0x62AA, 0x5249, 0x2924, 0x6268, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x6ACA, 0x940C, 0xDE33, 0xDE12, 0xD5F2, 0xA48E, 0x9C4E, 
-0x6AEA, 0x41E8, 0x5A69, 0x5A8A, 0x5A69, 0x18C2, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x1080, 
-0xDE12, 0xAC6D, 0xAC8D, 0xCDD1, 0xDE13, 0xE633, 0xB4EF, 0x6AEB, 0x5229, 0x5A69, 0x5A69, 0x62AA, 0x0000, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xA3EE, 0x0820, 0xBCEE, 0xCDD1, 0xC590, 0x9C0D, 0xAC8E, 0xC550, 0xE633, 0xA46E, 0x49E8, 0x5A69, 
-0x5A69, 0x5A8A, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x8B8D, 0x3963, 0xBD0F, 0xE6B6, 0xDE75, 0x7249, 
-0x8B6A, 0xC550, 0xDE12, 0x942E, 0x41E8, 0x5249, 0x5A69, 0x41E7, 0x41A6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 
-0x3984, 0xE653, 0x8B8A, 0x5146, 0x59A7, 0xC550, 0xCDD2, 0xC591, 0xD5F2, 0x9C2E, 0x5249, 0x62CA, 0x4A08, 0x0841, 0xC44F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x832B, 0x3984, 0xE653, 0xC571, 0xC550, 0xC550, 0xC591, 0xCD91, 0xC591, 0xCDB2, 0xB4CE, 
-0xAC8D, 0xB510, 0x49E7, 0x18A2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0x8B4C, 0x39A4, 0xEEB5, 0xD5D2, 0xCD91, 
-0xCDB1, 0xCD91, 0xC591, 0xCDB2, 0xACAE, 0xAC8D, 0xD5F2, 0x9C4D, 0x2104, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA40E, 0x20A3, 0x4104, 0x59C7, 0x7AEA, 0xDE53, 0xCD91, 0xC571, 0xCDB2, 0xCDD2, 0xC550, 0xBD30, 0xE654, 0xA46D, 0x0841, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A68, 0x0000, 0x3044, 0x2823, 0x38A4, 0x7B0A, 0xCDB2, 0xD5D2, 0xB4EF, 0xAC8D, 
-0xBD30, 0xDE13, 0x9C4D, 0x5A68, 0xB44F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41C6, 0x3943, 0x82EB, 0x3864, 
-0x3063, 0x2863, 0xB4CE, 0xBD0F, 0xA44C, 0x93AA, 0xACAE, 0xF6B5, 0x7329, 0x20C3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAC0F, 0x734A, 0x49C5, 0x0000, 0x2062, 0x7AC9, 0x9C0B, 0x9C0B, 0x9C0B, 0xA46D, 0xCD71, 0xACCE, 0x6AC9, 0xA3EE, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xAC2F, 0x3165, 0x5A69, 0x62A9, 0x8BAA, 0xA42C, 0x9C2C, 
-0xA44C, 0xC550, 0xEEB5, 0x5226, 0x6269, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44F, 0x0000, 0x9C0B, 0xA44C, 0xC550, 0xD5D2, 0xCDB1, 0x41C4, 0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0020, 0x9C2C, 0xC570, 0xCD91, 0xDE33, 0x5A88, 0x0000, 
-0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0820, 
-0xBD50, 0xD5B1, 0xB577, 0x6B71, 0x39EA, 0x39EB, 0x2126, 0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xC40D, 0xBC2E, 0x3144, 0xACAE, 0xCDB1, 0xBD76, 0x6B51, 0x420C, 0x422C, 0x4A6D, 0x420B, 0x2106, 0x6AA9, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xBC4E, 0x41A4, 0x93EA, 0xE633, 0xB556, 0x6B51, 0x422C, 0x420B, 
-0x424C, 0x422C, 0x4A6D, 0x3A0B, 0x18E5, 0x6AA9, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x4A09, 0x62CD, 
-0xD637, 0xB535, 0x6B51, 0x3A0B, 0x420B, 0x4A4C, 0x4A4D, 0x4A4C, 0x422C, 0x4A6C, 0x422C, 0x1083, 0x7B2B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6AA9, 0x10A4, 0xC5DD, 0x8C56, 0x6B52, 0x39EB, 0x422B, 0x4A4C, 0x3A0B, 0x31C9, 0x3A0B, 0x4A4C, 0x422C, 
-0x4A4C, 0x4A8D, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x732C, 0x5AEE, 0xC5FC, 0x94B6, 0x31AA, 0x422C, 0x424C, 
-0x420B, 0x2988, 0x1905, 0x31A9, 0x4A4D, 0x422C, 0x424C, 0x422C, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41A5, 0x5ACD, 
-0xF79F, 0xCE5B, 0x94D6, 0x3A0B, 0x422C, 0x4A4C, 0x2968, 0x2146, 0x2947, 0x39CA, 0x4A4C, 0x422C, 0x424C, 0x422C, 0x0000, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6268, 0x5ACC, 0xEF7F, 0x9CD6, 0x31AA, 0x422C, 0x422C, 0x4A4C, 0x2988, 0x2126, 0x39EA, 0x4A4C, 
-0x422C, 0x422C, 0x424C, 0x422C, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6268, 0x52AC, 0xEF9F, 0x9CF6, 0x31AA, 0x422C, 
-0x422C, 0x4A4C, 0x2968, 0x39CA, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x424C, 0x422C, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x72CA, 
-0x6B6F, 0xCE9C, 0x9CF6, 0x4A4C, 0x422B, 0x422C, 0x422C, 0x4A4C, 0x2968, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A6D, 
-0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x2903, 0x7BF1, 0xF79F, 0x8433, 0x2989, 0x424C, 0x422C, 0x422C, 0x4A4C, 0x2967, 0x39EA, 
-0x4A6D, 0x422C, 0x422C, 0x4A4C, 0x3A0B, 0x18C4, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3964, 0x6B6F, 0xEF7F, 0x8C74, 0x31AA, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x31A9, 0x39EB, 0x4A4C, 0x422C, 0x4A4C, 0x39EA, 0x1061, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 
-0xAC2F, 0x62CC, 0x9D16, 0xEF5F, 0x94B5, 0x31AA, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x2988, 0x31A9, 0x4A4C, 0x422C, 0x4A4C, 
-0x39EA, 0x1061, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x0820, 0xA537, 0xE73E, 0xB5B9, 0x6B91, 0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x4A4C, 0x2988, 0x31C9, 0x4A4D, 0x422C, 0x4A4C, 0x39EA, 0x1061, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x20E3, 0x94B4, 0xE75F, 0x73B1, 
-0x2969, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4D, 0x3188, 0x3188, 0x422C, 0x4A4C, 0x4A4C, 0x39EA, 0x1061, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0x20C2, 0x94B4, 0xE71E, 0x7BD2, 0x31CA, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x31A8, 0x2126, 0x31A9, 
-0x4A4C, 0x4A4C, 0x39EA, 0x1061, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x20E3, 0x9CD5, 0xC5FB, 0x6330, 0x39EA, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x4A4C, 0x3188, 0x2147, 0x2147, 0x2147, 0x31A9, 0x4A6D, 0x39EA, 0x1061, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x41A6, 0x9CF5, 0xA538, 
-0xA518, 0x6B50, 0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4D, 0x2967, 0x31C9, 0x422C, 0x420B, 0x422B, 0x4A6D, 0x3A0B, 0x0020, 
-0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44F, 0x0820, 0xBDFA, 0xA518, 0xA519, 0x7371, 0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 0x31A9, 0x39CA, 0x422C, 
-0x4A4C, 0x4A4C, 0x4A6D, 0x39CA, 0x2925, 0xBC4F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1061, 0xB598, 0xCE5C, 0x8413, 0x4A6D, 0x420B, 0x422C, 
-0x422C, 0x4A4C, 0x4A4C, 0x2146, 0x3A0B, 0x4A4C, 0x422C, 0x4A4C, 0x4A6D, 0x18E5, 0x1061, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x0820, 
-0xAD78, 0xE71E, 0x6B50, 0x31AA, 0x4A4C, 0x422C, 0x4A4C, 0x424C, 0x31A9, 0x31C9, 0x422B, 0x424C, 0x4A4C, 0x4A4C, 0x2147, 0x2945, 
-0xAC0E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xA40E, 0x528B, 0xBDDA, 0xD6DE, 0x6B71, 0x39CA, 0x422C, 0x4A4C, 0x422C, 0x31C9, 0x3188, 0x424C, 
-0x4A4C, 0x4A4C, 0x4A4C, 0x2967, 0x0000, 0x5227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB42F, 0x0000, 0xDEFD, 0xCE7C, 0xD69D, 0x6B71, 0x39CA, 
-0x4A4C, 0x422C, 0x31C9, 0x2988, 0x4A4C, 0x424C, 0x4A4C, 0x4A4C, 0x2967, 0x1082, 0x0000, 0x4A07, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 
-0x0861, 0xC63B, 0xCE5C, 0xD6BD, 0x6B91, 0x39CA, 0x422C, 0x31C9, 0x2988, 0x4A4C, 0x422C, 0x424C, 0x4A4C, 0x2988, 0x0841, 0x2947, 
-0x2968, 0x49E6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0861, 0xC65C, 0xCE5C, 0xD6BD, 0x6B71, 0x39EB, 0x31C9, 0x2988, 0x4A4C, 0x424C, 
-0x422C, 0x424C, 0x31A9, 0x0041, 0x2126, 0x52AF, 0x2106, 0x49E6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0862, 0xCE9C, 0xD6BD, 0xDEFE, 
-0x5B10, 0x8BEE, 0x7B8C, 0x1907, 0x4A6D, 0x424C, 0x4A4C, 0x31A9, 0x0020, 0x2126, 0x4A4C, 0x4A8D, 0x2106, 0x49E6, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBC6F, 0x0000, 0x4A6B, 0x4A6C, 0x422B, 0x8BEE, 0xCDB1, 0xCDB1, 0x6B2B, 0x1907, 0x4A4C, 0x31A9, 0x0841, 0x2947, 0x4A4C, 
-0x4A8D, 0x5ACF, 0x18E5, 0x2903, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x1906, 0x1906, 0x0023, 0x940D, 0xDE12, 0xD5D2, 0xC571, 
-0x736C, 0x2988, 0x0841, 0x10A3, 0x31A8, 0x422B, 0x10A4, 0x0000, 0x3986, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x18E5, 
-0x2147, 0x630B, 0xB510, 0xCDB1, 0xC571, 0xE653, 0xBD30, 0x0041, 0x10A3, 0x2967, 0x2968, 0x0862, 0x6AEA, 0xA3ED, 0xBC6F, 0xC40D, 
-0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x0842, 0x0863, 0xBD30, 0xDE12, 0xC571, 0xCDB1, 0xBD30, 0x62CA, 0x0862, 0x2988, 0x2967, 
-0x2988, 0x0000, 0xAC2E, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x18C4, 0x39C7, 0xACCE, 0xCDB1, 0xC591, 
-0xDE12, 0x8BCD, 0x0065, 0x2988, 0x2967, 0x2967, 0x31A9, 0x0000, 0x9BEE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 
-0x0000, 0x31A8, 0xCDB1, 0x93CA, 0xACCE, 0xD5F2, 0xDE32, 0x942E, 0x10E6, 0x2967, 0x2967, 0x2967, 0x2126, 0x18C3, 0xB44F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x2987, 0x93EB, 0x1061, 0x734A, 0xD5D2, 0xCDB1, 0x8BED, 0x10E6, 0x2967, 
-0x2967, 0x2967, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x2147, 0x18E4, 0x0000, 
-0x2105, 0x31C9, 0x31A8, 0x2987, 0x2147, 0x2967, 0x2967, 0x2968, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBC6F, 0x0000, 0x2147, 0x1084, 0x0000, 0x18C4, 0x2147, 0x2127, 0x2147, 0x2967, 0x2967, 0x2967, 0x29A8, 0x0000, 0xAC2F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC44F, 0x0000, 0x2147, 0x10A4, 0x0000, 0x18E5, 0x2988, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2147, 0x0841, 0x9BEE, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x6289, 0x10C4, 0x2967, 
-0x10A4, 0x0000, 0x18E5, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x0020, 0xC46F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAC0E, 0x0000, 0x31A9, 0x1905, 0x10A3, 0x0000, 0x18E5, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0000, 
-0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0000, 0x2947, 0x1063, 0x1083, 0x0000, 0x18E5, 0x2988, 
-0x2967, 0x2967, 0x2967, 0x2147, 0x1905, 0x6289, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2F, 0x0000, 
-0x2967, 0x0843, 0x1083, 0x0000, 0x18E5, 0x2988, 0x2967, 0x2967, 0x2967, 0x1905, 0x1882, 0xC44E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x1082, 0x2146, 0x2105, 0x1083, 0x0000, 0x18E5, 0x2988, 0x2967, 0x2967, 0x2967, 0x1906, 
-0x1882, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB42F, 0x1061, 0xBD30, 0x2905, 0x0000, 
-0x18E5, 0x2988, 0x2967, 0x2967, 0x2967, 0x1906, 0x18A2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBC4F, 0x0000, 0xB4CE, 0x9C0C, 0x2904, 0x0000, 0x1905, 0x2126, 0x1083, 0x18C5, 0x2967, 0x2126, 0x2924, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xB42F, 0x3143, 0xB48C, 0x39A6, 0x0000, 0x0862, 0x18C5, 0x0862, 
-0x10A3, 0x2968, 0x2967, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x0000, 
-0x4A28, 0x2105, 0x0842, 0x0841, 0x0842, 0x18C4, 0x2126, 0x2967, 0x2147, 0x0020, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x9BCD, 0x18C4, 0x10C4, 0x18C5, 0x0020, 0x0020, 0x2106, 0x29A8, 0x2967, 0x2147, 0x0020, 
-0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x2923, 0x18E5, 0x20E5, 0x0841, 
-0x0821, 0x10A3, 0x2126, 0x2967, 0x2147, 0x0020, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44E, 0x20C3, 0x18E5, 0x18E5, 0x1083, 0x0841, 0x0000, 0x18A4, 0x2968, 0x2147, 0x0020, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x5227, 0x1905, 0x18E5, 0x10A4, 0x0841, 0x0020, 0x18C5, 0x2968, 
-0x2147, 0x0841, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x49E6, 
-0x1083, 0x2106, 0x0821, 0x0020, 0x18C4, 0x2967, 0x2967, 0x2968, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x41A6, 0x0883, 0x2126, 0x1063, 0x0842, 0x0821, 0x18C4, 0x2967, 0x2988, 0x0000, 0xB44F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x5A69, 0x0821, 0x28E4, 0x1882, 
-0x0000, 0x10A4, 0x2968, 0x2988, 0x0000, 0xBC4F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x730A, 0x0000, 0x3925, 0x2082, 0x0000, 0x1083, 0x18C4, 0x2147, 0x18C5, 0x39A6, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0B, 0x0800, 0x20A3, 0x0841, 0x10E5, 0x18E5, 0x18E5, 0x2147, 
-0x3A0A, 0x0000, 0x834C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x49E7, 0x0800, 
-0x1061, 0x2904, 0x41C8, 0x3987, 0x2168, 0x2167, 0x10A4, 0x5248, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBC4F, 0x1082, 0x0000, 0x1882, 0x3103, 0x61E6, 0x51A5, 0x51A5, 0x3167, 0x3187, 0x0000, 0xBC4F, 0xC40D, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x18A2, 0x0820, 0x0840, 0x3924, 0x59C6, 0x49A5, 0x49A5, 0x49A5, 
-0x51A5, 0x59C6, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1061, 0x4164, 0x51C6, 
-0x51A6, 0x51A6, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x51A5, 0x51C6, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_left_3.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_left_3_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBC4F, 0x1061, 0x5228, 0x5228, 0x5228, 0x5228, 0x5228, 0x5249, 0x2904, 0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xBC4F, 0x18A2, 0x41C7, 0x5A8A, 0x5A8A, 0x5A69, 0x5A69, 0x5A69, 0x5A8A, 0x5249, 
-0x2924, 0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x2924, 0x20E4, 0x5249, 0x4A08, 
-0x49E8, 0x5249, 0x5A69, 0x5A69, 0x5A69, 0x5A8A, 0x5228, 0x2924, 0x6ACA, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x8B6C, 0x1061, 0xB511, 0x9C2E, 0x9C2E, 0x9C4E, 0x5A69, 0x4A28, 0x5A69, 0x5A69, 0x5A69, 0x62AA, 0x4A08, 0x0020, 0xC44F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x3143, 0xF6D5, 0xDE12, 0xDE13, 0xDE12, 0xA46E, 0x5A69, 0x4A08, 
-0x5A69, 0x5A69, 0x5A8A, 0x4A07, 0x1082, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x20E2, 0xCD91, 
-0xB4CE, 0xB4CE, 0xCDB1, 0xDE33, 0x9C6E, 0x62AA, 0x5229, 0x4A28, 0x5249, 0x4A08, 0x1082, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9BCE, 0x1860, 0xB4CD, 0xBD2F, 0xB50F, 0xAC6E, 0xC550, 0xE653, 0x8BCD, 0x5249, 0x734B, 0x730B, 0x49E7, 
-0x1082, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCE, 0x1060, 0xCD70, 0xF778, 0xEEF6, 0x6208, 0xAC8E, 
-0xDE33, 0x7B6C, 0x83AC, 0xE653, 0xB510, 0x41C7, 0x1082, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BAD, 
-0x20C1, 0xA40C, 0x5966, 0x61E8, 0xBD10, 0xCD91, 0xCDB2, 0xAC8D, 0xACAD, 0xD5F2, 0xB4F0, 0x41C7, 0x1082, 0xC44F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6D, 0x1060, 0xC52F, 0xB4CF, 0xB4CF, 0xCD91, 0xCD91, 0xCDB2, 0xAC8D, 0xAC8D, 0xD5F2, 
-0xB4F0, 0x41C7, 0x1082, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x93AD, 0x49E5, 0xEED4, 0xDE53, 
-0xCD91, 0xC571, 0xCD91, 0xBD30, 0xC570, 0xD5F2, 0xB510, 0x49E8, 0x0000, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40E, 0xC40D, 0xB44F, 0x0000, 0x7AAA, 0x72AA, 0xD5D2, 0xCDD2, 0xCD91, 0xD5F3, 0xBD30, 0xBD2F, 0x9C6D, 0x3145, 0xAC2F, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0000, 0x2002, 0x2843, 0x72CA, 0xC571, 0xC550, 0xB4EF, 
-0xA44C, 0xB4EE, 0x93EC, 0x2903, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0F, 0x0000, 
-0x7269, 0x38A4, 0x2022, 0xAC6E, 0xB4CE, 0x93CB, 0x9BEB, 0xBD0F, 0x940C, 0x2904, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x4A06, 0x6AC7, 0x1842, 0x1821, 0x51E5, 0x9C0B, 0xAC6D, 0x9BEB, 0xBD0F, 0x93EC, 0x20E3, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x20E3, 0x3165, 0x3185, 0x3145, 
-0x6AC8, 0xA42C, 0xA42C, 0xBD2F, 0x9C4D, 0x3985, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0x6289, 0x3963, 0xC550, 0xCDB2, 0xCDD2, 0xACAF, 0x18A2, 0xC44F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0x6289, 0x3122, 0xC550, 0xD5D1, 
-0xCD93, 0x9CB6, 0x39CA, 0x18C2, 0xC44F, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6AA9, 0x41A6, 0x7B6B, 0xBD0F, 0xCD90, 0xC593, 0x8C55, 0x528E, 0x4A4C, 0x3188, 0x49E7, 0x3124, 0xBC6F, 0xC40D, 0xC40D, 0xC40E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC42E, 0x6ACA, 0x0883, 0x0000, 0x940D, 0xEE72, 0xBD52, 0xAD38, 0x8C56, 0x39CA, 0x422C, 0x4A6D, 
-0x2947, 0x10C4, 0x4A28, 0x6288, 0xAC2F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x7B0B, 0x0021, 0x10A4, 0x52AE, 0xB510, 0xCD92, 
-0xA4D6, 0x8415, 0x630F, 0x422B, 0x422C, 0x422C, 0x4A6D, 0x5ACF, 0x2948, 0x0042, 0x2946, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xBC4F, 
-0x0000, 0x2126, 0x632E, 0x9CF8, 0xBD75, 0x9CB5, 0xAD7B, 0x9495, 0x2989, 0x424C, 0x422C, 0x4A4C, 0x4A4C, 0x422C, 0x4A6D, 0x5AEF, 
-0x18E5, 0x2103, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x9BCD, 0x0021, 0x5B0E, 0xD6BD, 0xAD38, 0x8C56, 0x9CF8, 0xB5B9, 0x8433, 0x39EA, 0x422C, 
-0x4A4C, 0x3A0B, 0x39EA, 0x422B, 0x422C, 0x4A6D, 0x18E5, 0x49E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x0000, 0x634F, 0xD6DD, 0xCE7C, 0xAD38, 
-0x9CB7, 0xCE7C, 0x8C94, 0x2948, 0x424C, 0x422C, 0x420B, 0x2967, 0x1926, 0x39EA, 0x4A4C, 0x4A6D, 0x2147, 0x41C7, 0xC44F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAC0E, 0x10A3, 0xDEFE, 0xC65B, 0xC63B, 0xC65B, 0xCE5B, 0xD69D, 0x8433, 0x31AA, 0x4A4C, 0x420B, 0x2967, 0x2147, 0x2147, 0x39EA, 
-0x4A4C, 0x422C, 0x4A6D, 0x3188, 0x2103, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x10A3, 0xD6DE, 0xC65B, 0xC63B, 0xC65B, 0xD6DD, 0x8413, 0x39EB, 0x422C, 
-0x4A4C, 0x420B, 0x2967, 0x2147, 0x39EA, 0x424C, 0x424C, 0x422C, 0x4A6D, 0x2988, 0x20E3, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x4208, 0xBDDA, 0xCE5C, 0xC63B, 
-0xC63B, 0xC63B, 0xD6DD, 0x7BD2, 0x31AA, 0x424C, 0x4A4C, 0x420B, 0x2147, 0x2147, 0x422B, 0x4A4C, 0x422C, 0x422C, 0x4A4D, 0x2988, 
-0x2903, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x8B6C, 0x2125, 0xEF7F, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6DD, 0x7BF2, 0x31AA, 0x422C, 0x422C, 0x422C, 0x420B, 0x2967, 
-0x2988, 0x3A0B, 0x4A4C, 0x422C, 0x4A4D, 0x2988, 0x2903, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0x9BAD, 0x18C3, 0xE71F, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xE73F, 0x8434, 
-0x31AA, 0x424C, 0x4A4D, 0x424C, 0x39CA, 0x2967, 0x2126, 0x39EB, 0x4A6D, 0x422C, 0x4A6D, 0x2968, 0x2903, 0xC40E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x730C, 0x7BF1, 0xD6BD, 
-0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xA557, 0x5AEF, 0x3A0B, 0x420B, 0x39C9, 0x31C9, 0x2126, 0x2147, 0x2967, 0x31A9, 0x420B, 0x424C, 
-0x4A4C, 0x39CA, 0x3166, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x5A27, 0x39E9, 0xF7BF, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6BD, 0x630F, 0x3189, 0x4A6D, 0x39EA, 0x1905, 0x2146, 
-0x31A9, 0x2967, 0x1905, 0x1905, 0x31CA, 0x4A4C, 0x422C, 0x4A6D, 0x420B, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0A, 0x39E8, 0xDF1F, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6BD, 
-0x6B71, 0x39CA, 0x4A4C, 0x3A0B, 0x2967, 0x31A9, 0x4A4C, 0x2988, 0x0000, 0x10A3, 0x3A0B, 0x4A4C, 0x422C, 0x4A4C, 0x39EA, 0x1061, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x72EA, 0x52AC, 
-0xDEFE, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6BD, 0x6B91, 0x39CA, 0x422C, 0x422C, 0x4A4C, 0x4A4C, 0x422C, 0x2988, 0x0841, 0x10A3, 
-0x39CA, 0x4A4C, 0x424C, 0x4A4C, 0x39EA, 0x1061, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6268, 0x630D, 0xD6DD, 0xC65B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6BD, 0x6B71, 0x39CA, 0x422C, 0x422C, 
-0x424C, 0x424C, 0x422C, 0x2968, 0x2967, 0x0862, 0x1083, 0x39EA, 0x4A4C, 0x4A4C, 0x39EA, 0x1061, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A27, 0x630D, 0xE71F, 0xC63B, 0xC63B, 0xC63B, 0xC65B, 
-0xCE7C, 0xB599, 0x62EF, 0x39EB, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x2968, 0x2988, 0x0861, 0x10A3, 0x2988, 0x31C9, 0x4A6D, 
-0x39EA, 0x1061, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8C, 0x0020, 
-0x73D0, 0xE71F, 0xC63B, 0xC63B, 0xC65B, 0xC63B, 0xAD38, 0xA4F8, 0x5AEF, 0x39EB, 0x422C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x2988, 
-0x2167, 0x0841, 0x10A3, 0x2147, 0x2988, 0x4A6D, 0x39EA, 0x1061, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x10A4, 0x0000, 0x5AAC, 0xD69E, 0xCE9C, 0xC63B, 0xC65B, 0xC63B, 0x9496, 0xAD39, 0x6330, 0x39EB, 
-0x422C, 0x424C, 0x4A6D, 0x4A4C, 0x31A9, 0x2146, 0x39EA, 0x1082, 0x18E4, 0x420B, 0x39EA, 0x4A6D, 0x420B, 0x0000, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x1083, 0x0863, 0x4A6A, 0x8413, 0xA518, 0xBDFA, 0xCE5C, 
-0xC65B, 0xC63B, 0xB5BA, 0x83F3, 0x4A8D, 0x422B, 0x4A4C, 0x420B, 0x31C9, 0x31A9, 0x2126, 0x31A9, 0x52AF, 0x1082, 0x18E4, 0x52AE, 
-0x4A4D, 0x39EA, 0x3167, 0x9BCE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0x8B8D, 0x0021, 0x3A0B, 
-0x0000, 0xA536, 0xCE5D, 0x8414, 0xA518, 0xCE7C, 0xC63B, 0xC65B, 0xD6BD, 0x52CE, 0x39CA, 0x424C, 0x4A4C, 0x39EA, 0x1905, 0x2146, 
-0x31A9, 0x4A4C, 0x31A9, 0x18C4, 0x3188, 0x4A6D, 0x4A8D, 0x2968, 0x1081, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8B8D, 0x0000, 0x424C, 0x2967, 0x0000, 0x9493, 0xC63C, 0x9CD7, 0xB599, 0xCE5C, 0xC63B, 0xC65B, 0xCE7C, 0x5B0F, 
-0x39EB, 0x422C, 0x4A4C, 0x3A0B, 0x2968, 0x31A9, 0x4A4C, 0x4A6D, 0x0020, 0x2967, 0x52AE, 0x424C, 0x3A0B, 0x3188, 0x72EA, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x0821, 0x4A4D, 0x2147, 0x2967, 0x0000, 0x8C73, 0xDF1E, 0xCE9C, 
-0xCE7C, 0xC63B, 0xC63B, 0xC65B, 0xCE7C, 0x5B0F, 0x39EB, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x4A4C, 0x422C, 0x4A6D, 0x0841, 0x2947, 
-0x4A6D, 0x4A8D, 0x18E5, 0x41A6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x41A3, 0xBD52, 0x39EB, 
-0x2167, 0x2147, 0x0000, 0x8C53, 0xD6BD, 0xC61B, 0xC63B, 0xC65B, 0xC65B, 0xCE5C, 0xCE7C, 0x630F, 0x39EB, 0x422C, 0x422C, 0x422C, 
-0x424C, 0x422C, 0x424C, 0x4A4C, 0x0861, 0x2947, 0x4A6D, 0x4A6D, 0x2106, 0x5207, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x834C, 0x4A06, 0xCDB1, 0xD5D2, 0xA48F, 0x2147, 0x0841, 0x18E5, 0x31C9, 0x39E9, 0x2147, 0x7390, 0xE71E, 0xCE9C, 0xD69D, 
-0xD6BD, 0x632F, 0x39EB, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422C, 0x1082, 0x18E5, 0x2147, 0x422C, 0x18C5, 0x6289, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A8A, 0x3984, 0xEE94, 0xD5F2, 0xACCF, 0x0020, 0x0000, 0x2126, 0x2147, 
-0x2126, 0x1905, 0x31A8, 0x52AC, 0x4A6C, 0x4A6C, 0x4A8C, 0x31A8, 0x3A0B, 0x4A6D, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A6D, 0x4A6D, 0x0000, 
-0x0864, 0x10E6, 0x31A9, 0x0021, 0x5207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x6AE9, 0x9C2C, 0xBD30, 
-0xC571, 0xA44C, 0x5A66, 0x0820, 0x1906, 0x2967, 0x2967, 0x2968, 0x2126, 0x18E5, 0x1906, 0x1906, 0x1906, 0x2146, 0x2988, 0x31A9, 
-0x31A9, 0x31A9, 0x31A9, 0x2988, 0x18E4, 0x7B4A, 0x942D, 0xA48F, 0x3185, 0x5A49, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x1882, 0x7328, 0xE612, 0xA46D, 0xCD91, 0xB4AD, 0xBCCE, 0x0840, 0x18E5, 0x2988, 0x2105, 0x2126, 0x2988, 0x2967, 
-0x2147, 0x18E5, 0x18E5, 0x2147, 0x2147, 0x2146, 0x2147, 0x2147, 0x2167, 0x18E5, 0x0000, 0xBD50, 0xE653, 0xF6B4, 0x4183, 0x8B6C, 
-0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2F, 0x5247, 0x8369, 0xCD90, 0xA46D, 0x4183, 0x5A67, 0x18C3, 
-0x2126, 0x2988, 0x10A4, 0x1083, 0x2147, 0x2988, 0x2147, 0x1083, 0x1062, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x2967, 
-0x5267, 0xBD50, 0xCDB2, 0xE633, 0x3984, 0x832C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 
-0x3964, 0x6A86, 0x5A67, 0x5208, 0x0000, 0x2967, 0x2968, 0x2967, 0x2106, 0x1063, 0x10A4, 0x2146, 0x1905, 0x0862, 0x1083, 0x2126, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x39E9, 0xDE33, 0xCD91, 0xC591, 0xE654, 0x3143, 0x834C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xAC2F, 0x0841, 0x93AD, 0xC42E, 0x1061, 0x2126, 0x2967, 0x2967, 0x2988, 0x2106, 
-0x1062, 0x1063, 0x1062, 0x0000, 0x1063, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x2127, 0x39E8, 0xC550, 0x8B8A, 0xB4CE, 0xE653, 
-0x62A7, 0x7B2B, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC44F, 
-0x0841, 0x2126, 0x2967, 0x2967, 0x2967, 0x18E5, 0x1063, 0x1083, 0x1063, 0x0000, 0x1063, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2147, 0x39C8, 0x93CB, 0x0840, 0x6287, 0xB4EF, 0xD5F2, 0x5205, 0x5228, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0841, 0x2126, 0x2967, 0x2968, 0x18E5, 0x1083, 0x1083, 0x10A4, 0x1063, 0x0841, 
-0x1063, 0x2146, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2146, 0x1061, 0x0000, 0x0820, 0x0841, 0x1061, 0x0000, 0x62A9, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0841, 0x2126, 0x2967, 0x2988, 
-0x18E5, 0x1063, 0x1083, 0x0021, 0x3985, 0xC46F, 0x2904, 0x18E5, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x18E5, 0x0020, 
-0xB42F, 0xC44F, 0xC44F, 0xC44F, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 
-0xC40D, 0xC44E, 0x0841, 0x2126, 0x2967, 0x2988, 0x18E5, 0x1063, 0x18C4, 0x0001, 0x2903, 0xC40D, 0x3144, 0x10C4, 0x2968, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0020, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x6ACA, 0x18C4, 0x2147, 0x2967, 0x2106, 0x10A4, 0x1083, 0x0021, 0x3986, 
-0xBC4F, 0xC44E, 0x1081, 0x10C4, 0x31A8, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x0020, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0000, 0x2988, 0x2967, 
-0x2967, 0x18A4, 0x1063, 0x18C4, 0x0000, 0x49E7, 0xC40D, 0xC42E, 0xA3EE, 0x2945, 0x1905, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2147, 0x0020, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x2967, 0x2967, 0x2967, 0x18C4, 0x1063, 0x0822, 0x2104, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0x3985, 
-0x0862, 0x31A8, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x0020, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x2967, 0x2147, 0x2147, 0x18E5, 0x10A4, 0x0000, 
-0x8B8C, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x834C, 0x20E4, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x0020, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x18C3, 
-0x2146, 0x31C8, 0x39E8, 0x2988, 0x18E5, 0x0000, 0x834C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 0x0021, 0x2988, 0x2967, 
-0x2967, 0x2967, 0x2147, 0x0020, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x1061, 0xB4EF, 0xD5F2, 0x528A, 0x1927, 0x0020, 0x7B2B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6ACA, 0x0021, 0x2988, 0x2967, 0x2967, 0x2967, 0x2147, 0x0020, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x0000, 0xA46C, 0xB4CE, 0xA44C, 
-0x5269, 0x0884, 0x0841, 0x834B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A48, 0x0021, 0x31C9, 0x2126, 0x1083, 0x18C4, 0x2167, 0x2126, 
-0x18C3, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xB44F, 0x3964, 0x93AA, 0xCD4E, 0x62CA, 0x10C5, 0x0000, 0x5207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x5228, 
-0x0000, 0x20E5, 0x1062, 0x1083, 0x2967, 0x2988, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x18C2, 0x39A6, 0x62CA, 0x39E8, 0x18E5, 0x0000, 0x6289, 
-0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44E, 0x6AA9, 0x0000, 0x18A4, 0x2146, 0x2967, 0x2968, 0x0000, 0xBC4F, 0xC40D, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x1061, 
-0x08A4, 0x1927, 0x2147, 0x2106, 0x0000, 0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xA40E, 0x0000, 0x18E5, 0x2126, 
-0x2967, 0x2967, 0x0883, 0x62AA, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x8B8C, 0x2925, 0x2106, 0x2988, 0x2106, 0x0000, 0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC470, 0x41C7, 0x0021, 0x1083, 0x2947, 0x2967, 0x31C9, 0x0000, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41C6, 0x0883, 0x29A8, 0x2106, 
-0x0000, 0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xBC6F, 0x0000, 0x18A4, 0x2967, 0x2967, 0x2988, 0x0000, 
-0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0x41A6, 0x1083, 0x2988, 0x18E5, 0x0000, 0x5228, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 
-0x0000, 0x18A4, 0x2147, 0x2967, 0x2988, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x41A5, 0x10A4, 0x1905, 0x1063, 0x1084, 0x0821, 0x41A6, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0020, 0x1083, 0x1083, 0x2147, 0x2988, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x3965, 0x1083, 
-0x2106, 0x1063, 0x10A4, 0x0021, 0x3165, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0020, 0x1083, 0x2147, 
-0x2988, 0x0000, 0xAC0E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x5248, 0x0821, 0x28C3, 0x28C3, 0x20A3, 0x20C3, 0x5A68, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC46F, 0x0020, 0x1083, 0x2967, 0x2968, 0x1906, 0x20E4, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0x72EA, 0x0000, 0x30E4, 0x28E3, 0x30E4, 
-0x2082, 0x1081, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 0x0862, 0x10A4, 0x2126, 0x31C9, 0x0000, 0x7B2B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 
-0xAC2F, 0x3965, 0x1861, 0x28E4, 0x28C3, 0x28E4, 0x2082, 0x18C2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44F, 0x0020, 
-0x18E5, 0x18E5, 0x2127, 0x2988, 0x0000, 0x8B8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x2103, 0x0820, 0x3904, 0x28E3, 0x30E4, 0x3104, 0x2082, 0x0841, 0xC44F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x834C, 0x20A2, 0x3987, 0x39A7, 0x3986, 0x2988, 0x0000, 0x8B8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xBC6F, 0xBC6F, 0x3985, 0x1861, 0x3104, 0x2082, 
-0x0821, 0x1020, 0x1041, 0x72EA, 0xC44E, 0xC40D, 0xC46F, 0xB44F, 0xBC4F, 0x8B6C, 0x0000, 0x59E7, 0x51A5, 0x51A5, 0x51A5, 0x41A7, 
-0x0000, 0x8B8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xAC2F, 
-0x0000, 0x0000, 0x20A3, 0x30E4, 0x20A2, 0x3965, 0x5207, 0x3985, 0x72EA, 0xC40D, 0xC40D, 0xC44F, 0x49E7, 0x0000, 0x0000, 0x1861, 
-0x6207, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x59C6, 0x0800, 0x8B8D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0000, 0x28E3, 0x28E3, 0x28C3, 0x30E4, 0x0000, 0x9BEE, 0xC40D, 0xC42E, 0xC42E, 0xC40D, 
-0xC42E, 0x3985, 0x20A2, 0x59E6, 0x51A6, 0x51A6, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x59C6, 0x0800, 0x8B8D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_left_4.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_left_4_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0x3165, 0x18C2, 0x20E3, 0x20E3, 0x0841, 
-0x8B8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44F, 0x2924, 
-0x41A6, 0x41A6, 0x41C7, 0x41A6, 0x41A6, 0x41C7, 0x20E3, 0x8B6C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xC40D, 0xC44F, 0x3144, 0x2904, 0x3145, 0x5A69, 0x62AA, 0x5A8A, 0x5A8A, 0x62CA, 0x49E7, 0x2904, 0x8B6C, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x41C6, 0x20E3, 0x62CB, 0x5229, 0x4A08, 0x4A08, 0x49E8, 
-0x5249, 0x5A69, 0x6ACB, 0x3124, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x834C, 0x0000, 
-0x6AEB, 0x5249, 0x8BED, 0x8BCD, 0x8BCD, 0x940D, 0x6AEB, 0x5249, 0x5A8A, 0x49E7, 0x39A6, 0xAC0E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCD, 0x0000, 0x62AA, 0x940D, 0xDE12, 0xDE12, 0xDE12, 0xEE73, 0x83AC, 0x41E8, 0x5249, 0x5A6A, 
-0x41C7, 0x0020, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x0820, 0x9C4E, 0xDE12, 0xCD91, 0xBD30, 
-0xBD30, 0xD5D1, 0x942E, 0x5A69, 0x5A8A, 0x7B4C, 0x5A69, 0x18A2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x938D, 0x3143, 0xE674, 0xCD91, 0xBD30, 0x9C2C, 0x9C0B, 0xBD0F, 0xDE33, 0x8BAC, 0x732B, 0xE673, 0xACAE, 0x1882, 0xC44F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8D, 0x3123, 0xE654, 0xC550, 0xA42C, 0xA42C, 0x9C0B, 0xBD2F, 0xDE12, 0x83AC, 
-0x732B, 0xE633, 0xA48E, 0x1882, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x834C, 0x18A1, 0xC50F, 0xB4EE, 
-0xFFB8, 0xFF98, 0x6A48, 0x9C0D, 0xDE13, 0xA48D, 0x9C2C, 0xD613, 0xA48E, 0x1882, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0x8B8D, 0x3963, 0xA42C, 0x7ACA, 0x7ACA, 0x9BED, 0xC550, 0xCDB1, 0xC550, 0xC570, 0xD5F3, 0xA48E, 0x1882, 
-0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xA3EE, 0x0000, 0xC50F, 0x8B6B, 0x8B6B, 0xC571, 0xCDD2, 
-0xC571, 0xCDB2, 0xBD30, 0xBD0F, 0xA46D, 0x1061, 0xC42E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 
-0x7B0B, 0x62A7, 0xDE13, 0xE694, 0xDE33, 0xDE13, 0xCDB1, 0xCD91, 0xB4CE, 0xAC6D, 0xBD51, 0x6AC9, 0x93AD, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xBC2E, 0x0000, 0xDE13, 0x9BED, 0x8BAC, 0x8B6C, 0xB4CF, 0xD5F2, 0xBD0F, 0x9C2C, 
-0xC570, 0xD5D2, 0x0000, 0xBC2E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x5227, 0x838A, 0x3063, 
-0x2802, 0x0800, 0x834B, 0xDE53, 0xBCEF, 0x9BEB, 0xA44C, 0xC550, 0x41A5, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x2903, 0x2842, 0x3884, 0x38C4, 0xAC6E, 0xB4EF, 0x8369, 0xA42C, 0xA46C, 0xCD91, 0xDE33, 0x20A1, 
-0x9BEE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x2944, 0x1821, 0x9BED, 0xE674, 0x5267, 
-0x2902, 0xB48D, 0xA46D, 0xCD91, 0xCD91, 0xDE12, 0x20E2, 0x9BCE, 0xC40E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44E, 0x3145, 0x0000, 0x1061, 0x5226, 0xA44C, 0xA42C, 0xA44C, 0xCD91, 0xC591, 0xD5D1, 0xAD15, 0x4A2B, 0x2903, 0x18A2, 
-0x72CA, 0xC40D, 0xC40E, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xC42E, 0x6289, 0x3122, 0xBCCD, 0xA44C, 0xC550, 0xCD91, 
-0xCDB0, 0xAD14, 0xB59A, 0x630F, 0x18E6, 0x2968, 0x3187, 0x5207, 0x4A07, 0x3965, 0xC44E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC42E, 0x6AA9, 0x72CA, 0x834B, 0x8B6C, 
-0x41E9, 0x4A28, 0xB4CD, 0xC550, 0xCDB1, 0xCD90, 0xAD14, 0x9CB7, 0x7392, 0x528D, 0x4A4C, 0x528D, 0x420B, 0x18C5, 0x18E5, 0x18C5, 
-0x4A08, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x6ACA, 0x832C, 
-0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC44F, 
-0x832B, 0x834C, 0x0863, 0x0863, 0x0863, 0x0001, 0x526A, 0xB4F1, 0xC54F, 0xD5D1, 0xCD91, 0xAD14, 0x9476, 0xC63C, 0x6B50, 0x31AA, 
-0x4A4C, 0x422C, 0x4A4C, 0x4A6D, 0x4A6D, 0x52AE, 0x0000, 0xB42F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB44F, 0x9BCE, 0xAC0E, 0x730B, 0x2902, 0x3122, 0x41A5, 0xA3EE, 0x9BCE, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x5A69, 0x0000, 0x0863, 0x528E, 0x52AE, 0x4A6D, 0x5AF1, 0xB532, 0xE651, 0xC592, 0xB533, 
-0xAD14, 0x9497, 0xAD59, 0xA537, 0x5AEF, 0x39EB, 0x422C, 0x424C, 0x4A4C, 0x4A4C, 0x422C, 0x4A4C, 0x18C5, 0x7B2C, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC2F, 0x49E6, 0x20E1, 0x1061, 0x7B49, 0xFEF5, 0xEE74, 0xCDB1, 0x20E2, 0x1081, 0xA40E, 
-0xBC4F, 0xB44F, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0xBC4F, 0x6289, 0x0842, 0x5AEF, 0x4A6D, 0x422C, 0x39EA, 
-0x39EA, 0x8435, 0xBD76, 0xC571, 0xAD14, 0x8C78, 0x9497, 0xAD58, 0xD6DD, 0x52AE, 0x31AA, 0x4A4C, 0x424C, 0x422B, 0x39EA, 0x3A0B, 
-0x422C, 0x422C, 0x5ACF, 0x0000, 0x9BAD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x20E3, 0x8BAB, 0xB4EF, 0xCD91, 0xD5D2, 
-0xC571, 0xC571, 0xCD71, 0xDE13, 0xEE94, 0x2924, 0x0000, 0x0000, 0x72EB, 0xC44E, 0xC46F, 0xC46F, 0xC46F, 0xC44F, 0x41A6, 0x0000, 
-0x2126, 0x52AE, 0x422C, 0x422C, 0x3A0B, 0x2967, 0x31A9, 0x8C54, 0xA518, 0x9497, 0x9CD7, 0xA4F7, 0xAD38, 0xCE7C, 0xB5D9, 0x5ACE, 
-0x3A0B, 0x422C, 0x4A4C, 0x39EA, 0x2126, 0x2967, 0x422C, 0x424C, 0x4A6D, 0x0842, 0x8B8D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x1061, 0xACCE, 0x41C5, 0x18A2, 0x5A47, 0xBD0F, 0xD5F2, 0xBD0F, 0x93EB, 0xC571, 0xCD91, 0x62ED, 0x3A0C, 0x528E, 0x2947, 0x0840, 
-0x0841, 0x0841, 0x0841, 0x0841, 0x31A9, 0x4A6D, 0x424C, 0x422C, 0x4A4C, 0x3A0B, 0x2967, 0x422C, 0x420B, 0xAD78, 0xBDDA, 0x9476, 
-0xAD59, 0xCE7C, 0xCE7C, 0xC61B, 0x4A6D, 0x420B, 0x422C, 0x422C, 0x4A4C, 0x39EA, 0x2126, 0x2988, 0x422C, 0x424C, 0x422C, 0x528E, 
-0x0842, 0x834B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1081, 0x0841, 0xBC4F, 0xC40D, 0x7B2B, 0x41C4, 0xEED5, 0x9C2D, 0x1061, 0xA44C, 
-0x5ACD, 0x422C, 0x424C, 0x4A4C, 0x422B, 0x39EB, 0x39CA, 0x2126, 0x2126, 0x1926, 0x39EB, 0x4A4C, 0x424C, 0x4A4C, 0x3A0B, 0x2147, 
-0x2967, 0x420B, 0xAD58, 0xCE7C, 0xC63B, 0xC61B, 0xC63B, 0xC65B, 0xCE5C, 0xC61B, 0x528D, 0x420B, 0x422C, 0x422C, 0x4A4C, 0x39EA, 
-0x2126, 0x2988, 0x422C, 0x424C, 0x422C, 0x528E, 0x0021, 0x8B6C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0xC44F, 0xC40D, 0x938D, 
-0x838B, 0x7329, 0x0000, 0x5227, 0xBC6F, 0x1081, 0x0000, 0x31CA, 0x52AE, 0x4A4C, 0x422C, 0x4A4C, 0x4A4C, 0x3A0B, 0x2147, 0x2146, 
-0x39EA, 0x4A4D, 0x4A6D, 0x420B, 0x2988, 0x2967, 0x2967, 0x420B, 0xB5B9, 0xCE9C, 0xC65B, 0xC65B, 0xC65B, 0xC63B, 0xCE7C, 0xCE7C, 
-0x52AD, 0x420B, 0x422C, 0x422C, 0x424C, 0x424C, 0x39EA, 0x2967, 0x4A4C, 0x424C, 0x422C, 0x4A4C, 0x420B, 0x2105, 0x93AD, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41A6, 0x0000, 0x836C, 0xBC2E, 0xC46F, 0xC40D, 0xBC4F, 0xBC4F, 0x2945, 0x0000, 0x2127, 
-0x5AEF, 0x4A6D, 0x422C, 0x424C, 0x39EA, 0x39EA, 0x4A6D, 0x420B, 0x3A0B, 0x10C4, 0x0000, 0x18C3, 0x2147, 0x420B, 0xB599, 0xCE7C, 
-0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xBDDA, 0x6B50, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422B, 0x2988, 0x2967, 0x31C9, 0x4A4C, 
-0x4A4C, 0x422C, 0x52AE, 0x0842, 0x6288, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC70, 0x8B8D, 0xC46F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0xAC0E, 0x5A69, 0x0000, 0x18C5, 0x5ACF, 0x4A8D, 0x528E, 0x5ACF, 0x10A4, 0x0000, 0x0000, 0x5248, 
-0x9BCD, 0x0000, 0x39EA, 0x420B, 0xAD99, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xB599, 0x39CA, 0x422B, 0x422C, 0x4A4C, 0x4A6D, 
-0x420B, 0x2968, 0x2147, 0x2146, 0x0862, 0x31A9, 0x4A4C, 0x4A4C, 0x4A4C, 0x31A9, 0x39C7, 0xAC0E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x834B, 0x6AEA, 0x0842, 0x0863, 
-0x0863, 0x0862, 0x730B, 0x9BCD, 0x832B, 0xC44F, 0xC44E, 0x0000, 0x4A4C, 0x422C, 0xAD99, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 
-0xB5B9, 0x422C, 0x422C, 0x424C, 0x39EA, 0x39EA, 0x2988, 0x2126, 0x2967, 0x2147, 0x1082, 0x1083, 0x2988, 0x422C, 0x422C, 0x52AE, 
-0x18C5, 0x2923, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xC40D, 0xC40D, 0xC44F, 0x5A27, 0x72EA, 0x72EA, 0x6268, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x422C, 0x422B, 
-0xAD99, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xB5B9, 0x422C, 0x422C, 0x4A4C, 0x2988, 0x1905, 0x2967, 0x3188, 0x2146, 0x2968, 
-0x2988, 0x0000, 0x10A3, 0x422B, 0x4A4D, 0x4A6D, 0x2988, 0x41C7, 0xBC4F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 
-0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x422C, 0x39EB, 0xAD98, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xB5B9, 0x422C, 0x422C, 0x4A4C, 
-0x31C9, 0x2967, 0x3A0A, 0x422C, 0x2967, 0x2147, 0x2126, 0x5228, 0x2966, 0x31A9, 0x424C, 0x424C, 0x528E, 0x2968, 0x1061, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0000, 0x424C, 0x4A8D, 0xB599, 0xCE7C, 0xC63B, 0xC63B, 
-0xC63B, 0xCE7C, 0xB5B9, 0x422C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x424C, 0x4A4C, 0x422B, 0x1905, 0x18A2, 0xC42E, 0x5A68, 0x0042, 
-0x39EA, 0x422C, 0x4A4C, 0x3189, 0x2904, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0000, 
-0x4A8D, 0xBDFA, 0xCE5C, 0xC65B, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xB5B9, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x4A4C, 
-0x420B, 0x1905, 0x18A2, 0xC42E, 0x5A68, 0x0862, 0x2988, 0x2147, 0x31A9, 0x4A4D, 0x39EA, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x18C3, 0x39EA, 0x4A8D, 0xC61B, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xC63B, 0x9475, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x420B, 0x1905, 0x18A2, 0xC44F, 0xC42E, 0x6AAA, 0x0042, 0x2967, 0x31A8, 0x4A6D, 
-0x39EA, 0x0861, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x0000, 0x4A6D, 0x4A6D, 0xBDFA, 0xCE5C, 0xC63B, 
-0xC63B, 0xCE5C, 0xBDFA, 0xA518, 0x8C55, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422C, 0x1905, 0x1882, 0xC44F, 
-0xC40D, 0x7B0B, 0x0021, 0x2967, 0x2988, 0x4A6D, 0x39EA, 0x1061, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xB44F, 
-0x0000, 0x4A4D, 0x4A6D, 0xC63B, 0xCE7C, 0xC63B, 0xC63B, 0xCE7C, 0xB599, 0x8C56, 0x8C35, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x4A4D, 0x422B, 0x2988, 0x18E5, 0x1882, 0xC44F, 0xC40D, 0x7B0A, 0x0021, 0x31A9, 0x420B, 0x4A6D, 0x420B, 0x0000, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x62AA, 0x2126, 0x422C, 0x39EB, 0xA538, 0xCE5C, 0xCE7C, 0xC65B, 0xC65B, 0xBDFA, 0xB599, 
-0xA517, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422B, 0x2988, 0x2147, 0x2968, 0x1082, 0xC44F, 0xC40D, 0x832B, 0x0000, 0x39EA, 
-0x4A6D, 0x39EA, 0x3167, 0x9BCE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x0000, 0x5ACF, 0x4A6D, 0x7BD2, 0x8C55, 
-0xB579, 0xB5BA, 0xBDFB, 0xC65B, 0xC65B, 0xD6BD, 0xBDDA, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x420B, 0x2967, 0x2126, 0x39EB, 0x39EB, 
-0x1882, 0xC44F, 0xC44F, 0x5228, 0x0862, 0x31C9, 0x4A8D, 0x2968, 0x2903, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0x7B2B, 0x10A4, 0x420C, 0x5ACE, 0xD6DD, 0xAD58, 0x9496, 0x8C35, 0xB599, 0xCE7C, 0xC63B, 0xCE7C, 0xB5B9, 0x422C, 0x422C, 0x422C, 
-0x4A4C, 0x31C9, 0x2147, 0x39CA, 0x4A6D, 0x39CA, 0x18A2, 0xC42E, 0x41A5, 0x0042, 0x31C9, 0x39EA, 0x528D, 0x3188, 0x18A2, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6AA9, 0x0842, 0x52AE, 0x422C, 0x7391, 0xCE7C, 0xCE9C, 0xAD59, 0x9CB7, 0xB5BA, 0xCE7C, 
-0xC63B, 0xCE7C, 0xB5B9, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x4A4C, 0x4A4C, 0x39CA, 0x18A2, 0xC42E, 0x6268, 0x0862, 
-0x420B, 0x4A6D, 0x422C, 0x3188, 0x5207, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0B, 0x0842, 0x422C, 0x6B50, 0xCE7C, 
-0xC61B, 0xC61B, 0xC61B, 0xC63B, 0xC65B, 0xC65B, 0xC65B, 0xCE7C, 0xB5B9, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 
-0x4A4C, 0x39CA, 0x18A2, 0xC42E, 0x5A68, 0x18E5, 0x4A6D, 0x4A6D, 0x2106, 0x49E6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6AC9, 0x0862, 0x52AF, 0x422B, 0x39E9, 0x39E9, 0x39E9, 0x2967, 0xA537, 0xDEFE, 0xCE9C, 0xCE9C, 0xD6BD, 0xBDFA, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x39CA, 0x18A2, 0xC42E, 0x5A48, 0x18C5, 0x528E, 0x4A6D, 0x2106, 0x49E6, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x834C, 0x0842, 0x2988, 0x2126, 0x2126, 0x2126, 0x1906, 0x3A0A, 
-0x4A8C, 0x4A6C, 0x4A6C, 0x4A6B, 0x4A6C, 0x4A4C, 0x4A4C, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x420B, 0x0000, 0x41A6, 
-0x9C2D, 0x4A6A, 0x0886, 0x3A0B, 0x2106, 0x2903, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xAC0E, 0x0000, 
-0x2988, 0x2988, 0x2968, 0x2967, 0x2967, 0x1906, 0x18E5, 0x1906, 0x1905, 0x1905, 0x2127, 0x31C9, 0x31A9, 0x2988, 0x422B, 0x4A6D, 
-0x4A4C, 0x52AE, 0x3189, 0x18C3, 0xC46F, 0x1061, 0x9C2C, 0xBD31, 0x942E, 0x4A28, 0x4A08, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x4A07, 0x10A4, 0x2147, 0x18E5, 0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x2147, 
-0x18E5, 0x18E5, 0x2146, 0x2146, 0x3188, 0x31CA, 0x39CA, 0x2147, 0x41E8, 0xAC2E, 0xAC0E, 0x732A, 0xACCF, 0xD5F2, 0xFF56, 0x5A66, 
-0x49C6, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6AA9, 0x0000, 0x39EA, 0x2106, 0x0842, 0x1063, 0x1905, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18C5, 0x1062, 0x1062, 0x2147, 0x2967, 0x2147, 0x2146, 0x2967, 0x0021, 0x6AA9, 0xC40D, 
-0x0020, 0xBD50, 0xDE13, 0xD5D2, 0x8BCB, 0x6ACA, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x5A69, 
-0x0862, 0x2988, 0x2126, 0x10A4, 0x1063, 0x1063, 0x1905, 0x2967, 0x2968, 0x2967, 0x18E5, 0x1062, 0x1083, 0x18C4, 0x2147, 0x2967, 
-0x2967, 0x2967, 0x2968, 0x10A4, 0x4A08, 0xBC6F, 0x4A06, 0xB4EE, 0xCDB2, 0xDE33, 0x5A66, 0x7B0B, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41A5, 0x0022, 0x31A9, 0x2967, 0x2967, 0x2147, 0x18A4, 0x1083, 0x1063, 0x1905, 0x2967, 0x10A4, 
-0x0821, 0x1083, 0x10A4, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x29A8, 0x10C4, 0x0840, 0xD5D1, 0x8369, 0xACAE, 0xCDB1, 
-0xF6D5, 0x5A46, 0x41A6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6268, 0x0842, 0x2988, 0x2967, 0x2967, 0x2967, 
-0x2147, 0x10A3, 0x1083, 0x1083, 0x1083, 0x18A2, 0x20E3, 0x1083, 0x10A4, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 
-0x18E5, 0x1081, 0x8BAA, 0x20E3, 0x6AC8, 0xB4EE, 0xD5D2, 0x5A67, 0x72CA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6268, 0x0842, 0x2988, 0x2967, 0x2967, 0x2146, 0x1083, 0x1083, 0x1083, 0x18A4, 0x0000, 0xA3EE, 0xBC4F, 0x0000, 0x18A4, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x2105, 0x0000, 0x18C2, 0xC46F, 0x5A48, 0x0000, 0x0000, 0x836C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x6ACA, 0x18E4, 0x2147, 0x2967, 0x2967, 0x2967, 0x2147, 0x1083, 0x1083, 0x18C4, 0x0000, 
-0x8B6C, 0xC40D, 0xB44F, 0x0000, 0x18C5, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x10C4, 0x2903, 0xBC4F, 0xC40D, 
-0xC44F, 0xBC4F, 0xBC4F, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x2903, 0x1083, 0x2988, 0x2147, 0x2967, 
-0x2126, 0x18A4, 0x1083, 0x18A4, 0x0000, 0x8B6C, 0xC40E, 0xC40D, 0xC44E, 0x9BCE, 0x0020, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2968, 0x10A4, 0x3165, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x3985, 0x1083, 0x2988, 0x2967, 0x2988, 0x2126, 0x1083, 0x1063, 0x0000, 0x836C, 0xC42E, 0xC40D, 0xC42E, 0xC40D, 0xBC4F, 
-0x0000, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x10A4, 0x3164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xA40E, 0x2945, 0x1905, 0x2967, 0x2968, 0x2147, 0x18C4, 0x0862, 0x1082, 0x8B6C, 
-0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC46F, 0x7B2B, 0x18C4, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x1906, 0x2925, 
-0xA40E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x0020, 0x18E5, 0x2988, 0x2967, 
-0x2147, 0x18C4, 0x1083, 0x0841, 0x1081, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44E, 0x0020, 0x2126, 0x2988, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x1906, 0x0000, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44F, 0x18A2, 0x1905, 0x2167, 0x2147, 0x18E5, 0x1083, 0x0862, 0x10A3, 0x6ACA, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44F, 0x4A07, 0x10A4, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x1906, 0x1882, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x3985, 0x18C4, 0x31A8, 0x3A08, 0x31A8, 0x2106, 0x0021, 0x41A6, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x41C6, 0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2126, 0x10A2, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x3145, 
-0x83AB, 0xE653, 0x734C, 0x10E6, 0x2126, 0x0841, 0x3165, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0x49C6, 0x0883, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x10A2, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x5A68, 0x6AC7, 0xBCCE, 0x62CA, 0x10E6, 0x0821, 0x20C3, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x3985, 0x0862, 0x31A9, 0x2988, 0x2126, 0x1083, 0x18C4, 0x2147, 0x0000, 
-0xC46F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5208, 0x5204, 0xD58F, 0x836B, 
-0x10C5, 0x0821, 0x20E3, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x3986, 0x0000, 
-0x18C4, 0x18C4, 0x1063, 0x1083, 0x2147, 0x1905, 0x3165, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x5A48, 0x20E3, 0x62CA, 0x4209, 0x1906, 0x0821, 0x20E3, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x3144, 0x0000, 0x18C4, 0x10A4, 0x2126, 0x2967, 0x29A8, 0x0000, 0xB42F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3985, 0x0021, 0x2148, 0x2127, 0x2126, 0x0821, 0x20E3, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC46F, 0x5208, 0x0000, 0x18C4, 0x2988, 
-0x2967, 0x2967, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2E, 0x3166, 
-0x18E5, 0x2988, 0x2126, 0x0821, 0x20E3, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xC40D, 0xAC0E, 0x0000, 0x2105, 0x2988, 0x2967, 0x2967, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x0000, 0x31A9, 0x2126, 0x0821, 0x20E3, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x2904, 0x0862, 0x2146, 0x2967, 0x2967, 0x0000, 0xB44F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0B, 0x0020, 0x29A8, 0x2106, 0x0842, 
-0x20C3, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 
-0x0000, 0x10A4, 0x2967, 0x2968, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x834B, 0x0841, 0x2126, 0x1063, 0x1083, 0x1063, 0x10A2, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0020, 0x10A4, 0x2967, 0x2968, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x938D, 0x0000, 0x1083, 0x1083, 0x0863, 0x0841, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0020, 0x2967, 0x2988, 
-0x0000, 0xBC4F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x0000, 
-0x18A4, 0x28C3, 0x20A3, 0x0861, 0xC44F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC46F, 0x0020, 0x10A4, 0x2967, 0x2126, 0x2104, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xA40E, 0x0000, 0x28E4, 0x30E3, 0x28C3, 0x2082, 0x5A48, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 0x0842, 0x10A4, 0x3188, 0x0000, 0x9BCD, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x41A6, 0x1041, 0x30E4, 0x28C3, 0x28E3, 0x30E4, 
-0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC44F, 0x0020, 
-0x18E5, 0x18E5, 0x2168, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x28E3, 
-0x0800, 0x3925, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC46F, 0xA3EE, 0x93CD, 0x20A2, 0x3987, 0x39A7, 0x39A7, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBC6F, 0xBC4F, 0x2903, 0x0820, 0x3924, 0x28C3, 0x28C3, 0x30E4, 0x30E4, 0x30E4, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0xB44F, 0xC44F, 0x7B0B, 0x0000, 0x1020, 0x59E7, 0x51A5, 0x51A5, 0x59C6, 0x0000, 
-0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xBC4F, 0x0861, 0x0000, 0x2082, 0x3104, 0x28C3, 0x28C3, 0x28C3, 0x20A3, 
-0x20A3, 0x20A3, 0x3165, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x3124, 0x0000, 0x0000, 0x20A2, 0x6207, 
-0x51C6, 0x49A5, 0x49A5, 0x49A5, 0x51C6, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0820, 0x28C3, 0x30E4, 
-0x28C3, 0x28E3, 0x28C3, 0x30E4, 0x20A2, 0x0000, 0x0000, 0x0841, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0x2103, 0x30E3, 0x59C6, 0x51A6, 0x51A6, 0x49A5, 0x51A5, 0x49A5, 0x49A5, 0x49A5, 0x51C6, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_left_5.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_left_5_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB42F, 
-0x20E3, 0x41A6, 0x41A6, 0x3985, 0x3965, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9BEE, 0x5228, 0x49E7, 0x2904, 0x2924, 0x2924, 0x2924, 0x2924, 0x41A6, 0xC44E, 0xC40D, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x2904, 0x1061, 0x41A6, 0x6AEB, 0x62AA, 0x62AA, 0x62AA, 
-0x62AA, 0x20C3, 0x5248, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xA40E, 0x1082, 0x41C7, 
-0x6AEB, 0x5A69, 0x4A08, 0x4A08, 0x4A29, 0x5A69, 0x5A69, 0x730C, 0x0000, 0xAC0E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44F, 0x0020, 0x41C7, 0x5A6A, 0x49E8, 0x6ACA, 0x83AC, 0x838C, 0x7B4B, 0x5A69, 0x5A69, 0x5A8A, 0x20C3, 0x834C, 
-0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x18A2, 0x5A69, 0x734B, 0x62AA, 0xA48F, 0xE653, 0xDE12, 
-0xBD50, 0x5229, 0x5269, 0x5249, 0x6AEB, 0x0000, 0x834C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1882, 
-0xACAE, 0xDDF2, 0xCDD2, 0xCD91, 0xC550, 0xCD91, 0xB510, 0x62AA, 0x5A69, 0x62AA, 0x730B, 0x0820, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1882, 0xA48E, 0xD5D2, 0xCDB2, 0xB4CE, 0x9BEB, 0xACAE, 0xCDB2, 0xBD30, 0x5A89, 0xACCF, 
-0xE653, 0x3123, 0x938D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x0841, 0xB4EF, 0xBD2F, 0x9C0C, 0x9BEB, 
-0x9BEB, 0xB4CE, 0xCDB2, 0xC551, 0x5269, 0xB4F0, 0xEE74, 0x3143, 0x938D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xBC4F, 0x4A07, 0x72C7, 0xDE73, 0xFFFA, 0xB4CF, 0x6A08, 0xD5F2, 0xC570, 0x8B8B, 0xBD10, 0xE653, 0x3143, 0x938D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x2924, 0x62A6, 0xA42E, 0x938D, 0x938C, 0xA44E, 0xCDB1, 0xC571, 
-0xBD2F, 0xCD91, 0xE653, 0x3122, 0x938D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x18A2, 0x7307, 
-0xA3EC, 0x7269, 0xB4CF, 0xE6B4, 0xC571, 0xCD91, 0xD5D2, 0xB4EF, 0xDE12, 0x20C2, 0x938D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x9BCE, 0x5227, 0xBD4F, 0xD5D2, 0x8B8C, 0xA44E, 0xDE13, 0xCD91, 0xBD0F, 0x9C0B, 0xCD70, 0x7B49, 
-0x730B, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41A6, 0x5226, 0x7ACA, 0x0800, 0x4926, 
-0xACAF, 0xBD2F, 0x9C0B, 0x9C0B, 0xBD0F, 0xFEF6, 0x4184, 0x5228, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x834B, 0x1021, 0x3063, 0x38A4, 0x3084, 0x5186, 0xA44C, 0xA42C, 0x9C0B, 0xBD2F, 0xE653, 0x6287, 0x6ACA, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x0800, 0x40A5, 0x59A6, 0xA44C, 0x9C0C, 0xA42C, 0x9C0B, 
-0xBD2F, 0xCDB1, 0xDE13, 0x6AE8, 0x5207, 0xC42E, 0xC42E, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6289, 0x41C4, 
-0xDDF2, 0x6AC8, 0x0000, 0x18C2, 0x9BEB, 0xA42C, 0xBD2F, 0xCDB1, 0xCDB1, 0xCDB1, 0x83AB, 0x20E3, 0x2903, 0x2103, 0xC44F, 0xC40D, 
-0xC42E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x834C, 0x0000, 0x6AC9, 0xC44F, 0x0020, 0x93CB, 0x9C0B, 0xBD0F, 0xCDB1, 0xC571, 0xD5D1, 
-0xBD51, 0x5AEF, 0x2968, 0x2968, 0x49E7, 0x5207, 0x2924, 0xB44F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC42E, 0xBC2F, 0xBC6F, 0x72EA, 0x6AE8, 
-0x9C0B, 0xB4EF, 0xC571, 0xCD91, 0xCDB0, 0xBD51, 0xAD37, 0xA518, 0x4A6D, 0x4A6D, 0x2127, 0x18C5, 0x18C5, 0x2105, 0xB42E, 0xC40D, 
-0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 
-0xC40D, 0xC46F, 0x9BCD, 0x7B2C, 0x1082, 0xAC8D, 0x9C0B, 0xC550, 0xCDB2, 0xCD90, 0xC572, 0xA4F6, 0x8436, 0x6330, 0x422C, 0x422C, 
-0x4A6D, 0x4A6D, 0x52AE, 0x2127, 0x2105, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA40E, 0xA3EE, 0xA3EE, 0xA3EE, 0x93AD, 0xC44F, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x49E7, 0x0000, 0x18E6, 0x8413, 0xB4CE, 0xB4AE, 0xC570, 0xD5B0, 0xC572, 
-0x9CB5, 0xA53A, 0x9CF6, 0x31A9, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x52CE, 0x18C5, 0x2924, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0000, 0x2902, 0x2902, 0x20C2, 0x1060, 0x8B8C, 0xB42F, 0xC46F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x3985, 0x1084, 0x528E, 0x5AF0, 
-0xB578, 0xD5D1, 0xD5B1, 0xBD52, 0xBD52, 0x9CD5, 0x94D8, 0xB599, 0x8C74, 0x39EB, 0x4A4C, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x4A6D, 
-0x18C5, 0x5227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41A5, 0xACCE, 0xB4CF, 0xD5B1, 
-0xF6D5, 0x62C8, 0x0000, 0x62A9, 0xC42E, 0xC44F, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 
-0xC44F, 0x3165, 0x18E6, 0x528E, 0x4A4C, 0x6B71, 0xA4F7, 0xC572, 0xC572, 0x9CB6, 0x9497, 0x94B7, 0xCE5C, 0x9CF6, 0x2969, 0x422C, 
-0x420B, 0x420B, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x2127, 0x4A07, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44F, 0x20E3, 0x18C2, 0x7B29, 0xBD2F, 0xCDB2, 0xE653, 0x8BCB, 0x0020, 0x0840, 0x1882, 0xC44F, 0xC42E, 0xC44E, 
-0xC44E, 0xC44E, 0xC44E, 0xC44E, 0xC44F, 0x18C3, 0x0820, 0x31A9, 0x4A6D, 0x31AA, 0x7C13, 0xCE7C, 0x9CB6, 0x9CB7, 0x9CB7, 0x9CD7, 
-0x94B6, 0xB5DA, 0xD6BD, 0x8C95, 0x39CA, 0x420B, 0x2147, 0x2147, 0x420B, 0x4A4C, 0x422C, 0x422C, 0x4A6D, 0x2968, 0x2924, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xC42E, 0x41C6, 0x5A46, 0xC570, 0xD5D2, 0xC571, 
-0xBD2F, 0xACCF, 0x420B, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x39EA, 0x3A0B, 0x4A4C, 0x31A9, 0x2127, 
-0x7BF3, 0xDEDE, 0xBDDA, 0x9496, 0x9496, 0xBDFA, 0xC63B, 0xD6BD, 0x8C74, 0x39EB, 0x422C, 0x420B, 0x2147, 0x2147, 0x420B, 0x4A4C, 
-0x422C, 0x422C, 0x4A6D, 0x2968, 0x2923, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 
-0x5A68, 0x0000, 0x838B, 0xF6B5, 0xCD70, 0xC52F, 0xBD51, 0x5ACD, 0x4A4C, 0x31A9, 0x3188, 0x31A9, 0x2126, 0x10C4, 0x10C5, 0x1905, 
-0x31A9, 0x4A4C, 0x4A6D, 0x31A9, 0x31C9, 0x31AA, 0x7BD2, 0xD6DD, 0xC63B, 0xBDFA, 0xBDFA, 0xC63B, 0xC65B, 0xD6DD, 0x8433, 0x3189, 
-0x4A4C, 0x420B, 0x2147, 0x2147, 0x2967, 0x420B, 0x4A6D, 0x4A4C, 0x4A6D, 0x2947, 0x3124, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x6ACA, 0x8BCB, 0xB4EF, 0x4A06, 0x1881, 0x0820, 0x5204, 0xBD10, 0x3A0D, 0x422C, 0x4A4C, 
-0x4A4D, 0x4A6D, 0x424C, 0x31A9, 0x2126, 0x2988, 0x4A6D, 0x424C, 0x4A6D, 0x2968, 0x39CA, 0x39EB, 0x7BD2, 0xD6BD, 0xC65B, 0xCE5B, 
-0xCE5C, 0xC65B, 0xC63B, 0xD6DD, 0x8454, 0x31AA, 0x422C, 0x422C, 0x39EA, 0x2967, 0x2146, 0x2988, 0x2988, 0x39CA, 0x4A6D, 0x420B, 
-0x3188, 0x72CA, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x0000, 0x3963, 0x49C4, 0x8B8D, 0xABEE, 
-0xAC0E, 0x834C, 0x1040, 0x0843, 0x4A6D, 0x528E, 0x4A4C, 0x422C, 0x4A4C, 0x422B, 0x31C9, 0x39EA, 0x4A6D, 0x4A4C, 0x3A0B, 0x2988, 
-0x39EA, 0x39CA, 0x7BD2, 0xD6BD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6DD, 0x8454, 0x31AA, 0x422C, 0x4A4C, 0x4A6D, 0x2968, 
-0x2147, 0x2167, 0x31A9, 0x420B, 0x424C, 0x4A6D, 0x39EB, 0x0020, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0x93AD, 0x8B4C, 0x72EA, 0xC44E, 0xC40D, 0xC40D, 0xC44F, 0x7B0B, 0x836C, 0x1083, 0x0862, 0x39EB, 0x52AE, 0x4A4C, 0x422C, 
-0x4A6D, 0x4A6D, 0x3A0B, 0x3A0A, 0x0021, 0x0841, 0x39C9, 0x39EB, 0x7BD2, 0xD6BD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6DD, 
-0x8454, 0x31AA, 0x422C, 0x422C, 0x39CA, 0x2967, 0x2967, 0x18C4, 0x2947, 0x422C, 0x424C, 0x4A4C, 0x39CA, 0x1081, 0xC44E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40E, 0xC40D, 0xC40D, 0xC42E, 
-0x72EA, 0x72EA, 0x2947, 0x10A4, 0x31A9, 0x52AE, 0x39EB, 0x10A4, 0x0042, 0x0862, 0x72CA, 0x20C2, 0x2126, 0x3A0B, 0x7BD2, 0xD6BD, 
-0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6DD, 0x8454, 0x31AA, 0x4A4C, 0x420B, 0x2126, 0x2147, 0x2988, 0x0020, 0x0862, 0x39EA, 
-0x4A6D, 0x4A4C, 0x39EB, 0x2105, 0xAC2F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x41A5, 0x39A7, 0x2968, 0x3187, 0x5207, 0x4A07, 0x5207, 
-0xC40D, 0x72CA, 0x10A4, 0x3A0B, 0x7BD2, 0xD6BD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6DD, 0x8454, 0x31AA, 0x4A4C, 0x422B, 
-0x2988, 0x2988, 0x2988, 0x1083, 0x1083, 0x3188, 0x424C, 0x424C, 0x4A4C, 0x4A4D, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA3EE, 0x0000, 0x834C, 0xC40D, 0xC42E, 0xC42E, 0xC40D, 0x5A48, 0x18C5, 0x39EB, 0x73D2, 0xD6BD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 
-0xC63B, 0xD6DD, 0x8454, 0x31AA, 0x422C, 0x422C, 0x4A4C, 0x4A4C, 0x2988, 0x2988, 0x0862, 0x0861, 0x31C9, 0x424C, 0x4A4C, 0x422B, 
-0x0020, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC44E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A48, 0x18C5, 0x39EB, 
-0x7BD2, 0xD6DD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6DD, 0x8C54, 0x31AA, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x2988, 0x2968, 
-0x0882, 0x1082, 0x2968, 0x31A8, 0x4A4C, 0x422B, 0x0020, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x5A48, 0x0863, 0x8434, 0xCE5C, 0xC65B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xDEDD, 0x8C54, 0x31AA, 
-0x422C, 0x422C, 0x422C, 0x4A4C, 0x2968, 0x2147, 0x2967, 0x10A3, 0x1082, 0x2968, 0x3188, 0x422C, 0x420B, 0x20E4, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A48, 0x0863, 0x94B6, 0xDEFE, 0xC63B, 0xC63B, 0xC63B, 
-0xC63B, 0xC63B, 0xCE9C, 0xC61B, 0x7391, 0x39CA, 0x422C, 0x422C, 0x422C, 0x422C, 0x420B, 0x2988, 0x2988, 0x10A3, 0x0841, 0x2147, 
-0x2147, 0x422C, 0x4A8D, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A48, 
-0x0863, 0x8C95, 0xD6DD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC65B, 0xB5B9, 0xA518, 0x6B51, 0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x4A6D, 0x31A9, 0x2988, 0x1082, 0x0841, 0x422B, 0x39EA, 0x424C, 0x52AE, 0x0000, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A48, 0x0843, 0x94B5, 0xDEFE, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0x9CF7, 0x9CB7, 
-0x6B71, 0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x31C9, 0x18E4, 0x10A3, 0x31A8, 0x4A6D, 0x4A4C, 0x422C, 0x2126, 0x7B2C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A48, 0x0863, 0x8434, 0xCE7C, 0xCE7C, 
-0xCE5C, 0xC63B, 0xC63B, 0xCE5B, 0xB599, 0xB59A, 0x7BD2, 0x39CA, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x29A8, 0x0020, 0x20E5, 
-0x52AF, 0x422C, 0x4A4C, 0x422B, 0x0020, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x5A68, 0x0863, 0x7372, 0xAD59, 0xBE1B, 0xBDFA, 0xC63B, 0xC63B, 0xC63B, 0xCE5C, 0xDEFE, 0x8C74, 0x31AA, 0x422C, 0x422C, 
-0x422C, 0x4A4C, 0x3188, 0x31A9, 0x1082, 0x18E4, 0x4A8D, 0x422C, 0x4A4C, 0x424C, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x5228, 0x10A4, 0x7BF3, 0xA538, 0x9476, 0x9CD7, 0xC65B, 0xC65B, 0xC63B, 
-0xC63B, 0xD6DD, 0x8454, 0x31AA, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x52AE, 0x18C4, 0x18C4, 0x4A8D, 0x422C, 0x422C, 0x39EA, 
-0x2944, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x3965, 0x2947, 0x39EB, 0x8C74, 
-0xC63C, 0x9496, 0xA518, 0xC65B, 0xC65B, 0xC63B, 0xC63B, 0xD6DD, 0x8454, 0x31AA, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x4A6D, 
-0x18C4, 0x18E4, 0x4A8D, 0x4A4C, 0x39CA, 0x1082, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0x3144, 0x2947, 0x39EB, 0x8C74, 0xDF1E, 0xCE5C, 0xCE5C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6DD, 0x8C54, 0x31AA, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x528E, 0x10A3, 0x2105, 0x4A4D, 0x424C, 0x4A6D, 0x39CA, 0x1061, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3985, 0x2947, 0x528E, 0x4A6C, 0x4A6B, 0x424B, 0x634F, 0xDEFE, 
-0xDEDE, 0xDEDE, 0xDEDE, 0xEF7F, 0x9495, 0x31AA, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x18E4, 0x0042, 0x1906, 0x420B, 0x528E, 0x31A9, 
-0x3145, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x7B2B, 0x2125, 0x2967, 
-0x39EA, 0x2968, 0x1905, 0x10C5, 0x2147, 0x630E, 0x5B0E, 0x5B0E, 0x5B0E, 0x632E, 0x52AD, 0x424C, 0x4A4C, 0x4A4C, 0x4A4D, 0x52AE, 
-0x0000, 0x62E9, 0x5AAB, 0x0065, 0x31AA, 0x18E5, 0x1081, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44F, 0x0840, 0x1905, 0x2988, 0x18E5, 0x18C4, 0x2126, 0x2988, 0x2147, 0x10C5, 0x10C5, 0x10C5, 0x18E5, 0x10C5, 
-0x2947, 0x39EA, 0x31C9, 0x31C9, 0x31A9, 0x2106, 0x5247, 0xCD70, 0xB4F0, 0x7B8C, 0x4A28, 0x2945, 0xB42F, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x18C2, 0x18E5, 0x2988, 0x18C4, 0x0822, 0x10A4, 0x2126, 
-0x2968, 0x2967, 0x2967, 0x2988, 0x2126, 0x18E5, 0x2126, 0x2147, 0x2146, 0x2147, 0x2126, 0x0000, 0xB4EF, 0xDE13, 0xCDB1, 0xFF16, 
-0x7B69, 0x3145, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xB42F, 0x18C3, 
-0x2106, 0x2968, 0x2105, 0x1083, 0x1062, 0x10A4, 0x2147, 0x2967, 0x2967, 0x2126, 0x1083, 0x0842, 0x18E5, 0x2988, 0x2967, 0x2967, 
-0x2147, 0x0000, 0x9C6D, 0xD5F2, 0xCDB2, 0xB4EF, 0x6AC9, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x0000, 0x2147, 0x2967, 0x2967, 0x2988, 0x2126, 0x1083, 0x1063, 0x10A3, 0x2147, 0x2147, 0x0000, 
-0x0841, 0x1083, 0x18E5, 0x2988, 0x2967, 0x2147, 0x2106, 0x20E3, 0xA48E, 0xD5D2, 0xE654, 0x41A4, 0x6AAA, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0820, 0x2147, 0x2967, 0x2967, 0x2967, 0x2968, 
-0x2105, 0x1063, 0x1083, 0x1083, 0x1063, 0x20E3, 0x18A3, 0x1063, 0x18E5, 0x2988, 0x2967, 0x1906, 0x0861, 0xBD30, 0xA44C, 0xB4CE, 
-0xE654, 0x5A87, 0x6AAA, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 
-0x0820, 0x2147, 0x2967, 0x2967, 0x2968, 0x1905, 0x1083, 0x1083, 0x1083, 0x0863, 0x0861, 0xC46F, 0x72EA, 0x0000, 0x1905, 0x2988, 
-0x2967, 0x1906, 0x0840, 0xA44C, 0x20E2, 0x6AA7, 0xCD91, 0xDE33, 0x7309, 0x5A48, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x2924, 0x2126, 0x2967, 0x2967, 0x2947, 0x2988, 0x1905, 0x1062, 0x18A4, 0x0842, 0x1061, 
-0xBC4F, 0xC40D, 0x5227, 0x0000, 0x2126, 0x2988, 0x2967, 0x2147, 0x2126, 0x18A1, 0x18E5, 0x18C3, 0x2902, 0x2103, 0x0000, 0x3145, 
-0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0000, 0x2988, 0x2967, 0x2967, 0x2967, 
-0x2106, 0x10A3, 0x18C4, 0x0021, 0x1081, 0xBC4F, 0xC40D, 0xC40D, 0xC44F, 0x6269, 0x0021, 0x2988, 0x2967, 0x2967, 0x2967, 0x10C4, 
-0x2147, 0x2126, 0x0000, 0x6AA9, 0xBC4F, 0xC490, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 
-0xBC4F, 0x0000, 0x2967, 0x2967, 0x2967, 0x2988, 0x18C4, 0x18A4, 0x0000, 0x18A2, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 
-0x0000, 0x31C9, 0x2947, 0x2967, 0x2967, 0x2988, 0x2967, 0x29A8, 0x0000, 0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x730B, 0x0863, 0x2967, 0x2967, 0x2968, 0x2126, 0x18A4, 0x0001, 0x3965, 0xBC6F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x4A08, 0x10A4, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x0000, 0x93AD, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCD, 0x0000, 0x31C9, 0x2967, 0x2967, 
-0x2126, 0x1083, 0x18A4, 0x0000, 0x834C, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xA3EE, 0x0000, 0x31C9, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2988, 0x0000, 0x9BCD, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAC2E, 0x0000, 0x2147, 0x2127, 0x2967, 0x18C4, 0x1083, 0x0842, 0x18A2, 0xAC2E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xB44F, 0x2104, 0x1906, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x0021, 0x7B0B, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x0000, 0x4229, 0x31C8, 0x2147, 0x2968, 0x18C5, 0x0000, 0xA40E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0000, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x31A9, 0x0021, 0x6AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x20C2, 0xDE13, 
-0xB510, 0x2987, 0x2147, 0x18C5, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 
-0x0000, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x0021, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xAC2F, 0x2922, 0xB4AD, 0x93EB, 0x39C8, 0x10A4, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x0000, 0x2968, 0x2988, 0x2988, 0x18E5, 0x1083, 0x18E5, 0x10C4, 0x7B0B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0000, 0xBCCD, 0xBCCD, 0x39E8, 0x10A4, 
-0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x0000, 0x10A4, 
-0x18E5, 0x1083, 0x0842, 0x2106, 0x0863, 0x41C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBC4F, 0x0000, 0x5A89, 0x5269, 0x3188, 0x18C5, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x0000, 0x0821, 0x18A3, 0x18C4, 0x2967, 0x0862, 0x5A48, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x1907, 0x1907, 0x2967, 0x18C5, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x2904, 0x0021, 0x2126, 0x31A9, 
-0x18E5, 0x3186, 0xAC2F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x2967, 0x2967, 
-0x2967, 0x18C5, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3985, 0x0000, 0x2105, 0x2147, 0x31A9, 0x10A4, 0x1081, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x2967, 0x2967, 0x2968, 0x18E5, 0x0000, 0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x8B8D, 0x18A3, 0x0821, 0x18E5, 0x29A8, 0x10A4, 0x3144, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x2967, 0x2967, 0x2147, 0x1083, 0x0861, 0xAC2F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 
-0x0000, 0x18E5, 0x2968, 0x18C5, 0x2924, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 
-0x2967, 0x2967, 0x18A4, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x730B, 0x0000, 0x1083, 0x18E5, 0x2988, 0x1906, 0x18C3, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x2967, 0x2967, 0x10A4, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x834C, 0x0000, 0x18E5, 0x2988, 
-0x1906, 0x1082, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x2968, 0x2988, 0x18C4, 0x0000, 
-0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x93AD, 0x0000, 0x10A4, 0x18E5, 0x1906, 0x18A2, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 
-0xBC4F, 0x0000, 0x2988, 0x18E5, 0x10A4, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x938D, 0x0000, 0x0843, 0x1084, 0x2147, 0x1905, 0x6289, 0xC46F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44E, 0x5A48, 0x1041, 0x18E5, 0x0863, 0x1083, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B8D, 0x0000, 
-0x3945, 0x2925, 0x2168, 0x2168, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x5207, 0x0000, 0x3104, 0x1883, 0x18A3, 
-0x1083, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x0800, 0x6207, 0x51A6, 0x3967, 0x3166, 0x0020, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0xBC6F, 0xC44F, 
-0x5A48, 0x0000, 0x3925, 0x28C3, 0x30E3, 0x30E3, 0x20A3, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x6AA9, 0x2061, 0x51C6, 0x51A5, 0x51A5, 0x5185, 
-0x0020, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBC4F, 0x18C2, 0x0000, 0x0000, 0x1041, 0x3904, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x30E4, 0x0000, 0xB44F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x41A6, 
-0x1841, 0x5A07, 0x49A5, 0x49A5, 0x51A6, 0x4985, 0x0020, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x18A2, 0x2082, 0x30E4, 0x28E3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 
-0x28C3, 0x28C3, 0x30E4, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x3985, 0x20A2, 0x59C6, 0x49A5, 0x49A5, 0x49A5, 0x51A6, 0x4985, 0x0020, 0xC46F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_left_6.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_left_6_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x49E7, 
-0x3965, 0x41A6, 0x41A6, 0x41A6, 0x41A6, 0x3144, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40E, 0xC40D, 0xC42E, 0x5227, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x72EA, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x6289, 0x1062, 0x5229, 0x5249, 0x5249, 0x5229, 0x5A6A, 
-0x62AA, 0x62CB, 0x5228, 0x18A2, 0x7B0B, 0xC40E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2F, 0x0000, 
-0x9C4F, 0x8BED, 0x8BCD, 0x8BCD, 0x940D, 0x6AEA, 0x4A08, 0x5A69, 0x5A8A, 0x5A8A, 0x1061, 0x836C, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x1060, 0xE653, 0xDE12, 0xDE12, 0xDE12, 0xE653, 0xACCF, 0x62AA, 0x5249, 0x5A69, 0x5A69, 
-0x62CB, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0840, 0xC571, 0xBD2F, 0xBD0F, 0xBD50, 
-0xC571, 0xDE32, 0xA48F, 0x49E8, 0x5249, 0x5249, 0x5A69, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB44F, 0x0820, 0xA44C, 0xAC8D, 0xACAD, 0x93CB, 0xB4CF, 0xDE13, 0x9C2E, 0x4A08, 0x62CA, 0x62AA, 0x5A8A, 0x0000, 0xBC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0000, 0xACAD, 0xF777, 0xFFB9, 0x7AAA, 0x938C, 0xE653, 0x93ED, 0x6AEA, 
-0xD5D2, 0xBD50, 0x62AA, 0x0820, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0820, 0x9C0C, 0x6A49, 
-0x61E8, 0xA40D, 0xC591, 0xD5F2, 0x8BCD, 0x62AA, 0xDE33, 0xC570, 0x18A2, 0xB44F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xB44F, 0x1040, 0xC550, 0xA42D, 0x9C0D, 0xC550, 0xCDB2, 0xCD91, 0xBD10, 0xB4F0, 0xC571, 0x730B, 0x0000, 0xC44F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x1080, 0xEE94, 0xE694, 0xD5F2, 0xCD91, 0xC571, 0xC571, 
-0xCDD2, 0xDE33, 0xA48E, 0x20E4, 0xAC0E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0000, 
-0x832B, 0x832B, 0xCDB1, 0xD5D2, 0xC571, 0xCDB2, 0xC550, 0xC550, 0x942C, 0x1882, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x1801, 0x2022, 0x7B0A, 0xC551, 0xD5D2, 0xC571, 0xA46D, 0xAC8D, 0xB4EF, 0x5247, 
-0xAC2F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x0000, 0x6A48, 0x40C5, 0x2002, 0x9C0D, 
-0xD5D2, 0xAC8D, 0x93CA, 0xAC6D, 0xD5F3, 0xCD91, 0x0000, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBC4F, 0x3985, 0xACAE, 0x30A3, 0x2022, 0x6A67, 0x9C0B, 0xA44C, 0x9C2C, 0xB4AE, 0xD5D2, 0xBD30, 0x2903, 0xB44F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1082, 0x10A2, 0x18C2, 0x1062, 0x6AA8, 0xAC6C, 0xB4AE, 0xCDB2, 
-0xC591, 0xCD91, 0xCDB1, 0x1081, 0xB42F, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC44F, 0xC44F, 
-0xC44F, 0xC42E, 0x72EB, 0x4183, 0xC52F, 0xCDB2, 0xC591, 0xCD91, 0xCDB1, 0xC570, 0x4A06, 0x0841, 0xAC0E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0B, 0x18A1, 0xC52F, 0xCDB2, 0xC591, 0xCD91, 0xCDB0, 0xC5D8, 
-0x528D, 0x2107, 0x39A7, 0x4185, 0x938D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x49E5, 0x93CB, 
-0xCD91, 0xCD91, 0xCD91, 0xCDB1, 0xBD76, 0x6B72, 0x4A6D, 0x528D, 0x31A9, 0x10A4, 0x2105, 0x938C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAC0E, 0x0843, 0x7B2A, 0xDE12, 0xCDB2, 0xCD90, 0xCD91, 0xA4D4, 0x6B72, 0x422C, 0x420B, 0x422C, 0x4A4C, 0x52AE, 
-0x31CA, 0x10A3, 0x9BCD, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xAC2F, 0x1082, 0x1908, 0xA491, 0xDE12, 0xCD90, 0xC571, 0xB555, 0xAD7A, 
-0x422B, 0x420B, 0x424C, 0x422C, 0x422C, 0x422C, 0x4A8D, 0x31CA, 0x0020, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x0020, 0x31CA, 0x52AF, 
-0xA4B0, 0xCDB2, 0xBD53, 0xAD14, 0x94B8, 0x9D16, 0x4A6D, 0x422C, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x39EA, 0x2104, 0xB44F, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44F, 0x18A2, 0x2988, 0x8C56, 0xC594, 0xAD14, 0x8C78, 0x9CF8, 0x9475, 0x31CA, 0x422C, 0x420B, 0x420B, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x4A4C, 0x422C, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x18A2, 0x2968, 0x8C35, 0xA4F8, 0x9CD7, 0x9CB7, 0xB579, 
-0xB5B9, 0x422B, 0x422C, 0x2988, 0x2126, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x4A4C, 0x420B, 0x0820, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x18A2, 
-0x2968, 0x8434, 0x9CB7, 0xAD79, 0xC65B, 0xCE7C, 0xB599, 0x422B, 0x422C, 0x2988, 0x2126, 0x39EA, 0x4A4D, 0x422C, 0x422C, 0x4A4C, 
-0x420B, 0x0820, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x3986, 0x39C9, 0x9CF6, 0xBE1B, 0xBDFA, 0xC63B, 0xC65B, 0xCE9C, 0xAD99, 0x422B, 0x422C, 0x2967, 
-0x2146, 0x2967, 0x39EA, 0x4A6D, 0x4A4C, 0x4A4C, 0x420B, 0x0820, 0xC44F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0000, 0x422C, 0xBDFA, 0xD69D, 0xCE5B, 0xC65B, 
-0xC63B, 0xD6BD, 0xBE1A, 0x420B, 0x422C, 0x420B, 0x2988, 0x2167, 0x2988, 0x2988, 0x31A9, 0x4A4C, 0x422C, 0x3189, 0x49E7, 0xC46F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44F, 
-0x0820, 0x420B, 0xB5B9, 0xCE7C, 0xC63B, 0xC63B, 0xCE7C, 0xB5B9, 0x6B70, 0x422C, 0x422C, 0x4A6D, 0x31C9, 0x10C4, 0x10C4, 0x2988, 
-0x420B, 0x424C, 0x4A4C, 0x528E, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x836C, 0x10A3, 0x420B, 0xB5B9, 0xCE7C, 0xC63B, 0xC63B, 0xD6BD, 0x9CF6, 0x2969, 0x422C, 
-0x422C, 0x4A6D, 0x31CA, 0x0020, 0x0862, 0x31EA, 0x420B, 0x424C, 0x424C, 0x4A4C, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xB44F, 0x0000, 0x2988, 0x39EA, 0xB5B9, 0xCE7C, 
-0xC63B, 0xC63B, 0xD69D, 0xA517, 0x39CA, 0x422C, 0x422C, 0x3A0B, 0x31A8, 0x10C4, 0x1083, 0x1905, 0x2988, 0x4A4C, 0x424C, 0x4A4C, 
-0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 
-0xA3EE, 0x0020, 0x31A9, 0x5B0F, 0xBDDA, 0xCE7C, 0xC63B, 0xC63B, 0xD69D, 0xA517, 0x39CA, 0x422C, 0x424C, 0x2967, 0x2146, 0x31A9, 
-0x10A3, 0x0021, 0x31C9, 0x4A4C, 0x424C, 0x4A4C, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x0000, 0x31A9, 0x52AE, 0xC65C, 0xCE5C, 0xC63B, 0xC63B, 0xC63B, 0xD69D, 0xA517, 
-0x39CA, 0x422C, 0x424C, 0x3188, 0x2967, 0x2988, 0x1083, 0x0841, 0x31C9, 0x422C, 0x424C, 0x4A4C, 0x0021, 0xAC2F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x0000, 0x2988, 0x52AD, 0xC63B, 
-0xCE5C, 0xC63B, 0xC63B, 0xC63B, 0xD69D, 0xA517, 0x39CA, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x39EA, 0x0882, 0x0862, 0x2988, 0x2988, 
-0x422C, 0x424C, 0x4A6D, 0x0021, 0xAC2E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 
-0xAC0E, 0x0861, 0x2126, 0x2968, 0x52AD, 0xC61B, 0xCE5C, 0xC63B, 0xC63B, 0xC63B, 0xD6BD, 0xA537, 0x39CA, 0x422C, 0x422C, 0x424C, 
-0x4A4D, 0x31C9, 0x2147, 0x10C3, 0x0862, 0x2988, 0x4A4C, 0x424C, 0x4A8D, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x0841, 0x10C4, 0x2967, 0x2147, 0x52AD, 0xC61B, 0xCE5C, 0xC63B, 0xCE7C, 0xD6BC, 
-0xC63B, 0x8434, 0x39EB, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x31A8, 0x2167, 0x18C4, 0x0021, 0x2968, 0x2988, 0x422B, 0x4A6D, 0x0000, 
-0xAC0E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 0x18E4, 0x2148, 0x39EA, 0x2967, 0x39CA, 
-0x528D, 0xC61B, 0xCE5C, 0xCE5C, 0xB5B9, 0xAD58, 0xAD59, 0x7BD3, 0x3A0B, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x420B, 0x31A9, 0x10C3, 
-0x0041, 0x2967, 0x39CA, 0x422C, 0x5ACF, 0x0000, 0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 
-0x10A3, 0x2969, 0x5ACF, 0x31C9, 0x2988, 0x422C, 0x424C, 0xC61B, 0xCE5C, 0xCE7C, 0xA518, 0x8C35, 0x9CB7, 0x7BF3, 0x3A0B, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x4A6D, 0x39EA, 0x1082, 0x0861, 0x3A0B, 0x4A4C, 0x4A4C, 0x2106, 0x6AEB, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2E, 0x0841, 0x31AA, 0x528D, 0x4A6D, 0x39EA, 0x2988, 0x4A6D, 0x7391, 0xC65B, 0xCE5C, 0xCE5C, 
-0xB5B9, 0xA538, 0xB59A, 0x8C75, 0x39EB, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422B, 0x18E4, 0x1082, 0x4A8D, 0x424C, 0x4A4C, 
-0x0000, 0xBC4F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xAC2F, 0x0000, 0x420B, 0x4A6D, 0x4A6D, 0x39CA, 0x18E5, 
-0x2146, 0x5ACF, 0xAD39, 0xBDDA, 0xC63B, 0xC63B, 0xCE5C, 0xCE7C, 0xD6DD, 0xA537, 0x39CA, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x528E, 0x2947, 0x0862, 0x4A6D, 0x424C, 0x4A4C, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 
-0x39E9, 0x3A0B, 0x4A4C, 0x420B, 0x39A7, 0x20C2, 0x0862, 0x630F, 0xA518, 0x9496, 0xBDFA, 0xCE5B, 0xC63B, 0xC63B, 0xD69D, 0xA517, 
-0x39CA, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A8D, 0x2947, 0x0861, 0x4A6D, 0x424C, 0x4A6D, 0x0000, 0xB44F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x18A1, 0xC550, 0x4209, 0x3A0B, 0x0021, 0xB42E, 0xB44F, 0x0000, 0x6B50, 0xCE5C, 0x9CF7, 
-0xBDFA, 0xC65B, 0xC63B, 0xC63B, 0xD69D, 0xA517, 0x39CA, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x2926, 0x0862, 0x4A6D, 
-0x424C, 0x424C, 0x0841, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x2903, 0xC550, 0xCDB2, 0xC571, 0x1882, 0xA3EE, 
-0xC40D, 0xAC2E, 0x0000, 0x6B50, 0xD6BD, 0xCE7C, 0xC65B, 0xC63B, 0xC63B, 0xC63B, 0xD69D, 0xA517, 0x39CA, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x4A6D, 0x2126, 0x0862, 0x2967, 0x31A9, 0x422B, 0x0841, 0xBC4F, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB42F, 
-0x0820, 0xDE33, 0xAC8D, 0xDE12, 0x1060, 0xB42F, 0xC40D, 0xA40E, 0x0000, 0x528E, 0x4A6B, 0x4A8C, 0xC63B, 0xDF1E, 0xDEDE, 0xDEDE, 
-0xE73F, 0xAD78, 0x39CA, 0x422C, 0x422C, 0x422C, 0x422C, 0x5ACF, 0x18C5, 0x0000, 0x2127, 0x2967, 0x2967, 0x0820, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x5A88, 0x940C, 0xACAD, 0x9C2C, 0xB4CE, 0x0840, 0xB42F, 0xC40D, 0xAC0E, 0x0000, 0x31A9, 
-0x18E5, 0x1906, 0x5AED, 0x632F, 0x5B0E, 0x5B0E, 0x630E, 0x5ACE, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A8E, 0x2106, 0x4A06, 0xA46E, 
-0x734C, 0x0885, 0x08A5, 0x0840, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AEB, 0x1881, 0xFF15, 0x93AA, 0xA42C, 0xBCCE, 
-0x0000, 0xAC0E, 0xC40D, 0xAC2E, 0x0000, 0x2967, 0x2947, 0x18E5, 0x0863, 0x10A4, 0x18E5, 0x10C5, 0x10C5, 0x2127, 0x39EA, 0x31C9, 
-0x31C9, 0x31C9, 0x3A0B, 0x0001, 0x62A7, 0xFF16, 0xC550, 0x7BAD, 0x8BED, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBC6F, 0x6ACA, 0x8BAB, 0xCD70, 0xAC8D, 0x49E4, 0x62A9, 0xC46F, 0xC40D, 0xB42F, 0x0000, 0x2988, 0x2147, 0x1062, 0x0842, 0x2126, 
-0x2968, 0x2988, 0x2147, 0x18E5, 0x1905, 0x2146, 0x2146, 0x2146, 0x2167, 0x0000, 0x5A87, 0xDE33, 0xD5D2, 0xD5D1, 0x8BAB, 0x834C, 
-0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB42F, 0x0000, 0x8BCB, 0x6266, 0x49E7, 0xC42E, 0xC40D, 0xC44F, 0x834C, 
-0x0021, 0x2988, 0x2147, 0x18C4, 0x1083, 0x18E5, 0x2967, 0x2147, 0x10A4, 0x0842, 0x10A3, 0x2967, 0x2967, 0x2967, 0x2988, 0x0001, 
-0x62A8, 0xE653, 0xD5D2, 0x9C4D, 0x1061, 0xC42E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC70, 0x2904, 0x3144, 
-0x41A6, 0xC44E, 0xC40D, 0xC40D, 0x834B, 0x0000, 0x31C9, 0x2967, 0x2967, 0x2967, 0x18E5, 0x1062, 0x2106, 0x1083, 0x0000, 0x1083, 
-0x10A4, 0x2967, 0x2967, 0x2967, 0x2988, 0x0001, 0x5A67, 0xDE13, 0xD5D2, 0xACAE, 0x3164, 0xBC6F, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x0000, 0x2988, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x18C4, 0x1083, 0x0821, 0x0021, 0x1083, 0x10A4, 0x2967, 0x2967, 0x2967, 0x2988, 0x0021, 0x49C4, 0xC52F, 0xCDB1, 0xD5D2, 
-0xC571, 0x0861, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x93AD, 0x0000, 0x2988, 0x2967, 0x2967, 0x2967, 0x18C4, 0x1083, 0x18A4, 0x0841, 0x0841, 0x10A4, 0x10A4, 0x2967, 0x2967, 0x2967, 
-0x2988, 0x0021, 0x49E5, 0xBCCE, 0xB4CE, 0xD5F2, 0xC571, 0x0861, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x0000, 0x2988, 0x2967, 0x2967, 0x2968, 0x10A4, 0x1083, 0x0000, 0xA40E, 
-0xA3EE, 0x0000, 0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x18E3, 0x18A1, 0x20C2, 0x20E2, 0x18C2, 0xBC4F, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0x9BED, 0x0000, 0x2988, 0x2967, 
-0x2147, 0x18C4, 0x1083, 0x18C5, 0x0000, 0x9BCE, 0xC40D, 0x93AD, 0x0000, 0x2988, 0x2967, 0x2967, 0x2147, 0x2988, 0x1906, 0x10A4, 
-0x0042, 0x20C2, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBC4F, 0x41C7, 0x10C4, 0x2967, 0x2967, 0x2147, 0x1083, 0x1083, 0x0000, 0x72EB, 0xC46F, 0xC40D, 0xBC4F, 0x0000, 0x2106, 
-0x2967, 0x2967, 0x2967, 0x2147, 0x2967, 0x29A9, 0x10A4, 0x3985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A48, 0x0000, 0x31C9, 0x2147, 0x2967, 0x2967, 0x10A3, 0x18A4, 0x0000, 
-0xB44F, 0xC40D, 0xC40D, 0xC46F, 0x72EB, 0x0841, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x1083, 0x3985, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0A, 0x0021, 0x2988, 
-0x2967, 0x2147, 0x2106, 0x1083, 0x0842, 0x49C7, 0xC46F, 0xC40D, 0xC40E, 0xC40D, 0xC44E, 0x0000, 0x18E5, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x18E5, 0x3145, 0xB44F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7B0B, 0x0021, 0x2147, 0x2147, 0x2126, 0x1062, 0x1083, 0x0000, 0xC44F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 
-0xC44F, 0x41C6, 0x1062, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E5, 0x0840, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 0x0861, 0x422A, 0x31A8, 0x2126, 0x10A3, 0x1083, 
-0x0000, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x20E3, 0x10C4, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x1906, 
-0x18C2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A89, 
-0x5226, 0xEE74, 0x942E, 0x18E6, 0x2147, 0x1083, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x2903, 0x0821, 
-0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2146, 0x18A2, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x836C, 0x49C4, 0xBCEE, 0x734A, 0x2147, 0x2147, 0x1083, 0x18A2, 0xBC6F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x2904, 0x0021, 0x2947, 0x29A8, 0x2126, 0x1083, 0x18C4, 0x2147, 0x0020, 0xC46F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EB, 0x1880, 0xDD90, 0x9C0C, 
-0x2147, 0x2967, 0x18C4, 0x0000, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x2924, 0x0000, 0x2106, 0x10A3, 
-0x0842, 0x1083, 0x2146, 0x0820, 0xC44F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44F, 0x834B, 0x3984, 0x4A49, 0x2147, 0x2167, 0x18A4, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44F, 0x3124, 0x0000, 0x2105, 0x2126, 0x2126, 0x2147, 0x18E4, 0x5A69, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xA40E, 0x0000, 0x2989, 0x2967, 0x2967, 0x18A4, 0x0000, 
-0xBC4F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x3144, 0x0000, 0x2988, 0x2988, 0x2967, 0x29A8, 
-0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 
-0x4A08, 0x10C4, 0x2967, 0x2967, 0x10A4, 0x0000, 0x7B2B, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 
-0xC46F, 0x3965, 0x0021, 0x2126, 0x2967, 0x2967, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xBC4F, 0x0000, 0x2967, 0x2967, 0x18E5, 0x18C5, 0x0000, 0x938D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xBC4F, 0x0000, 0x18A4, 0x2967, 0x2967, 0x0021, 0x9BCE, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0000, 0x2968, 0x2967, 
-0x2988, 0x18C5, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x18A2, 0x1083, 
-0x2147, 0x2967, 0x31A9, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBC4F, 0x0841, 0x2967, 0x2967, 0x2967, 0x18C5, 0x0000, 0x9BCE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0000, 0x1083, 0x2147, 0x2988, 0x0000, 0xAC2E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0841, 0x2147, 0x2967, 0x18C4, 0x1063, 0x0821, 
-0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x1083, 0x2147, 0x2988, 0x0000, 
-0xAC2E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 
-0x0820, 0x2147, 0x2968, 0x18C4, 0x18A4, 0x0000, 0x832B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBC4F, 0x0000, 0x10A4, 0x2967, 0x2967, 0x1906, 0x20E4, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0820, 0x2167, 0x2988, 0x18C4, 0x1083, 0x0000, 0x8B6C, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0xA40E, 0x1061, 0x0884, 0x1927, 0x31C9, 0x0000, 0x93AD, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44F, 0x0840, 0x10C4, 0x18E5, 0x1084, 
-0x1083, 0x0000, 0x8B6C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44E, 0x1081, 0x28C3, 
-0x3966, 0x2987, 0x08A4, 0x41E7, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0x8B6C, 0x1041, 0x1883, 0x1883, 0x18A3, 0x20C4, 0x0000, 0x8B6C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x1061, 0x4965, 0x59C5, 0x4186, 0x41E9, 0x0000, 0x5228, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC46F, 0xB44F, 0xC46F, 0x938D, 0x0000, 0x3104, 0x30E3, 0x30E3, 0x30E3, 0x30E4, 0x0000, 0x836C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1061, 0x4144, 0x51A6, 0x51A5, 0x59C6, 0x1040, 
-0x730B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x5207, 0x0000, 0x0000, 0x0820, 0x3104, 0x28C3, 0x28C3, 
-0x28C3, 0x28C3, 0x30E4, 0x0000, 0x836C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xB44F, 
-0x1882, 0x4165, 0x51A6, 0x49A5, 0x59C6, 0x1020, 0x730B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x41C6, 0x0820, 
-0x3104, 0x28C3, 0x28E3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x30E4, 0x0000, 0x836C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0020, 0x51A6, 0x51A6, 0x49A5, 0x49A5, 0x59C6, 0x1020, 0x730B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_left_7.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_left_7_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 
-0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6AAA, 0x3144, 0x41A6, 0x41A6, 0x41A6, 0x3144, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0x6289, 0x18C3, 0x18C3, 0x2904, 0x3144, 0x2924, 0x2924, 
-0x2924, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC42E, 0x72EA, 0x5A67, 
-0x942D, 0xACD0, 0x6B0B, 0x5229, 0x62AA, 0x62CB, 0x5228, 0x18A2, 0x7B0B, 0xC40E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44F, 0x834C, 0x3943, 0xDE13, 0xDE13, 0xDE32, 0xACCF, 0x62AA, 0x4A08, 0x5A69, 0x5A8A, 0x5A8A, 0x1061, 0x836C, 
-0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xB42F, 0x0000, 0xB4CD, 0xB4CE, 0xC591, 0xC591, 0xDE12, 0xB4CF, 
-0x5A8A, 0x4A08, 0x5A69, 0x5A69, 0x62CB, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xA3EE, 0x3143, 
-0xC570, 0xBD0F, 0xBD50, 0xCD91, 0xC591, 0xDE12, 0xB4CF, 0x5A89, 0x5269, 0x5A69, 0x5A69, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9BCE, 0x0820, 0xCD70, 0xF757, 0xF736, 0x9C2C, 0xB4CE, 0xCD91, 0xC591, 0xD5F2, 0xACCF, 0x4A08, 0x5A69, 
-0x5A69, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x18A1, 0xA42C, 0x59A7, 0x61A7, 0x5966, 0x8B6A, 
-0xBD50, 0xCDB1, 0xD5D2, 0xACAF, 0x4A08, 0x5A69, 0x5A69, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BCE, 0x4A06, 
-0xCDB1, 0xBD30, 0xB4CF, 0xB4CF, 0xB4CF, 0xBD30, 0xC571, 0xDE12, 0xA48F, 0x4A08, 0x5228, 0x5A69, 0x62AA, 0x0000, 0xB44F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x836C, 0x0000, 0x9BED, 0xE694, 0xCDB1, 0xCDB2, 0xCDB2, 0xCDB1, 0xD5F2, 0x8BED, 0x732B, 0xB4EF, 
-0x9C6E, 0x5228, 0x18A2, 0xAC2F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93CD, 0x0000, 0x40C5, 0x8B8C, 0xDE53, 0xCD91, 
-0xC571, 0xC591, 0xCDB1, 0xACAF, 0xA4AF, 0xE653, 0xD5D2, 0x5249, 0x0000, 0xC44F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x93CD, 0x0000, 0x2803, 0x38A4, 0x8B8C, 0xC571, 0xCD91, 0xCD91, 0xCDD2, 0xC550, 0xCD70, 0xCDB2, 0x7B4B, 0x1061, 0x938D, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B2B, 0x1061, 0x82CB, 0x2843, 0x38A4, 0xC571, 0xD5D2, 0xBD30, 0xB4EF, 0xACAE, 
-0xB4CF, 0x732B, 0x0841, 0x8B4C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0F, 0x62C8, 0x7B4A, 0x1000, 
-0x28A3, 0xBD30, 0xC570, 0xA42C, 0x9BEB, 0xCD91, 0x940D, 0x18A3, 0x834C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xB44F, 0x1082, 0x3165, 0x39A5, 0x836A, 0x9C0B, 0xA42C, 0xBD30, 0xE674, 0x5A67, 0x5A48, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC42E, 0xC44F, 0x18A2, 0x7B49, 0xC570, 
-0xCD91, 0xDE33, 0x6287, 0x5A48, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0x1082, 0x7B29, 0xC570, 0xCDB1, 0xDE33, 0x5A66, 0x5A28, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x1061, 0x9C2C, 0xD5B2, 0xCD91, 0xD5D0, 0xB533, 0x6B2F, 
-0x41A6, 0x6268, 0xC42E, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x6AEA, 0x838B, 
-0xC550, 0xCDB1, 0xCD90, 0xCDB4, 0x9CD6, 0x4A6D, 0x10A4, 0x2106, 0x72CA, 0x5A68, 0xC44E, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40E, 0xC40D, 0xC44F, 0x0000, 0xCDB1, 0xD5F1, 0xCD8F, 0xCDD4, 0x9475, 0x4A6E, 0x39EA, 0x528E, 0x4A4C, 0x1084, 0x0842, 
-0x5228, 0xC44E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x93CD, 0x62A7, 0xC570, 0xBD53, 0xBD54, 0x9474, 0x4A8E, 
-0x39CA, 0x4A4C, 0x422C, 0x424C, 0x4A8D, 0x52CF, 0x0842, 0x5A69, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB42E, 0x0000, 
-0xDE36, 0xBD53, 0x9496, 0xA51A, 0x5AEF, 0x31CA, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x5AEF, 0x0000, 0x834B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xA40E, 0x2106, 0x9CD8, 0x94B7, 0xA518, 0x9CB7, 0x5AEF, 0x39EA, 0x420B, 0x422B, 0x4A4C, 0x422C, 
-0x422C, 0x422C, 0x4A8D, 0x0021, 0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3ED, 0x1083, 0xAD5A, 0x9CD7, 0x9CD7, 0xCE7C, 0x6B50, 
-0x39EB, 0x31C9, 0x2126, 0x3188, 0x424C, 0x424C, 0x422C, 0x422C, 0x4A8D, 0x0021, 0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 
-0x0862, 0xB59A, 0xC63B, 0xC63B, 0xD69D, 0x6350, 0x39EB, 0x31C9, 0x2146, 0x2167, 0x2988, 0x4A4C, 0x424C, 0x422C, 0x4A8D, 0x0021, 
-0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x4A49, 0xBDDA, 0xC63B, 0xC65B, 0xC65B, 0xDEFE, 0x6B70, 0x39EB, 0x39EA, 0x10A3, 0x0862, 
-0x2988, 0x2988, 0x4A4C, 0x424C, 0x4A4C, 0x420B, 0x2105, 0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0A, 0x3187, 0xEF7F, 0xC65B, 0xC65B, 0xC65B, 
-0x7BF2, 0x4A6C, 0x4A4C, 0x31C9, 0x1905, 0x10A3, 0x1083, 0x2147, 0x2988, 0x420B, 0x424C, 0x52AE, 0x0842, 0x6AC9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 
-0x8B6B, 0x2125, 0xE73F, 0xC63B, 0xCE5C, 0xC65B, 0x4A6D, 0x39EB, 0x4A4C, 0x420B, 0x31CA, 0x18E4, 0x0000, 0x2988, 0x39EA, 0x422C, 
-0x424C, 0x4A6D, 0x0862, 0x7B2B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x6B0B, 0x8432, 0xD6BD, 0xC63B, 0xC65B, 0xC65B, 0x5ACE, 0x3A0B, 0x422C, 0x4A6D, 
-0x420B, 0x1905, 0x10A3, 0x18E4, 0x39EA, 0x422C, 0x422C, 0x4A6D, 0x0862, 0x7B2B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A6, 0x528B, 0xF7BF, 0xC63B, 0xC63B, 
-0xC65B, 0xC65B, 0x5ACE, 0x3A0B, 0x424C, 0x422B, 0x31A9, 0x2967, 0x2146, 0x0000, 0x2126, 0x420B, 0x4A4C, 0x4A6D, 0x0862, 0x7B2B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6A89, 0x528B, 0xDF1F, 0xC63B, 0xC63B, 0xC65B, 0xC65B, 0x5ACE, 0x3A0B, 0x4A4D, 0x31A9, 0x2126, 0x2967, 0x2126, 0x0020, 
-0x2147, 0x422B, 0x4A4C, 0x4A8D, 0x0842, 0x832B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A89, 0x528B, 0xDF1F, 0xC63B, 0xC63B, 0xC65B, 0xC65B, 0x5ACE, 0x3A0B, 
-0x4A4C, 0x39CA, 0x2167, 0x2988, 0x2126, 0x0841, 0x2126, 0x3A0B, 0x424C, 0x4A6D, 0x1084, 0x72EA, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A89, 0x528B, 0xDF1F, 
-0xC63B, 0xC63B, 0xC65B, 0xC65B, 0x5ACE, 0x3A0B, 0x424C, 0x422C, 0x424C, 0x39EA, 0x2147, 0x2146, 0x0021, 0x2105, 0x420B, 0x4A4C, 
-0x4A6D, 0x18C5, 0x6268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6A88, 0x4A2A, 0xDF1F, 0xC63B, 0xC63B, 0xC65B, 0xC65B, 0x5ACE, 0x3A0B, 0x422C, 0x424C, 0x4A4C, 0x39EB, 
-0x2147, 0x2147, 0x0020, 0x1905, 0x420B, 0x4A4C, 0x4A8D, 0x10C5, 0x5227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x6B2D, 0xB5D9, 0xCE7C, 0xC63B, 0xC63B, 0xC65B, 0xC65B, 
-0x5ACE, 0x3A0B, 0x422C, 0x422C, 0x4A4C, 0x39EA, 0x2126, 0x2147, 0x0020, 0x2106, 0x2967, 0x39EA, 0x528E, 0x18C5, 0x5A48, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x3123, 0x73B0, 
-0xE73F, 0xC63B, 0xC65B, 0xCE7C, 0xCE9C, 0xCE7C, 0x5ACE, 0x3A0B, 0x422C, 0x422C, 0x424C, 0x422B, 0x39CA, 0x2146, 0x0020, 0x18E5, 
-0x31A9, 0x420B, 0x528D, 0x18C5, 0x5A48, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x49C6, 0x738F, 0xDEFE, 0xC65B, 0xBDFA, 0xAD79, 0xB599, 0xB599, 0x52AE, 0x420B, 0x422C, 0x422C, 
-0x422C, 0x4A4C, 0x422C, 0x2146, 0x0020, 0x2967, 0x4A4C, 0x4A4C, 0x52AE, 0x10A4, 0x3985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41A5, 0x6B4F, 0xDF1E, 0xCE7C, 0xB5B9, 0x8C35, 
-0x9476, 0x9476, 0x528D, 0x420B, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x420B, 0x2126, 0x0020, 0x39EA, 0x4A6D, 0x4A4C, 0x31A9, 0x39A7, 
-0xAC0E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 
-0x5A69, 0x8412, 0xD69D, 0xCE7C, 0xBDDA, 0xA4F8, 0xA538, 0xA538, 0x52AE, 0x420B, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x2988, 
-0x0000, 0x39C9, 0x4A4D, 0x4A8E, 0x0842, 0x834B, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x18A2, 0x9CF5, 0xBDBB, 0xA518, 0xC65B, 0xC65B, 0xCE5C, 0xCE7C, 0xCE7C, 0x5ACE, 0x3A0B, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x1082, 0x39EA, 0x4A4C, 0x528E, 0x0862, 0x7B0A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x28E3, 0x94B4, 0xBDDB, 0x9476, 0xAD79, 
-0xCE7C, 0xC65B, 0xC65B, 0xC65B, 0x5ACE, 0x3A0B, 0x422C, 0x422C, 0x422C, 0x4A4D, 0x39C9, 0x0821, 0x420B, 0x4A4C, 0x422C, 0x4A6D, 
-0x1083, 0x832B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0x2903, 0x94B4, 0xDEFE, 0xC63B, 0xC61B, 0xC65B, 0xC63B, 0xC65B, 0xC65B, 0x5ACE, 0x3A0B, 0x422C, 0x422C, 0x422C, 0x4A4D, 
-0x39C9, 0x0000, 0x2947, 0x422C, 0x528E, 0x0842, 0x8B8C, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x3144, 0x2987, 0x3A0A, 0x9CF6, 0xEF7F, 0xD6DE, 0xDEDE, 0xDEDE, 0xDEDE, 
-0x5AEE, 0x39EB, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x39EA, 0x0000, 0x10A5, 0x2968, 0x31C9, 0x0000, 0x9BCD, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x2924, 0x0863, 0x18E5, 
-0x3A0A, 0x634F, 0x5B0E, 0x5B0E, 0x5B0E, 0x5B0E, 0x4A6D, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A6D, 0x31AA, 0x2924, 0x8BCC, 0x942E, 0x2147, 
-0x08A6, 0x0000, 0x9BCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x93AD, 0x6287, 0x20E3, 0x1906, 0x2126, 0x10C5, 0x18E5, 0x10C5, 0x10C5, 0x18E5, 0x31C9, 0x39CA, 0x31C9, 0x31C9, 
-0x39EA, 0x18E5, 0x18C1, 0xE653, 0xDE12, 0x8BED, 0xA490, 0x1040, 0x7B2B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0000, 0xA42C, 0x2922, 0x0883, 0x2988, 0x2126, 0x2106, 0x2988, 
-0x2967, 0x2105, 0x18E5, 0x2126, 0x2147, 0x2146, 0x2167, 0x10A4, 0x20E2, 0xCDB1, 0xCD91, 0xE633, 0xA48D, 0x72EA, 0xBC4F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1082, 0x93CB, 
-0x2902, 0x10A4, 0x2988, 0x1906, 0x18C4, 0x2126, 0x2106, 0x1063, 0x0842, 0x2126, 0x2967, 0x2967, 0x2988, 0x10A4, 0x20E2, 0xCDB2, 
-0xCD91, 0xDE33, 0x0820, 0xB40E, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1082, 0x9BEB, 0x2922, 0x10A4, 0x2988, 0x2988, 0x2126, 0x0842, 0x1062, 0x1083, 0x10A4, 0x2126, 
-0x2967, 0x2967, 0x2988, 0x10A4, 0x20E2, 0xC571, 0xCD91, 0xD5F2, 0x39A4, 0x9BCD, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1082, 0x8369, 0x2902, 0x10A4, 0x2988, 0x2967, 
-0x2126, 0x0862, 0x0020, 0x1083, 0x2147, 0x2967, 0x2967, 0x2967, 0x2988, 0x10C4, 0x18A1, 0xA46D, 0xC571, 0xCD91, 0xE674, 0x2902, 
-0x834C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A2, 0x0841, 0x0000, 0x18E5, 0x2988, 0x2967, 0x2126, 0x0862, 0x0000, 0x1083, 0x2147, 0x2967, 0x2967, 0x2967, 0x2988, 0x10C4, 
-0x18A1, 0xAC6C, 0xAC6C, 0xC571, 0xE694, 0x2922, 0x834C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0xC44F, 0x49C6, 0x0883, 0x2988, 0x2967, 0x2126, 0x0862, 0x0000, 0x1083, 
-0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x2125, 0x20C2, 0x0820, 0x0840, 0x0000, 0x9BCD, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A48, 0x0862, 
-0x2988, 0x2967, 0x2126, 0x1063, 0x0862, 0x0841, 0x2147, 0x2968, 0x2967, 0x2967, 0x2967, 0x2968, 0x1905, 0x1082, 0xB42F, 0xBC4F, 
-0xAC2F, 0xC44E, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x5227, 0x0862, 0x2988, 0x2967, 0x2106, 0x1083, 0x1083, 0x0000, 0x10C4, 0x2147, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x18E5, 0x20E3, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x5227, 0x0862, 0x2988, 0x2968, 0x2106, 0x1062, 
-0x1083, 0x0000, 0x0862, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x18C5, 0x20E3, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 
-0x5227, 0x0862, 0x2988, 0x2967, 0x2126, 0x10A4, 0x1083, 0x0841, 0x0841, 0x2126, 0x2968, 0x2967, 0x2967, 0x2967, 0x1906, 0x20E4, 
-0xAC2F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x5228, 0x0842, 0x2147, 0x2147, 0x2988, 0x2147, 0x1083, 0x1083, 0x0000, 0x18E4, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x2147, 0x0000, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x4A07, 0x10A3, 0x4229, 0x3188, 
-0x2147, 0x2126, 0x1083, 0x1083, 0x0000, 0x0841, 0x2126, 0x2968, 0x2967, 0x2967, 0x2967, 0x2126, 0x0861, 0xBC4F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0x41C6, 0x6AE8, 0xEE74, 0x83AD, 0x10E6, 0x2126, 0x1083, 0x1083, 0x1082, 0x0862, 0x2106, 0x2968, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2147, 0x0841, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x6ACA, 0x5A46, 0xBCEE, 0x6B0A, 0x1906, 0x0862, 0x1081, 
-0xC44F, 0x5228, 0x0000, 0x2947, 0x29A8, 0x2126, 0x1083, 0x18A4, 0x2967, 0x1906, 0x10A2, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5207, 
-0x2902, 0xDDB0, 0x8BAB, 0x10C6, 0x0862, 0x1062, 0x5A48, 0xC490, 0x5228, 0x0000, 0x18C4, 0x18C4, 0x1063, 0x1063, 0x2147, 0x31A8, 
-0x0000, 0xB42F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x730A, 0x41A5, 0x4A49, 0x2127, 0x2105, 0x1083, 0x0000, 0xC46F, 0xC42E, 0x39A5, 
-0x0000, 0x18C4, 0x10A4, 0x2126, 0x2967, 0x2967, 0x10C4, 0x41C7, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0x8B4C, 0x0000, 0x2989, 0x2967, 
-0x2967, 0x1083, 0x0000, 0xBC6F, 0xC40D, 0xC44F, 0x41C6, 0x0000, 0x18C5, 0x2126, 0x2967, 0x2967, 0x31C9, 0x0000, 0x93AD, 0xC40D, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBC6F, 0x41C7, 0x10C4, 0x2968, 0x2147, 0x1083, 0x0000, 0xC44F, 0xC40D, 0xC40D, 0xC44F, 0x3985, 0x0000, 0x1083, 
-0x2105, 0x2967, 0x2988, 0x0842, 0x6AAA, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xB44F, 0x0000, 0x2988, 0x2147, 0x1083, 0x0020, 0xA3EE, 
-0xC42E, 0xC40D, 0xC40D, 0xC44F, 0x3144, 0x0021, 0x1063, 0x2105, 0x2967, 0x39E9, 0x0000, 0x6AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC0E, 
-0x0000, 0x2988, 0x2147, 0x10A4, 0x18A4, 0x0000, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x3144, 0x0842, 0x0862, 0x2105, 0x2988, 
-0x0021, 0x72EA, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2F, 0x0020, 0x2968, 0x2967, 0x2967, 0x18C4, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44E, 0x3144, 0x0821, 0x1063, 0x2106, 0x29A8, 0x0862, 0x5A68, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2F, 0x0000, 0x2967, 0x2967, 
-0x18A4, 0x0000, 0xB44F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x3144, 0x0000, 0x2126, 0x31A9, 0x0042, 0x5A48, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x2967, 0x2967, 0x10A4, 0x0842, 0x20C3, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 
-0x5228, 0x0021, 0x2126, 0x2147, 0x18E4, 0x7B0B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0000, 0x2988, 0x2988, 0x10A4, 0x18A4, 0x0000, 0x93CD, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49E7, 0x0000, 0x2126, 0x2989, 0x2106, 0x20A2, 0x7B2B, 0xC44E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xBC4F, 0x0000, 
-0x18E5, 0x18E5, 0x1083, 0x1083, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x41C7, 0x1062, 0x41A7, 
-0x49C7, 0x4124, 0x0841, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x7B0B, 0x0820, 0x1883, 0x1883, 0x18A3, 0x20C4, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xC40D, 0x93AD, 0x0800, 0x61E6, 0x51A6, 0x4165, 0x28E3, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0xB44F, 0xC44F, 0x7B0B, 0x0000, 0x3925, 0x30E3, 0x30E3, 0x30E3, 0x30E4, 
-0x0000, 0x9BEE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x62A9, 0x2061, 0x51C6, 0x49A5, 0x51C6, 0x51A6, 0x0000, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x3144, 0x0000, 0x0000, 0x0821, 
-0x3904, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x30E4, 0x0000, 0x9BEE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49E7, 0x1840, 
-0x6207, 0x49A5, 0x51A5, 0x4985, 0x3944, 0x41C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0x2924, 0x1061, 0x30E4, 0x28E3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x30E4, 0x0000, 0x9BEE, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6289, 0x1841, 0x59C6, 0x49A5, 0x51A6, 0x3924, 0x18C2, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_left_8.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_left_8_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x49E7, 0x3965, 0x41A6, 0x20C3, 0xB44F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC42E, 0x41C7, 0x20C3, 0x2924, 0x3124, 
-0x2904, 0x2104, 0xB42F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 
-0xC42E, 0x5A69, 0x62A7, 0x9C6E, 0x628A, 0x5A6A, 0x6AEB, 0x3145, 0x2103, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC42E, 0x5A48, 0x4163, 0xEE94, 0xDDF2, 0x9C4E, 0x5A69, 0x4A28, 0x6AEB, 0x3145, 0x20C3, 
-0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x5A48, 0x49C4, 0xEE94, 0xB4CE, 0xCD91, 
-0xDE12, 0x9C4E, 0x5A69, 0x4A08, 0x6ACB, 0x3986, 0x1082, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 
-0x6AAA, 0x3942, 0xDDF2, 0xDE74, 0xB4EE, 0xC550, 0xC591, 0xDE33, 0x9C2E, 0x5A69, 0x5249, 0x62AA, 0x41C7, 0x0841, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x5A48, 0x5A46, 0xE632, 0x7AC8, 0x728A, 0xEF16, 0x9BEB, 0xBD0F, 0xCD91, 0xDE12, 0x940D, 
-0x49E8, 0x5A8A, 0x41C7, 0x20C3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A89, 0x5A66, 0xCD91, 0xACAD, 0xB4AF, 
-0x5987, 0x5987, 0x93AB, 0xC550, 0xDE12, 0x8BED, 0x4A08, 0x5A8A, 0x41C7, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 
-0x7B0B, 0x1842, 0x3084, 0x832B, 0xD612, 0xC591, 0xB4CF, 0xB4CF, 0xBD30, 0xDE12, 0x8BED, 0x49E8, 0x5229, 0x628A, 0x41C7, 0x20E3, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41C6, 0x0800, 0x3023, 0x72A9, 0xDE33, 0xCD91, 0xCDD2, 0xCDD2, 0xD5D2, 0x7B4B, 
-0x83AC, 0xBD10, 0x8BCD, 0x5A6A, 0x41C7, 0x0841, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x93AD, 0x7B8B, 0x51A6, 0x2002, 0x72CA, 
-0xDE33, 0xC591, 0xC591, 0xCD91, 0xD5D2, 0x9C4E, 0xB4F0, 0xEE94, 0xBD10, 0x3125, 0x10A2, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0x0000, 0xBD2F, 0x8B2C, 0x0000, 0x7289, 0xDE33, 0xCD91, 0xCDB2, 0xCDB1, 0xB4CE, 0xCD91, 0xE673, 0xCDB2, 0x5207, 0x18A2, 
-0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x93AD, 0x62A8, 0x6A88, 0x59C6, 0x8B8B, 0xDE33, 0xC591, 0xBD0F, 0xBD0F, 
-0xAC6D, 0xDDF2, 0xA46D, 0x2903, 0x18A3, 0xB42F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B4C, 0x41C4, 
-0x9C2B, 0xC52F, 0xC550, 0xB4EF, 0x9BEB, 0x9BEB, 0xCD91, 0xB4EF, 0x6289, 0x3144, 0xAC2F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x3143, 0x9C0B, 0xA44C, 0x9C0B, 0xA42C, 0xA46D, 0xD5D2, 0x1060, 0xB42F, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x28E2, 0xAC8D, 0x9C2C, 
-0xA44C, 0xC571, 0xDE13, 0x1080, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9BCE, 0x20C1, 0xAC6C, 0xA44C, 0xC591, 0xDE33, 0x1080, 0xB42F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xABEE, 0x0840, 0xDDF2, 0xD5B1, 0xD5F1, 0x736E, 0x39EA, 
-0x18C3, 0xBC4F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xB42F, 0x41C6, 
-0xB4CE, 0xD5D2, 0x734E, 0x734E, 0x422C, 0x4A6D, 0x2948, 0x20E4, 0xBC4F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x5226, 0x9C2B, 0xE654, 0x630D, 0x31CB, 0x31CB, 0x422C, 0x422C, 0x52AE, 0x2107, 0x2104, 0xBC4F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49E6, 0x41A6, 0xDE56, 0x6B2D, 0x29AB, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x52AE, 0x2107, 0x20E4, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x62AA, 
-0x6310, 0x73B4, 0x298A, 0x4A4C, 0x4A4C, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x52AE, 0x2106, 0x20C2, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3124, 0x4A6C, 0xC61D, 0x7BF3, 0x39CA, 0x422C, 0x420B, 0x422B, 0x424C, 0x422C, 0x422C, 0x422C, 
-0x4A6D, 0x2126, 0x41A5, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x4A07, 0x5AAD, 0xCE7D, 0x8C94, 0x39CA, 0x420B, 
-0x2147, 0x2146, 0x420B, 0x424C, 0x422C, 0x422C, 0x4A6D, 0x2126, 0x41A5, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x41A5, 
-0x8C53, 0xDEFE, 0x8434, 0x39EB, 0x422C, 0x420B, 0x2126, 0x0821, 0x2126, 0x422B, 0x4A4C, 0x422C, 0x4A6D, 0x2126, 0x41A5, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x20C2, 0x9494, 0xEF7F, 0x7BF2, 0x31A9, 0x4A4C, 0x420B, 0x2126, 0x0000, 0x2126, 0x2988, 
-0x420B, 0x4A4D, 0x4A6D, 0x2126, 0x41A5, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x2903, 0x8C74, 0xE73F, 0x8413, 0x31AA, 
-0x4A4C, 0x420B, 0x2126, 0x1905, 0x1082, 0x1905, 0x2967, 0x39EA, 0x528E, 0x18E6, 0x41A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x20C2, 0x8432, 0xF7BF, 0x8C54, 0x31AA, 0x424C, 0x422C, 0x39CA, 0x2988, 0x0020, 0x18E4, 0x31A9, 0x420B, 0x4A6D, 0x39CA, 
-0x31A7, 0x93AD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xA40E, 0x62EC, 0xB598, 0xB599, 0x5B0F, 0x39EB, 0x422C, 0x4A6D, 0x4A6D, 0x2967, 
-0x0000, 0x18E5, 0x424C, 0x4A6D, 0x422C, 0x528D, 0x31A9, 0x0840, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x0000, 0xBDFA, 0xE75E, 0x632F, 
-0x2989, 0x4A4C, 0x422B, 0x39EA, 0x39EA, 0x2967, 0x10A3, 0x10A3, 0x3188, 0x422C, 0x424C, 0x4A4D, 0x3189, 0x20E3, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44F, 0x1081, 0xAD57, 0xDEFE, 0x7391, 0x39CA, 0x4A4C, 0x39EA, 0x1926, 0x2146, 0x2967, 0x29A8, 0x0841, 0x0882, 0x39EA, 
-0x4A4D, 0x4A4D, 0x3189, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1081, 0xAD57, 0xDEFE, 0x7391, 0x39CA, 0x4A4C, 0x39EB, 0x2967, 
-0x2967, 0x2967, 0x2968, 0x0841, 0x10A3, 0x39EA, 0x4A4C, 0x4A4D, 0x3189, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1081, 0xAD57, 
-0xDEFE, 0x7391, 0x39CA, 0x422C, 0x422C, 0x422C, 0x420B, 0x2967, 0x2967, 0x0841, 0x10A3, 0x39EA, 0x4A4C, 0x4A4D, 0x3189, 0x20E3, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1081, 0xAD57, 0xDEFE, 0x7391, 0x39CA, 0x422C, 0x422C, 0x4A4C, 0x422B, 0x2147, 0x2967, 0x0841, 
-0x10A3, 0x3A0B, 0x4A6D, 0x4A4D, 0x3189, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1081, 0xAD57, 0xDEFE, 0x7391, 0x39CA, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x3A0B, 0x2988, 0x0841, 0x18C4, 0x2988, 0x39C9, 0x4A6D, 0x3189, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 
-0x0840, 0xA537, 0xE73E, 0x73B1, 0x31CA, 0x422C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x2988, 0x0841, 0x10A3, 0x31A9, 0x420B, 0x4A6D, 
-0x3189, 0x20E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x93AD, 0x6B4E, 0xBDFA, 0xC63C, 0x6B50, 0x39EA, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 
-0x2988, 0x0020, 0x1905, 0x424C, 0x4A4C, 0x4A8D, 0x31A9, 0x0841, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0000, 0xDEDD, 0xD69D, 0xA518, 0x5ACF, 
-0x39EB, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x2988, 0x0000, 0x2967, 0x528D, 0x4A4C, 0x39EA, 0x3187, 0x8B8D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBC4F, 0x0861, 0xC61B, 0xCE7C, 0xB5BA, 0x6330, 0x39EB, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x0020, 0x2946, 0x4A8D, 
-0x4A6D, 0x2106, 0x41A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0861, 0xC61B, 0xCE5C, 0xD6DD, 0x73B1, 0x39CA, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422B, 0x10A3, 0x2967, 0x4A6D, 0x4A6D, 0x2126, 0x3965, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0861, 0xC61B, 0xCE5C, 
-0xD6BD, 0x7391, 0x39CA, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422C, 0x0841, 0x3188, 0x4A6D, 0x424C, 0x4A6D, 0x2126, 0x49C6, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBC4F, 0x0861, 0xC61B, 0xCE5C, 0xD6BD, 0x7391, 0x39CA, 0x422C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x0841, 0x18E4, 
-0x422B, 0x528E, 0x18C5, 0x5A68, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x1061, 0xD6BC, 0xDEFE, 0xEF5F, 0x7BD2, 0x31AA, 0x422C, 
-0x422C, 0x4A4D, 0x422C, 0x0021, 0x0863, 0x2126, 0x2967, 0x4A6D, 0x1084, 0x41C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x0020, 
-0x5AEE, 0x5B0E, 0x632E, 0x528D, 0x4A4C, 0x4A4C, 0x4A6D, 0x39EA, 0x2104, 0x7B6A, 0x9C6E, 0x31C8, 0x0085, 0x0043, 0x6AAA, 0xC46F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 0x10C5, 0x10E5, 0x10A4, 0x2968, 0x39CA, 0x31C9, 0x3A0B, 0x2127, 0x0020, 0xD5D2, 
-0xE653, 0x942E, 0x9C90, 0x18A1, 0x6AA9, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 0x2147, 0x2967, 0x2967, 0x2147, 
-0x2147, 0x2126, 0x10A4, 0x18E4, 0x62C8, 0xC591, 0xCD91, 0xE633, 0xACAE, 0x6AEA, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC46F, 0x0020, 0x2147, 0x2967, 0x2967, 0x2967, 0x2968, 0x2106, 0x0000, 0x3143, 0xF6B5, 0xBD2F, 0xC571, 0xE654, 0x1081, 0xA3CD, 
-0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 0x2147, 0x2967, 0x2967, 0x2967, 0x2988, 0x2106, 0x0001, 0x20E2, 
-0xACAE, 0xAC8D, 0xCD91, 0xE653, 0x5226, 0x8B8D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 0x2147, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2106, 0x0842, 0x0000, 0x1082, 0xB4EF, 0xBD50, 0xBD30, 0xD5F2, 0x3963, 0x72CA, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC46F, 0x0020, 0x2147, 0x2967, 0x2967, 0x2968, 0x18E5, 0x1083, 0x0862, 0x0020, 0x1083, 0x1081, 0x1081, 0x10A1, 
-0x1081, 0x0000, 0x832B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 0x2147, 0x2967, 0x2967, 0x2988, 0x18E5, 0x0841, 
-0x0841, 0x1083, 0x1083, 0x0842, 0x18E5, 0x0000, 0x9BCE, 0xC44F, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 
-0x2147, 0x2967, 0x2947, 0x2988, 0x2106, 0x0821, 0x0020, 0x10A4, 0x1083, 0x2126, 0x31C9, 0x0000, 0xAC2F, 0xC40D, 0xC40D, 0xC40E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 0x2147, 0x2967, 0x2967, 0x2106, 0x18C4, 0x0841, 0x0020, 0x1083, 0x10A4, 0x2967, 
-0x0862, 0x836C, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 0x2147, 0x2967, 0x2968, 0x18C4, 
-0x0842, 0x0841, 0x0862, 0x1083, 0x10A4, 0x2147, 0x0000, 0xC44F, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC46F, 0x0020, 0x2147, 0x2967, 0x2968, 0x18E5, 0x0020, 0x0841, 0x18A4, 0x1083, 0x10A4, 0x2147, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 0x2147, 0x2967, 0x2968, 0x18E5, 0x0841, 0x0841, 0x1083, 0x1083, 
-0x10A4, 0x2147, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x0020, 0x2147, 0x2967, 
-0x2968, 0x18C4, 0x1083, 0x0842, 0x0820, 0x1083, 0x10A4, 0x2147, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBC6F, 0x0861, 0x2147, 0x2967, 0x2968, 0x18C5, 0x1063, 0x1083, 0x0862, 0x0020, 0x10A4, 0x2147, 0x0000, 0xBC4F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x18A2, 0x1083, 0x10A4, 0x2106, 0x2967, 0x1905, 
-0x0842, 0x0000, 0x10A4, 0x2967, 0x2146, 0x18C3, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 
-0x0020, 0x0842, 0x1063, 0x2106, 0x29A8, 0x2106, 0x0821, 0x0020, 0x10A4, 0x18C4, 0x2988, 0x0000, 0xB44F, 0xC40D, 0xC42E, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xAC2F, 0x0020, 0x1083, 0x2988, 0x2967, 0x2147, 0x18C4, 0x0841, 0x0841, 0x1083, 
-0x2967, 0x10C4, 0x41E7, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2F, 0x3186, 0x18E5, 
-0x2967, 0x2988, 0x2126, 0x0842, 0x0000, 0x1083, 0x18E5, 0x31C9, 0x0000, 0x938C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41A5, 0x0042, 0x31A9, 0x2967, 0x2147, 0x10A3, 0x0020, 0x1083, 0x1062, 0x2147, 0x0000, 0xAC0E, 
-0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0x93AD, 0x2105, 0x2126, 0x2967, 0x2988, 0x2126, 
-0x0000, 0x1083, 0x1083, 0x2147, 0x0021, 0x7B2C, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7B0A, 0x0020, 0x29A8, 0x2967, 0x2126, 0x0020, 0x1083, 0x1083, 0x2106, 0x31C9, 0x0000, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7B0B, 0x0841, 0x2988, 0x2967, 0x2126, 0x1083, 0x0020, 0x1083, 0x1083, 
-0x2147, 0x0021, 0x834C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x8B6C, 0x0001, 
-0x2988, 0x2967, 0x2126, 0x0020, 0x1083, 0x1063, 0x2147, 0x0000, 0x8B6C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9BAD, 0x0000, 0x2988, 0x2967, 0x2967, 0x2106, 0x0841, 0x0842, 0x2126, 0x2147, 0x18E4, 0x93AD, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x0000, 0x2188, 0x2147, 0x2167, 0x2168, 
-0x0000, 0x0842, 0x18A4, 0x2988, 0x0021, 0x5A48, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 
-0x9BCE, 0x0000, 0x41A7, 0x3986, 0x3986, 0x3986, 0x3103, 0x1061, 0x0842, 0x10C4, 0x1083, 0x3965, 0xAC2F, 0xC40E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x5A48, 0x28A2, 0x59C6, 0x51A5, 0x51A5, 0x51A5, 0x6207, 0x1881, 0x0841, 0x18A3, 
-0x28E4, 0x1020, 0x20E3, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0xBC4F, 0x3985, 0x1841, 0x6207, 0x4985, 0x51A5, 
-0x51C6, 0x51A6, 0x3944, 0x0820, 0x1862, 0x30E4, 0x30E4, 0x1041, 0x41C6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x20C3, 
-0x0000, 0x3903, 0x59E7, 0x49A5, 0x51A5, 0x4985, 0x4144, 0x4144, 0x0841, 0x0020, 0x20A2, 0x30E4, 0x30E4, 0x1041, 0x41C6, 0xC42E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1082, 0x4144, 0x51C6, 0x51A6, 0x49A5, 0x49A5, 0x51A6, 0x3944, 0x0000, 0x0020, 0x28C3, 0x30E4, 
-0x28C3, 0x28C3, 0x30E4, 0x1041, 0x41C6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_left_9.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_left_9_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44F, 0x3985, 0x41A6, 0x41A6, 
-0x41A6, 0x20C3, 0xB44F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 
-0xC40D, 0xC44E, 0x3145, 0x20C3, 0x20C3, 0x2924, 0x3124, 0x2904, 0x2104, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC42E, 0x5227, 0x6AC8, 0xA48F, 0xA46F, 0x5A8A, 0x5A6A, 0x6AEB, 0x3145, 0x2924, 
-0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44E, 0x41A6, 0x5204, 0xF6D5, 0xD5F2, 
-0xD5F2, 0x9C4E, 0x5A69, 0x4A28, 0x730C, 0x1082, 0x41C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC44E, 0x41A6, 0x6285, 0xEE93, 0xB4CE, 0xCDB1, 0xC591, 0xDE12, 0x9C2E, 0x5A8A, 0x5A6A, 0x3165, 0x5228, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x41A6, 0x51E4, 0xE654, 0xDE33, 0xB4EE, 0xC550, 0xC591, 0xC571, 0xE633, 0x8BAC, 
-0x4A08, 0x6ACB, 0x3124, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x39A6, 0x6266, 0xDE12, 0x936C, 0x830B, 
-0xEEF5, 0x93CB, 0xC571, 0xCD91, 0xD5F2, 0x838C, 0x4A08, 0x62AA, 0x3145, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 
-0x3165, 0x8BCB, 0xD5D2, 0xCD91, 0xCDD2, 0xA42D, 0x5126, 0x61E8, 0xC551, 0xCDB1, 0xD5F2, 0x838C, 0x4A08, 0x62AA, 0x3145, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x3165, 0x2042, 0x38C4, 0xA44E, 0xD5F2, 0xCDB1, 0xC550, 0xB4AF, 0xB4EF, 0xC571, 0xDE12, 
-0x7B6C, 0x4A08, 0x5229, 0x62AA, 0x3145, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x5248, 0x838B, 0x4925, 0x2002, 0x93CC, 0xD612, 
-0xC571, 0xCD91, 0xCDD2, 0xCDD2, 0xCDB2, 0x730B, 0x8BED, 0xBD10, 0x838C, 0x628A, 0x3124, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB42F, 
-0x0000, 0xEE74, 0x4946, 0x0800, 0x93AC, 0xDE12, 0xC591, 0xC591, 0xCD91, 0xC571, 0xAC8D, 0x93ED, 0xCD91, 0xFF15, 0xB4F0, 0x18A3, 
-0x2903, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x8B8D, 0x49E5, 0x7AC9, 0x7AEA, 0xB4EF, 0xD5D2, 0xC571, 0xCD91, 0xCDB2, 0xCD91, 
-0xB4AE, 0xEE73, 0xBD31, 0x6AC8, 0x18A1, 0x2924, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0x72EA, 0x4A05, 0xC54F, 
-0xCD90, 0xBD50, 0xCDD2, 0xC571, 0xB4EE, 0xBD0F, 0xDE33, 0x836A, 0x20C2, 0x49E7, 0x6289, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72CA, 0x49C5, 0x8BA9, 0xBCEE, 0xC571, 0xB4CE, 0x9BEB, 0xA46D, 0x942D, 0x5A48, 0x3965, 0xC46F, 
-0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6ACA, 0x5205, 0xA42C, 0x9C0B, 0x9C0B, 
-0xB4EE, 0xB50F, 0x0841, 0xC44E, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6ACA, 0x3963, 0xB48D, 0xACAE, 0xD5D2, 0xACCF, 0x1082, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6ACA, 0x3122, 0xC54F, 0xDE12, 0xB530, 0x4A6C, 0x39EB, 0x20E3, 
-0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72CA, 0x5A45, 
-0xBD31, 0x5AAD, 0x5ACD, 0x420C, 0x4A4C, 0x0000, 0xC44F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x3167, 0x5ACC, 0x6B2E, 0x31CB, 0x3A0B, 0x424C, 0x422C, 0x3188, 0x4A08, 0xC46F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x0861, 0x1906, 0x31CA, 0x2148, 0x39EA, 0x4A6D, 0x422C, 
-0x422C, 0x52AE, 0x0000, 0xAC0E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3CD, 0x0020, 0x10C5, 
-0x31C9, 0x31A9, 0x3188, 0x31A9, 0x39EA, 0x4A4C, 0x422C, 0x4A6D, 0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC42E, 0xAC2F, 0x1083, 0x2147, 0x2988, 0x420B, 0x4A6D, 0x4A6D, 0x420B, 0x2988, 0x39EA, 0x422C, 0x4A6D, 0x0000, 0xB42F, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x0000, 0xAD79, 0x420A, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x4A4C, 
-0x422B, 0x2988, 0x422C, 0x4A6D, 0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x18E4, 0xB5D9, 
-0x5ACE, 0x420B, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xB42F, 0x2925, 0xB5B9, 0x31C9, 0x420B, 0x424C, 0x422C, 0x422C, 0x4A4C, 0x39EA, 0x2147, 0x2988, 0x422C, 0x4A6D, 
-0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xB42E, 0x1082, 0xD6BD, 0x2146, 0x39EB, 0x424C, 0x422C, 0x422C, 
-0x4A4C, 0x39EA, 0x2126, 0x2967, 0x422C, 0x4A6D, 0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x5AAA, 0x8453, 
-0x52AC, 0x39EA, 0x422C, 0x424C, 0x422C, 0x422C, 0x4A6D, 0x420B, 0x2126, 0x2967, 0x422C, 0x4A6D, 0x0000, 0xB42F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8B6C, 0x3187, 0xD6DD, 0x0883, 0x422C, 0x424C, 0x422C, 0x422C, 0x4A4C, 0x420B, 0x2988, 0x2147, 0x2147, 
-0x422C, 0x4A6D, 0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xA3ED, 0x0841, 0x7BF2, 0x31A9, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x4A6D, 0x39EA, 0x2126, 0x2968, 0x39CA, 0x422C, 0x4A6D, 0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x8BCE, 
-0x2125, 0x18E6, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x424C, 0x422B, 0x31A9, 0x2126, 0x2988, 0x4A6D, 0x424C, 0x528E, 0x0000, 0xAC0E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A88, 0x4A4A, 0xBE1B, 0x10C5, 0x420B, 0x424C, 0x422C, 0x422C, 0x4A6D, 0x31C9, 0x2126, 0x2147, 
-0x2988, 0x4A4C, 0x422C, 0x39CA, 0x2945, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x832B, 0x4229, 0xA517, 0x18E5, 0x2967, 0x422B, 
-0x422C, 0x424C, 0x4A4C, 0x3188, 0x2126, 0x2147, 0x2988, 0x4A4C, 0x422C, 0x0000, 0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 
-0x8B6C, 0x0842, 0x52AE, 0x39EA, 0x2147, 0x2967, 0x422B, 0x4A4D, 0x31CA, 0x0882, 0x1082, 0x2968, 0x2988, 0x4A4C, 0x422C, 0x0000, 
-0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 0x2903, 0x39A7, 0x422B, 0x422C, 0x422C, 0x420B, 0x420B, 0x422C, 0x31C9, 0x0862, 0x2105, 
-0x39CA, 0x2126, 0x2988, 0x4A4C, 0x422C, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC42E, 0x5A47, 0x5A47, 0x2967, 0x2106, 0x39EA, 0x4A6D, 0x422C, 0x422C, 
-0x4A4C, 0x4A6D, 0x4A6D, 0x31EA, 0x0000, 0x2105, 0x4A8D, 0x39EA, 0x3A0B, 0x424C, 0x422C, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC44F, 0x5A48, 0x72EA, 0x10A4, 0x10A4, 
-0x420B, 0x528E, 0x4A4C, 0x422C, 0x424C, 0x4A6D, 0x4A4C, 0x39EA, 0x39EA, 0x10A3, 0x18E4, 0x39EA, 0x4A6D, 0x4A4C, 0x4A4C, 0x424C, 
-0x422C, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 
-0x834C, 0x7B4B, 0x2903, 0x0023, 0x4A8D, 0x4A8D, 0x424C, 0x422C, 0x424C, 0x4A6D, 0x4A4C, 0x39EA, 0x31C9, 0x0882, 0x0882, 0x0841, 
-0x39CA, 0x528E, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x0000, 0xC44F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0xAC0E, 0x62A9, 0x1080, 0x7B29, 0xE654, 0x734E, 0x422C, 0x422C, 0x4A6D, 0x4A6D, 0x424C, 0x31A9, 
-0x2105, 0x1083, 0x1082, 0x0841, 0x0041, 0x2968, 0x422C, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x18C4, 0x8B8D, 0xC44E, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x3985, 0x0020, 0x93EC, 0xF6F5, 0xD5D2, 0xD5D1, 0xCDB2, 
-0x4A4C, 0x4A4D, 0x2968, 0x3188, 0x2947, 0x0862, 0x0000, 0x0841, 0x10A3, 0x31A9, 0x31A9, 0x422C, 0x4A4C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x424C, 0x52AE, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x18A2, 0xACAE, 
-0xDE13, 0xCD91, 0xC571, 0xCDB1, 0xCD91, 0x940D, 0x31A9, 0x31AA, 0x3986, 0x1061, 0x0000, 0x18E5, 0x31A9, 0x31C9, 0x4A6D, 0x4A4C, 
-0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x1082, 0xBD30, 0xA46D, 0x9BEB, 0xBD0F, 0xCDB2, 0xD5D2, 0x940C, 0x1082, 0x18A2, 0x1082, 0xC44F, 0x7B0B, 
-0x1084, 0x4A6D, 0x422C, 0x422C, 0x424C, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 
-0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1041, 0xCD91, 0x20E2, 0x6AA7, 0xCD70, 0xDE33, 0x7329, 
-0x5228, 0xC42E, 0xC44F, 0xC44F, 0xC40D, 0x72CA, 0x1084, 0x4A8E, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x0000, 0xB42F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0000, 
-0x1060, 0xBC6F, 0x41C6, 0x7B29, 0xFF97, 0x7309, 0x49E7, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x72EA, 0x1083, 0x528E, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x0000, 0xB42F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB44F, 0xAC2F, 0xC40D, 0xC42E, 0x5A68, 0x20C1, 0x0020, 0x3986, 0xC40D, 0xC40D, 0xC40E, 
-0x9BEE, 0x2945, 0x1906, 0x420B, 0x4A6D, 0x4A4C, 0x4A4D, 0x4A6D, 0x4A6D, 0x4A4D, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 
-0x4A4C, 0x52CF, 0x0000, 0xA40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 
-0x8B4C, 0x93AD, 0xBC70, 0xC40D, 0xC40D, 0xC42E, 0x3144, 0x0862, 0x2988, 0x2968, 0x39CA, 0x31C9, 0x31A9, 0x2947, 0x2947, 0x31C9, 
-0x39EA, 0x39EA, 0x39EA, 0x39EA, 0x39CA, 0x31C9, 0x31C9, 0x18E5, 0x7B4C, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0xC40D, 0xC40D, 0x5207, 0x0862, 0x2988, 0x2147, 
-0x2146, 0x2147, 0x2146, 0x0862, 0x0842, 0x18C4, 0x18E5, 0x18E5, 0x18E5, 0x18E5, 0x1905, 0x2147, 0x2146, 0x0000, 0xC44F, 0xC40D, 
-0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0xBC4F, 0x39A6, 0x10C4, 0x2968, 0x2967, 0x2967, 0x2147, 0x2106, 0x1083, 0x1083, 0x1083, 0x1063, 0x1063, 0x1063, 0x0842, 
-0x1083, 0x2967, 0x2167, 0x0000, 0xBC6F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x18A2, 0x10C4, 0x2988, 0x2967, 0x2967, 0x2967, 0x2126, 0x1063, 0x1083, 
-0x1083, 0x1083, 0x1083, 0x1083, 0x10A3, 0x10A4, 0x18C4, 0x2967, 0x2167, 0x0000, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x2903, 0x10C4, 0x2968, 
-0x2967, 0x2967, 0x2967, 0x2126, 0x1083, 0x1083, 0x0000, 0x0862, 0x1083, 0x1063, 0x18E5, 0x2988, 0x2967, 0x2967, 0x2147, 0x0020, 
-0xBC4F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC44E, 0x2903, 0x10C4, 0x2968, 0x2967, 0x2967, 0x2967, 0x2126, 0x1083, 0x1083, 0x0841, 0x0862, 0x10A4, 0x1063, 
-0x18E5, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x0861, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x2903, 0x10C4, 0x2968, 0x2967, 0x2967, 0x2126, 0x10A3, 
-0x0862, 0x18A2, 0xC46F, 0x39A6, 0x0000, 0x18C4, 0x1083, 0x18E5, 0x2967, 0x2967, 0x2967, 0x2988, 0x0000, 0xB42F, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x2924, 
-0x10C4, 0x2968, 0x2967, 0x2988, 0x2126, 0x1083, 0x0842, 0x0020, 0xC44E, 0xC44E, 0x5228, 0x0000, 0x1063, 0x18C4, 0x2968, 0x2967, 
-0x2967, 0x2968, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x836C, 0x2105, 0x2126, 0x2967, 0x2967, 0x2126, 0x18C4, 0x0842, 0x20E3, 0xAC0E, 0xC42E, 0xC40D, 
-0x6289, 0x0000, 0x18C4, 0x18C4, 0x2967, 0x2967, 0x2967, 0x2968, 0x0000, 0xB44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x0000, 0x2126, 0x2988, 0x2147, 0x2988, 0x1905, 
-0x1083, 0x0021, 0x18C2, 0xC42E, 0xC40D, 0xC40D, 0xBC6F, 0x41C6, 0x0000, 0x18E5, 0x2988, 0x2967, 0x2967, 0x2968, 0x0000, 0xBC4F, 
-0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 
-0x1061, 0x2126, 0x2967, 0x2967, 0x2147, 0x18C4, 0x0842, 0x20E3, 0x8B8D, 0xC42E, 0xC40D, 0xC42E, 0xC40D, 0x93AD, 0x0000, 0x18E5, 
-0x2126, 0x2967, 0x2967, 0x2967, 0x0021, 0x834C, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x1061, 0x2126, 0x2967, 0x2147, 0x18C4, 0x1063, 0x0000, 0x6269, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xB42F, 0x18C3, 0x0822, 0x0863, 0x2147, 0x2967, 0x2967, 0x31C9, 0x0000, 0x938C, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC46F, 0x1061, 0x2126, 0x2988, 0x18C4, 
-0x1063, 0x1084, 0x0000, 0x5207, 0xC44E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAC2F, 0x0000, 0x3166, 0x39C8, 0x2147, 0x2147, 
-0x2988, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44F, 0x18A2, 0x2126, 0x2988, 0x18C4, 0x1063, 0x1083, 0x1083, 0x0841, 0x41A6, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA3EE, 0x20C2, 0xDE13, 0xB510, 0x2987, 0x2147, 0x2988, 0x0000, 0xA3EE, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x18A2, 0x0842, 0x2126, 0x2147, 0x2147, 0x2106, 0x0021, 
-0x2924, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA40E, 0x18A1, 0xBCEE, 0x93EB, 0x31A8, 0x2168, 0x0000, 0xA40E, 0xC40D, 
-0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 
-0x3965, 0x10A4, 0x2988, 0x2988, 0x2126, 0x0021, 0x3144, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x3143, 
-0xB4AD, 0x4209, 0x2147, 0x1905, 0x2104, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3124, 0x0862, 0x31A9, 0x2967, 0x2126, 0x0021, 0x3144, 0xC42E, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40E, 0xC40D, 0xC44F, 0x0000, 0x41C6, 0x2125, 0x2126, 0x31C9, 0x0000, 0x72EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xB44F, 0x39C7, 0x10C4, 0x2988, 
-0x2106, 0x0021, 0x3965, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x8B8D, 0x0841, 0x0842, 0x2126, 0x29A8, 
-0x0000, 0x836C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6268, 0x0020, 0x31C9, 0x2126, 0x1063, 0x20E3, 0xB42F, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 
-0xC40D, 0xC42E, 0x20E3, 0x0842, 0x2147, 0x29A8, 0x0000, 0x836C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x2104, 0x1906, 0x2988, 0x2967, 0x0842, 0x0020, 
-0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44F, 0x1082, 0x0842, 0x2106, 0x2988, 0x0000, 0x8B6C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 
-0x938C, 0x0000, 0x31A9, 0x2126, 0x0842, 0x18A2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x41C6, 0x1062, 
-0x0842, 0x2126, 0x0021, 0x7B0B, 0xC42E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93AD, 0x0021, 0x2988, 0x2126, 0x0862, 0x18A2, 0xC44F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC44E, 0x3985, 0x0021, 0x2126, 0x29A8, 0x0842, 0x6289, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA3EE, 0x0000, 0x20E4, 
-0x4985, 0x4165, 0x2103, 0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC42E, 0x3985, 0x0021, 0x2126, 0x31A9, 0x0021, 
-0x6269, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAC2F, 0x3124, 0x3924, 0x4165, 0x51C6, 0x49A5, 0x0000, 0xC46F, 0xC40D, 0xC40E, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC42E, 0x3985, 0x0021, 0x10A4, 0x2147, 0x0842, 0x6A89, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40E, 0xC40D, 0x8B6C, 0x0000, 0x6207, 0x51A6, 0x49A5, 0x4985, 0x3103, 0x5207, 
-0xC46F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41A5, 0x0020, 0x0842, 0x2106, 0x0842, 0x6A89, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0x49E7, 0x30E3, 
-0x51A6, 0x49A5, 0x49A5, 0x51A6, 0x59E7, 0x0000, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x93CD, 0x2125, 0x18E5, 0x1906, 
-0x2168, 0x0842, 0x6A89, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4A07, 0x0820, 0x6227, 0x4985, 0x51A6, 0x51C6, 0x51C6, 0x59E7, 0x0000, 0xAC2F, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x9BCD, 0x0000, 0x20E5, 0x3167, 0x2946, 0x3146, 0x0821, 0x6AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC6F, 0xBC4F, 0x5A68, 0x28A2, 0x51C6, 0x51C6, 0x4985, 0x20A2, 0x28A2, 
-0x2082, 0x41A6, 0xC44F, 0xC44E, 0xB44F, 0xBC6F, 0xA3EE, 0x0000, 0x28C3, 0x30E3, 0x28C3, 0x28C3, 0x30C3, 0x0800, 0x62A9, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBC4F, 0x18A2, 0x0000, 0x3924, 
-0x59E6, 0x51A5, 0x4985, 0x4165, 0x49E7, 0x49E7, 0x39A6, 0xC44F, 0xC42E, 0x6AAA, 0x0000, 0x0000, 0x0000, 0x3104, 0x28E3, 0x28C3, 
-0x28C3, 0x28C3, 0x30E4, 0x0800, 0x62A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC44F, 0x1061, 0x4164, 0x51C6, 0x51A6, 0x49A5, 0x51C6, 0x2081, 0x5228, 0xC40D, 0xC42E, 0xC42E, 0xC40D, 0x6AAA, 0x0000, 
-0x3104, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x30E4, 0x0800, 0x62A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
@@ -1,2591 +0,0 @@
-// Total bitmap data size: 81000 bytes
-
-// zombie1_walk_right_10.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_right_10_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3123, 0x1061, 0x1081, 0x0840, 0x51A5, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x3123, 0x3986, 
-0x4A28, 0x4A08, 0x4A08, 0x20E4, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x3923, 0x3986, 0x5A69, 0x62AA, 0x4A08, 0x7B6C, 0xBD30, 0x62C8, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3924, 0x3986, 0x5A8A, 0x5A8A, 0x41C8, 0x6B0B, 0xBD30, 0xEE74, 
-0xC571, 0x3964, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4165, 0x3986, 0x62AA, 
-0x5A69, 0x49E8, 0x6AEB, 0xBD30, 0xDE33, 0xBD0F, 0xBD2F, 0xE693, 0x49E5, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6A47, 0x18C3, 0x6AEB, 0x5A69, 0x5249, 0x6B0B, 0xBD50, 0xDDF2, 0xC550, 0xC54F, 0xCDB1, 0xCDB3, 0xC52F, 0x49E5, 
-0x51C5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x18A2, 0x628A, 0x5A69, 0x5249, 0xC550, 0xD5F2, 0xCDB2, 
-0xA42C, 0xAC6E, 0xCD92, 0x61E7, 0xCD91, 0xC54F, 0x5A67, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x18A2, 
-0x628A, 0x5A69, 0x5249, 0xA48F, 0xCD91, 0xD612, 0x9BCD, 0x48E5, 0x7289, 0xD5F2, 0xCD91, 0xCD91, 0xDDF3, 0x49E6, 0x51C6, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x18A2, 0x62AA, 0x5A69, 0x5A69, 0x5229, 0xA48F, 0xD5D2, 0xC571, 0xC550, 0xC571, 0xCD91, 
-0xCD91, 0xD5D2, 0x6208, 0x3884, 0x1862, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x18C3, 0x62CB, 0x5A69, 0x5249, 0xA48F, 
-0xACAE, 0x9C0B, 0xB4EF, 0xD5F2, 0xCD91, 0xC591, 0xCD91, 0xD5D2, 0x59A7, 0x2002, 0x938C, 0x736A, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBED, 0x6206, 0x2904, 0x62AA, 0x5A8A, 0xC591, 0xCDB1, 0xBD0F, 0xACAE, 0xACAE, 0xCDB1, 0xC591, 0xCD91, 0xD5D2, 0x5186, 0x0801, 
-0x9BAC, 0x8BCA, 0x20A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x2103, 0x20E3, 0x730B, 0xD5F3, 0xE653, 0xBD0F, 0xBD0F, 
-0xCDD2, 0xCDB2, 0xCDB2, 0xD5D2, 0x8B6B, 0x8B4A, 0x6AA8, 0x3123, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 
-0x6227, 0x18A3, 0x41E6, 0xB4EF, 0xE674, 0xBD50, 0xACAD, 0xB4EE, 0xB4CE, 0xB4CE, 0xC54F, 0x8BCA, 0x2903, 0xAB6B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 0x4985, 0x49E6, 0xB50F, 0xC571, 0xA44C, 0x93EB, 0x9C0B, 0x9C0B, 
-0x7B49, 0x2903, 0xA36B, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 
-0x5226, 0xF6B4, 0xCD91, 0xA46D, 0x9C2C, 0xB4AD, 0x18A2, 0x92EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x5267, 0xCDB2, 0xBD51, 0xCD91, 0xAC8D, 0x93EB, 0x2903, 0x8AE9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x2126, 0x422D, 0x62ED, 0xD5B1, 
-0xC551, 0x18C2, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x51A5, 0x2126, 0x4A4D, 0x422C, 0x424C, 0x52AD, 0x528C, 0x0861, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 0x2105, 0x4A4C, 0x4A6D, 0x422C, 0x422C, 0x420C, 0x420C, 0x39EA, 0x18A2, 0xA34B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 0x2105, 0x424C, 0x4A6D, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x424C, 0x4A6D, 0x39EA, 0x3104, 0x3923, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 
-0x2105, 0x4A4C, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x528E, 0x31A9, 0x2947, 0x20E4, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x59E6, 0x2105, 0x4A6D, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x4A6D, 0x52CF, 0x39EA, 0x18C3, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x1082, 0x4A8D, 0x4A4C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x528E, 0x39C9, 0x1881, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 
-0x0862, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 
-0x31A9, 0x20C3, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x1082, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x39EA, 0x1882, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x1062, 0x2988, 0x422C, 0x424C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A4C, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x39EA, 0x18A2, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7A88, 0x0862, 0x31A9, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x422B, 0x2988, 0x2988, 0x2967, 0x422B, 
-0x4A6D, 0x424C, 0x422C, 0x4A4C, 0x4A4C, 0x39EA, 0x18A2, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0862, 0x2988, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x4A4C, 0x420B, 0x2126, 0x2126, 0x2167, 0x10A3, 0x2106, 0x422C, 0x4A4D, 0x422C, 0x424C, 0x4A6D, 0x39CA, 0x18A2, 0xAB8B, 0xC40D, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0861, 0x2988, 0x4A4C, 
-0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x39EA, 0x2968, 0x18C4, 0x0041, 0x18E5, 0x422C, 0x4A4D, 
-0x422C, 0x422C, 0x4A8D, 0x39CA, 0x20C2, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8AE9, 0x0841, 0x39EA, 0x39CA, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4D, 0x4A4D, 
-0x39EA, 0x29A9, 0x18E4, 0x0841, 0x18E5, 0x422C, 0x4A4C, 0x422C, 0x422C, 0x528E, 0x39C9, 0x3104, 0x7247, 0x8AC9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x2967, 0x4A4C, 0x2147, 0x422C, 0x4A4C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x39EA, 0x29A8, 0x18E5, 0x0841, 0x1905, 0x420B, 0x4A4C, 0x422C, 0x422C, 
-0x52AE, 0x31A9, 0x10A3, 0x20E4, 0x930A, 0x82A9, 0x7AA9, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x2105, 0x52CF, 
-0x420B, 0x2967, 0x39EA, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x39EA, 0x2988, 
-0x1905, 0x0841, 0x2105, 0x420B, 0x4A4C, 0x4A4C, 0x422C, 0x4A4D, 0x52AE, 0x39EA, 0x0862, 0x10A3, 0x10A3, 0x7A88, 0x9B4A, 0xBBCD, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18E4, 0x528D, 0x420B, 0x2147, 0x2147, 0x39EA, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x4A4D, 0x39EA, 0x2967, 0x2126, 0x0020, 0x2126, 0x39EA, 0x422B, 0x422B, 0x422C, 0x424C, 0x4A4C, 
-0x4A4C, 0x424C, 0x4A4C, 0x2104, 0x18C2, 0x6A47, 0xBBCD, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18E4, 0x4A8E, 0x420B, 0x2147, 0x2147, 0x2147, 
-0x39EA, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x424C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x39EA, 0x2147, 0x2126, 0x0821, 
-0x0841, 0x2126, 0x2967, 0x39CA, 0x4A4C, 0x4A4C, 0x422B, 0x2147, 0x2147, 0xACAF, 0xE633, 0x5247, 0x0820, 0x51A5, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18E4, 0x4A8D, 0x422C, 0x420B, 0x2967, 0x2146, 0x3A0B, 0x4A4C, 0x422C, 0x424C, 0x4A4C, 0x422C, 0x2988, 0x2967, 0x420B, 0x4A4C, 
-0x422C, 0x424C, 0x422C, 0x422C, 0x39EA, 0x0841, 0xABAC, 0x3124, 0x0841, 0x0841, 0x18E5, 0x31C9, 0x2988, 0x2967, 0x2147, 0xB510, 
-0xDE33, 0xBD30, 0xBD30, 0x62C8, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18E4, 0x4A6D, 0x4A4C, 0x422C, 0x2147, 0x2147, 0x2967, 0x3A0A, 0x528D, 0x420B, 
-0x2988, 0x2988, 0x2126, 0x2126, 0x3A0B, 0x4A4C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x422C, 0x39C9, 0x3144, 0x7AA8, 0x9B2A, 0xA36B, 
-0x51A5, 0x0882, 0x0862, 0x0862, 0x0862, 0xA44C, 0xC52F, 0xCDB1, 0xDE33, 0xC571, 0x6AE9, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x2105, 0x5ACF, 0x4A6D, 0x422C, 
-0x39EA, 0x2967, 0x31A9, 0x31A9, 0x31A8, 0x2967, 0x1906, 0x2146, 0x39EA, 0x39EA, 0x422B, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x4A4C, 0x4A6D, 0x1082, 0x9B2A, 0xC40D, 0xC40D, 0xB3AC, 0x6A47, 0x7A88, 0x7A88, 0x7AA8, 0x3964, 0x3123, 0x8BAB, 0xD5B1, 0xDE33, 
-0xA48E, 0x1061, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3144, 0x2946, 0x2967, 0x4A8D, 0x52AE, 0x2988, 0x3A0B, 0x420B, 0x3188, 0x31A9, 0x31C9, 0x39EA, 0x4A4C, 0x4A4C, 
-0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x424C, 0x1062, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7268, 0x7A88, 0x3944, 0x838A, 0xF6D5, 0xACAE, 0x1061, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x3944, 0x4144, 0x2967, 0x2967, 0x2967, 0x39EB, 0x4A6D, 
-0x4A4D, 0x4A4C, 0x4A4C, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x0841, 0xA34B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x49A5, 0xA48E, 0xD5D2, 0x5247, 0x6207, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBED, 0x3103, 0x3103, 0x18E4, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x424C, 0x422C, 0x18E5, 0x6A27, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x6B09, 
-0xCD91, 0x5247, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28E2, 0x3188, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x528E, 0x18C3, 0x7268, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x1061, 0x1061, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x28C2, 
-0x3188, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x4A6D, 0x10A3, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xBBED, 0xBBED, 0xBBED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x28C2, 0x3188, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x4A4C, 0x4A6D, 0x10A3, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x28C2, 0x3188, 0x4A6D, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A6D, 0x422B, 0x2988, 0x2988, 0x3188, 0x2147, 0x18A3, 0x7AA8, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0x28C2, 0x31A9, 0x528E, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A6D, 0x39EA, 0x2988, 0x31A9, 0x31C9, 0x31A9, 
-0x2147, 0x2147, 0x2147, 0x31A8, 0x1082, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x28C2, 0x2146, 0x39EA, 0x31C9, 0x31C9, 0x39EA, 0x39EA, 0x39EA, 0x39EA, 
-0x39EA, 0x2988, 0x2167, 0x2126, 0x10C4, 0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 0x2105, 0x2904, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x28C2, 0x18E4, 0x2167, 
-0x2147, 0x2126, 0x18E5, 0x18E5, 0x18E5, 0x18E5, 0x18E5, 0x2106, 0x2126, 0x18C4, 0x0842, 0x10A4, 0x2967, 0x2967, 0x2967, 0x2147, 
-0x31A9, 0x18C4, 0x3944, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC3ED, 0x28C2, 0x1905, 0x2988, 0x2988, 0x2105, 0x0842, 0x1063, 0x1063, 0x1063, 0x1062, 0x0842, 0x1062, 0x1083, 
-0x1083, 0x18C4, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x10C3, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x28C2, 0x1905, 0x2988, 0x2967, 0x2126, 0x1083, 0x1083, 
-0x1083, 0x10A4, 0x0820, 0x1881, 0x1882, 0x1083, 0x1083, 0x18A4, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x10A3, 0x51A5, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x28C2, 
-0x18E5, 0x2988, 0x2967, 0x2967, 0x2126, 0x1083, 0x1083, 0x1083, 0x0841, 0xA34B, 0x7A88, 0x0841, 0x1083, 0x18C4, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2988, 0x18C4, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28E2, 0x18E5, 0x2988, 0x2967, 0x2967, 0x2126, 0x1083, 0x1083, 0x0841, 0x8AE9, 0xC40D, 
-0xC40D, 0x6227, 0x0841, 0x18C4, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x18C4, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3123, 0x18E5, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2147, 0x1083, 0x10A4, 0x0020, 0x932A, 0xC40D, 0xC40D, 0x6A27, 0x0841, 0x18A4, 0x18C4, 0x2167, 0x2967, 0x2967, 0x2967, 0x2988, 
-0x18E4, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 
-0x1041, 0x2126, 0x2988, 0x2947, 0x2967, 0x2126, 0x18A4, 0x1083, 0x1061, 0x7268, 0xBBED, 0xC40D, 0xC40D, 0xB3CC, 0x59C6, 0x0841, 
-0x1083, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E4, 0x3923, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x1881, 0x2126, 0x2968, 0x2967, 0x2968, 0x2106, 0x1063, 0x1083, 0x0820, 0xB3CC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x0820, 0x18A4, 0x18E5, 0x2147, 0x2967, 0x2967, 0x2988, 0x18C4, 0x4144, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x1881, 0x2126, 0x2968, 0x2967, 
-0x2988, 0x2126, 0x1062, 0x1082, 0x59E6, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x4144, 0x1062, 0x1063, 0x2147, 0x2967, 
-0x2967, 0x2968, 0x2126, 0x20E3, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x1881, 0x2126, 0x2968, 0x2967, 0x2147, 0x18E5, 0x1062, 0x1061, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x0020, 0x1083, 0x2105, 0x2147, 0x2967, 0x2947, 0x29A8, 0x2126, 0x1061, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x18A2, 0x2126, 0x2968, 0x2967, 0x10A5, 0x0842, 0x1082, 0x4164, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x20C2, 0x1062, 0x1062, 0x2126, 0x2967, 0x2967, 0x2988, 0x1905, 
-0x20A2, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0841, 0x2147, 0x2967, 
-0x2147, 0x31A8, 0x39A7, 0x18A3, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x1061, 
-0x1062, 0x2126, 0x2967, 0x2967, 0x2988, 0x1905, 0x20A2, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8B, 0x0841, 0x2147, 0x2967, 0x10C6, 0x83AD, 0xEE74, 0x838B, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x1061, 0x1083, 0x1083, 0x2106, 0x2967, 0x2988, 0x1905, 0x20A2, 0xBBED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x0841, 0x2146, 0x1927, 0x6AE9, 0xC50F, 0x7B49, 0x3124, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 0x1083, 0x1063, 0x2126, 0x2106, 
-0x0862, 0x3103, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x28E3, 0x2105, 
-0x2147, 0x1906, 0x9C2D, 0x7B28, 0x3944, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xABAC, 0x1061, 0x1083, 0x1063, 0x2126, 0x2968, 0x10A3, 0x3924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x0841, 0x2988, 0x2967, 0x2168, 0x4A08, 0x18A2, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 0x1083, 0x1062, 0x1905, 0x31A9, 0x18E5, 0x3923, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0841, 0x2967, 0x2967, 0x2126, 0x0864, 0x0001, 
-0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 0x1063, 0x18C5, 
-0x2147, 0x2988, 0x18E4, 0x3923, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 
-0x0841, 0x2967, 0x2967, 0x10A4, 0x0862, 0x20C2, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xABAC, 0x1061, 0x1062, 0x2147, 0x2968, 0x29A8, 0x18E5, 0x28E2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6A27, 0x10A3, 0x2967, 0x2967, 0x18C4, 0x0020, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 0x1062, 0x2126, 0x2968, 0x2147, 0x18C3, 0x6206, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x0882, 0x2988, 0x2967, 0x2147, 0x18C4, 
-0x0821, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 
-0x1062, 0x2126, 0x2988, 0x10A3, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7A88, 0x0862, 0x2988, 0x2147, 0x10A4, 0x1083, 0x0841, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 0x1062, 0x2126, 0x2988, 0x10C3, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0862, 0x2988, 0x2947, 0x10A4, 0x0841, 0x7268, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 0x1062, 0x2126, 0x2988, 0x10C3, 
-0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0862, 0x2988, 0x2947, 
-0x10A4, 0x0020, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xABAC, 0x1061, 0x0842, 0x2126, 0x29A8, 0x10C3, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7A88, 0x0862, 0x2988, 0x2947, 0x1083, 0x0000, 0x9B4A, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 0x18E5, 0x2947, 0x2988, 0x10A3, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0862, 0x2988, 0x2167, 0x2106, 0x18E5, 0x3124, 0xB3AC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 0x2146, 0x2968, 
-0x2168, 0x1926, 0x18C3, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0861, 
-0x2926, 0x2926, 0x2946, 0x3167, 0x20C3, 0x28E2, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xABAC, 0x1061, 0x2126, 0x2168, 0x3167, 0x41A8, 0x3166, 0x1881, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x1041, 0x30C3, 0x28C3, 0x28C3, 0x28C3, 0x3104, 0x20A2, 0x3103, 0x9B4B, 0x82C9, 0x930A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 0x2946, 0x3167, 0x4986, 0x51A5, 0x59E6, 0x4985, 
-0x1081, 0x8AEA, 0x8AE9, 0x82A9, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x1041, 0x30E4, 0x28C3, 0x28C3, 0x28C3, 
-0x28C3, 0x3104, 0x20A2, 0x0820, 0x0841, 0x1061, 0x9B2B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 
-0x4165, 0x51A5, 0x51A5, 0x49A5, 0x49A5, 0x51C6, 0x4985, 0x1061, 0x1061, 0x1061, 0x6A27, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7A88, 0x1041, 0x30E4, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28E3, 0x30E4, 0x28C3, 0x1061, 0xAB8B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 0x4165, 0x51A6, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x51A6, 0x51A6, 0x51A6, 0x59C6, 
-0x1882, 0x7248, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_right_1.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_right_1_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7248, 0x0840, 0x1081, 0x1081, 0x1061, 0x1061, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x20E3, 0x5249, 0x4A08, 0x49E7, 0x41A7, 0x41C7, 
-0x1082, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x2904, 
-0x5249, 0x62AA, 0x5249, 0x5A8A, 0xACCF, 0xACD0, 0xA48E, 0x2923, 0xA36B, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x3986, 0x6AEB, 0x4A08, 0x5A69, 0xAC8F, 0xD5D2, 0xD5D2, 0xEE94, 0x8BAB, 0x1881, 0xA36B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x3124, 0x4A08, 0x5A69, 0x62CA, 0xA48F, 0xDE12, 
-0xCD91, 0xCDB2, 0xAC8D, 0xEEB4, 0xA48D, 0x18A1, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1061, 
-0x4A08, 0x6ACB, 0x49E8, 0x8BCC, 0xE633, 0xC571, 0xC591, 0xBD50, 0xC590, 0xCDD2, 0xDDF2, 0x8B8A, 0x20A2, 0xA36B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x20C2, 0x41C7, 0x62AA, 0x4A08, 0x83AC, 0xDE12, 0xCD91, 0xC571, 0x8B4A, 0xDE54, 0x82EB, 
-0x938C, 0xDE32, 0x8BCB, 0x2923, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x20C2, 0x41C7, 0x62AA, 0x4A08, 0x7B4C, 
-0xCD91, 0xCDB1, 0xC551, 0x6A08, 0x4905, 0xAC6E, 0xD5F2, 0xCD91, 0xDDF2, 0x9C0D, 0x1881, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBED, 0x20A2, 0x41C7, 0x62AA, 0x5A69, 0x5229, 0x7B4B, 0xD5D2, 0xC591, 0xC571, 0xC550, 0xC571, 0xC591, 0xD612, 0x9BED, 0x3063, 
-0x3083, 0x1881, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1881, 0x41E7, 0x5A6A, 0x83AC, 0xC571, 0xACCE, 0xA46D, 0xCD91, 0xCDB1, 
-0xCDB1, 0xCD91, 0xD612, 0x93AC, 0x38A4, 0x3064, 0x2843, 0x0841, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x20A2, 0x3986, 
-0xACD0, 0xEEB4, 0xC571, 0xBD0F, 0xC591, 0xCDB2, 0xCD91, 0xC571, 0xDE33, 0x7AEA, 0x0800, 0x59A7, 0xACAF, 0x0861, 0xAB6B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB6B, 0x20C3, 0x2944, 0x8BEC, 0xEE94, 0xCD91, 0xC571, 0xB4AE, 0xC571, 0xCDB2, 0xD613, 0xA44D, 
-0x7AC9, 0x8B6A, 0x4A46, 0x7A88, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x6206, 0x3964, 0x942D, 0xE654, 
-0xC571, 0x9BEB, 0xAC8D, 0xB4EF, 0xB4CE, 0xC52F, 0xAC6C, 0x3984, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC3ED, 0xC40D, 0xC40D, 0xAB8C, 0x3103, 0x942D, 0xCD91, 0xB4CE, 0x9C0B, 0x93EB, 0xAC6C, 0x9BEB, 0x3164, 0x7A88, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x1081, 0xD5D1, 0xDDF2, 0xB4CE, 0xA44C, 
-0x9BEB, 0x3964, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x18C2, 0xB510, 0xB530, 0xCDB2, 0xCD90, 0x41A4, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x1082, 0x422C, 0x420C, 0xACD0, 0xE653, 0x5267, 0x51C6, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x1082, 0x422C, 0x422C, 0x422C, 
-0x528C, 0x62EE, 0x2125, 0x0000, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8AEA, 0x10A3, 0x422B, 0x4A6D, 0x422C, 0x424C, 0x420C, 0x420C, 0x39EA, 0x39EA, 0x2946, 0x28C2, 0x4144, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x18A3, 0x420B, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A8D, 
-0x420B, 0x2968, 0x2967, 0x4165, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x18A3, 0x420B, 0x528E, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x528E, 0x422B, 0x0020, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 
-0x18C3, 0x420B, 0x528E, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422B, 0x2105, 
-0x6207, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1061, 0x39CA, 0x528E, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 
-0x4A4C, 0x424C, 0x422C, 0x422C, 0x4A4C, 0x4A6D, 0x0862, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x20C2, 0x31A8, 0x4A6D, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422B, 0x3A0B, 0x422B, 0x422C, 0x422C, 0x4A4C, 0x422C, 0x0861, 0x9B4B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBED, 0x20C2, 0x31A9, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x31A8, 0x2126, 0x31C9, 0x4A4D, 0x422C, 
-0x424C, 0x422C, 0x1082, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x20C2, 0x31A9, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x4A4C, 0x31A8, 0x2126, 0x31C9, 0x4A4D, 0x422C, 0x422C, 0x424C, 0x422C, 0x18A3, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x20C2, 0x1905, 0x420B, 
-0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x2988, 0x2146, 0x31C9, 0x4A4C, 0x422C, 0x424C, 0x4A6D, 0x0862, 
-0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x20C2, 0x10C4, 0x420B, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422C, 0x2988, 
-0x2988, 0x4A6D, 0x422C, 0x422C, 0x424C, 0x39EA, 0x2104, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x18C3, 0x2126, 0x2988, 0x3A0B, 0x4A4C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x39CA, 0x2147, 0x39EA, 0x424C, 0x422C, 0x422C, 0x52AE, 0x18A3, 0x7247, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0820, 0x31A9, 
-0x31A9, 0x1926, 0x31A9, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x31C9, 0x1905, 0x2988, 0x4A6D, 0x422C, 
-0x422C, 0x4A4D, 0x31A8, 0x3945, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x420B, 0x31A9, 0x2126, 0x39CA, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x4A4C, 0x3A0A, 0x2967, 0x2968, 0x3A0B, 0x422C, 0x422C, 0x422C, 0x5ACF, 0x2126, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x39EA, 0x39EA, 0x2147, 0x31A9, 0x422C, 
-0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x424C, 0x4A6D, 0x39EB, 0x2126, 0x2967, 0x422C, 0x424C, 0x422C, 0x4A6D, 0x2967, 
-0x4144, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x1061, 0x39CA, 0x4A6D, 0x31A9, 0x1926, 0x31A9, 0x4A4D, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x422B, 0x4A4C, 0x39EA, 0x2147, 
-0x2967, 0x422B, 0x424C, 0x422C, 0x422C, 0x528E, 0x3188, 0x2903, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x39EA, 0x4A6D, 0x31A9, 0x2126, 0x31A9, 0x4A4C, 0x422C, 0x422C, 0x422C, 
-0x4A4C, 0x31A9, 0x2126, 0x31C9, 0x4A6D, 0x39EB, 0x2147, 0x2967, 0x422B, 0x424C, 0x422C, 0x424C, 0x4A6D, 0x3188, 0x28E3, 0xBBED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x39EA, 0x4A6D, 0x422C, 
-0x31A9, 0x2147, 0x2968, 0x2988, 0x4A4C, 0x4A4D, 0x31A9, 0x2147, 0x2126, 0x31A9, 0x4A6D, 0x3A0B, 0x2146, 0x2147, 0x2967, 0x422B, 
-0x4A6D, 0x424C, 0x4A4C, 0x4A4C, 0x3188, 0x2903, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x0841, 0x420B, 0x52AE, 0x528E, 0x4A8D, 0x39EA, 0x2988, 0x39EA, 0x2988, 0x2988, 0x2146, 0x1926, 0x31A9, 0x422C, 
-0x4A4C, 0x422C, 0x39EA, 0x2988, 0x2968, 0x2988, 0x2988, 0x3A0B, 0x4A6D, 0x4A6D, 0x4A6D, 0x2968, 0x3103, 0xBBED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x18E4, 0x2105, 0x18E4, 0x2105, 0x10A3, 0x2105, 0x4A4D, 
-0x39CA, 0x31C9, 0x39EA, 0x39CA, 0x422B, 0x4A4C, 0x422C, 0x4A4C, 0x420B, 0x0841, 0x0021, 0x2126, 0x2988, 0x31A9, 0x39CA, 0x31A8, 
-0x39EA, 0x528D, 0x3188, 0x4164, 0x3944, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 
-0x59E6, 0x6206, 0x6A47, 0x3944, 0x1082, 0x4A6D, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x422C, 0x422C, 0x4A4C, 0x420B, 0x2105, 
-0x2105, 0x10A3, 0x0882, 0x0841, 0x18C4, 0x2988, 0x2988, 0x39EA, 0x420B, 0x0043, 0x5A88, 0x51C5, 0x6206, 0x930A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x10A3, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A8E, 0x52AE, 0x2126, 0x1083, 0x18C3, 0x10C3, 0x10A3, 0x18C4, 0x2167, 0x2147, 0x52AA, 
-0xD613, 0x8BEC, 0x4A06, 0x3984, 0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 
-0x10A3, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x4A8D, 0x52AF, 
-0x31A8, 0x0841, 0x18A3, 0x1905, 0x1905, 0xCDB1, 0xD5F2, 0xD5D2, 0xF6D5, 0xA48E, 0x28E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x10A3, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A6D, 0x39A9, 0x20A2, 0x20C2, 0x940C, 0xCDB2, 0xCDB1, 0xC571, 0xDE13, 
-0xA48E, 0x20E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x10A3, 0x4A6D, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A6D, 0x3188, 0x28C2, 0xBBED, 
-0xBBCC, 0x28E3, 0x93EC, 0xD5F2, 0xCDB2, 0xB4CE, 0xACAD, 0xACAF, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7A88, 0x10A3, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x4A4C, 0x4A4C, 0x4A8D, 0x3188, 0x28C2, 0xC40D, 0xC40D, 0xB3CC, 0x3123, 0x8BCC, 0xF6B5, 0x7329, 0x3143, 0xA44C, 0x1081, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7248, 0x18C3, 0x52AE, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 
-0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A6D, 0x39CA, 0x2988, 0x31A9, 0x2126, 0x28C2, 0xC40D, 0xC40D, 0xC40D, 0x20C2, 0x8BCC, 
-0xFF77, 0x838B, 0x0000, 0x20E2, 0x0841, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x59E6, 0x2105, 
-0x31A9, 0x31A9, 0x31A9, 0x31A9, 0x31A9, 0x31A9, 0x31A9, 0x31A9, 0x31A9, 0x31A9, 0x31A9, 0x31C9, 0x2988, 0x2147, 0x2967, 0x18E5, 
-0x28C2, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x41A5, 0x5A67, 0x49C5, 0x930A, 0x7AA8, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x0020, 0x2968, 0x2147, 0x2147, 0x2146, 0x2147, 0x2167, 0x2167, 0x2167, 0x2167, 0x2167, 
-0x2967, 0x18E5, 0x18C4, 0x2126, 0x2988, 0x18E4, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x51A5, 0x932A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4164, 0x18E4, 0x2147, 0x2967, 0x2968, 
-0x2126, 0x18E5, 0x2106, 0x2106, 0x2105, 0x2105, 0x2106, 0x1083, 0x0821, 0x18E5, 0x2988, 0x2126, 0x20C3, 0x7AA9, 0xC3ED, 0xC40D, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xB3CC, 0x0840, 0x2146, 0x2968, 0x2147, 0x18A4, 0x1062, 0x0862, 0x0842, 0x1083, 0x1063, 0x1062, 0x10A4, 0x18C4, 0x2126, 
-0x2967, 0x2988, 0x2147, 0x0840, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0841, 0x2147, 0x2988, 0x18A4, 0x1063, 0x1084, 0x0862, 0x0020, 
-0x1083, 0x1083, 0x10A4, 0x2147, 0x2988, 0x2967, 0x2967, 0x2968, 0x2126, 0x1881, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x1882, 0x2126, 
-0x2988, 0x18C5, 0x1083, 0x1083, 0x1083, 0x1062, 0x0020, 0x1083, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x2126, 0x1881, 
-0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x1882, 0x2126, 0x2988, 0x18E5, 0x1063, 0x1084, 0x1062, 0x0020, 0x1083, 0x1083, 0x2126, 
-0x2967, 0x2967, 0x2967, 0x2968, 0x2126, 0x1881, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x1881, 0x2126, 0x2988, 0x18E5, 0x1063, 
-0x1083, 0x1083, 0x0862, 0x0821, 0x1062, 0x2147, 0x2968, 0x2967, 0x2967, 0x2968, 0x2126, 0x1881, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB3AC, 0x0840, 0x2146, 0x31A8, 0x18C4, 0x1062, 0x1083, 0x1083, 0x1083, 0x0000, 0x1083, 0x18C4, 0x2126, 0x2967, 0x2967, 0x2968, 
-0x2126, 0x1881, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7AA8, 0x20C3, 0x2126, 0x2147, 0x18C4, 0x1083, 0x1083, 0x1083, 0x0862, 
-0x0841, 0x0842, 0x2126, 0x2988, 0x2967, 0x2968, 0x2126, 0x1881, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28E3, 0x18E4, 
-0x31A9, 0x2106, 0x1063, 0x1083, 0x10A3, 0x18A4, 0x0000, 0x1062, 0x18E5, 0x2147, 0x2967, 0x2968, 0x2105, 0x1881, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28E3, 0x18E5, 0x2988, 0x1905, 0x1063, 0x1083, 0x1083, 0x1082, 0x4144, 0x18A2, 0x0842, 0x1905, 
-0x2988, 0x2968, 0x2126, 0x18A3, 0x7A88, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x20C3, 0x2105, 0x2988, 0x2106, 0x0862, 0x0843, 
-0x0842, 0x1061, 0xC40D, 0x3944, 0x0842, 0x18E5, 0x2147, 0x2147, 0x2968, 0x2967, 0x0840, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x1061, 
-0x2126, 0x2988, 0x2967, 0x18C5, 0x1083, 0x2925, 0x2104, 0x0861, 0xBBED, 0x3923, 0x0862, 0x1083, 0x1063, 0x18C4, 0x2988, 0x2147, 
-0x0841, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x1061, 0x2126, 0x2988, 0x18E5, 0x0001, 0x5228, 0xDE33, 0xACCF, 0x18A2, 0xB3CC, 0x3123, 
-0x0862, 0x1083, 0x1063, 0x18C4, 0x2988, 0x2146, 0x1061, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x1881, 0x2126, 0x29A8, 0x0884, 0x41C6, 
-0xB4CE, 0x9C2C, 0x2923, 0xA36B, 0x3103, 0x1062, 0x1063, 0x18E5, 0x2147, 0x2967, 0x2126, 0x1882, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x1881, 0x2126, 0x2106, 0x0002, 0x6AE9, 0xA42B, 0x2903, 0xA36B, 0xBBED, 0x1881, 0x1083, 0x1063, 0x18E5, 0x2988, 0x2988, 
-0x2105, 0x1881, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x4985, 0x18E4, 0x2967, 0x18C4, 0x0842, 0x3986, 0x3165, 0x1882, 0xC40D, 0xBBCD, 
-0x1881, 0x0862, 0x18E5, 0x2147, 0x2967, 0x2988, 0x2147, 0x0840, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0820, 0x2967, 0x29A8, 0x18C5, 
-0x1083, 0x0842, 0x1882, 0x82C9, 0xC40D, 0xBBCD, 0x1881, 0x0862, 0x2126, 0x2988, 0x2967, 0x2126, 0x18C3, 0x7247, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xB3AC, 0x0841, 0x2146, 0x2146, 0x10A4, 0x18A4, 0x0862, 0x4144, 0xC40D, 0xC40D, 0xBBCD, 0x1882, 0x0842, 0x2106, 0x2967, 
-0x2988, 0x18E4, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7A88, 0x10A2, 0x2967, 0x10A4, 0x1063, 0x1083, 0x1062, 0x6A47, 0xC40D, 
-0xC40D, 0xBBCD, 0x1881, 0x1083, 0x2126, 0x2967, 0x2988, 0x1905, 0x28C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x0841, 0x2988, 0x2967, 
-0x10A4, 0x1083, 0x0841, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x1882, 0x2126, 0x2968, 0x2967, 0x2988, 0x1905, 0x20C2, 0xC3ED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x930A, 0x0861, 0x2947, 0x10A4, 0x1083, 0x10A4, 0x0841, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1882, 0x2105, 
-0x2968, 0x2967, 0x2988, 0x18E5, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 0x2167, 0x1083, 0x1083, 0x0841, 0x6207, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1882, 0x2105, 0x2968, 0x2988, 0x18E4, 0x3924, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x1881, 0x28C3, 
-0x28E4, 0x2126, 0x2167, 0x0882, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x3103, 0x1905, 0x2967, 0x2967, 0x2988, 0x18C4, 0x4144, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8AEA, 0x18A2, 0x20C3, 0x30E4, 0x28C3, 0x2905, 0x3125, 0x1062, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xAB6B, 0x0841, 
-0x2147, 0x2968, 0x2967, 0x2988, 0x10C4, 0x4185, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x1061, 0x3904, 0x28C3, 0x28C3, 0x28C3, 0x30C3, 0x1041, 
-0x7247, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x1061, 0x2126, 0x2967, 0x2167, 0x2168, 0x2946, 0x28E2, 0x7AA9, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x1061, 
-0x3904, 0x30E4, 0x28C3, 0x28C3, 0x30E4, 0x0841, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x0840, 0x2947, 0x2168, 0x3167, 0x3166, 
-0x49C7, 0x4985, 0x1881, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x1882, 0x20A3, 0x20A3, 0x30E4, 0x30E4, 0x30E4, 0x1882, 0x51A5, 0x930A, 0xA36B, 0xC40D, 
-0xB3AC, 0x3944, 0x18E4, 0x2967, 0x4986, 0x59A5, 0x51A5, 0x51C6, 0x49A5, 0x1881, 0x82A9, 0x8AE9, 0x82A9, 0xBBCC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x1881, 0x20C2, 0x20C3, 0x20A3, 
-0x28C3, 0x3104, 0x1882, 0x0820, 0x28E3, 0xB3AC, 0xC40D, 0xC3ED, 0x1882, 0x4144, 0x51C6, 0x49A5, 0x49A5, 0x49A5, 0x51A6, 0x51A6, 
-0x1061, 0x1061, 0x1081, 0x59E6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC3ED, 0xAB8B, 0x0840, 0x0000, 0x20A3, 0x30E3, 0x28E3, 0x3104, 0x20A2, 0x28C2, 0xC40D, 0xBBCD, 0x1881, 0x3944, 
-0x51C6, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x51A6, 0x51A6, 0x59E6, 0x20A2, 0x61E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_right_2.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_right_2_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3123, 0x0841, 0x3165, 0x5A8A, 0x5249, 0x5249, 0x5249, 0x5228, 0x1882, 0x9B4B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x3123, 0x3986, 0x4A08, 0x5249, 0x5A8A, 0x5A8A, 0x5A69, 
-0x5229, 0x5229, 0x41C7, 0x18C2, 0x92EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3923, 0x3986, 
-0x5A69, 0x62AA, 0x5A8A, 0x5229, 0x41C8, 0x5A8A, 0xACAF, 0xAC8F, 0xB510, 0x18A2, 0x8AEA, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4164, 0x3986, 0x5A8A, 0x5A8A, 0x5A69, 0x41E8, 0x6AEB, 0x9C4E, 0xA48F, 0xD5F2, 0xDE12, 0xDE33, 0x9C6D, 
-0x41A5, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1081, 0x62AA, 0x5A89, 0x5A69, 0x5249, 0x6AEB, 0xB4EF, 
-0xE633, 0xDE13, 0xCDD1, 0xAC8D, 0xAC6D, 0xDDF2, 0x4A06, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1081, 
-0x628A, 0x5A69, 0x5A69, 0x49E8, 0xA46E, 0xE633, 0xC550, 0xAC8E, 0x9C0D, 0xC5B0, 0xCDD1, 0xBCEE, 0x2902, 0x7268, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20C3, 0x49E7, 0x5A69, 0x5249, 0x41E8, 0x942E, 0xDE12, 0xC550, 0x8B6A, 0x7249, 0xDE75, 
-0xE6B6, 0xBD0F, 0x5246, 0x51E6, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0861, 0x5228, 0x62CA, 0x5229, 
-0x9C2E, 0xD5F2, 0xC591, 0xCDD2, 0xC550, 0x59A7, 0x5146, 0x8B8A, 0xE653, 0x6AE9, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8B, 0x1061, 0x4A08, 0xB510, 0xAC8D, 0xB4CE, 0xCDB2, 0xC591, 0xCD91, 0xC591, 0xC550, 0xC550, 0xC571, 0xE653, 0x62A8, 
-0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x18A2, 0xA48E, 0xD5F2, 0xAC8D, 0xB4AE, 0xCDB2, 0xC591, 
-0xC591, 0xCD91, 0xCD91, 0xD5D2, 0xEEB5, 0x62A8, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x0841, 
-0xB50F, 0xE653, 0xBD30, 0xC550, 0xCDD2, 0xCDB1, 0xC571, 0xCD91, 0xDE53, 0x7AEA, 0x59C7, 0x4945, 0x2062, 0x6A27, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x82C9, 0x41C5, 0xA48E, 0xDE13, 0xBD30, 0xAC8D, 0xB4EF, 0xD5D2, 0xCDB2, 0x7B0A, 0x38A4, 
-0x2823, 0x3044, 0x1822, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1882, 0x940C, 0xEEB5, 0xACAE, 
-0x93AA, 0xA44C, 0xBD0F, 0xB4CE, 0x2863, 0x3043, 0x3864, 0x82CB, 0x6288, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6A27, 0x5A47, 0xB510, 0xC570, 0xA46C, 0x9C0B, 0x9C0B, 0x9C0B, 0x7AA9, 0x30C4, 0x1001, 0x72E9, 0x6AE8, 0x7A88, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4165, 0x6B09, 0xEEB5, 0xC550, 0xA44C, 0x9C0B, 0xA42C, 
-0x93EB, 0x3964, 0x3123, 0x18A2, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3944, 
-0x5AA8, 0xCDB1, 0xD5D2, 0xC550, 0xA44C, 0x9C0C, 0x1081, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3944, 0x0000, 0x5A88, 0xDE33, 0xCD91, 0xC570, 0xA42C, 0x1081, 0x9B2A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3944, 0x2967, 0x420B, 0x39EA, 0x6B71, 0xB577, 
-0xD5B1, 0xC550, 0x18A2, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3944, 
-0x2947, 0x424C, 0x4A6D, 0x422C, 0x420C, 0x6B51, 0xBD77, 0xCDB1, 0xACCE, 0x28E3, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x3944, 0x2947, 0x4A4C, 0x4A4C, 0x422C, 0x424C, 0x420B, 0x422C, 0x6B51, 0xB556, 0xDE33, 0xB4CD, 
-0x2902, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4185, 0x2947, 0x4A6D, 0x4A4C, 0x422C, 0x4A4C, 0x4A4D, 
-0x4A4C, 0x420B, 0x3A0B, 0x6B51, 0xB535, 0xD617, 0x8C11, 0x3146, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1082, 
-0x4A8D, 0x4A4C, 0x422C, 0x424C, 0x3A0B, 0x31C9, 0x3A0B, 0x4A4C, 0x422B, 0x39EA, 0x6B52, 0x8C56, 0xBDBC, 0x422A, 0x4985, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1062, 0x424C, 0x424C, 0x422C, 0x4A4D, 0x31A9, 0x1905, 0x2988, 0x420B, 0x424C, 0x422C, 
-0x31AA, 0x94B6, 0xC5FC, 0x73B0, 0x41A6, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1062, 0x424C, 0x424C, 0x422C, 0x4A4C, 
-0x39CA, 0x2967, 0x2126, 0x2988, 0x4A4C, 0x422C, 0x3A0B, 0x9CD6, 0xCE5B, 0xEF9F, 0x8411, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x1062, 0x424C, 0x424C, 0x422C, 0x422C, 0x4A4C, 0x39EA, 0x2126, 0x2988, 0x4A4C, 0x422C, 0x422C, 0x31AA, 0x9CD6, 0xEF7F, 
-0x738F, 0x3944, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1062, 0x424C, 0x424C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x39CA, 0x2968, 
-0x4A4C, 0x422C, 0x424C, 0x31AA, 0x9CF6, 0xEF9F, 0x6B8F, 0x4144, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1082, 0x4A6D, 0x4A4C, 
-0x422C, 0x422C, 0x422C, 0x4A4C, 0x39EA, 0x2968, 0x4A4C, 0x422C, 0x422C, 0x422B, 0x424C, 0x9CF6, 0xD6BD, 0x6B6F, 0x4165, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7268, 0x18E4, 0x420B, 0x4A4C, 0x422C, 0x422C, 0x4A6D, 0x39EA, 0x2947, 0x4A4C, 0x422C, 0x422C, 0x424C, 
-0x2969, 0x8433, 0xF79F, 0x94B4, 0x1882, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x0841, 0x3A0B, 0x4A4C, 0x422C, 0x4A4C, 0x39EA, 
-0x31A9, 0x39EA, 0x424C, 0x422C, 0x422C, 0x422C, 0x31AA, 0x8C74, 0xEF7F, 0x7C11, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 
-0x1061, 0x420B, 0x4A4C, 0x422C, 0x4A4C, 0x31A9, 0x2988, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x31AA, 0x94B5, 0xEF5F, 0xAD57, 
-0x4A29, 0x7A88, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x1061, 0x420B, 0x4A4C, 0x422C, 0x4A6D, 0x31C9, 0x2988, 0x4A4C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x39EA, 0x6B91, 0xB5B9, 0xE71E, 0xB5D9, 0x0841, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x1061, 0x420B, 0x4A4C, 0x4A4C, 
-0x422C, 0x31A8, 0x3188, 0x4A4D, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x2969, 0x73B1, 0xE75F, 0x9D16, 0x1882, 0xB3CC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA36B, 0x1061, 0x420B, 0x4A4C, 0x424C, 0x31A9, 0x2126, 0x31A8, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x31CA, 
-0x7BD2, 0xE71F, 0x9D16, 0x1881, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x1061, 0x420B, 0x4A6D, 0x31A9, 0x2147, 0x2147, 0x2147, 0x3188, 
-0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x6330, 0xC5FC, 0xA536, 0x18A2, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0841, 0x422C, 
-0x4A6D, 0x420B, 0x420B, 0x422C, 0x31A9, 0x2967, 0x4A4D, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x6B50, 0xA518, 0xAD58, 0x9CF5, 
-0x28E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x8AE9, 0x20C3, 0x420B, 0x4A6D, 0x4A4C, 0x4A4C, 0x422C, 0x39CA, 0x31A9, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x39EA, 0x7371, 0xA519, 0xA518, 0xC61A, 0x10A2, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x0820, 0x2967, 0x4A6C, 0x4A4C, 0x422C, 
-0x4A4C, 0x3A0B, 0x2146, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x420B, 0x4A6D, 0x8413, 0xC65C, 0xB5B9, 0x18A2, 0xA36B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBED, 0x7247, 0x18A3, 0x2988, 0x4A4C, 0x4A4C, 0x424C, 0x422B, 0x31C9, 0x31A9, 0x424C, 0x424C, 0x422C, 0x4A4C, 0x31AA, 0x6B50, 
-0xE71E, 0xB5B8, 0x1061, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28E3, 0x0021, 0x2967, 0x4A4C, 0x4A4C, 0x4A4C, 0x424C, 0x3188, 
-0x31C9, 0x422C, 0x4A4C, 0x422C, 0x39CA, 0x6B71, 0xD6DD, 0xBDFA, 0x52AB, 0x6A47, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x28E2, 0x0841, 
-0x1083, 0x2967, 0x4A4C, 0x4A4C, 0x424C, 0x4A4C, 0x2988, 0x31C9, 0x422C, 0x4A4C, 0x39CA, 0x6B71, 0xD6BD, 0xCE7C, 0xDF1E, 0x2125, 
-0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x28C2, 0x39EA, 0x2947, 0x0841, 0x2988, 0x4A4C, 0x424C, 0x422C, 0x4A4C, 0x2988, 0x31C9, 0x422C, 
-0x39CA, 0x6B71, 0xD6BD, 0xCE5C, 0xC65B, 0x2104, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x28C2, 0x3188, 0x52AF, 0x2126, 0x0041, 0x31A9, 
-0x4A4C, 0x422C, 0x424C, 0x4A4C, 0x2988, 0x31C9, 0x39EB, 0x6B71, 0xD6BD, 0xCE7C, 0xCE5C, 0x2104, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 
-0x28C2, 0x3188, 0x4A8D, 0x4A4C, 0x2126, 0x0020, 0x31A9, 0x4A4C, 0x424C, 0x4A6D, 0x18E7, 0x7B8C, 0x8BEE, 0x5B10, 0xDEFE, 0xD6BD, 
-0xD69C, 0x2104, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1881, 0x39C9, 0x52AF, 0x4A8D, 0x4A4C, 0x2947, 0x0841, 0x31A9, 0x4A4C, 0x1907, 
-0x6B2B, 0xCDB1, 0xCDB1, 0x8BEE, 0x422B, 0x4A8C, 0x4A6C, 0x1082, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x20E4, 0x18C4, 0x2947, 
-0x420B, 0x31A8, 0x10A3, 0x0841, 0x2988, 0x736C, 0xC571, 0xD5D2, 0xDE12, 0x940D, 0x0023, 0x1906, 0x1926, 0x0841, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x6A47, 0x3944, 0x18E5, 0x2968, 0x2967, 0x10A3, 0x0021, 0xBD2F, 0xE653, 0xC571, 0xCDB1, 0xB510, 
-0x630B, 0x2147, 0x18E5, 0x0841, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0862, 0x2988, 0x2967, 0x2988, 
-0x0862, 0x62CA, 0xBD30, 0xCDB1, 0xC571, 0xDE13, 0xBD10, 0x0863, 0x0842, 0x0820, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6207, 0x1083, 0x2988, 0x2967, 0x2967, 0x2988, 0x0065, 0x83ED, 0xDE12, 0xC591, 0xCDB1, 0xACAE, 0x39C7, 0x18C4, 0x0821, 
-0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA8, 0x18A3, 0x2147, 0x2967, 0x2967, 0x2967, 0x10E6, 0x942E, 0xDE12, 
-0xD5F2, 0xACAE, 0x93CA, 0xCDB1, 0x31A8, 0x0821, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x0861, 
-0x2968, 0x2967, 0x2967, 0x10E6, 0x8BED, 0xCDB1, 0xCDD2, 0x734A, 0x1061, 0x93EB, 0x2987, 0x0841, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x0861, 0x2968, 0x2967, 0x2967, 0x2147, 0x2987, 0x31A8, 0x39C9, 0x2105, 0x0000, 0x20E4, 
-0x2967, 0x0841, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0862, 0x2988, 0x2967, 0x2967, 0x2967, 
-0x2147, 0x2127, 0x2147, 0x18E4, 0x0000, 0x1084, 0x2147, 0x0861, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBCC, 0x6207, 0x10A3, 0x2947, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E5, 0x0000, 0x10A4, 0x2947, 0x0840, 0xA36B, 0xC40D, 
-0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0840, 0x2947, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E5, 
-0x0000, 0x10A4, 0x2967, 0x1905, 0x3124, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0841, 0x2988, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E5, 0x0000, 0x1083, 0x1905, 0x31A8, 0x1082, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x3124, 0x1905, 0x2167, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E5, 0x0000, 0x1083, 0x1063, 0x2147, 
-0x1082, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x0841, 0x2126, 0x2967, 0x2967, 0x2967, 
-0x2988, 0x18E5, 0x0000, 0x1083, 0x0863, 0x2967, 0x1082, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xABAC, 0x1061, 0x2126, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E5, 0x0000, 0x1083, 0x2105, 0x2947, 0x1082, 0x82C9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x1061, 0x2126, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E5, 0x0000, 0x2105, 
-0xBD30, 0x2103, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x18A2, 0x2126, 0x2967, 0x18C5, 
-0x1083, 0x2147, 0x1905, 0x0000, 0x2924, 0x9C0B, 0xB4CE, 0x18C2, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x0841, 0x2967, 0x2988, 0x10A3, 0x0862, 0x18C5, 0x0862, 0x0000, 0x39A6, 0xB4AC, 0x3164, 0x7A88, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 0x2967, 0x2967, 0x2126, 0x18C4, 0x0841, 0x0841, 0x0842, 
-0x2105, 0x5269, 0x0020, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 0x2967, 
-0x2967, 0x29A8, 0x2106, 0x0020, 0x0020, 0x18C5, 0x18E5, 0x1083, 0x5A06, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 0x2967, 0x2967, 0x2126, 0x1083, 0x0821, 0x0841, 0x1905, 0x2146, 0x1881, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x0841, 0x2967, 0x2968, 0x18A4, 0x0000, 0x0841, 
-0x1083, 0x18E5, 0x2146, 0x1061, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 
-0x1082, 0x2967, 0x2968, 0x18C5, 0x0020, 0x0841, 0x1084, 0x18E5, 0x2105, 0x28E3, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x0862, 0x2968, 0x2967, 0x2967, 0x18C4, 0x0020, 0x0821, 0x2126, 0x2125, 0x20C2, 0xBBED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA9, 0x0862, 0x2988, 0x2967, 0x18C4, 0x0821, 
-0x0842, 0x1063, 0x2126, 0x2126, 0x20A2, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x0841, 0x2988, 0x2967, 0x10A4, 0x0000, 0x1882, 0x28E4, 0x18A3, 0x3124, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x20E3, 0x2126, 0x2147, 0x18C4, 0x1083, 0x0000, 0x2082, 0x3924, 0x1882, 0x4164, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x10A3, 0x31EA, 0x2147, 0x18E5, 
-0x18E5, 0x10E5, 0x0841, 0x28A3, 0x20A2, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x9B2A, 0x3103, 0x1905, 0x2168, 0x2168, 0x3987, 0x41C8, 0x2904, 0x1061, 0x1862, 0x28E3, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0841, 0x3187, 0x3167, 0x51A5, 0x51A5, 0x61E7, 0x3103, 
-0x1882, 0x1862, 0x0820, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x1081, 
-0x51C6, 0x51A5, 0x49A5, 0x49A5, 0x49A5, 0x59E6, 0x3924, 0x0840, 0x1061, 0x1881, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x1061, 0x51A6, 0x51A5, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x51A6, 0x51A6, 0x51C6, 0x4985, 
-0x1061, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_right_3.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_right_3_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3924, 0x3986, 0x5A8A, 0x5249, 0x5249, 
-0x5249, 0x5249, 0x5249, 0x1882, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x3924, 0x3165, 0x5A69, 0x5A8A, 0x5A69, 0x5A69, 0x5A69, 0x5A8A, 0x5A89, 0x5228, 0x1882, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4144, 0x3186, 0x5A69, 0x5A8A, 0x5A69, 0x5A69, 0x5A69, 0x5249, 0x49E8, 0x4A08, 0x5229, 
-0x39A7, 0x20C3, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB6B, 0x0841, 0x5A69, 0x628A, 0x5A69, 0x5A69, 
-0x5A69, 0x4A29, 0x5A69, 0x9C4E, 0x9C2E, 0x9C2E, 0xB4F0, 0x41C6, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8C, 0x1061, 0x5228, 0x5A8A, 0x5A69, 0x5A69, 0x4A08, 0x5A69, 0xA46E, 0xDE12, 0xDE12, 0xDE12, 0xF6D5, 0x5247, 0x6207, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x1061, 0x5228, 0x5249, 0x4A29, 0x5229, 0x62AA, 0x9C6E, 0xDE33, 0xCDB1, 
-0xB4CE, 0xB4CE, 0xCD91, 0x49E6, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x1061, 0x4A08, 0x6B0B, 
-0x732B, 0x5229, 0x8BCD, 0xE653, 0xBD30, 0xAC6E, 0xB50F, 0xBD2F, 0xB4CD, 0x3984, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x1061, 0x49E8, 0xB510, 0xE653, 0x83AC, 0x7B6C, 0xDE33, 0xAC8E, 0x6208, 0xE6D6, 0xF778, 0xCD70, 0x3964, 
-0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x1061, 0x49E8, 0xB4F0, 0xD5F2, 0xAC8E, 0xAC8D, 0xCDB2, 
-0xCD91, 0xBD10, 0x61C8, 0x5967, 0xA40C, 0x41E5, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x1061, 
-0x49E8, 0xB4F0, 0xD5F2, 0xAC8D, 0xAC8D, 0xCDB2, 0xCD91, 0xC591, 0xB4CF, 0xB4CF, 0xC52F, 0x41C5, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB6B, 0x0840, 0x5229, 0xB4F0, 0xD5F2, 0xC550, 0xBD50, 0xCD91, 0xC571, 0xCD91, 0xDE53, 0xEED4, 
-0x62A8, 0x59C6, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7A88, 0x20E3, 0xA48E, 0xBD2F, 0xBD30, 
-0xD5F3, 0xCD91, 0xCDD2, 0xD5D2, 0x72A9, 0x72AA, 0x1061, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x1882, 0x9C6D, 0xB4EE, 0xA44C, 0xB4EE, 0xC550, 0xC551, 0x72CA, 0x2843, 0x2002, 0x0800, 0x7A88, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x18A2, 0xA46E, 0xBD0F, 0x9BEB, 0x93CB, 0xB4CE, 0xAC6E, 0x2022, 
-0x38A4, 0x7268, 0x20C2, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x18A2, 0x9C4D, 
-0xBD0F, 0x9BEB, 0xAC6C, 0x9C2C, 0x5A47, 0x2863, 0x2883, 0x836A, 0x3984, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x2903, 0xA4AE, 0xBD2F, 0xA42C, 0xA44C, 0x5A67, 0x20A2, 0x18A2, 0x18A2, 0x1061, 0xA36B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x18C2, 0xB4EF, 0xCDB2, 0xCDB2, 0xC550, 0x5A46, 0x3944, 
-0xC40D, 0xBBED, 0xBBED, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x1082, 0x420B, 
-0x9CB6, 0xC593, 0xD5D1, 0xC550, 0x5205, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x8AE9, 0x1882, 0x28E3, 0x39EA, 0x4A4C, 0x528E, 0x8C55, 0xC593, 0xCD90, 0xBD30, 0x6AE9, 0x28E2, 0x3944, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x3944, 0x2924, 0x31A9, 0x31A9, 0x4A6D, 0x422C, 0x39CA, 0x8C56, 0xAD38, 0xBD72, 
-0xEE72, 0x942D, 0x0022, 0x18E4, 0x4144, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x2105, 0x2946, 0x39C9, 0x52AE, 0x4A6D, 
-0x422C, 0x422C, 0x422C, 0x630F, 0x8416, 0xA4D6, 0xCD92, 0xB531, 0x4A8E, 0x10C5, 0x18C4, 0x4185, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x1061, 0x39C9, 0x5ACF, 0x4A4D, 0x422C, 0x4A4C, 0x4A4C, 0x422C, 0x422C, 0x2989, 0x9495, 0xAD7B, 0x9CB4, 0xBD75, 0x9CF8, 0x632E, 
-0x2126, 0x0020, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28E2, 0x3188, 0x4A6D, 0x424C, 0x422B, 0x39EA, 0x3A0B, 0x4A4C, 0x422C, 0x39EB, 
-0x8433, 0xB599, 0x9CD8, 0x8C56, 0xAD58, 0xD6BD, 0x5B0E, 0x0882, 0x59E6, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x20E3, 0x31A9, 0x4A6D, 0x4A4C, 
-0x39EA, 0x1906, 0x2967, 0x420B, 0x424C, 0x4A4C, 0x2948, 0x8C94, 0xCE7C, 0x9CB7, 0xAD38, 0xCE7C, 0xD6BD, 0x632F, 0x1082, 0x7248, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB3CC, 0x1881, 0x39EA, 0x4A6D, 0x422C, 0x4A4C, 0x39EA, 0x2147, 0x2147, 0x2967, 0x422B, 0x424C, 0x31AA, 0x8433, 0xD69D, 0xC65B, 
-0xC65B, 0xC63B, 0xC65B, 0xDEDE, 0x31A7, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x1081, 0x39CA, 0x4A6D, 0x422C, 0x424C, 0x424C, 0x39EA, 0x2147, 0x2967, 
-0x422B, 0x424C, 0x422C, 0x39EB, 0x8433, 0xD6BD, 0xC65B, 0xC63B, 0xC65B, 0xD6DE, 0x3186, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x1881, 0x39C9, 0x4A6D, 
-0x422C, 0x422C, 0x4A4C, 0x422B, 0x2147, 0x2147, 0x422B, 0x424C, 0x424C, 0x31AA, 0x7BD2, 0xD6DD, 0xC63B, 0xC63B, 0xC63B, 0xCE5C, 
-0xBE1A, 0x4208, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xB3CC, 0x1881, 0x39C9, 0x4A6D, 0x422C, 0x4A4C, 0x3A0B, 0x2968, 0x2967, 0x420B, 0x422C, 0x424C, 0x422C, 0x31AA, 
-0x7BF2, 0xD6DD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xE75F, 0x528B, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x1881, 0x31A9, 0x4A6D, 0x422C, 0x4A6D, 0x39EA, 0x2126, 
-0x2967, 0x39CA, 0x4A4C, 0x4A6D, 0x424C, 0x31AA, 0x8433, 0xE73F, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xDF1F, 0x39C7, 0x7268, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6227, 0x2105, 
-0x420B, 0x4A4C, 0x4A4C, 0x420B, 0x31A9, 0x2967, 0x2147, 0x2126, 0x31C9, 0x39CA, 0x420B, 0x3A0B, 0x5AEF, 0xA557, 0xCE7C, 0xC63B, 
-0xC63B, 0xC63B, 0xD6BD, 0x9494, 0x49C6, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0841, 0x4A4C, 0x4A6D, 0x422C, 0x4A4C, 0x39C9, 0x1905, 0x1905, 0x2967, 0x31A9, 0x2146, 0x1905, 
-0x39EA, 0x4A6D, 0x3189, 0x630F, 0xD6BD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xF79F, 0x738F, 0x3924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x420B, 0x4A4C, 0x422C, 0x4A4C, 0x3A0B, 
-0x10A3, 0x0000, 0x2988, 0x4A4C, 0x31A9, 0x2967, 0x39EB, 0x4A4C, 0x39CA, 0x6B71, 0xD6BD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xDF1F, 
-0x5AEC, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x1061, 0x420B, 0x4A4C, 0x424C, 0x4A4C, 0x31CA, 0x10A3, 0x0861, 0x2988, 0x422C, 0x4A4C, 0x4A4C, 0x424C, 0x422C, 0x39CA, 0x6B71, 
-0xD6BD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xDEFE, 0x6B6F, 0x4985, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x420B, 0x4A4C, 0x4A4C, 0x39EA, 0x10A3, 0x0861, 0x2967, 0x2988, 0x422C, 
-0x424C, 0x424C, 0x422C, 0x422C, 0x39CA, 0x6B71, 0xD6BD, 0xC65B, 0xC63B, 0xC63B, 0xC63B, 0xC65B, 0xDEDD, 0x73B0, 0x3944, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x420B, 0x4A6D, 0x31C9, 
-0x2988, 0x1083, 0x0861, 0x2988, 0x2968, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 0x39EB, 0x62EF, 0xB599, 0xCE7C, 0xC63B, 0xC63B, 
-0xC63B, 0xC63B, 0xDF1F, 0x7BF1, 0x3924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x1061, 0x420B, 0x4A6D, 0x2988, 0x2147, 0x10A3, 0x0841, 0x2167, 0x2968, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x422C, 
-0x39EB, 0x5AEF, 0xA4F8, 0xAD58, 0xC63B, 0xC65B, 0xC63B, 0xC63B, 0xE71F, 0x7BF1, 0x0020, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0841, 0x4A4C, 0x4A6D, 0x39EA, 0x420B, 0x18E4, 0x1082, 0x39EA, 
-0x2146, 0x31A9, 0x424C, 0x4A6D, 0x424C, 0x422C, 0x39EB, 0x6330, 0xAD39, 0x9496, 0xC63B, 0xC65B, 0xC63B, 0xCE9C, 0xD69D, 0x52AC, 
-0x0000, 0x1905, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x2925, 
-0x420B, 0x4A6D, 0x52AE, 0x18E4, 0x1082, 0x52AF, 0x31A9, 0x2126, 0x31A9, 0x31C9, 0x420B, 0x424C, 0x420B, 0x4A8D, 0x8413, 0xB5BA, 
-0xC63B, 0xC65B, 0xC65B, 0xBDFA, 0xA518, 0x8413, 0x4A4A, 0x18C4, 0x2126, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x1041, 0x39EA, 0x4A6D, 0x4A6D, 0x3188, 0x18C4, 0x31A9, 0x4A4C, 0x31A9, 0x2126, 0x1905, 
-0x39CA, 0x4A4C, 0x424C, 0x39CA, 0x52CE, 0xD6BD, 0xC65B, 0xC63B, 0xCE7C, 0xA518, 0x8414, 0xCE5D, 0xA536, 0x0000, 0x422C, 0x2126, 
-0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4164, 0x2967, 0x422C, 0x422C, 0x52AE, 
-0x2967, 0x0020, 0x4A6D, 0x4A4C, 0x31A9, 0x2968, 0x3A0B, 0x4A4C, 0x422C, 0x39EB, 0x5B0F, 0xCE7C, 0xC65B, 0xC63B, 0xCE5C, 0xB599, 
-0x9CD7, 0xC63C, 0x9493, 0x0000, 0x2967, 0x424C, 0x2105, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x20C2, 0x3188, 0x4A6D, 0x4A6D, 0x2947, 0x0841, 0x4A6D, 0x424C, 0x4A4C, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x39EB, 
-0x5B0F, 0xCE7C, 0xC65B, 0xC63B, 0xC63B, 0xCE7C, 0xCE9C, 0xDF1E, 0x8C73, 0x0000, 0x2967, 0x2147, 0x424D, 0x3166, 0x5A06, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x28E3, 0x3188, 0x4A6D, 0x4A6D, 0x2947, 0x0861, 0x4A4C, 0x424C, 
-0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 0x39EB, 0x630F, 0xCE7C, 0xC65B, 0xC65B, 0xC65B, 0xC63B, 0xC61B, 0xD6BD, 0x8C53, 0x0000, 
-0x2147, 0x2167, 0x39EB, 0xBD52, 0x62A8, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x3924, 
-0x3188, 0x422B, 0x2147, 0x18E4, 0x1082, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EB, 0x632F, 0xD6BD, 0xCE9D, 0xCE9C, 
-0xE71E, 0x6B90, 0x2147, 0x39E9, 0x31C9, 0x18E5, 0x0841, 0x2147, 0xA48F, 0xD5D2, 0xD5F2, 0x5A88, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28E3, 0x2105, 0x2989, 0x10E6, 0x0884, 0x0000, 0x4A6D, 0x4A6D, 0x4A4C, 0x4A4C, 0x4A4C, 
-0x4A6D, 0x3A0B, 0x31A8, 0x4A6C, 0x4A6C, 0x4A6C, 0x528C, 0x31A8, 0x1906, 0x2126, 0x2147, 0x2146, 0x0000, 0x0020, 0xACCF, 0xD5F2, 
-0xEE94, 0x62C8, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB6B, 0x3103, 0x4A28, 0xA48F, 0x942D, 
-0x734A, 0x18E4, 0x2988, 0x31A9, 0x31A9, 0x31A9, 0x31A9, 0x2988, 0x2146, 0x1906, 0x1906, 0x1906, 0x18E5, 0x2126, 0x2988, 0x2967, 
-0x2967, 0x1906, 0x0840, 0x6287, 0xA44C, 0xC571, 0xBD30, 0xA46D, 0x5A67, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x59E6, 0x62A8, 0xF6B4, 0xE653, 0xBD50, 0x0000, 0x18E5, 0x2167, 0x2147, 0x2147, 0x2146, 0x2147, 0x2147, 0x18E5, 
-0x18E5, 0x2147, 0x2967, 0x2988, 0x2126, 0x2105, 0x2988, 0x18E5, 0x1060, 0xBCCE, 0xB4AD, 0xCD91, 0xA46D, 0xDDF1, 0xACAE, 0x1061, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 0x5AA8, 0xE633, 0xCDB2, 0xBD50, 0x5267, 0x2967, 0x2147, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x1062, 0x1083, 0x2147, 0x2988, 0x2147, 0x1083, 0x10A4, 0x2988, 0x2126, 0x18C3, 0x5A67, 
-0x5A46, 0xACAE, 0xCD4F, 0x9C2C, 0x4A06, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x5267, 
-0xE653, 0xCD91, 0xCD91, 0xE633, 0x39E8, 0x2127, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x1083, 0x0862, 0x2105, 0x2147, 0x10A4, 
-0x1083, 0x2106, 0x2967, 0x2968, 0x2967, 0x0000, 0x3123, 0x5205, 0x8BAA, 0x3143, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4985, 0x7B8B, 0xE654, 0xB4CE, 0x838A, 0xC550, 0x39E8, 0x2127, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2126, 0x1063, 0x0000, 0x1062, 0x1083, 0x1062, 0x2106, 0x2988, 0x2967, 0x2967, 0x2147, 0x0841, 0xBBED, 0x6207, 0x0820, 0x7A88, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3123, 0x7329, 0xDE13, 0xBD0F, 0x6AA7, 0x0861, 0x93CB, 
-0x39C8, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x1083, 0x0020, 0x1083, 0x1083, 0x1063, 0x18E5, 0x2967, 0x2967, 0x2967, 
-0x2147, 0x0841, 0xA34B, 0xC40D, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3924, 
-0x1061, 0x18C2, 0x18A2, 0x1061, 0x0000, 0x0841, 0x2146, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2146, 0x1083, 0x0840, 0x1083, 
-0x1083, 0x1083, 0x1083, 0x18E5, 0x2968, 0x2967, 0x2147, 0x0841, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x9B4A, 0xA34B, 0xAB8B, 0x7A88, 0x0841, 0x1905, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2126, 0x1882, 0x9B2A, 0x20A2, 0x1083, 0x1083, 0x1063, 0x18E5, 0x2968, 0x2967, 0x2147, 0x0841, 0xA34B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 
-0x0841, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x2126, 0x1882, 0xC40D, 0x1061, 0x1083, 0x18A4, 0x1063, 0x18E5, 
-0x2988, 0x2967, 0x2147, 0x0820, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x2146, 0x0840, 
-0xBBCC, 0x8AE9, 0x20A2, 0x1083, 0x1083, 0x10A4, 0x2106, 0x2967, 0x2147, 0x18E4, 0x3944, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2146, 0x18C3, 0x6A27, 0xBBED, 0xC40D, 0x28C2, 0x0862, 0x18A4, 0x1063, 0x10A4, 0x2967, 0x2967, 0x2988, 
-0x0861, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x9B2A, 0x0841, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x1905, 0x20A2, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x1882, 
-0x1083, 0x1063, 0x18C4, 0x2968, 0x2967, 0x2967, 0x0841, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E4, 
-0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x0841, 0x10A4, 0x18E5, 0x2127, 0x2127, 0x2968, 0x0861, 0x8AC9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2988, 0x18C4, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x0841, 0x18E5, 0x2988, 0x39E8, 
-0x39C8, 0x2147, 0x1082, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 0x2947, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E4, 0x3944, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0x10C4, 0x1927, 0x528A, 0xD5F2, 0xB510, 0x18A2, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x1082, 0x2147, 0x2947, 0x18C4, 0x1083, 0x2126, 0x31C9, 
-0x18E4, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x0841, 0x10C5, 0x5269, 0xA44C, 0xB4CE, 0xAC8D, 0x1081, 0xA36B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0862, 
-0x2988, 0x2967, 0x1083, 0x1062, 0x18C5, 0x10A4, 0x2903, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28E3, 0x0842, 0x10A5, 0x62CA, 
-0xCD4E, 0x93EB, 0x3123, 0x8AC9, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0841, 0x2968, 0x2967, 0x2126, 0x18C4, 0x0842, 0x3923, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3103, 0x0842, 0x18E5, 0x39E8, 0x62CA, 0x4207, 0x1061, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x3944, 0x18E5, 0x2967, 0x2967, 0x2126, 0x18C5, 
-0x0821, 0x6A47, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x0842, 0x2106, 0x2147, 0x1927, 0x1906, 0x0840, 0xB3AC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 
-0x10A3, 0x31A9, 0x2967, 0x2947, 0x1083, 0x0862, 0x20C3, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x0842, 
-0x2106, 0x2988, 0x2147, 0x18E4, 0x51C6, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x1082, 0x2988, 0x2967, 0x2967, 0x18A4, 0x0020, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3123, 0x0841, 0x2106, 0x29A9, 0x18E5, 0x20C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x1082, 0x2988, 0x2967, 0x2147, 
-0x18A4, 0x0821, 0x7AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x28E3, 0x0842, 0x18E5, 0x2988, 0x1905, 0x20A2, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6A27, 0x1082, 0x2988, 0x2147, 0x1083, 0x1083, 0x0841, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x20A2, 
-0x1062, 0x1083, 0x1063, 0x2105, 0x2126, 0x20A2, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7248, 0x1082, 0x2988, 0x2147, 0x1083, 0x0841, 0x82C9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x18A2, 0x0862, 0x1083, 0x0863, 0x2106, 0x2126, 0x1881, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x18A3, 0x2147, 0x2968, 
-0x2967, 0x1083, 0x0820, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x3103, 0x20A2, 0x28C3, 0x20C3, 0x28C3, 0x18A3, 
-0x2903, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x4985, 0x10C4, 0x31A9, 0x2126, 0x10A4, 0x1063, 0x0820, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0x0840, 0x28C3, 0x30E4, 0x28E3, 0x30E4, 0x1882, 0x4165, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 0x10A3, 0x2988, 0x1947, 0x18E5, 0x18E5, 0x0020, 0xAB8B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 0x20C3, 0x28E3, 0x28C3, 0x28E4, 0x28A3, 0x20A2, 0x7268, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 0x10A3, 
-0x2988, 0x3986, 0x39A7, 0x3987, 0x28E3, 0x49A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0840, 0x28C3, 0x30E4, 0x30E4, 
-0x28E3, 0x3104, 0x20A3, 0x1061, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 0x18A3, 0x41A7, 0x59A5, 0x51A5, 0x51A5, 0x59E6, 0x28E3, 0x51A5, 0x9B2B, 0x82A9, 0xA34B, 
-0xC40D, 0xB3CC, 0x4164, 0x1882, 0x20A2, 0x20A2, 0x28C3, 0x30E4, 0x20A3, 0x20A2, 0x8AE9, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 0x28C2, 0x59C6, 0x49A5, 0x49A5, 0x49A5, 
-0x49A5, 0x59E6, 0x28E3, 0x0841, 0x1061, 0x3103, 0xABAC, 0xC40D, 0xC40D, 0x4164, 0x20A2, 0x28E3, 0x20A2, 0x28C3, 0x30E4, 0x28C3, 
-0x0841, 0x0841, 0x7A88, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x51C5, 0x28C3, 0x59C6, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x51A6, 0x51A6, 0x59E6, 0x3924, 0x20C2, 0xC3ED, 0xC40D, 0xC40D, 
-0xBBED, 0xC40D, 0x6207, 0x1061, 0x30E4, 0x28C3, 0x30E3, 0x30E4, 0x0841, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_right_4.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_right_4_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x0840, 0x1081, 0x1081, 0x1061, 0x20C2, 0xB3CC, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x2924, 0x5248, 0x4A08, 0x4A08, 0x4A08, 
-0x41E7, 0x20C2, 0x1881, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51C6, 
-0x2944, 0x5A69, 0x62AA, 0x5A8A, 0x5A8A, 0x628A, 0x5A8A, 0x41C7, 0x41E7, 0x20A2, 0xA36B, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x41E7, 0x62CB, 0x5A69, 0x5249, 0x49E8, 0x4A08, 0x4A08, 0x5229, 0x62AA, 0x4A07, 
-0x2903, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7247, 0x2924, 0x4A28, 0x5A8A, 0x5249, 0x6B0B, 
-0x940D, 0x8BCD, 0x8BCD, 0x8BED, 0x5249, 0x62CB, 0x2944, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 
-0x0840, 0x5228, 0x5A49, 0x5249, 0x41E8, 0x83AC, 0xEE73, 0xDE12, 0xDE12, 0xDDF2, 0x940D, 0x62AA, 0x20C3, 0x59E6, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1061, 0x62A9, 0x7B4C, 0x5A8A, 0x5A69, 0x9C2E, 0xD5B1, 0xBD30, 0xBD30, 0xCD91, 
-0xDE12, 0x9C4E, 0x2104, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1881, 0xB4EF, 0xE653, 0x732B, 
-0x8BAD, 0xDE33, 0xBD0F, 0x9BEB, 0x9C2C, 0xBD50, 0xC591, 0xE674, 0x5267, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xABAC, 0x1881, 0xACCF, 0xE633, 0x732B, 0x83AC, 0xDE13, 0xBD2F, 0x9C0B, 0x9C2C, 0xA42C, 0xC550, 0xE653, 0x5247, 0x59E6, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1881, 0xACCF, 0xD613, 0x9C2C, 0xAC8D, 0xDE13, 0x9C0D, 0x6A48, 
-0xFF98, 0xFFB8, 0xB4EE, 0xBD0E, 0x4A05, 0x51C5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x1881, 0xACAE, 
-0xD5F2, 0xC570, 0xC550, 0xCDB1, 0xC550, 0x9BED, 0x7ACA, 0x7ACA, 0xA42C, 0x5226, 0x51C6, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1061, 0xACAE, 0xBD2F, 0xBD30, 0xCDB1, 0xC571, 0xCDD2, 0xC571, 0x8B6B, 0x8B6B, 0xC4EE, 0x3143, 
-0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x59E6, 0x62C8, 0xC571, 0xAC6D, 0xB4CE, 0xCD91, 0xCDB2, 
-0xDE12, 0xDE33, 0xE694, 0xDE33, 0x6B09, 0x4185, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x1061, 
-0xDDF2, 0xC570, 0x9C2C, 0xBD0F, 0xD5F2, 0xB4CF, 0x8B6C, 0x93AC, 0x9BED, 0xDE13, 0x18C2, 0x9B2A, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x4A06, 0xC571, 0xA44C, 0x9BEB, 0xBCEF, 0xDE53, 0x834B, 0x0800, 0x2802, 0x3084, 0x940C, 
-0x3964, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x4A06, 0xDE33, 0xCD91, 0xA46D, 0xA42C, 0x8369, 
-0xB4EF, 0xA44E, 0x38C4, 0x38A4, 0x2883, 0x18A2, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xB3CC, 0xC40D, 0x6A47, 0x41E6, 
-0xDE13, 0xCD91, 0xC591, 0xA46C, 0xB48D, 0x2902, 0x5267, 0xE674, 0x9C0D, 0x2022, 0x1882, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4164, 0x1061, 0x1881, 0x39C9, 0xB556, 0xD5D1, 0xC591, 0xC591, 0xA44C, 0xA42C, 0xA44C, 0x5206, 0x10A2, 0x18A2, 0x1882, 
-0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x20A2, 0x28E3, 0x28E3, 0x2967, 0x39EA, 0x2947, 0x6B50, 0xB59A, 0xAD14, 0xCDB0, 0xCD91, 0xC550, 
-0xA44C, 0xBCCD, 0x49E5, 0x4164, 0xBBCD, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x2904, 0x31A8, 0x3188, 0x2967, 0x422C, 0x4A6D, 0x4A4C, 
-0x528D, 0x7392, 0x9CB7, 0xAD14, 0xCD90, 0xCDB1, 0xC550, 0xB4AD, 0x5A8A, 0x20E5, 0x59E6, 0x51A5, 0x4144, 0x3944, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x0862, 
-0x52AE, 0x4A6D, 0x4A6D, 0x4A4C, 0x422C, 0x424C, 0x31AA, 0x6B50, 0xC63C, 0x9476, 0xAD14, 0xCD91, 0xD5D1, 0xC54F, 0xACD0, 0x5ACC, 
-0x10A4, 0x2946, 0x2947, 0x2947, 0x4985, 0x51A5, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x51C5, 0x4985, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4185, 0x2967, 0x4A4C, 0x422C, 0x4A4C, 0x4A4C, 0x424C, 0x422C, 0x39EB, 0x5AEF, 0xA537, 0xAD59, 
-0x9497, 0xAD14, 0xB533, 0xC592, 0xE651, 0xB532, 0x5AF1, 0x4A6D, 0x528E, 0x528E, 0x2946, 0x2105, 0x3124, 0xB3CC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6A47, 0x6A47, 0x4A06, 0x5A87, 0x62C8, 0x49A5, 0x82C9, 
-0x6A27, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x18E4, 0x52CF, 0x422C, 0x422C, 0x3A0B, 0x39EA, 
-0x422B, 0x422C, 0x4A4C, 0x31AA, 0x52AE, 0xD6DD, 0xAD58, 0x9497, 0x8C78, 0xAD14, 0xC571, 0xBD76, 0x8435, 0x39EA, 0x39EA, 0x424C, 
-0x4A6D, 0x52CF, 0x3188, 0x3124, 0x9B2A, 0x9B4A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x82A9, 0x932A, 0x6A47, 0x41C5, 
-0x41C5, 0xD5D2, 0xEE74, 0xF6D5, 0x8BCC, 0x3164, 0x5247, 0x41C5, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x51C6, 
-0x2126, 0x4A6D, 0x424C, 0x422C, 0x2967, 0x2126, 0x39EA, 0x4A4C, 0x422C, 0x3A0B, 0x5ACE, 0xB5D9, 0xCE7C, 0xAD38, 0xA4F7, 0x9CB7, 
-0x9497, 0xA518, 0x8C54, 0x31A9, 0x2967, 0x3A0B, 0x424C, 0x422C, 0x52AE, 0x3188, 0x0841, 0x28E3, 0xAB8C, 0xA34B, 0xA34B, 0xA34B, 
-0xB3AC, 0x4165, 0x1082, 0x0021, 0x41C6, 0xEE94, 0xDE13, 0xC571, 0xC571, 0xC571, 0xD5D2, 0xCDB1, 0xBD30, 0x9C6D, 0x2923, 0x9B2A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x2125, 0x528E, 0x422C, 0x424C, 0x422C, 0x2968, 0x2126, 0x39EA, 0x4A4C, 0x422C, 0x422C, 
-0x420B, 0x4A6D, 0xC61B, 0xCE5C, 0xCE7C, 0xAD59, 0x9476, 0xBDBA, 0xAD78, 0x422B, 0x422B, 0x2967, 0x3A0B, 0x424C, 0x424C, 0x424C, 
-0x4A6D, 0x39C9, 0x0820, 0x0841, 0x0841, 0x0841, 0x0840, 0x2967, 0x528E, 0x3A0C, 0x62ED, 0xCD91, 0xC571, 0x9BEB, 0xBD2F, 0xD5F2, 
-0xBD2F, 0x5205, 0x1061, 0x3984, 0xBD30, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x2105, 0x528E, 0x422C, 0x424C, 0x422C, 
-0x2968, 0x2126, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x420B, 0x4A8D, 0xC61B, 0xCE5C, 0xC65B, 0xC63B, 0xC61B, 0xC63B, 0xCE7C, 0xAD58, 
-0x420B, 0x2947, 0x2147, 0x3A0B, 0x4A4C, 0x424C, 0x4A4C, 0x3A0B, 0x2126, 0x2147, 0x2126, 0x39EA, 0x420B, 0x422C, 0x4A4C, 0x422C, 
-0x422C, 0x5ACD, 0xA44C, 0x18A1, 0x9C4D, 0xF6D5, 0x62C8, 0x51A5, 0xC40D, 0x930A, 0x18A2, 0x0841, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 
-0x2126, 0x422C, 0x4A4C, 0x422C, 0x424C, 0x4A4C, 0x2967, 0x39EA, 0x424C, 0x424C, 0x422C, 0x422C, 0x420B, 0x52AD, 0xCE7C, 0xCE7C, 
-0xC63B, 0xC65B, 0xC65B, 0xC65B, 0xCE9C, 0xB5B9, 0x420B, 0x2967, 0x2967, 0x2988, 0x420B, 0x4A6D, 0x4A6D, 0x39EA, 0x2146, 0x2147, 
-0x3A0B, 0x4A4C, 0x4A4C, 0x422C, 0x4A4C, 0x52AE, 0x39EA, 0x0861, 0x20E2, 0x932A, 0x3964, 0x18C2, 0x8BCC, 0x7B6A, 0x6207, 0xC40D, 
-0x9B4B, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0x3944, 0x2947, 0x52AE, 0x422C, 0x4A4C, 0x4A4C, 0x31C9, 0x2967, 0x2988, 0x422B, 0x4A4C, 
-0x422C, 0x422C, 0x422C, 0x4A4C, 0x6B50, 0xBDDA, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xB599, 0x420B, 0x2147, 0x10A3, 0x0841, 
-0x2146, 0x39EA, 0x420B, 0x4A6D, 0x39EA, 0x39EA, 0x424C, 0x422C, 0x4A6D, 0x5ACF, 0x31A9, 0x1083, 0x20E3, 0x930A, 0x8AE9, 0xC40D, 
-0x9B4A, 0x9B2A, 0x5206, 0x3985, 0x20A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7248, 0x2925, 0x39EA, 0x4A4C, 0x4A4C, 0x4A4C, 
-0x31A9, 0x0862, 0x2126, 0x2147, 0x2988, 0x422B, 0x4A6D, 0x4A4C, 0x422C, 0x420B, 0x39CA, 0xB599, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 
-0xCE7C, 0xAD99, 0x422B, 0x39EA, 0x0841, 0x6207, 0x3104, 0x10A3, 0x10A3, 0x3188, 0x52AF, 0x528E, 0x4A8D, 0x52AE, 0x2968, 0x2105, 
-0x3124, 0x7A88, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x59E6, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x1882, 0x31A9, 0x528E, 0x422C, 0x422C, 0x2988, 0x1083, 0x1082, 0x2146, 0x2967, 0x2126, 0x2988, 0x39EA, 0x39EA, 0x424C, 0x422C, 
-0x422C, 0xB5B9, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xAD99, 0x422C, 0x4A4C, 0x1082, 0xAB8C, 0xA34B, 0x4985, 0x6207, 0x4165, 
-0x2967, 0x2946, 0x2946, 0x2967, 0x3944, 0x51A5, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x20E4, 0x39CA, 0x4A4D, 0x4A4D, 0x420B, 0x18E4, 0x0000, 0x2988, 0x2967, 0x2147, 
-0x2988, 0x2967, 0x1905, 0x2988, 0x4A4C, 0x422C, 0x422C, 0xB5B9, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xAD99, 0x422B, 0x422C, 
-0x1082, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x3123, 0x4164, 0x4144, 0x3103, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x0841, 0x3A0B, 0x4A8D, 0x4A4C, 0x424C, 
-0x31C9, 0x20E4, 0x28E3, 0x2126, 0x2147, 0x2967, 0x422C, 0x3A0A, 0x2967, 0x31C9, 0x4A4C, 0x422C, 0x422C, 0xB5B9, 0xCE7C, 0xC63B, 
-0xC63B, 0xC63B, 0xCE7C, 0xAD98, 0x39EB, 0x422C, 0x1082, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA36B, 0x18A2, 0x39EA, 0x4A4C, 0x422C, 0x39EA, 0x10C4, 0x3123, 0xBBED, 0x1061, 0x2126, 0x422B, 0x4A4C, 0x422C, 0x4A4C, 0x4A4C, 
-0x422C, 0x422C, 0x422C, 0xB5B9, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xB5B9, 0x528D, 0x424C, 0x0862, 0x8AEA, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1882, 0x3A0A, 0x4A6D, 0x31A9, 0x2147, 0x2988, 0x18E5, 0x3123, 0xBBED, 0x1061, 
-0x2126, 0x420B, 0x4A4C, 0x422C, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0xB5B9, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xCE5C, 
-0xBDDA, 0x528D, 0x0862, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0861, 0x420B, 0x4A6D, 0x31A8, 
-0x2967, 0x18E4, 0x3944, 0xBBED, 0xAB8C, 0x1061, 0x2126, 0x420B, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x9475, 
-0xC63B, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xC61B, 0x4A8D, 0x420B, 0x18C3, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x1061, 0x420B, 0x4A6D, 0x2988, 0x2967, 0x18C4, 0x4165, 0xC40D, 0xAB8B, 0x1041, 0x2126, 0x422C, 0x4A4C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x8C55, 0xA4F8, 0xBDDA, 0xCE5C, 0xC63B, 0xC63B, 0xCE5C, 0xBDFA, 0x4A6D, 0x4A6D, 0x18C4, 
-0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0841, 0x4A4C, 0x4A6D, 0x420B, 0x31A9, 0x10C4, 0x4164, 0xC40D, 
-0xAB8C, 0x1041, 0x1926, 0x2988, 0x422C, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x8C35, 0x8C56, 0xB599, 0xCE7C, 0xC63B, 
-0xC63B, 0xCE7C, 0xC63B, 0x4A6D, 0x4A4D, 0x1082, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x2925, 
-0x420B, 0x4A6D, 0x39EA, 0x10A3, 0x4985, 0xC40D, 0xAB8B, 0x1061, 0x31A9, 0x2147, 0x2968, 0x422B, 0x4A4C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0xA517, 0xB599, 0xBDFA, 0xC65B, 0xC65B, 0xCE7C, 0xCE5C, 0xA538, 0x39EB, 0x422C, 0x31A8, 0x3944, 0x9B4B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1881, 0x31A9, 0x4A8D, 0x31C9, 0x18E4, 0x2903, 0xA34B, 0xB3AC, 0x1061, 0x422B, 0x3A0B, 
-0x2126, 0x2967, 0x420B, 0x4A4C, 0x422C, 0x422C, 0x422C, 0xBDD9, 0xD6BD, 0xC65B, 0xC65B, 0xBDFA, 0xB5B9, 0xB579, 0x8C55, 0x7BD2, 
-0x4A6C, 0x52AF, 0x2105, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x1061, 0x39EA, 0x4A8D, 0x39CA, 0x31A8, 
-0x1905, 0x20C2, 0xBBED, 0x1061, 0x39EA, 0x4A6D, 0x39EA, 0x2167, 0x31C9, 0x4A4C, 0x422C, 0x422C, 0x422C, 0xB5B9, 0xCE7C, 0xC63B, 
-0xCE7C, 0xB599, 0x8C35, 0x9496, 0xAD59, 0xD6DD, 0x5ACE, 0x420C, 0x2967, 0x4185, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBCD, 0x28E3, 0x3188, 0x424C, 0x4A6D, 0x420B, 0x18E4, 0x3123, 0xBBCD, 0x1061, 0x39EA, 0x4A4C, 0x424C, 0x4A4C, 0x4A4C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0xB5B9, 0xCE7C, 0xC63B, 0xCE7C, 0xB5BA, 0x9CB7, 0xAD59, 0xCE9C, 0xCE7C, 0x7391, 0x422C, 0x528E, 0x2947, 
-0x3944, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x28C2, 0x3188, 0x4A6D, 0x4A6D, 0x2988, 0x3123, 0xBBED, 0x1061, 
-0x39EA, 0x4A4C, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0xB5B9, 0xCE7C, 0xC65B, 0xC65B, 0xC65B, 0xC63B, 0xC61B, 
-0xC61B, 0xC61B, 0xCE7C, 0x6B50, 0x422C, 0x2126, 0x4165, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28C2, 0x3188, 
-0x4A6D, 0x528E, 0x2968, 0x3924, 0xBBED, 0x1061, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422B, 0x422C, 0xBDFA, 
-0xD6BD, 0xCE9C, 0xCE9C, 0xDEFE, 0xA537, 0x2967, 0x39C9, 0x39E9, 0x39E9, 0x422B, 0x52AE, 0x2947, 0x4144, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1881, 0x39EA, 0x39EB, 0x0886, 0x528A, 0x8BCB, 0x28C2, 0x0021, 0x422C, 0x4A6D, 0x422C, 0x422C, 
-0x422C, 0x424C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A6C, 0x4A6B, 0x4A6C, 0x4A6C, 0x4A8C, 0x3A0A, 0x1906, 0x2126, 0x2126, 0x2126, 0x2988, 
-0x2105, 0x4985, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4A, 0x28E4, 0x62CA, 0x942E, 0xBD30, 0xACAE, 
-0x1041, 0x930A, 0x18C3, 0x422C, 0x528D, 0x4A4C, 0x4A6D, 0x422B, 0x2988, 0x31A9, 0x31C9, 0x2127, 0x18E5, 0x1905, 0x1906, 0x18E5, 
-0x1906, 0x2967, 0x2967, 0x2968, 0x2988, 0x2988, 0x0861, 0x7A68, 0xC40D, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x3103, 0x8BCB, 0xFF36, 0xD5F2, 0xB50F, 0x62A8, 0x7268, 0x7268, 0x2925, 0x31A8, 0x39CA, 0x39CA, 0x3188, 0x2146, 0x2146, 
-0x18E5, 0x18E5, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E5, 0x18E5, 0x2947, 0x2126, 0x2903, 0x8AE9, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x49C5, 0x9C4D, 0xD5D2, 0xDDF2, 0xCD91, 0x0841, 0xC40D, 0x4164, 
-0x10C3, 0x2967, 0x2146, 0x2147, 0x2967, 0x2147, 0x1062, 0x0862, 0x18E4, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x1905, 0x1083, 
-0x0842, 0x2106, 0x31C9, 0x18C4, 0x3944, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4985, 0x732A, 
-0xDE33, 0xCDB2, 0xB4EF, 0x49E6, 0x82C9, 0x28E3, 0x2106, 0x2968, 0x2967, 0x2967, 0x2967, 0x2147, 0x18C4, 0x1083, 0x1062, 0x18E5, 
-0x2967, 0x2988, 0x2967, 0x1905, 0x1063, 0x1083, 0x18A4, 0x2146, 0x2988, 0x1905, 0x3124, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x28C2, 0x83AB, 0xF6B5, 0xCDB1, 0xB4CE, 0x8BAA, 0xD5D2, 0x18C2, 0x18E5, 0x2988, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x10A4, 0x1083, 0x0862, 0x18C4, 0x2967, 0x1905, 0x1062, 0x1083, 0x18A4, 0x2947, 0x2967, 0x2967, 0x31A8, 
-0x1905, 0x20C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x6B09, 0xD5F2, 0xBD0F, 0x6AA7, 0x18A2, 0x93CA, 
-0x1081, 0x18E5, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x10A4, 0x1083, 0x1061, 0x1062, 0x1083, 0x1083, 0x1083, 
-0x10A3, 0x2147, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E4, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x51C6, 0x18A2, 0x1081, 0x3123, 0xAB8C, 0x18A2, 0x0020, 0x2105, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x10A4, 
-0x0841, 0x8AE9, 0x6A27, 0x0841, 0x18A4, 0x1083, 0x1083, 0x10A3, 0x2146, 0x2967, 0x2967, 0x2988, 0x18E4, 0x3123, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x9B2A, 0x9B4B, 0xAB8C, 0xC40D, 0x9B4B, 0x1061, 0x2105, 0x2968, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x18C4, 0x0821, 0x7A88, 0xC40D, 0x51A5, 0x0862, 0x18A4, 0x1083, 0x1083, 0x2147, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x18E4, 0x3944, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0x18A2, 0x2105, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0862, 0x5A06, 0xB3CC, 0xC40D, 0xC40D, 
-0x51A5, 0x0862, 0x10A4, 0x1083, 0x18A4, 0x2146, 0x2967, 0x2967, 0x2988, 0x2126, 0x1061, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x1905, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2988, 0x0841, 0x9B2A, 0xC40D, 0xBBED, 0xC40D, 0xC40D, 0x51A5, 0x0862, 0x10A4, 0x1063, 0x2126, 0x2988, 0x2967, 0x2988, 0x1905, 
-0x20A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6A27, 0x18C3, 0x2146, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x18E4, 0x4985, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x1062, 
-0x1083, 0x18C5, 0x2147, 0x2968, 0x2967, 0x2146, 0x18C3, 0x6A47, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xA36B, 0x0020, 0x2967, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0820, 0xB3CC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1041, 0x1083, 0x1063, 0x18C4, 0x2147, 0x2967, 0x2988, 0x2967, 0x0820, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x1041, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x1905, 0x28E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x4144, 0x1062, 0x1083, 0x1083, 0x18E5, 
-0x2147, 0x2147, 0x2146, 0x0841, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x1061, 
-0x2146, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x1905, 0x28E3, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBCD, 0x20C2, 0x1062, 0x2106, 0x31A8, 0x39E9, 0x39C8, 0x1905, 0x20C2, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x1061, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x1905, 0x20C2, 0xBBCD, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x18A2, 0x1062, 0x2126, 0x10E6, 0x734C, 0xE653, 0x940C, 0x20A2, 0xB3CC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0841, 0x2967, 0x18C4, 0x1083, 0x2126, 0x2988, 
-0x31A8, 0x1905, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x1061, 0x1062, 0x10E6, 
-0x62CA, 0xBCCE, 0x7B69, 0x3944, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x932A, 0x20C3, 
-0x2126, 0x2967, 0x1083, 0x1063, 0x18C4, 0x10A3, 0x0862, 0x20C3, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xB3AC, 0x1061, 0x1062, 0x10C5, 0x836B, 0xD58F, 0x6AA7, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0862, 0x2988, 0x2967, 0x2106, 0x10A4, 0x18A4, 0x0841, 0x1881, 0xAB8B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x1061, 0x1062, 0x1906, 0x4229, 0x62CA, 0x3986, 0x3103, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x0862, 0x2968, 0x2967, 0x2988, 0x18C4, 
-0x0862, 0x28E3, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x1061, 
-0x1062, 0x2126, 0x2127, 0x1928, 0x10C5, 0x20A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x82A9, 0x0862, 0x2968, 0x2967, 0x2988, 0x18E5, 0x0821, 0x7268, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x1061, 0x1062, 0x2126, 0x2988, 0x2146, 0x20C3, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x0862, 0x2968, 0x2967, 0x2126, 0x10A3, 0x1882, 0x82C9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x1061, 0x1062, 0x2126, 0x29A8, 0x10A3, 
-0x51C5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x0862, 0x2968, 0x2967, 
-0x10A4, 0x0020, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x9B4A, 0x1061, 0x1062, 0x2106, 0x2988, 0x18C4, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x82A9, 0x0862, 0x2968, 0x2967, 0x10A4, 0x0841, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x0841, 0x1083, 0x1083, 0x1063, 0x2126, 0x18E4, 0x4985, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x0861, 0x2988, 0x2967, 0x0861, 0x82C9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x0841, 0x1083, 0x1083, 0x1083, 
-0x0862, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x18A3, 0x2147, 
-0x2967, 0x18C4, 0x0840, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xB3AC, 0x0820, 0x20A3, 0x28C3, 0x18A4, 0x0021, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6207, 0x10A3, 0x2988, 0x10A4, 0x1062, 0x0820, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x3103, 0x20A2, 0x28E3, 0x30E3, 0x28C4, 0x0841, 0x6A47, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x1083, 0x2168, 0x18E5, 0x18E5, 0x0020, 0xAB6B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x0841, 0x30E4, 0x28E3, 
-0x28C3, 0x30E4, 0x20C3, 0x20C2, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 
-0x1082, 0x39A7, 0x39A7, 0x3987, 0x28E3, 0x59E6, 0x6A47, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8AE9, 0x0841, 0x28E3, 0x28C3, 0x28C3, 0x28C3, 0x3104, 0x28C3, 0x1881, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x20A2, 0x59C6, 0x51A5, 0x51A5, 0x59E6, 0x28E3, 0x1882, 0x4185, 0x9B4B, 0x82C9, 
-0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x0841, 0x30E4, 0x30E4, 0x30E4, 0x28C3, 0x28C3, 0x3104, 
-0x28C3, 0x1881, 0x930A, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x18A2, 0x59C6, 0x49A5, 0x49A5, 
-0x49A5, 0x51A6, 0x6207, 0x3103, 0x0841, 0x1061, 0x20C2, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x20A2, 
-0x20C3, 0x20A3, 0x20A3, 0x28C3, 0x28C3, 0x28C3, 0x30E4, 0x28C3, 0x0820, 0x1061, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6A27, 0x18A2, 0x59C6, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x49A5, 0x51A6, 0x51A6, 0x51C6, 0x4165, 0x1061, 0xB3CC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0820, 0x0000, 0x0000, 0x20A2, 0x30E4, 0x28C3, 0x28C3, 0x28C3, 0x30E4, 0x28C3, 
-0x0841, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_right_5.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_right_5_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xBBED, 0xBBED, 0xBBED, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x20A2, 0x20A2, 0x20C2, 
-0x20C2, 0x1061, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xB3AC, 0x20C2, 0x41C7, 0x41A6, 0x41A6, 0x41A6, 0x4A07, 0x3124, 0x3123, 0x6227, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x3124, 0x41C7, 0x62AA, 0x62AA, 0x62AA, 0x62AA, 0x6ACB, 0x4A08, 0x3165, 
-0x2904, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x18A2, 0x6AEB, 0x5A69, 
-0x5A69, 0x4A29, 0x4A08, 0x4A08, 0x5A69, 0x6AEB, 0x5249, 0x20E3, 0x7247, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xB3AC, 0x4985, 0x3165, 0x5A8A, 0x5A69, 0x5A69, 0x7B4B, 0x838C, 0x83AC, 0x6ACA, 0x49E8, 0x5A6A, 0x5229, 0x0840, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x2924, 0x6ACB, 0x5249, 0x5249, 0x5229, 0xBD30, 0xDE13, 0xE653, 
-0xA48F, 0x62AA, 0x734B, 0x62A9, 0x1061, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x2924, 0x730B, 
-0x62AA, 0x5A69, 0x62AA, 0xB510, 0xCD91, 0xC550, 0xCD91, 0xCDD2, 0xDDF2, 0xB4EF, 0x1881, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x61E6, 0x5247, 0xE653, 0xACCF, 0x5A89, 0xBD30, 0xCDB2, 0xAC8D, 0x9BEB, 0xB4CE, 0xCDB2, 0xD5D2, 0xACCF, 
-0x1081, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x61E6, 0x5247, 0xEE94, 0xB4EF, 0x5269, 0xC551, 0xCDB2, 
-0xB4CE, 0x9BEB, 0x9BEB, 0x9C0C, 0xBD0F, 0xBD30, 0x1081, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x61E6, 
-0x5247, 0xE653, 0xBD30, 0x8BAB, 0xC570, 0xD5F2, 0x6A08, 0xB4CF, 0xFFFA, 0xDE73, 0x7B29, 0x3964, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x61E6, 0x5247, 0xE653, 0xCD91, 0xBD2F, 0xC571, 0xCDB1, 0xA44E, 0x938C, 0x938D, 0xA42E, 
-0x7308, 0x20A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x41E6, 0xDE12, 0xB4EF, 0xD5D2, 
-0xCD91, 0xC571, 0xE6B4, 0xB4CF, 0x7269, 0x9BCC, 0x8BCA, 0x1061, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA36B, 0x49A5, 0x8BEC, 0xCD70, 0x9C0B, 0xBD0F, 0xCD91, 0xDE13, 0xA44E, 0x8B8C, 0xD5D2, 0xC590, 0x41A5, 0x6206, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3924, 0x732A, 0xF6D5, 0xBD0F, 0x9C0B, 0x9C0B, 0xBD2F, 0xACAF, 0x4926, 0x0800, 
-0x7AAA, 0x7309, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4144, 0x7B6A, 0xE653, 0xBD2F, 
-0x9C0B, 0xA42C, 0xA44C, 0x5186, 0x3084, 0x38A4, 0x3064, 0x1842, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0xB3CC, 
-0xBBED, 0x3103, 0x838B, 0xDE13, 0xCDB1, 0xBD2F, 0x9C0B, 0xA42C, 0x9C0B, 0xA44C, 0x59C6, 0x40A5, 0x2082, 0x4985, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x1061, 0x1881, 0x1881, 0x838B, 0xD5D2, 0xCDB1, 0xCDB1, 0xBD2F, 0xA42C, 0x93EB, 0x18C2, 0x1081, 
-0x72E8, 0xDDD2, 0x6AE9, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x1881, 0x28E3, 0x28E3, 0x39CA, 0x31C9, 0x6B51, 0xC572, 0xD5D1, 0xC571, 
-0xCDB1, 0xBD0F, 0x9C0B, 0x93EB, 0x0840, 0xA36B, 0x4185, 0x39A5, 0x51C6, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x18C4, 0x31C9, 0x2967, 0x31A9, 
-0x4A6D, 0x4A4D, 0xA518, 0xAD37, 0xC571, 0xCDB0, 0xCD91, 0xC571, 0xB4EF, 0x9C2C, 0x72E8, 0x4984, 0x8AE9, 0x9B2A, 0xBBCC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7AA8, 0x18C4, 0x420B, 0x52AE, 0x4A6D, 0x4A6D, 0x422C, 0x422C, 0x6330, 0x8436, 0xA4F6, 0xC572, 0xCD90, 0xCDB2, 0xC570, 0x9C0B, 
-0xAC8D, 0x39A7, 0x4985, 0x6A47, 0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1881, 0x31C9, 0x528E, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x31A9, 0x9CF6, 
-0xA53A, 0x9CB5, 0xC572, 0xD5B0, 0xC570, 0xB4AE, 0xB4CE, 0x83F2, 0x31A9, 0x18E5, 0x2904, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x6207, 0x7268, 0x7268, 
-0x7248, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x2967, 0x4A6D, 0x422C, 
-0x422C, 0x422C, 0x4A4C, 0x424C, 0x39EB, 0x8C74, 0xB599, 0x94B8, 0x9CD5, 0xBD52, 0xBD52, 0xD5D1, 0xD5D1, 0xB578, 0x5AF0, 0x4A6D, 
-0x39C9, 0x20C2, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xA34B, 0x932A, 0x51C6, 0x4A06, 0x41E6, 0x4A26, 0x4A06, 0x1061, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8B, 0x28E3, 0x31A9, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x420B, 0x420B, 0x422C, 0x2969, 0x9CF6, 0xCE5C, 0x94B7, 0x9497, 
-0x9CD6, 0xC572, 0xC572, 0xA4F7, 0x6B91, 0x4A4C, 0x4A6D, 0x39C9, 0x20C2, 0xAB8C, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xA36B, 0xA34B, 0xABAC, 0x3964, 0x18A2, 0x734A, 0xF6B5, 0xD5D2, 0xBD10, 0xBD30, 0x3124, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x1881, 0x39C9, 0x4A6D, 0x422C, 0x422C, 0x4A4C, 0x420B, 0x2147, 0x2147, 
-0x420B, 0x39CA, 0x9495, 0xD6BD, 0xB5BA, 0x94B6, 0x9CD7, 0x9CB7, 0x9CB7, 0x9CB7, 0xCE7C, 0x7C13, 0x31AA, 0x4A6D, 0x39C9, 0x0841, 
-0x1082, 0xA36B, 0xBBCD, 0xB3AC, 0xB3AC, 0xB3AC, 0xB3AC, 0xB3CC, 0xA34B, 0x1062, 0x18A2, 0x0841, 0x8BEC, 0xE653, 0xCDB2, 0xBD2F, 
-0x72E8, 0x1881, 0x18A2, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x1881, 0x39C9, 0x4A6D, 
-0x422C, 0x422C, 0x4A4C, 0x420B, 0x2147, 0x2147, 0x422B, 0x422C, 0x39EB, 0x8C74, 0xD6BD, 0xC63B, 0xBDFA, 0x9496, 0x9496, 0xBDFA, 
-0xDEDE, 0x7BF3, 0x2147, 0x31A9, 0x4A4C, 0x422B, 0x3A0B, 0x1882, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1082, 0x420B, 
-0xB4F0, 0xBD50, 0xC571, 0xD5D2, 0xC570, 0x6AE8, 0x28E3, 0xBBED, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x1882, 0x31A9, 0x4A6D, 0x4A4C, 0x4A6D, 0x420B, 0x2967, 0x2147, 0x2147, 0x420B, 0x4A4C, 0x3189, 0x8433, 
-0xD6DD, 0xC65B, 0xC63B, 0xBDFA, 0xBDFA, 0xC65B, 0xD6DD, 0x7BD2, 0x31AA, 0x31C9, 0x31A9, 0x4A6D, 0x4A4C, 0x39EA, 0x2146, 0x2126, 
-0x1905, 0x2967, 0x39EA, 0x39CA, 0x39EA, 0x4A4C, 0x5AAD, 0xBD51, 0xC52F, 0xCD70, 0xF6B5, 0x8BAB, 0x0000, 0x3944, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x4144, 0x3167, 0x422B, 0x4A4D, 0x39CA, 0x2988, 0x2988, 0x2146, 
-0x2967, 0x39EA, 0x422C, 0x424C, 0x31AA, 0x8454, 0xD6DD, 0xC63B, 0xC65B, 0xCE5B, 0xCE5C, 0xC65B, 0xD6BD, 0x7BD2, 0x39EB, 0x39CA, 
-0x2968, 0x4A6D, 0x424C, 0x4A6D, 0x2988, 0x2126, 0x31A9, 0x424C, 0x4A6D, 0x4A6D, 0x4A4D, 0x422C, 0x3A0D, 0xB4F0, 0x6AC7, 0x2923, 
-0x3985, 0x62C8, 0xB50F, 0x942D, 0x4164, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB6B, 0x0841, 0x422C, 
-0x4A6D, 0x424C, 0x420B, 0x31A9, 0x2167, 0x2147, 0x2968, 0x4A6D, 0x4A4C, 0x422C, 0x31AA, 0x8454, 0xD6DD, 0xC63B, 0xC63B, 0xC63B, 
-0xC63B, 0xC63B, 0xD6BD, 0x7BD2, 0x39CA, 0x39EA, 0x2988, 0x3A0B, 0x4A4C, 0x4A6D, 0x39EA, 0x31C9, 0x422B, 0x4A4C, 0x422C, 0x4A4C, 
-0x528E, 0x4A6D, 0x2126, 0x41C5, 0x49A5, 0x82A9, 0x7AA9, 0x51E6, 0x7B6A, 0x62A8, 0x0840, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x0841, 0x39EA, 0x4A4C, 0x424C, 0x422C, 0x2947, 0x18C4, 0x2967, 0x2967, 0x39CA, 0x422C, 0x424C, 
-0x31AA, 0x8454, 0xD6DD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6BD, 0x7BD2, 0x39EB, 0x31A9, 0x0882, 0x18E4, 0x39EB, 0x39EA, 
-0x4A6D, 0x4A6D, 0x422C, 0x4A4C, 0x528E, 0x422C, 0x2126, 0x2946, 0x51A5, 0x49A5, 0xABAC, 0xC40D, 0xC40D, 0xB3AC, 0x4985, 0x59C6, 
-0x59E6, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7248, 0x20E4, 0x420B, 0x424C, 0x4A6D, 0x39EA, 0x0862, 
-0x0020, 0x2988, 0x2146, 0x2126, 0x420B, 0x4A4C, 0x31AA, 0x8454, 0xD6DD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6BD, 0x7BD2, 
-0x3A0B, 0x2967, 0x1061, 0x3944, 0x18E4, 0x18C4, 0x2947, 0x422B, 0x528E, 0x3A0A, 0x3188, 0x2946, 0x4164, 0x4164, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0862, 
-0x4A6D, 0x4A4C, 0x4A4C, 0x424C, 0x3188, 0x1083, 0x1083, 0x2988, 0x2988, 0x2988, 0x422B, 0x424C, 0x31AA, 0x8454, 0xD6DD, 0xC63B, 
-0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6BD, 0x7BD2, 0x39EB, 0x2967, 0x4144, 0xC40D, 0x28E3, 0x28C2, 0x3103, 0x2946, 0x422C, 0x2925, 
-0x20C2, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0861, 0x422C, 0x424C, 0x424C, 0x31C9, 0x0861, 0x0862, 0x2988, 0x2988, 0x4A4C, 0x4A4C, 
-0x422C, 0x422C, 0x31AA, 0x8454, 0xD6DD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xD6DD, 0x73D2, 0x39EB, 0x2967, 0x3103, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x0020, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0862, 0x422C, 0x4A4C, 0x3188, 0x2988, 
-0x1082, 0x0862, 0x2968, 0x2988, 0x4A4C, 0x424C, 0x422C, 0x422C, 0x31AA, 0x8454, 0xD6DD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 
-0xD6DD, 0x7BD2, 0x39EB, 0x2967, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xB3AC, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x18A3, 0x420B, 0x422C, 0x3188, 0x2968, 0x1082, 0x10A3, 0x2967, 0x2147, 0x2968, 0x424C, 0x422C, 0x422C, 0x422C, 0x31AA, 0x8C54, 
-0xDEDD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC65B, 0xCE5C, 0x8434, 0x2106, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x10A3, 0x4A8D, 0x422C, 0x2147, 0x2147, 0x0841, 0x10A3, 0x2988, 0x2988, 0x420B, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x39CA, 0x7392, 0xC61B, 0xCE9C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xDEFE, 0x94B6, 0x18E5, 
-0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x10A3, 0x52AE, 0x424C, 0x39EA, 
-0x420B, 0x0841, 0x1082, 0x2988, 0x31A9, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x6B51, 0xA518, 0xB5BA, 0xCE5B, 0xC63B, 
-0xC63B, 0xC63B, 0xC63B, 0xD6DD, 0x8C95, 0x18E5, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x4185, 0x2967, 0x422C, 0x4A4C, 0x4A6D, 0x31A8, 0x10C3, 0x18E4, 0x31C9, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x39EA, 0x7371, 0x9CB7, 0x9CF7, 0xCE7C, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xDEFE, 0x94B5, 0x18E5, 0x3103, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8B, 0x0841, 0x422C, 0x424C, 0x422C, 0x52CF, 0x20E5, 0x0020, 
-0x29A9, 0x39EA, 0x424C, 0x422C, 0x422C, 0x422C, 0x39CA, 0x7BD2, 0xB59A, 0xB599, 0xCE5C, 0xC63B, 0xC63B, 0xCE5B, 0xCE7C, 0xCE7C, 
-0x8434, 0x1906, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0861, 
-0x4A4C, 0x4A4C, 0x422C, 0x4A8D, 0x18E4, 0x1062, 0x31A9, 0x31A8, 0x424C, 0x422C, 0x422C, 0x422C, 0x31AA, 0x8C74, 0xDEFE, 0xCE5C, 
-0xC63B, 0xC63B, 0xC63B, 0xBDFA, 0xBE1B, 0xAD59, 0x7372, 0x2126, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x18A2, 0x39EA, 0x422C, 0x422C, 0x4A8D, 0x18C4, 0x18C4, 0x52AE, 0x4A4C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x31AA, 0x8454, 0xD6DD, 0xC63B, 0xC63B, 0xC65B, 0xC65B, 0x9CD7, 0x9476, 0xA538, 0x7BD3, 0x2127, 0x2903, 0xB3AC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB6B, 0x1061, 0x3A0B, 0x4A4C, 0x4A8D, 
-0x18E4, 0x18C4, 0x4A6D, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x31AA, 0x8454, 0xD6DD, 0xC63B, 0xC63B, 0xC65B, 0xC65B, 0xA518, 
-0x9496, 0xC63C, 0x8C74, 0x39EB, 0x31A9, 0x20A2, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x0841, 0x420B, 0x4A6D, 0x424C, 0x4A4C, 0x2105, 0x10A3, 0x528E, 0x422C, 0x422C, 0x422C, 0x422C, 0x31AA, 0x8454, 
-0xD6DD, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xCE5C, 0xCE5C, 0xDF1E, 0x8C74, 0x39CB, 0x31A9, 0x1882, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x932A, 0x18C3, 0x39EA, 0x528E, 0x420B, 0x1906, 0x0042, 0x18E4, 
-0x4A4C, 0x424C, 0x422C, 0x422C, 0x3189, 0x9495, 0xEF7F, 0xDEDE, 0xDEDE, 0xDEDE, 0xDEFE, 0x634F, 0x424B, 0x4A8B, 0x4A6C, 0x4A8E, 
-0x31A9, 0x20A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x0840, 
-0x2987, 0x2989, 0x0065, 0x5AAB, 0x62C9, 0x0000, 0x52AE, 0x4A4D, 0x4A4C, 0x4A4C, 0x424C, 0x52AD, 0x632E, 0x5B0E, 0x5B0E, 0x5B0E, 
-0x5B0E, 0x2147, 0x10E5, 0x18E5, 0x2968, 0x39EA, 0x2988, 0x18E4, 0x4985, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7A88, 0x1882, 0x5289, 0x7B8C, 0xB4F0, 0xCD70, 0x5247, 0x2106, 0x31A9, 0x31C9, 0x31C9, 
-0x39EA, 0x2147, 0x10C5, 0x18E5, 0x10C5, 0x10C5, 0x10C5, 0x2147, 0x2988, 0x2126, 0x18C4, 0x1905, 0x2988, 0x2147, 0x0840, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20A2, 0xA46D, 0xFF15, 0xCDB1, 
-0xDE13, 0xB4EF, 0x0000, 0x2126, 0x2147, 0x2146, 0x2147, 0x2126, 0x18E5, 0x2126, 0x2988, 0x2967, 0x2967, 0x2968, 0x2126, 0x10A4, 
-0x0822, 0x18C4, 0x2988, 0x2126, 0x1061, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6206, 0x5A87, 0xBD30, 0xCDB2, 0xD5F2, 0x9C6D, 0x0000, 0x2147, 0x2967, 0x2967, 0x2988, 0x18E5, 0x0842, 0x1083, 
-0x2126, 0x2967, 0x2967, 0x2146, 0x10A4, 0x1062, 0x1083, 0x2106, 0x2988, 0x2146, 0x10A3, 0x7A88, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x62A8, 0xE654, 0xD5D2, 0xA48E, 0x20E3, 0x2126, 
-0x2147, 0x2967, 0x2988, 0x18E5, 0x1083, 0x0842, 0x0020, 0x2147, 0x2147, 0x10A3, 0x1083, 0x1083, 0x2126, 0x2988, 0x2967, 0x2967, 
-0x2968, 0x0841, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x4164, 
-0x7B4A, 0xE654, 0xB4CE, 0xA44C, 0xBD30, 0x1061, 0x1906, 0x2967, 0x2988, 0x18E5, 0x1083, 0x1082, 0x1061, 0x1083, 0x1083, 0x1083, 
-0x1063, 0x1905, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x0841, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3923, 0x7B8B, 0xE633, 0xCD91, 0x62A7, 0x20E2, 0xA44C, 0x0840, 0x1906, 0x2967, 0x2988, 0x2105, 
-0x0841, 0x4164, 0xA36B, 0x0841, 0x1083, 0x1083, 0x1083, 0x1083, 0x1905, 0x2968, 0x2967, 0x2967, 0x2147, 0x0841, 0xA34B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x20E3, 0x3164, 0x20E2, 0x18C3, 0x18E5, 
-0x18A1, 0x2126, 0x2147, 0x2967, 0x2968, 0x2106, 0x0842, 0x28E3, 0xC40D, 0x930A, 0x0841, 0x1083, 0x10A4, 0x1063, 0x1905, 0x2988, 
-0x2967, 0x2967, 0x2967, 0x2146, 0x18A2, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x932A, 0x932A, 0x3944, 0x0021, 0x2126, 0x2147, 0x10C4, 0x2967, 0x2967, 0x2967, 0x2988, 0x18C4, 0x3103, 0xAB8B, 0xC40D, 0xC40D, 
-0x930A, 0x0841, 0x1083, 0x18A4, 0x10A3, 0x2106, 0x2967, 0x2967, 0x2967, 0x2988, 0x0861, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x10C3, 0x31A9, 0x2967, 0x2988, 0x2967, 0x2967, 0x2147, 
-0x31A9, 0x18C4, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x1041, 0x1083, 0x1083, 0x18C4, 0x2988, 0x2967, 0x2967, 0x2967, 
-0x0821, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x10A3, 
-0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2106, 0x2904, 0x92EA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x18A2, 
-0x1062, 0x18A4, 0x2126, 0x2988, 0x2967, 0x2967, 0x18E4, 0x4165, 0xAB6B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x10A3, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x31A9, 0x1082, 0x6A47, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x0842, 0x10A4, 0x1083, 0x2126, 0x2967, 0x2967, 0x31A9, 0x10A3, 0x6206, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x4165, 0x18C4, 0x2988, 0x2967, 0x2967, 0x2967, 
-0x2967, 0x2147, 0x18A3, 0x7AA9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x1062, 0x1083, 0x1083, 0x18C4, 
-0x2967, 0x2147, 0x2147, 0x0862, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3944, 
-0x18C4, 0x29A8, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x0862, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6A27, 0x0821, 0x18C5, 0x2968, 0x2147, 0x31C8, 0x4209, 0x10A3, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0x18C4, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2968, 0x0862, 0x7A88, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0821, 0x18C5, 0x2147, 0x2987, 0xB510, 0xDE13, 0x41C5, 
-0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0x18E4, 0x2105, 0x1083, 0x18E5, 0x2988, 
-0x2968, 0x2988, 0x0882, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0841, 
-0x10A4, 0x31C8, 0x93EB, 0xACAD, 0x41C5, 0x7268, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x20C2, 0x2126, 0x2105, 0x0842, 0x10A3, 0x18E5, 0x18C4, 0x0862, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0841, 0x10A4, 0x39E8, 0xBCCD, 0xBCCD, 0x18C2, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x18E4, 0x2967, 0x18C4, 0x1083, 0x1083, 0x0821, 0x7268, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0841, 0x18C5, 0x3188, 0x5289, 0x5A89, 
-0x1082, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7268, 0x20C3, 0x2126, 0x29A9, 0x2126, 
-0x0862, 0x1882, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6207, 0x0841, 0x18C5, 0x2167, 0x1907, 0x1907, 0x0841, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xB3CC, 0x0841, 0x2146, 0x31A8, 0x2146, 0x18E5, 0x0862, 0x20A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0841, 0x18C5, 0x2967, 0x2967, 0x2967, 0x0861, 0x82C9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1882, 0x1905, 0x29A8, 0x18E5, 0x1062, 0x1062, 0x51C6, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x0841, 0x18E5, 0x2968, 
-0x2967, 0x2967, 0x0861, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x18A2, 0x2126, 0x2968, 
-0x18E5, 0x0841, 0x4144, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7268, 0x0841, 0x18C4, 0x2947, 0x2967, 0x2967, 0x0861, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xAB8C, 0x1061, 0x2146, 0x2988, 0x18C4, 0x1083, 0x0862, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0821, 0x18A4, 0x2967, 0x2967, 0x0861, 0x82C9, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0841, 0x2146, 0x2988, 0x18E5, 0x0841, 0x4985, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 
-0x0820, 0x18A4, 0x2967, 0x2967, 0x0861, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x0841, 0x2146, 
-0x18E5, 0x10A4, 0x0841, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0821, 0x18A4, 0x2988, 0x2968, 0x0861, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8B, 0x3124, 0x1905, 0x2967, 0x10A4, 0x0863, 0x0841, 0x51C5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0841, 0x10A4, 0x18E5, 0x2988, 
-0x0861, 0x9B4A, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0841, 0x2968, 0x2168, 0x3125, 0x3945, 0x1882, 0x51A5, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7A88, 0x0841, 0x1083, 0x0863, 0x18E5, 0x18A3, 0x3103, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 
-0x3166, 0x3187, 0x51A6, 0x6207, 0x20C2, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0821, 0x1083, 0x18A3, 0x1883, 0x30E4, 0x20A2, 0x28E3, 0xB3AC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x1061, 0x51A5, 0x51A5, 0x51A5, 0x51C6, 0x3124, 0x3924, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0841, 0x20A4, 
-0x30E3, 0x30E3, 0x28C3, 0x3104, 0x20A2, 0x3103, 0x9B4B, 0x82C9, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x1061, 0x4985, 0x51A6, 0x49A5, 0x49A5, 
-0x59E6, 0x3944, 0x28C2, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x1041, 0x30E4, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x3104, 0x20A2, 0x0820, 0x0841, 0x1061, 0x9B2B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x9B2A, 0x1061, 0x4985, 0x51A6, 0x49A5, 0x49A5, 0x49A5, 0x59C6, 0x3924, 0x20C2, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x1041, 0x30E4, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 
-0x28C3, 0x28C3, 0x28E3, 0x30E4, 0x28C3, 0x1061, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_right_6.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_right_6_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xBBED, 0xBBED, 0xBBED, 0xBBED, 0xBBED, 0xBBED, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0x1881, 0x20C2, 0x20C2, 0x20C2, 
-0x20C2, 0x20A2, 0x28E3, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x4965, 0x3165, 0x41C7, 0x41A6, 0x41A6, 0x41A6, 0x41A6, 0x41C7, 0x39A6, 0x3103, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x3145, 0x5A8A, 0x62AA, 0x62AA, 0x5A6A, 0x5229, 0x5249, 0x5249, 0x5229, 0x2925, 
-0x3924, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x51A5, 0x3145, 0x62AA, 0x5A8A, 0x5A69, 0x4A08, 
-0x6AEA, 0x940D, 0x8BCD, 0x8BCD, 0x8BED, 0x9C4E, 0x20E3, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 
-0x1082, 0x62CB, 0x5A69, 0x5A69, 0x5249, 0x62AA, 0xACCF, 0xE653, 0xDE12, 0xDE12, 0xDE13, 0xE653, 0x3144, 0x82C9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x1082, 0x5A69, 0x5249, 0x5249, 0x49E8, 0xA48F, 0xDE33, 0xC571, 0xBD50, 0xBD0F, 
-0xBD2F, 0xC571, 0x2923, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x1082, 0x5A8A, 0x62AA, 0x62CA, 
-0x4A08, 0x9C4E, 0xDE13, 0xB4CE, 0x93CB, 0xACAD, 0xAC8D, 0xA44C, 0x20E2, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x8AE9, 0x1061, 0x62AA, 0xBD50, 0xD5D2, 0x6AEA, 0x93ED, 0xE653, 0x938C, 0x7AAA, 0xFFD9, 0xF777, 0xACAD, 0x20C2, 0x82C9, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x20E3, 0xC591, 0xDE33, 0x62AA, 0x8BCD, 0xD5F2, 0xC571, 
-0xA40D, 0x61E8, 0x6A49, 0xA40C, 0x2102, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0841, 
-0x732B, 0xC551, 0xB4EF, 0xBD10, 0xCD91, 0xCDB2, 0xC550, 0x9BED, 0xA42E, 0xC550, 0x2923, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7247, 0x18C3, 0xACAE, 0xDE33, 0xCDB2, 0xC571, 0xC571, 0xCD91, 0xD612, 0xE694, 0xEE94, 
-0x3144, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0xA46E, 0xC550, 0xC550, 
-0xCDB2, 0xC571, 0xD5D2, 0xCDB1, 0x830B, 0x832B, 0x18C2, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBCD, 0x7268, 0x4A06, 0xBD30, 0xAC8D, 0xA46D, 0xC571, 0xD5D2, 0xC551, 0x7B0A, 0x2022, 0x1801, 0x0800, 0x82C9, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x1061, 0xD5D2, 0xD5F2, 0xAC8D, 0x93CA, 0xAC8D, 0xD5D2, 0x9C0D, 0x2002, 
-0x40C5, 0x6A28, 0x1882, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x3144, 0xBD50, 0xCDD2, 
-0xACAE, 0x9C2C, 0xA42C, 0x9C2C, 0x6AA8, 0x2843, 0x38C4, 0xB4EF, 0x3164, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0xBBED, 0x8AC9, 0x2943, 0xCDB1, 0xCD91, 0xC591, 0xCDB2, 0xB4AE, 0xAC6C, 0x62A7, 0x1041, 0x1061, 0x1061, 0x1081, 0xA34B, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x0840, 0x41A4, 0xCD91, 0xCDB1, 0xCD91, 0xC571, 0xCDB2, 0xC52F, 0x5A46, 0x4164, 
-0xBBED, 0xAB8C, 0xAB8C, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x20C2, 0x2925, 0x31A9, 0x5ACE, 0xC5D7, 0xCDB0, 
-0xC591, 0xC591, 0xCDB2, 0xC52F, 0x3984, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x2105, 
-0x3188, 0x39EA, 0x4A6D, 0x4A6D, 0x6B72, 0xBD76, 0xCDB1, 0xCD91, 0xCD91, 0xCD91, 0x9C2C, 0x3963, 0x7268, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBCD, 0x6206, 0x2105, 0x422C, 0x52AE, 0x4A4C, 0x422C, 0x420B, 0x420C, 0x6B72, 0xA4D3, 0xCD91, 0xCD90, 0xCDB2, 
-0xDDF2, 0x8BED, 0x0863, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x0020, 0x422B, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x420B, 0x422C, 0xAD7A, 0xB555, 0xC571, 0xCD90, 0xDE12, 0x9C90, 0x298A, 0x18C4, 0x7288, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7A88, 0x18E4, 
-0x420B, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422C, 0x4A6D, 0x9D16, 0x94B8, 0xAD14, 0xBD52, 0xCDB2, 0xA4B0, 0x52AF, 0x422B, 
-0x0821, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 0x4A4C, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422B, 0x420B, 0x422B, 0x422C, 0x31CA, 0x9475, 
-0x9CF8, 0x8C78, 0xAD14, 0xC594, 0x8C56, 0x31A9, 0x1061, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x0861, 0x422B, 0x424C, 0x422C, 0x422C, 0x4A4C, 
-0x39EA, 0x2126, 0x2988, 0x422C, 0x420B, 0xB5B9, 0xB579, 0x9CB7, 0x9CD7, 0x9CF8, 0x8434, 0x31A9, 0x1061, 0xB3AC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 
-0x0861, 0x422B, 0x424C, 0x422C, 0x422C, 0x4A4C, 0x39EA, 0x2126, 0x2988, 0x422C, 0x422B, 0xB599, 0xCE7C, 0xC65B, 0xAD79, 0x9CB7, 
-0x8434, 0x3189, 0x1061, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x0841, 0x422B, 0x424C, 0x4A4C, 0x4A6D, 0x39EA, 0x2967, 0x2147, 0x2967, 0x422C, 
-0x422B, 0xAD99, 0xCE9C, 0xCE5B, 0xC63B, 0xBDFA, 0xBE1B, 0x9CF6, 0x39C9, 0x20C2, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x2904, 0x31A9, 0x422C, 0x4A4C, 0x31A9, 
-0x2988, 0x2988, 0x2167, 0x2988, 0x420B, 0x422C, 0x420B, 0xBE1A, 0xD6BD, 0xC63B, 0xC65B, 0xCE5B, 0xD69D, 0xBDFA, 0x424C, 0x0841, 
-0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7AA8, 0x10A3, 0x528D, 0x424C, 0x424C, 0x3A0B, 0x2988, 0x10C4, 0x10C4, 0x31C9, 0x4A6D, 0x422C, 0x422C, 0x6B70, 0xB5B9, 0xCE7C, 
-0xC63B, 0xC63B, 0xCE7C, 0xB5B9, 0x420B, 0x0841, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x1082, 0x4A4C, 0x424C, 0x424C, 0x420B, 0x31EA, 0x0862, 0x0020, 0x31CA, 
-0x4A6D, 0x422C, 0x422C, 0x2969, 0x9CF6, 0xD6BD, 0xC63B, 0xC63B, 0xCE7C, 0xB5B9, 0x422B, 0x18C4, 0x49A5, 0xB3AC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x1082, 0x4A4C, 0x424C, 
-0x4A4C, 0x2988, 0x1905, 0x10A3, 0x10C4, 0x31A8, 0x420B, 0x422C, 0x422C, 0x39CA, 0xA517, 0xD69D, 0xC63B, 0xC63B, 0xCE7C, 0xB5B9, 
-0x39EA, 0x2988, 0x0841, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x8AEA, 0x1062, 0x4A4C, 0x424C, 0x4A4C, 0x31C9, 0x0021, 0x10A3, 0x29A9, 0x2126, 0x2967, 0x422C, 0x422C, 0x39CA, 
-0xA517, 0xD69D, 0xC63B, 0xC63B, 0xCE7C, 0xBDDA, 0x5B0F, 0x31A9, 0x1083, 0x6227, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7288, 0x18C4, 0x4A4C, 0x424C, 0x422C, 0x31C9, 0x0841, 0x1083, 
-0x2988, 0x2967, 0x2988, 0x424C, 0x422C, 0x39CA, 0xA517, 0xD69D, 0xC63B, 0xC63B, 0xC63B, 0xCE7C, 0xC65B, 0x52AE, 0x29A9, 0x0882, 
-0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x18C4, 0x4A6D, 
-0x424C, 0x424C, 0x2988, 0x2988, 0x0862, 0x1082, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x39CA, 0xA517, 0xD69D, 0xC63B, 0xC63B, 
-0xC63B, 0xCE5C, 0xC61B, 0x52AD, 0x2988, 0x0862, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x18C4, 0x4A8D, 0x424C, 0x4A4C, 0x2988, 0x0862, 0x10C4, 0x2147, 0x31C9, 0x4A4D, 0x424C, 0x422C, 
-0x422C, 0x39CA, 0xA537, 0xD6BD, 0xC63B, 0xC63B, 0xC63B, 0xCE5C, 0xC61B, 0x52AD, 0x2968, 0x2147, 0x1082, 0x7268, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x18C4, 0x4A6D, 0x422B, 0x2988, 0x2968, 0x0020, 
-0x18C4, 0x2167, 0x31A8, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x39EB, 0x8434, 0xC63B, 0xD69C, 0xCE5C, 0xC63B, 0xCE5C, 0xC61B, 0x52AD, 
-0x2147, 0x2967, 0x2147, 0x0862, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 
-0x18E4, 0x52CF, 0x422C, 0x39CA, 0x2967, 0x0841, 0x10C3, 0x31C9, 0x420B, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x3A0B, 0x7BD3, 0xAD59, 
-0xAD58, 0xB5BA, 0xCE5C, 0xCE5C, 0xC61B, 0x528D, 0x39EA, 0x2967, 0x31C9, 0x39EB, 0x18C4, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x3965, 0x3188, 0x4A4C, 0x4A4D, 0x3A0B, 0x0861, 0x1082, 0x39EA, 0x4A6D, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x3A0B, 0x7BF3, 0x9CB7, 0x8C35, 0xA518, 0xCE7C, 0xCE5C, 0xC61B, 0x4A4C, 0x422C, 0x2988, 0x39C9, 0x52AE, 
-0x422B, 0x18C3, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 0x4A4C, 0x424C, 
-0x4A8D, 0x1082, 0x18E4, 0x422B, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EB, 0x8C75, 0xB59A, 0xA538, 0xB5B9, 0xCE5C, 0xCE5C, 
-0xC65B, 0x7391, 0x4A6D, 0x2988, 0x39EA, 0x4A6D, 0x4A6D, 0x422C, 0x18C3, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x82C9, 0x1082, 0x4A4C, 0x424C, 0x4A6D, 0x0861, 0x2947, 0x528E, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39CA, 
-0xA537, 0xD6DD, 0xCE7C, 0xCE5C, 0xC63B, 0xC63B, 0xBDDA, 0xAD39, 0x5ACF, 0x2126, 0x2126, 0x420B, 0x4A4D, 0x4A6D, 0x4A4C, 0x0842, 
-0x7A88, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x1082, 0x4A6D, 0x424C, 0x4A6D, 0x0861, 0x2947, 0x4A8D, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39CA, 0xA517, 0xD69D, 0xC63B, 0xC63B, 0xC65B, 0xBDFA, 0x9496, 0xA518, 0x5B0F, 0x1082, 
-0x1061, 0x2925, 0x4A4C, 0x424C, 0x3A0B, 0x4209, 0x0821, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x10A3, 
-0x4A4C, 0x424C, 0x4A6D, 0x0862, 0x2946, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39CA, 0xA517, 0xD69D, 0xC63B, 0xC63B, 
-0xC65B, 0xBDFA, 0x9CF7, 0xCE5C, 0x6B50, 0x1083, 0x8AC9, 0x82C9, 0x18E4, 0x3A0B, 0x4209, 0xC571, 0x2903, 0x930A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x10A3, 0x422C, 0x31A9, 0x2167, 0x0861, 0x2126, 0x4A6D, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x39CA, 0xA517, 0xD69D, 0xC63B, 0xC63B, 0xC63B, 0xC65B, 0xCE7C, 0xD6BD, 0x6B50, 0x1083, 0x7268, 0xC40D, 0x7247, 0x3165, 
-0xC571, 0xCDB2, 0xC550, 0x3144, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0841, 0x2988, 0x2967, 0x2127, 
-0x0000, 0x18C5, 0x52CF, 0x422C, 0x422C, 0x422C, 0x422C, 0x39CA, 0xAD78, 0xE73F, 0xDEDE, 0xDEDE, 0xDF1E, 0xC63B, 0x4A6B, 0x4A6B, 
-0x528D, 0x18C4, 0x6A47, 0xC40D, 0x82C9, 0x3164, 0xDE12, 0xAC8D, 0xDE13, 0x2103, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x9B4B, 0x0841, 0x08A5, 0x0885, 0x734C, 0xA46E, 0x4A06, 0x2106, 0x528D, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x5ACD, 0x630E, 
-0x5B0E, 0x5B0E, 0x632E, 0x52CD, 0x1906, 0x18E5, 0x31A9, 0x10A3, 0x7247, 0xC40D, 0x82A9, 0x2923, 0xB4CE, 0x9C2C, 0xACAD, 0x9C4D, 
-0x41A5, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x932A, 0x1081, 0x942E, 0x7BAD, 0xBD50, 0xFF16, 0x62A7, 0x0001, 0x3A0B, 
-0x31C9, 0x31C9, 0x31C9, 0x39EA, 0x2127, 0x10C5, 0x10C5, 0x18E5, 0x10A4, 0x0863, 0x18E5, 0x2947, 0x2967, 0x1082, 0x7247, 0xC40D, 
-0x7268, 0x2923, 0xBCCD, 0xA42C, 0x93AA, 0xFED5, 0x5AA8, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x51C5, 0x83AB, 
-0xD5F2, 0xD5D2, 0xDE33, 0x5A87, 0x0000, 0x2967, 0x2146, 0x2146, 0x2146, 0x1905, 0x18E5, 0x2147, 0x2968, 0x2968, 0x2126, 0x0842, 
-0x1062, 0x2147, 0x2988, 0x0862, 0x7AA8, 0xC40D, 0xA34B, 0x3964, 0x6AE8, 0xB48D, 0xCD50, 0x942C, 0x41A5, 0x9B2A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0x1041, 0xA48E, 0xD5D2, 0xE653, 0x62A8, 0x0001, 0x2988, 0x2967, 0x2967, 0x2967, 0x1083, 
-0x0842, 0x10C4, 0x2147, 0x2967, 0x18E5, 0x1083, 0x18C4, 0x2147, 0x2988, 0x18C4, 0x4985, 0xB3AC, 0xC40D, 0xBBCD, 0x28E3, 0x72E8, 
-0x9C4D, 0x1081, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x3144, 0xB4EF, 0xD5D2, 0xDE13, 0x5A67, 
-0x0001, 0x2988, 0x2967, 0x2967, 0x2967, 0x18A4, 0x1083, 0x0000, 0x10A3, 0x2106, 0x1062, 0x18E5, 0x2967, 0x2967, 0x2967, 0x31A9, 
-0x10C3, 0x4985, 0xC40D, 0xC40D, 0xBBCD, 0x20C2, 0x20A2, 0x1881, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 
-0x18C2, 0xCD91, 0xCDB2, 0xCDB1, 0xC52F, 0x49C4, 0x0021, 0x2988, 0x2967, 0x2967, 0x2967, 0x18A4, 0x1083, 0x0841, 0x0841, 0x1083, 
-0x18C4, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x10A3, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xBBED, 0xBBED, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x18C2, 0xCD91, 0xD5F2, 0xB4AE, 0xBCCE, 0x49E5, 0x0021, 0x2988, 0x2967, 0x2967, 
-0x2967, 0x18A4, 0x10A4, 0x0841, 0x0841, 0x10A4, 0x1083, 0x18C4, 0x2967, 0x2967, 0x2967, 0x2988, 0x10A3, 0x59C6, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x2923, 0x2923, 0x20C2, 
-0x18A1, 0x18E3, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x18C4, 0x0841, 0x6A47, 0x6A27, 0x0862, 0x1083, 0x10A4, 0x2968, 0x2967, 
-0x2967, 0x2988, 0x10A3, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x1061, 0x0883, 0x10C4, 0x1906, 0x2988, 0x2147, 0x2967, 0x2967, 0x2988, 0x1082, 0x59C6, 0xC40D, 
-0x6207, 0x0841, 0x18A4, 0x1083, 0x18C5, 0x2147, 0x2967, 0x2988, 0x1082, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20A2, 0x2126, 0x29A9, 0x2967, 0x2147, 0x2967, 
-0x2967, 0x2967, 0x2106, 0x0841, 0x930A, 0xC40D, 0xA36B, 0x4144, 0x0862, 0x1083, 0x1083, 0x2147, 0x2967, 0x2968, 0x2126, 0x20E3, 
-0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x20A2, 0x1905, 0x2988, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x0862, 0x4164, 0xAB8C, 0xC40D, 0xC40D, 0x82A9, 0x0821, 0x18A4, 
-0x1083, 0x2967, 0x2967, 0x2147, 0x31A9, 0x18E4, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x82C9, 0x18A3, 0x2126, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2106, 0x0840, 0xB3AC, 
-0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x20C3, 0x1062, 0x1083, 0x2105, 0x2147, 0x2967, 0x2988, 0x18C4, 0x4164, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x0820, 0x2147, 0x2988, 0x2967, 0x2967, 
-0x2967, 0x2967, 0x2146, 0x0862, 0x28E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0020, 0x1083, 0x1062, 0x2126, 0x2147, 
-0x2147, 0x10A4, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x9B4B, 0x1081, 0x2146, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x2105, 0x1061, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x930A, 0x0820, 0x1083, 0x10A3, 0x2126, 0x31A8, 0x422A, 0x2105, 0x4144, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x1061, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2126, 0x1062, 0x1881, 
-0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0820, 0x1083, 0x2147, 0x18E6, 0x942E, 0xEE74, 0x6B09, 0x4164, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 0x2967, 0x18C4, 0x1083, 
-0x2126, 0x29A8, 0x2126, 0x1062, 0x1881, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x0841, 0x10A4, 0x2147, 0x2147, 
-0x7B4A, 0xBCEE, 0x62A8, 0x51A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xABAC, 0x0841, 0x2147, 0x1083, 0x0842, 0x10A4, 0x20E5, 0x1083, 0x1861, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7268, 0x0821, 0x18C4, 0x2967, 0x2147, 0x9C0B, 0xD56F, 0x49E5, 0x49A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x3124, 0x1905, 0x2147, 0x2126, 0x2126, 0x18E5, 0x0842, 0x1881, 0xA36B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0821, 0x18A4, 0x2967, 0x2147, 0x4A49, 0x5227, 0x49A5, 0xAB8C, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0862, 0x29A8, 0x2967, 
-0x2988, 0x2967, 0x10A3, 0x1881, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x0020, 0x18A4, 
-0x2967, 0x2967, 0x2168, 0x0021, 0x7268, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x930A, 0x0841, 0x2967, 0x2967, 0x2126, 0x1083, 0x18A2, 0xA36B, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xAB8C, 0x4165, 0x0841, 0x10A4, 0x2967, 0x2967, 0x2105, 0x2903, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x59E6, 0x10A3, 0x2967, 0x2967, 0x18A4, 0x0020, 0x8AC9, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x0841, 0x18C4, 0x18E5, 0x2967, 0x2968, 0x0841, 0x9B2A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x1082, 0x31A8, 
-0x2967, 0x2147, 0x10A3, 0x0841, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A27, 0x0821, 
-0x18C5, 0x2988, 0x2967, 0x2968, 0x0861, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7247, 0x1082, 0x2988, 0x2147, 0x1083, 0x0820, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x0841, 0x18C5, 0x2967, 0x2967, 0x2967, 0x0861, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A68, 0x0862, 0x2988, 0x2147, 0x1083, 0x0820, 0x930A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x0862, 0x1083, 0x18C4, 0x2968, 0x2147, 0x0861, 
-0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x18A3, 
-0x2147, 0x2967, 0x2967, 0x18A4, 0x0820, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 
-0x0862, 0x1083, 0x18C4, 0x2968, 0x2147, 0x0841, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x10A3, 0x31A9, 0x1927, 0x10A4, 0x0862, 0x6A47, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x0842, 0x1083, 0x18C4, 0x2988, 0x2967, 0x0841, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x20E4, 0x1906, 0x2988, 0x3966, 0x28E3, 0x0840, 
-0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x0842, 0x1083, 0x10A4, 0x18E5, 
-0x18E5, 0x0820, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x30E3, 
-0x2104, 0x41C8, 0x4186, 0x59C5, 0x51A5, 0x1061, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x49A5, 0x1062, 0x20C4, 0x18A3, 0x1883, 0x1883, 0x1882, 0x51A5, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0x30E3, 0x59C6, 0x51A5, 0x51A6, 0x4985, 0x0841, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x1882, 0x30E4, 0x30E3, 0x30E3, 0x30E3, 0x3104, 0x1882, 0x51C6, 
-0x9B2A, 0x82A9, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0x28E3, 0x59C6, 0x49A5, 0x51A6, 
-0x4985, 0x1882, 0x82A9, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x1862, 0x30E4, 
-0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x3104, 0x1862, 0x0820, 0x0841, 0x28E3, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4164, 0x28E3, 0x59C6, 0x49A5, 0x49A5, 0x51A6, 0x51A6, 0x1061, 0x8AEA, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x1862, 0x30E4, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28E3, 0x28E3, 0x30E4, 0x20A2, 0x28C2, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_right_7.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_right_7_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC3ED, 0xBBED, 0xBBED, 0xBBED, 0xBBED, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0x1881, 0x20C2, 0x20C2, 0x20C2, 0x1882, 0x3944, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4965, 0x3165, 0x41C7, 0x41A6, 
-0x41C7, 0x3986, 0x3166, 0x2104, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x4985, 0x3145, 0x5A8A, 0x62AA, 0x62AA, 0x5229, 0x6B0B, 0xACCF, 0x9C4E, 0x7309, 0x4165, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x51A5, 0x3145, 0x62AA, 0x5A8A, 0x5A69, 0x4A08, 0x62AA, 0xACCF, 0xDE32, 0xDE13, 
-0xDE33, 0x5A87, 0x49A5, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x1082, 0x62CB, 0x5A69, 0x5A69, 
-0x4A08, 0x628A, 0xB4EF, 0xDE12, 0xC591, 0xC591, 0xB4CE, 0xB4AD, 0x18C2, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x8AE9, 0x1082, 0x5A69, 0x5A69, 0x5249, 0x5A8A, 0xB4CF, 0xDE12, 0xC591, 0xC591, 0xBD50, 0xBD0F, 0xC570, 0x49E5, 0x6227, 
-0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x1082, 0x5A69, 0x5A69, 0x4A08, 0xACCF, 0xD5F2, 0xC591, 0xCD91, 
-0xB4CE, 0x9C2C, 0xEF37, 0xF757, 0xC570, 0x3123, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x1082, 0x5A8A, 
-0x5A69, 0x4A08, 0xACAF, 0xD5D2, 0xCDB2, 0xBD4F, 0x8B6A, 0x5166, 0x61A7, 0x59A7, 0xA42C, 0x3984, 0x7247, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x1082, 0x62AA, 0x5A69, 0x4A29, 0x4A08, 0xA48F, 0xDE12, 0xC571, 0xBD30, 0xB4CF, 0xB4CF, 0xB4CF, 
-0xC530, 0xD5F2, 0x5247, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7268, 0x20E3, 0x5249, 0x9C6E, 0xB4EF, 0x732B, 
-0x8BED, 0xD5D2, 0xCDB1, 0xCDD2, 0xCDB1, 0xCDB1, 0xE674, 0x9BCD, 0x20A3, 0x51A5, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xAB8B, 0x0020, 0x5A6A, 0xCDB2, 0xE653, 0xA4AF, 0xACAF, 0xCDB1, 0xC591, 0xC591, 0xCD91, 0xDE53, 0x8B8C, 0x40C5, 0x1001, 0x59E6, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x59E6, 0x2924, 0x838C, 0xCDB2, 0xCD70, 0xC550, 0xCDD2, 0xCDB1, 0xCD91, 
-0xC571, 0x8B6B, 0x38A4, 0x2802, 0x1021, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x1083, 
-0x83AD, 0xB4CE, 0xACAE, 0xB4EF, 0xBD30, 0xD5D2, 0xC571, 0x38A4, 0x2843, 0x7AAA, 0x4185, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x1883, 0x9C4E, 0xCD91, 0x9BEB, 0xA42C, 0xC570, 0xBD30, 0x3904, 0x1821, 0x940D, 
-0x5AA7, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3944, 0x734A, 0xE654, 0xBD30, 
-0xA42C, 0x9C0B, 0x8369, 0x20E2, 0x18A2, 0x0841, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x3924, 0x7B4A, 0xDE33, 0xCDB1, 0xC570, 0x838A, 0x1881, 0xAB8C, 0xBBED, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3924, 0x732A, 0xDE33, 0xCDB1, 0xC570, 0x8369, 0x1061, 0xB3AC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x3123, 0x28E2, 0x5ACD, 0xBD53, 
-0xD5B0, 0xC591, 0xD5B2, 0xA46D, 0x1061, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 
-0x3123, 0x3944, 0x2967, 0x2967, 0x52AE, 0x9CB6, 0xCDB4, 0xCD90, 0xCDB2, 0xC571, 0x838B, 0x4164, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x3103, 0x2967, 0x2947, 0x4A6D, 0x528D, 0x39EA, 0x4A6E, 0x9475, 0xCDD4, 0xCD8F, 0xD5D1, 
-0xD5D2, 0x0861, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x3124, 0x3188, 0x52AE, 0x4A8D, 0x422C, 0x422C, 
-0x4A4C, 0x39CA, 0x4A6E, 0x9474, 0xBD74, 0xBD53, 0xCD90, 0x6AE8, 0x5A06, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 
-0x2126, 0x5ACF, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x4A4C, 0x31CA, 0x5AEF, 0xA51A, 0x9496, 0xBD73, 0xDE36, 0x2903, 0x82C9, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x61E6, 0x20E5, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x424C, 0x422B, 0x3A0B, 0x39EA, 0x5AEF, 
-0x9CD7, 0xA518, 0x94B7, 0x9CD8, 0x39C8, 0x6A47, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6206, 0x18E5, 0x4A6D, 0x422C, 0x422C, 
-0x422C, 0x424C, 0x2988, 0x2126, 0x31C9, 0x39EB, 0x6350, 0xCE7C, 0x9CD7, 0x9CD7, 0xAD5A, 0x3187, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x6206, 0x18E4, 0x4A8D, 0x422C, 0x424C, 0x4A4C, 0x3188, 0x2147, 0x2146, 0x31C9, 0x39EB, 0x6330, 0xD69C, 0xC63B, 0xC63B, 
-0xB59A, 0x2946, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x2105, 0x422C, 0x4A4C, 0x4A4C, 0x424C, 0x2988, 0x2988, 0x0862, 0x10A3, 
-0x39EA, 0x39EB, 0x6B70, 0xDEFE, 0xC65B, 0xC65B, 0xC61B, 0xBE1A, 0x4A49, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3944, 0x2947, 0x528E, 0x424C, 
-0x420B, 0x2988, 0x2147, 0x1083, 0x10A3, 0x1905, 0x31C9, 0x424C, 0x4A6C, 0x7BF2, 0xC65B, 0xC65B, 0xC65B, 0xEF5F, 0x5AED, 0x51A5, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x4985, 0x2126, 0x4A8D, 0x424C, 0x422C, 0x39EA, 0x29A8, 0x0000, 0x18E4, 0x31CA, 0x420B, 0x4A4C, 0x39EB, 0x4A6D, 
-0xC65B, 0xC65B, 0xC63B, 0xE73F, 0x4229, 0x6A27, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x2126, 0x4A8D, 0x422C, 0x422C, 0x39CA, 0x18E4, 0x10A3, 
-0x1905, 0x420B, 0x4A6D, 0x422C, 0x420B, 0x5ACE, 0xC65B, 0xC65B, 0xC63B, 0xD6BD, 0x94B4, 0x41C7, 0x932A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x2126, 
-0x4A8D, 0x4A4C, 0x420B, 0x2126, 0x0000, 0x2146, 0x2967, 0x31A9, 0x422B, 0x424C, 0x420B, 0x5ACE, 0xC65B, 0xC65B, 0xC63B, 0xC63B, 
-0xEF9F, 0x7C11, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x2126, 0x4A8D, 0x4A4C, 0x422B, 0x2147, 0x0020, 0x2126, 0x2967, 0x2126, 0x31A9, 0x4A4D, 
-0x420B, 0x5ACE, 0xC65B, 0xC65B, 0xC63B, 0xC63B, 0xDF1F, 0x6B6F, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4164, 0x2947, 0x4A6D, 0x4A4C, 0x3A0B, 0x2126, 
-0x0841, 0x2126, 0x2988, 0x2147, 0x39CA, 0x4A4C, 0x420B, 0x5ACE, 0xC65B, 0xC65B, 0xC63B, 0xC63B, 0xDF1F, 0x6B6F, 0x4164, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3123, 
-0x2967, 0x4A6D, 0x4A4C, 0x420B, 0x1905, 0x0020, 0x2146, 0x2147, 0x39EA, 0x424C, 0x422C, 0x424C, 0x420B, 0x5ACE, 0xC65B, 0xC65B, 
-0xC63B, 0xC63B, 0xDF1F, 0x6B6F, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28E3, 0x3188, 0x4A6D, 0x4A4C, 0x420B, 0x1905, 0x0020, 0x2147, 0x2147, 0x3A0A, 0x4A4C, 
-0x424C, 0x422C, 0x420B, 0x5ACE, 0xC65B, 0xC65B, 0xC63B, 0xC63B, 0xE71F, 0x632E, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x2967, 0x528E, 0x39EA, 0x2967, 
-0x2126, 0x0020, 0x2147, 0x2126, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x420B, 0x5ACE, 0xC65B, 0xC65B, 0xC63B, 0xC63B, 0xCE7C, 0xBDFA, 
-0x62EC, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x3103, 0x2967, 0x4A8D, 0x420B, 0x31A9, 0x18E5, 0x0020, 0x2146, 0x39CA, 0x422B, 0x4A4C, 0x422C, 0x422C, 0x3A0B, 0x5ACE, 
-0xCE7C, 0xCE7C, 0xCE7C, 0xC65B, 0xC63B, 0xE73F, 0x9494, 0x18A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x31A9, 0x52AE, 0x4A4C, 0x4A4C, 0x2967, 0x0020, 0x2146, 0x422C, 
-0x4A4C, 0x422C, 0x422C, 0x422C, 0x420B, 0x52AE, 0xB599, 0xB599, 0xAD79, 0xBE1A, 0xC65B, 0xDEFE, 0x8432, 0x28E3, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x2925, 0x3A0B, 
-0x4A4C, 0x4A6D, 0x39EA, 0x0020, 0x2126, 0x420B, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x422B, 0x528D, 0x9476, 0x9476, 0x8C35, 0xB5B9, 
-0xCE7C, 0xDF1F, 0x7C11, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 0x2105, 0x4A8E, 0x4A4D, 0x39C9, 0x0000, 0x2988, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 
-0x420B, 0x52AE, 0xA538, 0xA538, 0xA4F8, 0xBDFA, 0xCE7C, 0xD69D, 0x8C74, 0x3965, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0x2946, 0x528E, 0x4A4C, 0x39CA, 0x1062, 
-0x39EA, 0x424C, 0x422C, 0x422C, 0x422C, 0x422C, 0x420B, 0x5ACE, 0xCE7C, 0xCE7C, 0xCE5C, 0xC65B, 0xC65B, 0xA518, 0xB59A, 0xAD77, 
-0x1081, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x4985, 0x2126, 0x4A6D, 0x424C, 0x4A4C, 0x420B, 0x0841, 0x39C9, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x420B, 0x5ACE, 0xC65B, 0xC65B, 
-0xC65B, 0xCE7C, 0xAD79, 0x9476, 0xBDDB, 0xA516, 0x18A2, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C5, 0x2126, 0x528E, 0x422C, 0x2947, 0x0000, 0x39C9, 0x4A4D, 0x422C, 
-0x422C, 0x422C, 0x420B, 0x5ACE, 0xC65B, 0xC65B, 0xC63B, 0xC65B, 0xC61B, 0xC63B, 0xDEFE, 0xA516, 0x18A2, 0xBBCD, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x10A3, 0x31C9, 
-0x2968, 0x10A5, 0x0000, 0x39EA, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x39EB, 0x5AEE, 0xDEDD, 0xDEFE, 0xDEDE, 0xD6DE, 0xEF7F, 0x9CF5, 
-0x3A0A, 0x39E9, 0x1881, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x61E6, 0x0862, 0x08A6, 0x2147, 0x942E, 0x8BCC, 0x2924, 0x31CA, 0x4A6D, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A6D, 
-0x5B0E, 0x5B0E, 0x5B0E, 0x5B0E, 0x634F, 0x3A0A, 0x18E5, 0x10C5, 0x1882, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x41E6, 0x9C6F, 0x8BED, 0xDE32, 0xE653, 0x18C1, 
-0x18C5, 0x39EA, 0x31C9, 0x31C9, 0x39CA, 0x31C9, 0x18E5, 0x10C5, 0x10C5, 0x18E5, 0x10C5, 0x2126, 0x1906, 0x2104, 0x5A46, 0x59E6, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 
-0x49E5, 0xB4EF, 0xE633, 0xCD91, 0xCDB1, 0x20E2, 0x10A4, 0x2167, 0x2146, 0x2147, 0x2126, 0x18E5, 0x2106, 0x2967, 0x2988, 0x2106, 
-0x2126, 0x2988, 0x0883, 0x2922, 0xAC8D, 0x0861, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xC40D, 0x930A, 0x20E2, 0xDE33, 0xCD91, 0xCDD2, 0x20E2, 0x10A4, 0x2988, 0x2967, 0x2967, 
-0x2126, 0x0842, 0x1063, 0x2126, 0x2126, 0x18C4, 0x2106, 0x2988, 0x10A4, 0x2902, 0x9BEB, 0x1081, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6206, 0x5A87, 0xD5F2, 0xCD91, 
-0xC571, 0x20E2, 0x10A4, 0x2988, 0x2967, 0x2967, 0x2126, 0x10A4, 0x1083, 0x1062, 0x0862, 0x2126, 0x2968, 0x2988, 0x10A4, 0x2922, 
-0x9C0C, 0x1881, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x59E6, 0x5A67, 0xE674, 0xCD91, 0xC571, 0xA46C, 0x18A1, 0x10C4, 0x2988, 0x2967, 0x2967, 0x2967, 0x2147, 0x1083, 0x0020, 
-0x0862, 0x2126, 0x2967, 0x2988, 0x10A4, 0x2902, 0x8BCA, 0x1081, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59C6, 0x5267, 0xEE94, 0xC571, 0xAC6D, 0xAC6C, 0x18A1, 0x10C4, 0x2988, 
-0x2967, 0x2967, 0x2967, 0x2147, 0x1083, 0x0020, 0x0862, 0x2126, 0x2967, 0x2988, 0x18E5, 0x0020, 0x1081, 0x1061, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x6206, 0x2944, 
-0x2903, 0x20C2, 0x20C2, 0x2105, 0x2147, 0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x1083, 0x0000, 0x0862, 0x2126, 0x2967, 0x2988, 
-0x18E5, 0x20C2, 0xA36B, 0xA34B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x82A8, 0x8AE9, 0x82A9, 0x0840, 0x2126, 0x2988, 0x2947, 0x2967, 0x2967, 0x2967, 0x2147, 
-0x0841, 0x0862, 0x1063, 0x2126, 0x2967, 0x2988, 0x18E5, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x1081, 0x2126, 
-0x2967, 0x2967, 0x2967, 0x2967, 0x2147, 0x10A4, 0x0000, 0x1083, 0x1083, 0x2126, 0x2967, 0x2988, 0x18E5, 0x28E3, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1061, 0x2126, 0x2968, 0x2967, 0x2967, 0x2967, 0x2126, 0x0862, 0x0000, 0x1083, 0x1063, 0x2106, 
-0x2967, 0x2988, 0x18E5, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x7A88, 0x18A3, 0x2146, 0x2967, 0x2967, 0x2967, 0x2988, 
-0x2126, 0x0841, 0x0841, 0x1083, 0x18C4, 0x2126, 0x2967, 0x2988, 0x18E5, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0020, 
-0x2967, 0x2968, 0x2967, 0x2967, 0x2967, 0x2967, 0x18E4, 0x0000, 0x1084, 0x1083, 0x2147, 0x2967, 0x2147, 0x2147, 0x18C4, 0x28E3, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x92EA, 0x0861, 0x2147, 0x2967, 0x2967, 0x2967, 0x2968, 0x2106, 0x0842, 0x0020, 0x1083, 0x1083, 
-0x2126, 0x2147, 0x3188, 0x4209, 0x2946, 0x28C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x0861, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 
-0x2988, 0x2126, 0x0862, 0x0841, 0x1083, 0x1083, 0x2126, 0x10E6, 0x83AD, 0xEE74, 0x838B, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x1082, 
-0x2967, 0x2967, 0x18A4, 0x1083, 0x2126, 0x29A8, 0x2126, 0x1062, 0x28E3, 0xAB8C, 0x0841, 0x1083, 0x18E6, 0x6B0A, 0xBCEE, 0x7309, 
-0x4164, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0x82A9, 0x0861, 0x29A8, 0x2147, 0x1063, 0x1063, 0x18C4, 0x10A3, 0x0841, 0x28E3, 0x930A, 0x3103, 
-0x1062, 0x1062, 0x10C6, 0x8BAB, 0xDD8F, 0x5A67, 0x3103, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x20E3, 0x2126, 0x2967, 0x2967, 0x2126, 0x10A4, 
-0x18A4, 0x0821, 0x20A2, 0xB3CC, 0xA36B, 0x0821, 0x10A4, 0x1905, 0x2127, 0x4A49, 0x5247, 0x49A5, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 
-0x10A3, 0x31A9, 0x2967, 0x2967, 0x2126, 0x18C4, 0x1062, 0x20C3, 0xAB8C, 0xC40D, 0x8AEA, 0x0820, 0x1083, 0x2967, 0x2967, 0x2988, 
-0x0042, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x3924, 0x18E5, 0x2988, 0x2967, 0x2105, 0x1083, 0x1062, 0x20A2, 0xABAC, 0xC40D, 0xC40D, 
-0xA34B, 0x0020, 0x1083, 0x2147, 0x2967, 0x2126, 0x20E3, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3924, 0x18C4, 0x31C9, 0x2967, 0x2105, 0x1063, 
-0x1062, 0x18A2, 0xB3AC, 0xC40D, 0xC40D, 0xBBED, 0x6227, 0x0841, 0x1083, 0x2147, 0x2988, 0x0861, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x3944, 0x18E4, 0x2988, 0x2105, 0x1063, 0x1063, 0x18A2, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x0841, 0x18A4, 0x18A4, 0x2147, 
-0x2988, 0x1082, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x18E4, 0x29A8, 0x2105, 0x1083, 0x1062, 0x1882, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7A88, 0x0821, 0x18A4, 0x2967, 0x2967, 0x2988, 0x1082, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x18E4, 0x31A9, 0x2126, 0x0842, 
-0x1882, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x0820, 0x18A4, 0x2967, 0x2967, 0x1082, 0x7268, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x4985, 0x18C4, 0x2967, 0x2126, 0x1062, 0x28E3, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7AA8, 0x1082, 0x1083, 0x10A4, 
-0x2967, 0x2968, 0x0841, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCC, 0x4985, 0x30E3, 0x2967, 0x2188, 0x1906, 0x0841, 0x28C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x59E6, 0x0841, 0x18A4, 0x10A4, 0x2988, 0x2988, 0x0861, 0x82C9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x0820, 0x4985, 0x49A6, 0x41A7, 0x20E4, 
-0x20C2, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0841, 0x1084, 0x1083, 0x18E5, 0x18E5, 0x0021, 0x9B2A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6227, 0x28C3, 0x4985, 0x51A5, 0x61E6, 0x20C2, 0x6207, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x0841, 
-0x20C4, 0x18A3, 0x1883, 0x1883, 0x1882, 0x4164, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0841, 0x59E6, 0x51C6, 0x49A5, 0x51C6, 0x3124, 0x3924, 0xAB8C, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x1061, 0x30E4, 0x30E3, 0x30E3, 0x30E3, 0x3904, 0x1882, 0x4164, 0x9B4B, 0x82C9, 0x9B2A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20C2, 0x3944, 0x4985, 0x51A5, 
-0x49A5, 0x59E6, 0x3124, 0x28C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x1061, 0x30E4, 0x28C3, 0x28C3, 0x28C3, 
-0x28C3, 0x3104, 0x1882, 0x0820, 0x0841, 0x20A2, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xB3AC, 0x1061, 0x4165, 0x51A6, 0x49A5, 0x59C6, 0x3103, 0x3923, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x6207, 0x1061, 0x30E4, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28E3, 0x28E3, 0x30E4, 0x20A3, 0x1881, 0xBBCC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_right_8.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_right_8_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xBBED, 0xBBED, 0xBBED, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x1061, 0x20C2, 0x20A2, 0x28E3, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x20C3, 0x49E7, 0x41C6, 0x41A6, 
-0x2925, 0x28E3, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x8AC9, 0x18C2, 0x5228, 0x6ACB, 0x5A6A, 0x5A8A, 0xA46F, 0x838B, 0x3124, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x18A2, 0x5249, 0x6ACB, 0x4A08, 0x5A69, 0x9C4E, 0xDDF2, 0xEE94, 0x6AC8, 0x3103, 
-0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x18C2, 0x5249, 0x62AA, 0x4A28, 0x5A69, 
-0x9C4E, 0xDE12, 0xCD91, 0xB4CE, 0xEE93, 0x7B6A, 0x3103, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x0841, 0x5249, 0x62AA, 0x5249, 0x5A69, 0x9C2E, 0xDE32, 0xC591, 0xC550, 0xB50E, 0xDE74, 0xD5B1, 0x6AA8, 0x3964, 0xBBCD, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x4A08, 0x5A8A, 0x49E8, 0x940D, 0xDE12, 0xCD91, 0xBD0F, 0x9BEB, 0xEF16, 
-0x728A, 0x7AC8, 0xDE32, 0x7B6B, 0x3944, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x4A08, 0x5A8A, 0x49E8, 
-0x8BED, 0xDE12, 0xC550, 0x93CB, 0x5986, 0x5987, 0xB4CF, 0xACAD, 0xCD91, 0x734A, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x1061, 0x4A08, 0x5A8A, 0x5229, 0x49E8, 0x8BCD, 0xDE12, 0xBD30, 0xB4CF, 0xB4CF, 0xC571, 0xD5F2, 0x832B, 0x38A4, 
-0x2062, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0840, 0x5249, 0x5A69, 0x8BCD, 0xBD10, 0x83AC, 0x7B4C, 0xD5D2, 
-0xCDB2, 0xCDB2, 0xCD91, 0xDE33, 0x7289, 0x3023, 0x2042, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x18C2, 
-0x41C8, 0xB510, 0xEE94, 0xB4EF, 0x9C4E, 0xD5D2, 0xC591, 0xC591, 0xC591, 0xDE33, 0x72CA, 0x2002, 0x59E7, 0x7309, 0x61E6, 0xBBED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x1082, 0x6AEA, 0xCD92, 0xE674, 0xC570, 0xB4CE, 0xCDB2, 0xCDB2, 0xCD91, 0xDE33, 
-0x7289, 0x0000, 0x830B, 0xD612, 0x0820, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x1062, 0x4A27, 0xACCF, 
-0xD5D2, 0xA46D, 0xBD0F, 0xBD0F, 0xC591, 0xDE33, 0x8B8B, 0x59A6, 0x7B0A, 0x62C8, 0x6206, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x20C2, 0x4185, 0xBD30, 0xCD91, 0x9BEB, 0x9BEB, 0xB4EF, 0xC550, 0xBD2F, 0xACAD, 0x49E5, 0x6206, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82C9, 0x2923, 0xD5D2, 0xA46C, 0xA42C, 
-0x9C0B, 0xA42C, 0xAC6C, 0x41C5, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7A88, 0x3184, 0xDDF2, 0xC571, 0xA44C, 0x9C2C, 0xB48D, 0x41C5, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x3164, 0xE633, 0xC591, 0xA42C, 0xAC6C, 0x41C5, 0x6206, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x10A3, 0x422B, 0x736E, 
-0xD5F2, 0xD5B1, 0xD5F2, 0x2903, 0x82C9, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x8AEA, 0x18A3, 0x420B, 0x4A4D, 0x422C, 0x734E, 0x734E, 0xD5D2, 0xBD2F, 0x3144, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AEA, 0x18A3, 0x420B, 0x528E, 0x422C, 0x422C, 0x31CB, 0x31CB, 0x6B0D, 0xDE33, 
-0xC52F, 0x3984, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x18C3, 0x420B, 0x528E, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x29AB, 0x6B2D, 0xDE36, 0x732B, 0x3123, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xBBED, 0x1061, 0x39CA, 0x528E, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A4C, 0x4A4C, 0x298A, 0x73B4, 0x73B2, 0x3965, 0xA36B, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x20C2, 0x31A8, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422B, 0x420B, 
-0x422C, 0x39CA, 0x7BF3, 0xC61D, 0x6B50, 0x20A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x20C2, 0x31A8, 0x4A6D, 
-0x422C, 0x422C, 0x4A4C, 0x3A0B, 0x2146, 0x2147, 0x420B, 0x39CA, 0x8C95, 0xCE7D, 0x6B2F, 0x3103, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x20C2, 0x31A8, 0x4A6D, 0x422C, 0x4A4C, 0x422B, 0x2126, 0x0821, 0x2126, 0x420B, 0x422C, 0x39EB, 0x8434, 
-0xDEFE, 0x8C93, 0x28E3, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x20C2, 0x31A8, 0x4A6D, 0x4A6D, 0x3A0B, 0x2988, 0x2126, 
-0x0000, 0x2126, 0x420B, 0x4A4C, 0x31A9, 0x7BF2, 0xEF7F, 0x9D16, 0x1881, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20C2, 
-0x3188, 0x528E, 0x39EA, 0x2967, 0x1905, 0x1082, 0x1905, 0x2126, 0x3A0B, 0x4A4C, 0x31AA, 0x8413, 0xE73F, 0x9CD5, 0x18A2, 0xBBCD, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x2926, 0x420B, 0x4A6D, 0x420B, 0x31A9, 0x18E4, 0x0000, 0x2988, 0x39CA, 0x422C, 0x424C, 
-0x31AA, 0x8C54, 0xF7BF, 0x9494, 0x1882, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0841, 0x420B, 0x4A6D, 0x422B, 0x4A6D, 0x422C, 
-0x18E5, 0x0000, 0x2967, 0x4A4D, 0x4A4D, 0x422C, 0x39EB, 0x5B0F, 0xB599, 0xBDD9, 0x528A, 0x6A47, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x1061, 0x39EA, 0x4A4D, 0x424C, 0x422C, 0x3188, 0x10A3, 0x10A3, 0x2967, 0x39EA, 0x39EA, 0x422B, 0x4A4C, 0x2989, 0x630F, 0xE73E, 
-0xC65B, 0x1082, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x39EA, 0x4A4D, 0x4A4C, 0x39EA, 0x0882, 0x0841, 0x29A8, 0x2967, 0x2146, 
-0x2126, 0x39EA, 0x4A4C, 0x39CA, 0x7391, 0xDEFE, 0xAD98, 0x18A2, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x39EA, 0x4A4D, 0x4A4C, 
-0x39EA, 0x10A3, 0x0841, 0x2968, 0x2967, 0x2967, 0x2967, 0x39EB, 0x4A4C, 0x39CA, 0x7391, 0xDEFE, 0xAD98, 0x18A2, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x1061, 0x39EA, 0x4A4D, 0x4A4C, 0x39EA, 0x10A3, 0x0841, 0x2968, 0x2967, 0x422B, 0x422C, 0x422C, 0x424C, 0x39CA, 
-0x7391, 0xDEFE, 0xAD98, 0x18A2, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x39EA, 0x4A4C, 0x4A6D, 0x3A0B, 0x10A3, 0x0841, 0x2967, 
-0x2147, 0x422B, 0x4A4C, 0x424C, 0x422C, 0x39CA, 0x7391, 0xDEFE, 0xAD98, 0x18A2, 0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x39EA, 
-0x4A6D, 0x31C9, 0x2988, 0x10C4, 0x0841, 0x2988, 0x3A0B, 0x422C, 0x424C, 0x422C, 0x422C, 0x39CA, 0x7391, 0xDEFE, 0xAD98, 0x18A2, 
-0xAB8C, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x39EA, 0x4A6D, 0x420B, 0x29A8, 0x10A3, 0x0841, 0x31A8, 0x4A4C, 0x424C, 0x422C, 0x422C, 
-0x422C, 0x31CA, 0x73B1, 0xE73F, 0xAD78, 0x0841, 0xBBCD, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x0841, 0x420B, 0x4A6D, 0x4A4C, 0x424C, 0x1905, 
-0x0020, 0x2988, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x6B50, 0xC63C, 0xBDFA, 0x6B2E, 0x59E6, 0xB3AC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x51C6, 0x2946, 0x420B, 0x424C, 0x528E, 0x2967, 0x0000, 0x2988, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EB, 0x5ACF, 0xA518, 
-0xD69D, 0xDEFD, 0x2104, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x20C2, 0x3188, 0x4A6D, 0x4A6D, 0x2946, 0x0020, 0x39EA, 0x424C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x39EB, 0x6330, 0xB5BA, 0xCE7C, 0xC63B, 0x20E3, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x18A2, 0x31A9, 0x4A6D, 
-0x4A6D, 0x2967, 0x1083, 0x422B, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x39CA, 0x73B1, 0xD6DD, 0xCE5C, 0xC63B, 0x20E3, 0x932A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x28E2, 0x3188, 0x4A6D, 0x422C, 0x4A6D, 0x3188, 0x0841, 0x424C, 0x424C, 0x422C, 0x422C, 0x422C, 0x39CA, 
-0x7391, 0xD6BD, 0xCE5C, 0xC63B, 0x20E3, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x3103, 0x3188, 0x528E, 0x420B, 0x18E4, 0x0841, 
-0x4A4D, 0x4A4C, 0x422C, 0x422C, 0x422C, 0x39CA, 0x7391, 0xD6BD, 0xCE5C, 0xC63B, 0x20E3, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x28C2, 0x31A8, 0x4A6C, 0x2967, 0x2126, 0x0863, 0x0021, 0x424C, 0x4A4D, 0x422C, 0x422C, 0x31AA, 0x7BD2, 0xE75F, 0xDEFE, 0xD6BD, 
-0x2104, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x3965, 0x18E5, 0x0085, 0x31A8, 0x9C6E, 0x7B6A, 0x2104, 0x39EB, 0x4A6D, 
-0x4A4C, 0x424C, 0x528D, 0x632E, 0x630E, 0x5AEE, 0x1082, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4165, 0x4A07, 0x9C6F, 
-0x942E, 0xE653, 0xD5D2, 0x0020, 0x2127, 0x3A0B, 0x31C9, 0x39CA, 0x2968, 0x10A4, 0x10C5, 0x10C5, 0x0841, 0x932A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x5206, 0xBD2F, 0xDE33, 0xCD91, 0xC591, 0x62A8, 0x18E4, 0x10A4, 0x2126, 0x2147, 0x2147, 0x2967, 
-0x2967, 0x2167, 0x0841, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0x7A88, 0x3144, 0xE654, 0xC570, 0xBD30, 0xF6B5, 
-0x3143, 0x0000, 0x2106, 0x2988, 0x2967, 0x2967, 0x2967, 0x2167, 0x0841, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x51C6, 0x6B09, 0xE653, 0xCD91, 0xAC8D, 0xACAE, 0x20E2, 0x0001, 0x2106, 0x2968, 0x2967, 0x2967, 0x2967, 0x2167, 0x0841, 0x932A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x62A8, 0xDDF2, 0xBD30, 0xC550, 0xB50F, 0x1082, 0x0000, 0x0842, 0x2106, 0x2967, 
-0x2967, 0x2967, 0x2967, 0x2167, 0x0841, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4985, 0x0861, 0x18C2, 0x1081, 0x1081, 
-0x1081, 0x1063, 0x0020, 0x0862, 0x1083, 0x18E5, 0x2968, 0x2967, 0x2967, 0x2167, 0x0841, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xABAC, 0xAB8B, 0x6207, 0x0841, 0x18E5, 0x0842, 0x1083, 0x1083, 0x0841, 0x0841, 0x18E5, 0x2988, 0x2967, 0x2967, 0x2167, 
-0x0841, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x1082, 0x31A9, 0x2126, 0x10A3, 0x10A4, 0x0820, 
-0x0821, 0x2106, 0x2988, 0x2967, 0x2967, 0x2167, 0x0841, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 
-0x49A5, 0x18E4, 0x2967, 0x10A4, 0x1083, 0x0020, 0x0841, 0x18C4, 0x2106, 0x2967, 0x2967, 0x2167, 0x0841, 0x932A, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0820, 0x2967, 0x10A4, 0x1083, 0x0862, 0x0841, 0x0842, 0x18C4, 0x2968, 
-0x2967, 0x2167, 0x0841, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0861, 0x2947, 0x10A4, 
-0x1083, 0x18A4, 0x0841, 0x0000, 0x18E5, 0x2967, 0x2967, 0x2167, 0x0841, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x930A, 0x0861, 0x2947, 0x10A4, 0x1083, 0x1083, 0x0841, 0x0841, 0x18E5, 0x2967, 0x2967, 0x2167, 0x0841, 0x932A, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0841, 0x2947, 0x10A4, 0x1083, 0x0021, 0x0842, 0x1083, 
-0x18C4, 0x2968, 0x2967, 0x2967, 0x0841, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0861, 
-0x2967, 0x10A4, 0x0020, 0x0862, 0x1083, 0x1083, 0x18C5, 0x2968, 0x2967, 0x2967, 0x0861, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x1082, 0x2967, 0x2967, 0x10A4, 0x0020, 0x0842, 0x2105, 0x2967, 0x2106, 0x10A4, 0x10A3, 0x1062, 
-0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0x8AC9, 0x0861, 0x2988, 0x18C4, 0x10A4, 0x0020, 0x0821, 
-0x2106, 0x29A8, 0x2106, 0x1062, 0x1083, 0x0020, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x28E3, 
-0x2126, 0x2967, 0x1063, 0x0841, 0x0841, 0x18C4, 0x2147, 0x2967, 0x2967, 0x1905, 0x0821, 0x7A88, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x10A3, 0x31A8, 0x18E5, 0x1083, 0x0000, 0x0842, 0x2126, 0x2988, 0x2967, 0x2146, 0x20E4, 
-0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x1083, 0x2147, 0x1062, 0x1083, 0x0020, 
-0x10A3, 0x2147, 0x2967, 0x31A8, 0x1905, 0x20C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 
-0x4985, 0x18E4, 0x2147, 0x1083, 0x1083, 0x0000, 0x2126, 0x2988, 0x2967, 0x2147, 0x18C4, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4164, 0x18C4, 0x31A9, 0x2106, 0x1083, 0x1063, 0x0020, 0x2126, 0x2968, 0x2988, 0x18C4, 
-0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x18C4, 0x2147, 0x1083, 0x1083, 
-0x0020, 0x1083, 0x2126, 0x2967, 0x2988, 0x18C4, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x51C5, 0x18C4, 0x2127, 0x1083, 0x1063, 0x0020, 0x2126, 0x2967, 0x2988, 0x10C4, 0x51A5, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x59E6, 0x18C3, 0x2988, 0x2126, 0x0842, 0x0841, 0x2126, 0x2967, 0x2967, 0x2988, 
-0x10A3, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x1905, 0x2968, 0x18A4, 
-0x0842, 0x0000, 0x2168, 0x2167, 0x2147, 0x2188, 0x10A3, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x7268, 0x20A2, 0x18C4, 0x10C4, 0x0842, 0x1061, 0x3103, 0x3986, 0x3986, 0x3986, 0x41A7, 0x18A2, 0x6A27, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x1061, 0x28C3, 0x28C4, 0x18A3, 0x0841, 0x1881, 0x6207, 0x51A5, 0x51A5, 
-0x51A5, 0x59C6, 0x3944, 0x3103, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x20C2, 0x20A2, 0x30E4, 
-0x30E4, 0x1882, 0x0820, 0x3944, 0x51A6, 0x51A6, 0x51A5, 0x4985, 0x59E7, 0x4144, 0x20C2, 0x9B2A, 0x930A, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBED, 0x20C2, 0x20A2, 0x30E4, 0x30E4, 0x20A2, 0x0020, 0x0841, 0x4144, 0x4144, 0x4985, 0x51A5, 0x49A5, 0x59C6, 
-0x4144, 0x0841, 0x1882, 0x9B2B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x20C2, 0x20A2, 0x30E4, 0x28C3, 0x28C3, 0x30E4, 0x28C3, 
-0x0000, 0x0000, 0x3944, 0x51C6, 0x49A5, 0x49A5, 0x51A6, 0x51C6, 0x4985, 0x1061, 0xAB8B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
-
-// zombie1_walk_right_9.png
-// Size: 54x75 (8100 bytes)
-const uint16_t zombie1_walk_right_9_bmp[4050] = {
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0xBBED, 0xBBED, 0xBBED, 0xBBED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 
-0x1061, 0x20C2, 0x20C2, 0x20A2, 0x18A2, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x20C3, 0x49E7, 0x41C6, 0x39A6, 0x3145, 0x3166, 0x1882, 0xB3AC, 0xC40D, 0xC3ED, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x20E3, 0x5228, 0x6ACB, 0x5A6A, 0x5A8A, 0xA46F, 
-0xA48F, 0x8BEC, 0x3123, 0xABAC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x28E3, 
-0x39A6, 0x6AEB, 0x4A08, 0x5A69, 0x9C4E, 0xD5F2, 0xD5F2, 0xF6B5, 0x836A, 0x20C2, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x41E7, 0x5A6A, 0x5A8A, 0x9C4E, 0xDE12, 0xC591, 0xCDB1, 0xB4CF, 0xE673, 0x8BEB, 
-0x20C2, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4A07, 0x62CB, 0x4A08, 0x83AC, 0xDE33, 
-0xC571, 0xC591, 0xC550, 0xB4EE, 0xDE34, 0xE633, 0x7308, 0x20C2, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x41C7, 0x62AA, 0x4A08, 0x838C, 0xD5F2, 0xCD91, 0xC571, 0x93CB, 0xEEF5, 0x830B, 0x936C, 0xDE12, 0x7B29, 0x2903, 0xB3CC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41C7, 0x62AA, 0x4A08, 0x838C, 0xD5F2, 0xCDB1, 0xC550, 0x61E8, 0x5126, 
-0xA42E, 0xCDD2, 0xCD91, 0xD5D2, 0x942D, 0x20C2, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x41C7, 0x62AA, 0x5229, 
-0x4A08, 0x7B6C, 0xDE12, 0xC591, 0xB4EF, 0xB4AF, 0xC551, 0xCDB1, 0xD5F2, 0xA44E, 0x40E5, 0x2863, 0x20C2, 0xB3CC, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x4A08, 0x5A6A, 0x838C, 0xBD10, 0x8BED, 0x730B, 0xCDB2, 0xCDD2, 0xCDD2, 0xCD91, 0xC571, 0xD612, 0x93AC, 
-0x2002, 0x4926, 0x940C, 0x3944, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18C2, 0x39A7, 0xACD0, 0xFF15, 0xCD91, 0x93ED, 0xAC8D, 
-0xC571, 0xCD91, 0xC591, 0xC591, 0xDE13, 0x93AC, 0x0800, 0x4926, 0xEE94, 0x2903, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 
-0x18C3, 0x4A07, 0x7B6B, 0xBD11, 0xEE73, 0xACAE, 0xCD91, 0xCDB2, 0xCD91, 0xC571, 0xD5D2, 0xB4F0, 0x7AEA, 0x7AE9, 0x62C8, 0x59E6, 
-0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AC9, 0x4164, 0x28C3, 0x41C7, 0x940C, 0xDE33, 0xBD0F, 0xB4EF, 0xC571, 0xCDD2, 
-0xBD50, 0xCD90, 0xCDB0, 0x5A86, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x20A2, 
-0x3123, 0x9C2D, 0xA46D, 0x9BEB, 0xB4CE, 0xC571, 0xB4CE, 0x9BEB, 0x4A05, 0x4985, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x1061, 0xBD30, 0xB4EE, 0x9C0B, 0x9C0B, 0xA44C, 0x5246, 0x4985, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x18A2, 0xB4EF, 0xD5D2, 
-0xACAE, 0xB48D, 0x5A46, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x9B2A, 0x18A2, 0x420B, 0x4A6C, 0xBD31, 0xDE12, 0xC54F, 0x5205, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA34B, 0x0841, 0x4A4C, 0x420C, 0x5ACD, 0x5AAD, 0xBD31, 0x7B49, 0x4985, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x2904, 0x31A9, 0x422C, 
-0x422C, 0x3A0B, 0x31CB, 0x6B2E, 0x630D, 0x20E5, 0x7247, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7248, 0x18C3, 0x52AE, 0x422C, 0x422C, 0x4A6D, 0x39EA, 0x2148, 0x31AA, 0x31A8, 0x1082, 0x7248, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x10A3, 0x4A6D, 0x422C, 0x4A4C, 0x39EA, 0x31A8, 0x3188, 
-0x31A9, 0x31A9, 0x2147, 0x1082, 0x7267, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x10A3, 
-0x4A6D, 0x422C, 0x39EA, 0x2988, 0x420B, 0x4A6D, 0x4A6D, 0x420B, 0x2988, 0x2988, 0x2966, 0x7268, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x10A3, 0x4A6D, 0x422C, 0x2988, 0x422B, 0x4A4C, 0x422C, 0x422C, 0x4A4C, 0x39EA, 0x420A, 
-0xB57A, 0x18A3, 0x932A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x10A3, 0x4A6D, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x420B, 0x5ACE, 0xBDDA, 0x2945, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7A88, 0x10A3, 0x4A6D, 0x422C, 0x2988, 0x2147, 0x39EA, 0x4A4C, 0x422C, 0x422C, 0x424C, 0x420B, 0x31C9, 0xB5B9, 0x39A7, 0x82C9, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x10A3, 0x4A6D, 0x422C, 0x2967, 0x2126, 0x39EA, 0x4A4C, 0x422C, 0x422C, 
-0x4A4C, 0x39EB, 0x2147, 0xD6BD, 0x3166, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x10A3, 0x4A6D, 0x422C, 
-0x2967, 0x2126, 0x3A0B, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x39EA, 0x52AC, 0x9494, 0x4A08, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7A88, 0x10A3, 0x4A6D, 0x422C, 0x2147, 0x2146, 0x2988, 0x420B, 0x4A4C, 0x422C, 0x422C, 0x424C, 0x422C, 0x0884, 
-0xD6BD, 0x632D, 0x61E6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x10A3, 0x4A6D, 0x422C, 0x39CA, 0x2967, 0x1926, 0x39EA, 
-0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x31A9, 0x7C12, 0x2125, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x18C3, 
-0x528E, 0x424C, 0x4A6D, 0x2988, 0x2146, 0x31A9, 0x422B, 0x424C, 0x422C, 0x422C, 0x424C, 0x4A6D, 0x18E6, 0x39C8, 0x5A28, 0xABAC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x20C3, 0x39EA, 0x424C, 0x4A4C, 0x2988, 0x2147, 0x2126, 0x31C9, 0x4A6D, 0x422C, 0x422C, 
-0x424C, 0x420B, 0x10C5, 0xBDFA, 0x7BF1, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0861, 0x424C, 0x4A4C, 0x2988, 
-0x2147, 0x2126, 0x31A8, 0x4A4C, 0x424C, 0x422C, 0x422B, 0x2967, 0x18E5, 0xA517, 0x632E, 0x51C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x930A, 0x1062, 0x424C, 0x4A4C, 0x2988, 0x2968, 0x0882, 0x0882, 0x39CA, 0x4A6D, 0x420B, 0x2967, 0x2147, 0x39EB, 0x52AE, 
-0x2126, 0x51C5, 0xC40D, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x1062, 0x424C, 0x4A4C, 0x2988, 0x2126, 0x39CA, 0x2105, 0x0862, 
-0x31CA, 0x422C, 0x420B, 0x420B, 0x422C, 0x422C, 0x424C, 0x2926, 0x1881, 0x4164, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x1062, 0x424C, 
-0x424C, 0x420B, 0x39EA, 0x4A8D, 0x2105, 0x0000, 0x39EA, 0x4A6D, 0x4A6D, 0x4A4C, 0x424C, 0x422C, 0x4A6D, 0x420B, 0x31A9, 0x2967, 
-0x3103, 0x3103, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x930A, 0x1062, 0x424C, 0x424C, 0x4A4C, 0x4A4C, 0x4A4D, 0x39EA, 0x18C4, 0x10A3, 0x39EA, 0x39EA, 0x4A4C, 
-0x4A6D, 0x424C, 0x422C, 0x4A4C, 0x4A8D, 0x422C, 0x2967, 0x2967, 0x4164, 0x3944, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0841, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 
-0x528E, 0x39CA, 0x0041, 0x0862, 0x1082, 0x31C9, 0x39EA, 0x424C, 0x4A6D, 0x424C, 0x422C, 0x4A4C, 0x528D, 0x4A8D, 0x18C6, 0x5AA8, 
-0x49C5, 0x6206, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x51C6, 
-0x2126, 0x422C, 0x424C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422C, 0x2968, 0x0041, 0x0841, 0x1082, 0x1083, 0x2105, 0x31A9, 0x424C, 
-0x4A6D, 0x4A4D, 0x422C, 0x422C, 0x734F, 0xDE34, 0x8BEB, 0x4A06, 0x41A5, 0x82C9, 0x8AE9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7247, 0x18C4, 0x52AE, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x422C, 0x31A9, 
-0x31A9, 0x10A3, 0x0841, 0x0000, 0x0862, 0x2947, 0x39C9, 0x39CA, 0x4A4C, 0x4A4C, 0xCDB2, 0xD5D1, 0xD5D2, 0xF6D5, 0x9C4D, 0x2923, 
-0x3164, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x10A3, 0x4A6D, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x4A4C, 0x4A4C, 0x4A6D, 0x31C9, 0x31A9, 0x18E5, 0x0000, 0x0840, 0x20C3, 0x39EB, 0x39EA, 
-0x9C4E, 0xCD91, 0xCDB1, 0xC571, 0xCD91, 0xDE13, 0xB50F, 0x20E2, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7A88, 0x10A3, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x422C, 0x424C, 0x422C, 0x422C, 
-0x4A6D, 0x2947, 0x4985, 0xAB8C, 0x1061, 0x1041, 0x1061, 0x93EC, 0xD5F2, 0xCDB2, 0xBD0F, 0x9BEB, 0xAC8D, 0xBD50, 0x18C2, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x10A3, 0x4A6D, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x424C, 0x424C, 0x528E, 0x2947, 0x4144, 0xC40D, 0xAB8C, 0xAB8C, 0xB3AC, 0x3123, 0x8BCC, 0xDE33, 
-0xCD70, 0x6AC8, 0x3144, 0xCDB2, 0x18C2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x10A3, 0x4A6D, 0x422C, 
-0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x422C, 0x528E, 0x2947, 0x4165, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x3103, 0x8BCC, 0xFF77, 0x9C2D, 0x28E2, 0x8AE9, 0x2944, 0x0820, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x6A47, 0x18C4, 0x52AE, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4C, 0x4A4D, 0x4A6D, 0x4A6D, 0x4A4D, 
-0x4A4C, 0x4A6D, 0x420B, 0x2947, 0x18C3, 0x6207, 0xC40D, 0xC40D, 0xC40D, 0x20A2, 0x3144, 0x5A67, 0x3985, 0xABAC, 0xC40D, 0x7AA8, 
-0x7AA8, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xAB8C, 0x4985, 0x2946, 0x31C9, 0x31C9, 0x39CA, 0x39EA, 0x39EA, 
-0x39EA, 0x39EA, 0x31C9, 0x2947, 0x2947, 0x31A9, 0x31C9, 0x39CA, 0x2968, 0x2988, 0x2126, 0x1881, 0xC3ED, 0xC40D, 0xC40D, 0x82A9, 
-0x6206, 0x59E6, 0x9B2A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 
-0x0020, 0x2147, 0x2147, 0x1905, 0x18E5, 0x18E5, 0x18E5, 0x18E5, 0x18C4, 0x0842, 0x0862, 0x2146, 0x2147, 0x2146, 0x2147, 0x2988, 
-0x18E5, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC3ED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x930A, 0x0841, 0x2967, 0x2967, 0x1083, 0x0842, 0x1063, 0x1063, 0x1063, 0x1063, 0x1083, 
-0x1083, 0x2106, 0x2147, 0x2967, 0x2967, 0x2968, 0x2106, 0x20C3, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B2A, 0x0841, 0x2967, 0x2967, 0x18C5, 
-0x10A4, 0x10A3, 0x1083, 0x1083, 0x1083, 0x1083, 0x1083, 0x1063, 0x2126, 0x2967, 0x2967, 0x2967, 0x2988, 0x2146, 0x0841, 0xB3CC, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x82C9, 0x0861, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E5, 0x1063, 0x1083, 0x1062, 0x0020, 0x1083, 0x1083, 0x2126, 0x2967, 
-0x2967, 0x2967, 0x2968, 0x2126, 0x1881, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x82A9, 0x1082, 0x2967, 0x2967, 0x2967, 0x2967, 0x2988, 0x18E5, 0x1063, 0x10A4, 
-0x1082, 0x0820, 0x1083, 0x1083, 0x2126, 0x2967, 0x2967, 0x2967, 0x2968, 0x2126, 0x1881, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0882, 0x2988, 0x2967, 
-0x2967, 0x2967, 0x18E5, 0x1083, 0x18A4, 0x1083, 0x20A2, 0x9B2A, 0x1061, 0x1083, 0x10A4, 0x2126, 0x2967, 0x2967, 0x2968, 0x2126, 
-0x1881, 0xB3CC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x7A88, 0x0862, 0x2968, 0x2967, 0x2967, 0x2967, 0x18C4, 0x1083, 0x1062, 0x2903, 0xAB8C, 0xB3AC, 0x0020, 0x1083, 
-0x1063, 0x2126, 0x2988, 0x2947, 0x2968, 0x2105, 0x1881, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A88, 0x0862, 0x2968, 0x2967, 0x2967, 0x2967, 0x18C4, 0x18A4, 
-0x0862, 0x3123, 0xC40D, 0xBBED, 0x7268, 0x1082, 0x1083, 0x18C4, 0x2126, 0x2967, 0x2967, 0x2147, 0x18C4, 0x51A5, 0xB3CC, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x8AE9, 0x0841, 
-0x2968, 0x2967, 0x2967, 0x2988, 0x18E5, 0x0862, 0x20C3, 0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0x1061, 0x1083, 0x1063, 0x1905, 0x2988, 
-0x2947, 0x2968, 0x2967, 0x0020, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xB3AC, 0x49A5, 0x18C4, 0x2967, 0x2967, 0x2967, 0x2126, 0x18C5, 0x0841, 0x59E6, 0xC40D, 0xC40D, 0xC40D, 
-0xBBED, 0x51C6, 0x1082, 0x1063, 0x18C5, 0x2147, 0x2967, 0x2967, 0x2146, 0x0841, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51C6, 0x10A3, 0x31A9, 0x2967, 0x2967, 0x2147, 0x0863, 
-0x0862, 0x1062, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x0862, 0x1063, 0x18C4, 0x2967, 0x2967, 0x2146, 0x0841, 
-0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 
-0x1083, 0x2988, 0x2147, 0x2167, 0x39C8, 0x3166, 0x0861, 0x7268, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xB3CC, 0x28E3, 0x1062, 
-0x1083, 0x1063, 0x18C4, 0x2988, 0x2147, 0x0841, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6207, 0x1083, 0x2988, 0x2147, 0x2987, 0xB510, 0xDE13, 0x41C5, 0x7247, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xBBCD, 0x20A2, 0x1062, 0x1083, 0x1083, 0x1083, 0x18C4, 0x2988, 0x2146, 0x1061, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x6A47, 0x1082, 0x2968, 0x31A8, 0x93EB, 
-0xBCEE, 0x41E5, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x1881, 0x0862, 0x2106, 0x2147, 0x2147, 0x2126, 0x1083, 
-0x1082, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0x7268, 0x18C3, 0x2147, 0x2147, 0x4209, 0xB4AD, 0x3984, 0x6A47, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x1881, 
-0x0862, 0x2126, 0x2988, 0x2988, 0x1905, 0x18A2, 0x9B4B, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x4144, 0x18C4, 0x31A9, 0x2126, 0x2105, 0x49E7, 0x0000, 0xA36B, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBCD, 0x1881, 0x0862, 0x2126, 0x2967, 0x31A8, 0x2126, 0x1881, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x49A5, 0x10C3, 0x29A8, 0x2126, 
-0x0842, 0x0021, 0x51C6, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x18A2, 0x0841, 0x2106, 0x2988, 0x2126, 
-0x20E3, 0x82A9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0x49A5, 0x10C3, 0x29A8, 0x2147, 0x1062, 0x1061, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 
-0x7A88, 0x1082, 0x10A4, 0x2147, 0x31A9, 0x18C4, 0x3924, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x51A5, 0x10C3, 0x2988, 0x2105, 0x1063, 0x0841, 0xAB8C, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0020, 0x1083, 0x2947, 0x2988, 0x2147, 0x18C3, 0x6227, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xBBED, 0x4164, 0x18E5, 
-0x2126, 0x1063, 0x1082, 0x28C2, 0xB3AC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xABAC, 0x0841, 0x1062, 0x2126, 0x31A9, 
-0x10A3, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x3923, 0x18E4, 0x29A8, 0x2126, 0x0842, 0x20A2, 0xBBCC, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xA36B, 0x1061, 0x1083, 0x2126, 0x2988, 0x10A3, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3103, 0x18E4, 0x31A9, 0x2126, 0x0842, 0x20A2, 0xBBED, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x9B4B, 0x1882, 0x4165, 0x4985, 0x20E4, 0x0041, 0x6207, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3924, 
-0x18E5, 0x2147, 0x10A4, 0x1062, 0x20A2, 0xBBED, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xA36B, 0x0820, 0x51A6, 0x51A6, 
-0x4165, 0x4165, 0x28E3, 0x7A88, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3924, 0x1905, 0x2106, 0x0842, 0x0842, 0x20A2, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x9B2B, 0x3103, 0x3944, 0x49A5, 0x49A5, 0x51A6, 0x6207, 0x20C2, 0x59C6, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3924, 0x18E5, 0x2168, 0x1906, 0x1906, 
-0x18E4, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7A68, 0x1881, 0x59E6, 0x51A5, 0x49A5, 0x49A5, 0x51A6, 0x4144, 0x3103, 
-0x8AC9, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0x3924, 0x18A3, 0x3146, 0x2946, 0x3146, 0x2926, 0x1061, 0x6206, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x7268, 0x1881, 0x59E6, 
-0x51C6, 0x51C6, 0x51A6, 0x4985, 0x6207, 0x3103, 0x28E3, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3924, 0x1882, 0x30C3, 0x28C3, 0x28C3, 0x30C3, 0x30E4, 0x1061, 0x6A27, 
-0x930A, 0x82A9, 0xB3CC, 0xAB8C, 0x28C2, 0x3944, 0x3924, 0x3924, 0x49A5, 0x51A6, 0x51C6, 0x3944, 0x3103, 0x932A, 0x930A, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0x3924, 0x1882, 0x30E4, 
-0x28C3, 0x28C3, 0x28C3, 0x28E3, 0x30E4, 0x1061, 0x0820, 0x0841, 0x3944, 0xC40D, 0xABAC, 0x18A2, 0x20C2, 0x28E3, 0x3124, 0x49A5, 
-0x51A5, 0x59C6, 0x4144, 0x0841, 0x1881, 0x930A, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0x3924, 0x1882, 0x30E4, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28C3, 0x28E3, 0x3104, 0x1882, 0x3944, 
-0xC40D, 0xBBED, 0xBBED, 0xC40D, 0x28E3, 0x3104, 0x51C6, 0x49A5, 0x51A6, 0x51C6, 0x4985, 0x1061, 0xA36B, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 0xC40D, 
-0xC40D, 0xC40D, 
-};
@@ -10,4 +10,8 @@
 
 #ifndef CONSTRAIN
 #define CONSTRAIN(val, low, high) ((val) < (low) ? (low) : ((val) > (high) ? (high) : (val)))
+#endif
+
+#ifndef ABS
+#define ABS(a) ((a) < 0 ? -(a) : (a))
 #endif
\ No newline at end of file